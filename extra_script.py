@@ -1,15 +1,55 @@
 #!/usr/bin/env python3
+import os
 import subprocess
 from SCons.Script import Import, DefaultEnvironment
 
+def newest_input(paths):
+    # Newest modification time of the files and the folder trees given
+    newest = 0
+    for path in paths:
+        if os.path.isdir(path):
+            for folder, _, files in os.walk(path):
+                newest = max([newest, os.path.getmtime(folder)] + [os.path.getmtime(os.path.join(folder, f)) for f in files])
+        elif os.path.exists(path):
+            newest = max(newest, os.path.getmtime(path))
+    return newest
+
+def is_stale(inputs, outputs):
+    # A generator runs again when an output is missing or older than its inputs or itself
+    if not all(os.path.exists(output) for output in outputs):
+        return True
+    return min(os.path.getmtime(output) for output in outputs) < newest_input(inputs)
+
 env = DefaultEnvironment()
 if not ("IsCleanTarget" in dir(env) and env.IsCleanTarget()) and not env.IsIntegrationDump():
     Import("env")
 
     print("Running custom script before build...")
-    command = ["python3", "scripts/image_to_code.py", "resources/images", "StaticImages", "lib/images"]
-    result = subprocess.run(command, capture_output=True, text=True)
-    if result.returncode != 0:
-        print(f"Error running script: {result.stderr}")
-    else:
-        print(result.stdout)
+    luts_path = env.subst("$BUILD_DIR/luts.bin")
+    # Command, its inputs, its outputs
+    generators = [
+        (["python3", "scripts/atlas_to_code.py", "resources/images", "UiSprites", "lib/images"],
+         ["scripts/atlas_to_code.py", "resources/images"], ["lib/images/UiSprites.h", "lib/images/UiSprites.c"]),
+        (["python3", "scripts/border_to_code.py", "resources/images/borders", "BorderTiles", "lib/images"],
+         ["scripts/border_to_code.py", "resources/images/borders"], ["lib/images/BorderTiles.h", "lib/images/BorderTiles.c"]),
+        (["python3", "scripts/grain_to_code.py", "resources/grain", "GrainTiles", "lib/images"],
+         ["scripts/grain_to_code.py", "resources/grain"], ["lib/images/GrainTiles.h", "lib/images/GrainTiles.c"]),
+        (["python3", "scripts/cube_to_lut.py", "resources/luts", luts_path],
+         ["scripts/cube_to_lut.py", "resources/luts"], [luts_path]),
+    ]
+    for command, inputs, outputs in generators:
+        if not is_stale(inputs, outputs):
+            print(f"{command[1]}: up to date")
+            continue
+        result = subprocess.run(command, capture_output=True, text=True)
+        if result.returncode != 0:
+            print(f"Error running script: {result.stderr}")
+        else:
+            print(result.stdout)
+
+    # The LUT blob is flashed with the firmware, at the offset of its partition
+    with open("partitions.csv") as partitions:
+        for line in partitions:
+            fields = [field.strip() for field in line.split("#")[0].split(",")]
+            if fields[0] == "luts":
+                env.Append(FLASH_EXTRA_IMAGES=[(fields[3], luts_path)])
@@ -0,0 +1,154 @@
+#include "BatterySampler.h"
+
+/**
+ * @brief Point of the discharge curve.
+ */
+struct DischargePoint {
+    float voltage;  ///< Resting cell voltage, in volts.
+    float charge;   ///< State of charge, in percent.
+};
+
+// Resting voltage of a 1S Li-ion cell discharged at a low rate, highest voltage first
+static const DischargePoint DISCHARGE_CURVE[] = {
+    {4.20f, 100.0f}, {4.15f, 95.0f}, {4.11f, 90.0f}, {4.08f, 85.0f}, {4.02f, 80.0f},
+    {3.98f, 75.0f},  {3.95f, 70.0f}, {3.91f, 65.0f}, {3.87f, 60.0f}, {3.85f, 55.0f},
+    {3.84f, 50.0f},  {3.82f, 45.0f}, {3.80f, 40.0f}, {3.79f, 35.0f}, {3.77f, 30.0f},
+    {3.75f, 25.0f},  {3.73f, 20.0f}, {3.71f, 15.0f}, {3.69f, 10.0f}, {3.61f, 5.0f},
+    {3.27f, 0.0f},
+};
+#define DISCHARGE_CURVE_POINTS (sizeof(DISCHARGE_CURVE) / sizeof(DISCHARGE_CURVE[0]))
+
+BatterySampler::BatterySampler(float dividerRatio) : dividerRatio(dividerRatio) {
+    reset();
+}
+
+void BatterySampler::reset() {
+    windowCount = 0;
+    voltage = 0.0f;
+    stateOfCharge = 0.0f;
+    rateReferenceValid = false;
+    rateReferenceMs = 0;
+    rateReferenceCharge = 0.0f;
+    rateValid = false;
+    dischargeRate = 0.0f;
+}
+
+float BatterySampler::addBurst(uint16_t* millivolts, int count, uint32_t timeMs) {
+    if (count <= 0) {
+        return voltage;
+    }
+    if (count > BATTERY_BURST_SAMPLES) {
+        count = BATTERY_BURST_SAMPLES;
+    }
+
+    // Sort the burst, insertion sort is enough for a few dozen readings
+    for (int i = 1; i < count; i++) {
+        uint16_t value = millivolts[i];
+        int j = i - 1;
+        while (j >= 0 && millivolts[j] > value) {
+            millivolts[j + 1] = millivolts[j];
+            j--;
+        }
+        millivolts[j + 1] = value;
+    }
+
+    // Average the middle half: spikes are dropped, the noise is averaged out
+    int first = count / 4;
+    int last = count - count / 4;
+    uint32_t sum = 0;
+    for (int i = first; i < last; i++) {
+        sum += millivolts[i];
+    }
+    float windowVoltage = (float) sum / (float) (last - first) / 1000.0f * dividerRatio;
+
+    // Median of the last three windows drops a single load sag
+    if (windowCount < 3) {
+        windowVoltages[windowCount++] = windowVoltage;
+    } else {
+        windowVoltages[0] = windowVoltages[1];
+        windowVoltages[1] = windowVoltages[2];
+        windowVoltages[2] = windowVoltage;
+    }
+    float median = windowVoltage;
+    if (windowCount == 3) {
+        float a = windowVoltages[0];
+        float b = windowVoltages[1];
+        float c = windowVoltages[2];
+        median = (a > b) ? ((b > c) ? b : ((a > c) ? c : a)) : ((a > c) ? a : ((b > c) ? c : b));
+    }
+
+    // Exponential moving average, started on the first window
+    if (windowCount == 1) {
+        voltage = median;
+    } else {
+        voltage += BATTERY_EMA_ALPHA * (median - voltage);
+    }
+    stateOfCharge = voltageToStateOfCharge(voltage);
+
+    updateDischargeRate(timeMs);
+    return voltage;
+}
+
+void BatterySampler::updateDischargeRate(uint32_t timeMs) {
+    if (!rateReferenceValid) {
+        rateReferenceValid = true;
+        rateReferenceMs = timeMs;
+        rateReferenceCharge = stateOfCharge;
+        return;
+    }
+
+    uint32_t elapsedMs = timeMs - rateReferenceMs;
+    if (elapsedMs < BATTERY_RATE_WINDOW_MS) {
+        return;
+    }
+
+    float drop = rateReferenceCharge - stateOfCharge;
+    if (drop < -BATTERY_CHARGING_RISE) {
+        // Charging, the previous rate no longer applies
+        rateValid = false;
+        rateReferenceMs = timeMs;
+        rateReferenceCharge = stateOfCharge;
+        return;
+    }
+
+    // A small rise is noise on a flat part of the curve
+    float rate = (drop > 0.0f ? drop : 0.0f) / ((float) elapsedMs / 1000.0f);
+    if (!rateValid) {
+        dischargeRate = rate;
+        rateValid = true;
+    } else {
+        dischargeRate += BATTERY_RATE_ALPHA * (rate - dischargeRate);
+    }
+    rateReferenceMs = timeMs;
+    rateReferenceCharge = stateOfCharge;
+}
+
+float BatterySampler::getVoltage() const {
+    return voltage;
+}
+
+float BatterySampler::getStateOfCharge() const {
+    return stateOfCharge;
+}
+
+long BatterySampler::getTimeToEmptySeconds() const {
+    if (!rateValid || dischargeRate <= 0.0f) {
+        return BATTERY_UNKNOWN_TIME;
+    }
+    return (long) (stateOfCharge / dischargeRate);
+}
+
+float BatterySampler::voltageToStateOfCharge(float voltage) {
+    if (voltage >= DISCHARGE_CURVE[0].voltage) {
+        return DISCHARGE_CURVE[0].charge;
+    }
+    // Interpolate linearly inside the segment of the curve holding the voltage
+    for (unsigned int i = 1; i < DISCHARGE_CURVE_POINTS; i++) {
+        const DischargePoint& low = DISCHARGE_CURVE[i];
+        if (voltage >= low.voltage) {
+            const DischargePoint& high = DISCHARGE_CURVE[i - 1];
+            return low.charge + (voltage - low.voltage) * (high.charge - low.charge) / (high.voltage - low.voltage);
+        }
+    }
+    return DISCHARGE_CURVE[DISCHARGE_CURVE_POINTS - 1].charge;
+}
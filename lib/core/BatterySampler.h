@@ -0,0 +1,114 @@
+#ifndef RETROLENS_BATTERY_SAMPLER_H
+#define RETROLENS_BATTERY_SAMPLER_H
+
+#include <stdint.h>
+
+// Samples taken per enable window of the voltage divider
+#define BATTERY_BURST_SAMPLES 64
+
+// Weight of a new window in the voltage average
+#define BATTERY_EMA_ALPHA 0.3f
+
+// Discharge rate measurement
+#define BATTERY_RATE_WINDOW_MS 600000 // Minimum time between two state of charge points
+#define BATTERY_RATE_ALPHA 0.15f      // Weight of a new discharge rate in its average
+#define BATTERY_CHARGING_RISE 3.0f    // State of charge rise, in percent, that means the battery charges
+
+#define BATTERY_UNKNOWN_TIME -1
+
+/**
+ * @class BatterySampler
+ * @brief Turns bursts of calibrated ADC readings into a filtered battery voltage, a state of
+ *        charge and a time-to-empty estimate.
+ *
+ * Each burst is sorted and the middle half averaged, which rejects spikes like a median while
+ * keeping the resolution gain of oversampling. The last three window voltages go through a
+ * median, dropping a single load sag, then an exponential moving average. The state of charge
+ * comes from a Li-ion discharge curve lookup table, and the time-to-empty from the averaged
+ * slope of the state of charge over windows of at least BATTERY_RATE_WINDOW_MS.
+ *
+ * Example usage:
+ * @code
+ * BatterySampler sampler(2.0f);
+ * uint16_t millivolts[BATTERY_BURST_SAMPLES];
+ * // Fill millivolts with calibrated ADC readings of the divider
+ * sampler.addBurst(millivolts, BATTERY_BURST_SAMPLES, millis());
+ * float percentage = sampler.getStateOfCharge();
+ * @endcode
+ */
+class BatterySampler {
+public:
+    /**
+     * @brief Construct a new Battery Sampler object.
+     *
+     * @param dividerRatio Battery voltage divided by the voltage at the ADC pin.
+     */
+    BatterySampler(float dividerRatio);
+
+    /**
+     * @brief Forget every window, the next burst restarts the averages.
+     */
+    void reset();
+
+    /**
+     * @brief Add a burst of readings taken during one enable window.
+     *
+     * @param millivolts Calibrated readings at the ADC pin, sorted in place.
+     * @param count Number of readings, at most BATTERY_BURST_SAMPLES.
+     * @param timeMs Time of the burst.
+     * @return float Filtered battery voltage, in volts.
+     */
+    float addBurst(uint16_t* millivolts, int count, uint32_t timeMs);
+
+    /**
+     * @brief Get the filtered battery voltage.
+     *
+     * @return float Voltage in volts, 0 before the first burst.
+     */
+    float getVoltage() const;
+
+    /**
+     * @brief Get the state of charge of the filtered voltage.
+     *
+     * @return float State of charge in percent.
+     */
+    float getStateOfCharge() const;
+
+    /**
+     * @brief Get the estimated time until the battery is empty.
+     *
+     * @return long Seconds, or BATTERY_UNKNOWN_TIME while charging or before a rate is known.
+     */
+    long getTimeToEmptySeconds() const;
+
+    /**
+     * @brief Convert a resting battery voltage to a state of charge with the discharge curve.
+     *
+     * @param voltage Battery voltage in volts.
+     * @return float State of charge in percent, clamped to 0-100.
+     */
+    static float voltageToStateOfCharge(float voltage);
+
+private:
+    /**
+     * @brief Update the discharge rate with the current state of charge.
+     *
+     * @param timeMs Time of the current window.
+     */
+    void updateDischargeRate(uint32_t timeMs);
+
+    float dividerRatio;        ///< Battery voltage over ADC pin voltage.
+    float windowVoltages[3];   ///< Voltages of the last windows, for the median.
+    int windowCount;           ///< Number of windows added, saturates at 3.
+    float voltage;             ///< Filtered battery voltage.
+    float stateOfCharge;       ///< State of charge of the filtered voltage.
+
+    // Discharge rate
+    bool rateReferenceValid;   ///< True once a reference point is set.
+    uint32_t rateReferenceMs;  ///< Time of the reference point.
+    float rateReferenceCharge; ///< State of charge at the reference point.
+    bool rateValid;            ///< True once a discharge rate is averaged.
+    float dischargeRate;       ///< Averaged discharge rate, in percent per second.
+};
+
+#endif // RETROLENS_BATTERY_SAMPLER_H
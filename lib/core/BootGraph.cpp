@@ -0,0 +1,119 @@
+#include "BootGraph.h"
+
+BootGraph::BootGraph()
+    : stageCount(0), doneMask(0), takenMask(0), criticalMask(0), started(false), startUs(0), readyUs(0) {}
+
+int BootGraph::addStage(const char* name, uint32_t dependencies, bool deferred) {
+    if (stageCount >= BOOT_MAX_STAGES || started) {
+        return BOOT_INVALID_STAGE;
+    }
+    // Only earlier stages, which also rules out cycles
+    uint32_t existing = BOOT_STAGE_MASK(stageCount) - 1;
+    if ((dependencies & ~existing) != 0) {
+        return BOOT_INVALID_STAGE;
+    }
+    // A critical stage cannot wait for a deferred one
+    if (!deferred) {
+        for (int i = 0; i < stageCount; i++) {
+            if ((dependencies & BOOT_STAGE_MASK(i)) && stages[i].deferred) {
+                return BOOT_INVALID_STAGE;
+            }
+        }
+    }
+
+    int stage = stageCount++;
+    stages[stage] = {name, dependencies, deferred, false, false, 0, 0};
+    if (!deferred) {
+        criticalMask |= BOOT_STAGE_MASK(stage);
+    }
+    return stage;
+}
+
+void BootGraph::start(uint64_t nowUs) {
+    started = true;
+    startUs = nowUs;
+    if (criticalMask == 0) {
+        readyUs = nowUs;
+    }
+}
+
+uint32_t BootGraph::takeReady() {
+    if (!started) {
+        return 0;
+    }
+    bool ready = isReady();
+    uint32_t readyMask = 0;
+    for (int i = 0; i < stageCount; i++) {
+        uint32_t bit = BOOT_STAGE_MASK(i);
+        if ((takenMask & bit) || (stages[i].dependencies & ~doneMask) != 0) {
+            continue;
+        }
+        // Deferred stages wait until the camera can shoot
+        if (stages[i].deferred && !ready) {
+            continue;
+        }
+        readyMask |= bit;
+    }
+    takenMask |= readyMask;
+    return readyMask;
+}
+
+void BootGraph::markStarted(int stage, uint64_t nowUs) {
+    if (stage < 0 || stage >= stageCount) {
+        return;
+    }
+    stages[stage].started = true;
+    stages[stage].startUs = nowUs;
+}
+
+void BootGraph::markDone(int stage, uint64_t nowUs) {
+    if (stage < 0 || stage >= stageCount || stages[stage].done) {
+        return;
+    }
+    stages[stage].done = true;
+    stages[stage].endUs = nowUs;
+    doneMask |= BOOT_STAGE_MASK(stage);
+    if (!stages[stage].deferred && isReady()) {
+        readyUs = nowUs;
+    }
+}
+
+bool BootGraph::isReady() const {
+    return (doneMask & criticalMask) == criticalMask;
+}
+
+bool BootGraph::isComplete() const {
+    return doneMask == BOOT_STAGE_MASK(stageCount) - 1;
+}
+
+uint64_t BootGraph::getReadyTimeUs() const {
+    if (!started || !isReady()) {
+        return 0;
+    }
+    return readyUs - startUs;
+}
+
+uint64_t BootGraph::getSerialTimeUs() const {
+    uint64_t total = 0;
+    for (int i = 0; i < stageCount; i++) {
+        if (stages[i].done) {
+            total += stages[i].endUs - stages[i].startUs;
+        }
+    }
+    return total;
+}
+
+int BootGraph::getStageCount() const {
+    return stageCount;
+}
+
+const BootStageInfo* BootGraph::getStage(int stage) const {
+    if (stage < 0 || stage >= stageCount) {
+        return nullptr;
+    }
+    return &stages[stage];
+}
+
+uint64_t BootGraph::getStartUs() const {
+    return startUs;
+}
@@ -0,0 +1,157 @@
+#ifndef RETROLENS_BOOT_GRAPH_H
+#define RETROLENS_BOOT_GRAPH_H
+
+#include <stdint.h>
+
+#define BOOT_MAX_STAGES 16
+#define BOOT_INVALID_STAGE -1
+
+// Bit of a stage in a dependency or stage mask
+#define BOOT_STAGE_MASK(stage) (1u << (stage))
+
+/**
+ * @struct BootStageInfo
+ * @brief Description and timestamps of a boot stage.
+ */
+struct BootStageInfo {
+    const char* name;      ///< Name shown in the boot log.
+    uint32_t dependencies; ///< Mask of the stages that must be done before this one starts.
+    bool deferred;         ///< True if the stage is not needed for the first shot.
+    bool started;          ///< True once the stage was handed out.
+    bool done;             ///< True once the stage finished.
+    uint64_t startUs;      ///< Time the stage started running.
+    uint64_t endUs;        ///< Time the stage finished.
+};
+
+/**
+ * @class BootGraph
+ * @brief Dependency graph of the boot stages, handing out the stages that may run in parallel.
+ *
+ * A stage may only depend on stages added before it, so the graph has no cycle. Stages whose
+ * dependencies are done are handed out together and may run on different cores. Deferred stages
+ * are held back until every other stage is done, the camera is then ready to shoot and the
+ * deferred ones run while the user frames the picture.
+ *
+ * The graph only does the bookkeeping, the caller runs the stages and provides the time, which
+ * keeps it testable on the host.
+ *
+ * Example usage:
+ * @code
+ * BootGraph graph;
+ * int camera = graph.addStage("camera", 0, false);
+ * int services = graph.addStage("services", 0, false);
+ * int power = graph.addStage("power", BOOT_STAGE_MASK(camera) | BOOT_STAGE_MASK(services), false);
+ * graph.start(esp_timer_get_time());
+ * uint32_t ready = graph.takeReady();
+ * // Run the stages of ready, calling markStarted() and markDone(), and take the ready ones again
+ * @endcode
+ */
+class BootGraph {
+public:
+    /**
+     * @brief Construct an empty graph.
+     */
+    BootGraph();
+
+    /**
+     * @brief Add a stage.
+     *
+     * @param name Name shown in the boot log, must outlive the graph.
+     * @param dependencies Mask of stages added before this one.
+     * @param deferred True if the stage is not needed for the first shot.
+     * @return int Stage ID, or BOOT_INVALID_STAGE if the graph is full or a dependency does not exist yet.
+     */
+    int addStage(const char* name, uint32_t dependencies, bool deferred);
+
+    /**
+     * @brief Start the boot, stages may be taken from now on.
+     *
+     * @param nowUs Current time.
+     */
+    void start(uint64_t nowUs);
+
+    /**
+     * @brief Take the stages that may start now. Each stage is handed out once.
+     *
+     * @return uint32_t Mask of the stages to run.
+     */
+    uint32_t takeReady();
+
+    /**
+     * @brief Record that a stage started running.
+     *
+     * @param stage Stage ID.
+     * @param nowUs Current time.
+     */
+    void markStarted(int stage, uint64_t nowUs);
+
+    /**
+     * @brief Record that a stage finished.
+     *
+     * @param stage Stage ID.
+     * @param nowUs Current time.
+     */
+    void markDone(int stage, uint64_t nowUs);
+
+    /**
+     * @brief Check if every stage needed for the first shot is done.
+     *
+     * @return true if the camera is ready to shoot.
+     */
+    bool isReady() const;
+
+    /**
+     * @brief Check if every stage, deferred ones included, is done.
+     *
+     * @return true if the boot is complete.
+     */
+    bool isComplete() const;
+
+    /**
+     * @brief Get the time from the start of the boot until the camera was ready to shoot.
+     *
+     * @return uint64_t Time in microseconds, 0 until ready.
+     */
+    uint64_t getReadyTimeUs() const;
+
+    /**
+     * @brief Get the time the stages would take one after the other.
+     *
+     * @return uint64_t Sum of the durations of the done stages, in microseconds.
+     */
+    uint64_t getSerialTimeUs() const;
+
+    /**
+     * @brief Get the number of stages.
+     *
+     * @return int Stage count.
+     */
+    int getStageCount() const;
+
+    /**
+     * @brief Get a stage.
+     *
+     * @param stage Stage ID.
+     * @return const BootStageInfo* Stage, nullptr if the ID is invalid.
+     */
+    const BootStageInfo* getStage(int stage) const;
+
+    /**
+     * @brief Get the start time of the boot.
+     *
+     * @return uint64_t Time given to start().
+     */
+    uint64_t getStartUs() const;
+
+private:
+    BootStageInfo stages[BOOT_MAX_STAGES]; ///< Stages, in the order they were added.
+    int stageCount;                        ///< Number of stages.
+    uint32_t doneMask;                     ///< Stages done.
+    uint32_t takenMask;                    ///< Stages handed out.
+    uint32_t criticalMask;                 ///< Stages needed for the first shot.
+    bool started;                          ///< True once start() was called.
+    uint64_t startUs;                      ///< Time the boot started.
+    uint64_t readyUs;                      ///< Time the last critical stage finished.
+};
+
+#endif // RETROLENS_BOOT_GRAPH_H
@@ -0,0 +1,167 @@
+#include "ButtonGestures.h"
+
+// States of the recognizer
+#define STATE_IDLE 0            // Button up, nothing pending
+#define STATE_DOWN 1            // Button down, may become a click or a hold
+#define STATE_UP 2              // Clicks counted, waiting for another press
+#define STATE_HOLD 3            // Hold in progress, repeating
+#define STATE_HOLD_UP 4         // Hold finished, waiting for a follow-up click
+#define STATE_HOLD_CLICK_DOWN 5 // Button down after a hold
+#define STATE_COUNT 6
+
+// Input symbols
+#define INPUT_PRESS 0
+#define INPUT_RELEASE 1
+#define INPUT_TIMEOUT 2
+#define INPUT_COUNT 3
+
+// Transition actions
+#define ACTION_NONE 0
+#define ACTION_START_PRESS 1
+#define ACTION_COUNT_CLICK 2
+#define ACTION_EMIT_CLICKS 3
+#define ACTION_START_HOLD 4
+#define ACTION_REPEAT_HOLD 5
+#define ACTION_END_HOLD 6
+#define ACTION_EMIT_HOLD_CLICK 7
+#define ACTION_CLEAR 8
+
+struct GestureTransition {
+    uint8_t nextState;
+    uint8_t action;
+};
+
+// Transition table indexed by [state][input]
+static const GestureTransition TRANSITIONS[STATE_COUNT][INPUT_COUNT] = {
+    // STATE_IDLE
+    {{STATE_DOWN, ACTION_START_PRESS}, {STATE_IDLE, ACTION_NONE}, {STATE_IDLE, ACTION_NONE}},
+    // STATE_DOWN
+    {{STATE_DOWN, ACTION_NONE}, {STATE_UP, ACTION_COUNT_CLICK}, {STATE_HOLD, ACTION_START_HOLD}},
+    // STATE_UP
+    {{STATE_DOWN, ACTION_START_PRESS}, {STATE_UP, ACTION_NONE}, {STATE_IDLE, ACTION_EMIT_CLICKS}},
+    // STATE_HOLD
+    {{STATE_HOLD, ACTION_NONE}, {STATE_HOLD_UP, ACTION_END_HOLD}, {STATE_HOLD, ACTION_REPEAT_HOLD}},
+    // STATE_HOLD_UP
+    {{STATE_HOLD_CLICK_DOWN, ACTION_START_PRESS}, {STATE_HOLD_UP, ACTION_NONE}, {STATE_IDLE, ACTION_CLEAR}},
+    // STATE_HOLD_CLICK_DOWN
+    {{STATE_HOLD_CLICK_DOWN, ACTION_NONE}, {STATE_IDLE, ACTION_EMIT_HOLD_CLICK}, {STATE_HOLD, ACTION_START_HOLD}},
+};
+
+// Check if the deadline is at or before the given time, handling timer wrap-around
+#define DEADLINE_EXPIRED(deadline, now) ((int32_t) ((now) - (deadline)) >= 0)
+
+ButtonGestures::ButtonGestures(const GestureConfig& config)
+    : config(config), state(STATE_IDLE), clicks(0), hasDeadline(false), deadlineMs(0) {}
+
+void ButtonGestures::setConfig(const GestureConfig& config) {
+    this->config = config;
+    reset();
+}
+
+const GestureConfig& ButtonGestures::getConfig() const {
+    return config;
+}
+
+void ButtonGestures::reset() {
+    state = STATE_IDLE;
+    clicks = 0;
+    hasDeadline = false;
+}
+
+int ButtonGestures::handleEdge(int buttonState, uint32_t timeMs, int* events) {
+    // Timeouts that expired before the edge happened first
+    int count = update(timeMs, events);
+    int input = buttonState == BUTTON_PRESSED ? INPUT_PRESS : INPUT_RELEASE;
+    return step(input, timeMs, events, count);
+}
+
+int ButtonGestures::update(uint32_t nowMs, int* events) {
+    int count = 0;
+    while (hasDeadline && DEADLINE_EXPIRED(deadlineMs, nowMs)) {
+        count = step(INPUT_TIMEOUT, deadlineMs, events, count);
+    }
+    return count;
+}
+
+long ButtonGestures::msUntilDeadline(uint32_t nowMs) const {
+    if (!hasDeadline) {
+        return -1;
+    }
+    if (DEADLINE_EXPIRED(deadlineMs, nowMs)) {
+        return 0;
+    }
+    return (long) (deadlineMs - nowMs);
+}
+
+// Map a click count to its gesture event
+static int clickGesture(int clicks) {
+    if (clicks >= 3) {
+        return BUTTON_TRIPLE_CLICK;
+    }
+    return clicks == 2 ? BUTTON_DOUBLE_CLICK : BUTTON_SINGLE_CLICK;
+}
+
+// Append an event to the output array, dropping it if the array is full
+#define EMIT(event)                          \
+    do {                                     \
+        if (count < MAX_GESTURE_EVENTS) {    \
+            events[count++] = (event);       \
+        }                                    \
+    } while (0)
+
+int ButtonGestures::step(int input, uint32_t timeMs, int* events, int count) {
+    const GestureTransition& transition = TRANSITIONS[state][input];
+    state = transition.nextState;
+
+    switch (transition.action) {
+        case ACTION_START_PRESS:
+            // A press becomes a hold unless it is released before the long press time
+            hasDeadline = true;
+            deadlineMs = timeMs + config.longPressMs;
+            break;
+        case ACTION_COUNT_CLICK:
+            clicks++;
+            if (clicks >= config.maxClicks) {
+                // No longer gesture exists, report it without waiting for the gap
+                EMIT(clickGesture(clicks));
+                clicks = 0;
+                state = STATE_IDLE;
+                hasDeadline = false;
+            } else {
+                hasDeadline = true;
+                deadlineMs = timeMs + config.multiClickGapMs;
+            }
+            break;
+        case ACTION_EMIT_CLICKS:
+            EMIT(clickGesture(clicks));
+            clicks = 0;
+            hasDeadline = false;
+            break;
+        case ACTION_START_HOLD:
+            // Clicks before the hold are dropped
+            clicks = 0;
+            EMIT(BUTTON_LONG_PRESSED);
+            // A zero repeat period disables the repeat events
+            hasDeadline = config.holdRepeatMs > 0;
+            deadlineMs = timeMs + config.holdRepeatMs;
+            break;
+        case ACTION_REPEAT_HOLD:
+            EMIT(BUTTON_HOLD_REPEAT);
+            deadlineMs += config.holdRepeatMs;
+            break;
+        case ACTION_END_HOLD:
+            hasDeadline = true;
+            deadlineMs = timeMs + config.holdClickGapMs;
+            break;
+        case ACTION_EMIT_HOLD_CLICK:
+            EMIT(BUTTON_HOLD_CLICK);
+            hasDeadline = false;
+            break;
+        case ACTION_CLEAR:
+            hasDeadline = false;
+            break;
+        default:
+            break;
+    }
+    return count;
+}
@@ -0,0 +1,137 @@
+#ifndef RETROLENS_BUTTON_GESTURES_H
+#define RETROLENS_BUTTON_GESTURES_H
+
+#include <stdint.h>
+
+// Raw button events
+#define BUTTON_RELEASED 0
+#define BUTTON_PRESSED 1
+
+// Gesture events
+#define BUTTON_LONG_PRESSED 2
+#define BUTTON_SINGLE_CLICK 3
+#define BUTTON_DOUBLE_CLICK 4
+#define BUTTON_TRIPLE_CLICK 5
+#define BUTTON_HOLD_REPEAT 6
+#define BUTTON_HOLD_CLICK 7
+
+// Default gesture thresholds
+#define LONG_PRESS_TIME_MS 1000
+#define MULTI_CLICK_GAP_MS 250
+#define HOLD_REPEAT_MS 200
+#define HOLD_CLICK_GAP_MS 400
+#define MAX_CLICKS 3
+
+// Maximum number of gesture events produced by a single call
+#define MAX_GESTURE_EVENTS 2
+
+/**
+ * @struct GestureConfig
+ * @brief Timing thresholds used by the gesture recognizer.
+ */
+struct GestureConfig {
+    uint32_t longPressMs = LONG_PRESS_TIME_MS;   ///< Press duration that starts a hold.
+    uint32_t multiClickGapMs = MULTI_CLICK_GAP_MS; ///< Maximum gap between the clicks of a multi-click.
+    uint32_t holdRepeatMs = HOLD_REPEAT_MS;      ///< Period of the repeat events while holding.
+    uint32_t holdClickGapMs = HOLD_CLICK_GAP_MS; ///< Maximum gap between the end of a hold and its follow-up click.
+    int maxClicks = MAX_CLICKS;                  ///< Click count that is reported without waiting for the gap.
+};
+
+/**
+ * @class ButtonGestures
+ * @brief Table-driven state machine that turns timestamped button edges into gestures.
+ *
+ * The recognizer has no timers or tasks of its own. The owner feeds it every debounced edge
+ * and calls update() when the deadline returned by msUntilDeadline() expires.
+ *
+ * Gestures:
+ * - BUTTON_SINGLE_CLICK, BUTTON_DOUBLE_CLICK, BUTTON_TRIPLE_CLICK once the multi-click gap expires
+ *   (or immediately when maxClicks is reached).
+ * - BUTTON_LONG_PRESSED when a press lasts longPressMs, then BUTTON_HOLD_REPEAT every holdRepeatMs.
+ * - BUTTON_HOLD_CLICK for a click that follows a hold within holdClickGapMs.
+ *
+ * Example usage:
+ * @code
+ * ButtonGestures gestures;
+ * int events[MAX_GESTURE_EVENTS];
+ * int count = gestures.handleEdge(BUTTON_PRESSED, millis(), events);
+ * @endcode
+ */
+class ButtonGestures {
+public:
+    /**
+     * @brief Construct a new Button Gestures object.
+     *
+     * @param config Timing thresholds.
+     */
+    ButtonGestures(const GestureConfig& config = GestureConfig());
+
+    /**
+     * @brief Replace the timing thresholds and reset the state machine.
+     *
+     * @param config Timing thresholds.
+     */
+    void setConfig(const GestureConfig& config);
+
+    /**
+     * @brief Get the timing thresholds.
+     *
+     * @return const GestureConfig& Current configuration.
+     */
+    const GestureConfig& getConfig() const;
+
+    /**
+     * @brief Return to the idle state, dropping any gesture in progress.
+     */
+    void reset();
+
+    /**
+     * @brief Feed a debounced button edge.
+     *
+     * An expired deadline is processed before the edge, so the call can produce up to
+     * MAX_GESTURE_EVENTS events.
+     *
+     * @param buttonState BUTTON_PRESSED or BUTTON_RELEASED.
+     * @param timeMs Timestamp of the edge in milliseconds.
+     * @param events Output array with room for MAX_GESTURE_EVENTS events.
+     * @return int Number of events written.
+     */
+    int handleEdge(int buttonState, uint32_t timeMs, int* events);
+
+    /**
+     * @brief Process the pending deadlines that have expired.
+     *
+     * @param nowMs Current time in milliseconds.
+     * @param events Output array with room for MAX_GESTURE_EVENTS events.
+     * @return int Number of events written.
+     */
+    int update(uint32_t nowMs, int* events);
+
+    /**
+     * @brief Time left until the next deadline.
+     *
+     * @param nowMs Current time in milliseconds.
+     * @return long Milliseconds until the deadline, 0 if it already expired, -1 if there is none.
+     */
+    long msUntilDeadline(uint32_t nowMs) const;
+
+private:
+    /**
+     * @brief Run one transition of the state machine.
+     *
+     * @param input Input symbol.
+     * @param timeMs Timestamp of the input.
+     * @param events Output array.
+     * @param count Number of events already written.
+     * @return int New number of events written.
+     */
+    int step(int input, uint32_t timeMs, int* events, int count);
+
+    GestureConfig config; ///< Timing thresholds.
+    uint8_t state;        ///< Current state.
+    int clicks;           ///< Clicks counted in the current multi-click.
+    bool hasDeadline;     ///< Whether a deadline is armed.
+    uint32_t deadlineMs;  ///< Time of the next timeout input.
+};
+
+#endif // RETROLENS_BUTTON_GESTURES_H
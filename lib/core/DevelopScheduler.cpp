@@ -0,0 +1,185 @@
+#include <string.h>
+
+#include "DevelopScheduler.h"
+
+DevelopScheduler::DevelopScheduler() : count(0), completed(0), failed(0), added(0), sequence(0), preempted(false) {
+    for (int kind = 0; kind < DEVELOP_TASK_KINDS; kind++) {
+        steps[kind] = nullptr;
+        contexts[kind] = nullptr;
+    }
+}
+
+void DevelopScheduler::setStep(int kind, DevelopStep step, void* context) {
+    if (kind < 0 || kind >= DEVELOP_TASK_KINDS) {
+        return;
+    }
+    steps[kind] = step;
+    contexts[kind] = context;
+}
+
+bool DevelopScheduler::add(int kind, const char* path, uint32_t total) {
+    if (kind < 0 || kind >= DEVELOP_TASK_KINDS || path == nullptr || strlen(path) >= DEVELOP_PATH_BYTES) {
+        return false;
+    }
+
+    // The file changed since the task was queued, whatever was done on it is stale
+    for (int i = 0; i < count; i++) {
+        if (tasks[i].kind == kind && strcmp(tasks[i].path, path) == 0) {
+            tasks[i].serial = ++added;
+            tasks[i].cursor = 0;
+            tasks[i].total = total;
+            tasks[i].state = 0;
+            return true;
+        }
+    }
+    if (count == DEVELOP_QUEUE_CAPACITY) {
+        return false;
+    }
+
+    // A new batch starts counting from zero
+    if (count == 0) {
+        completed = 0;
+        failed = 0;
+    }
+    DevelopTask& task = tasks[count++];
+    memset(&task, 0, sizeof(task));
+    task.kind = (uint8_t) kind;
+    task.serial = ++added;
+    task.total = total;
+    strcpy(task.path, path);
+    return true;
+}
+
+int DevelopScheduler::run(uint32_t budgetUs, DevelopClock clock) {
+    uint32_t startUs = clock();
+    while (count > 0) {
+        if (preempted) {
+            return DEVELOP_RUN_PREEMPTED;
+        }
+        if (clock() - startUs >= budgetUs) {
+            return DEVELOP_RUN_BUDGET;
+        }
+
+        DevelopTask& task = tasks[0];
+        DevelopStep step = steps[task.kind];
+        int result = step != nullptr ? step(contexts[task.kind], &task) : -1;
+        if (result == DEVELOP_STEP_DONE) {
+            completed++;
+            popTask();
+        } else if (result < 0) {
+            failed++;
+            popTask();
+        }
+    }
+    return DEVELOP_RUN_EMPTY;
+}
+
+void DevelopScheduler::preempt() {
+    preempted = true;
+}
+
+void DevelopScheduler::resume() {
+    preempted = false;
+}
+
+bool DevelopScheduler::isPreempted() const {
+    return preempted;
+}
+
+int DevelopScheduler::getPending() const {
+    return count;
+}
+
+uint32_t DevelopScheduler::getCompleted() const {
+    return completed;
+}
+
+uint32_t DevelopScheduler::getFailed() const {
+    return failed;
+}
+
+int DevelopScheduler::getTaskPercent() const {
+    if (count == 0 || tasks[0].total == 0) {
+        return 0;
+    }
+    return (int) ((uint64_t) tasks[0].cursor * 100 / tasks[0].total);
+}
+
+const DevelopTask* DevelopScheduler::getTask(int index) const {
+    if (index < 0 || index >= count) {
+        return nullptr;
+    }
+    return &tasks[index];
+}
+
+uint32_t DevelopScheduler::getAdded() const {
+    return added;
+}
+
+uint32_t DevelopScheduler::getSequence() const {
+    return sequence;
+}
+
+void DevelopScheduler::popTask() {
+    memmove(&tasks[0], &tasks[1], (count - 1) * sizeof(DevelopTask));
+    count--;
+}
+
+size_t DevelopScheduler::serialize(uint8_t* out, size_t capacity) {
+    size_t length = sizeof(DevelopQueueHeader) + count * sizeof(DevelopTask) + sizeof(uint32_t);
+    if (length > capacity) {
+        return 0;
+    }
+    sequence++;
+    DevelopQueueHeader header = {DEVELOP_QUEUE_MAGIC, DEVELOP_QUEUE_VERSION, (uint8_t) count, 0, sequence, completed, failed,
+                                 added};
+    uint8_t* cursor = out;
+    memcpy(cursor, &header, sizeof(header));
+    cursor += sizeof(header);
+    memcpy(cursor, tasks, count * sizeof(DevelopTask));
+    cursor += count * sizeof(DevelopTask);
+    uint32_t checksum = StandbyStore::crc32(out, (size_t) (cursor - out));
+    memcpy(cursor, &checksum, sizeof(checksum));
+    return length;
+}
+
+bool DevelopScheduler::deserialize(const uint8_t* blob, size_t length) {
+    count = 0;
+    completed = 0;
+    failed = 0;
+    added = 0;
+    DevelopQueueHeader header;
+    if (blob == nullptr || length < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, blob, sizeof(header));
+    if (header.magic != DEVELOP_QUEUE_MAGIC || header.version != DEVELOP_QUEUE_VERSION ||
+        header.count > DEVELOP_QUEUE_CAPACITY || header.reserved != 0) {
+        return false;
+    }
+    size_t expected = sizeof(header) + header.count * sizeof(DevelopTask) + sizeof(uint32_t);
+    uint32_t checksum;
+    if (length != expected) {
+        return false;
+    }
+    memcpy(&checksum, blob + expected - sizeof(checksum), sizeof(checksum));
+    if (checksum != StandbyStore::crc32(blob, expected - sizeof(checksum))) {
+        return false;
+    }
+
+    // The checksum only catches a damaged card, the tasks are checked as if they were not ours
+    memcpy(tasks, blob + sizeof(header), header.count * sizeof(DevelopTask));
+    for (int i = 0; i < header.count; i++) {
+        const DevelopTask& task = tasks[i];
+        if (task.kind >= DEVELOP_TASK_KINDS || memchr(task.path, 0, DEVELOP_PATH_BYTES) == nullptr ||
+            (task.total != 0 && task.cursor > task.total) || task.serial == 0 || task.serial > header.added) {
+            return false;
+        }
+    }
+    count = header.count;
+    completed = header.completed;
+    failed = header.failed;
+    added = header.added;
+    sequence = header.sequence;
+    return true;
+}
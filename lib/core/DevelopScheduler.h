@@ -0,0 +1,243 @@
+#ifndef RETROLENS_DEVELOP_SCHEDULER_H
+#define RETROLENS_DEVELOP_SCHEDULER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "StandbyStore.h"
+
+// Queue written by serialize(), bump the version when the layout changes
+#define DEVELOP_QUEUE_MAGIC 0x56454452u // "RDEV"
+#define DEVELOP_QUEUE_VERSION 2
+
+// Deferred tasks the queue holds
+#define DEVELOP_QUEUE_CAPACITY 16
+
+// Kinds of task a scheduler can run, each with its own step function
+#define DEVELOP_TASK_KINDS 4
+
+// Longest path of the file a task works on, with the terminating zero
+#define DEVELOP_PATH_BYTES 32
+
+// Step results, a negative value fails the task and drops it
+#define DEVELOP_STEP_MORE 0 // A part of the task was done, more is left
+#define DEVELOP_STEP_DONE 1 // The task is finished
+
+// Why run() returned
+#define DEVELOP_RUN_EMPTY 0     // Every task is done
+#define DEVELOP_RUN_PREEMPTED 1 // preempt() was called
+#define DEVELOP_RUN_BUDGET 2    // The time of the slice is used up, tasks are left
+
+/**
+ * @struct DevelopTask
+ * @brief Deferred work on one file, done a step at a time.
+ */
+struct DevelopTask {
+    uint8_t kind;                   ///< Kind of task, below DEVELOP_TASK_KINDS.
+    uint8_t reserved[3];            ///< Zero.
+    uint32_t serial;                ///< Number of the task over the life of the queue, names what the file held.
+    uint32_t cursor;                ///< Work done so far, in units of the kind.
+    uint32_t total;                 ///< Work of the whole task, given by add() or 0 until its first step knows it.
+    uint32_t state;                 ///< Partial result carried from step to step.
+    char path[DEVELOP_PATH_BYTES];  ///< File the task works on, zero terminated.
+};
+
+/**
+ * @struct DevelopQueueHeader
+ * @brief Start of a saved queue, followed by the tasks and a CRC-32 of all of them.
+ */
+struct DevelopQueueHeader {
+    uint32_t magic;     ///< DEVELOP_QUEUE_MAGIC.
+    uint16_t version;   ///< DEVELOP_QUEUE_VERSION.
+    uint8_t count;      ///< Number of tasks.
+    uint8_t reserved;   ///< Zero.
+    uint32_t sequence;  ///< Number of the save, the newest copy wins.
+    uint32_t completed; ///< Tasks done since the queue was last empty.
+    uint32_t failed;    ///< Tasks dropped since the queue was last empty.
+    uint32_t added;     ///< Tasks queued over the life of the queue, the serial of the last one.
+};
+
+// Largest saved queue
+#define DEVELOP_QUEUE_MAX_BLOB_BYTES \
+    (sizeof(DevelopQueueHeader) + DEVELOP_QUEUE_CAPACITY * sizeof(DevelopTask) + sizeof(uint32_t))
+
+/**
+ * @brief Run one step of a task, short enough that a preemption is served in a few milliseconds.
+ *
+ * The step updates the cursor, total and state of the task: whatever they hold when the queue
+ * is saved is where the task starts again after a reboot.
+ *
+ * @param context Context given to setStep().
+ * @param task Task to advance.
+ * @return int DEVELOP_STEP_MORE, DEVELOP_STEP_DONE, or a negative error code.
+ */
+typedef int (*DevelopStep)(void* context, DevelopTask* task);
+
+/**
+ * @brief Clock of run(), in microseconds.
+ */
+typedef uint32_t (*DevelopClock)();
+
+/**
+ * @class DevelopScheduler
+ * @brief Queue of deferred per-frame work, run in preemptible slices and saved across reboots.
+ *
+ * Work that does not belong on the shutter path is queued as tasks and run when the camera is
+ * idle. A task is split into steps by the step function of its kind; run() checks the
+ * preemption flag between steps, so preempt() stops it within one step. The flag stays set
+ * until resume(), so a slice that starts after the press does not run either.
+ *
+ * A preempted task keeps its cursor and carries on from there in the next slice. serialize()
+ * and deserialize() keep the queue as a blob, with a sequence number so that two copies can be
+ * written in turn and the newest intact one loaded: after a reboot the tasks start again from
+ * the last save.
+ *
+ * The scheduler does no locking. The owner must serialize the calls, except for preempt(),
+ * which may be called from any task while run() is in progress (see DevelopService).
+ *
+ * Example usage:
+ * @code
+ * int checksumStep(void* context, DevelopTask* task) {
+ *     // Checksum the next part of task->path
+ *     return task->cursor == task->total ? DEVELOP_STEP_DONE : DEVELOP_STEP_MORE;
+ * }
+ *
+ * DevelopScheduler scheduler;
+ * scheduler.setStep(0, checksumStep, nullptr);
+ * scheduler.add(0, "/picture.jpg");
+ * if (scheduler.run(500000, clockUs) != DEVELOP_RUN_PREEMPTED) {
+ *     size_t length = scheduler.serialize(blob, sizeof(blob));
+ * }
+ * @endcode
+ */
+class DevelopScheduler {
+public:
+    /**
+     * @brief Constructor for DevelopScheduler, without tasks or steps.
+     */
+    DevelopScheduler();
+
+    /**
+     * @brief Set the step function of a kind of task.
+     *
+     * @param kind Kind of task, below DEVELOP_TASK_KINDS.
+     * @param step Step function, nullptr to fail the tasks of the kind.
+     * @param context Context of the step function.
+     */
+    void setStep(int kind, DevelopStep step, void* context);
+
+    /**
+     * @brief Queue a task, or hand a queued task of the same kind and file over to the new content.
+     *
+     * A file written again no longer holds what the queued task was for, so that task starts
+     * again on the new content with the new total and a new serial. Serials are counted over the
+     * life of the queue and saved with it, a result recorded with one names the content it is of.
+     *
+     * @param kind Kind of task, below DEVELOP_TASK_KINDS.
+     * @param path File the task works on, shorter than DEVELOP_PATH_BYTES.
+     * @param total Work of the whole task as the file was written, 0 to let its first step find it.
+     * @return true if the task is queued, false if the queue is full or the arguments are invalid.
+     */
+    bool add(int kind, const char* path, uint32_t total = 0);
+
+    /**
+     * @brief Run tasks in order until the queue is empty, the budget is spent or a preemption.
+     *
+     * A task whose step fails is dropped and counted as failed.
+     *
+     * @param budgetUs Time of the slice, checked between steps.
+     * @param clock Clock of the slice.
+     * @return int One of the DEVELOP_RUN_* values.
+     */
+    int run(uint32_t budgetUs, DevelopClock clock);
+
+    /**
+     * @brief Stop run() after the step in progress, and any later run() until resume().
+     */
+    void preempt();
+
+    /**
+     * @brief Let run() work again.
+     */
+    void resume();
+
+    /**
+     * @brief Check if the scheduler is preempted.
+     */
+    bool isPreempted() const;
+
+    /**
+     * @brief Get the number of queued tasks, the one in progress included.
+     */
+    int getPending() const;
+
+    /**
+     * @brief Get the number of tasks done since the queue was last empty.
+     */
+    uint32_t getCompleted() const;
+
+    /**
+     * @brief Get the number of tasks dropped since the queue was last empty.
+     */
+    uint32_t getFailed() const;
+
+    /**
+     * @brief Get the progress of the task in progress.
+     *
+     * @return int Percent of its work done, 0 if there is none.
+     */
+    int getTaskPercent() const;
+
+    /**
+     * @brief Get a queued task, the one in progress first.
+     *
+     * @return const DevelopTask* The task, or nullptr for an invalid index.
+     */
+    const DevelopTask* getTask(int index) const;
+
+    /**
+     * @brief Get the number of tasks queued over the life of the queue, the serial of the last one.
+     */
+    uint32_t getAdded() const;
+
+    /**
+     * @brief Get the sequence number of the last save or load.
+     */
+    uint32_t getSequence() const;
+
+    /**
+     * @brief Write the queue as a blob, with the next sequence number.
+     *
+     * @param out Output buffer.
+     * @param capacity Size of the buffer, DEVELOP_QUEUE_MAX_BLOB_BYTES always fits.
+     * @return size_t Size of the blob, 0 if it does not fit.
+     */
+    size_t serialize(uint8_t* out, size_t capacity);
+
+    /**
+     * @brief Load a blob of serialize(), checking all of it. The steps and the preemption are kept.
+     *
+     * @param blob Blob.
+     * @param length Size of the blob.
+     * @return true if the blob is intact, the queue is left empty otherwise.
+     */
+    bool deserialize(const uint8_t* blob, size_t length);
+
+private:
+    /**
+     * @brief Remove the task in progress.
+     */
+    void popTask();
+
+    DevelopTask tasks[DEVELOP_QUEUE_CAPACITY]; ///< Queued tasks, the one in progress first.
+    DevelopStep steps[DEVELOP_TASK_KINDS];     ///< Step function of each kind.
+    void* contexts[DEVELOP_TASK_KINDS];        ///< Context of each step function.
+    int count;                                 ///< Number of queued tasks.
+    uint32_t completed;                        ///< Tasks done since the queue was last empty.
+    uint32_t failed;                           ///< Tasks dropped since the queue was last empty.
+    uint32_t added;                            ///< Tasks queued over the life of the queue.
+    uint32_t sequence;                         ///< Sequence number of the last save or load.
+    volatile bool preempted;                   ///< Set by preempt(), cleared by resume().
+};
+
+#endif // RETROLENS_DEVELOP_SCHEDULER_H
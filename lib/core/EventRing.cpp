@@ -0,0 +1,79 @@
+#include "EventRing.h"
+
+#define EVENT_RING_MASK (EVENT_RING_SIZE - 1)
+
+EventRing::EventRing() : head(0) {
+    for (int i = 0; i < MAX_EVENT_SUBSCRIBERS; i++) {
+        cursors[i] = {false, 0, 0, 0};
+    }
+    for (int i = 0; i < EVENT_TYPE_COUNT; i++) {
+        typeSubscribers[i] = 0;
+    }
+}
+
+int EventRing::subscribe(uint32_t typeMask) {
+    for (int id = 0; id < MAX_EVENT_SUBSCRIBERS; id++) {
+        if (!cursors[id].active) {
+            // Start reading at the current head, older events are not delivered
+            cursors[id] = {true, typeMask, head, 0};
+            for (int type = 0; type < EVENT_TYPE_COUNT; type++) {
+                if (typeMask & EVENT_MASK(type)) {
+                    typeSubscribers[type] |= 1u << id;
+                }
+            }
+            return id;
+        }
+    }
+    return -1;
+}
+
+void EventRing::unsubscribe(int id) {
+    if (id < 0 || id >= MAX_EVENT_SUBSCRIBERS) {
+        return;
+    }
+    cursors[id].active = false;
+    for (int type = 0; type < EVENT_TYPE_COUNT; type++) {
+        typeSubscribers[type] &= ~(1u << id);
+    }
+}
+
+void EventRing::publish(const Event& event) {
+    slots[head & EVENT_RING_MASK] = event;
+    head++;
+}
+
+bool EventRing::poll(int id, Event* event) {
+    if (id < 0 || id >= MAX_EVENT_SUBSCRIBERS || !cursors[id].active) {
+        return false;
+    }
+    Cursor& cursor = cursors[id];
+
+    // If the writer lapped the cursor, skip to the oldest event still in the ring
+    uint32_t pending = head - cursor.next;
+    if (pending > EVENT_RING_SIZE) {
+        cursor.overruns += pending - EVENT_RING_SIZE;
+        cursor.next = head - EVENT_RING_SIZE;
+    }
+
+    // Skip the events the subscriber is not interested in
+    while (cursor.next != head) {
+        const Event& slot = slots[cursor.next & EVENT_RING_MASK];
+        cursor.next++;
+        if (cursor.typeMask & EVENT_MASK(slot.type)) {
+            *event = slot;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t EventRing::getSubscribersForType(uint16_t type) const {
+    return type < EVENT_TYPE_COUNT ? typeSubscribers[type] : 0;
+}
+
+uint32_t EventRing::getOverruns(int id) const {
+    if (id < 0 || id >= MAX_EVENT_SUBSCRIBERS) {
+        return 0;
+    }
+    return cursors[id].overruns;
+}
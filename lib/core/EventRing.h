@@ -0,0 +1,142 @@
+#ifndef RETROLENS_EVENT_RING_H
+#define RETROLENS_EVENT_RING_H
+
+#include <stdint.h>
+
+// Number of events kept in the ring, must be a power of two
+#define EVENT_RING_SIZE 64
+#define MAX_EVENT_SUBSCRIBERS 8
+
+// Event types
+#define EVENT_BUTTON 0
+#define EVENT_BATTERY_LEVEL 1
+#define EVENT_SAVE_RESULT 2
+#define EVENT_FILM_STATUS 3
+#define EVENT_TYPE_COUNT 4
+
+// Build a subscription mask from an event type
+#define EVENT_MASK(type) (1u << (type))
+
+/**
+ * @struct SaveResultPayload
+ * @brief Result of an image save or film status read.
+ */
+struct SaveResultPayload {
+    int code;            ///< Error code, 0 on success.
+    const char* message; ///< Static error message.
+};
+
+/**
+ * @union EventPayload
+ * @brief Payload of an event, interpreted according to the event type.
+ */
+union EventPayload {
+    int button;                    ///< EVENT_BUTTON: button or gesture event code.
+    float batteryLevel;            ///< EVENT_BATTERY_LEVEL: battery level in percent.
+    SaveResultPayload saveResult;  ///< EVENT_SAVE_RESULT and EVENT_FILM_STATUS: result of the operation.
+};
+
+/**
+ * @struct Event
+ * @brief Fixed-size tagged event stored in the ring.
+ */
+struct Event {
+    uint16_t type;        ///< Event type, one of the EVENT_* values.
+    uint32_t timeMs;      ///< Time the event was published, in milliseconds.
+    EventPayload payload; ///< Event data.
+};
+
+/**
+ * @class EventRing
+ * @brief Statically sized multi-consumer ring of events with one read cursor per subscriber.
+ *
+ * Publishing writes a single slot whatever the number of subscribers; every subscriber reads
+ * the events at its own pace through its cursor. A subscriber that falls more than EVENT_RING_SIZE
+ * events behind loses the oldest ones, which is counted as an overrun.
+ *
+ * The ring does no locking. The owner must serialize publish() and poll() (see EventBus).
+ *
+ * Example usage:
+ * @code
+ * EventRing ring;
+ * int id = ring.subscribe(EVENT_MASK(EVENT_BUTTON));
+ * Event event = {EVENT_BUTTON, 0, {}};
+ * event.payload.button = BUTTON_PRESSED;
+ * ring.publish(event);
+ * while (ring.poll(id, &event)) {
+ *     // Process the event
+ * }
+ * @endcode
+ */
+class EventRing {
+public:
+    /**
+     * @brief Construct an empty ring without subscribers.
+     */
+    EventRing();
+
+    /**
+     * @brief Add a subscriber. It only sees the events published after this call.
+     *
+     * @param typeMask Mask of the event types to receive, built with EVENT_MASK.
+     * @return int Subscriber id, or -1 if there is no free slot.
+     */
+    int subscribe(uint32_t typeMask);
+
+    /**
+     * @brief Remove a subscriber.
+     *
+     * @param id Subscriber id returned by subscribe().
+     */
+    void unsubscribe(int id);
+
+    /**
+     * @brief Publish an event to every subscriber.
+     *
+     * @param event Event to copy into the ring.
+     */
+    void publish(const Event& event);
+
+    /**
+     * @brief Read the next event matching the subscriber's mask.
+     *
+     * @param id Subscriber id.
+     * @param event Output event.
+     * @return true if an event was read, false if there are no pending events.
+     */
+    bool poll(int id, Event* event);
+
+    /**
+     * @brief Get the mask of the subscribers interested in an event type.
+     *
+     * @param type Event type.
+     * @return uint32_t Bit i is set if subscriber i receives the type.
+     */
+    uint32_t getSubscribersForType(uint16_t type) const;
+
+    /**
+     * @brief Get the number of events lost by a subscriber because it fell behind.
+     *
+     * @param id Subscriber id.
+     * @return uint32_t Number of lost events.
+     */
+    uint32_t getOverruns(int id) const;
+
+private:
+    /**
+     * @brief Read cursor of a subscriber.
+     */
+    struct Cursor {
+        bool active;       ///< Whether the slot is in use.
+        uint32_t typeMask; ///< Event types the subscriber receives.
+        uint32_t next;     ///< Sequence number of the next event to read.
+        uint32_t overruns; ///< Events lost because the writer lapped the cursor.
+    };
+
+    Event slots[EVENT_RING_SIZE];             ///< Event storage.
+    uint32_t head;                            ///< Sequence number of the next event to write.
+    Cursor cursors[MAX_EVENT_SUBSCRIBERS];    ///< Subscriber cursors.
+    uint32_t typeSubscribers[EVENT_TYPE_COUNT]; ///< Subscriber mask per event type.
+};
+
+#endif // RETROLENS_EVENT_RING_H
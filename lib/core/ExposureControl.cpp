@@ -0,0 +1,85 @@
+#include "ExposureControl.h"
+
+ExposureControl::ExposureControl(const ExposureConfig& config) : config(config) {}
+
+bool ExposureControl::update(const MeterStats& stats, ExposureSettings* settings) const {
+    if (stats.count == 0) {
+        return false;
+    }
+    bool clipped = (uint64_t) stats.clippedHigh * 1000 > (uint64_t) stats.count * config.highlightLimitPermille;
+    int error = (int) stats.mean - (int) config.targetMean;
+    if (!clipped && error <= config.tolerance && error >= -config.tolerance) {
+        return true;
+    }
+    if (clipped && error < -config.tolerance) {
+        // Dark with blown highlights, a backlit scene: brightening clips more, darkening loses the subject
+        return true;
+    }
+
+    // Step in 1/256 units, a black frame counts as mean 1
+    uint32_t mean = stats.mean > 0 ? stats.mean : 1;
+    uint32_t step = ((uint32_t) config.targetMean << 8) / mean;
+    uint32_t maxStep = (uint32_t) config.maxStep << 8;
+    uint32_t minStep = 256 / config.maxStep;
+    if (step > maxStep) {
+        step = maxStep;
+    }
+    if (step < minStep || stats.median >= LUMA_CLIP_HIGH) {
+        // A mostly saturated frame says nothing about how far over it is
+        step = minStep;
+    }
+    if (clipped && step > 192) {
+        // Blown highlights hide how bright the scene is, back off by at least a quarter
+        step = 192;
+    }
+
+    uint64_t target = ((uint64_t) brightness(*settings) * step + 128) >> 8;
+    if (target < EXPOSURE_MIN_LINES) {
+        target = EXPOSURE_MIN_LINES;
+    }
+    uint64_t maxBrightness = (uint64_t) config.maxExposureLines * (1 + config.maxGain);
+    if (target > maxBrightness) {
+        target = maxBrightness;
+    }
+
+    // Exposure first, gain for the rest
+    ExposureSettings next = *settings;
+    if (target <= config.maxExposureLines) {
+        next.exposureLines = (uint16_t) target;
+        next.gain = 0;
+    } else {
+        uint32_t factor = (uint32_t) ((target + config.maxExposureLines - 1) / config.maxExposureLines);
+        next.gain = (uint8_t) (factor - 1);
+        next.exposureLines = (uint16_t) ((target + factor / 2) / factor);
+    }
+    if (next.exposureLines == settings->exposureLines && next.gain == settings->gain) {
+        // At a limit of the sensor, nothing left to try
+        return true;
+    }
+    *settings = next;
+    return false;
+}
+
+uint8_t ExposureControl::pickWhiteBalance(const MeterStats& stats) {
+    if (stats.sumBlue == 0 && stats.sumRed == 0) {
+        return WB_MODE_AUTO;
+    }
+    if (stats.sumBlue == 0) {
+        return WB_MODE_HOME;
+    }
+    uint64_t ratioPercent = (uint64_t) stats.sumRed * 100 / stats.sumBlue;
+    if (ratioPercent > WB_HOME_ABOVE_PERCENT) {
+        return WB_MODE_HOME;
+    }
+    if (ratioPercent > WB_OFFICE_ABOVE_PERCENT) {
+        return WB_MODE_OFFICE;
+    }
+    if (ratioPercent < WB_CLOUDY_BELOW_PERCENT) {
+        return WB_MODE_CLOUDY;
+    }
+    return WB_MODE_SUNNY;
+}
+
+uint32_t ExposureControl::brightness(const ExposureSettings& settings) {
+    return (uint32_t) settings.exposureLines * (1 + settings.gain);
+}
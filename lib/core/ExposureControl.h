@@ -0,0 +1,118 @@
+#ifndef RETROLENS_EXPOSURE_CONTROL_H
+#define RETROLENS_EXPOSURE_CONTROL_H
+
+#include <stdint.h>
+
+#include "LumaMeter.h"
+
+// Sensor ranges of the OV2640 manual controls
+#define EXPOSURE_MIN_LINES 1
+#define EXPOSURE_MAX_LINES 1200
+#define EXPOSURE_MAX_GAIN 30
+
+// Defaults of the control loop
+#define EXPOSURE_TARGET_MEAN 118
+#define EXPOSURE_TOLERANCE 10
+#define EXPOSURE_HIGHLIGHT_LIMIT_PERMILLE 10
+#define EXPOSURE_MAX_STEP 4
+
+// White balance presets, matching the sensor_t set_wb_mode() values
+#define WB_MODE_AUTO 0
+#define WB_MODE_SUNNY 1
+#define WB_MODE_CLOUDY 2
+#define WB_MODE_OFFICE 3
+#define WB_MODE_HOME 4
+
+// Red to blue ratios, in percent, measured under the sunny preset that select another preset
+#define WB_CLOUDY_BELOW_PERCENT 85
+#define WB_OFFICE_ABOVE_PERCENT 125
+#define WB_HOME_ABOVE_PERCENT 160
+
+/**
+ * @struct ExposureSettings
+ * @brief Manual sensor controls.
+ */
+struct ExposureSettings {
+    uint16_t exposureLines = 300;   ///< Exposure time in sensor lines, EXPOSURE_MIN_LINES to EXPOSURE_MAX_LINES.
+    uint8_t gain = 0;               ///< Gain index, 0 to EXPOSURE_MAX_GAIN.
+    uint8_t wbMode = WB_MODE_SUNNY; ///< One of the WB_MODE_* presets.
+};
+
+/**
+ * @struct ExposureConfig
+ * @brief Targets and limits of the exposure control loop.
+ */
+struct ExposureConfig {
+    uint8_t targetMean = EXPOSURE_TARGET_MEAN;                           ///< Mean luma to reach.
+    uint8_t tolerance = EXPOSURE_TOLERANCE;                              ///< Accepted distance from the target.
+    uint16_t highlightLimitPermille = EXPOSURE_HIGHLIGHT_LIMIT_PERMILLE; ///< Clipped highlights allowed, in thousandths.
+    uint16_t maxExposureLines = EXPOSURE_MAX_LINES;                      ///< Longest exposure before gain is used.
+    uint8_t maxGain = EXPOSURE_MAX_GAIN;                                 ///< Highest gain index.
+    uint8_t maxStep = EXPOSURE_MAX_STEP;                                 ///< Largest brightness change of one iteration.
+};
+
+/**
+ * @class ExposureControl
+ * @brief Control loop that turns metering statistics into exposure, gain and white balance.
+ *
+ * The brightness of a frame is modelled as proportional to exposure lines times the gain factor
+ * (1 + gain). Each update scales that product by target / mean, limited to maxStep either way, and
+ * spends it on exposure first and on gain only past maxExposureLines. Clipped highlights over the
+ * limit cap the step below 1, so a bright sky pulls exposure down even at the target mean. A dark
+ * frame with clipped highlights, a backlit scene, is accepted as it is.
+ *
+ * The white balance preset is picked from the red to blue ratio of a frame taken with the sunny
+ * preset, which stands in for the illuminant colour.
+ *
+ * Example usage:
+ * @code
+ * ExposureControl control;
+ * ExposureSettings settings;
+ * for (int i = 0; i < 6; i++) {
+ *     // Grab a metering frame with settings
+ *     LumaMeter::measureRgb565(pixels, count, &stats);
+ *     if (control.update(stats, &settings)) {
+ *         break;
+ *     }
+ * }
+ * @endcode
+ */
+class ExposureControl {
+public:
+    /**
+     * @brief Constructor for ExposureControl.
+     *
+     * @param config Targets and limits.
+     */
+    ExposureControl(const ExposureConfig& config = ExposureConfig());
+
+    /**
+     * @brief Check a metering frame and compute the settings of the next one.
+     *
+     * @param stats Statistics of a frame taken with settings.
+     * @param settings Settings of the frame, updated in place.
+     * @return true if the frame was already acceptable or the sensor is at a limit, settings are then left unchanged.
+     */
+    bool update(const MeterStats& stats, ExposureSettings* settings) const;
+
+    /**
+     * @brief Pick a white balance preset from the colour sums of a frame taken with the sunny preset.
+     *
+     * @param stats Statistics of a colour frame.
+     * @return uint8_t One of the WB_MODE_* presets, WB_MODE_AUTO for grayscale frames.
+     */
+    static uint8_t pickWhiteBalance(const MeterStats& stats);
+
+    /**
+     * @brief Get the brightness of settings, in lines times gain factor.
+     *
+     * @param settings Sensor controls.
+     * @return uint32_t Relative brightness.
+     */
+    static uint32_t brightness(const ExposureSettings& settings);
+
+private:
+    ExposureConfig config; ///< Targets and limits.
+};
+
+#endif // RETROLENS_EXPOSURE_CONTROL_H
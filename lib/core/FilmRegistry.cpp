@@ -0,0 +1,383 @@
+#include <string.h>
+
+#include "FilmRegistry.h"
+
+// Keys of a film section, in the order of their bit in filmKeys
+enum FilmKey { KEY_CAPACITY, KEY_CONTRAST, KEY_SATURATION, KEY_FRAME_SIZE, KEY_JPEG_QUALITY, KEY_XCLK_MHZ, KEY_COUNT };
+
+struct FilmKeyRange {
+    const char* name;
+    int minimum;
+    int maximum;
+};
+
+static const FilmKeyRange FILM_KEYS[KEY_COUNT] = {
+    {"capacity", 1, 999},   {"contrast", -100, 100}, {"saturation", 0, 200},
+    {"frame_size", 0, 254}, {"jpeg_quality", 4, 63}, {"xclk_mhz", 1, 20},
+};
+
+static bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static bool isNameCharacter(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// Decimal integer with an optional sign, the whole text, within -9999..9999
+static bool parseInteger(const char* text, size_t length, int* value) {
+    size_t i = 0;
+    bool negative = false;
+    if (i < length && (text[i] == '-' || text[i] == '+')) {
+        negative = text[i] == '-';
+        i++;
+    }
+    if (i == length || length - i > 4) {
+        return false;
+    }
+    int result = 0;
+    for (; i < length; i++) {
+        if (text[i] < '0' || text[i] > '9') {
+            return false;
+        }
+        result = result * 10 + (text[i] - '0');
+    }
+    *value = negative ? -result : result;
+    return true;
+}
+
+FilmRegistry::FilmRegistry() : count(0), seed(0), lineNumber(0), errorLine(0), filmKeys(0), inFilm(false) {
+    memset(slots, -1, sizeof(slots));
+}
+
+int FilmRegistry::parse(const char* text, size_t length) {
+    beginParse();
+    size_t start = 0;
+    while (start < length) {
+        const char* end = static_cast<const char*>(memchr(text + start, '\n', length - start));
+        size_t lineLength = end != nullptr ? (size_t) (end - (text + start)) : length - start;
+        int result = parseLine(text + start, lineLength);
+        if (result != FILM_REGISTRY_OK) {
+            return result;
+        }
+        start += lineLength + 1;
+    }
+    return endParse();
+}
+
+void FilmRegistry::beginParse() {
+    count = 0;
+    seed = 0;
+    memset(slots, -1, sizeof(slots));
+    lineNumber = 0;
+    errorLine = 0;
+    filmKeys = 0;
+    inFilm = false;
+}
+
+int FilmRegistry::fail(int error) {
+    errorLine = lineNumber;
+    count = 0;
+    inFilm = false;
+    return error;
+}
+
+int FilmRegistry::parseLine(const char* line, size_t length) {
+    lineNumber++;
+    if (length > FILM_REGISTRY_MAX_LINE) {
+        return fail(FILM_REGISTRY_ERROR_SYNTAX);
+    }
+    // Comments and surrounding blanks are dropped
+    for (size_t i = 0; i < length; i++) {
+        if (line[i] == '#' || line[i] == ';') {
+            length = i;
+            break;
+        }
+    }
+    while (length > 0 && isBlank(line[length - 1])) {
+        length--;
+    }
+    while (length > 0 && isBlank(line[0])) {
+        line++;
+        length--;
+    }
+    if (length == 0) {
+        return FILM_REGISTRY_OK;
+    }
+
+    if (line[0] == '[') {
+        if (line[length - 1] != ']') {
+            return fail(FILM_REGISTRY_ERROR_SYNTAX);
+        }
+        int result = closeFilm();
+        if (result != FILM_REGISTRY_OK) {
+            return result;
+        }
+        if (count == FILM_REGISTRY_MAX_FILMS) {
+            return fail(FILM_REGISTRY_ERROR_FULL);
+        }
+        size_t nameLength = length - 2;
+        if (nameLength == 0 || nameLength >= FILM_REGISTRY_NAME_BYTES) {
+            return fail(FILM_REGISTRY_ERROR_RANGE);
+        }
+        FilmStock* stock = &stocks[count];
+        memset(stock, 0, sizeof(*stock));
+        for (size_t i = 0; i < nameLength; i++) {
+            if (!isNameCharacter(line[1 + i])) {
+                return fail(FILM_REGISTRY_ERROR_RANGE);
+            }
+            stock->name[i] = line[1 + i];
+        }
+        for (int i = 0; i < count; i++) {
+            if (strcmp(stocks[i].name, stock->name) == 0) {
+                return fail(FILM_REGISTRY_ERROR_DUPLICATE);
+            }
+        }
+        stock->saturation = 100;
+        stock->sensor.frameSize = FILM_STOCK_SENSOR_UNSET;
+        stock->sensor.jpegQuality = FILM_STOCK_SENSOR_UNSET;
+        stock->sensor.xclkMhz = FILM_STOCK_SENSOR_UNSET;
+        filmKeys = 0;
+        inFilm = true;
+        return FILM_REGISTRY_OK;
+    }
+
+    // key = value, inside a film
+    const char* equals = static_cast<const char*>(memchr(line, '=', length));
+    if (!inFilm || equals == nullptr) {
+        return fail(FILM_REGISTRY_ERROR_SYNTAX);
+    }
+    size_t keyLength = (size_t) (equals - line);
+    while (keyLength > 0 && isBlank(line[keyLength - 1])) {
+        keyLength--;
+    }
+    const char* valueText = equals + 1;
+    size_t valueLength = length - (size_t) (valueText - line);
+    while (valueLength > 0 && isBlank(valueText[0])) {
+        valueText++;
+        valueLength--;
+    }
+
+    int key = 0;
+    while (key < KEY_COUNT && (strlen(FILM_KEYS[key].name) != keyLength || memcmp(FILM_KEYS[key].name, line, keyLength) != 0)) {
+        key++;
+    }
+    if (key == KEY_COUNT) {
+        return fail(FILM_REGISTRY_ERROR_SYNTAX);
+    }
+    if (filmKeys & (1u << key)) {
+        return fail(FILM_REGISTRY_ERROR_DUPLICATE);
+    }
+    int value;
+    if (!parseInteger(valueText, valueLength, &value)) {
+        return fail(FILM_REGISTRY_ERROR_SYNTAX);
+    }
+    if (value < FILM_KEYS[key].minimum || value > FILM_KEYS[key].maximum) {
+        return fail(FILM_REGISTRY_ERROR_RANGE);
+    }
+    filmKeys |= 1u << key;
+
+    FilmStock* stock = &stocks[count];
+    switch (key) {
+        case KEY_CAPACITY:
+            stock->capacity = (uint16_t) value;
+            break;
+        case KEY_CONTRAST:
+            stock->contrast = (int8_t) value;
+            break;
+        case KEY_SATURATION:
+            stock->saturation = (uint8_t) value;
+            break;
+        case KEY_FRAME_SIZE:
+            stock->sensor.frameSize = (uint8_t) value;
+            break;
+        case KEY_JPEG_QUALITY:
+            stock->sensor.jpegQuality = (uint8_t) value;
+            break;
+        case KEY_XCLK_MHZ:
+            stock->sensor.xclkMhz = (uint8_t) value;
+            break;
+    }
+    return FILM_REGISTRY_OK;
+}
+
+int FilmRegistry::closeFilm() {
+    if (!inFilm) {
+        return FILM_REGISTRY_OK;
+    }
+    if (!(filmKeys & (1u << KEY_CAPACITY))) {
+        return fail(FILM_REGISTRY_ERROR_MISSING);
+    }
+    count++;
+    inFilm = false;
+    return FILM_REGISTRY_OK;
+}
+
+int FilmRegistry::endParse() {
+    lineNumber++;
+    int result = closeFilm();
+    if (result != FILM_REGISTRY_OK) {
+        return result;
+    }
+    if (count == 0) {
+        return fail(FILM_REGISTRY_ERROR_MISSING);
+    }
+    if (!buildHash()) {
+        return fail(FILM_REGISTRY_ERROR_HASH);
+    }
+    errorLine = 0;
+    return count;
+}
+
+int FilmRegistry::getErrorLine() const {
+    return errorLine;
+}
+
+uint32_t FilmRegistry::hashName(const char* name, uint32_t seed) {
+    // FNV-1a from a seeded basis, with the high bits folded into the slot bits
+    uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (; *name != '\0'; name++) {
+        hash = (hash ^ (uint8_t) *name) * 16777619u;
+    }
+    return hash ^ (hash >> 15);
+}
+
+bool FilmRegistry::buildHash() {
+    for (uint32_t candidate = 0; candidate < FILM_REGISTRY_MAX_SEEDS; candidate++) {
+        memset(slots, -1, sizeof(slots));
+        int placed = 0;
+        while (placed < count) {
+            uint32_t slot = hashName(stocks[placed].name, candidate) & (FILM_REGISTRY_SLOTS - 1);
+            if (slots[slot] >= 0) {
+                break;
+            }
+            slots[slot] = (int8_t) placed++;
+        }
+        if (placed == count) {
+            seed = candidate;
+            return true;
+        }
+    }
+    memset(slots, -1, sizeof(slots));
+    return false;
+}
+
+int FilmRegistry::find(const char* name) const {
+    if (count == 0 || name == nullptr) {
+        return -1;
+    }
+    int index = slots[hashName(name, seed) & (FILM_REGISTRY_SLOTS - 1)];
+    if (index >= 0 && strncmp(stocks[index].name, name, FILM_REGISTRY_NAME_BYTES) == 0) {
+        return index;
+    }
+    return -1;
+}
+
+int FilmRegistry::getCount() const {
+    return count;
+}
+
+const FilmStock* FilmRegistry::getStock(int index) const {
+    return index >= 0 && index < count ? &stocks[index] : nullptr;
+}
+
+uint32_t FilmRegistry::getSeed() const {
+    return seed;
+}
+
+bool FilmRegistry::isValidStock(const FilmStock& stock) {
+    size_t nameLength = strnlen(stock.name, FILM_REGISTRY_NAME_BYTES);
+    if (nameLength == 0 || nameLength == FILM_REGISTRY_NAME_BYTES) {
+        return false;
+    }
+    for (size_t i = 0; i < nameLength; i++) {
+        if (!isNameCharacter(stock.name[i])) {
+            return false;
+        }
+    }
+    for (size_t i = nameLength; i < FILM_REGISTRY_NAME_BYTES; i++) {
+        if (stock.name[i] != '\0') {
+            return false;
+        }
+    }
+    int values[KEY_COUNT] = {stock.capacity, stock.contrast, stock.saturation};
+    for (int key = 0; key <= KEY_SATURATION; key++) {
+        if (values[key] < FILM_KEYS[key].minimum || values[key] > FILM_KEYS[key].maximum) {
+            return false;
+        }
+    }
+    const uint8_t sensor[] = {stock.sensor.frameSize, stock.sensor.jpegQuality, stock.sensor.xclkMhz};
+    for (int key = KEY_FRAME_SIZE; key < KEY_COUNT; key++) {
+        uint8_t value = sensor[key - KEY_FRAME_SIZE];
+        if (value != FILM_STOCK_SENSOR_UNSET && (value < FILM_KEYS[key].minimum || value > FILM_KEYS[key].maximum)) {
+            return false;
+        }
+    }
+    return stock.reserved == 0;
+}
+
+size_t FilmRegistry::serialize(uint8_t* out, size_t capacity, uint32_t sourceLength, uint32_t sourceStamp) const {
+    size_t length = sizeof(FilmRegistryHeader) + sizeof(slots) + count * sizeof(FilmStock) + sizeof(uint32_t);
+    if (count == 0 || length > capacity) {
+        return 0;
+    }
+    FilmRegistryHeader header = {FILM_REGISTRY_MAGIC, FILM_REGISTRY_VERSION, (uint8_t) count, 0, seed, sourceLength, sourceStamp};
+    uint8_t* cursor = out;
+    memcpy(cursor, &header, sizeof(header));
+    cursor += sizeof(header);
+    memcpy(cursor, slots, sizeof(slots));
+    cursor += sizeof(slots);
+    memcpy(cursor, stocks, count * sizeof(FilmStock));
+    cursor += count * sizeof(FilmStock);
+    uint32_t checksum = StandbyStore::crc32(out, (size_t) (cursor - out));
+    memcpy(cursor, &checksum, sizeof(checksum));
+    return length;
+}
+
+bool FilmRegistry::deserialize(const uint8_t* blob, size_t length, uint32_t sourceLength, uint32_t sourceStamp) {
+    beginParse();
+    FilmRegistryHeader header;
+    if (blob == nullptr || length < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, blob, sizeof(header));
+    if (header.magic != FILM_REGISTRY_MAGIC || header.version != FILM_REGISTRY_VERSION || header.count == 0 ||
+        header.count > FILM_REGISTRY_MAX_FILMS || header.reserved != 0 || header.sourceLength != sourceLength ||
+        header.sourceStamp != sourceStamp) {
+        return false;
+    }
+    size_t expected = sizeof(header) + sizeof(slots) + header.count * sizeof(FilmStock) + sizeof(uint32_t);
+    uint32_t checksum;
+    if (length != expected) {
+        return false;
+    }
+    memcpy(&checksum, blob + expected - sizeof(checksum), sizeof(checksum));
+    if (checksum != StandbyStore::crc32(blob, expected - sizeof(checksum))) {
+        return false;
+    }
+
+    // The checksum only catches a damaged card, the content is checked as if it were not ours
+    memcpy(slots, blob + sizeof(header), sizeof(slots));
+    memcpy(stocks, blob + sizeof(header) + sizeof(slots), header.count * sizeof(FilmStock));
+    int filled = 0;
+    for (int slot = 0; slot < FILM_REGISTRY_SLOTS; slot++) {
+        if (slots[slot] >= header.count || slots[slot] < -1) {
+            memset(slots, -1, sizeof(slots));
+            return false;
+        }
+        filled += slots[slot] >= 0;
+    }
+    for (int i = 0; i < header.count; i++) {
+        if (!isValidStock(stocks[i]) || slots[hashName(stocks[i].name, header.seed) & (FILM_REGISTRY_SLOTS - 1)] != i) {
+            memset(slots, -1, sizeof(slots));
+            return false;
+        }
+    }
+    if (filled != header.count) {
+        memset(slots, -1, sizeof(slots));
+        return false;
+    }
+    count = header.count;
+    seed = header.seed;
+    return true;
+}
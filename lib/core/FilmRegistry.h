@@ -0,0 +1,230 @@
+#ifndef RETROLENS_FILM_REGISTRY_H
+#define RETROLENS_FILM_REGISTRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "StandbyStore.h"
+
+// Cached registry written by serialize(), bump the version when the layout changes
+#define FILM_REGISTRY_MAGIC 0x4B545352u // "RSTK"
+#define FILM_REGISTRY_VERSION 1
+
+// Film stocks the registry holds, and the slots of its hash table, a power of two at least twice as many
+#define FILM_REGISTRY_MAX_FILMS 16
+#define FILM_REGISTRY_SLOTS 32
+
+// Longest film name with the terminating zero, names are made of a-z, 0-9 and _
+#define FILM_REGISTRY_NAME_BYTES 24
+
+// Longest line of a film stock file, line break excluded
+#define FILM_REGISTRY_MAX_LINE 80
+
+// Hash seeds tried before giving up on a perfect hash
+#define FILM_REGISTRY_MAX_SEEDS 65536
+
+// Sensor settings a film stock leaves to the camera
+#define FILM_STOCK_SENSOR_UNSET 0xFF
+
+// Parse results
+#define FILM_REGISTRY_OK 0
+#define FILM_REGISTRY_ERROR_SYNTAX -1    // Malformed line, unknown key or a key outside of a film
+#define FILM_REGISTRY_ERROR_RANGE -2     // Value out of range, or a name too long or with other characters
+#define FILM_REGISTRY_ERROR_DUPLICATE -3 // Film or key given twice
+#define FILM_REGISTRY_ERROR_FULL -4      // More than FILM_REGISTRY_MAX_FILMS films
+#define FILM_REGISTRY_ERROR_MISSING -5   // A film without capacity, or no film at all
+#define FILM_REGISTRY_ERROR_HASH -6      // No perfect hash found
+
+/**
+ * @struct FilmStock
+ * @brief Definition of a film stock: what a roll holds and how its frames are taken and developed.
+ */
+struct FilmStock {
+    char name[FILM_REGISTRY_NAME_BYTES]; ///< Film name, zero terminated, the folder suffix of its rolls.
+    uint16_t capacity;                   ///< Frames of a roll.
+    int8_t contrast;                     ///< FilmLook contrast, in percent.
+    uint8_t saturation;                  ///< FilmLook saturation, in percent.
+    SensorProfile sensor;                ///< Sensor settings, FILM_STOCK_SENSOR_UNSET fields keep the camera's.
+    uint8_t reserved;                    ///< Zero.
+};
+
+/**
+ * @struct FilmRegistryHeader
+ * @brief Start of a cached registry, followed by the hash slots, the stocks and a CRC-32 of all of them.
+ */
+struct FilmRegistryHeader {
+    uint32_t magic;        ///< FILM_REGISTRY_MAGIC.
+    uint16_t version;      ///< FILM_REGISTRY_VERSION.
+    uint8_t count;         ///< Number of stocks.
+    uint8_t reserved;      ///< Zero.
+    uint32_t seed;         ///< Seed of the perfect hash.
+    uint32_t sourceLength; ///< Size of the film stock file the registry was parsed from.
+    uint32_t sourceStamp;  ///< Modification time of that file.
+};
+
+// Largest cached registry
+#define FILM_REGISTRY_MAX_BLOB_BYTES \
+    (sizeof(FilmRegistryHeader) + FILM_REGISTRY_SLOTS + FILM_REGISTRY_MAX_FILMS * sizeof(FilmStock) + sizeof(uint32_t))
+
+/**
+ * @class FilmRegistry
+ * @brief Film stocks by name, parsed from a text file and looked up through a perfect hash.
+ *
+ * The film stock file has a section per film, with one key a line:
+ *
+ * @code
+ * # Comments start with # or ;
+ * [test_film]
+ * capacity = 36       ; frames of a roll, required
+ * contrast = 20       ; -100..100, 0 by default
+ * saturation = 90     ; 0..200, 100 by default
+ * frame_size = 21     ; framesize_t, the sensor settings are left to the camera when not given
+ * jpeg_quality = 12   ; 4..63, the finest quality the rate control picks for the film
+ * xclk_mhz = 4        ; 1..20
+ * @endcode
+ *
+ * The file is parsed line by line, so it can be streamed from the card. Once parsed, a seed is
+ * searched so the hashes of the names land in distinct slots: a lookup is one hash, one slot and
+ * one string compare. serialize() and deserialize() keep the parsed registry as a blob, with the
+ * size and time of its file, so later boots skip the parse while the file does not change.
+ *
+ * A parse or a load that fails leaves the registry unusable; parse into a spare registry and
+ * copy it over on success.
+ *
+ * Example usage:
+ * @code
+ * FilmRegistry registry;
+ * if (registry.parse(text, length) > 0) {
+ *     int index = registry.find("test_film");
+ *     int capacity = index >= 0 ? registry.getStock(index)->capacity : -1;
+ * }
+ * @endcode
+ */
+class FilmRegistry {
+public:
+    /**
+     * @brief Constructor for FilmRegistry, without films.
+     */
+    FilmRegistry();
+
+    /**
+     * @brief Parse a whole film stock file.
+     *
+     * @param text Content of the file.
+     * @param length Size of the content.
+     * @return int Number of films, or a FILM_REGISTRY_ERROR_* code.
+     */
+    int parse(const char* text, size_t length);
+
+    /**
+     * @brief Start parsing a film stock file, the films are forgotten.
+     */
+    void beginParse();
+
+    /**
+     * @brief Parse the next line of the file.
+     *
+     * @param line Line, without its line break, not zero terminated.
+     * @param length Size of the line.
+     * @return int FILM_REGISTRY_OK or a FILM_REGISTRY_ERROR_* code.
+     */
+    int parseLine(const char* line, size_t length);
+
+    /**
+     * @brief Finish parsing and build the hash.
+     *
+     * @return int Number of films, or a FILM_REGISTRY_ERROR_* code.
+     */
+    int endParse();
+
+    /**
+     * @brief Get the line of the file the last error was found on.
+     *
+     * @return int Line number from 1, 0 for an error found at the end or none.
+     */
+    int getErrorLine() const;
+
+    /**
+     * @brief Find a film by name.
+     *
+     * @param name Film name, zero terminated.
+     * @return int Index of the film, or -1 if there is none with this name.
+     */
+    int find(const char* name) const;
+
+    /**
+     * @brief Get the number of films.
+     */
+    int getCount() const;
+
+    /**
+     * @brief Get a film by index.
+     *
+     * @return const FilmStock* The film, or nullptr for an invalid index.
+     */
+    const FilmStock* getStock(int index) const;
+
+    /**
+     * @brief Get the seed of the perfect hash.
+     */
+    uint32_t getSeed() const;
+
+    /**
+     * @brief Write the registry as a blob.
+     *
+     * @param out Output buffer.
+     * @param capacity Size of the buffer, FILM_REGISTRY_MAX_BLOB_BYTES always fits.
+     * @param sourceLength Size of the film stock file.
+     * @param sourceStamp Modification time of the file.
+     * @return size_t Size of the blob, 0 if it does not fit or there are no films.
+     */
+    size_t serialize(uint8_t* out, size_t capacity, uint32_t sourceLength, uint32_t sourceStamp) const;
+
+    /**
+     * @brief Load a blob of serialize(), checking all of it.
+     *
+     * @param blob Blob.
+     * @param length Size of the blob.
+     * @param sourceLength Size of the film stock file now.
+     * @param sourceStamp Modification time of the file now.
+     * @return true if the blob is intact and was made from the file as it is now.
+     */
+    bool deserialize(const uint8_t* blob, size_t length, uint32_t sourceLength, uint32_t sourceStamp);
+
+private:
+    /**
+     * @brief Hash a name with a seed.
+     */
+    static uint32_t hashName(const char* name, uint32_t seed);
+
+    /**
+     * @brief Check the name and the ranges of a film.
+     */
+    static bool isValidStock(const FilmStock& stock);
+
+    /**
+     * @brief Close the film being parsed, checking its required keys.
+     */
+    int closeFilm();
+
+    /**
+     * @brief Place every film in a slot of its own, searching a seed.
+     */
+    bool buildHash();
+
+    /**
+     * @brief Record a parse error at the current line.
+     */
+    int fail(int error);
+
+    FilmStock stocks[FILM_REGISTRY_MAX_FILMS]; ///< Films, in file order.
+    int8_t slots[FILM_REGISTRY_SLOTS];         ///< Film of each hash slot, -1 for none.
+    int count;                                 ///< Number of films.
+    uint32_t seed;                             ///< Seed of the perfect hash.
+    int lineNumber;                            ///< Lines parsed so far.
+    int errorLine;                             ///< Line of the last error.
+    uint32_t filmKeys;                         ///< Keys given for the film being parsed, a bit each.
+    bool inFilm;                               ///< True once a section was opened.
+};
+
+#endif // RETROLENS_FILM_REGISTRY_H
@@ -0,0 +1,104 @@
+#include "FlashSync.h"
+
+FlashSync::FlashSync(const FlashSyncConfig& config)
+    : config(config), state(FLASH_STATE_IDLE), lampOnUs(0), lastFrameUs(-1), framePeriodUs(0), droppedFrames(0),
+      litFrames(0), lastOnTimeUs(0), lastDroppedFrames(0), shotCount(0), failureCount(0), onTimeSumUs(0),
+      maxOnTimeUs(0) {}
+
+void FlashSync::arm() {
+    state = FLASH_STATE_ARMED;
+    droppedFrames = 0;
+    litFrames = 0;
+}
+
+int FlashSync::onFrame(int64_t frameStartUs, int64_t nowUs) {
+    // Track the frame period, the worst case exposure
+    if (lastFrameUs >= 0 && frameStartUs > lastFrameUs) {
+        framePeriodUs = frameStartUs - lastFrameUs;
+    }
+    lastFrameUs = frameStartUs;
+
+    if (state == FLASH_STATE_ARMED) {
+        // A frame just ended, switch the lamp on at the boundary
+        state = FLASH_STATE_LIT;
+        lampOnUs = nowUs;
+        droppedFrames++;
+        return FLASH_FRAME_DROP;
+    }
+    if (state != FLASH_STATE_LIT) {
+        return FLASH_FRAME_DROP;
+    }
+
+    // Every row of the frame integrated after the LED reached full brightness
+    int64_t exposureUs = config.exposureUs > 0 ? config.exposureUs : framePeriodUs;
+    if (framePeriodUs > 0 && frameStartUs - exposureUs >= lampOnUs + config.ledRiseUs) {
+        finish(nowUs, true);
+        return FLASH_FRAME_KEEP;
+    }
+
+    droppedFrames++;
+    if (++litFrames >= config.maxLitFrames) {
+        finish(nowUs, false);
+    }
+    return FLASH_FRAME_DROP;
+}
+
+void FlashSync::abort(int64_t nowUs) {
+    if (state == FLASH_STATE_LIT) {
+        finish(nowUs, false);
+    } else if (state == FLASH_STATE_ARMED) {
+        state = FLASH_STATE_IDLE;
+        failureCount++;
+    }
+}
+
+void FlashSync::finish(int64_t nowUs, bool lit) {
+    state = FLASH_STATE_IDLE;
+    lastOnTimeUs = nowUs - lampOnUs;
+    lastDroppedFrames = droppedFrames;
+    if (!lit) {
+        failureCount++;
+        return;
+    }
+    shotCount++;
+    onTimeSumUs += lastOnTimeUs;
+    if (lastOnTimeUs > maxOnTimeUs) {
+        maxOnTimeUs = lastOnTimeUs;
+    }
+}
+
+bool FlashSync::isLampOn() const {
+    return state == FLASH_STATE_LIT;
+}
+
+int FlashSync::getState() const {
+    return state;
+}
+
+int64_t FlashSync::getFramePeriodUs() const {
+    return framePeriodUs;
+}
+
+int64_t FlashSync::getLastOnTimeUs() const {
+    return lastOnTimeUs;
+}
+
+int FlashSync::getLastDroppedFrames() const {
+    return lastDroppedFrames;
+}
+
+uint32_t FlashSync::getShotCount() const {
+    return shotCount;
+}
+
+uint32_t FlashSync::getFailureCount() const {
+    return failureCount;
+}
+
+int64_t FlashSync::getMeanOnTimeUs() const {
+    return shotCount == 0 ? 0 : onTimeSumUs / (int64_t) shotCount;
+}
+
+int64_t FlashSync::getMaxOnTimeUs() const {
+    return maxOnTimeUs;
+}
@@ -0,0 +1,177 @@
+#ifndef RETROLENS_FLASH_SYNC_H
+#define RETROLENS_FLASH_SYNC_H
+
+#include <stdint.h>
+
+// What to do with a frame handed to onFrame()
+#define FLASH_FRAME_DROP 0 // Stale or partially lit, return it to the driver
+#define FLASH_FRAME_KEEP 1 // Lit for its whole exposure, save it
+
+// Flash sync states
+#define FLASH_STATE_IDLE 0     // Lamp off, no shot
+#define FLASH_STATE_ARMED 1    // Waiting for a frame boundary to switch the lamp on
+#define FLASH_STATE_LIT 2      // Lamp on, dropping frames until one is fully lit
+
+// Defaults of the flash sync
+#define FLASH_LED_RISE_US 1000   // Time the LED takes to reach full brightness
+#define FLASH_MAX_LIT_FRAMES 4   // Frames dropped with the lamp on before giving up
+
+/**
+ * @struct FlashSyncConfig
+ * @brief Timing of the lamp and of the sensor exposure.
+ */
+struct FlashSyncConfig {
+    int64_t exposureUs = 0;                  ///< Exposure time, 0 to assume the worst case of a whole frame period.
+    int64_t ledRiseUs = FLASH_LED_RISE_US;   ///< Time the LED takes to reach full brightness.
+    int maxLitFrames = FLASH_MAX_LIT_FRAMES; ///< Frames dropped with the lamp on before the shot fails.
+};
+
+/**
+ * @class FlashSync
+ * @brief Keeps the flash on only for the frame it lights, synchronized to the frame boundaries.
+ *
+ * Frames are reported as they arrive, with the time their readout started. Once armed, the
+ * lamp goes on at the next frame boundary, and every frame whose rows may have started
+ * integrating before the LED was at full brightness is dropped: a frame is lit if its readout
+ * started at least an exposure after the lamp reached full brightness. The lamp goes off as soon
+ * as that frame arrives, not after the save, and its on time is added to the statistics.
+ *
+ * Without a known exposure the frame period, measured from the frame times, is used, since a
+ * rolling shutter row never integrates longer than a frame.
+ *
+ * The controller only decides, the caller switches the lamp from isLampOn() and owns the clock,
+ * which keeps it testable on the host.
+ *
+ * Example usage:
+ * @code
+ * FlashSync sync;
+ * sync.arm();
+ * while (sync.getState() != FLASH_STATE_IDLE) {
+ *     camera_fb_t* fb = esp_camera_fb_get();
+ *     int action = sync.onFrame(frameTimeUs(fb), esp_timer_get_time());
+ *     digitalWrite(LAMP_PIN, sync.isLampOn());
+ *     if (action == FLASH_FRAME_KEEP) {
+ *         // Save fb
+ *     }
+ *     esp_camera_fb_return(fb);
+ * }
+ * @endcode
+ */
+class FlashSync {
+public:
+    /**
+     * @brief Construct an idle controller.
+     *
+     * @param config Timing of the lamp and of the sensor.
+     */
+    FlashSync(const FlashSyncConfig& config = FlashSyncConfig());
+
+    /**
+     * @brief Arm the flash for the next shot. The lamp goes on at the next frame.
+     */
+    void arm();
+
+    /**
+     * @brief Report a frame.
+     *
+     * @param frameStartUs Time the readout of the frame started.
+     * @param nowUs Current time, when the frame was received.
+     * @return int FLASH_FRAME_KEEP for the lit frame, FLASH_FRAME_DROP otherwise.
+     */
+    int onFrame(int64_t frameStartUs, int64_t nowUs);
+
+    /**
+     * @brief Abort the shot and switch the lamp off, for a capture error.
+     *
+     * @param nowUs Current time.
+     */
+    void abort(int64_t nowUs);
+
+    /**
+     * @brief Check if the lamp should be on.
+     *
+     * @return true while the lamp is on.
+     */
+    bool isLampOn() const;
+
+    /**
+     * @brief Get the state of the controller.
+     *
+     * @return int One of the FLASH_STATE_* values.
+     */
+    int getState() const;
+
+    /**
+     * @brief Get the measured frame period.
+     *
+     * @return int64_t Period in microseconds, 0 before two frames were seen.
+     */
+    int64_t getFramePeriodUs() const;
+
+    /**
+     * @brief Get the lamp on time of the last shot.
+     *
+     * @return int64_t Time in microseconds.
+     */
+    int64_t getLastOnTimeUs() const;
+
+    /**
+     * @brief Get the number of frames dropped during the last shot.
+     *
+     * @return int Frame count, the boundary frame included.
+     */
+    int getLastDroppedFrames() const;
+
+    /**
+     * @brief Get the number of shots with a lit frame.
+     *
+     * @return uint32_t Count.
+     */
+    uint32_t getShotCount() const;
+
+    /**
+     * @brief Get the number of shots aborted or without a lit frame.
+     *
+     * @return uint32_t Count.
+     */
+    uint32_t getFailureCount() const;
+
+    /**
+     * @brief Get the average lamp on time of the shots.
+     *
+     * @return int64_t Time in microseconds, 0 before the first shot.
+     */
+    int64_t getMeanOnTimeUs() const;
+
+    /**
+     * @brief Get the longest lamp on time of the shots.
+     *
+     * @return int64_t Time in microseconds.
+     */
+    int64_t getMaxOnTimeUs() const;
+
+private:
+    /**
+     * @brief Switch the lamp off and record the on time.
+     *
+     * @param nowUs Current time.
+     * @param lit True if a lit frame was captured.
+     */
+    void finish(int64_t nowUs, bool lit);
+
+    FlashSyncConfig config;  ///< Timing of the lamp and of the sensor.
+    int state;               ///< One of the FLASH_STATE_* values.
+    int64_t lampOnUs;        ///< Time the lamp went on.
+    int64_t lastFrameUs;     ///< Start of the last frame, -1 before the first.
+    int64_t framePeriodUs;   ///< Measured frame period.
+    int droppedFrames;       ///< Frames dropped during the current shot.
+    int litFrames;           ///< Frames seen with the lamp on.
+    int64_t lastOnTimeUs;    ///< Lamp on time of the last shot.
+    int lastDroppedFrames;   ///< Frames dropped during the last shot.
+    uint32_t shotCount;      ///< Shots with a lit frame.
+    uint32_t failureCount;   ///< Shots without a lit frame.
+    int64_t onTimeSumUs;     ///< Sum of the on times of the shots.
+    int64_t maxOnTimeUs;     ///< Longest on time.
+};
+
+#endif // RETROLENS_FLASH_SYNC_H
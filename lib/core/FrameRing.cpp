@@ -0,0 +1,123 @@
+#include "FrameRing.h"
+
+FrameRing::FrameRing(int capacity)
+    : capacity(capacity), head(0), count(0), holding(false), holdTimeUs(0), shotCount(0), offsetSumUs(0), absOffsetSumUs(0), minOffsetUs(0),
+      maxOffsetUs(0) {
+    if (this->capacity < 1) {
+        this->capacity = 1;
+    }
+    if (this->capacity > FRAME_RING_MAX_FRAMES) {
+        this->capacity = FRAME_RING_MAX_FRAMES;
+    }
+}
+
+bool FrameRing::push(void* frame, int64_t timeUs, void** evicted) {
+    bool full = count == capacity;
+    if (full) {
+        *evicted = popOldest();
+    }
+    frames[(head + count) % capacity] = {frame, timeUs};
+    count++;
+    return full;
+}
+
+void FrameRing::hold(int64_t pressTimeUs) {
+    holding = true;
+    holdTimeUs = pressTimeUs;
+}
+
+void FrameRing::unhold() {
+    holding = false;
+}
+
+bool FrameRing::needsFrames() const {
+    if (!holding || count == 0) {
+        return true;
+    }
+    // Older frames are further from the press than the newest one, evicting them is harmless
+    return frames[(head + count - 1) % capacity].timeUs < holdTimeUs;
+}
+
+void* FrameRing::popOldest() {
+    if (count == 0) {
+        return nullptr;
+    }
+    void* frame = frames[head].frame;
+    head = (head + 1) % capacity;
+    count--;
+    return frame;
+}
+
+void* FrameRing::takeClosest(int64_t pressTimeUs, int64_t* frameTimeUs) {
+    holding = false;
+    if (count == 0) {
+        return nullptr;
+    }
+
+    // Frames are in time order, the first strictly closer one wins so ties keep the earlier frame
+    int best = 0;
+    int64_t bestDistance = -1;
+    for (int i = 0; i < count; i++) {
+        int64_t offset = frames[(head + i) % capacity].timeUs - pressTimeUs;
+        int64_t distance = offset < 0 ? -offset : offset;
+        if (bestDistance < 0 || distance < bestDistance) {
+            best = i;
+            bestDistance = distance;
+        }
+    }
+
+    RingFrame taken = frames[(head + best) % capacity];
+    // Close the gap, keeping the time order
+    for (int i = best; i < count - 1; i++) {
+        frames[(head + i) % capacity] = frames[(head + i + 1) % capacity];
+    }
+    count--;
+
+    int64_t offset = taken.timeUs - pressTimeUs;
+    if (shotCount == 0 || offset < minOffsetUs) {
+        minOffsetUs = offset;
+    }
+    if (shotCount == 0 || offset > maxOffsetUs) {
+        maxOffsetUs = offset;
+    }
+    shotCount++;
+    offsetSumUs += offset;
+    absOffsetSumUs += offset < 0 ? -offset : offset;
+
+    if (frameTimeUs != nullptr) {
+        *frameTimeUs = taken.timeUs;
+    }
+    return taken.frame;
+}
+
+int FrameRing::getCount() const {
+    return count;
+}
+
+int FrameRing::getCapacity() const {
+    return capacity;
+}
+
+bool FrameRing::isFull() const {
+    return count == capacity;
+}
+
+uint32_t FrameRing::getShotCount() const {
+    return shotCount;
+}
+
+int64_t FrameRing::getMeanOffsetUs() const {
+    return shotCount == 0 ? 0 : offsetSumUs / (int64_t) shotCount;
+}
+
+int64_t FrameRing::getMeanAbsOffsetUs() const {
+    return shotCount == 0 ? 0 : absOffsetSumUs / (int64_t) shotCount;
+}
+
+int64_t FrameRing::getMinOffsetUs() const {
+    return minOffsetUs;
+}
+
+int64_t FrameRing::getMaxOffsetUs() const {
+    return maxOffsetUs;
+}
@@ -0,0 +1,168 @@
+#ifndef RETROLENS_FRAME_RING_H
+#define RETROLENS_FRAME_RING_H
+
+#include <stdint.h>
+
+// Maximum number of frames the ring can hold
+#define FRAME_RING_MAX_FRAMES 4
+
+/**
+ * @struct RingFrame
+ * @brief Frame held by the ring with the time it was exposed.
+ */
+struct RingFrame {
+    void* frame;    ///< Opaque frame handle, a camera_fb_t on the device.
+    int64_t timeUs; ///< Time of the frame in microseconds.
+};
+
+/**
+ * @class FrameRing
+ * @brief Ring of timestamped frames that picks the frame closest to a shutter press.
+ *
+ * While armed, the camera keeps pushing frames; once full the oldest one is evicted and handed
+ * back to the caller, which returns it to the camera driver. A press holds the ring: it only
+ * needs frames until one at or after the press is in, so the frames around the press survive
+ * until the shot is requested on release. On a shot the frame closest to the press is taken,
+ * ties going to the earlier frame, and its offset from the press is added to the
+ * press-to-exposure statistics. A positive offset means the frame came after the press.
+ *
+ * The ring does no locking, the owner must serialize the calls (see ZslService).
+ *
+ * Example usage:
+ * @code
+ * FrameRing ring(2);
+ * void* evicted;
+ * if (ring.needsFrames() && ring.push(fb, fbTimeUs, &evicted)) {
+ *     esp_camera_fb_return((camera_fb_t*) evicted);
+ * }
+ *
+ * // On the press, then on the release
+ * ring.hold(pressTimeUs);
+ * camera_fb_t* shot = (camera_fb_t*) ring.takeClosest(pressTimeUs, nullptr);
+ * @endcode
+ */
+class FrameRing {
+public:
+    /**
+     * @brief Construct an empty ring.
+     *
+     * @param capacity Number of frames kept, clamped to 1..FRAME_RING_MAX_FRAMES.
+     */
+    FrameRing(int capacity = FRAME_RING_MAX_FRAMES);
+
+    /**
+     * @brief Add the newest frame, evicting the oldest one if the ring is full.
+     *
+     * @param frame Frame handle.
+     * @param timeUs Time of the frame.
+     * @param evicted Output evicted frame, set only when the function returns true.
+     * @return true if a frame was evicted.
+     */
+    bool push(void* frame, int64_t timeUs, void** evicted);
+
+    /**
+     * @brief Hold the frames around a press until the shot takes one.
+     *
+     * @param pressTimeUs Time of the press.
+     */
+    void hold(int64_t pressTimeUs);
+
+    /**
+     * @brief Stop holding, frames are evicted as they come again.
+     */
+    void unhold();
+
+    /**
+     * @brief Check if new frames should be pushed.
+     *
+     * @return true unless the ring holds a press and already has a frame at or after it.
+     */
+    bool needsFrames() const;
+
+    /**
+     * @brief Remove the oldest frame.
+     *
+     * @return void* Frame handle, nullptr if the ring is empty.
+     */
+    void* popOldest();
+
+    /**
+     * @brief Remove the frame closest to a press, record its offset and stop holding.
+     *
+     * @param pressTimeUs Time of the press.
+     * @param frameTimeUs Output time of the frame taken, may be nullptr.
+     * @return void* Frame handle, nullptr if the ring is empty.
+     */
+    void* takeClosest(int64_t pressTimeUs, int64_t* frameTimeUs);
+
+    /**
+     * @brief Get the number of frames held.
+     *
+     * @return int Frame count.
+     */
+    int getCount() const;
+
+    /**
+     * @brief Get the number of frames the ring keeps.
+     *
+     * @return int Capacity.
+     */
+    int getCapacity() const;
+
+    /**
+     * @brief Check if the next push evicts a frame.
+     *
+     * @return true if the ring is full.
+     */
+    bool isFull() const;
+
+    /**
+     * @brief Get the number of frames taken for a press.
+     *
+     * @return uint32_t Count.
+     */
+    uint32_t getShotCount() const;
+
+    /**
+     * @brief Get the average press-to-exposure offset.
+     *
+     * @return int64_t Offset in microseconds, 0 before the first shot.
+     */
+    int64_t getMeanOffsetUs() const;
+
+    /**
+     * @brief Get the average distance between the press and the exposure.
+     *
+     * @return int64_t Distance in microseconds, 0 before the first shot.
+     */
+    int64_t getMeanAbsOffsetUs() const;
+
+    /**
+     * @brief Get the most negative press-to-exposure offset, the frame furthest before its press.
+     *
+     * @return int64_t Offset in microseconds, 0 before the first shot.
+     */
+    int64_t getMinOffsetUs() const;
+
+    /**
+     * @brief Get the most positive press-to-exposure offset, the frame furthest after its press.
+     *
+     * @return int64_t Offset in microseconds, 0 before the first shot.
+     */
+    int64_t getMaxOffsetUs() const;
+
+private:
+    RingFrame frames[FRAME_RING_MAX_FRAMES]; ///< Frames, oldest at head.
+    int capacity;                            ///< Number of frames kept.
+    int head;                                ///< Index of the oldest frame.
+    int count;                               ///< Number of frames held.
+    bool holding;                            ///< True while the frames around a press are held.
+    int64_t holdTimeUs;                      ///< Time of the held press.
+    uint32_t shotCount;                      ///< Frames taken for a press.
+    int64_t offsetSumUs;                     ///< Sum of the press-to-exposure offsets.
+    int64_t absOffsetSumUs;                  ///< Sum of their absolute values.
+    int64_t minOffsetUs;                     ///< Most negative offset.
+    int64_t maxOffsetUs;                     ///< Most positive offset.
+};
+
+#endif // RETROLENS_FRAME_RING_H
@@ -0,0 +1,51 @@
+#include "JobQueue.h"
+
+#define JOB_QUEUE_MASK (JOB_QUEUE_CAPACITY - 1)
+
+JobQueue::JobQueue() {
+    for (int i = 0; i < JOB_PRIORITY_COUNT; i++) {
+        head[i] = 0;
+        tail[i] = 0;
+    }
+}
+
+bool JobQueue::push(const Job& job) {
+    if (job.priority >= JOB_PRIORITY_COUNT || job.function == nullptr) {
+        return false;
+    }
+    uint8_t priority = job.priority;
+    if (tail[priority] - head[priority] >= JOB_QUEUE_CAPACITY) {
+        return false;
+    }
+    jobs[priority][tail[priority] & JOB_QUEUE_MASK] = job;
+    tail[priority]++;
+    return true;
+}
+
+bool JobQueue::pop(uint32_t priorityMask, Job* job) {
+    // Most urgent priority first, FIFO inside a priority
+    for (int priority = 0; priority < JOB_PRIORITY_COUNT; priority++) {
+        if ((priorityMask & JOB_PRIORITY_MASK(priority)) && head[priority] != tail[priority]) {
+            *job = jobs[priority][head[priority] & JOB_QUEUE_MASK];
+            head[priority]++;
+            return true;
+        }
+    }
+    return false;
+}
+
+int JobQueue::pending(uint8_t priority) const {
+    if (priority >= JOB_PRIORITY_COUNT) {
+        return 0;
+    }
+    return (int) (tail[priority] - head[priority]);
+}
+
+bool JobQueue::hasPending(uint32_t priorityMask) const {
+    for (int priority = 0; priority < JOB_PRIORITY_COUNT; priority++) {
+        if ((priorityMask & JOB_PRIORITY_MASK(priority)) && head[priority] != tail[priority]) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,94 @@
+#ifndef RETROLENS_JOB_QUEUE_H
+#define RETROLENS_JOB_QUEUE_H
+
+#include <stdint.h>
+
+// Job priorities, lower values run first
+#define JOB_PRIORITY_SHUTTER 0    // On the shutter path: capture and save
+#define JOB_PRIORITY_NORMAL 1     // User visible work that is not on the shutter path
+#define JOB_PRIORITY_BACKGROUND 2 // Battery reads and housekeeping
+#define JOB_PRIORITY_COUNT 3
+
+// Build a mask of the priorities served by a worker
+#define JOB_PRIORITY_MASK(priority) (1u << (priority))
+#define JOB_PRIORITY_MASK_ALL ((1u << JOB_PRIORITY_COUNT) - 1)
+
+// Number of pending jobs per priority, must be a power of two
+#define JOB_QUEUE_CAPACITY 8
+
+/**
+ * @brief Function run by a worker. Returns a result code passed to the completion callback.
+ */
+typedef int (*JobFunction)(void* arg);
+
+/**
+ * @brief Completion callback, called on the worker once the job function returns.
+ */
+typedef void (*JobCallback)(void* context, int result);
+
+/**
+ * @struct Job
+ * @brief Unit of work executed by the worker pool.
+ */
+struct Job {
+    JobFunction function;  ///< Function to run.
+    void* arg;             ///< Argument of the function.
+    JobCallback done;      ///< Completion callback, may be nullptr.
+    void* doneContext;     ///< Context of the completion callback.
+    uint8_t priority;      ///< One of the JOB_PRIORITY_* values.
+};
+
+/**
+ * @class JobQueue
+ * @brief Fixed-capacity queue of jobs with one FIFO per priority.
+ *
+ * pop() returns the oldest job of the most urgent priority allowed by the caller's mask.
+ * The queue does no locking, the owner must serialize the calls (see WorkerPool).
+ */
+class JobQueue {
+public:
+    /**
+     * @brief Construct an empty queue.
+     */
+    JobQueue();
+
+    /**
+     * @brief Add a job.
+     *
+     * @param job Job to copy into the queue.
+     * @return true if the job was queued, false if its priority FIFO is full or the priority is invalid.
+     */
+    bool push(const Job& job);
+
+    /**
+     * @brief Remove the most urgent job among the allowed priorities.
+     *
+     * @param priorityMask Priorities the caller can run, built with JOB_PRIORITY_MASK.
+     * @param job Output job.
+     * @return true if a job was removed, false if there is no job for the mask.
+     */
+    bool pop(uint32_t priorityMask, Job* job);
+
+    /**
+     * @brief Get the number of pending jobs of a priority.
+     *
+     * @param priority Job priority.
+     * @return int Number of pending jobs.
+     */
+    int pending(uint8_t priority) const;
+
+    /**
+     * @brief Check if there is a pending job among the given priorities.
+     *
+     * @param priorityMask Priorities to check, built with JOB_PRIORITY_MASK.
+     * @return true if at least one job is pending.
+     */
+    bool hasPending(uint32_t priorityMask) const;
+
+private:
+    Job jobs[JOB_PRIORITY_COUNT][JOB_QUEUE_CAPACITY]; ///< Ring buffer per priority.
+    uint32_t head[JOB_PRIORITY_COUNT];                ///< Index of the next job to pop.
+    uint32_t tail[JOB_PRIORITY_COUNT];                ///< Index of the next free slot.
+};
+
+#endif // RETROLENS_JOB_QUEUE_H
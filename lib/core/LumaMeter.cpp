@@ -0,0 +1,132 @@
+#include <string.h>
+
+#include "LumaMeter.h"
+
+void LumaMeter::measureGray8(const uint8_t* pixels, size_t count, MeterStats* stats) {
+    memset(stats, 0, sizeof(*stats));
+
+    // Four sub-histograms, one per byte lane
+    static uint32_t lanes[4][LUMA_LEVELS];
+    memset(lanes, 0, sizeof(lanes));
+
+    size_t i = 0;
+    // Head until the pointer is word aligned
+    while (i < count && ((uintptr_t) (pixels + i) & 3) != 0) {
+        lanes[0][pixels[i++]]++;
+    }
+    // Four pixels per word read
+    const uint32_t* words = reinterpret_cast<const uint32_t*>(pixels + i);
+    size_t wordCount = (count - i) / 4;
+    for (size_t w = 0; w < wordCount; w++) {
+        uint32_t word = words[w];
+        lanes[0][word & 0xFF]++;
+        lanes[1][(word >> 8) & 0xFF]++;
+        lanes[2][(word >> 16) & 0xFF]++;
+        lanes[3][word >> 24]++;
+    }
+    i += wordCount * 4;
+    // Tail
+    while (i < count) {
+        lanes[1][pixels[i++]]++;
+    }
+
+    for (int level = 0; level < LUMA_LEVELS; level++) {
+        stats->histogram[level] = lanes[0][level] + lanes[1][level] + lanes[2][level] + lanes[3][level];
+    }
+    stats->count = (uint32_t) count;
+    summarize(stats);
+}
+
+// Luma of an RGB565 pixel, high byte first, with its channels expanded to 8 bit
+static inline uint32_t lumaRgb565(const uint8_t* pixel, uint32_t* red, uint32_t* green, uint32_t* blue) {
+    uint32_t value = ((uint32_t) pixel[0] << 8) | pixel[1];
+    // Expand to 8 bit per channel, replicating the high bits
+    uint32_t r = (value >> 8) & 0xF8;
+    uint32_t g = (value >> 3) & 0xFC;
+    uint32_t b = (value << 3) & 0xF8;
+    *red = r | (r >> 5);
+    *green = g | (g >> 6);
+    *blue = b | (b >> 5);
+    return (77 * *red + 150 * *green + 29 * *blue) >> 8;
+}
+
+void LumaMeter::measureRgb565(const uint8_t* pixels, size_t count, MeterStats* stats) {
+    memset(stats, 0, sizeof(*stats));
+
+    static uint32_t lanes[2][LUMA_LEVELS];
+    memset(lanes, 0, sizeof(lanes));
+
+    uint32_t sumRed = 0;
+    uint32_t sumGreen = 0;
+    uint32_t sumBlue = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t red, green, blue;
+        uint32_t luma = lumaRgb565(pixels + 2 * i, &red, &green, &blue);
+        sumRed += red;
+        sumGreen += green;
+        sumBlue += blue;
+        lanes[i & 1][luma]++;
+    }
+
+    for (int level = 0; level < LUMA_LEVELS; level++) {
+        stats->histogram[level] = lanes[0][level] + lanes[1][level];
+    }
+    stats->count = (uint32_t) count;
+    stats->sumRed = sumRed;
+    stats->sumGreen = sumGreen;
+    stats->sumBlue = sumBlue;
+    summarize(stats);
+}
+
+uint32_t LumaMeter::measureDetail(const uint8_t* pixels, int width, int height) {
+    if (width < 2 || height < 1) {
+        return 0;
+    }
+    uint64_t total = 0;
+    uint32_t red, green, blue;
+    for (int y = 0; y < height; y++) {
+        const uint8_t* row = pixels + (size_t) y * width * 2;
+        uint32_t previous = lumaRgb565(row, &red, &green, &blue);
+        for (int x = 1; x < width; x++) {
+            uint32_t luma = lumaRgb565(row + 2 * x, &red, &green, &blue);
+            total += luma > previous ? luma - previous : previous - luma;
+            previous = luma;
+        }
+    }
+    return (uint32_t) (total * 16 / ((uint64_t) (width - 1) * height));
+}
+
+uint8_t LumaMeter::percentile(const MeterStats& stats, uint32_t permille) {
+    if (stats.count == 0) {
+        return 0;
+    }
+    // Smallest level with more than the fraction of pixels at or below it
+    uint64_t threshold = (uint64_t) stats.count * permille / 1000;
+    uint64_t cumulative = 0;
+    for (int level = 0; level < LUMA_LEVELS; level++) {
+        cumulative += stats.histogram[level];
+        if (cumulative > threshold) {
+            return (uint8_t) level;
+        }
+    }
+    return LUMA_LEVELS - 1;
+}
+
+void LumaMeter::summarize(MeterStats* stats) {
+    if (stats->count == 0) {
+        return;
+    }
+    uint64_t sum = 0;
+    for (int level = 0; level < LUMA_LEVELS; level++) {
+        sum += (uint64_t) level * stats->histogram[level];
+        if (level <= LUMA_CLIP_LOW) {
+            stats->clippedLow += stats->histogram[level];
+        }
+        if (level >= LUMA_CLIP_HIGH) {
+            stats->clippedHigh += stats->histogram[level];
+        }
+    }
+    stats->mean = (uint8_t) ((sum + stats->count / 2) / stats->count);
+    stats->median = percentile(*stats, 500);
+    stats->percentile98 = percentile(*stats, 980);
+}
@@ -0,0 +1,100 @@
+#ifndef RETROLENS_LUMA_METER_H
+#define RETROLENS_LUMA_METER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define LUMA_LEVELS 256
+
+// Levels counted as clipped
+#define LUMA_CLIP_LOW 4
+#define LUMA_CLIP_HIGH 251
+
+/**
+ * @struct MeterStats
+ * @brief Luminance histogram and colour means of a metering frame.
+ */
+struct MeterStats {
+    uint32_t histogram[LUMA_LEVELS]; ///< Pixel count per luma level.
+    uint32_t count;                  ///< Number of pixels.
+    uint32_t clippedLow;             ///< Pixels at or below LUMA_CLIP_LOW.
+    uint32_t clippedHigh;            ///< Pixels at or above LUMA_CLIP_HIGH.
+    uint8_t mean;                    ///< Mean luma.
+    uint8_t median;                  ///< Median luma.
+    uint8_t percentile98;            ///< Luma below which 98% of the pixels are.
+    uint32_t sumRed;                 ///< Sum of the red channel, 8 bit per pixel, 0 for grayscale frames.
+    uint32_t sumGreen;               ///< Sum of the green channel.
+    uint32_t sumBlue;                ///< Sum of the blue channel.
+};
+
+/**
+ * @class LumaMeter
+ * @brief Integer kernels that turn a small frame into a luminance histogram and clipping statistics.
+ *
+ * The histogram kernels read four pixels per word and spread them over four sub-histograms, so
+ * runs of equal pixels, common in flat areas, do not serialize on the same counter. The colour
+ * kernel also sums the channels for the white balance. The sub-histograms are static, so the
+ * kernels must not run on two tasks at once.
+ *
+ * Example usage:
+ * @code
+ * MeterStats stats;
+ * LumaMeter::measureGray8(pixels, width * height, &stats);
+ * if (stats.clippedHigh > stats.count / 100) {
+ *     // Highlights are blown
+ * }
+ * @endcode
+ */
+class LumaMeter {
+public:
+    /**
+     * @brief Measure an 8 bit grayscale frame.
+     *
+     * @param pixels Luma of each pixel.
+     * @param count Number of pixels.
+     * @param stats Output statistics.
+     */
+    static void measureGray8(const uint8_t* pixels, size_t count, MeterStats* stats);
+
+    /**
+     * @brief Measure an RGB565 frame, with the high byte of each pixel first as the camera converters write it.
+     *
+     * Luma is the integer BT.601 weighting (77 R + 150 G + 29 B) >> 8.
+     *
+     * @param pixels Two bytes per pixel.
+     * @param count Number of pixels.
+     * @param stats Output statistics.
+     */
+    static void measureRgb565(const uint8_t* pixels, size_t count, MeterStats* stats);
+
+    /**
+     * @brief Measure the detail of an RGB565 frame as the mean luma step between horizontal neighbours.
+     *
+     * JPEG sizes grow with the image gradients, so this predicts how the size changes between scenes.
+     *
+     * @param pixels Two bytes per pixel, high byte first.
+     * @param width Frame width.
+     * @param height Frame height.
+     * @return uint32_t Mean absolute luma step, in 1/16 levels.
+     */
+    static uint32_t measureDetail(const uint8_t* pixels, int width, int height);
+
+    /**
+     * @brief Get the luma below which a fraction of the pixels are.
+     *
+     * @param stats Statistics with a filled histogram.
+     * @param permille Fraction in thousandths.
+     * @return uint8_t Luma level.
+     */
+    static uint8_t percentile(const MeterStats& stats, uint32_t permille);
+
+private:
+    /**
+     * @brief Fill the summary fields from the histogram.
+     *
+     * @param stats Statistics with a filled histogram and count.
+     */
+    static void summarize(MeterStats* stats);
+};
+
+#endif // RETROLENS_LUMA_METER_H
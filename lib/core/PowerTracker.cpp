@@ -0,0 +1,120 @@
+#include "PowerTracker.h"
+
+static const float STATE_CURRENT_MA[POWER_STATE_COUNT] = {
+    POWER_ACTIVE_CURRENT_MA,
+    POWER_IDLE_CURRENT_MA,
+    POWER_SENSOR_OFF_CURRENT_MA,
+};
+
+PowerTracker::PowerTracker(const PowerConfig& config)
+    : config(config), state(POWER_STATE_IDLE), stateStartMs(0), startMs(0), lastActivityMs(0),
+      sensorIdleTimeoutMs(config.sensorIdleTimeoutMs), rearmLatencyMs(0.0f) {
+    start(0);
+}
+
+void PowerTracker::start(uint32_t nowMs) {
+    state = POWER_STATE_IDLE;
+    stateStartMs = nowMs;
+    startMs = nowMs;
+    lastActivityMs = nowMs;
+    for (int i = 0; i < POWER_STATE_COUNT; i++) {
+        timeInState[i] = 0;
+    }
+}
+
+void PowerTracker::setState(int state, uint32_t nowMs) {
+    if (state < 0 || state >= POWER_STATE_COUNT || state == this->state) {
+        return;
+    }
+    timeInState[this->state] += nowMs - stateStartMs;
+    this->state = state;
+    stateStartMs = nowMs;
+}
+
+int PowerTracker::getState() const {
+    return state;
+}
+
+uint32_t PowerTracker::getTimeInState(int state, uint32_t nowMs) const {
+    if (state < 0 || state >= POWER_STATE_COUNT) {
+        return 0;
+    }
+    uint32_t time = timeInState[state];
+    if (state == this->state) {
+        time += nowMs - stateStartMs;
+    }
+    return time;
+}
+
+float PowerTracker::getChargeUsedMah(uint32_t nowMs) const {
+    float chargeMah = 0.0f;
+    for (int i = 0; i < POWER_STATE_COUNT; i++) {
+        chargeMah += STATE_CURRENT_MA[i] * (float) getTimeInState(i, nowMs) / 3600000.0f;
+    }
+    return chargeMah;
+}
+
+float PowerTracker::getAverageCurrentMa(uint32_t nowMs) const {
+    uint32_t elapsedMs = nowMs - startMs;
+    if (elapsedMs == 0) {
+        return STATE_CURRENT_MA[state];
+    }
+    return getChargeUsedMah(nowMs) * 3600000.0f / (float) elapsedMs;
+}
+
+void PowerTracker::noteActivity(uint32_t nowMs) {
+    lastActivityMs = nowMs;
+}
+
+bool PowerTracker::isSensorIdle(uint32_t nowMs) const {
+    return nowMs - lastActivityMs >= sensorIdleTimeoutMs;
+}
+
+void PowerTracker::recordRearm(uint32_t latencyMs, uint32_t shotWaitMs) {
+    if (rearmLatencyMs == 0.0f) {
+        rearmLatencyMs = (float) latencyMs;
+    } else {
+        rearmLatencyMs += REARM_LATENCY_ALPHA * ((float) latencyMs - rearmLatencyMs);
+    }
+
+    if (shotWaitMs > 0) {
+        // The user felt the re-arm, keep the sensor on longer
+        sensorIdleTimeoutMs *= 2;
+    } else {
+        // Hidden behind the press, try powering down a bit sooner
+        sensorIdleTimeoutMs -= sensorIdleTimeoutMs / 8;
+    }
+
+    uint32_t minTimeoutMs = config.minSensorIdleTimeoutMs;
+    uint32_t breakEvenMs = breakEvenTimeoutMs();
+    if (breakEvenMs > minTimeoutMs) {
+        minTimeoutMs = breakEvenMs;
+    }
+    if (sensorIdleTimeoutMs < minTimeoutMs) {
+        sensorIdleTimeoutMs = minTimeoutMs;
+    }
+    if (sensorIdleTimeoutMs > config.maxSensorIdleTimeoutMs) {
+        sensorIdleTimeoutMs = config.maxSensorIdleTimeoutMs;
+    }
+}
+
+uint32_t PowerTracker::breakEvenTimeoutMs() const {
+    // Charge of a re-arm at full clock over the current saved per millisecond off
+    float savedMa = POWER_IDLE_CURRENT_MA - POWER_SENSOR_OFF_CURRENT_MA;
+    return (uint32_t) (rearmLatencyMs * POWER_ACTIVE_CURRENT_MA / savedMa);
+}
+
+uint32_t PowerTracker::getSensorIdleTimeoutMs() const {
+    return sensorIdleTimeoutMs;
+}
+
+uint32_t PowerTracker::getRearmLatencyMs() const {
+    return (uint32_t) (rearmLatencyMs + 0.5f);
+}
+
+float PowerTracker::getStateCurrentMa(int state) {
+    if (state < 0 || state >= POWER_STATE_COUNT) {
+        return 0.0f;
+    }
+    return STATE_CURRENT_MA[state];
+}
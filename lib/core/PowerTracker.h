@@ -0,0 +1,172 @@
+#ifndef RETROLENS_POWER_TRACKER_H
+#define RETROLENS_POWER_TRACKER_H
+
+#include <stdint.h>
+
+// Power states
+#define POWER_STATE_ACTIVE 0      // Capture or save running, full clock
+#define POWER_STATE_IDLE 1        // Waiting for the user, low clock, sensor powered
+#define POWER_STATE_SENSOR_OFF 2  // Waiting for the user, light sleep, sensor powered down
+#define POWER_STATE_COUNT 3
+
+// Estimated board current of each state, in mA
+#define POWER_ACTIVE_CURRENT_MA 240.0f
+#define POWER_IDLE_CURRENT_MA 75.0f
+#define POWER_SENSOR_OFF_CURRENT_MA 20.0f
+
+// Default sensor idle timeouts
+#define SENSOR_IDLE_TIMEOUT_MS 20000
+#define SENSOR_IDLE_TIMEOUT_MIN_MS 5000
+#define SENSOR_IDLE_TIMEOUT_MAX_MS 120000
+
+// Weight of a new re-arm latency in its average
+#define REARM_LATENCY_ALPHA 0.25f
+
+/**
+ * @struct PowerConfig
+ * @brief Sensor power-down policy.
+ */
+struct PowerConfig {
+    uint32_t sensorIdleTimeoutMs = SENSOR_IDLE_TIMEOUT_MS;       ///< Initial idle time before the sensor is powered down.
+    uint32_t minSensorIdleTimeoutMs = SENSOR_IDLE_TIMEOUT_MIN_MS; ///< Lower bound of the adaptive timeout.
+    uint32_t maxSensorIdleTimeoutMs = SENSOR_IDLE_TIMEOUT_MAX_MS; ///< Upper bound of the adaptive timeout.
+};
+
+/**
+ * @class PowerTracker
+ * @brief Accounts the time spent in each power state and decides when the sensor may be powered down.
+ *
+ * Time and estimated charge are accumulated per state. The sensor idle timeout adapts to the
+ * cost of waking the sensor: it doubles each time a shot had to wait for the sensor, shrinks
+ * slowly while re-arms stay hidden behind the press, and never drops below the break-even
+ * time, where the charge saved while off pays for the re-arm at full clock.
+ *
+ * Example usage:
+ * @code
+ * PowerTracker tracker;
+ * tracker.start(millis());
+ * tracker.noteActivity(millis());
+ * if (tracker.isSensorIdle(millis())) {
+ *     // Power the sensor down
+ *     tracker.setState(POWER_STATE_SENSOR_OFF, millis());
+ * }
+ * @endcode
+ */
+class PowerTracker {
+public:
+    /**
+     * @brief Construct a tracker in the idle state at time 0.
+     *
+     * @param config Sensor power-down policy.
+     */
+    PowerTracker(const PowerConfig& config = PowerConfig());
+
+    /**
+     * @brief Restart the accounting in the idle state.
+     *
+     * @param nowMs Current time.
+     */
+    void start(uint32_t nowMs);
+
+    /**
+     * @brief Switch to a power state.
+     *
+     * @param state One of the POWER_STATE_* values.
+     * @param nowMs Current time.
+     */
+    void setState(int state, uint32_t nowMs);
+
+    /**
+     * @brief Get the current power state.
+     *
+     * @return int One of the POWER_STATE_* values.
+     */
+    int getState() const;
+
+    /**
+     * @brief Get the total time spent in a state, including the current stay.
+     *
+     * @param state One of the POWER_STATE_* values.
+     * @param nowMs Current time.
+     * @return uint32_t Time in milliseconds.
+     */
+    uint32_t getTimeInState(int state, uint32_t nowMs) const;
+
+    /**
+     * @brief Get the estimated charge drawn since the tracker started.
+     *
+     * @param nowMs Current time.
+     * @return float Charge in mAh.
+     */
+    float getChargeUsedMah(uint32_t nowMs) const;
+
+    /**
+     * @brief Get the estimated average current since the tracker started.
+     *
+     * @param nowMs Current time.
+     * @return float Current in mA.
+     */
+    float getAverageCurrentMa(uint32_t nowMs) const;
+
+    /**
+     * @brief Record user activity, restarting the sensor idle timeout.
+     *
+     * @param nowMs Current time.
+     */
+    void noteActivity(uint32_t nowMs);
+
+    /**
+     * @brief Check if the sensor has been idle for the current timeout.
+     *
+     * @param nowMs Current time.
+     * @return true if the sensor may be powered down.
+     */
+    bool isSensorIdle(uint32_t nowMs) const;
+
+    /**
+     * @brief Record a sensor re-arm and adapt the idle timeout.
+     *
+     * @param latencyMs Time from the power-up request until the sensor was ready.
+     * @param shotWaitMs Time a shot spent waiting for the sensor, 0 if the re-arm was hidden.
+     */
+    void recordRearm(uint32_t latencyMs, uint32_t shotWaitMs);
+
+    /**
+     * @brief Get the current sensor idle timeout.
+     *
+     * @return uint32_t Timeout in milliseconds.
+     */
+    uint32_t getSensorIdleTimeoutMs() const;
+
+    /**
+     * @brief Get the averaged re-arm latency.
+     *
+     * @return uint32_t Latency in milliseconds, 0 before the first re-arm.
+     */
+    uint32_t getRearmLatencyMs() const;
+
+    /**
+     * @brief Get the estimated current of a state.
+     *
+     * @param state One of the POWER_STATE_* values.
+     * @return float Current in mA.
+     */
+    static float getStateCurrentMa(int state);
+
+private:
+    /**
+     * @brief Lowest timeout for which powering the sensor down saves charge.
+     */
+    uint32_t breakEvenTimeoutMs() const;
+
+    PowerConfig config;                         ///< Sensor power-down policy.
+    int state;                                  ///< Current power state.
+    uint32_t stateStartMs;                      ///< Time the current state was entered.
+    uint32_t startMs;                           ///< Time the tracker started.
+    uint32_t timeInState[POWER_STATE_COUNT];    ///< Time of the completed stays, per state.
+    uint32_t lastActivityMs;                    ///< Time of the last user activity.
+    uint32_t sensorIdleTimeoutMs;               ///< Current adaptive timeout.
+    float rearmLatencyMs;                       ///< Averaged re-arm latency.
+};
+
+#endif // RETROLENS_POWER_TRACKER_H
@@ -0,0 +1,120 @@
+#include "RateController.h"
+
+RateController::RateController(const RateConfig& config)
+    : config(config), finestQuality(config.minQuality), complexity(0), detail(0), writeBytesPerSecond(0), quality(config.minQuality), targetBytes(0),
+      frameCount(0), overBudgetCount(0), lastSizePercent(0), sizePercentTotal(0) {
+    targetBytes = getTargetBytes();
+}
+
+uint8_t RateController::onFrame(uint32_t bytes, uint8_t quality) {
+    // Score against the target the frame was aimed at
+    uint32_t target = targetBytes > 0 ? targetBytes : 1;
+    lastSizePercent = (uint32_t) ((uint64_t) bytes * 100 / target);
+    sizePercentTotal += lastSizePercent;
+    frameCount++;
+    bool overBytes = bytes > config.byteBudget;
+    bool overTime = writeBytesPerSecond > 0 && (uint64_t) bytes * 1000 > (uint64_t) writeBytesPerSecond * config.writeBudgetMs;
+    if (overBytes || overTime) {
+        overBudgetCount++;
+    }
+
+    uint64_t measured = (uint64_t) bytes * (quality + RATE_QUALITY_OFFSET);
+    if (complexity == 0) {
+        complexity = measured;
+    } else {
+        complexity = (complexity * (256 - RATE_COMPLEXITY_WEIGHT) + measured * RATE_COMPLEXITY_WEIGHT) >> 8;
+    }
+
+    targetBytes = getTargetBytes();
+    this->quality = pickQuality();
+    return this->quality;
+}
+
+void RateController::noteWrite(uint32_t bytes, uint32_t durationMs) {
+    if (durationMs == 0) {
+        durationMs = 1;
+    }
+    uint32_t measured = (uint32_t) ((uint64_t) bytes * 1000 / durationMs);
+    if (writeBytesPerSecond == 0) {
+        writeBytesPerSecond = measured;
+    } else {
+        writeBytesPerSecond = (uint32_t) (((uint64_t) writeBytesPerSecond * (256 - RATE_THROUGHPUT_WEIGHT) +
+                                           (uint64_t) measured * RATE_THROUGHPUT_WEIGHT) >> 8);
+    }
+    targetBytes = getTargetBytes();
+    quality = pickQuality();
+}
+
+uint8_t RateController::noteDetail(uint32_t detail) {
+    if (detail > 0 && this->detail > 0 && complexity > 0) {
+        complexity = complexity * detail / this->detail;
+    }
+    if (detail > 0) {
+        this->detail = detail;
+    }
+    quality = pickQuality();
+    return quality;
+}
+
+uint8_t RateController::setFinestQuality(uint8_t quality) {
+    if (quality < config.minQuality) {
+        quality = config.minQuality;
+    }
+    finestQuality = quality > config.maxQuality ? config.maxQuality : quality;
+    this->quality = pickQuality();
+    return this->quality;
+}
+
+uint8_t RateController::getQuality() const {
+    return quality;
+}
+
+uint32_t RateController::getTargetBytes() const {
+    uint64_t limit = config.byteBudget;
+    if (writeBytesPerSecond > 0) {
+        uint64_t writable = (uint64_t) writeBytesPerSecond * config.writeBudgetMs / 1000;
+        if (writable < limit) {
+            limit = writable;
+        }
+    }
+    return (uint32_t) (limit * config.headroomPercent / 100);
+}
+
+uint32_t RateController::predictBytes(uint8_t quality) const {
+    return (uint32_t) (complexity / (quality + RATE_QUALITY_OFFSET));
+}
+
+uint32_t RateController::getWriteBytesPerSecond() const {
+    return writeBytesPerSecond;
+}
+
+uint32_t RateController::getFrameCount() const {
+    return frameCount;
+}
+
+uint32_t RateController::getOverBudgetCount() const {
+    return overBudgetCount;
+}
+
+uint32_t RateController::getLastSizePercent() const {
+    return lastSizePercent;
+}
+
+uint32_t RateController::getMeanSizePercent() const {
+    return frameCount > 0 ? (uint32_t) (sizePercentTotal / frameCount) : 0;
+}
+
+uint8_t RateController::pickQuality() const {
+    if (complexity == 0 || targetBytes == 0) {
+        return finestQuality;
+    }
+    // Finest quality with complexity / (quality + offset) <= target
+    uint64_t divisor = (complexity + targetBytes - 1) / targetBytes;
+    if (divisor <= (uint64_t) finestQuality + RATE_QUALITY_OFFSET) {
+        return finestQuality;
+    }
+    if (divisor >= (uint64_t) config.maxQuality + RATE_QUALITY_OFFSET) {
+        return config.maxQuality;
+    }
+    return (uint8_t) (divisor - RATE_QUALITY_OFFSET);
+}
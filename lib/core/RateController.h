@@ -0,0 +1,171 @@
+#ifndef RETROLENS_RATE_CONTROLLER_H
+#define RETROLENS_RATE_CONTROLLER_H
+
+#include <stdint.h>
+
+// Sensor JPEG quality range, lower is finer. The finest bound keeps frames inside the driver buffers
+#define RATE_DEFAULT_MIN_QUALITY 12
+#define RATE_DEFAULT_MAX_QUALITY 40
+
+// Default budgets of a frame
+#define RATE_DEFAULT_BYTE_BUDGET 450000
+#define RATE_DEFAULT_WRITE_BUDGET_MS 1500
+
+// Share of the budget aimed at, the rest absorbs prediction errors
+#define RATE_DEFAULT_HEADROOM_PERCENT 85
+
+// Size model: bytes = complexity / (quality + RATE_QUALITY_OFFSET)
+#define RATE_QUALITY_OFFSET 4
+
+// Weight of a new measurement in the write throughput and complexity averages, in 1/256
+#define RATE_THROUGHPUT_WEIGHT 64
+#define RATE_COMPLEXITY_WEIGHT 192
+
+/**
+ * @struct RateConfig
+ * @brief Budgets and quality range of the rate control.
+ */
+struct RateConfig {
+    uint32_t byteBudget = RATE_DEFAULT_BYTE_BUDGET;          ///< Largest frame, in bytes.
+    uint32_t writeBudgetMs = RATE_DEFAULT_WRITE_BUDGET_MS;   ///< Longest SD write of a frame.
+    uint8_t minQuality = RATE_DEFAULT_MIN_QUALITY;           ///< Finest quality allowed.
+    uint8_t maxQuality = RATE_DEFAULT_MAX_QUALITY;           ///< Coarsest quality allowed.
+    uint8_t headroomPercent = RATE_DEFAULT_HEADROOM_PERCENT; ///< Share of the budget aimed at.
+};
+
+/**
+ * @class RateController
+ * @brief Predicts the JPEG quality that keeps each frame under a byte budget and an SD write-time budget.
+ *
+ * Frame size is modelled as a scene complexity divided by (quality + RATE_QUALITY_OFFSET), the
+ * shape of the sensor quantizer scale. Each frame updates the complexity from its size and the
+ * quality it was encoded with. A scene detail statistic, when given, rescales the complexity
+ * before the frame of a new scene is taken. The target is the smaller of the byte budget and
+ * what the measured write throughput moves within the write budget, times the headroom, and the
+ * next quality is the finest whose predicted size fits it.
+ *
+ * Example usage:
+ * @code
+ * RateController rate;
+ * // After each frame
+ * uint8_t quality = rate.onFrame(fb->len, qualityOfFb);
+ * sensor->set_quality(sensor, quality);
+ * // After each SD write
+ * rate.noteWrite(fb->len, writeMs);
+ * @endcode
+ */
+class RateController {
+public:
+    /**
+     * @brief Constructor for RateController.
+     *
+     * @param config Budgets and quality range.
+     */
+    RateController(const RateConfig& config = RateConfig());
+
+    /**
+     * @brief Learn from a frame and pick the quality of the next.
+     *
+     * @param bytes Size of the frame.
+     * @param quality Quality the frame was encoded with.
+     * @return uint8_t Quality for the next frame.
+     */
+    uint8_t onFrame(uint32_t bytes, uint8_t quality);
+
+    /**
+     * @brief Record an SD write, updating the write throughput.
+     *
+     * @param bytes Bytes written.
+     * @param durationMs Time the write took.
+     */
+    void noteWrite(uint32_t bytes, uint32_t durationMs);
+
+    /**
+     * @brief Record the detail of the scene about to be shot, rescaling the complexity.
+     *
+     * @param detail Scene detail, in any unit proportional to the image gradients, 0 if unknown.
+     * @return uint8_t Quality for the next frame.
+     */
+    uint8_t noteDetail(uint32_t detail);
+
+    /**
+     * @brief Narrow the finest quality picked, for a film shot coarser than the camera allows.
+     *
+     * @param quality Finest JPEG quality, kept within the configured range.
+     * @return uint8_t Quality for the next frame.
+     */
+    uint8_t setFinestQuality(uint8_t quality);
+
+    /**
+     * @brief Get the quality the next frame should use.
+     *
+     * @return uint8_t JPEG quality.
+     */
+    uint8_t getQuality() const;
+
+    /**
+     * @brief Get the size aimed at for the next frame.
+     *
+     * @return uint32_t Bytes.
+     */
+    uint32_t getTargetBytes() const;
+
+    /**
+     * @brief Predict the size of the next frame at a quality.
+     *
+     * @param quality JPEG quality.
+     * @return uint32_t Bytes, 0 before the first frame.
+     */
+    uint32_t predictBytes(uint8_t quality) const;
+
+    /**
+     * @brief Get the write throughput.
+     *
+     * @return uint32_t Bytes per second, 0 before the first write.
+     */
+    uint32_t getWriteBytesPerSecond() const;
+
+    /**
+     * @brief Get the number of frames seen.
+     */
+    uint32_t getFrameCount() const;
+
+    /**
+     * @brief Get the number of frames over the byte or write-time budget.
+     */
+    uint32_t getOverBudgetCount() const;
+
+    /**
+     * @brief Get the size of the last frame as a share of its target.
+     *
+     * @return uint32_t Percent, 0 before the first frame.
+     */
+    uint32_t getLastSizePercent() const;
+
+    /**
+     * @brief Get the mean size of the frames as a share of their targets.
+     *
+     * @return uint32_t Percent, 0 before the first frame.
+     */
+    uint32_t getMeanSizePercent() const;
+
+private:
+    /**
+     * @brief Pick the finest quality that fits the target.
+     */
+    uint8_t pickQuality() const;
+
+    RateConfig config;            ///< Budgets and quality range.
+    uint8_t finestQuality;        ///< Finest quality picked, within the configured range.
+    uint64_t complexity;          ///< Size model constant, bytes times (quality + offset), 0 if unknown.
+    uint32_t detail;              ///< Scene detail of the complexity, 0 if unknown.
+    uint32_t writeBytesPerSecond; ///< Averaged SD write throughput, 0 if unknown.
+    uint8_t quality;              ///< Quality for the next frame.
+    uint32_t targetBytes;         ///< Target of the next frame.
+    uint32_t frameCount;          ///< Frames seen.
+    uint32_t overBudgetCount;     ///< Frames over a budget.
+    uint32_t lastSizePercent;     ///< Size of the last frame against its target.
+    uint64_t sizePercentTotal;    ///< Sum of the size shares.
+};
+
+#endif // RETROLENS_RATE_CONTROLLER_H
@@ -0,0 +1,117 @@
+#include "ResourceArbiter.h"
+
+ResourceArbiter::ResourceArbiter() : heldResources(0), nextSequence(0) {
+    for (int i = 0; i < ARBITER_MAX_CLIENTS; i++) {
+        clients[i] = {0, 0, 0, false};
+    }
+}
+
+bool ResourceArbiter::isValid(int ticket) const {
+    return ticket >= 0 && ticket < ARBITER_MAX_CLIENTS && clients[ticket].resources != 0;
+}
+
+int ResourceArbiter::request(uint32_t resources, uint8_t priority) {
+    if (resources == 0) {
+        return ARBITER_INVALID_TICKET;
+    }
+    for (int ticket = 0; ticket < ARBITER_MAX_CLIENTS; ticket++) {
+        if (clients[ticket].resources == 0) {
+            clients[ticket] = {resources, nextSequence++, priority, false};
+            grantWaiters();
+            return ticket;
+        }
+    }
+    return ARBITER_INVALID_TICKET;
+}
+
+bool ResourceArbiter::isGranted(int ticket) const {
+    return isValid(ticket) && clients[ticket].granted;
+}
+
+uint32_t ResourceArbiter::release(int ticket) {
+    if (!isGranted(ticket)) {
+        return 0;
+    }
+    return cancel(ticket);
+}
+
+uint32_t ResourceArbiter::cancel(int ticket) {
+    if (!isValid(ticket)) {
+        return 0;
+    }
+    if (clients[ticket].granted) {
+        heldResources &= ~clients[ticket].resources;
+    }
+    clients[ticket] = {0, 0, 0, false};
+
+    // Freed resources, or a withdrawn reservation, may unblock waiters
+    return grantWaiters();
+}
+
+uint32_t ResourceArbiter::grantWaiters() {
+    uint32_t granted = 0;
+    // Resources held or reserved by a more urgent waiter
+    uint32_t blocked = heldResources;
+    uint32_t visited = 0;
+
+    while (true) {
+        // Pick the most urgent waiter not visited yet, oldest first inside a priority
+        int next = ARBITER_INVALID_TICKET;
+        for (int ticket = 0; ticket < ARBITER_MAX_CLIENTS; ticket++) {
+            const Client& client = clients[ticket];
+            if (client.resources == 0 || client.granted || (visited & (1u << ticket))) {
+                continue;
+            }
+            if (next == ARBITER_INVALID_TICKET || client.priority > clients[next].priority ||
+                (client.priority == clients[next].priority && (int32_t) (client.sequence - clients[next].sequence) < 0)) {
+                next = ticket;
+            }
+        }
+        if (next == ARBITER_INVALID_TICKET) {
+            return granted;
+        }
+        visited |= 1u << next;
+
+        Client& client = clients[next];
+        if ((client.resources & blocked) == 0) {
+            client.granted = true;
+            heldResources |= client.resources;
+            granted |= 1u << next;
+        }
+        // Granted or not, less urgent waiters must not take these resources
+        blocked |= client.resources;
+    }
+}
+
+uint8_t ResourceArbiter::effectivePriority(int ticket) const {
+    if (!isValid(ticket)) {
+        return 0;
+    }
+    uint8_t priority = clients[ticket].priority;
+    if (!clients[ticket].granted) {
+        return priority;
+    }
+    // Inherit from every waiter blocked on the resources of the holder
+    for (int i = 0; i < ARBITER_MAX_CLIENTS; i++) {
+        const Client& waiter = clients[i];
+        if (waiter.resources != 0 && !waiter.granted && (waiter.resources & clients[ticket].resources) &&
+            waiter.priority > priority) {
+            priority = waiter.priority;
+        }
+    }
+    return priority;
+}
+
+uint32_t ResourceArbiter::getHeldResources() const {
+    return heldResources;
+}
+
+uint32_t ResourceArbiter::getHolders() const {
+    uint32_t holders = 0;
+    for (int ticket = 0; ticket < ARBITER_MAX_CLIENTS; ticket++) {
+        if (clients[ticket].resources != 0 && clients[ticket].granted) {
+            holders |= 1u << ticket;
+        }
+    }
+    return holders;
+}
@@ -0,0 +1,127 @@
+#ifndef RETROLENS_RESOURCE_ARBITER_H
+#define RETROLENS_RESOURCE_ARBITER_H
+
+#include <stdint.h>
+
+// Number of clients holding or waiting for resources at the same time, at most 32
+#define ARBITER_MAX_CLIENTS 16
+#define ARBITER_INVALID_TICKET -1
+
+/**
+ * @class ResourceArbiter
+ * @brief Grants sets of shared resources to prioritized clients.
+ *
+ * Each resource is a bit of a mask. A client asks for its whole set at once and is granted
+ * all of it or nothing, so no client ever holds part of a set while waiting for the rest.
+ * This is the fixed lock order taken to its limit: there is no hold-and-wait, so no deadlock.
+ *
+ * Waiters are granted by priority (higher values first, like FreeRTOS task priorities), FIFO
+ * inside a priority. A waiter reserves its resources, so lower priority clients cannot barge
+ * in and starve it. effectivePriority() gives the priority a holder inherits from the waiters
+ * it blocks, the owner raises the holder task to it.
+ *
+ * The arbiter does no locking and never blocks, the owner serializes the calls and wakes the
+ * clients granted by release() and cancel() (see PinArbiter).
+ *
+ * Example usage:
+ * @code
+ * ResourceArbiter arbiter;
+ * int ticket = arbiter.request(PINS_SCREEN_BUS | PINS_BATTERY, 3);
+ * if (!arbiter.isGranted(ticket)) {
+ *     // Sleep until release() of another client reports the ticket as granted
+ * }
+ * uint32_t granted = arbiter.release(ticket);
+ * @endcode
+ */
+class ResourceArbiter {
+public:
+    /**
+     * @brief Construct an arbiter with every resource free.
+     */
+    ResourceArbiter();
+
+    /**
+     * @brief Ask for a set of resources. The set is granted right away if it is free and no
+     *        waiter of the same or higher priority reserved part of it.
+     *
+     * @param resources Mask of resources, must not be empty.
+     * @param priority Priority of the client, higher values are more urgent.
+     * @return int Ticket of the client, or ARBITER_INVALID_TICKET if the set is empty or every slot is used.
+     */
+    int request(uint32_t resources, uint8_t priority);
+
+    /**
+     * @brief Check if a ticket holds its resources.
+     *
+     * @param ticket Ticket returned by request().
+     * @return true if the resources are granted, false if the client is still waiting.
+     */
+    bool isGranted(int ticket) const;
+
+    /**
+     * @brief Give back the resources of a granted ticket and grant the waiters they unblock.
+     *
+     * @param ticket Granted ticket, invalid afterwards.
+     * @return uint32_t Mask of the tickets (bit per ticket) granted by the call.
+     */
+    uint32_t release(int ticket);
+
+    /**
+     * @brief Withdraw a ticket, granted or not, for example after a timeout.
+     *
+     * @param ticket Ticket returned by request(), invalid afterwards.
+     * @return uint32_t Mask of the tickets (bit per ticket) granted by the call.
+     */
+    uint32_t cancel(int ticket);
+
+    /**
+     * @brief Get the priority a ticket runs at: its own or the highest of the waiters it blocks.
+     *
+     * @param ticket Ticket returned by request().
+     * @return uint8_t Effective priority, 0 for an invalid ticket.
+     */
+    uint8_t effectivePriority(int ticket) const;
+
+    /**
+     * @brief Get the resources currently granted.
+     *
+     * @return uint32_t Mask of held resources.
+     */
+    uint32_t getHeldResources() const;
+
+    /**
+     * @brief Get the tickets currently holding resources.
+     *
+     * @return uint32_t Mask of tickets (bit per ticket).
+     */
+    uint32_t getHolders() const;
+
+private:
+    /**
+     * @brief State of a client slot.
+     */
+    struct Client {
+        uint32_t resources; ///< Requested resources, 0 if the slot is free.
+        uint32_t sequence;  ///< Arrival order, for FIFO inside a priority.
+        uint8_t priority;   ///< Priority of the client.
+        bool granted;       ///< True while the client holds its resources.
+    };
+
+    /**
+     * @brief Grant every waiter that can run, most urgent first.
+     *
+     * @return uint32_t Mask of the tickets granted.
+     */
+    uint32_t grantWaiters();
+
+    /**
+     * @brief Check if a ticket refers to a used slot.
+     */
+    bool isValid(int ticket) const;
+
+    Client clients[ARBITER_MAX_CLIENTS]; ///< Client slots, indexed by ticket.
+    uint32_t heldResources;              ///< Resources of the granted clients.
+    uint32_t nextSequence;               ///< Arrival counter.
+};
+
+#endif // RETROLENS_RESOURCE_ARBITER_H
@@ -0,0 +1,93 @@
+#include <string.h>
+
+#include "StandbyStore.h"
+
+StandbyStore::StandbyStore(StandbyState* state) : state(state) {}
+
+bool StandbyStore::isValid() const {
+    return state->magic == STANDBY_STATE_MAGIC && state->version == STANDBY_STATE_VERSION &&
+           state->checksum == computeChecksum();
+}
+
+void StandbyStore::save(const StandbySettings& settings) {
+    StandbyState saved;
+    // Zero the padding too, the checksum covers every byte
+    memset(&saved, 0, sizeof(saved));
+    if (isValid()) {
+        saved.standbyCount = state->standbyCount;
+        saved.wakeToCaptureCount = state->wakeToCaptureCount;
+        saved.wakeToCaptureTotalUs = state->wakeToCaptureTotalUs;
+        saved.wakeToCaptureMaxUs = state->wakeToCaptureMaxUs;
+    }
+    saved.magic = STANDBY_STATE_MAGIC;
+    saved.version = STANDBY_STATE_VERSION;
+    saved.settings = settings;
+    saved.standbyCount++;
+
+    memcpy(state, &saved, sizeof(saved));
+    seal();
+}
+
+bool StandbyStore::load(StandbySettings* settings) const {
+    if (!isValid()) {
+        return false;
+    }
+    *settings = state->settings;
+    return true;
+}
+
+void StandbyStore::invalidate() {
+    state->magic = 0;
+}
+
+void StandbyStore::recordWakeToCapture(uint32_t elapsedUs) {
+    if (!isValid()) {
+        return;
+    }
+    state->wakeToCaptureCount++;
+    state->wakeToCaptureTotalUs += elapsedUs;
+    if (elapsedUs > state->wakeToCaptureMaxUs) {
+        state->wakeToCaptureMaxUs = elapsedUs;
+    }
+    seal();
+}
+
+uint32_t StandbyStore::getStandbyCount() const {
+    return isValid() ? state->standbyCount : 0;
+}
+
+uint32_t StandbyStore::getWakeToCaptureCount() const {
+    return isValid() ? state->wakeToCaptureCount : 0;
+}
+
+uint32_t StandbyStore::getAverageWakeToCaptureUs() const {
+    if (!isValid() || state->wakeToCaptureCount == 0) {
+        return 0;
+    }
+    return (uint32_t) (state->wakeToCaptureTotalUs / state->wakeToCaptureCount);
+}
+
+uint32_t StandbyStore::getMaxWakeToCaptureUs() const {
+    return isValid() ? state->wakeToCaptureMaxUs : 0;
+}
+
+uint32_t StandbyStore::crc32(const void* data, size_t length, uint32_t previous) {
+    // Bitwise, the state is a few dozen bytes and a table would cost 1 KB of flash
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint32_t crc = ~previous;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+uint32_t StandbyStore::computeChecksum() const {
+    return crc32(state, offsetof(StandbyState, checksum));
+}
+
+void StandbyStore::seal() {
+    state->checksum = computeChecksum();
+}
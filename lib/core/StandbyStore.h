@@ -0,0 +1,164 @@
+#ifndef RETROLENS_STANDBY_STORE_H
+#define RETROLENS_STANDBY_STORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Identifies a standby state written by this firmware, bump the version when the layout changes
+#define STANDBY_STATE_MAGIC 0x524C5342u // "RLSB"
+#define STANDBY_STATE_VERSION 1
+
+/**
+ * @struct SensorProfile
+ * @brief Sensor configuration restored on wake, so the camera starts as it was left.
+ */
+struct SensorProfile {
+    uint8_t frameSize;    ///< framesize_t of the captures.
+    uint8_t jpegQuality;  ///< JPEG quality, lower is better.
+    uint8_t xclkMhz;      ///< Sensor clock in MHz.
+};
+
+/**
+ * @struct StandbySettings
+ * @brief User state kept across standby.
+ */
+struct StandbySettings {
+    uint16_t rollIndex;   ///< Film roll frames are saved to.
+    uint8_t flashOn;      ///< 1 if the flash fires on the shot.
+    SensorProfile sensor; ///< Sensor configuration.
+};
+
+/**
+ * @struct StandbyState
+ * @brief Layout of the standby state in RTC memory.
+ */
+struct StandbyState {
+    uint32_t magic;                   ///< STANDBY_STATE_MAGIC once saved.
+    uint16_t version;                 ///< STANDBY_STATE_VERSION of the layout.
+    StandbySettings settings;         ///< Saved user state.
+    uint32_t standbyCount;            ///< Number of times standby was entered.
+    uint32_t wakeToCaptureCount;      ///< Number of wakes followed by a capture.
+    uint64_t wakeToCaptureTotalUs;    ///< Sum of the wake-to-capture times.
+    uint32_t wakeToCaptureMaxUs;      ///< Slowest wake-to-capture time.
+    uint32_t checksum;                ///< CRC-32 of every byte before this field.
+};
+
+/**
+ * @class StandbyStore
+ * @brief Saves the user state and the wake-to-capture statistics in memory that survives standby.
+ *
+ * The store only wraps the memory, the caller places the StandbyState where it survives deep
+ * sleep, RTC_DATA_ATTR on the ESP32. A power loss or a new firmware leaves garbage or an older
+ * layout there, so the state is only trusted when its magic, version and CRC-32 match.
+ *
+ * Example usage:
+ * @code
+ * RTC_DATA_ATTR static StandbyState rtcState;
+ * StandbyStore store(&rtcState);
+ *
+ * StandbySettings settings;
+ * if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT0 && store.load(&settings)) {
+ *     // Resume with settings
+ * }
+ * @endcode
+ */
+class StandbyStore {
+public:
+    /**
+     * @brief Construct a store over a state, which keeps its content.
+     *
+     * @param state Memory of the state.
+     */
+    StandbyStore(StandbyState* state);
+
+    /**
+     * @brief Check the magic, version and checksum of the state.
+     *
+     * @return true if the state was saved by this firmware and is intact.
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Save the user state before entering standby.
+     *
+     * The statistics of a valid state are kept, an invalid state starts from zero.
+     *
+     * @param settings User state to keep.
+     */
+    void save(const StandbySettings& settings);
+
+    /**
+     * @brief Load the user state saved before standby.
+     *
+     * @param settings Output user state, untouched if the state is invalid.
+     * @return true if the state is valid.
+     */
+    bool load(StandbySettings* settings) const;
+
+    /**
+     * @brief Invalidate the state, the next load fails until the next save.
+     */
+    void invalidate();
+
+    /**
+     * @brief Add a wake-to-capture time to the statistics. Ignored if the state is invalid.
+     *
+     * @param elapsedUs Time from the wake until the frame was captured.
+     */
+    void recordWakeToCapture(uint32_t elapsedUs);
+
+    /**
+     * @brief Get the number of times standby was entered.
+     *
+     * @return uint32_t Count, 0 if the state is invalid.
+     */
+    uint32_t getStandbyCount() const;
+
+    /**
+     * @brief Get the number of recorded wake-to-capture times.
+     *
+     * @return uint32_t Count, 0 if the state is invalid.
+     */
+    uint32_t getWakeToCaptureCount() const;
+
+    /**
+     * @brief Get the average wake-to-capture time.
+     *
+     * @return uint32_t Time in microseconds, 0 if none was recorded.
+     */
+    uint32_t getAverageWakeToCaptureUs() const;
+
+    /**
+     * @brief Get the slowest wake-to-capture time.
+     *
+     * @return uint32_t Time in microseconds, 0 if none was recorded.
+     */
+    uint32_t getMaxWakeToCaptureUs() const;
+
+    /**
+     * @brief Compute the CRC-32 (IEEE 802.3) of a buffer.
+     *
+     * A large buffer can be checked in parts, passing the checksum of the bytes before each part.
+     *
+     * @param data Buffer.
+     * @param length Length in bytes.
+     * @param previous Checksum of the bytes before the buffer, 0 for none.
+     * @return uint32_t Checksum.
+     */
+    static uint32_t crc32(const void* data, size_t length, uint32_t previous = 0);
+
+private:
+    /**
+     * @brief Checksum of the state as it is in memory.
+     */
+    uint32_t computeChecksum() const;
+
+    /**
+     * @brief Store the checksum of the current content.
+     */
+    void seal();
+
+    StandbyState* state; ///< Memory of the state.
+};
+
+#endif // RETROLENS_STANDBY_STORE_H
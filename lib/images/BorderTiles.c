@@ -0,0 +1,2167 @@
+#include "BorderTiles.h"
+
+static const uint32_t FONT_BORDER_MCUS[] = {
+    0, 476, 924, 1402, 1826, 2284, 2608, 3076, 3584, 3964, 4460, 4840, 5330, 5792, 6218, 6708,
+    7198, 7686, 8068, 8452, 8864, 9344, 9598, 9982, 10442, 10778, 11268, 11604, 12094, 12602, 12986, 13178,
+    13370, 13754, 14138, 14474, 14982, 15364, 15830, 16306, 16690, 17140, 17618, 18064, 18526, 19022, 19470, 19850,
+    20318, 20700, 21190, 21652, 22078, 22568, 23058, 23550, 23932, 24316, 24798, 25278, 25718, 26102, 26562, 26898,
+    27388, 27828, 28322, 28830, 29214, 29550, 29914, 30298, 30682, 30994, 31502, 31884,
+};
+static const int16_t FONT_BORDER_COEFFICIENTS[] = {
+    63, -569, 1, -144, 2, -163, 3, -4, 4, 160, 5, -2, 6, -67, 7, -29,
+    8, -39, 9, -83, 10, 169, 11, 46, 12, -179, 13, 31, 14, 70, 15, -16,
+    16, -23, 17, -32, 18, 91, 19, -27, 20, -23, 21, -18, 22, 38, 23, -6,
+    24, -92, 25, 128, 26, -89, 27, 10, 28, 26, 29, 7, 30, -37, 31, 26,
+    32, -53, 33, 95, 34, -70, 35, -38, 36, 89, 37, -26, 38, -29, 39, 19,
+    40, -62, 41, 86, 42, -59, 43, 7, 44, 17, 45, 5, 46, -25, 47, 17,
+    48, -10, 49, -13, 50, 38, 51, -11, 52, -10, 53, -8, 54, 16, 55, -3,
+    56, -8, 57, -16, 58, 34, 59, 9, 60, -36, 61, 6, 62, 14, 63, -3,
+    63, -498, 1, 214, 2, -163, 3, -56, 4, 89, 5, -37, 6, -67, 7, 43,
+    8, -109, 9, 14, 10, 169, 11, 12, 12, -109, 13, 8, 14, 70, 15, 3,
+    16, -23, 17, 32, 18, 91, 19, 27, 20, -23, 21, 18, 22, 38, 23, 6,
+    24, -33, 25, -70, 26, -89, 27, -59, 28, -33, 29, -40, 30, -37, 31, -14,
+    32, -125, 33, -164, 34, -70, 35, 98, 36, 160, 37, 65, 38, -29, 39, -33,
+    40, -22, 41, -47, 42, -59, 43, -40, 44, -22, 45, -27, 46, -25, 47, -9,
+    48, -10, 49, 13, 50, 38, 51, 11, 52, -10, 53, 8, 54, 16, 55, 3,
+    56, -22, 57, 3, 58, 34, 59, 2, 60, -22, 61, 2, 62, 14, 63, 1,
+    54, -172, 1, 9, 2, 79, 3, -18, 4, 59, 5, 12, 6, -6, 7, -2,
+    8, 35, 9, -9, 10, 21, 11, 18, 12, -61, 13, -12, 14, -4, 15, 2,
+    16, 11, 18, 14, 20, -33, 22, 6, 24, 29, 25, 7, 26, -44, 27, -15,
+    28, 32, 29, 10, 30, -8, 31, -1, 32, 42, 33, -9, 34, -57, 35, 18,
+    36, 25, 37, -12, 38, 15, 39, 2, 40, 20, 41, 5, 42, -29, 43, -10,
+    44, 21, 45, 7, 46, -5, 47, -1, 48, 5, 50, 6, 52, -14, 54, 2,
+    56, 7, 57, -2, 58, 4, 59, 4, 60, -12, 61, -2, 62, -1, 54, 162,
+    1, -8, 2, -72, 3, 17, 4, -53, 5, -11, 6, 5, 7, 2, 8, -32,
+    9, 8, 10, -20, 11, -16, 12, 55, 13, 11, 14, 3, 15, -2, 16, -10,
+    18, -13, 20, 30, 22, -5, 24, -27, 25, -7, 26, 40, 27, 14, 28, -29,
+    29, -9, 30, 7, 31, 1, 32, -38, 33, 8, 34, 52, 35, -17, 36, -23,
+    37, 11, 38, -13, 39, -2, 40, -18, 41, -4, 42, 27, 43, 9, 44, -19,
+    45, -6, 46, 5, 47, 1, 48, -4, 50, -5, 52, 12, 54, -2, 56, -6,
+    57, 2, 58, -4, 59, -3, 60, 11, 61, 2, 62, 1, 63, -676, 1, -243,
+    2, 163, 3, -87, 4, 53, 5, -58, 6, 67, 7, -48, 8, -25, 9, 34,
+    10, -32, 11, 29, 12, -25, 13, 19, 14, -13, 15, 7, 16, -116, 17, 124,
+    18, -30, 19, -50, 20, 70, 21, -33, 22, -13, 23, 25, 24, -21, 25, 29,
+    26, -27, 27, 25, 28, -21, 29, 16, 30, -11, 31, 6, 32, 53, 33, -45,
+    34, -23, 35, 80, 36, -89, 37, 54, 38, -10, 39, -9, 40, -14, 41, 19,
+    42, -18, 43, 16, 44, -14, 45, 11, 46, -8, 47, 4, 48, -48, 49, 51,
+    50, -13, 51, -21, 52, 29, 53, -14, 54, -5, 55, 10, 56, -5, 57, 7,
+    58, -6, 59, 6, 60, -5, 61, 4, 62, -3, 63, 1, 63, -748, 1, 173,
+    2, 163, 3, 147, 4, 125, 5, 98, 6, 67, 7, 34, 8, -25, 9, -34,
+    10, -32, 11, -29, 12, -25, 13, -19, 14, -13, 15, -7, 16, -23, 17, -32,
+    18, -30, 19, -27, 20, -23, 21, -18, 22, -13, 23, -6, 24, -21, 25, -29,
+    26, -27, 27, -25, 28, -21, 29, -16, 30, -11, 31, -6, 32, -18, 33, -25,
+    34, -23, 35, -21, 36, -18, 37, -14, 38, -10, 39, -5, 40, -14, 41, -19,
+    42, -18, 43, -16, 44, -14, 45, -11, 46, -8, 47, -4, 48, -10, 49, -13,
+    50, -13, 51, -11, 52, -10, 53, -8, 54, -5, 55, -3, 56, -5, 57, -7,
+    58, -6, 59, -6, 60, -5, 61, -4, 62, -3, 63, -1, 47, -89, 1, -9,
+    2, 92, 3, 18, 4, -59, 5, -12, 6, 25, 7, 2, 8, 12, 10, -15,
+    12, 12, 14, -6, 16, 33, 17, 12, 18, -34, 19, -24, 20, 11, 21, 16,
+    22, 2, 23, -2, 24, 10, 26, -13, 28, 10, 30, -5, 32, -8, 33, -9,
+    34, 5, 35, 18, 36, 8, 37, -12, 38, -11, 39, 2, 40, 7, 42, -9,
+    44, 7, 46, -4, 48, 14, 49, 5, 50, -14, 51, -10, 52, 5, 53, 7,
+    54, 1, 55, -1, 56, 2, 58, -3, 60, 2, 62, -1, 47, 86, 1, 8,
+    2, -84, 3, -17, 4, 53, 5, 11, 6, -23, 7, -2, 8, -11, 10, 14,
+    12, -11, 14, 6, 16, -30, 17, -11, 18, 31, 19, 22, 20, -10, 21, -14,
+    22, -2, 23, 2, 24, -9, 26, 12, 28, -9, 30, 5, 32, 8, 33, 8,
+    34, -4, 35, -17, 36, -8, 37, 11, 38, 10, 39, -2, 40, -6, 42, 8,
+    44, -6, 46, 3, 48, -12, 49, -4, 50, 13, 51, 9, 52, -4, 53, -6,
+    54, -1, 55, 1, 56, -2, 58, 3, 60, -2, 62, 1, 55, -694, 1, -119,
+    2, -47, 3, 17, 4, 36, 5, 12, 6, -19, 7, -24, 8, 105, 9, -117,
+    10, 46, 11, 17, 12, -35, 13, 11, 14, 19, 15, -23, 16, -93, 18, 122,
+    20, -93, 22, 50, 24, -89, 25, 99, 26, -39, 27, -14, 28, 30, 29, -10,
+    30, -16, 31, 20, 32, -36, 33, 119, 34, -140, 35, -17, 36, 107, 37, -12,
+    38, -58, 39, 24, 40, -59, 41, 66, 42, -26, 43, -10, 44, 20, 45, -6,
+    46, -11, 47, 13, 48, -39, 50, 50, 52, -39, 54, 21, 56, 21, 57, -23,
+    58, 9, 59, 3, 60, -7, 61, 2, 62, 4, 63, -5, 62, -587, 1, 154,
+    2, -140, 3, -47, 4, 71, 5, -31, 6, -58, 7, 31, 8, -14, 9, 69,
+    10, 137, 11, 24, 12, -55, 13, 16, 14, 57, 15, 14, 16, -47, 17, 46,
+    18, 122, 19, -39, 20, -140, 21, -26, 22, 50, 23, 9, 24, -72, 25, -140,
+    26, -116, 27, 49, 28, 131, 29, 33, 30, -48, 31, -28, 32, -71, 33, -84,
+    34, -47, 35, -12, 37, -8, 38, -19, 39, -17, 40, -48, 41, -94, 42, -78,
+    43, 33, 44, 87, 45, 22, 46, -32, 47, -19, 48, -19, 49, 19, 50, 50,
+    51, -16, 52, -58, 53, -11, 54, 21, 55, 4, 56, -3, 57, 14, 58, 27,
+    59, 5, 60, -11, 61, 3, 62, 11, 63, 3, 59, -122, 1, 21, 2, 60,
+    3, -23, 4, 33, 5, -3, 6, -7, 7, 2, 8, -21, 9, -22, 10, 41,
+    11, 26, 12, -33, 13, 1, 14, 1, 15, -2, 16, 33, 17, 6, 18, 10,
+    19, -12, 20, -44, 21, 8, 22, -4, 23, -1, 24, 38, 25, 8, 26, -53,
+    27, -1, 28, 28, 29, -15, 30, 7, 31, 4, 32, 25, 33, -12, 34, -45,
+    35, 5, 36, 33, 37, 15, 38, 1, 39, -4, 40, 25, 41, 6, 42, -35,
+    43, -1, 44, 19, 45, -10, 46, 5, 47, 3, 48, 14, 49, 2, 50, 4,
+    51, -5, 52, -18, 53, 3, 54, -2, 56, -4, 57, -4, 58, 8, 59, 5,
+    60, -7, 59, 116, 1, -19, 2, -55, 3, 21, 4, -30, 5, 3, 6, 6,
+    7, -2, 8, 19, 9, 20, 10, -37, 11, -24, 12, 30, 13, -1, 14, -1,
+    15, 2, 16, -30, 17, -5, 18, -9, 19, 11, 20, 40, 21, -7, 22, 4,
+    23, 1, 24, -34, 25, -8, 26, 48, 27, 1, 28, -25, 29, 14, 30, -6,
+    31, -3, 32, -23, 33, 11, 34, 41, 35, -4, 36, -30, 37, -14, 38, -1,
+    39, 4, 40, -23, 41, -5, 42, 32, 43, 1, 44, -17, 45, 9, 46, -4,
+    47, -2, 48, -12, 49, -2, 50, -4, 51, 4, 52, 16, 53, -3, 54, 2,
+    56, 4, 57, 4, 58, -7, 59, -5, 60, 6, 39, -658, 1, -169, 3, -25,
+    4, 71, 5, -16, 7, -34, 8, 140, 9, -69, 10, -91, 11, 58, 13, 39,
+    14, -38, 15, -14, 24, -119, 25, 58, 26, 77, 27, -49, 29, -33, 30, 32,
+    31, 12, 32, -214, 33, 169, 35, 25, 36, -71, 37, 16, 39, 34, 40, -79,
+    41, 39, 42, 52, 43, -33, 45, -22, 46, 21, 47, 8, 56, 28, 57, -14,
+    58, -18, 59, 12, 61, 8, 62, -8, 63, -3, 55, -552, 1, 274, 3, -64,
+    4, -36, 5, -43, 7, 54, 8, 90, 9, 20, 10, -91, 11, -17, 12, 49,
+    13, -11, 14, -38, 15, 4, 16, -47, 17, -46, 19, 39, 20, 47, 21, 26,
+    23, -9, 24, -160, 25, -99, 26, 77, 27, 84, 28, 42, 29, 56, 30, 32,
+    31, -20, 32, -107, 33, -64, 35, -113, 36, -178, 37, -76, 39, -13, 40, -107,
+    41, -66, 42, 52, 43, 56, 44, 28, 45, 38, 46, 21, 47, -13, 48, -19,
+    49, -19, 51, 16, 52, 19, 53, 11, 55, -4, 56, 18, 57, 4, 58, -18,
+    59, -3, 60, 10, 61, -2, 62, -8, 63, 1, 57, -139, 1, 13, 2, 98,
+    3, -27, 5, 18, 6, -4, 7, -3, 8, -54, 9, -6, 10, 20, 11, 13,
+    12, 33, 13, -8, 14, -8, 15, 1, 16, 11, 17, -6, 18, -10, 19, 12,
+    21, -8, 22, 4, 23, 1, 24, 65, 25, -5, 26, -35, 27, 11, 28, -28,
+    29, -7, 30, 14, 31, 1, 32, 75, 33, 13, 34, -51, 35, -27, 37, 18,
+    38, -15, 39, -3, 40, 44, 41, -3, 42, -23, 43, 7, 44, -19, 45, -5,
+    46, 10, 47, 1, 48, 5, 49, -2, 50, -4, 51, 5, 53, -3, 54, 2,
+    56, -11, 57, -1, 58, 4, 59, 3, 60, 7, 61, -2, 62, -2, 57, 132,
+    1, -12, 2, -89, 3, 25, 5, -17, 6, 4, 7, 2, 8, 49, 9, 6,
+    10, -18, 11, -11, 12, -30, 13, 8, 14, 7, 15, -1, 16, -10, 17, 5,
+    18, 9, 19, -11, 21, 7, 22, -4, 23, -1, 24, -60, 25, 5, 26, 32,
+    27, -10, 28, 25, 29, 7, 30, -13, 31, -1, 32, -69, 33, -12, 34, 47,
+    35, 25, 37, -17, 38, 14, 39, 2, 40, -40, 41, 3, 42, 21, 43, -7,
+    44, 17, 45, 4, 46, -9, 47, -1, 48, -4, 49, 2, 50, 4, 51, -4,
+    53, 3, 54, -2, 56, 10, 57, 1, 58, -4, 59, -2, 60, -6, 61, 2,
+    62, 1, 53, -730, 1, -119, 3, 17, 5, 12, 7, -24, 8, -119, 9, 69,
+    10, 65, 11, -58, 12, 20, 13, -39, 14, 27, 15, 14, 17, 65, 18, -122,
+    19, 55, 21, 37, 22, -50, 23, 13, 24, 17, 25, -58, 26, 55, 27, 49,
+    28, -101, 29, 33, 30, 23, 31, -12, 33, 20, 35, -101, 36, 143, 37, -68,
+    39, 4, 40, 12, 41, -39, 42, 37, 43, 33, 44, -68, 45, 22, 46, 15,
+    47, -8, 49, 27, 50, -50, 51, 23, 53, 15, 54, -21, 55, 5, 56, -24,
+    57, 14, 58, 13, 59, -12, 60, 4, 61, -8, 62, 5, 63, 3, 52, -587,
+    1, 294, 2, 47, 3, -165, 4, -214, 5, -111, 6, 19, 7, 58, 8, -49,
+    9, -48, 11, 41, 12, 49, 13, 27, 15, -10, 16, -93, 17, -110, 18, -61,
+    19, -16, 21, -11, 22, -25, 23, -22, 24, -42, 25, -41, 27, 35, 28, 42,
+    29, 23, 31, -8, 33, 14, 34, 47, 35, 72, 36, 71, 37, 48, 38, 19,
+    39, 3, 40, -28, 41, -27, 43, 23, 44, 28, 45, 16, 47, -5, 48, -39,
+    49, -46, 50, -25, 51, -7, 53, -4, 54, -10, 55, -9, 56, -10, 57, -10,
+    59, 8, 60, 10, 61, 5, 63, -2, 60, -114, 1, 14, 2, 91, 3, -38,
+    4, -8, 5, 35, 6, -20, 7, -6, 8, 40, 9, 14, 10, -26, 11, -15,
+    12, -12, 13, -3, 14, 11, 15, 2, 16, 22, 17, -17, 18, -39, 19, 21,
+    20, 33, 21, -2, 22, -8, 23, -1, 24, 6, 25, -3, 26, 4, 27, 18,
+    28, -10, 29, -23, 30, -2, 31, 4, 33, -4, 34, -1, 35, -2, 36, -8,
+    37, 11, 38, 19, 39, -3, 40, 4, 41, -2, 42, 3, 43, 12, 44, -7,
+    45, -15, 46, -1, 47, 3, 48, 9, 49, -7, 50, -16, 51, 9, 52, 14,
+    53, -1, 54, -3, 56, 8, 57, 3, 58, -5, 59, -3, 60, -2, 61, -1,
+    62, 2, 60, 109, 1, -13, 2, -83, 3, 35, 4, 8, 5, -32, 6, 18,
+    7, 6, 8, -36, 9, -13, 10, 24, 11, 14, 12, 11, 13, 3, 14, -10,
+    15, -2, 16, -20, 17, 15, 18, 35, 19, -19, 20, -30, 21, 2, 22, 7,
+    23, 1, 24, -5, 25, 3, 26, -3, 27, -16, 28, 9, 29, 21, 30, 1,
+    31, -4, 33, 3, 34, 1, 35, 2, 36, 8, 37, -10, 38, -17, 39, 2,
+    40, -4, 41, 2, 42, -2, 43, -11, 44, 6, 45, 14, 46, 1, 47, -3,
+    48, -8, 49, 6, 50, 15, 51, -8, 52, -12, 53, 1, 54, 3, 56, -7,
+    57, -3, 58, 5, 59, 3, 60, 2, 61, 1, 62, -2, 20, -445, 1, -239,
+    2, -186, 3, 35, 4, 143, 5, 23, 6, -77, 7, -47, 16, -93, 18, 122,
+    20, -93, 22, 50, 32, -285, 33, 239, 35, -35, 37, -23, 39, 47, 48, -39,
+    50, 50, 52, -39, 54, 21, 39, -552, 1, 239, 2, -47, 3, -35, 4, 36,
+    5, -23, 6, -19, 7, 47, 8, 20, 10, -27, 12, 20, 14, -11, 16, 47,
+    18, -61, 20, 47, 22, -25, 24, -101, 26, 132, 28, -101, 30, 55, 32, -249,
+    33, -239, 34, -47, 35, 35, 36, 36, 37, 23, 38, -19, 39, -47, 40, -68,
+    42, 88, 44, -68, 46, 37, 48, 19, 50, -25, 52, 19, 54, -10, 56, 4,
+    58, -5, 60, 4, 62, -2, 50, -189, 1, -25, 2, 105, 3, 21, 4, 42,
+    5, 14, 6, -7, 7, -5, 8, -5, 9, 5, 11, -4, 12, 5, 13, -3,
+    15, 1, 16, 11, 17, 32, 19, -27, 20, -11, 21, -18, 23, 6, 24, 24,
+    25, -23, 27, 20, 28, -24, 29, 13, 31, -5, 32, 125, 33, 8, 34, -105,
+    35, -7, 36, 8, 37, -5, 38, 7, 39, 2, 40, 16, 41, -16, 43, 13,
+    44, -16, 45, 9, 47, -3, 48, 5, 49, 13, 51, -11, 52, -5, 53, -8,
+    55, 3, 56, -1, 57, 1, 59, -1, 60, 1, 61, -1, 49, 177, 1, 22,
+    2, -96, 3, -19, 4, -38, 5, -13, 6, 7, 7, 4, 8, 4, 9, -4,
+    11, 4, 12, -4, 13, 2, 15, -1, 16, -10, 17, -29, 19, 25, 20, 10,
+    21, 17, 23, -6, 24, -22, 25, 21, 27, -18, 28, 22, 29, -12, 31, 4,
+    32, -114, 33, -7, 34, 96, 35, 6, 36, -8, 37, 4, 38, -7, 39, -1,
+    40, -14, 41, 14, 43, -12, 44, 14, 45, -8, 47, 3, 48, -4, 49, -12,
+    51, 10, 52, 4, 53, 7, 55, -2, 56, 1, 57, -1, 59, 1, 60, -1,
+    63, -605, 1, -179, 2, -70, 3, 26, 4, 53, 5, 17, 6, -29, 7, -36,
+    8, -158, 9, 34, 10, 169, 11, -53, 12, -60, 13, -35, 14, 70, 15, 7,
+    16, 23, 17, 13, 18, -30, 19, -66, 20, 116, 21, -44, 22, -13, 23, 3,
+    24, -75, 25, 111, 26, -89, 27, 25, 28, 9, 29, 16, 30, -37, 31, 22,
+    32, 53, 33, -80, 34, 23, 35, 110, 36, -160, 37, 73, 38, 10, 39, -16,
+    40, -50, 41, 74, 42, -59, 43, 16, 44, 6, 45, 11, 46, -25, 47, 15,
+    48, 10, 49, 6, 50, -13, 51, -27, 52, 48, 53, -18, 54, -5, 55, 1,
+    56, -32, 57, 7, 58, 34, 59, -11, 60, -12, 61, -7, 62, 14, 63, 1,
+    63, -712, 1, 179, 2, 70, 3, -26, 4, -53, 5, -17, 6, 29, 7, 36,
+    8, 31, 9, 34, 10, 13, 11, -5, 12, -10, 13, -3, 14, 6, 15, 7,
+    16, 70, 17, 78, 18, 30, 19, -11, 20, -23, 21, -8, 22, 13, 23, 16,
+    24, -152, 25, -169, 26, -66, 27, 25, 28, 51, 29, 16, 30, -27, 31, -34,
+    32, -53, 33, -60, 34, -23, 35, 9, 36, 18, 37, 6, 38, -10, 39, -12,
+    40, -101, 41, -113, 42, -44, 43, 16, 44, 34, 45, 11, 46, -18, 47, -23,
+    48, 29, 49, 32, 50, 13, 51, -5, 52, -10, 53, -3, 54, 5, 55, 6,
+    56, 6, 57, 7, 58, 3, 59, -1, 60, -2, 61, -1, 62, 1, 63, 1,
+    52, -114, 1, -25, 2, 79, 3, 21, 5, 14, 6, -6, 7, -5, 8, 30,
+    9, 36, 11, -41, 12, -33, 13, -4, 14, 5, 15, 4, 16, -22, 17, 1,
+    18, 14, 19, -15, 21, 22, 22, 6, 23, -4, 24, 53, 25, -11, 26, -62,
+    27, 18, 28, 28, 29, -8, 31, 1, 33, -10, 34, 5, 35, 29, 37, -29,
+    38, -11, 39, 5, 40, 36, 41, -8, 42, -41, 43, 12, 44, 19, 45, -5,
+    48, -9, 50, 6, 51, -6, 53, 9, 54, 2, 55, -2, 56, 6, 57, 7,
+    59, -8, 60, -7, 61, -1, 62, 1, 63, 1, 52, 109, 1, 22, 2, -72,
+    3, -19, 5, -13, 6, 5, 7, 4, 8, -27, 9, -33, 11, 37, 12, 30,
+    13, 3, 14, -5, 15, -3, 16, 20, 17, -1, 18, -13, 19, 13, 21, -20,
+    22, -5, 23, 4, 24, -49, 25, 10, 26, 57, 27, -17, 28, -25, 29, 7,
+    31, -1, 33, 9, 34, -4, 35, -27, 37, 26, 38, 10, 39, -5, 40, -32,
+    41, 7, 42, 38, 43, -11, 44, -17, 45, 5, 48, 8, 50, -5, 51, 6,
+    53, -8, 54, -2, 55, 2, 56, -5, 57, -7, 59, 7, 60, 6, 61, 1,
+    62, -1, 63, -1, 63, -676, 1, -144, 2, -23, 3, -4, 4, 53, 5, -2,
+    6, -10, 7, -29, 8, 150, 9, -83, 10, -78, 11, 46, 12, 10, 13, 31,
+    14, -32, 15, -16, 16, 23, 17, -32, 18, 30, 19, -27, 20, 23, 21, -18,
+    22, 13, 23, -6, 24, -169, 25, 128, 26, 11, 27, 10, 28, -51, 29, 7,
+    30, 5, 31, 26, 32, -160, 33, 95, 34, 70, 35, -38, 36, -18, 37, -26,
+    38, 29, 39, 19, 40, -113, 41, 86, 42, 8, 43, 7, 44, -34, 45, 5,
+    46, 3, 47, 17, 48, 10, 49, -13, 50, 13, 51, -11, 52, 10, 53, -8,
+    54, 5, 55, -3, 56, 30, 57, -16, 58, -16, 59, 9, 60, 2, 61, 6,
+    62, -6, 63, -3, 63, -534, 1, 214, 2, -116, 3, -56, 4, 53, 5, -37,
+    6, -48, 7, 43, 8, 80, 9, 14, 10, -78, 11, 12, 12, 80, 13, 8,
+    14, -32, 15, 3, 16, -70, 17, 32, 18, 152, 19, 27, 20, -70, 21, 18,
+    22, 63, 23, 6, 24, -110, 25, -70, 26, 11, 27, -59, 28, -110, 29, -40,
+    30, 5, 31, -14, 32, -160, 33, -164, 34, -23, 35, 98, 36, 125, 37, 65,
+    38, -10, 39, -33, 40, -73, 41, -47, 42, 8, 43, -40, 44, -73, 45, -27,
+    46, 3, 47, -9, 48, -29, 49, 13, 50, 63, 51, 11, 52, -29, 53, 8,
+    54, 26, 55, 3, 56, 16, 57, 3, 58, -16, 59, 2, 60, 16, 61, 2,
+    62, -6, 63, 1, 62, -139, 1, 25, 2, 79, 3, -32, 4, 25, 5, 3,
+    6, -6, 7, 1, 8, -54, 9, -9, 10, 21, 11, 18, 12, 28, 13, -12,
+    14, -4, 15, 2, 16, 11, 17, -21, 18, 14, 19, 18, 20, -33, 21, 12,
+    22, 6, 23, -4, 24, 65, 25, 7, 26, -44, 27, -15, 28, -4, 29, 10,
+    30, -8, 31, -1, 32, 75, 33, 8, 34, -57, 35, 4, 36, -8, 37, -21,
+    38, 15, 39, 5, 40, 44, 41, 5, 42, -29, 43, -10, 44, -3, 45, 7,
+    46, -5, 47, -1, 48, 5, 49, -9, 50, 6, 51, 8, 52, -14, 53, 5,
+    54, 2, 55, -2, 56, -11, 57, -2, 58, 4, 59, 4, 60, 6, 61, -2,
+    62, -1, 62, 132, 1, -23, 2, -72, 3, 29, 4, -23, 5, -3, 6, 5,
+    7, -1, 8, 49, 9, 8, 10, -20, 11, -16, 12, -26, 13, 11, 14, 3,
+    15, -2, 16, -10, 17, 20, 18, -13, 19, -17, 20, 30, 21, -11, 22, -5,
+    23, 4, 24, -60, 25, -7, 26, 40, 27, 14, 28, 4, 29, -9, 30, 7,
+    31, 1, 32, -69, 33, -7, 34, 52, 35, -4, 36, 8, 37, 20, 38, -13,
+    39, -5, 40, -40, 41, -4, 42, 27, 43, 9, 44, 2, 45, -6, 46, 5,
+    47, 1, 48, -4, 49, 8, 50, -5, 51, -7, 52, 12, 53, -5, 54, -2,
+    55, 2, 56, 10, 57, 2, 58, -4, 59, -3, 60, -5, 61, 2, 62, 1,
+    63, -569, 1, -179, 2, -116, 3, 26, 4, 89, 5, 17, 6, -48, 7, -36,
+    8, -39, 9, -34, 10, 105, 11, 5, 12, -80, 13, 3, 14, 43, 15, -7,
+    16, -23, 17, -78, 18, 152, 19, 11, 20, -116, 21, 8, 22, 63, 23, -16,
+    24, -92, 25, 169, 26, -143, 27, -25, 28, 110, 29, -16, 30, -59, 31, 34,
+    32, -53, 33, 60, 34, -23, 35, -9, 36, 18, 37, -6, 38, -10, 39, 12,
+    40, -62, 41, 113, 42, -96, 43, -16, 44, 73, 45, -11, 46, -40, 47, 23,
+    48, -10, 49, -32, 50, 63, 51, 5, 52, -48, 53, 3, 54, 26, 55, -6,
+    56, -8, 57, -7, 58, 21, 59, 1, 60, -16, 61, 1, 62, 9, 63, -1,
+    63, -569, 1, 179, 2, -116, 3, -26, 4, 89, 5, -17, 6, -48, 7, 36,
+    8, -39, 9, 34, 10, 105, 11, -5, 12, -80, 13, -3, 14, 43, 15, 7,
+    16, -23, 17, 78, 18, 152, 19, -11, 20, -116, 21, -8, 22, 63, 23, 16,
+    24, -92, 25, -169, 26, -143, 27, 25, 28, 110, 29, 16, 30, -59, 31, -34,
+    32, -53, 33, -60, 34, -23, 35, 9, 36, 18, 37, 6, 38, -10, 39, -12,
+    40, -62, 41, -113, 42, -96, 43, 16, 44, 73, 45, 11, 46, -40, 47, -23,
+    48, -10, 49, 32, 50, 63, 51, -5, 52, -48, 53, -3, 54, 26, 55, 6,
+    56, -8, 57, 7, 58, 21, 59, -1, 60, -16, 61, -1, 62, 9, 63, 1,
+    30, -156, 2, 79, 4, 42, 6, -6, 8, 18, 10, 15, 12, -38, 14, -1,
+    16, 11, 18, 34, 20, -55, 22, -2, 24, 43, 26, -75, 28, 52, 30, 5,
+    32, 25, 34, -26, 36, 8, 38, 2, 40, 29, 42, -50, 44, 34, 46, 4,
+    48, 5, 50, 14, 52, -23, 54, -1, 56, 4, 58, 3, 60, -7, 30, 147,
+    2, -72, 4, -38, 6, 5, 8, -17, 10, -14, 12, 34, 14, 1, 16, -10,
+    18, -31, 20, 50, 22, 2, 24, -40, 26, 68, 28, -47, 30, -5, 32, -23,
+    34, 24, 36, -8, 38, -2, 40, -26, 42, 46, 44, -31, 46, -3, 48, -4,
+    50, -13, 52, 21, 54, 1, 56, -3, 58, -3, 60, 7, 63, -569, 1, -179,
+    2, -116, 3, 26, 4, 89, 5, 17, 6, -48, 7, -36, 8, -39, 9, -34,
+    10, 105, 11, 5, 12, -80, 13, 3, 14, 43, 15, -7, 16, -23, 17, -78,
+    18, 152, 19, 11, 20, -116, 21, 8, 22, 63, 23, -16, 24, -92, 25, 169,
+    26, -143, 27, -25, 28, 110, 29, -16, 30, -59, 31, 34, 32, -53, 33, 60,
+    34, -23, 35, -9, 36, 18, 37, -6, 38, -10, 39, 12, 40, -62, 41, 113,
+    42, -96, 43, -16, 44, 73, 45, -11, 46, -40, 47, 23, 48, -10, 49, -32,
+    50, 63, 51, 5, 52, -48, 53, 3, 54, 26, 55, -6, 56, -8, 57, -7,
+    58, 21, 59, 1, 60, -16, 61, 1, 62, 9, 63, -1, 63, -534, 1, 179,
+    2, -163, 3, -26, 4, 125, 5, -17, 6, -67, 7, 36, 8, -89, 9, 34,
+    10, 169, 11, -5, 12, -130, 13, -3, 14, 70, 15, 7, 16, 23, 17, 78,
+    18, 91, 19, -11, 20, -70, 21, -8, 22, 38, 23, 16, 24, -134, 25, -169,
+    26, -89, 27, 25, 28, 68, 29, 16, 30, -37, 31, -34, 32, -18, 33, -60,
+    34, -70, 35, 9, 36, 53, 37, 6, 38, -29, 39, -12, 40, -90, 41, -113,
+    42, -59, 43, 16, 44, 45, 45, 11, 46, -25, 47, -23, 48, 10, 49, 32,
+    50, 38, 51, -5, 52, -29, 53, -3, 54, 16, 55, 6, 56, -18, 57, 7,
+    58, 34, 59, -1, 60, -26, 61, -1, 62, 14, 63, 1, 59, -164, 1, 8,
+    2, 79, 3, -7, 4, 50, 5, -5, 6, -6, 7, 2, 8, 30, 9, -11,
+    10, 15, 11, 10, 12, -49, 13, 6, 14, -1, 15, -2, 17, 11, 18, 34,
+    19, -9, 20, -44, 21, -6, 22, -2, 23, 2, 24, 53, 25, -10, 26, -75,
+    27, 8, 28, 42, 29, 5, 30, 5, 31, -2, 32, 17, 33, 8, 34, -26,
+    35, -7, 36, 17, 37, -5, 38, 2, 39, 2, 40, 36, 41, -6, 42, -50,
+    43, 5, 44, 28, 45, 4, 46, 4, 47, -1, 49, 4, 50, 14, 51, -4,
+    52, -18, 53, -3, 54, -1, 55, 1, 56, 6, 57, -2, 58, 3, 59, 2,
+    60, -10, 61, 1, 59, 154, 1, -7, 2, -72, 3, 6, 4, -46, 5, 4,
+    6, 5, 7, -1, 8, -27, 9, 10, 10, -14, 11, -9, 12, 45, 13, -6,
+    14, 1, 15, 2, 17, -10, 18, -31, 19, 8, 20, 40, 21, 6, 22, 2,
+    23, -2, 24, -49, 25, 9, 26, 68, 27, -7, 28, -38, 29, -5, 30, -5,
+    31, 2, 32, -15, 33, -7, 34, 24, 35, 6, 36, -15, 37, 4, 38, -2,
+    39, -1, 40, -32, 41, 6, 42, 46, 43, -5, 44, -25, 45, -3, 46, -3,
+    47, 1, 49, -4, 50, -13, 51, 3, 52, 16, 53, 2, 54, 1, 55, -1,
+    56, -5, 57, 2, 58, -3, 59, -2, 60, 9, 61, -1, 63, -534, 1, -179,
+    2, -163, 3, 26, 4, 125, 5, 17, 6, -67, 7, -36, 8, -89, 9, -34,
+    10, 169, 11, 5, 12, -130, 13, 3, 14, 70, 15, -7, 16, 23, 17, -78,
+    18, 91, 19, 11, 20, -70, 21, 8, 22, 38, 23, -16, 24, -134, 25, 169,
+    26, -89, 27, -25, 28, 68, 29, -16, 30, -37, 31, 34, 32, -18, 33, 60,
+    34, -70, 35, -9, 36, 53, 37, -6, 38, -29, 39, 12, 40, -90, 41, 113,
+    42, -59, 43, -16, 44, 45, 45, -11, 46, -25, 47, 23, 48, 10, 49, -32,
+    50, 38, 51, 5, 52, -29, 53, 3, 54, 16, 55, -6, 56, -18, 57, -7,
+    58, 34, 59, 1, 60, -26, 61, 1, 62, 14, 63, -1, 63, -534, 1, 179,
+    2, -163, 3, -26, 4, 125, 5, -17, 6, -67, 7, 36, 8, -89, 9, 34,
+    10, 169, 11, -5, 12, -130, 13, -3, 14, 70, 15, 7, 16, 23, 17, 78,
+    18, 91, 19, -11, 20, -70, 21, -8, 22, 38, 23, 16, 24, -134, 25, -169,
+    26, -89, 27, 25, 28, 68, 29, 16, 30, -37, 31, -34, 32, -18, 33, -60,
+    34, -70, 35, 9, 36, 53, 37, 6, 38, -29, 39, -12, 40, -90, 41, -113,
+    42, -59, 43, 16, 44, 45, 45, 11, 46, -25, 47, -23, 48, 10, 49, 32,
+    50, 38, 51, -5, 52, -29, 53, -3, 54, 16, 55, 6, 56, -18, 57, 7,
+    58, 34, 59, -1, 60, -26, 61, -1, 62, 14, 63, 1, 30, -172, 2, 79,
+    4, 59, 6, -6, 8, 42, 10, 15, 12, -61, 14, -1, 16, -11, 18, 34,
+    20, -33, 22, -2, 24, 63, 26, -75, 28, 32, 30, 5, 32, 8, 34, -26,
+    36, 25, 38, 2, 40, 42, 42, -50, 44, 21, 46, 4, 48, -5, 50, 14,
+    52, -14, 54, -1, 56, 8, 58, 3, 60, -12, 30, 162, 2, -72, 4, -53,
+    6, 5, 8, -38, 10, -14, 12, 55, 14, 1, 16, 10, 18, -31, 20, 30,
+    22, 2, 24, -57, 26, 68, 28, -29, 30, -5, 32, -8, 34, 24, 36, -23,
+    38, -2, 40, -38, 42, 46, 44, -19, 46, -3, 48, 4, 50, -13, 52, 12,
+    54, 1, 56, -8, 58, -3, 60, 11, 63, -463, 1, -179, 2, -256, 3, 26,
+    4, 196, 5, 17, 6, -106, 7, -36, 8, -19, 9, -34, 10, 78, 11, 5,
+    12, -60, 13, 3, 14, 32, 15, -7, 16, 23, 17, -78, 18, 91, 19, 11,
+    20, -70, 21, 8, 22, 38, 23, -16, 24, -194, 25, 169, 26, -11, 27, -25,
+    28, 9, 29, -16, 30, -5, 31, 34, 32, -89, 33, 60, 34, 23, 35, -9,
+    36, -18, 37, -6, 38, 10, 39, 12, 40, -129, 41, 113, 42, -8, 43, -16,
+    44, 6, 45, -11, 46, -3, 47, 23, 48, 10, 49, -32, 50, 38, 51, 5,
+    52, -29, 53, 3, 54, 16, 55, -6, 56, -4, 57, -7, 58, 16, 59, 1,
+    60, -12, 61, 1, 62, 6, 63, -1, 63, -569, 1, 179, 2, -116, 3, -26,
+    4, 89, 5, -17, 6, -48, 7, 36, 8, -39, 9, 34, 10, 105, 11, -5,
+    12, -80, 13, -3, 14, 43, 15, 7, 16, -23, 17, 78, 18, 152, 19, -11,
+    20, -116, 21, -8, 22, 63, 23, 16, 24, -92, 25, -169, 26, -143, 27, 25,
+    28, 110, 29, 16, 30, -59, 31, -34, 32, -53, 33, -60, 34, -23, 35, 9,
+    36, 18, 37, 6, 38, -10, 39, -12, 40, -62, 41, -113, 42, -96, 43, 16,
+    44, 73, 45, 11, 46, -40, 47, -23, 48, -10, 49, 32, 50, 63, 51, -5,
+    52, -48, 53, -3, 54, 26, 55, 6, 56, -8, 57, 7, 58, 21, 59, -1,
+    60, -16, 61, -1, 62, 9, 63, 1, 58, -181, 1, -25, 2, 79, 3, 21,
+    4, 67, 5, 14, 6, -6, 7, -5, 8, 14, 9, -5, 10, 15, 11, 4,
+    12, -33, 13, 3, 14, -1, 15, -1, 17, -11, 18, 34, 19, 9, 20, -44,
+    21, 6, 22, -2, 23, -2, 24, 67, 25, 23, 26, -75, 27, -20, 28, 28,
+    29, -13, 30, 5, 31, 5, 32, 33, 33, 8, 34, -26, 35, -7, 37, -5,
+    38, 2, 39, 2, 40, 45, 41, 16, 42, -50, 43, -13, 44, 19, 45, -9,
+    46, 4, 47, 3, 49, -4, 50, 14, 51, 4, 52, -18, 53, 3, 54, -1,
+    55, -1, 56, 3, 57, -1, 58, 3, 59, 1, 60, -7, 61, 1, 57, 170,
+    1, 22, 2, -72, 3, -19, 4, -61, 5, -13, 6, 5, 7, 4, 8, -12,
+    9, 4, 10, -14, 11, -4, 12, 30, 13, -2, 14, 1, 15, 1, 17, 10,
+    18, -31, 19, -8, 20, 40, 21, -6, 22, 2, 23, 2, 24, -61, 25, -21,
+    26, 68, 27, 18, 28, -25, 29, 12, 30, -5, 31, -4, 32, -30, 33, -7,
+    34, 24, 35, 6, 37, 4, 38, -2, 39, -1, 40, -41, 41, -14, 42, 46,
+    43, 12, 44, -17, 45, 8, 46, -3, 47, -3, 49, 4, 50, -13, 51, -3,
+    52, 16, 53, -2, 54, 1, 55, 1, 56, -2, 57, 1, 58, -3, 59, -1,
+    60, 6, 55, -587, 1, -119, 2, -186, 3, 17, 4, 143, 5, 12, 6, -77,
+    7, -24, 8, -14, 9, -117, 10, 202, 11, 17, 12, -154, 13, 11, 14, 83,
+    15, -23, 16, -47, 18, 61, 20, -47, 22, 25, 24, -72, 25, 99, 26, -61,
+    27, -14, 28, 47, 29, -10, 30, -25, 31, 20, 32, -71, 33, 119, 34, -93,
+    35, -17, 36, 71, 37, -12, 38, -39, 39, 24, 40, -48, 41, 66, 42, -41,
+    43, -10, 44, 31, 45, -6, 46, -17, 47, 13, 48, -19, 50, 25, 52, -19,
+    54, 10, 56, -3, 57, -23, 58, 40, 59, 3, 60, -31, 61, 2, 62, 17,
+    63, -5, 55, -694, 1, 119, 2, -47, 3, -17, 4, 36, 5, -12, 6, -19,
+    7, 24, 8, 105, 9, 117, 10, 46, 11, -17, 12, -35, 13, -11, 14, 19,
+    15, 23, 16, -93, 18, 122, 20, -93, 22, 50, 24, -89, 25, -99, 26, -39,
+    27, 14, 28, 30, 29, 10, 30, -16, 31, -20, 32, -36, 33, -119, 34, -140,
+    35, 17, 36, 107, 37, 12, 38, -58, 39, -24, 40, -59, 41, -66, 42, -26,
+    43, 10, 44, 20, 45, 6, 46, -11, 47, -13, 48, -39, 50, 50, 52, -39,
+    54, 21, 56, 21, 57, 23, 58, 9, 59, -3, 60, -7, 61, -2, 62, 4,
+    63, 5, 59, -122, 1, -25, 2, 53, 3, 21, 4, 42, 5, 14, 6, -4,
+    7, -5, 8, -21, 9, 27, 10, 52, 11, -23, 12, -44, 13, -16, 14, -4,
+    15, 5, 16, 33, 17, -11, 19, 9, 20, -33, 21, 6, 23, -2, 24, 38,
+    25, -4, 26, -44, 27, 3, 28, 18, 29, 2, 30, 3, 31, -1, 32, 25,
+    33, 8, 34, -53, 35, -7, 36, 42, 37, -5, 38, 4, 39, 2, 40, 25,
+    41, -3, 42, -29, 43, 2, 44, 12, 45, 2, 46, 2, 47, -1, 48, 14,
+    49, -4, 51, 4, 52, -14, 53, 3, 55, -1, 56, -4, 57, 5, 58, 10,
+    59, -5, 60, -9, 61, -3, 62, -1, 63, 1, 58, 116, 1, 22, 2, -48,
+    3, -19, 4, -38, 5, -13, 6, 3, 7, 4, 8, 19, 9, -25, 10, -47,
+    11, 21, 12, 40, 13, 14, 14, 3, 15, -5, 16, -30, 17, 10, 19, -8,
+    20, 30, 21, -6, 23, 2, 24, -34, 25, 4, 26, 40, 27, -3, 28, -16,
+    29, -2, 30, -3, 31, 1, 32, -23, 33, -7, 34, 48, 35, 6, 36, -38,
+    37, 4, 38, -3, 39, -1, 40, -23, 41, 2, 42, 27, 43, -2, 44, -11,
+    45, -1, 46, -2, 48, -12, 49, 4, 51, -3, 52, 12, 53, -2, 55, 1,
+    56, 4, 57, -5, 58, -9, 59, 4, 60, 8, 61, 3, 62, 1, 63, -1,
+    52, -516, 1, -119, 2, -279, 3, 17, 4, 214, 5, 12, 6, -116, 7, -24,
+    8, 55, 9, -117, 10, 110, 11, 17, 12, -84, 13, 11, 14, 46, 15, -23,
+    16, -47, 18, 61, 20, -47, 22, 25, 24, -131, 25, 99, 26, 16, 27, -14,
+    28, -12, 29, -10, 30, 7, 31, 20, 32, -143, 33, 119, 35, -17, 37, -12,
+    39, 24, 40, -87, 41, 66, 42, 11, 43, -10, 44, -8, 45, -6, 46, 4,
+    47, 13, 48, -19, 50, 25, 52, -19, 54, 10, 56, 11, 57, -23, 58, 22,
+    59, 3, 60, -17, 61, 2, 62, 9, 63, -5, 55, -587, 1, 119, 2, -186,
+    3, -17, 4, 143, 5, -12, 6, -77, 7, 24, 8, -14, 9, 117, 10, 202,
+    11, -17, 12, -154, 13, -11, 14, 83, 15, 23, 16, -47, 18, 61, 20, -47,
+    22, 25, 24, -72, 25, -99, 26, -61, 27, 14, 28, 47, 29, 10, 30, -25,
+    31, -20, 32, -71, 33, -119, 34, -93, 35, 17, 36, 71, 37, 12, 38, -39,
+    39, -24, 40, -48, 41, -66, 42, -41, 43, 10, 44, 31, 45, 6, 46, -17,
+    47, -13, 48, -19, 50, 25, 52, -19, 54, 10, 56, -3, 57, 23, 58, 40,
+    59, -3, 60, -31, 61, -2, 62, 17, 63, 5, 51, -164, 1, -16, 2, 53,
+    3, 14, 4, 84, 5, 9, 6, -4, 7, -3, 8, -10, 9, -16, 10, 52,
+    11, 14, 12, -56, 13, 9, 14, -4, 15, -3, 16, 22, 20, -22, 24, 47,
+    25, 14, 26, -44, 27, -12, 28, 8, 29, -8, 30, 3, 31, 3, 32, 50,
+    33, 16, 34, -53, 35, -14, 36, 17, 37, -9, 38, 4, 39, 3, 40, 32,
+    41, 9, 42, -29, 43, -8, 44, 5, 45, -5, 46, 2, 47, 2, 48, 9,
+    52, -9, 56, -2, 57, -3, 58, 10, 59, 3, 60, -11, 61, 2, 62, -1,
+    63, -1, 51, 154, 1, 15, 2, -48, 3, -13, 4, -76, 5, -8, 6, 3,
+    7, 3, 8, 9, 9, 15, 10, -47, 11, -12, 12, 51, 13, -8, 14, 3,
+    15, 3, 16, -20, 20, 20, 24, -43, 25, -12, 26, 40, 27, 11, 28, -7,
+    29, 7, 30, -3, 31, -2, 32, -46, 33, -15, 34, 48, 35, 13, 36, -15,
+    37, 8, 38, -3, 39, -3, 40, -29, 41, -8, 42, 27, 43, 7, 44, -5,
+    45, 5, 46, -2, 47, -2, 48, -8, 52, 8, 56, 2, 57, 3, 58, -9,
+    59, -2, 60, 10, 61, -2, 62, 1, 63, 1, 63, -463, 1, -179, 2, -256,
+    3, 26, 4, 196, 5, 17, 6, -106, 7, -36, 8, -19, 9, -34, 10, 78,
+    11, 5, 12, -60, 13, 3, 14, 32, 15, -7, 16, 23, 17, -78, 18, 91,
+    19, 11, 20, -70, 21, 8, 22, 38, 23, -16, 24, -194, 25, 169, 26, -11,
+    27, -25, 28, 9, 29, -16, 30, -5, 31, 34, 32, -89, 33, 60, 34, 23,
+    35, -9, 36, -18, 37, -6, 38, 10, 39, 12, 40, -129, 41, 113, 42, -8,
+    43, -16, 44, 6, 45, -11, 46, -3, 47, 23, 48, 10, 49, -32, 50, 38,
+    51, 5, 52, -29, 53, 3, 54, 16, 55, -6, 56, -4, 57, -7, 58, 16,
+    59, 1, 60, -12, 61, 1, 62, 6, 63, -1, 63, -641, 1, 179, 2, -23,
+    3, -26, 4, 18, 5, -17, 6, -10, 7, 36, 8, 101, 9, 34, 10, -78,
+    11, -5, 12, 60, 13, -3, 14, -32, 15, 7, 16, 70, 17, 78, 18, 30,
+    19, -11, 20, -23, 21, -8, 22, 13, 23, 16, 24, -211, 25, -169, 26, 11,
+    27, 25, 28, -9, 29, 16, 30, 5, 31, -34, 32, -125, 33, -60, 34, 70,
+    35, 9, 36, -53, 37, 6, 38, 29, 39, -12, 40, -141, 41, -113, 42, 8,
+    43, 16, 44, -6, 45, 11, 46, 3, 47, -23, 48, 29, 49, 32, 50, 13,
+    51, -5, 52, -10, 53, -3, 54, 5, 55, 6, 56, 20, 57, 7, 58, -16,
+    59, -1, 60, 12, 61, -1, 62, -6, 63, 1, 58, -164, 1, -41, 2, 79,
+    3, 35, 4, 50, 5, 23, 6, -6, 7, -8, 8, -19, 9, 27, 10, 15,
+    11, -23, 13, -16, 14, -1, 15, 5, 16, -22, 17, 11, 18, 34, 19, -9,
+    20, -22, 21, -6, 22, -2, 23, 2, 24, 95, 25, -4, 26, -75, 27, 3,
+    29, 2, 30, 5, 31, -1, 32, 50, 33, -8, 34, -26, 35, 7, 36, -17,
+    37, 5, 38, 2, 39, -2, 40, 63, 41, -3, 42, -50, 43, 2, 45, 2,
+    46, 4, 47, -1, 48, -9, 49, 4, 50, 14, 51, -4, 52, -9, 53, -3,
+    54, -1, 55, 1, 56, -4, 57, 5, 58, 3, 59, -5, 61, -3, 63, 1,
+    57, 154, 1, 37, 2, -72, 3, -32, 4, -46, 5, -21, 6, 5, 7, 7,
+    8, 18, 9, -25, 10, -14, 11, 21, 13, 14, 14, 1, 15, -5, 16, 20,
+    17, -10, 18, -31, 19, 8, 20, 20, 21, 6, 22, 2, 23, -2, 24, -87,
+    25, 4, 26, 68, 27, -3, 29, -2, 30, -5, 31, 1, 32, -46, 33, 7,
+    34, 24, 35, -6, 36, 15, 37, -4, 38, -2, 39, 1, 40, -58, 41, 2,
+    42, 46, 43, -2, 45, -1, 46, -3, 48, 8, 49, -4, 50, -13, 51, 3,
+    52, 8, 53, 2, 54, 1, 55, -1, 56, 3, 57, -5, 58, -3, 59, 4,
+    61, 3, 63, -1, 63, -463, 1, -179, 2, -256, 3, 26, 4, 196, 5, 17,
+    6, -106, 7, -36, 8, -19, 9, -34, 10, 78, 11, 5, 12, -60, 13, 3,
+    14, 32, 15, -7, 16, 23, 17, -78, 18, 91, 19, 11, 20, -70, 21, 8,
+    22, 38, 23, -16, 24, -194, 25, 169, 26, -11, 27, -25, 28, 9, 29, -16,
+    30, -5, 31, 34, 32, -89, 33, 60, 34, 23, 35, -9, 36, -18, 37, -6,
+    38, 10, 39, 12, 40, -129, 41, 113, 42, -8, 43, -16, 44, 6, 45, -11,
+    46, -3, 47, 23, 48, 10, 49, -32, 50, 38, 51, 5, 52, -29, 53, 3,
+    54, 16, 55, -6, 56, -4, 57, -7, 58, 16, 59, 1, 60, -12, 61, 1,
+    62, 6, 63, -1, 63, -641, 1, 179, 2, -23, 3, -26, 4, 18, 5, -17,
+    6, -10, 7, 36, 8, 101, 9, 34, 10, -78, 11, -5, 12, 60, 13, -3,
+    14, -32, 15, 7, 16, 70, 17, 78, 18, 30, 19, -11, 20, -23, 21, -8,
+    22, 13, 23, 16, 24, -211, 25, -169, 26, 11, 27, 25, 28, -9, 29, 16,
+    30, 5, 31, -34, 32, -125, 33, -60, 34, 70, 35, 9, 36, -53, 37, 6,
+    38, 29, 39, -12, 40, -141, 41, -113, 42, 8, 43, 16, 44, -6, 45, 11,
+    46, 3, 47, -23, 48, 29, 49, 32, 50, 13, 51, -5, 52, -10, 53, -3,
+    54, 5, 55, 6, 56, 20, 57, 7, 58, -16, 59, -1, 60, 12, 61, -1,
+    62, -6, 63, 1, 58, -164, 1, -41, 2, 79, 3, 35, 4, 50, 5, 23,
+    6, -6, 7, -8, 8, -19, 9, 27, 10, 15, 11, -23, 13, -16, 14, -1,
+    15, 5, 16, -22, 17, 11, 18, 34, 19, -9, 20, -22, 21, -6, 22, -2,
+    23, 2, 24, 95, 25, -4, 26, -75, 27, 3, 29, 2, 30, 5, 31, -1,
+    32, 50, 33, -8, 34, -26, 35, 7, 36, -17, 37, 5, 38, 2, 39, -2,
+    40, 63, 41, -3, 42, -50, 43, 2, 45, 2, 46, 4, 47, -1, 48, -9,
+    49, 4, 50, 14, 51, -4, 52, -9, 53, -3, 54, -1, 55, 1, 56, -4,
+    57, 5, 58, 3, 59, -5, 61, -3, 63, 1, 57, 154, 1, 37, 2, -72,
+    3, -32, 4, -46, 5, -21, 6, 5, 7, 7, 8, 18, 9, -25, 10, -14,
+    11, 21, 13, 14, 14, 1, 15, -5, 16, 20, 17, -10, 18, -31, 19, 8,
+    20, 20, 21, 6, 22, 2, 23, -2, 24, -87, 25, 4, 26, 68, 27, -3,
+    29, -2, 30, -5, 31, 1, 32, -46, 33, 7, 34, 24, 35, -6, 36, 15,
+    37, -4, 38, -2, 39, 1, 40, -58, 41, 2, 42, 46, 43, -2, 45, -1,
+    46, -3, 48, 8, 49, -4, 50, -13, 51, 3, 52, 8, 53, 2, 54, 1,
+    55, -1, 56, 3, 57, -5, 58, -3, 59, 4, 61, 3, 63, -1, 63, -569,
+    1, -144, 2, -163, 3, -4, 4, 160, 5, -2, 6, -67, 7, -29, 8, -39,
+    9, -83, 10, 169, 11, 46, 12, -179, 13, 31, 14, 70, 15, -16, 16, -23,
+    17, -32, 18, 91, 19, -27, 20, -23, 21, -18, 22, 38, 23, -6, 24, -92,
+    25, 128, 26, -89, 27, 10, 28, 26, 29, 7, 30, -37, 31, 26, 32, -53,
+    33, 95, 34, -70, 35, -38, 36, 89, 37, -26, 38, -29, 39, 19, 40, -62,
+    41, 86, 42, -59, 43, 7, 44, 17, 45, 5, 46, -25, 47, 17, 48, -10,
+    49, -13, 50, 38, 51, -11, 52, -10, 53, -8, 54, 16, 55, -3, 56, -8,
+    57, -16, 58, 34, 59, 9, 60, -36, 61, 6, 62, 14, 63, -3, 63, -605,
+    1, 179, 2, -70, 3, -26, 4, 53, 5, -17, 6, -29, 7, 36, 8, -19,
+    9, 34, 10, 78, 11, -5, 12, -60, 13, -3, 14, 32, 15, 7, 16, 23,
+    17, 78, 18, 91, 19, -11, 20, -70, 21, -8, 22, 38, 23, 16, 24, -194,
+    25, -169, 26, -11, 27, 25, 28, 9, 29, 16, 30, -5, 31, -34, 32, 53,
+    33, -60, 34, -163, 35, 9, 36, 125, 37, 6, 38, -67, 39, -12, 40, -129,
+    41, -113, 42, -8, 43, 16, 44, 6, 45, 11, 46, -3, 47, -23, 48, 10,
+    49, 32, 50, 38, 51, -5, 52, -29, 53, -3, 54, 16, 55, 6, 56, -4,
+    57, 7, 58, 16, 59, -1, 60, -12, 61, -1, 62, 6, 63, 1, 57, -147,
+    1, -12, 2, 71, 3, 5, 4, 42, 5, 15, 6, -2, 7, -4, 8, 14,
+    9, 10, 10, 26, 11, -1, 12, -44, 13, -18, 14, -6, 15, 4, 17, 6,
+    18, 24, 19, -12, 20, -33, 21, 8, 22, 2, 23, -1, 24, 67, 25, -19,
+    26, -66, 27, 22, 28, 18, 29, 1, 30, 2, 31, -2, 33, 21, 34, -34,
+    35, -23, 36, 42, 37, -3, 38, 5, 39, 2, 40, 45, 41, -13, 42, -44,
+    43, 15, 44, 12, 46, 1, 47, -1, 49, 2, 50, 10, 51, -5, 52, -14,
+    53, 3, 54, 1, 56, 3, 57, 2, 58, 5, 60, -9, 61, -3, 62, -1,
+    63, 1, 57, 139, 1, 11, 2, -65, 3, -4, 4, -38, 5, -14, 6, 2,
+    7, 4, 8, -12, 9, -9, 10, -24, 11, 1, 12, 40, 13, 16, 14, 5,
+    15, -4, 17, -5, 18, -22, 19, 11, 20, 30, 21, -7, 22, -2, 23, 1,
+    24, -61, 25, 17, 26, 60, 27, -20, 28, -16, 29, -1, 30, -1, 31, 2,
+    33, -19, 34, 31, 35, 21, 36, -38, 37, 3, 38, -5, 39, -2, 40, -41,
+    41, 11, 42, 40, 43, -14, 44, -11, 46, -1, 47, 1, 49, -2, 50, -9,
+    51, 4, 52, 12, 53, -3, 54, -1, 56, -2, 57, -2, 58, -5, 60, 8,
+    61, 3, 62, 1, 63, -1, 63, -569, 1, -60, 2, -303, 3, 9, 4, 232,
+    5, 6, 6, -125, 7, -12, 8, -124, 9, 83, 10, 32, 11, -12, 12, -25,
+    13, -8, 14, 13, 15, 16, 16, 23, 17, -78, 18, 91, 19, 11, 20, -70,
+    21, 8, 22, 38, 23, -16, 24, -105, 25, 70, 26, 27, 27, -10, 28, -21,
+    29, -7, 30, 11, 31, 14, 32, 18, 33, -60, 34, 70, 35, 9, 36, -53,
+    37, 6, 38, 29, 39, -12, 40, -70, 41, 47, 42, 18, 43, -7, 44, -14,
+    45, -5, 46, 8, 47, 9, 48, 10, 49, -32, 50, 38, 51, 5, 52, -29,
+    53, 3, 54, 16, 55, -6, 56, -25, 57, 16, 58, 6, 59, -2, 60, -5,
+    61, -2, 62, 3, 63, 3, 63, -569, 1, 60, 2, -303, 3, -9, 4, 232,
+    5, -6, 6, -125, 7, 12, 8, -124, 9, -83, 10, 32, 11, 12, 12, -25,
+    13, 8, 14, 13, 15, -16, 16, 23, 17, 78, 18, 91, 19, -11, 20, -70,
+    21, -8, 22, 38, 23, 16, 24, -105, 25, -70, 26, 27, 27, 10, 28, -21,
+    29, 7, 30, 11, 31, -14, 32, 18, 33, 60, 34, 70, 35, -9, 36, -53,
+    37, -6, 38, 29, 39, 12, 40, -70, 41, -47, 42, 18, 43, 7, 44, -14,
+    45, 5, 46, 8, 47, -9, 48, 10, 49, 32, 50, 38, 51, -5, 52, -29,
+    53, -3, 54, 16, 55, 6, 56, -25, 57, -16, 58, 6, 59, 2, 60, -5,
+    61, 2, 62, 3, 63, -3, 31, -156, 2, 26, 4, 109, 6, -2, 8, 58,
+    10, -37, 12, -12, 14, 3, 16, -11, 18, 34, 20, -33, 22, -2, 24, 49,
+    26, -31, 28, -10, 30, 2, 32, -8, 34, 26, 36, -25, 38, -2, 40, 33,
+    42, -21, 44, -7, 46, 1, 48, -5, 50, 14, 52, -14, 54, -1, 56, 12,
+    58, -7, 60, -2, 62, 1, 30, 147, 2, -24, 4, -99, 6, 2, 8, -53,
+    10, 33, 12, 11, 14, -2, 16, 10, 18, -31, 20, 30, 22, 2, 24, -45,
+    26, 28, 28, 9, 30, -2, 32, 8, 34, -24, 36, 23, 38, 2, 40, -30,
+    42, 19, 44, 6, 46, -1, 48, 4, 50, -13, 52, 12, 54, 1, 56, -11,
+    58, 7, 60, 2, 63, -676, 1, -243, 2, 163, 3, -87, 4, 53, 5, -58,
+    6, 67, 7, -48, 8, 45, 9, -34, 10, -32, 11, 87, 12, -95, 13, 58,
+    14, -13, 15, -7, 16, -23, 17, 32, 18, -30, 19, 27, 20, -23, 21, 18,
+    22, -13, 23, 6, 24, -80, 25, 87, 26, -27, 27, -25, 28, 38, 29, -16,
+    30, -11, 31, 17, 32, -89, 33, 95, 34, -23, 35, -38, 36, 53, 37, -26,
+    38, -10, 39, 19, 40, -54, 41, 58, 42, -18, 43, -16, 44, 26, 45, -11,
+    46, -8, 47, 12, 48, -10, 49, 13, 50, -13, 51, 11, 52, -10, 53, 8,
+    54, -5, 55, 3, 56, 9, 57, -7, 58, -6, 59, 17, 60, -19, 61, 12,
+    62, -3, 63, -1, 63, -676, 1, 243, 2, 163, 3, 87, 4, 53, 5, 58,
+    6, 67, 7, 48, 8, 45, 9, 34, 10, -32, 11, -87, 12, -95, 13, -58,
+    14, -13, 15, 7, 16, -23, 17, -32, 18, -30, 19, -27, 20, -23, 21, -18,
+    22, -13, 23, -6, 24, -80, 25, -87, 26, -27, 27, 25, 28, 38, 29, 16,
+    30, -11, 31, -17, 32, -89, 33, -95, 34, -23, 35, 38, 36, 53, 37, 26,
+    38, -10, 39, -19, 40, -54, 41, -58, 42, -18, 43, 16, 44, 26, 45, 11,
+    46, -8, 47, -12, 48, -10, 49, -13, 50, -13, 51, -11, 52, -10, 53, -8,
+    54, -5, 55, -3, 56, 9, 57, 7, 58, -6, 59, -17, 60, -19, 61, -12,
+    62, -3, 63, 1, 31, -105, 2, 107, 4, -59, 6, 19, 8, -21, 10, 15,
+    12, 12, 14, -19, 16, 11, 18, -14, 20, 11, 22, -6, 24, 38, 26, -39,
+    28, 10, 30, 5, 32, 42, 34, -42, 36, 8, 38, 8, 40, 25, 42, -26,
+    44, 7, 46, 4, 48, 5, 50, -6, 52, 5, 54, -2, 56, -4, 58, 3,
+    60, 2, 62, -4, 31, 101, 2, -98, 4, 53, 6, -17, 8, 19, 10, -14,
+    12, -11, 14, 17, 16, -10, 18, 13, 20, -10, 22, 5, 24, -34, 26, 35,
+    28, -9, 30, -5, 32, -38, 34, 38, 36, -8, 38, -8, 40, -23, 42, 23,
+    44, -6, 46, -3, 48, -4, 50, 5, 52, -4, 54, 2, 56, 4, 58, -3,
+    60, -2, 62, 3, 47, -837, 1, -49, 2, 47, 3, -42, 4, 36, 5, -28,
+    6, 19, 7, -10, 8, 35, 9, -48, 10, 46, 11, -41, 12, 35, 13, -27,
+    14, 19, 15, -10, 24, -30, 25, 41, 26, -39, 27, 35, 28, -30, 29, 23,
+    30, -16, 31, 8, 32, -36, 33, 49, 34, -47, 35, 42, 36, -36, 37, 28,
+    38, -19, 39, 10, 40, -20, 41, 27, 42, -26, 43, 23, 44, -20, 45, 16,
+    46, -11, 47, 5, 56, 7, 57, -10, 58, 9, 59, -8, 60, 7, 61, -5,
+    62, 4, 63, -2, 51, -516, 1, 294, 2, -47, 3, -165, 4, -143, 5, -111,
+    6, -19, 7, 58, 8, 55, 10, -46, 11, 82, 12, 154, 13, 55, 14, -19,
+    16, -47, 17, -46, 19, 39, 20, 47, 21, 26, 23, -9, 24, -131, 25, -82,
+    26, 39, 28, -47, 30, 16, 31, -16, 32, -143, 33, -84, 34, 47, 35, -12,
+    36, -71, 37, -8, 38, 19, 39, -17, 40, -87, 41, -55, 42, 26, 44, -31,
+    46, 11, 47, -11, 48, -19, 49, -19, 51, 16, 52, 19, 53, 11, 55, -4,
+    56, 11, 58, -9, 59, 16, 60, 31, 61, 11, 62, -4, 52, -105, 1, 47,
+    2, 76, 3, -77, 5, 33, 6, -13, 7, -3, 8, -21, 9, 10, 10, 11,
+    11, -1, 13, -18, 14, 13, 15, 4, 16, 11, 17, -6, 18, -10, 19, 12,
+    21, -8, 22, 4, 23, 1, 24, 38, 25, -19, 26, -27, 27, 22, 29, 1,
+    30, -4, 31, -2, 32, 42, 33, -21, 34, -30, 35, 23, 37, 3, 38, -6,
+    39, -2, 40, 25, 41, -13, 42, -18, 43, 15, 46, -3, 47, -1, 48, 5,
+    49, -2, 50, -4, 51, 5, 53, -3, 54, 2, 56, -4, 57, 2, 58, 2,
+    61, -3, 62, 3, 63, 1, 52, 101, 1, -43, 2, -69, 3, 71, 5, -30,
+    6, 12, 7, 3, 8, 19, 9, -9, 10, -10, 11, 1, 13, 16, 14, -12,
+    15, -4, 16, -10, 17, 5, 18, 9, 19, -11, 21, 7, 22, -4, 23, -1,
+    24, -34, 25, 17, 26, 25, 27, -20, 29, -1, 30, 3, 31, 2, 32, -38,
+    33, 19, 34, 27, 35, -21, 37, -3, 38, 5, 39, 2, 40, -23, 41, 11,
+    42, 17, 43, -14, 46, 2, 47, 1, 48, -4, 49, 2, 50, 4, 51, -4,
+    53, 3, 54, -2, 56, 4, 57, -2, 58, -2, 61, 3, 62, -2, 63, -1,
+    51, -552, 1, -84, 2, -279, 3, -12, 4, 249, 5, -8, 6, -116, 7, -17,
+    8, -134, 9, 97, 10, 19, 12, -35, 14, 8, 15, 19, 17, -46, 18, 61,
+    19, 39, 20, -93, 21, 26, 22, 25, 23, -9, 24, -54, 26, 93, 27, -70,
+    28, 30, 29, -47, 30, 39, 32, -36, 33, 14, 35, 72, 36, -107, 37, 48,
+    39, 3, 40, -36, 42, 62, 43, -47, 44, 20, 45, -31, 46, 26, 49, -19,
+    50, 25, 51, 16, 52, -39, 53, 11, 54, 10, 55, -4, 56, -27, 57, 19,
+    58, 4, 60, -7, 62, 2, 63, 4, 59, -694, 1, 119, 2, -47, 3, -17,
+    4, 36, 5, -12, 6, -19, 7, 24, 8, 35, 9, -48, 10, -137, 11, -41,
+    12, 35, 13, -27, 14, -57, 15, -10, 16, -93, 17, -91, 19, 77, 20, 93,
+    21, 52, 23, -18, 24, -30, 25, 41, 26, 116, 27, 35, 28, -30, 29, 23,
+    30, 48, 31, 8, 32, -36, 33, 20, 34, 47, 35, -101, 36, -178, 37, -68,
+    38, 19, 39, 4, 40, -20, 41, 27, 42, 78, 43, 23, 44, -20, 45, 16,
+    46, 32, 47, 5, 48, -39, 49, -38, 51, 32, 52, 39, 53, 21, 55, -8,
+    56, 7, 57, -10, 58, -27, 59, -8, 60, 7, 61, -5, 62, -11, 63, -2,
+    63, -130, 1, -37, 2, 45, 3, 26, 4, 59, 5, 29, 6, -1, 7, -9,
+    8, 23, 9, 34, 10, -32, 11, -36, 12, 21, 13, -7, 14, -4, 15, 4,
+    16, 22, 17, -7, 18, -10, 19, 27, 20, -11, 21, -30, 22, 4, 23, 6,
+    24, 20, 25, 1, 26, 9, 27, -7, 28, -38, 29, 9, 30, 11, 31, -2,
+    32, 17, 33, -4, 34, 1, 35, -2, 36, -8, 37, 11, 38, -19, 39, -3,
+    40, 13, 41, 1, 42, 6, 43, -5, 44, -25, 45, 6, 46, 8, 47, -1,
+    48, 9, 49, -3, 50, -4, 51, 11, 52, -5, 53, -12, 54, 2, 55, 2,
+    56, 5, 57, 7, 58, -6, 59, -7, 60, 4, 61, -1, 62, -1, 63, 1,
+    63, 124, 1, 33, 2, -41, 3, -23, 4, -53, 5, -27, 6, 1, 7, 8,
+    8, -21, 9, -31, 10, 29, 11, 33, 12, -19, 13, 7, 14, 4, 15, -4,
+    16, -20, 17, 6, 18, 9, 19, -24, 20, 10, 21, 27, 22, -4, 23, -5,
+    24, -18, 25, -1, 26, -8, 27, 7, 28, 34, 29, -9, 30, -10, 31, 2,
+    32, -15, 33, 3, 34, -1, 35, 2, 36, 8, 37, -10, 38, 17, 39, 2,
+    40, -12, 41, -1, 42, -6, 43, 4, 44, 23, 45, -6, 46, -7, 47, 1,
+    48, -8, 49, 3, 50, 4, 51, -10, 52, 4, 53, 11, 54, -2, 55, -2,
+    56, -4, 57, -6, 58, 6, 59, 7, 60, -4, 61, 1, 62, 1, 63, -1,
+    31, -623, 2, -326, 4, 249, 6, -135, 8, -49, 10, 65, 12, -49, 14, 27,
+    16, -47, 18, 61, 20, -47, 22, 25, 24, -42, 26, 55, 28, -42, 30, 23,
+    32, -36, 34, 47, 36, -36, 38, 19, 40, -28, 42, 37, 44, -28, 46, 15,
+    48, -19, 50, 25, 52, -19, 54, 10, 56, -10, 58, 13, 60, -10, 62, 5,
+    0, -872, 46, -72, 1, -57, 3, 49, 4, 59, 5, 33, 7, -11, 8, 12,
+    9, 11, 11, -10, 12, -12, 13, -6, 15, 2, 16, 11, 17, 11, 19, -9,
+    20, -11, 21, -6, 23, 2, 24, 10, 25, 10, 27, -8, 28, -10, 29, -5,
+    31, 2, 32, 8, 33, 8, 35, -7, 36, -8, 37, -5, 39, 2, 40, 7,
+    41, 6, 43, -5, 44, -7, 45, -4, 47, 1, 48, 5, 49, 4, 51, -4,
+    52, -5, 53, -3, 55, 1, 56, 2, 57, 2, 59, -2, 60, -2, 61, -1,
+    46, 71, 1, 52, 3, -44, 4, -53, 5, -30, 7, 10, 8, -11, 9, -10,
+    11, 9, 12, 11, 13, 6, 15, -2, 16, -10, 17, -10, 19, 8, 20, 10,
+    21, 6, 23, -2, 24, -9, 25, -9, 27, 7, 28, 9, 29, 5, 31, -2,
+    32, -8, 33, -7, 35, 6, 36, 8, 37, 4, 39, -1, 40, -6, 41, -6,
+    43, 5, 44, 6, 45, 3, 47, -1, 48, -4, 49, -4, 51, 3, 52, 4,
+    53, 2, 55, -1, 56, -2, 57, -2, 59, 2, 60, 2, 61, 1, 63, -498,
+    1, -144, 2, -256, 3, -4, 4, 232, 5, -2, 6, -106, 7, -29, 8, -109,
+    9, 83, 10, -13, 11, 70, 12, -109, 13, 47, 14, -6, 15, 16, 16, -116,
+    17, 59, 18, 91, 19, -105, 20, 70, 21, -70, 22, 38, 23, 12, 24, -33,
+    25, -12, 26, 66, 27, -10, 28, -33, 29, -7, 30, 27, 31, -2, 32, 18,
+    33, -45, 34, 23, 35, 80, 36, -125, 37, 54, 38, 10, 39, -9, 40, -22,
+    41, -8, 42, 44, 43, -7, 44, -22, 45, -5, 46, 18, 47, -2, 48, -48,
+    49, 24, 50, 38, 51, -43, 52, 29, 53, -29, 54, 16, 55, 5, 56, -22,
+    57, 16, 58, -3, 59, 14, 60, -22, 61, 9, 62, -1, 63, 3, 63, -498,
+    1, 144, 2, -256, 3, 4, 4, 232, 5, 2, 6, -106, 7, 29, 8, -109,
+    9, -83, 10, -13, 11, -70, 12, -109, 13, -47, 14, -6, 15, -16, 16, -116,
+    17, -59, 18, 91, 19, 105, 20, 70, 21, 70, 22, 38, 23, -12, 24, -33,
+    25, 12, 26, 66, 27, 10, 28, -33, 29, 7, 30, 27, 31, 2, 32, 18,
+    33, 45, 34, 23, 35, -80, 36, -125, 37, -54, 38, 10, 39, 9, 40, -22,
+    41, 8, 42, 44, 43, 7, 44, -22, 45, 5, 46, 18, 47, 2, 48, -48,
+    49, -24, 50, 38, 51, 43, 52, 29, 53, 29, 54, 16, 55, -5, 56, -22,
+    57, -16, 58, -3, 59, -14, 60, -22, 61, -9, 62, -1, 63, -3, 31, -189,
+    2, 64, 4, 92, 6, 1, 8, 51, 10, -37, 12, 5, 14, -15, 16, 55,
+    18, -26, 20, -33, 22, 23, 24, 16, 26, 5, 28, -24, 30, 2, 32, -8,
+    34, 20, 36, -8, 38, -17, 40, 10, 42, 4, 44, -16, 46, 1, 48, 23,
+    50, -11, 52, -14, 54, 9, 56, 10, 58, -7, 60, 1, 62, -3, 31, 177,
+    2, -58, 4, -84, 6, -1, 8, -47, 10, 33, 12, -4, 14, 14, 16, -50,
+    18, 24, 20, 30, 22, -21, 24, -14, 26, -5, 28, 22, 30, -2, 32, 8,
+    34, -18, 36, 8, 38, 16, 40, -9, 42, -3, 44, 14, 46, -1, 48, -21,
+    50, 10, 52, 12, 54, -9, 56, -9, 58, 7, 60, -1, 62, 3, 63, -534,
+    1, -95, 2, -303, 3, 38, 4, 196, 5, 26, 6, -125, 7, -19, 8, -144,
+    9, 103, 10, 32, 11, -29, 12, -4, 13, -19, 14, 13, 15, 20, 16, -23,
+    17, -32, 18, 91, 19, -27, 20, -23, 21, -18, 22, 38, 23, -6, 24, -4,
+    25, -29, 26, 27, 27, 74, 28, -122, 29, 49, 30, 11, 31, -6, 32, -89,
+    33, 45, 34, 70, 35, -80, 36, 53, 37, -54, 38, 29, 39, 9, 40, -2,
+    41, -19, 42, 18, 43, 49, 44, -82, 45, 33, 46, 8, 47, -4, 48, -10,
+    49, -13, 50, 38, 51, -11, 52, -10, 53, -8, 54, 16, 55, -3, 56, -29,
+    57, 20, 58, 6, 59, -6, 60, -1, 61, -4, 62, 3, 63, 4, 63, -605,
+    1, 25, 2, -303, 3, 21, 4, 267, 5, 14, 6, -125, 7, 5, 8, -74,
+    9, -34, 10, 32, 11, -29, 12, -74, 13, -19, 14, 13, 15, -7, 16, -23,
+    17, 32, 18, 91, 19, 27, 20, -23, 21, 18, 22, 38, 23, 6, 24, -63,
+    25, -29, 26, 27, 27, -25, 28, -63, 29, -16, 30, 11, 31, -6, 32, -18,
+    33, 25, 34, 70, 35, 21, 36, -18, 37, 14, 38, 29, 39, 5, 40, -42,
+    41, -19, 42, 18, 43, -16, 44, -42, 45, -11, 46, 8, 47, -4, 48, -10,
+    49, 13, 50, 38, 51, 11, 52, -10, 53, 8, 54, 16, 55, 3, 56, -15,
+    57, -7, 58, 6, 59, -6, 60, -15, 61, -4, 62, 3, 63, -1, 50, -156,
+    1, -9, 2, 26, 3, 18, 4, 109, 5, -12, 6, -2, 7, 2, 8, 51,
+    9, 9, 10, -30, 11, -18, 12, -12, 13, 12, 15, -2, 16, 11, 18, 14,
+    20, -33, 22, 6, 24, 16, 25, -7, 27, 15, 28, -10, 29, -10, 30, -11,
+    31, 1, 32, 25, 33, 9, 34, -5, 35, -18, 36, -25, 37, 12, 38, 11,
+    39, -2, 40, 10, 41, -5, 43, 10, 44, -7, 45, -7, 46, -7, 47, 1,
+    48, 5, 50, 6, 52, -14, 54, 2, 56, 10, 57, 2, 58, -6, 59, -4,
+    60, -2, 61, 2, 50, 147, 1, 8, 2, -24, 3, -17, 4, -99, 5, 11,
+    6, 2, 7, -2, 8, -47, 9, -8, 10, 28, 11, 16, 12, 11, 13, -11,
+    15, 2, 16, -10, 18, -13, 20, 30, 22, -5, 24, -14, 25, 7, 27, -14,
+    28, 9, 29, 9, 30, 10, 31, -1, 32, -23, 33, -8, 34, 4, 35, 17,
+    36, 23, 37, -11, 38, -10, 39, 2, 40, -9, 41, 4, 43, -9, 44, 6,
+    45, 6, 46, 6, 47, -1, 48, -4, 50, -5, 52, 12, 54, -2, 56, -9,
+    57, -2, 58, 5, 59, 3, 60, 2, 61, -2, 55, -587, 1, -119, 2, -186,
+    3, 17, 4, 143, 5, 12, 6, -77, 7, -24, 8, -14, 9, -117, 10, 202,
+    11, 17, 12, -154, 13, 11, 14, 83, 15, -23, 16, -47, 18, 61, 20, -47,
+    22, 25, 24, -72, 25, 99, 26, -61, 27, -14, 28, 47, 29, -10, 30, -25,
+    31, 20, 32, -71, 33, 119, 34, -93, 35, -17, 36, 71, 37, -12, 38, -39,
+    39, 24, 40, -48, 41, 66, 42, -41, 43, -10, 44, 31, 45, -6, 46, -17,
+    47, 13, 48, -19, 50, 25, 52, -19, 54, 10, 56, -3, 57, -23, 58, 40,
+    59, 3, 60, -31, 61, 2, 62, 17, 63, -5, 55, -587, 1, 119, 2, -186,
+    3, -17, 4, 143, 5, -12, 6, -77, 7, 24, 8, -14, 9, 117, 10, 202,
+    11, -17, 12, -154, 13, -11, 14, 83, 15, 23, 16, -47, 18, 61, 20, -47,
+    22, 25, 24, -72, 25, -99, 26, -61, 27, 14, 28, 47, 29, 10, 30, -25,
+    31, -20, 32, -71, 33, -119, 34, -93, 35, 17, 36, 71, 37, 12, 38, -39,
+    39, -24, 40, -48, 41, -66, 42, -41, 43, 10, 44, 31, 45, 6, 46, -17,
+    47, -13, 48, -19, 50, 25, 52, -19, 54, 10, 56, -3, 57, 23, 58, 40,
+    59, -3, 60, -31, 61, -2, 62, 17, 63, 5, 27, -147, 2, 53, 4, 67,
+    6, -4, 8, 7, 10, 52, 12, -72, 14, -4, 16, 22, 20, -22, 24, 34,
+    26, -44, 28, 22, 30, 3, 32, 33, 34, -53, 36, 33, 38, 4, 40, 22,
+    42, -29, 44, 15, 46, 2, 48, 9, 52, -9, 56, 1, 58, 10, 60, -14,
+    62, -1, 27, 139, 2, -48, 4, -61, 6, 3, 8, -6, 10, -47, 12, 66,
+    14, 3, 16, -20, 20, 20, 24, -31, 26, 40, 28, -20, 30, -3, 32, -30,
+    34, 48, 36, -30, 38, -3, 40, -20, 42, 27, 44, -13, 46, -2, 48, -8,
+    52, 8, 56, -1, 58, -9, 60, 13, 62, 1, 63, -463, 1, -179, 2, -256,
+    3, 26, 4, 196, 5, 17, 6, -106, 7, -36, 8, -19, 9, -34, 10, 78,
+    11, 5, 12, -60, 13, 3, 14, 32, 15, -7, 16, 23, 17, -78, 18, 91,
+    19, 11, 20, -70, 21, 8, 22, 38, 23, -16, 24, -194, 25, 169, 26, -11,
+    27, -25, 28, 9, 29, -16, 30, -5, 31, 34, 32, -89, 33, 60, 34, 23,
+    35, -9, 36, -18, 37, -6, 38, 10, 39, 12, 40, -129, 41, 113, 42, -8,
+    43, -16, 44, 6, 45, -11, 46, -3, 47, 23, 48, 10, 49, -32, 50, 38,
+    51, 5, 52, -29, 53, 3, 54, 16, 55, -6, 56, -4, 57, -7, 58, 16,
+    59, 1, 60, -12, 61, 1, 62, 6, 63, -1, 63, -569, 1, 179, 2, -116,
+    3, -26, 4, 89, 5, -17, 6, -48, 7, 36, 8, -39, 9, 34, 10, 105,
+    11, -5, 12, -80, 13, -3, 14, 43, 15, 7, 16, -23, 17, 78, 18, 152,
+    19, -11, 20, -116, 21, -8, 22, 63, 23, 16, 24, -92, 25, -169, 26, -143,
+    27, 25, 28, 110, 29, 16, 30, -59, 31, -34, 32, -53, 33, -60, 34, -23,
+    35, 9, 36, 18, 37, 6, 38, -10, 39, -12, 40, -62, 41, -113, 42, -96,
+    43, 16, 44, 73, 45, 11, 46, -40, 47, -23, 48, -10, 49, 32, 50, 63,
+    51, -5, 52, -48, 53, -3, 54, 26, 55, 6, 56, -8, 57, 7, 58, 21,
+    59, -1, 60, -16, 61, -1, 62, 9, 63, 1, 58, -181, 1, -25, 2, 79,
+    3, 21, 4, 67, 5, 14, 6, -6, 7, -5, 8, 14, 9, -5, 10, 15,
+    11, 4, 12, -33, 13, 3, 14, -1, 15, -1, 17, -11, 18, 34, 19, 9,
+    20, -44, 21, 6, 22, -2, 23, -2, 24, 67, 25, 23, 26, -75, 27, -20,
+    28, 28, 29, -13, 30, 5, 31, 5, 32, 33, 33, 8, 34, -26, 35, -7,
+    37, -5, 38, 2, 39, 2, 40, 45, 41, 16, 42, -50, 43, -13, 44, 19,
+    45, -9, 46, 4, 47, 3, 49, -4, 50, 14, 51, 4, 52, -18, 53, 3,
+    54, -1, 55, -1, 56, 3, 57, -1, 58, 3, 59, 1, 60, -7, 61, 1,
+    57, 170, 1, 22, 2, -72, 3, -19, 4, -61, 5, -13, 6, 5, 7, 4,
+    8, -12, 9, 4, 10, -14, 11, -4, 12, 30, 13, -2, 14, 1, 15, 1,
+    17, 10, 18, -31, 19, -8, 20, 40, 21, -6, 22, 2, 23, 2, 24, -61,
+    25, -21, 26, 68, 27, 18, 28, -25, 29, 12, 30, -5, 31, -4, 32, -30,
+    33, -7, 34, 24, 35, 6, 37, 4, 38, -2, 39, -1, 40, -41, 41, -14,
+    42, 46, 43, 12, 44, -17, 45, 8, 46, -3, 47, -3, 49, 4, 50, -13,
+    51, -3, 52, 16, 53, -2, 54, 1, 55, 1, 56, -2, 57, 1, 58, -3,
+    59, -1, 60, 6, 55, -587, 1, -119, 2, -186, 3, 17, 4, 143, 5, 12,
+    6, -77, 7, -24, 8, -14, 9, -117, 10, 202, 11, 17, 12, -154, 13, 11,
+    14, 83, 15, -23, 16, -47, 18, 61, 20, -47, 22, 25, 24, -72, 25, 99,
+    26, -61, 27, -14, 28, 47, 29, -10, 30, -25, 31, 20, 32, -71, 33, 119,
+    34, -93, 35, -17, 36, 71, 37, -12, 38, -39, 39, 24, 40, -48, 41, 66,
+    42, -41, 43, -10, 44, 31, 45, -6, 46, -17, 47, 13, 48, -19, 50, 25,
+    52, -19, 54, 10, 56, -3, 57, -23, 58, 40, 59, 3, 60, -31, 61, 2,
+    62, 17, 63, -5, 55, -587, 1, 119, 2, -186, 3, -17, 4, 143, 5, -12,
+    6, -77, 7, 24, 8, -14, 9, 117, 10, 202, 11, -17, 12, -154, 13, -11,
+    14, 83, 15, 23, 16, -47, 18, 61, 20, -47, 22, 25, 24, -72, 25, -99,
+    26, -61, 27, 14, 28, 47, 29, 10, 30, -25, 31, -20, 32, -71, 33, -119,
+    34, -93, 35, 17, 36, 71, 37, 12, 38, -39, 39, -24, 40, -48, 41, -66,
+    42, -41, 43, 10, 44, 31, 45, 6, 46, -17, 47, -13, 48, -19, 50, 25,
+    52, -19, 54, 10, 56, -3, 57, 23, 58, 40, 59, -3, 60, -31, 61, -2,
+    62, 17, 63, 5, 27, -147, 2, 53, 4, 67, 6, -4, 8, 7, 10, 52,
+    12, -72, 14, -4, 16, 22, 20, -22, 24, 34, 26, -44, 28, 22, 30, 3,
+    32, 33, 34, -53, 36, 33, 38, 4, 40, 22, 42, -29, 44, 15, 46, 2,
+    48, 9, 52, -9, 56, 1, 58, 10, 60, -14, 62, -1, 27, 139, 2, -48,
+    4, -61, 6, 3, 8, -6, 10, -47, 12, 66, 14, 3, 16, -20, 20, 20,
+    24, -31, 26, 40, 28, -20, 30, -3, 32, -30, 34, 48, 36, -30, 38, -3,
+    40, -20, 42, 27, 44, -13, 46, -2, 48, -8, 52, 8, 56, -1, 58, -9,
+    60, 13, 62, 1, 63, -463, 1, -179, 2, -256, 3, 26, 4, 196, 5, 17,
+    6, -106, 7, -36, 8, -19, 9, -34, 10, 78, 11, 5, 12, -60, 13, 3,
+    14, 32, 15, -7, 16, 23, 17, -78, 18, 91, 19, 11, 20, -70, 21, 8,
+    22, 38, 23, -16, 24, -194, 25, 169, 26, -11, 27, -25, 28, 9, 29, -16,
+    30, -5, 31, 34, 32, -89, 33, 60, 34, 23, 35, -9, 36, -18, 37, -6,
+    38, 10, 39, 12, 40, -129, 41, 113, 42, -8, 43, -16, 44, 6, 45, -11,
+    46, -3, 47, 23, 48, 10, 49, -32, 50, 38, 51, 5, 52, -29, 53, 3,
+    54, 16, 55, -6, 56, -4, 57, -7, 58, 16, 59, 1, 60, -12, 61, 1,
+    62, 6, 63, -1, 63, -569, 1, 179, 2, -116, 3, -26, 4, 89, 5, -17,
+    6, -48, 7, 36, 8, -39, 9, 34, 10, 105, 11, -5, 12, -80, 13, -3,
+    14, 43, 15, 7, 16, -23, 17, 78, 18, 152, 19, -11, 20, -116, 21, -8,
+    22, 63, 23, 16, 24, -92, 25, -169, 26, -143, 27, 25, 28, 110, 29, 16,
+    30, -59, 31, -34, 32, -53, 33, -60, 34, -23, 35, 9, 36, 18, 37, 6,
+    38, -10, 39, -12, 40, -62, 41, -113, 42, -96, 43, 16, 44, 73, 45, 11,
+    46, -40, 47, -23, 48, -10, 49, 32, 50, 63, 51, -5, 52, -48, 53, -3,
+    54, 26, 55, 6, 56, -8, 57, 7, 58, 21, 59, -1, 60, -16, 61, -1,
+    62, 9, 63, 1, 58, -181, 1, -25, 2, 79, 3, 21, 4, 67, 5, 14,
+    6, -6, 7, -5, 8, 14, 9, -5, 10, 15, 11, 4, 12, -33, 13, 3,
+    14, -1, 15, -1, 17, -11, 18, 34, 19, 9, 20, -44, 21, 6, 22, -2,
+    23, -2, 24, 67, 25, 23, 26, -75, 27, -20, 28, 28, 29, -13, 30, 5,
+    31, 5, 32, 33, 33, 8, 34, -26, 35, -7, 37, -5, 38, 2, 39, 2,
+    40, 45, 41, 16, 42, -50, 43, -13, 44, 19, 45, -9, 46, 4, 47, 3,
+    49, -4, 50, 14, 51, 4, 52, -18, 53, 3, 54, -1, 55, -1, 56, 3,
+    57, -1, 58, 3, 59, 1, 60, -7, 61, 1, 57, 170, 1, 22, 2, -72,
+    3, -19, 4, -61, 5, -13, 6, 5, 7, 4, 8, -12, 9, 4, 10, -14,
+    11, -4, 12, 30, 13, -2, 14, 1, 15, 1, 17, 10, 18, -31, 19, -8,
+    20, 40, 21, -6, 22, 2, 23, 2, 24, -61, 25, -21, 26, 68, 27, 18,
+    28, -25, 29, 12, 30, -5, 31, -4, 32, -30, 33, -7, 34, 24, 35, 6,
+    37, 4, 38, -2, 39, -1, 40, -41, 41, -14, 42, 46, 43, 12, 44, -17,
+    45, 8, 46, -3, 47, -3, 49, 4, 50, -13, 51, -3, 52, 16, 53, -2,
+    54, 1, 55, 1, 56, -2, 57, 1, 58, -3, 59, -1, 60, 6, 63, -569,
+    1, -179, 2, -116, 3, 26, 4, 89, 5, 17, 6, -48, 7, -36, 8, -39,
+    9, -34, 10, 105, 11, 5, 12, -80, 13, 3, 14, 43, 15, -7, 16, -23,
+    17, -78, 18, 152, 19, 11, 20, -116, 21, 8, 22, 63, 23, -16, 24, -92,
+    25, 169, 26, -143, 27, -25, 28, 110, 29, -16, 30, -59, 31, 34, 32, -53,
+    33, 60, 34, -23, 35, -9, 36, 18, 37, -6, 38, -10, 39, 12, 40, -62,
+    41, 113, 42, -96, 43, -16, 44, 73, 45, -11, 46, -40, 47, 23, 48, -10,
+    49, -32, 50, 63, 51, 5, 52, -48, 53, 3, 54, 26, 55, -6, 56, -8,
+    57, -7, 58, 21, 59, 1, 60, -16, 61, 1, 62, 9, 63, -1, 63, -641,
+    1, 179, 2, -23, 3, -26, 4, 18, 5, -17, 6, -10, 7, 36, 8, 101,
+    9, 34, 10, -78, 11, -5, 12, 60, 13, -3, 14, -32, 15, 7, 16, 70,
+    17, 78, 18, 30, 19, -11, 20, -23, 21, -8, 22, 13, 23, 16, 24, -211,
+    25, -169, 26, 11, 27, 25, 28, -9, 29, 16, 30, 5, 31, -34, 32, -125,
+    33, -60, 34, 70, 35, 9, 36, -53, 37, 6, 38, 29, 39, -12, 40, -141,
+    41, -113, 42, 8, 43, 16, 44, -6, 45, 11, 46, 3, 47, -23, 48, 29,
+    49, 32, 50, 13, 51, -5, 52, -10, 53, -3, 54, 5, 55, 6, 56, 20,
+    57, 7, 58, -16, 59, -1, 60, 12, 61, -1, 62, -6, 63, 1, 62, -139,
+    1, -16, 2, 79, 3, 14, 4, 25, 5, 9, 6, -6, 7, -3, 8, -14,
+    9, 32, 10, 15, 11, -27, 12, -5, 13, -18, 14, -1, 15, 6, 16, -11,
+    17, 21, 18, 34, 19, -18, 20, -33, 21, -12, 22, -2, 23, 4, 24, 71,
+    25, -27, 26, -75, 27, 23, 28, 24, 29, 15, 30, 5, 31, -5, 32, 42,
+    33, -16, 34, -26, 35, 14, 36, -8, 37, 9, 38, 2, 39, -3, 40, 48,
+    41, -18, 42, -50, 43, 15, 44, 16, 45, 10, 46, 4, 47, -4, 48, -5,
+    49, 9, 50, 14, 51, -8, 52, -14, 53, -5, 54, -1, 55, 2, 56, -3,
+    57, 6, 58, 3, 59, -5, 60, -1, 61, -4, 63, 1, 62, 132, 1, 15,
+    2, -72, 3, -13, 4, -23, 5, -8, 6, 5, 7, 3, 8, 13, 9, -29,
+    10, -14, 11, 25, 12, 4, 13, 17, 14, 1, 15, -6, 16, 10, 17, -20,
+    18, -31, 19, 17, 20, 30, 21, 11, 22, 2, 23, -4, 24, -65, 25, 25,
+    26, 68, 27, -21, 28, -22, 29, -14, 30, -5, 31, 5, 32, -38, 33, 15,
+    34, 24, 35, -13, 36, 8, 37, -8, 38, -2, 39, 3, 40, -43, 41, 17,
+    42, 46, 43, -14, 44, -14, 45, -9, 46, -3, 47, 3, 48, 4, 49, -8,
+    50, -13, 51, 7, 52, 12, 53, 5, 54, 1, 55, -2, 56, 3, 57, -6,
+    58, -3, 59, 5, 60, 1, 61, 3, 63, -1, 63, -605, 1, -243, 2, 70,
+    3, -87, 4, 125, 5, -58, 6, 29, 7, -48, 8, 115, 9, -34, 10, -124,
+    11, 87, 12, -25, 13, 58, 14, -51, 15, -7, 16, -23, 17, 32, 18, -30,
+    19, 27, 20, -23, 21, 18, 22, -13, 23, 6, 24, -139, 25, 87, 26, 50,
+    27, -25, 28, -21, 29, -16, 30, 21, 31, 17, 32, -160, 33, 95, 34, 70,
+    35, -38, 36, -18, 37, -26, 38, 29, 39, 19, 40, -93, 41, 58, 42, 33,
+    43, -16, 44, -14, 45, -11, 46, 14, 47, 12, 48, -10, 49, 13, 50, -13,
+    51, 11, 52, -10, 53, 8, 54, -5, 55, 3, 56, 23, 57, -7, 58, -25,
+    59, 17, 60, -5, 61, 12, 62, -10, 63, -1, 63, -605, 1, 243, 2, 70,
+    3, 87, 4, 125, 5, 58, 6, 29, 7, 48, 8, 115, 9, 34, 10, -124,
+    11, -87, 12, -25, 13, -58, 14, -51, 15, 7, 16, -23, 17, -32, 18, -30,
+    19, -27, 20, -23, 21, -18, 22, -13, 23, -6, 24, -139, 25, -87, 26, 50,
+    27, 25, 28, -21, 29, 16, 30, 21, 31, -17, 32, -160, 33, -95, 34, 70,
+    35, 38, 36, -18, 37, 26, 38, 29, 39, -19, 40, -93, 41, -58, 42, 33,
+    43, 16, 44, -14, 45, 11, 46, 14, 47, -12, 48, -10, 49, -13, 50, -13,
+    51, -11, 52, -10, 53, -8, 54, -5, 55, -3, 56, 23, 57, 7, 58, -25,
+    59, -17, 60, -5, 61, -12, 62, -10, 63, 1, 31, -139, 2, 107, 4, -25,
+    6, 19, 8, -54, 10, 15, 12, 44, 14, -19, 16, 11, 18, -14, 20, 11,
+    22, -6, 24, 65, 26, -39, 28, -18, 30, 5, 32, 75, 34, -42, 36, -25,
+    38, 8, 40, 44, 42, -26, 44, -12, 46, 4, 48, 5, 50, -6, 52, 5,
+    54, -2, 56, -11, 58, 3, 60, 9, 62, -4, 31, 132, 2, -98, 4, 23,
+    6, -17, 8, 49, 10, -14, 12, -40, 14, 17, 16, -10, 18, 13, 20, -10,
+    22, 5, 24, -60, 26, 35, 28, 16, 30, -5, 32, -69, 34, 38, 36, 23,
+    38, -8, 40, -40, 42, 23, 44, 11, 46, -3, 48, -4, 50, 5, 52, -4,
+    54, 2, 56, 10, 58, -3, 60, -8, 62, 3, 31, -623, 2, -326, 4, 249,
+    6, -135, 8, -49, 10, 65, 12, -49, 14, 27, 16, -47, 18, 61, 20, -47,
+    22, 25, 24, -42, 26, 55, 28, -42, 30, 23, 32, -36, 34, 47, 36, -36,
+    38, 19, 40, -28, 42, 37, 44, -28, 46, 15, 48, -19, 50, 25, 52, -19,
+    54, 10, 56, -10, 58, 13, 60, -10, 62, 5, 31, -623, 2, -326, 4, 249,
+    6, -135, 8, -49, 10, 65, 12, -49, 14, 27, 16, -47, 18, 61, 20, -47,
+    22, 25, 24, -42, 26, 55, 28, -42, 30, 23, 32, -36, 34, 47, 36, -36,
+    38, 19, 40, -28, 42, 37, 44, -28, 46, 15, 48, -19, 50, 25, 52, -19,
+    54, 10, 56, -10, 58, 13, 60, -10, 62, 5, 15, -130, 4, 117, 8, 23,
+    12, -23, 16, 22, 20, -22, 24, 20, 28, -20, 32, 17, 36, -17, 40, 13,
+    44, -13, 48, 9, 52, -9, 56, 5, 60, -5, 15, 124, 4, -107, 8, -21,
+    12, 21, 16, -20, 20, 20, 24, -18, 28, 18, 32, -15, 36, 15, 40, -12,
+    44, 12, 48, -8, 52, 8, 56, -4, 60, 4, 31, -623, 2, -326, 4, 249,
+    6, -135, 8, -49, 10, 65, 12, -49, 14, 27, 16, -47, 18, 61, 20, -47,
+    22, 25, 24, -42, 26, 55, 28, -42, 30, 23, 32, -36, 34, 47, 36, -36,
+    38, 19, 40, -28, 42, 37, 44, -28, 46, 15, 48, -19, 50, 25, 52, -19,
+    54, 10, 56, -10, 58, 13, 60, -10, 62, 5, 31, -623, 2, -326, 4, 249,
+    6, -135, 8, -49, 10, 65, 12, -49, 14, 27, 16, -47, 18, 61, 20, -47,
+    22, 25, 24, -42, 26, 55, 28, -42, 30, 23, 32, -36, 34, 47, 36, -36,
+    38, 19, 40, -28, 42, 37, 44, -28, 46, 15, 48, -19, 50, 25, 52, -19,
+    54, 10, 56, -10, 58, 13, 60, -10, 62, 5, 15, -130, 4, 117, 8, 23,
+    12, -23, 16, 22, 20, -22, 24, 20, 28, -20, 32, 17, 36, -17, 40, 13,
+    44, -13, 48, 9, 52, -9, 56, 5, 60, -5, 15, 124, 4, -107, 8, -21,
+    12, 21, 16, -20, 20, 20, 24, -18, 28, 18, 32, -15, 36, 15, 40, -12,
+    44, 12, 48, -8, 52, 8, 56, -4, 60, 4, 63, -605, 1, -25, 2, -303,
+    3, -21, 4, 267, 5, -14, 6, -125, 7, -5, 8, -74, 9, 34, 10, 32,
+    11, 29, 12, -74, 13, 19, 14, 13, 15, 7, 16, -23, 17, -32, 18, 91,
+    19, -27, 20, -23, 21, -18, 22, 38, 23, -6, 24, -63, 25, 29, 26, 27,
+    27, 25, 28, -63, 29, 16, 30, 11, 31, 6, 32, -18, 33, -25, 34, 70,
+    35, -21, 36, -18, 37, -14, 38, 29, 39, -5, 40, -42, 41, 19, 42, 18,
+    43, 16, 44, -42, 45, 11, 46, 8, 47, 4, 48, -10, 49, -13, 50, 38,
+    51, -11, 52, -10, 53, -8, 54, 16, 55, -3, 56, -15, 57, 7, 58, 6,
+    59, 6, 60, -15, 61, 4, 62, 3, 63, 1, 63, -605, 1, 25, 2, -303,
+    3, 21, 4, 267, 5, 14, 6, -125, 7, 5, 8, -74, 9, -34, 10, 32,
+    11, -29, 12, -74, 13, -19, 14, 13, 15, -7, 16, -23, 17, 32, 18, 91,
+    19, 27, 20, -23, 21, 18, 22, 38, 23, 6, 24, -63, 25, -29, 26, 27,
+    27, -25, 28, -63, 29, -16, 30, 11, 31, -6, 32, -18, 33, 25, 34, 70,
+    35, 21, 36, -18, 37, 14, 38, 29, 39, 5, 40, -42, 41, -19, 42, 18,
+    43, -16, 44, -42, 45, -11, 46, 8, 47, -4, 48, -10, 49, 13, 50, 38,
+    51, 11, 52, -10, 53, 8, 54, 16, 55, 3, 56, -15, 57, -7, 58, 6,
+    59, -6, 60, -15, 61, -4, 62, 3, 63, -1, 31, -139, 2, 11, 4, 109,
+    6, 5, 8, 35, 10, -15, 12, -12, 14, -6, 16, 11, 18, 14, 20, -33,
+    22, 6, 24, 29, 26, -13, 28, -10, 30, -5, 32, 8, 34, 11, 36, -25,
+    38, 5, 40, 20, 42, -9, 44, -7, 46, -4, 48, 5, 50, 6, 52, -14,
+    54, 2, 56, 7, 58, -3, 60, -2, 62, -1, 31, 132, 2, -10, 4, -99,
+    6, -4, 8, -32, 10, 14, 12, 11, 14, 6, 16, -10, 18, -13, 20, 30,
+    22, -5, 24, -27, 26, 12, 28, 9, 30, 5, 32, -8, 34, -10, 36, 23,
+    38, -4, 40, -18, 42, 8, 44, 6, 46, 3, 48, -4, 50, -5, 52, 12,
+    54, -2, 56, -6, 58, 3, 60, 2, 62, 1, 63, -641, 1, -95, 2, -163,
+    3, 38, 4, 89, 5, 26, 6, -67, 7, -19, 8, -25, 9, 103, 10, -124,
+    11, -29, 12, 115, 13, -19, 14, -51, 15, 20, 16, -70, 17, -32, 18, 152,
+    19, -27, 20, -70, 21, -18, 22, 63, 23, -6, 24, -21, 25, -29, 26, 50,
+    27, 74, 28, -139, 29, 49, 30, 21, 31, -6, 32, -53, 33, 45, 34, 23,
+    35, -80, 36, 89, 37, -54, 38, 10, 39, 9, 40, -14, 41, -19, 42, 33,
+    43, 49, 44, -93, 45, 33, 46, 14, 47, -4, 48, -29, 49, -13, 50, 63,
+    51, -11, 52, -29, 53, -8, 54, 26, 55, -3, 56, -5, 57, 20, 58, -25,
+    59, -6, 60, 23, 61, -4, 62, -10, 63, 4, 63, -641, 1, 95, 2, -163,
+    3, -38, 4, 89, 5, -26, 6, -67, 7, 19, 8, -25, 9, -103, 10, -124,
+    11, 29, 12, 115, 13, 19, 14, -51, 15, -20, 16, -70, 17, 32, 18, 152,
+    19, 27, 20, -70, 21, 18, 22, 63, 23, 6, 24, -21, 25, 29, 26, 50,
+    27, -74, 28, -139, 29, -49, 30, 21, 31, 6, 32, -53, 33, -45, 34, 23,
+    35, 80, 36, 89, 37, 54, 38, 10, 39, -9, 40, -14, 41, 19, 42, 33,
+    43, -49, 44, -93, 45, -33, 46, 14, 47, 4, 48, -29, 49, 13, 50, 63,
+    51, 11, 52, -29, 53, 8, 54, 26, 55, 3, 56, -5, 57, -20, 58, -25,
+    59, 6, 60, 23, 61, 4, 62, -10, 63, -4, 31, -122, 2, 42, 4, 59,
+    6, -8, 8, 12, 10, -45, 12, 44, 14, 6, 16, 33, 18, 14, 20, -55,
+    22, 6, 24, 10, 26, 13, 28, -18, 30, -16, 32, 25, 34, -20, 36, -8,
+    38, 17, 40, 7, 42, 9, 44, -12, 46, -11, 48, 14, 50, 6, 52, -23,
+    54, 2, 56, 2, 58, -9, 60, 9, 62, 1, 31, 116, 2, -38, 4, -53,
+    6, 8, 8, -11, 10, 41, 12, -40, 14, -6, 16, -30, 18, -13, 20, 50,
+    22, -5, 24, -9, 26, -12, 28, 16, 30, 15, 32, -23, 34, 18, 36, 8,
+    38, -16, 40, -6, 42, -8, 44, 11, 46, 10, 48, -12, 50, -5, 52, 21,
+    54, -2, 56, -2, 58, 8, 60, -8, 62, -1, 55, -623, 1, -35, 2, -279,
+    3, 30, 4, 178, 5, 20, 6, -116, 7, -7, 8, -49, 9, 48, 11, -41,
+    12, 49, 13, -27, 15, 10, 16, -47, 17, -46, 18, 122, 19, 39, 20, -140,
+    21, 26, 22, 50, 23, -9, 24, -42, 25, 41, 27, -35, 28, 42, 29, -23,
+    31, 8, 32, -36, 33, -35, 34, 93, 35, 30, 36, -107, 37, 20, 38, 39,
+    39, -7, 40, -28, 41, 27, 43, -23, 44, 28, 45, -16, 47, 5, 48, -19,
+    49, -19, 50, 50, 51, 16, 52, -58, 53, 11, 54, 21, 55, -4, 56, -10,
+    57, 10, 59, -8, 60, 10, 61, -5, 63, 2, 55, -623, 1, 35, 2, -279,
+    3, -30, 4, 178, 5, -20, 6, -116, 7, 7, 8, -49, 9, -48, 11, 41,
+    12, 49, 13, 27, 15, -10, 16, -47, 17, 46, 18, 122, 19, -39, 20, -140,
+    21, -26, 22, 50, 23, 9, 24, -42, 25, -41, 27, 35, 28, 42, 29, 23,
+    31, -8, 32, -36, 33, 35, 34, 93, 35, -30, 36, -107, 37, -20, 38, 39,
+    39, 7, 40, -28, 41, -27, 43, 23, 44, 28, 45, 16, 47, -5, 48, -19,
+    49, 19, 50, 50, 51, -16, 52, -58, 53, -11, 54, 21, 55, 4, 56, -10,
+    57, -10, 59, 8, 60, 10, 61, 5, 63, -2, 27, -130, 2, 15, 4, 100,
+    6, -6, 8, 23, 10, -21, 14, 9, 16, 22, 18, 20, 20, -44, 22, -8,
+    24, 20, 26, -18, 30, 8, 32, 17, 34, 15, 36, -33, 38, -6, 40, 13,
+    42, -12, 46, 5, 48, 9, 50, 8, 52, -18, 54, -3, 56, 5, 58, -4,
+    62, 2, 27, 124, 2, -14, 4, -91, 6, 6, 8, -21, 10, 20, 14, -8,
+    16, -20, 18, -18, 20, 40, 22, 8, 24, -18, 26, 17, 30, -7, 32, -15,
+    34, -14, 36, 30, 38, 6, 40, -12, 42, 11, 46, -5, 48, -8, 50, -8,
+    52, 16, 54, 3, 56, -4, 58, 4, 62, -2, 63, -676, 1, -144, 2, -23,
+    3, -4, 4, 53, 5, -2, 6, -10, 7, -29, 8, 150, 9, -83, 10, -78,
+    11, 46, 12, 10, 13, 31, 14, -32, 15, -16, 16, 23, 17, -32, 18, 30,
+    19, -27, 20, 23, 21, -18, 22, 13, 23, -6, 24, -169, 25, 128, 26, 11,
+    27, 10, 28, -51, 29, 7, 30, 5, 31, 26, 32, -160, 33, 95, 34, 70,
+    35, -38, 36, -18, 37, -26, 38, 29, 39, 19, 40, -113, 41, 86, 42, 8,
+    43, 7, 44, -34, 45, 5, 46, 3, 47, 17, 48, 10, 49, -13, 50, 13,
+    51, -11, 52, 10, 53, -8, 54, 5, 55, -3, 56, 30, 57, -16, 58, -16,
+    59, 9, 60, 2, 61, 6, 62, -6, 63, -3, 63, -534, 1, 214, 2, -116,
+    3, -56, 4, 53, 5, -37, 6, -48, 7, 43, 8, 80, 9, 14, 10, -78,
+    11, 12, 12, 80, 13, 8, 14, -32, 15, 3, 16, -70, 17, 32, 18, 152,
+    19, 27, 20, -70, 21, 18, 22, 63, 23, 6, 24, -110, 25, -70, 26, 11,
+    27, -59, 28, -110, 29, -40, 30, 5, 31, -14, 32, -160, 33, -164, 34, -23,
+    35, 98, 36, 125, 37, 65, 38, -10, 39, -33, 40, -73, 41, -47, 42, 8,
+    43, -40, 44, -73, 45, -27, 46, 3, 47, -9, 48, -29, 49, 13, 50, 63,
+    51, 11, 52, -29, 53, 8, 54, 26, 55, 3, 56, 16, 57, 3, 58, -16,
+    59, 2, 60, 16, 61, 2, 62, -6, 63, 1, 62, -139, 1, 25, 2, 79,
+    3, -32, 4, 25, 5, 3, 6, -6, 7, 1, 8, -54, 9, -9, 10, 21,
+    11, 18, 12, 28, 13, -12, 14, -4, 15, 2, 16, 11, 17, -21, 18, 14,
+    19, 18, 20, -33, 21, 12, 22, 6, 23, -4, 24, 65, 25, 7, 26, -44,
+    27, -15, 28, -4, 29, 10, 30, -8, 31, -1, 32, 75, 33, 8, 34, -57,
+    35, 4, 36, -8, 37, -21, 38, 15, 39, 5, 40, 44, 41, 5, 42, -29,
+    43, -10, 44, -3, 45, 7, 46, -5, 47, -1, 48, 5, 49, -9, 50, 6,
+    51, 8, 52, -14, 53, 5, 54, 2, 55, -2, 56, -11, 57, -2, 58, 4,
+    59, 4, 60, 6, 61, -2, 62, -1, 62, 132, 1, -23, 2, -72, 3, 29,
+    4, -23, 5, -3, 6, 5, 7, -1, 8, 49, 9, 8, 10, -20, 11, -16,
+    12, -26, 13, 11, 14, 3, 15, -2, 16, -10, 17, 20, 18, -13, 19, -17,
+    20, 30, 21, -11, 22, -5, 23, 4, 24, -60, 25, -7, 26, 40, 27, 14,
+    28, 4, 29, -9, 30, 7, 31, 1, 32, -69, 33, -7, 34, 52, 35, -4,
+    36, 8, 37, 20, 38, -13, 39, -5, 40, -40, 41, -4, 42, 27, 43, 9,
+    44, 2, 45, -6, 46, 5, 47, 1, 48, -4, 49, 8, 50, -5, 51, -7,
+    52, 12, 53, -5, 54, -2, 55, 2, 56, 10, 57, 2, 58, -4, 59, -3,
+    60, -5, 61, 2, 62, 1, 63, -783, 1, -60, 2, -23, 3, 9, 4, 18,
+    5, 6, 6, -10, 7, -12, 8, -124, 9, 83, 10, 32, 11, -12, 12, -25,
+    13, -8, 14, 13, 15, 16, 16, 116, 17, -78, 18, -30, 19, 11, 20, 23,
+    21, 8, 22, -13, 23, -16, 24, -105, 25, 70, 26, 27, 27, -10, 28, -21,
+    29, -7, 30, 11, 31, 14, 32, 89, 33, -60, 34, -23, 35, 9, 36, 18,
+    37, 6, 38, -10, 39, -12, 40, -70, 41, 47, 42, 18, 43, -7, 44, -14,
+    45, -5, 46, 8, 47, 9, 48, 48, 49, -32, 50, -13, 51, 5, 52, 10,
+    53, 3, 54, -5, 55, -6, 56, -25, 57, 16, 58, 6, 59, -2, 60, -5,
+    61, -2, 62, 3, 63, 3, 63, -783, 1, 60, 2, -23, 3, -9, 4, 18,
+    5, -6, 6, -10, 7, 12, 8, -124, 9, -83, 10, 32, 11, 12, 12, -25,
+    13, 8, 14, 13, 15, -16, 16, 116, 17, 78, 18, -30, 19, -11, 20, 23,
+    21, -8, 22, -13, 23, 16, 24, -105, 25, -70, 26, 27, 27, 10, 28, -21,
+    29, 7, 30, 11, 31, -14, 32, 89, 33, 60, 34, -23, 35, -9, 36, 18,
+    37, -6, 38, -10, 39, 12, 40, -70, 41, -47, 42, 18, 43, 7, 44, -14,
+    45, 5, 46, 8, 47, -9, 48, 48, 49, 32, 50, -13, 51, -5, 52, 10,
+    53, -3, 54, -5, 55, 6, 56, -25, 57, -16, 58, 6, 59, 2, 60, -5,
+    61, 2, 62, 3, 63, -3, 31, -55, 2, 26, 4, 8, 6, -2, 8, 58,
+    10, -37, 12, -12, 14, 3, 16, -55, 18, 34, 20, 11, 22, -2, 24, 49,
+    26, -31, 28, -10, 30, 2, 32, -42, 34, 26, 36, 8, 38, -2, 40, 33,
+    42, -21, 44, -7, 46, 1, 48, -23, 50, 14, 52, 5, 54, -1, 56, 12,
+    58, -7, 60, -2, 62, 1, 30, 55, 2, -24, 4, -8, 6, 2, 8, -53,
+    10, 33, 12, 11, 14, -2, 16, 50, 18, -31, 20, -10, 22, 2, 24, -45,
+    26, 28, 28, 9, 30, -2, 32, 38, 34, -24, 36, -8, 38, 2, 40, -30,
+    42, 19, 44, 6, 46, -1, 48, 21, 50, -13, 52, -4, 54, 1, 56, -11,
+    58, 7, 60, 2, 63, -391, 1, -249, 2, -256, 3, 85, 4, 125, 5, 57,
+    6, -106, 7, -50, 8, -228, 9, 200, 10, -13, 11, -29, 12, 10, 13, -19,
+    14, -6, 15, 40, 16, -70, 17, 13, 18, 91, 19, -66, 20, 23, 21, -44,
+    22, 38, 23, 3, 24, -16, 25, -29, 26, 66, 27, 4, 28, -51, 29, 3,
+    30, 27, 31, -6, 32, -18, 33, -10, 34, 23, 35, 51, 36, -89, 37, 34,
+    38, 10, 39, -2, 40, -11, 41, -19, 42, 44, 43, 3, 44, -34, 45, 2,
+    46, 18, 47, -4, 48, -29, 49, 6, 50, 38, 51, -27, 52, 10, 53, -18,
+    54, 16, 55, 1, 56, -45, 57, 40, 58, -3, 59, -6, 60, 2, 61, -4,
+    62, -1, 63, 8, 63, -783, 1, 109, 2, 70, 3, 33, 4, 18, 5, 22,
+    6, 29, 7, 22, 8, -109, 9, -131, 10, -78, 11, -29, 12, -10, 13, -19,
+    14, -32, 15, -26, 16, 70, 17, 78, 18, 30, 19, -11, 20, -23, 21, -8,
+    22, 13, 23, 16, 24, -33, 25, -29, 26, 11, 27, 45, 28, 51, 29, 30,
+    30, 5, 31, -6, 32, 18, 33, 10, 34, -23, 35, -51, 36, -53, 37, -34,
+    38, -10, 39, 2, 40, -22, 41, -19, 42, 8, 43, 30, 44, 34, 45, 20,
+    46, 3, 47, -4, 48, 29, 49, 32, 50, 13, 51, -5, 52, -10, 53, -3,
+    54, 5, 55, 6, 56, -22, 57, -26, 58, -16, 59, -6, 60, -2, 61, -4,
+    62, -6, 63, -5, 52, -147, 1, -75, 2, 79, 3, 85, 4, 33, 5, 8,
+    6, -6, 7, -8, 8, 79, 9, 20, 10, -73, 11, -27, 12, 16, 13, 5,
+    15, 1, 17, 22, 18, 14, 19, -33, 20, -22, 21, 10, 22, 6, 24, 12,
+    25, 2, 27, 7, 28, -14, 29, -16, 30, 4, 31, 3, 33, 8, 34, 5,
+    35, -7, 37, -5, 38, -11, 39, 2, 40, 8, 41, 2, 43, 5, 44, -9,
+    45, -10, 46, 3, 47, 2, 49, 9, 50, 6, 51, -14, 52, -9, 53, 4,
+    54, 2, 56, 16, 57, 4, 58, -15, 59, -5, 60, 3, 61, 1, 51, 139,
+    1, 69, 2, -72, 3, -77, 4, -30, 5, -8, 6, 5, 7, 7, 8, -72,
+    9, -18, 10, 67, 11, 25, 12, -15, 13, -5, 17, -20, 18, -13, 19, 30,
+    20, 20, 21, -9, 22, -5, 24, -10, 25, -2, 27, -6, 28, 13, 29, 14,
+    30, -4, 31, -3, 33, -7, 34, -4, 35, 6, 37, 4, 38, 10, 39, -1,
+    40, -7, 41, -1, 43, -4, 44, 8, 45, 9, 46, -3, 47, -2, 49, -8,
+    50, -5, 51, 12, 52, 8, 53, -4, 54, -2, 56, -14, 57, -4, 58, 13,
+    59, 5, 60, -3, 61, -1, 63, -498, 1, -214, 2, -163, 3, 56, 4, 89,
+    5, 37, 6, -67, 7, -43, 8, 109, 9, 14, 10, -169, 11, 12, 12, 109,
+    13, 8, 14, -70, 15, 3, 16, -23, 17, -32, 18, 91, 19, -27, 20, -23,
+    21, -18, 22, 38, 23, -6, 24, 33, 25, -70, 26, 89, 27, -59, 28, 33,
+    29, -40, 30, 37, 31, -14, 32, -125, 33, 164, 34, -70, 35, -98, 36, 160,
+    37, -65, 38, -29, 39, 33, 40, 22, 41, -47, 42, 59, 43, -40, 44, 22,
+    45, -27, 46, 25, 47, -9, 48, -10, 49, -13, 50, 38, 51, -11, 52, -10,
+    53, -8, 54, 16, 55, -3, 56, 22, 57, 3, 58, -34, 59, 2, 60, 22,
+    61, 2, 62, -14, 63, 1, 63, -569, 1, 144, 2, -163, 3, 4, 4, 160,
+    5, 2, 6, -67, 7, 29, 8, 39, 9, -83, 10, -169, 11, 46, 12, 179,
+    13, 31, 14, -70, 15, -16, 16, -23, 17, 32, 18, 91, 19, 27, 20, -23,
+    21, 18, 22, 38, 23, 6, 24, 92, 25, 128, 26, 89, 27, 10, 28, -26,
+    29, 7, 30, 37, 31, 26, 32, -53, 33, -95, 34, -70, 35, 38, 36, 89,
+    37, 26, 38, -29, 39, -19, 40, 62, 41, 86, 42, 59, 43, 7, 44, -17,
+    45, 5, 46, 25, 47, 17, 48, -10, 49, 13, 50, 38, 51, 11, 52, -10,
+    53, 8, 54, 16, 55, 3, 56, 8, 57, -16, 58, -34, 59, 9, 60, 36,
+    61, 6, 62, -14, 63, -3, 54, -172, 1, -9, 2, 79, 3, 18, 4, 59,
+    5, -12, 6, -6, 7, 2, 8, -35, 9, -9, 10, -21, 11, 18, 12, 61,
+    13, -12, 14, 4, 15, 2, 16, 11, 18, 14, 20, -33, 22, 6, 24, -29,
+    25, 7, 26, 44, 27, -15, 28, -32, 29, 10, 30, 8, 31, -1, 32, 42,
+    33, 9, 34, -57, 35, -18, 36, 25, 37, 12, 38, 15, 39, -2, 40, -20,
+    41, 5, 42, 29, 43, -10, 44, -21, 45, 7, 46, 5, 47, -1, 48, 5,
+    50, 6, 52, -14, 54, 2, 56, -7, 57, -2, 58, -4, 59, 4, 60, 12,
+    61, -2, 62, 1, 54, 162, 1, 8, 2, -72, 3, -17, 4, -53, 5, 11,
+    6, 5, 7, -2, 8, 32, 9, 8, 10, 20, 11, -16, 12, -55, 13, 11,
+    14, -3, 15, -2, 16, -10, 18, -13, 20, 30, 22, -5, 24, 27, 25, -7,
+    26, -40, 27, 14, 28, 29, 29, -9, 30, -7, 31, 1, 32, -38, 33, -8,
+    34, 52, 35, 17, 36, -23, 37, -11, 38, -13, 39, 2, 40, 18, 41, -4,
+    42, -27, 43, 9, 44, 19, 45, -6, 46, -5, 47, 1, 48, -4, 50, -5,
+    52, 12, 54, -2, 56, 6, 57, 2, 58, 4, 59, -3, 60, -11, 61, 2,
+    62, -1, 63, -676, 1, -243, 2, 163, 3, -87, 4, 53, 5, -58, 6, 67,
+    7, -48, 8, -45, 9, 34, 10, 32, 11, -87, 12, 95, 13, -58, 14, 13,
+    15, 7, 16, -23, 17, 32, 18, -30, 19, 27, 20, -23, 21, 18, 22, -13,
+    23, 6, 24, 80, 25, -87, 26, 27, 27, 25, 28, -38, 29, 16, 30, 11,
+    31, -17, 32, -89, 33, 95, 34, -23, 35, -38, 36, 53, 37, -26, 38, -10,
+    39, 19, 40, 54, 41, -58, 42, 18, 43, 16, 44, -26, 45, 11, 46, 8,
+    47, -12, 48, -10, 49, 13, 50, -13, 51, 11, 52, -10, 53, 8, 54, -5,
+    55, 3, 56, -9, 57, 7, 58, 6, 59, -17, 60, 19, 61, -12, 62, 3,
+    63, 1, 63, -676, 1, 243, 2, 163, 3, 87, 4, 53, 5, 58, 6, 67,
+    7, 48, 8, -45, 9, -34, 10, 32, 11, 87, 12, 95, 13, 58, 14, 13,
+    15, -7, 16, -23, 17, -32, 18, -30, 19, -27, 20, -23, 21, -18, 22, -13,
+    23, -6, 24, 80, 25, 87, 26, 27, 27, -25, 28, -38, 29, -16, 30, 11,
+    31, 17, 32, -89, 33, -95, 34, -23, 35, 38, 36, 53, 37, 26, 38, -10,
+    39, -19, 40, 54, 41, 58, 42, 18, 43, -16, 44, -26, 45, -11, 46, 8,
+    47, 12, 48, -10, 49, -13, 50, -13, 51, -11, 52, -10, 53, -8, 54, -5,
+    55, -3, 56, -9, 57, -7, 58, 6, 59, 17, 60, 19, 61, 12, 62, 3,
+    63, -1, 31, -105, 2, 107, 4, -59, 6, 19, 8, 21, 10, -15, 12, -12,
+    14, 19, 16, 11, 18, -14, 20, 11, 22, -6, 24, -38, 26, 39, 28, -10,
+    30, -5, 32, 42, 34, -42, 36, 8, 38, 8, 40, -25, 42, 26, 44, -7,
+    46, -4, 48, 5, 50, -6, 52, 5, 54, -2, 56, 4, 58, -3, 60, -2,
+    62, 4, 31, 101, 2, -98, 4, 53, 6, -17, 8, -19, 10, 14, 12, 11,
+    14, -17, 16, -10, 18, 13, 20, -10, 22, 5, 24, 34, 26, -35, 28, 9,
+    30, 5, 32, -38, 34, 38, 36, -8, 38, -8, 40, 23, 42, -23, 44, 6,
+    46, 3, 48, -4, 50, 5, 52, -4, 54, 2, 56, -4, 58, 3, 60, 2,
+    62, -3, 50, -587, 1, -239, 3, 35, 5, 23, 7, -47, 8, -140, 9, 69,
+    10, 91, 11, -58, 13, -39, 14, 38, 15, 14, 16, -93, 17, 91, 19, -77,
+    20, 93, 21, -52, 23, 18, 24, 119, 25, -58, 26, -77, 27, 49, 29, 33,
+    30, -32, 31, -12, 32, -143, 33, 99, 35, 84, 36, -143, 37, 56, 39, 20,
+    40, 79, 41, -39, 42, -52, 43, 33, 45, 22, 46, -21, 47, -8, 48, -39,
+    49, 38, 51, -32, 52, 39, 53, -21, 55, 8, 56, -28, 57, 14, 58, 18,
+    59, -12, 61, -8, 62, 8, 63, 3, 55, -623, 1, 204, 3, -5, 4, 36,
+    5, -3, 7, 41, 8, -90, 9, -20, 10, 91, 11, 17, 12, -49, 13, 11,
+    14, 38, 15, -4, 16, 47, 17, 46, 19, -39, 20, -47, 21, -26, 23, 9,
+    24, 160, 25, 99, 26, -77, 27, -84, 28, -42, 29, -56, 30, -32, 31, 20,
+    32, -178, 33, -134, 35, -54, 36, -107, 37, -36, 39, -27, 40, 107, 41, 66,
+    42, -52, 43, -56, 44, -28, 45, -38, 46, -21, 47, 13, 48, 19, 49, 19,
+    51, -16, 52, -19, 53, -11, 55, 4, 56, -18, 57, -4, 58, 18, 59, 3,
+    60, -10, 61, 2, 62, 8, 63, -1, 58, -139, 1, -4, 2, 98, 3, 9,
+    5, -6, 6, -4, 7, 1, 8, 54, 9, 6, 10, -20, 11, -13, 12, -33,
+    13, 8, 14, 8, 15, -1, 16, 11, 17, 17, 18, -10, 19, -36, 21, 24,
+    22, 4, 23, -3, 24, -65, 25, 5, 26, 35, 27, -11, 28, 28, 29, 7,
+    30, -14, 31, -1, 32, 75, 33, -4, 34, -51, 35, 9, 37, -6, 38, -15,
+    39, 1, 40, -44, 41, 3, 42, 23, 43, -7, 44, 19, 45, 5, 46, -10,
+    47, -1, 48, 5, 49, 7, 50, -4, 51, -15, 53, 10, 54, 2, 55, -1,
+    56, 11, 57, 1, 58, -4, 59, -3, 60, -7, 61, 2, 62, 2, 58, 132,
+    1, 4, 2, -89, 3, -8, 5, 6, 6, 4, 7, -1, 8, -49, 9, -6,
+    10, 18, 11, 11, 12, 30, 13, -8, 14, -7, 15, 1, 16, -10, 17, -16,
+    18, 9, 19, 32, 21, -22, 22, -4, 23, 3, 24, 60, 25, -5, 26, -32,
+    27, 10, 28, -25, 29, -7, 30, 13, 31, 1, 32, -69, 33, 4, 34, 47,
+    35, -8, 37, 6, 38, 14, 39, -1, 40, 40, 41, -3, 42, -21, 43, 7,
+    44, -17, 45, -4, 46, 9, 47, 1, 48, -4, 49, -7, 50, 4, 51, 13,
+    53, -9, 54, -2, 55, 1, 56, -10, 57, -1, 58, 4, 59, 2, 60, 6,
+    61, -2, 62, -1, 55, -694, 1, -119, 2, -47, 3, 17, 4, 36, 5, 12,
+    6, -19, 7, -24, 8, -105, 9, 117, 10, -46, 11, -17, 12, 35, 13, -11,
+    14, -19, 15, 23, 16, -93, 18, 122, 20, -93, 22, 50, 24, 89, 25, -99,
+    26, 39, 27, 14, 28, -30, 29, 10, 30, 16, 31, -20, 32, -36, 33, 119,
+    34, -140, 35, -17, 36, 107, 37, -12, 38, -58, 39, 24, 40, 59, 41, -66,
+    42, 26, 43, 10, 44, -20, 45, 6, 46, 11, 47, -13, 48, -39, 50, 50,
+    52, -39, 54, 21, 56, -21, 57, 23, 58, -9, 59, -3, 60, 7, 61, -2,
+    62, -4, 63, 5, 62, -587, 1, 154, 2, -140, 3, -47, 4, 71, 5, -31,
+    6, -58, 7, 31, 8, 14, 9, -69, 10, -137, 11, -24, 12, 55, 13, -16,
+    14, -57, 15, -14, 16, -47, 17, 46, 18, 122, 19, -39, 20, -140, 21, -26,
+    22, 50, 23, 9, 24, 72, 25, 140, 26, 116, 27, -49, 28, -131, 29, -33,
+    30, 48, 31, 28, 32, -71, 33, -84, 34, -47, 35, -12, 37, -8, 38, -19,
+    39, -17, 40, 48, 41, 94, 42, 78, 43, -33, 44, -87, 45, -22, 46, 32,
+    47, 19, 48, -19, 49, 19, 50, 50, 51, -16, 52, -58, 53, -11, 54, 21,
+    55, 4, 56, 3, 57, -14, 58, -27, 59, -5, 60, 11, 61, -3, 62, -11,
+    63, -3, 59, -122, 1, 21, 2, 60, 3, -23, 4, 33, 5, -3, 6, -7,
+    7, 2, 8, 21, 9, 22, 10, -41, 11, -26, 12, 33, 13, -1, 14, -1,
+    15, 2, 16, 33, 17, 6, 18, 10, 19, -12, 20, -44, 21, 8, 22, -4,
+    23, -1, 24, -38, 25, -8, 26, 53, 27, 1, 28, -28, 29, 15, 30, -7,
+    31, -4, 32, 25, 33, -12, 34, -45, 35, 5, 36, 33, 37, 15, 38, 1,
+    39, -4, 40, -25, 41, -6, 42, 35, 43, 1, 44, -19, 45, 10, 46, -5,
+    47, -3, 48, 14, 49, 2, 50, 4, 51, -5, 52, -18, 53, 3, 54, -2,
+    56, 4, 57, 4, 58, -8, 59, -5, 60, 7, 59, 116, 1, -19, 2, -55,
+    3, 21, 4, -30, 5, 3, 6, 6, 7, -2, 8, -19, 9, -20, 10, 37,
+    11, 24, 12, -30, 13, 1, 14, 1, 15, -2, 16, -30, 17, -5, 18, -9,
+    19, 11, 20, 40, 21, -7, 22, 4, 23, 1, 24, 34, 25, 8, 26, -48,
+    27, -1, 28, 25, 29, -14, 30, 6, 31, 3, 32, -23, 33, 11, 34, 41,
+    35, -4, 36, -30, 37, -14, 38, -1, 39, 4, 40, 23, 41, 5, 42, -32,
+    43, -1, 44, 17, 45, -9, 46, 4, 47, 2, 48, -12, 49, -2, 50, -4,
+    51, 4, 52, 16, 53, -3, 54, 2, 56, -4, 57, -4, 58, 7, 59, 5,
+    60, -6, 52, -658, 1, -119, 2, -93, 3, 17, 4, 71, 5, 12, 6, -39,
+    7, -24, 8, 224, 9, -117, 10, -110, 11, 17, 12, 84, 13, 11, 14, -46,
+    15, -23, 16, 47, 18, -61, 20, 47, 22, -25, 24, -106, 25, 99, 26, -16,
+    27, -14, 28, 12, 29, -10, 30, -7, 31, 20, 32, -143, 33, 119, 35, -17,
+    37, -12, 39, 24, 40, -71, 41, 66, 42, -11, 43, -10, 44, 8, 45, -6,
+    46, -4, 47, 13, 48, 19, 50, -25, 52, 19, 54, -10, 56, 45, 57, -23,
+    58, -22, 59, 3, 60, 17, 61, 2, 62, -9, 63, -5, 51, -516, 1, 294,
+    2, -47, 3, -165, 4, -143, 5, -111, 6, -19, 7, 58, 8, 154, 9, 97,
+    10, -46, 12, 55, 14, -19, 15, 19, 16, -47, 17, -46, 19, 39, 20, 47,
+    21, 26, 23, -9, 24, -47, 26, 39, 27, -70, 28, -131, 29, -47, 30, 16,
+    32, -143, 33, -84, 34, 47, 35, -12, 36, -71, 37, -8, 38, 19, 39, -17,
+    40, -31, 42, 26, 43, -47, 44, -87, 45, -31, 46, 11, 48, -19, 49, -19,
+    51, 16, 52, 19, 53, 11, 55, -4, 56, 31, 57, 19, 58, -9, 60, 11,
+    62, -4, 63, 4, 58, -147, 1, 14, 2, 91, 3, -38, 4, 25, 5, 35,
+    6, -20, 7, -6, 8, -89, 9, -14, 10, 47, 11, 15, 12, 28, 13, 3,
+    14, -2, 15, -2, 17, -17, 18, -10, 19, 21, 20, 11, 21, -2, 22, 4,
+    23, -1, 24, 36, 25, 3, 26, -22, 27, -18, 28, -4, 29, 23, 30, -6,
+    31, -4, 32, 67, 33, -4, 34, -45, 35, -2, 36, -8, 37, 11, 38, 1,
+    39, -3, 40, 24, 41, 2, 42, -15, 43, -12, 44, -3, 45, 15, 46, -4,
+    47, -3, 49, -7, 50, -4, 51, 9, 52, 5, 53, -1, 54, 2, 56, -18,
+    57, -3, 58, 9, 59, 3, 60, 6, 61, 1, 58, 139, 1, -13, 2, -83,
+    3, 35, 4, -23, 5, -32, 6, 18, 7, 6, 8, 81, 9, 13, 10, -43,
+    11, -14, 12, -26, 13, -3, 14, 2, 15, 2, 17, 15, 18, 9, 19, -19,
+    20, -10, 21, 2, 22, -4, 23, 1, 24, -33, 25, -3, 26, 20, 27, 16,
+    28, 4, 29, -21, 30, 5, 31, 4, 32, -61, 33, 3, 34, 41, 35, 2,
+    36, 8, 37, -10, 38, -1, 39, 2, 40, -22, 41, -2, 42, 13, 43, 11,
+    44, 2, 45, -14, 46, 4, 47, 3, 49, 6, 50, 4, 51, -8, 52, -4,
+    53, 1, 54, -2, 56, 16, 57, 3, 58, -9, 59, -3, 60, -5, 61, -1,
+    55, -694, 1, -119, 2, -47, 3, 17, 4, 36, 5, 12, 6, -19, 7, -24,
+    8, -105, 9, 117, 10, -46, 11, -17, 12, 35, 13, -11, 14, -19, 15, 23,
+    16, -93, 18, 122, 20, -93, 22, 50, 24, 89, 25, -99, 26, 39, 27, 14,
+    28, -30, 29, 10, 30, 16, 31, -20, 32, -36, 33, 119, 34, -140, 35, -17,
+    36, 107, 37, -12, 38, -58, 39, 24, 40, 59, 41, -66, 42, 26, 43, 10,
+    44, -20, 45, 6, 46, 11, 47, -13, 48, -39, 50, 50, 52, -39, 54, 21,
+    56, -21, 57, 23, 58, -9, 59, -3, 60, 7, 61, -2, 62, -4, 63, 5,
+    55, -587, 1, 119, 2, -186, 3, -17, 4, 143, 5, -12, 6, -77, 7, 24,
+    8, 14, 9, -117, 10, -202, 11, 17, 12, 154, 13, 11, 14, -83, 15, -23,
+    16, -47, 18, 61, 20, -47, 22, 25, 24, 72, 25, 99, 26, 61, 27, -14,
+    28, -47, 29, -10, 30, 25, 31, 20, 32, -71, 33, -119, 34, -93, 35, 17,
+    36, 71, 37, 12, 38, -39, 39, -24, 40, 48, 41, 66, 42, 41, 43, -10,
+    44, -31, 45, -6, 46, 17, 47, 13, 48, -19, 50, 25, 52, -19, 54, 10,
+    56, 3, 57, -23, 58, -40, 59, 3, 60, 31, 61, 2, 62, -17, 63, -5,
+    59, -122, 1, 25, 2, 53, 3, -21, 4, 42, 5, -14, 6, -4, 7, 5,
+    8, 21, 9, 27, 10, -52, 11, -23, 12, 44, 13, -16, 14, 4, 15, 5,
+    16, 33, 17, 11, 19, -9, 20, -33, 21, -6, 23, 2, 24, -38, 25, -4,
+    26, 44, 27, 3, 28, -18, 29, 2, 30, -3, 31, -1, 32, 25, 33, -8,
+    34, -53, 35, 7, 36, 42, 37, 5, 38, 4, 39, -2, 40, -25, 41, -3,
+    42, 29, 43, 2, 44, -12, 45, 2, 46, -2, 47, -1, 48, 14, 49, 4,
+    51, -4, 52, -14, 53, -3, 55, 1, 56, 4, 57, 5, 58, -10, 59, -5,
+    60, 9, 61, -3, 62, 1, 63, 1, 58, 116, 1, -22, 2, -48, 3, 19,
+    4, -38, 5, 13, 6, 3, 7, -4, 8, -19, 9, -25, 10, 47, 11, 21,
+    12, -40, 13, 14, 14, -3, 15, -5, 16, -30, 17, -10, 19, 8, 20, 30,
+    21, 6, 23, -2, 24, 34, 25, 4, 26, -40, 27, -3, 28, 16, 29, -2,
+    30, 3, 31, 1, 32, -23, 33, 7, 34, 48, 35, -6, 36, -38, 37, -4,
+    38, -3, 39, 1, 40, 23, 41, 2, 42, -27, 43, -2, 44, 11, 45, -1,
+    46, 2, 48, -12, 49, -4, 51, 3, 52, 12, 53, 2, 55, -1, 56, -4,
+    57, -5, 58, 9, 59, 4, 60, -8, 61, 3, 62, -1, 63, -1, 63, -534,
+    1, -179, 2, -163, 3, 26, 4, 125, 5, 17, 6, -67, 7, -36, 8, 89,
+    9, 34, 10, -169, 11, -5, 12, 130, 13, -3, 14, -70, 15, 7, 16, 23,
+    17, -78, 18, 91, 19, 11, 20, -70, 21, 8, 22, 38, 23, -16, 24, 134,
+    25, -169, 26, 89, 27, 25, 28, -68, 29, 16, 30, 37, 31, -34, 32, -18,
+    33, 60, 34, -70, 35, -9, 36, 53, 37, -6, 38, -29, 39, 12, 40, 90,
+    41, -113, 42, 59, 43, 16, 44, -45, 45, 11, 46, 25, 47, -23, 48, 10,
+    49, -32, 50, 38, 51, 5, 52, -29, 53, 3, 54, 16, 55, -6, 56, 18,
+    57, 7, 58, -34, 59, -1, 60, 26, 61, -1, 62, -14, 63, 1, 63, -569,
+    1, 179, 2, -116, 3, -26, 4, 89, 5, -17, 6, -48, 7, 36, 8, 39,
+    9, -34, 10, -105, 11, 5, 12, 80, 13, 3, 14, -43, 15, -7, 16, -23,
+    17, 78, 18, 152, 19, -11, 20, -116, 21, -8, 22, 63, 23, 16, 24, 92,
+    25, 169, 26, 143, 27, -25, 28, -110, 29, -16, 30, 59, 31, 34, 32, -53,
+    33, -60, 34, -23, 35, 9, 36, 18, 37, 6, 38, -10, 39, -12, 40, 62,
+    41, 113, 42, 96, 43, -16, 44, -73, 45, -11, 46, 40, 47, 23, 48, -10,
+    49, 32, 50, 63, 51, -5, 52, -48, 53, -3, 54, 26, 55, 6, 56, 8,
+    57, -7, 58, -21, 59, 1, 60, 16, 61, 1, 62, -9, 63, -1, 59, -164,
+    1, -8, 2, 79, 3, 7, 4, 50, 5, 5, 6, -6, 7, -2, 8, -30,
+    9, -11, 10, -15, 11, 10, 12, 49, 13, 6, 14, 1, 15, -2, 17, -11,
+    18, 34, 19, 9, 20, -44, 21, 6, 22, -2, 23, -2, 24, -53, 25, -10,
+    26, 75, 27, 8, 28, -42, 29, 5, 30, -5, 31, -2, 32, 17, 33, -8,
+    34, -26, 35, 7, 36, 17, 37, 5, 38, 2, 39, -2, 40, -36, 41, -6,
+    42, 50, 43, 5, 44, -28, 45, 4, 46, -4, 47, -1, 49, -4, 50, 14,
+    51, 4, 52, -18, 53, 3, 54, -1, 55, -1, 56, -6, 57, -2, 58, -3,
+    59, 2, 60, 10, 61, 1, 59, 154, 1, 7, 2, -72, 3, -6, 4, -46,
+    5, -4, 6, 5, 7, 1, 8, 27, 9, 10, 10, 14, 11, -9, 12, -45,
+    13, -6, 14, -1, 15, 2, 17, 10, 18, -31, 19, -8, 20, 40, 21, -6,
+    22, 2, 23, 2, 24, 49, 25, 9, 26, -68, 27, -7, 28, 38, 29, -5,
+    30, 5, 31, 2, 32, -15, 33, 7, 34, 24, 35, -6, 36, -15, 37, -4,
+    38, -2, 39, 1, 40, 32, 41, 6, 42, -46, 43, -5, 44, 25, 45, -3,
+    46, 3, 47, 1, 49, 4, 50, -13, 51, -3, 52, 16, 53, -2, 54, 1,
+    55, 1, 56, 5, 57, 2, 58, 3, 59, -2, 60, -9, 61, -1, 63, -641,
+    1, -234, 2, 23, 3, 157, 4, -196, 5, 105, 6, 10, 7, -47, 8, 25,
+    9, -34, 10, 32, 11, -29, 12, 25, 13, -19, 14, 13, 15, -7, 16, -70,
+    17, 59, 18, 30, 19, -105, 20, 116, 21, -70, 22, 13, 23, 12, 24, 21,
+    25, -29, 26, 27, 27, -25, 28, 21, 29, -16, 30, 11, 31, -6, 32, -53,
+    33, 45, 34, 23, 35, -80, 36, 89, 37, -54, 38, 10, 39, 9, 40, 14,
+    41, -19, 42, 18, 43, -16, 44, 14, 45, -11, 46, 8, 47, -4, 48, -29,
+    49, 24, 50, 13, 51, -43, 52, 48, 53, -29, 54, 5, 55, 5, 56, 5,
+    57, -7, 58, 6, 59, -6, 60, 5, 61, -4, 62, 3, 63, -1, 63, -854,
+    1, 25, 2, 23, 3, 21, 4, 18, 5, 14, 6, 10, 7, 5, 8, 25,
+    9, 34, 10, 32, 11, 29, 12, 25, 13, 19, 14, 13, 15, 7, 16, 23,
+    17, 32, 18, 30, 19, 27, 20, 23, 21, 18, 22, 13, 23, 6, 24, 21,
+    25, 29, 26, 27, 27, 25, 28, 21, 29, 16, 30, 11, 31, 6, 32, 18,
+    33, 25, 34, 23, 35, 21, 36, 18, 37, 14, 38, 10, 39, 5, 40, 14,
+    41, 19, 42, 18, 43, 16, 44, 14, 45, 11, 46, 8, 47, 4, 48, 10,
+    49, 13, 50, 13, 51, 11, 52, 10, 53, 8, 54, 5, 55, 3, 56, 5,
+    57, 7, 58, 6, 59, 6, 60, 5, 61, 4, 62, 3, 63, 1, 47, -72,
+    1, -27, 2, 57, 3, 54, 4, -8, 5, -36, 6, -15, 7, 5, 8, -12,
+    10, 15, 12, -12, 14, 6, 16, 11, 17, 12, 18, -6, 19, -24, 20, -11,
+    21, 16, 22, 14, 23, -2, 24, -10, 26, 13, 28, -10, 30, 5, 32, 8,
+    33, 9, 34, -5, 35, -18, 36, -8, 37, 12, 38, 11, 39, -2, 40, -7,
+    42, 9, 44, -7, 46, 4, 48, 5, 49, 5, 50, -2, 51, -10, 52, -5,
+    53, 7, 54, 6, 55, -1, 56, -2, 58, 3, 60, -2, 62, 1, 47, 71,
+    1, 24, 2, -52, 3, -50, 4, 8, 5, 33, 6, 13, 7, -5, 8, 11,
+    10, -14, 12, 11, 14, -6, 16, -10, 17, -11, 18, 5, 19, 22, 20, 10,
+    21, -14, 22, -13, 23, 2, 24, 9, 26, -12, 28, 9, 30, -5, 32, -8,
+    33, -8, 34, 4, 35, 17, 36, 8, 37, -11, 38, -10, 39, 2, 40, 6,
+    42, -8, 44, 6, 46, -3, 48, -4, 49, -4, 50, 2, 51, 9, 52, 4,
+    53, -6, 54, -5, 55, 1, 56, 2, 58, -3, 60, 2, 62, -1, 63, -569,
+    1, -179, 2, -116, 3, 26, 4, 89, 5, 17, 6, -48, 7, -36, 8, 39,
+    9, 34, 10, -105, 11, -5, 12, 80, 13, -3, 14, -43, 15, 7, 16, -23,
+    17, -78, 18, 152, 19, 11, 20, -116, 21, 8, 22, 63, 23, -16, 24, 92,
+    25, -169, 26, 143, 27, 25, 28, -110, 29, 16, 30, 59, 31, -34, 32, -53,
+    33, 60, 34, -23, 35, -9, 36, 18, 37, -6, 38, -10, 39, 12, 40, 62,
+    41, -113, 42, 96, 43, 16, 44, -73, 45, 11, 46, 40, 47, -23, 48, -10,
+    49, -32, 50, 63, 51, 5, 52, -48, 53, 3, 54, 26, 55, -6, 56, 8,
+    57, 7, 58, -21, 59, -1, 60, 16, 61, -1, 62, -9, 63, 1, 63, -569,
+    1, 179, 2, -116, 3, -26, 4, 89, 5, -17, 6, -48, 7, 36, 8, 39,
+    9, -34, 10, -105, 11, 5, 12, 80, 13, 3, 14, -43, 15, -7, 16, -23,
+    17, 78, 18, 152, 19, -11, 20, -116, 21, -8, 22, 63, 23, 16, 24, 92,
+    25, 169, 26, 143, 27, -25, 28, -110, 29, -16, 30, 59, 31, 34, 32, -53,
+    33, -60, 34, -23, 35, 9, 36, 18, 37, 6, 38, -10, 39, -12, 40, 62,
+    41, 113, 42, 96, 43, -16, 44, -73, 45, -11, 46, 40, 47, 23, 48, -10,
+    49, 32, 50, 63, 51, -5, 52, -48, 53, -3, 54, 26, 55, 6, 56, 8,
+    57, -7, 58, -21, 59, 1, 60, 16, 61, 1, 62, -9, 63, -1, 30, -156,
+    2, 79, 4, 42, 6, -6, 8, -18, 10, -15, 12, 38, 14, 1, 16, 11,
+    18, 34, 20, -55, 22, -2, 24, -43, 26, 75, 28, -52, 30, -5, 32, 25,
+    34, -26, 36, 8, 38, 2, 40, -29, 42, 50, 44, -34, 46, -4, 48, 5,
+    50, 14, 52, -23, 54, -1, 56, -4, 58, -3, 60, 7, 30, 147, 2, -72,
+    4, -38, 6, 5, 8, 17, 10, 14, 12, -34, 14, -1, 16, -10, 18, -31,
+    20, 50, 22, 2, 24, 40, 26, -68, 28, 47, 30, 5, 32, -23, 34, 24,
+    36, -8, 38, -2, 40, 26, 42, -46, 44, 31, 46, 3, 48, -4, 50, -13,
+    52, 21, 54, 1, 56, 3, 58, 3, 60, -7, 63, -712, 1, -179, 2, 70,
+    3, 26, 4, -53, 5, 17, 6, 29, 7, -36, 8, -31, 9, 34, 10, -13,
+    11, -5, 12, 10, 13, -3, 14, -6, 15, 7, 16, 70, 17, -78, 18, 30,
+    19, 11, 20, -23, 21, 8, 22, 13, 23, -16, 24, 152, 25, -169, 26, 66,
+    27, 25, 28, -51, 29, 16, 30, 27, 31, -34, 32, -53, 33, 60, 34, -23,
+    35, -9, 36, 18, 37, -6, 38, -10, 39, 12, 40, 101, 41, -113, 42, 44,
+    43, 16, 44, -34, 45, 11, 46, 18, 47, -23, 48, 29, 49, -32, 50, 13,
+    51, 5, 52, -10, 53, 3, 54, 5, 55, -6, 56, -6, 57, 7, 58, -3,
+    59, -1, 60, 2, 61, -1, 62, -1, 63, 1, 63, -605, 1, 179, 2, -70,
+    3, -26, 4, 53, 5, -17, 6, -29, 7, 36, 8, 158, 9, 34, 10, -169,
+    11, -53, 12, 60, 13, -35, 14, -70, 15, 7, 16, 23, 17, -13, 18, -30,
+    19, 66, 20, 116, 21, 44, 22, -13, 23, -3, 24, 75, 25, 111, 26, 89,
+    27, 25, 28, -9, 29, 16, 30, 37, 31, 22, 32, 53, 33, 80, 34, 23,
+    35, -110, 36, -160, 37, -73, 38, 10, 39, 16, 40, 50, 41, 74, 42, 59,
+    43, 16, 44, -6, 45, 11, 46, 25, 47, 15, 48, 10, 49, -6, 50, -13,
+    51, 27, 52, 48, 53, 18, 54, -5, 55, -1, 56, 32, 57, 7, 58, -34,
+    59, -11, 60, 12, 61, -7, 62, -14, 63, 1, 52, -114, 1, 25, 2, 79,
+    3, -21, 5, -14, 6, -6, 7, 5, 8, -30, 9, 36, 11, -41, 12, 33,
+    13, -4, 14, -5, 15, 4, 16, -22, 17, -1, 18, 14, 19, 15, 21, -22,
+    22, 6, 23, 4, 24, -53, 25, -11, 26, 62, 27, 18, 28, -28, 29, -8,
+    31, 1, 33, 10, 34, 5, 35, -29, 37, 29, 38, -11, 39, -5, 40, -36,
+    41, -8, 42, 41, 43, 12, 44, -19, 45, -5, 48, -9, 50, 6, 51, 6,
+    53, -9, 54, 2, 55, 2, 56, -6, 57, 7, 59, -8, 60, 7, 61, -1,
+    62, -1, 63, 1, 52, 109, 1, -22, 2, -72, 3, 19, 5, 13, 6, 5,
+    7, -4, 8, 27, 9, -33, 11, 37, 12, -30, 13, 3, 14, 5, 15, -3,
+    16, 20, 17, 1, 18, -13, 19, -13, 21, 20, 22, -5, 23, -4, 24, 49,
+    25, 10, 26, -57, 27, -17, 28, 25, 29, 7, 31, -1, 33, -9, 34, -4,
+    35, 27, 37, -26, 38, 10, 39, 5, 40, 32, 41, 7, 42, -38, 43, -11,
+    44, 17, 45, 5, 48, 8, 50, -5, 51, -6, 53, 8, 54, -2, 55, -2,
+    56, 5, 57, -7, 59, 7, 60, -6, 61, 1, 62, 1, 63, -1, 63, -569,
+    1, -60, 2, -303, 3, 9, 4, 232, 5, 6, 6, -125, 7, -12, 8, 124,
+    9, -83, 10, -32, 11, 12, 12, 25, 13, 8, 14, -13, 15, -16, 16, 23,
+    17, -78, 18, 91, 19, 11, 20, -70, 21, 8, 22, 38, 23, -16, 24, 105,
+    25, -70, 26, -27, 27, 10, 28, 21, 29, 7, 30, -11, 31, -14, 32, 18,
+    33, -60, 34, 70, 35, 9, 36, -53, 37, 6, 38, 29, 39, -12, 40, 70,
+    41, -47, 42, -18, 43, 7, 44, 14, 45, 5, 46, -8, 47, -9, 48, 10,
+    49, -32, 50, 38, 51, 5, 52, -29, 53, 3, 54, 16, 55, -6, 56, 25,
+    57, -16, 58, -6, 59, 2, 60, 5, 61, 2, 62, -3, 63, -3, 63, -569,
+    1, 60, 2, -303, 3, -9, 4, 232, 5, -6, 6, -125, 7, 12, 8, 124,
+    9, 83, 10, -32, 11, -12, 12, 25, 13, -8, 14, -13, 15, 16, 16, 23,
+    17, 78, 18, 91, 19, -11, 20, -70, 21, -8, 22, 38, 23, 16, 24, 105,
+    25, 70, 26, -27, 27, -10, 28, 21, 29, -7, 30, -11, 31, 14, 32, 18,
+    33, 60, 34, 70, 35, -9, 36, -53, 37, -6, 38, 29, 39, 12, 40, 70,
+    41, 47, 42, -18, 43, -7, 44, 14, 45, -5, 46, -8, 47, 9, 48, 10,
+    49, 32, 50, 38, 51, -5, 52, -29, 53, -3, 54, 16, 55, 6, 56, 25,
+    57, 16, 58, -6, 59, -2, 60, 5, 61, -2, 62, -3, 63, 3, 31, -156,
+    2, 26, 4, 109, 6, -2, 8, -58, 10, 37, 12, 12, 14, -3, 16, -11,
+    18, 34, 20, -33, 22, -2, 24, -49, 26, 31, 28, 10, 30, -2, 32, -8,
+    34, 26, 36, -25, 38, -2, 40, -33, 42, 21, 44, 7, 46, -1, 48, -5,
+    50, 14, 52, -14, 54, -1, 56, -12, 58, 7, 60, 2, 62, -1, 30, 147,
+    2, -24, 4, -99, 6, 2, 8, 53, 10, -33, 12, -11, 14, 2, 16, 10,
+    18, -31, 20, 30, 22, 2, 24, 45, 26, -28, 28, -9, 30, 2, 32, 8,
+    34, -24, 36, 23, 38, 2, 40, 30, 42, -19, 44, -6, 46, 1, 48, 4,
+    50, -13, 52, 12, 54, 1, 56, 11, 58, -7, 60, -2, 63, -463, 1, -179,
+    2, -256, 3, 26, 4, 196, 5, 17, 6, -106, 7, -36, 8, 19, 9, 34,
+    10, -78, 11, -5, 12, 60, 13, -3, 14, -32, 15, 7, 16, 23, 17, -78,
+    18, 91, 19, 11, 20, -70, 21, 8, 22, 38, 23, -16, 24, 194, 25, -169,
+    26, 11, 27, 25, 28, -9, 29, 16, 30, 5, 31, -34, 32, -89, 33, 60,
+    34, 23, 35, -9, 36, -18, 37, -6, 38, 10, 39, 12, 40, 129, 41, -113,
+    42, 8, 43, 16, 44, -6, 45, 11, 46, 3, 47, -23, 48, 10, 49, -32,
+    50, 38, 51, 5, 52, -29, 53, 3, 54, 16, 55, -6, 56, 4, 57, 7,
+    58, -16, 59, -1, 60, 12, 61, -1, 62, -6, 63, 1, 63, -569, 1, 179,
+    2, -116, 3, -26, 4, 89, 5, -17, 6, -48, 7, 36, 8, 39, 9, -34,
+    10, -105, 11, 5, 12, 80, 13, 3, 14, -43, 15, -7, 16, -23, 17, 78,
+    18, 152, 19, -11, 20, -116, 21, -8, 22, 63, 23, 16, 24, 92, 25, 169,
+    26, 143, 27, -25, 28, -110, 29, -16, 30, 59, 31, 34, 32, -53, 33, -60,
+    34, -23, 35, 9, 36, 18, 37, 6, 38, -10, 39, -12, 40, 62, 41, 113,
+    42, 96, 43, -16, 44, -73, 45, -11, 46, 40, 47, 23, 48, -10, 49, 32,
+    50, 63, 51, -5, 52, -48, 53, -3, 54, 26, 55, 6, 56, 8, 57, -7,
+    58, -21, 59, 1, 60, 16, 61, 1, 62, -9, 63, -1, 58, -181, 1, -25,
+    2, 79, 3, 21, 4, 67, 5, 14, 6, -6, 7, -5, 8, -14, 9, 5,
+    10, -15, 11, -4, 12, 33, 13, -3, 14, 1, 15, 1, 17, -11, 18, 34,
+    19, 9, 20, -44, 21, 6, 22, -2, 23, -2, 24, -67, 25, -23, 26, 75,
+    27, 20, 28, -28, 29, 13, 30, -5, 31, -5, 32, 33, 33, 8, 34, -26,
+    35, -7, 37, -5, 38, 2, 39, 2, 40, -45, 41, -16, 42, 50, 43, 13,
+    44, -19, 45, 9, 46, -4, 47, -3, 49, -4, 50, 14, 51, 4, 52, -18,
+    53, 3, 54, -1, 55, -1, 56, -3, 57, 1, 58, -3, 59, -1, 60, 7,
+    61, -1, 57, 170, 1, 22, 2, -72, 3, -19, 4, -61, 5, -13, 6, 5,
+    7, 4, 8, 12, 9, -4, 10, 14, 11, 4, 12, -30, 13, 2, 14, -1,
+    15, -1, 17, 10, 18, -31, 19, -8, 20, 40, 21, -6, 22, 2, 23, 2,
+    24, 61, 25, 21, 26, -68, 27, -18, 28, 25, 29, -12, 30, 5, 31, 4,
+    32, -30, 33, -7, 34, 24, 35, 6, 37, 4, 38, -2, 39, -1, 40, 41,
+    41, 14, 42, -46, 43, -12, 44, 17, 45, -8, 46, 3, 47, 3, 49, 4,
+    50, -13, 51, -3, 52, 16, 53, -2, 54, 1, 55, 1, 56, 2, 57, -1,
+    58, 3, 59, 1, 60, -6, 55, -587, 1, -119, 2, -186, 3, 17, 4, 143,
+    5, 12, 6, -77, 7, -24, 8, 14, 9, 117, 10, -202, 11, -17, 12, 154,
+    13, -11, 14, -83, 15, 23, 16, -47, 18, 61, 20, -47, 22, 25, 24, 72,
+    25, -99, 26, 61, 27, 14, 28, -47, 29, 10, 30, 25, 31, -20, 32, -71,
+    33, 119, 34, -93, 35, -17, 36, 71, 37, -12, 38, -39, 39, 24, 40, 48,
+    41, -66, 42, 41, 43, 10, 44, -31, 45, 6, 46, 17, 47, -13, 48, -19,
+    50, 25, 52, -19, 54, 10, 56, 3, 57, 23, 58, -40, 59, -3, 60, 31,
+    61, -2, 62, -17, 63, 5, 55, -694, 1, 119, 2, -47, 3, -17, 4, 36,
+    5, -12, 6, -19, 7, 24, 8, -105, 9, -117, 10, -46, 11, 17, 12, 35,
+    13, 11, 14, -19, 15, -23, 16, -93, 18, 122, 20, -93, 22, 50, 24, 89,
+    25, 99, 26, 39, 27, -14, 28, -30, 29, -10, 30, 16, 31, 20, 32, -36,
+    33, -119, 34, -140, 35, 17, 36, 107, 37, 12, 38, -58, 39, -24, 40, 59,
+    41, 66, 42, 26, 43, -10, 44, -20, 45, -6, 46, 11, 47, 13, 48, -39,
+    50, 50, 52, -39, 54, 21, 56, -21, 57, -23, 58, -9, 59, 3, 60, 7,
+    61, 2, 62, -4, 63, -5, 59, -122, 1, -25, 2, 53, 3, 21, 4, 42,
+    5, 14, 6, -4, 7, -5, 8, 21, 9, -27, 10, -52, 11, 23, 12, 44,
+    13, 16, 14, 4, 15, -5, 16, 33, 17, -11, 19, 9, 20, -33, 21, 6,
+    23, -2, 24, -38, 25, 4, 26, 44, 27, -3, 28, -18, 29, -2, 30, -3,
+    31, 1, 32, 25, 33, 8, 34, -53, 35, -7, 36, 42, 37, -5, 38, 4,
+    39, 2, 40, -25, 41, 3, 42, 29, 43, -2, 44, -12, 45, -2, 46, -2,
+    47, 1, 48, 14, 49, -4, 51, 4, 52, -14, 53, 3, 55, -1, 56, 4,
+    57, -5, 58, -10, 59, 5, 60, 9, 61, 3, 62, 1, 63, -1, 58, 116,
+    1, 22, 2, -48, 3, -19, 4, -38, 5, -13, 6, 3, 7, 4, 8, -19,
+    9, 25, 10, 47, 11, -21, 12, -40, 13, -14, 14, -3, 15, 5, 16, -30,
+    17, 10, 19, -8, 20, 30, 21, -6, 23, 2, 24, 34, 25, -4, 26, -40,
+    27, 3, 28, 16, 29, 2, 30, 3, 31, -1, 32, -23, 33, -7, 34, 48,
+    35, 6, 36, -38, 37, 4, 38, -3, 39, -1, 40, 23, 41, -2, 42, -27,
+    43, 2, 44, 11, 45, 1, 46, 2, 48, -12, 49, 4, 51, -3, 52, 12,
+    53, -2, 55, 1, 56, -4, 57, 5, 58, 9, 59, -4, 60, -8, 61, -3,
+    62, -1, 63, 1, 52, -516, 1, -119, 2, -279, 3, 17, 4, 214, 5, 12,
+    6, -116, 7, -24, 8, -55, 9, 117, 10, -110, 11, -17, 12, 84, 13, -11,
+    14, -46, 15, 23, 16, -47, 18, 61, 20, -47, 22, 25, 24, 131, 25, -99,
+    26, -16, 27, 14, 28, 12, 29, 10, 30, -7, 31, -20, 32, -143, 33, 119,
+    35, -17, 37, -12, 39, 24, 40, 87, 41, -66, 42, -11, 43, 10, 44, 8,
+    45, 6, 46, -4, 47, -13, 48, -19, 50, 25, 52, -19, 54, 10, 56, -11,
+    57, 23, 58, -22, 59, -3, 60, 17, 61, -2, 62, -9, 63, 5, 55, -587,
+    1, 119, 2, -186, 3, -17, 4, 143, 5, -12, 6, -77, 7, 24, 8, 14,
+    9, -117, 10, -202, 11, 17, 12, 154, 13, 11, 14, -83, 15, -23, 16, -47,
+    18, 61, 20, -47, 22, 25, 24, 72, 25, 99, 26, 61, 27, -14, 28, -47,
+    29, -10, 30, 25, 31, 20, 32, -71, 33, -119, 34, -93, 35, 17, 36, 71,
+    37, 12, 38, -39, 39, -24, 40, 48, 41, 66, 42, 41, 43, -10, 44, -31,
+    45, -6, 46, 17, 47, 13, 48, -19, 50, 25, 52, -19, 54, 10, 56, 3,
+    57, -23, 58, -40, 59, 3, 60, 31, 61, 2, 62, -17, 63, -5, 51, -164,
+    1, -16, 2, 53, 3, 14, 4, 84, 5, 9, 6, -4, 7, -3, 8, 10,
+    9, 16, 10, -52, 11, -14, 12, 56, 13, -9, 14, 4, 15, 3, 16, 22,
+    20, -22, 24, -47, 25, -14, 26, 44, 27, 12, 28, -8, 29, 8, 30, -3,
+    31, -3, 32, 50, 33, 16, 34, -53, 35, -14, 36, 17, 37, -9, 38, 4,
+    39, 3, 40, -32, 41, -9, 42, 29, 43, 8, 44, -5, 45, 5, 46, -2,
+    47, -2, 48, 9, 52, -9, 56, 2, 57, 3, 58, -10, 59, -3, 60, 11,
+    61, -2, 62, 1, 63, 1, 51, 154, 1, 15, 2, -48, 3, -13, 4, -76,
+    5, -8, 6, 3, 7, 3, 8, -9, 9, -15, 10, 47, 11, 12, 12, -51,
+    13, 8, 14, -3, 15, -3, 16, -20, 20, 20, 24, 43, 25, 12, 26, -40,
+    27, -11, 28, 7, 29, -7, 30, 3, 31, 2, 32, -46, 33, -15, 34, 48,
+    35, 13, 36, -15, 37, 8, 38, -3, 39, -3, 40, 29, 41, 8, 42, -27,
+    43, -7, 44, 5, 45, -5, 46, 2, 47, 2, 48, -8, 52, 8, 56, -2,
+    57, -3, 58, 9, 59, 2, 60, -10, 61, 2, 62, -1, 63, -1, 63, -463,
+    1, -179, 2, -256, 3, 26, 4, 196, 5, 17, 6, -106, 7, -36, 8, 19,
+    9, 34, 10, -78, 11, -5, 12, 60, 13, -3, 14, -32, 15, 7, 16, 23,
+    17, -78, 18, 91, 19, 11, 20, -70, 21, 8, 22, 38, 23, -16, 24, 194,
+    25, -169, 26, 11, 27, 25, 28, -9, 29, 16, 30, 5, 31, -34, 32, -89,
+    33, 60, 34, 23, 35, -9, 36, -18, 37, -6, 38, 10, 39, 12, 40, 129,
+    41, -113, 42, 8, 43, 16, 44, -6, 45, 11, 46, 3, 47, -23, 48, 10,
+    49, -32, 50, 38, 51, 5, 52, -29, 53, 3, 54, 16, 55, -6, 56, 4,
+    57, 7, 58, -16, 59, -1, 60, 12, 61, -1, 62, -6, 63, 1, 63, -641,
+    1, 179, 2, -23, 3, -26, 4, 18, 5, -17, 6, -10, 7, 36, 8, -101,
+    9, -34, 10, 78, 11, 5, 12, -60, 13, 3, 14, 32, 15, -7, 16, 70,
+    17, 78, 18, 30, 19, -11, 20, -23, 21, -8, 22, 13, 23, 16, 24, 211,
+    25, 169, 26, -11, 27, -25, 28, 9, 29, -16, 30, -5, 31, 34, 32, -125,
+    33, -60, 34, 70, 35, 9, 36, -53, 37, 6, 38, 29, 39, -12, 40, 141,
+    41, 113, 42, -8, 43, -16, 44, 6, 45, -11, 46, -3, 47, 23, 48, 29,
+    49, 32, 50, 13, 51, -5, 52, -10, 53, -3, 54, 5, 55, 6, 56, -20,
+    57, -7, 58, 16, 59, 1, 60, -12, 61, 1, 62, 6, 63, -1, 58, -164,
+    1, -41, 2, 79, 3, 35, 4, 50, 5, 23, 6, -6, 7, -8, 8, 19,
+    9, -27, 10, -15, 11, 23, 13, 16, 14, 1, 15, -5, 16, -22, 17, 11,
+    18, 34, 19, -9, 20, -22, 21, -6, 22, -2, 23, 2, 24, -95, 25, 4,
+    26, 75, 27, -3, 29, -2, 30, -5, 31, 1, 32, 50, 33, -8, 34, -26,
+    35, 7, 36, -17, 37, 5, 38, 2, 39, -2, 40, -63, 41, 3, 42, 50,
+    43, -2, 45, -2, 46, -4, 47, 1, 48, -9, 49, 4, 50, 14, 51, -4,
+    52, -9, 53, -3, 54, -1, 55, 1, 56, 4, 57, -5, 58, -3, 59, 5,
+    61, 3, 63, -1, 57, 154, 1, 37, 2, -72, 3, -32, 4, -46, 5, -21,
+    6, 5, 7, 7, 8, -18, 9, 25, 10, 14, 11, -21, 13, -14, 14, -1,
+    15, 5, 16, 20, 17, -10, 18, -31, 19, 8, 20, 20, 21, 6, 22, 2,
+    23, -2, 24, 87, 25, -4, 26, -68, 27, 3, 29, 2, 30, 5, 31, -1,
+    32, -46, 33, 7, 34, 24, 35, -6, 36, 15, 37, -4, 38, -2, 39, 1,
+    40, 58, 41, -2, 42, -46, 43, 2, 45, 1, 46, 3, 48, 8, 49, -4,
+    50, -13, 51, 3, 52, 8, 53, 2, 54, 1, 55, -1, 56, -3, 57, 5,
+    58, 3, 59, -4, 61, -3, 63, 1, 63, -569, 1, -60, 2, -303, 3, 9,
+    4, 232, 5, 6, 6, -125, 7, -12, 8, 124, 9, -83, 10, -32, 11, 12,
+    12, 25, 13, 8, 14, -13, 15, -16, 16, 23, 17, -78, 18, 91, 19, 11,
+    20, -70, 21, 8, 22, 38, 23, -16, 24, 105, 25, -70, 26, -27, 27, 10,
+    28, 21, 29, 7, 30, -11, 31, -14, 32, 18, 33, -60, 34, 70, 35, 9,
+    36, -53, 37, 6, 38, 29, 39, -12, 40, 70, 41, -47, 42, -18, 43, 7,
+    44, 14, 45, 5, 46, -8, 47, -9, 48, 10, 49, -32, 50, 38, 51, 5,
+    52, -29, 53, 3, 54, 16, 55, -6, 56, 25, 57, -16, 58, -6, 59, 2,
+    60, 5, 61, 2, 62, -3, 63, -3, 63, -819, 1, 60, 2, 23, 3, -9,
+    4, -18, 5, -6, 6, 10, 7, 12, 8, 74, 9, 83, 10, 32, 11, -12,
+    12, -25, 13, -8, 14, 13, 15, 16, 16, 70, 17, 78, 18, 30, 19, -11,
+    20, -23, 21, -8, 22, 13, 23, 16, 24, 63, 25, 70, 26, 27, 27, -10,
+    28, -21, 29, -7, 30, 11, 31, 14, 32, 53, 33, 60, 34, 23, 35, -9,
+    36, -18, 37, -6, 38, 10, 39, 12, 40, 42, 41, 47, 42, 18, 43, -7,
+    44, -14, 45, -5, 46, 8, 47, 9, 48, 29, 49, 32, 50, 13, 51, -5,
+    52, -10, 53, -3, 54, 5, 55, 6, 56, 15, 57, 16, 58, 6, 59, -2,
+    60, -5, 61, -2, 62, 3, 63, 3, 58, -97, 1, -57, 2, 26, 3, 49,
+    4, 50, 5, 33, 6, -2, 7, -11, 8, -46, 9, -11, 10, 37, 11, 10,
+    13, 6, 14, -3, 15, -2, 16, -22, 17, 11, 18, 34, 19, -9, 20, -22,
+    21, -6, 22, -2, 23, 2, 24, -39, 25, -10, 26, 31, 27, 8, 29, 5,
+    30, -2, 31, -2, 32, -17, 33, 8, 34, 26, 35, -7, 36, -17, 37, -5,
+    38, -2, 39, 2, 40, -26, 41, -6, 42, 21, 43, 5, 45, 4, 46, -1,
+    47, -1, 48, -9, 49, 4, 50, 14, 51, -4, 52, -9, 53, -3, 54, -1,
+    55, 1, 56, -9, 57, -2, 58, 7, 59, 2, 61, 1, 62, -1, 57, 94,
+    1, 52, 2, -24, 3, -44, 4, -46, 5, -30, 6, 2, 7, 10, 8, 42,
+    9, 10, 10, -33, 11, -9, 13, -6, 14, 2, 15, 2, 16, 20, 17, -10,
+    18, -31, 19, 8, 20, 20, 21, 6, 22, 2, 23, -2, 24, 36, 25, 9,
+    26, -28, 27, -7, 29, -5, 30, 2, 31, 2, 32, 15, 33, -7, 34, -24,
+    35, 6, 36, 15, 37, 4, 38, 2, 39, -1, 40, 24, 41, 6, 42, -19,
+    43, -5, 45, -3, 46, 1, 47, 1, 48, 8, 49, -4, 50, -13, 51, 3,
+    52, 8, 53, 2, 54, 1, 55, -1, 56, 8, 57, 2, 58, -7, 59, -2,
+    61, -1, 63, -569, 1, -144, 2, -163, 3, -4, 4, 160, 5, -2, 6, -67,
+    7, -29, 8, 39, 9, 83, 10, -169, 11, -46, 12, 179, 13, -31, 14, -70,
+    15, 16, 16, -23, 17, -32, 18, 91, 19, -27, 20, -23, 21, -18, 22, 38,
+    23, -6, 24, 92, 25, -128, 26, 89, 27, -10, 28, -26, 29, -7, 30, 37,
+    31, -26, 32, -53, 33, 95, 34, -70, 35, -38, 36, 89, 37, -26, 38, -29,
+    39, 19, 40, 62, 41, -86, 42, 59, 43, -7, 44, -17, 45, -5, 46, 25,
+    47, -17, 48, -10, 49, -13, 50, 38, 51, -11, 52, -10, 53, -8, 54, 16,
+    55, -3, 56, 8, 57, 16, 58, -34, 59, -9, 60, 36, 61, -6, 62, -14,
+    63, 3, 63, -463, 1, 179, 2, -256, 3, -26, 4, 196, 5, -17, 6, -106,
+    7, 36, 8, 19, 9, -34, 10, -78, 11, 5, 12, 60, 13, 3, 14, -32,
+    15, -7, 16, 23, 17, 78, 18, 91, 19, -11, 20, -70, 21, -8, 22, 38,
+    23, 16, 24, 194, 25, 169, 26, 11, 27, -25, 28, -9, 29, -16, 30, 5,
+    31, 34, 32, -89, 33, -60, 34, 23, 35, 9, 36, -18, 37, 6, 38, 10,
+    39, -12, 40, 129, 41, 113, 42, 8, 43, -16, 44, -6, 45, -11, 46, 3,
+    47, 23, 48, 10, 49, 32, 50, 38, 51, -5, 52, -29, 53, -3, 54, 16,
+    55, 6, 56, 4, 57, -7, 58, -16, 59, 1, 60, 12, 61, 1, 62, -6,
+    63, -1, 58, -181, 1, 21, 2, 71, 3, -23, 4, 75, 5, -3, 6, -2,
+    7, 2, 8, -14, 9, -10, 10, -26, 11, 1, 12, 44, 13, 18, 14, 6,
+    15, -4, 17, 6, 18, 24, 19, -12, 20, -33, 21, 8, 22, 2, 23, -1,
+    24, -67, 25, 19, 26, 66, 27, -22, 28, -18, 29, -1, 30, -2, 31, 2,
+    32, 33, 33, -12, 34, -34, 35, 5, 36, 8, 37, 15, 38, 5, 39, -4,
+    40, -45, 41, 13, 42, 44, 43, -15, 44, -12, 46, -1, 47, 1, 49, 2,
+    50, 10, 51, -5, 52, -14, 53, 3, 54, 1, 56, -3, 57, -2, 58, -5,
+    60, 9, 61, 3, 62, 1, 63, -1, 58, 170, 1, -19, 2, -65, 3, 21,
+    4, -69, 5, 3, 6, 2, 7, -2, 8, 12, 9, 9, 10, 24, 11, -1,
+    12, -40, 13, -16, 14, -5, 15, 4, 17, -5, 18, -22, 19, 11, 20, 30,
+    21, -7, 22, -2, 23, 1, 24, 61, 25, -17, 26, -60, 27, 20, 28, 16,
+    29, 1, 30, 1, 31, -2, 32, -30, 33, 11, 34, 31, 35, -4, 36, -8,
+    37, -14, 38, -5, 39, 4, 40, 41, 41, -11, 42, -40, 43, 14, 44, 11,
+    46, 1, 47, -1, 49, -2, 50, -9, 51, 4, 52, 12, 53, -3, 54, -1,
+    56, 2, 57, 2, 58, 5, 60, -8, 61, -3, 62, -1, 63, 1, 63, -569,
+    1, -60, 2, -303, 3, 9, 4, 232, 5, 6, 6, -125, 7, -12, 8, 124,
+    9, -83, 10, -32, 11, 12, 12, 25, 13, 8, 14, -13, 15, -16, 16, 23,
+    17, -78, 18, 91, 19, 11, 20, -70, 21, 8, 22, 38, 23, -16, 24, 105,
+    25, -70, 26, -27, 27, 10, 28, 21, 29, 7, 30, -11, 31, -14, 32, 18,
+    33, -60, 34, 70, 35, 9, 36, -53, 37, 6, 38, 29, 39, -12, 40, 70,
+    41, -47, 42, -18, 43, 7, 44, 14, 45, 5, 46, -8, 47, -9, 48, 10,
+    49, -32, 50, 38, 51, 5, 52, -29, 53, 3, 54, 16, 55, -6, 56, 25,
+    57, -16, 58, -6, 59, 2, 60, 5, 61, 2, 62, -3, 63, -3, 63, -569,
+    1, 60, 2, -303, 3, -9, 4, 232, 5, -6, 6, -125, 7, 12, 8, 124,
+    9, 83, 10, -32, 11, -12, 12, 25, 13, -8, 14, -13, 15, 16, 16, 23,
+    17, 78, 18, 91, 19, -11, 20, -70, 21, -8, 22, 38, 23, 16, 24, 105,
+    25, 70, 26, -27, 27, -10, 28, 21, 29, -7, 30, -11, 31, 14, 32, 18,
+    33, 60, 34, 70, 35, -9, 36, -53, 37, -6, 38, 29, 39, 12, 40, 70,
+    41, 47, 42, -18, 43, -7, 44, 14, 45, -5, 46, -8, 47, 9, 48, 10,
+    49, 32, 50, 38, 51, -5, 52, -29, 53, -3, 54, 16, 55, 6, 56, 25,
+    57, 16, 58, -6, 59, -2, 60, 5, 61, -2, 62, -3, 63, 3, 31, -156,
+    2, 26, 4, 109, 6, -2, 8, -58, 10, 37, 12, 12, 14, -3, 16, -11,
+    18, 34, 20, -33, 22, -2, 24, -49, 26, 31, 28, 10, 30, -2, 32, -8,
+    34, 26, 36, -25, 38, -2, 40, -33, 42, 21, 44, 7, 46, -1, 48, -5,
+    50, 14, 52, -14, 54, -1, 56, -12, 58, 7, 60, 2, 62, -1, 30, 147,
+    2, -24, 4, -99, 6, 2, 8, 53, 10, -33, 12, -11, 14, 2, 16, 10,
+    18, -31, 20, 30, 22, 2, 24, 45, 26, -28, 28, -9, 30, 2, 32, 8,
+    34, -24, 36, 23, 38, 2, 40, 30, 42, -19, 44, -6, 46, 1, 48, 4,
+    50, -13, 52, 12, 54, 1, 56, 11, 58, -7, 60, -2, 63, -676, 1, -243,
+    2, 163, 3, -87, 4, 53, 5, -58, 6, 67, 7, -48, 8, -45, 9, 34,
+    10, 32, 11, -87, 12, 95, 13, -58, 14, 13, 15, 7, 16, -23, 17, 32,
+    18, -30, 19, 27, 20, -23, 21, 18, 22, -13, 23, 6, 24, 80, 25, -87,
+    26, 27, 27, 25, 28, -38, 29, 16, 30, 11, 31, -17, 32, -89, 33, 95,
+    34, -23, 35, -38, 36, 53, 37, -26, 38, -10, 39, 19, 40, 54, 41, -58,
+    42, 18, 43, 16, 44, -26, 45, 11, 46, 8, 47, -12, 48, -10, 49, 13,
+    50, -13, 51, 11, 52, -10, 53, 8, 54, -5, 55, 3, 56, -9, 57, 7,
+    58, 6, 59, -17, 60, 19, 61, -12, 62, 3, 63, 1, 63, -676, 1, 243,
+    2, 163, 3, 87, 4, 53, 5, 58, 6, 67, 7, 48, 8, -45, 9, -34,
+    10, 32, 11, 87, 12, 95, 13, 58, 14, 13, 15, -7, 16, -23, 17, -32,
+    18, -30, 19, -27, 20, -23, 21, -18, 22, -13, 23, -6, 24, 80, 25, 87,
+    26, 27, 27, -25, 28, -38, 29, -16, 30, 11, 31, 17, 32, -89, 33, -95,
+    34, -23, 35, 38, 36, 53, 37, 26, 38, -10, 39, -19, 40, 54, 41, 58,
+    42, 18, 43, -16, 44, -26, 45, -11, 46, 8, 47, 12, 48, -10, 49, -13,
+    50, -13, 51, -11, 52, -10, 53, -8, 54, -5, 55, -3, 56, -9, 57, -7,
+    58, 6, 59, 17, 60, 19, 61, 12, 62, 3, 63, -1, 31, -105, 2, 107,
+    4, -59, 6, 19, 8, 21, 10, -15, 12, -12, 14, 19, 16, 11, 18, -14,
+    20, 11, 22, -6, 24, -38, 26, 39, 28, -10, 30, -5, 32, 42, 34, -42,
+    36, 8, 38, 8, 40, -25, 42, 26, 44, -7, 46, -4, 48, 5, 50, -6,
+    52, 5, 54, -2, 56, 4, 58, -3, 60, -2, 62, 4, 31, 101, 2, -98,
+    4, 53, 6, -17, 8, -19, 10, 14, 12, 11, 14, -17, 16, -10, 18, 13,
+    20, -10, 22, 5, 24, 34, 26, -35, 28, 9, 30, 5, 32, -38, 34, 38,
+    36, -8, 38, -8, 40, 23, 42, -23, 44, 6, 46, 3, 48, -4, 50, 5,
+    52, -4, 54, 2, 56, -4, 58, 3, 60, 2, 62, -3, 55, -694, 1, -119,
+    2, -47, 3, 17, 4, 36, 5, 12, 6, -19, 7, -24, 8, -105, 9, 117,
+    10, -46, 11, -17, 12, 35, 13, -11, 14, -19, 15, 23, 16, -93, 18, 122,
+    20, -93, 22, 50, 24, 89, 25, -99, 26, 39, 27, 14, 28, -30, 29, 10,
+    30, 16, 31, -20, 32, -36, 33, 119, 34, -140, 35, -17, 36, 107, 37, -12,
+    38, -58, 39, 24, 40, 59, 41, -66, 42, 26, 43, 10, 44, -20, 45, 6,
+    46, 11, 47, -13, 48, -39, 50, 50, 52, -39, 54, 21, 56, -21, 57, 23,
+    58, -9, 59, -3, 60, 7, 61, -2, 62, -4, 63, 5, 58, -658, 1, 224,
+    2, 47, 3, -106, 4, -143, 5, -71, 6, 19, 7, 45, 8, 84, 9, 69,
+    10, -46, 11, -140, 12, -154, 13, -94, 14, -19, 15, 14, 16, -47, 17, -46,
+    19, 39, 20, 47, 21, 26, 23, -9, 24, 12, 25, 24, 26, 39, 27, 49,
+    28, 47, 29, 33, 30, 16, 31, 5, 33, -14, 34, -47, 35, -72, 36, -71,
+    37, -48, 38, -19, 39, -3, 40, 8, 41, 16, 42, 26, 43, 33, 44, 31,
+    45, 22, 46, 11, 47, 3, 48, -19, 49, -19, 51, 16, 52, 19, 53, 11,
+    55, -4, 56, 17, 57, 14, 58, -9, 59, -28, 60, -31, 61, -19, 62, -4,
+    63, 3, 62, -105, 1, -3, 2, 76, 3, -13, 5, 27, 6, -13, 7, -6,
+    8, 5, 9, 24, 10, -11, 11, -48, 12, 16, 13, 32, 14, -13, 15, -5,
+    16, 33, 17, 16, 18, -10, 19, -6, 20, -22, 21, -20, 22, 4, 23, 5,
+    24, -24, 25, -10, 26, 27, 27, 20, 28, -14, 29, -13, 30, 4, 31, 2,
+    32, 8, 33, -3, 34, -30, 35, -13, 36, 33, 37, 27, 38, -6, 39, -6,
+    40, -16, 41, -6, 42, 18, 43, 13, 44, -9, 45, -9, 46, 3, 47, 1,
+    48, 14, 49, 6, 50, -4, 51, -3, 52, -9, 53, -8, 54, 2, 55, 2,
+    56, 1, 57, 5, 58, -2, 59, -10, 60, 3, 61, 6, 62, -3, 63, -1,
+    62, 101, 1, 3, 2, -69, 3, 12, 5, -25, 6, 12, 7, 5, 8, -4,
+    9, -21, 10, 10, 11, 44, 12, -15, 13, -29, 14, 12, 15, 4, 16, -30,
+    17, -14, 18, 9, 19, 6, 20, 20, 21, 18, 22, -4, 23, -5, 24, 22,
+    25, 9, 26, -25, 27, -18, 28, 13, 29, 12, 30, -3, 31, -2, 32, -8,
+    33, 3, 34, 27, 35, 12, 36, -30, 37, -25, 38, 5, 39, 5, 40, 14,
+    41, 6, 42, -17, 43, -12, 44, 8, 45, 8, 46, -2, 47, -1, 48, -12,
+    49, -6, 50, 4, 51, 2, 52, 8, 53, 8, 54, -2, 55, -2, 56, -1,
+    57, -4, 58, 2, 59, 9, 60, -3, 61, -6, 62, 2, 63, 1, 51, -552,
+    1, -84, 2, -279, 3, -12, 4, 249, 5, -8, 6, -116, 7, -17, 8, 134,
+    9, -97, 10, -19, 12, 35, 14, -8, 15, -19, 17, -46, 18, 61, 19, 39,
+    20, -93, 21, 26, 22, 25, 23, -9, 24, 54, 26, -93, 27, 70, 28, -30,
+    29, 47, 30, -39, 32, -36, 33, 14, 35, 72, 36, -107, 37, 48, 39, 3,
+    40, 36, 42, -62, 43, 47, 44, -20, 45, 31, 46, -26, 49, -19, 50, 25,
+    51, 16, 52, -39, 53, 11, 54, 10, 55, -4, 56, 27, 57, -19, 58, -4,
+    60, 7, 62, -2, 63, -4, 59, -694, 1, 119, 2, -47, 3, -17, 4, 36,
+    5, -12, 6, -19, 7, 24, 8, -35, 9, 48, 10, 137, 11, 41, 12, -35,
+    13, 27, 14, 57, 15, 10, 16, -93, 17, -91, 19, 77, 20, 93, 21, 52,
+    23, -18, 24, 30, 25, -41, 26, -116, 27, -35, 28, 30, 29, -23, 30, -48,
+    31, -8, 32, -36, 33, 20, 34, 47, 35, -101, 36, -178, 37, -68, 38, 19,
+    39, 4, 40, 20, 41, -27, 42, -78, 43, -23, 44, 20, 45, -16, 46, -32,
+    47, -5, 48, -39, 49, -38, 51, 32, 52, 39, 53, 21, 55, -8, 56, -7,
+    57, 10, 58, 27, 59, 8, 60, -7, 61, 5, 62, 11, 63, 2, 63, -130,
+    1, -37, 2, 45, 3, 26, 4, 59, 5, 29, 6, -1, 7, -9, 8, -23,
+    9, -34, 10, 32, 11, 36, 12, -21, 13, 7, 14, 4, 15, -4, 16, 22,
+    17, -7, 18, -10, 19, 27, 20, -11, 21, -30, 22, 4, 23, 6, 24, -20,
+    25, -1, 26, -9, 27, 7, 28, 38, 29, -9, 30, -11, 31, 2, 32, 17,
+    33, -4, 34, 1, 35, -2, 36, -8, 37, 11, 38, -19, 39, -3, 40, -13,
+    41, -1, 42, -6, 43, 5, 44, 25, 45, -6, 46, -8, 47, 1, 48, 9,
+    49, -3, 50, -4, 51, 11, 52, -5, 53, -12, 54, 2, 55, 2, 56, -5,
+    57, -7, 58, 6, 59, 7, 60, -4, 61, 1, 62, 1, 63, -1, 63, 124,
+    1, 33, 2, -41, 3, -23, 4, -53, 5, -27, 6, 1, 7, 8, 8, 21,
+    9, 31, 10, -29, 11, -33, 12, 19, 13, -7, 14, -4, 15, 4, 16, -20,
+    17, 6, 18, 9, 19, -24, 20, 10, 21, 27, 22, -4, 23, -5, 24, 18,
+    25, 1, 26, 8, 27, -7, 28, -34, 29, 9, 30, 10, 31, -2, 32, -15,
+    33, 3, 34, -1, 35, 2, 36, 8, 37, -10, 38, 17, 39, 2, 40, 12,
+    41, 1, 42, 6, 43, -4, 44, -23, 45, 6, 46, 7, 47, -1, 48, -8,
+    49, 3, 50, 4, 51, -10, 52, 4, 53, 11, 54, -2, 55, -2, 56, 4,
+    57, 6, 58, -6, 59, -7, 60, 4, 61, -1, 62, -1, 63, 1, 52, -516,
+    1, -119, 2, -279, 3, 17, 4, 214, 5, 12, 6, -116, 7, -24, 8, -55,
+    9, 117, 10, -110, 11, -17, 12, 84, 13, -11, 14, -46, 15, 23, 16, -47,
+    18, 61, 20, -47, 22, 25, 24, 131, 25, -99, 26, -16, 27, 14, 28, 12,
+    29, 10, 30, -7, 31, -20, 32, -143, 33, 119, 35, -17, 37, -12, 39, 24,
+    40, 87, 41, -66, 42, -11, 43, 10, 44, 8, 45, 6, 46, -4, 47, -13,
+    48, -19, 50, 25, 52, -19, 54, 10, 56, -11, 57, 23, 58, -22, 59, -3,
+    60, 17, 61, -2, 62, -9, 63, 5, 47, -694, 1, 119, 2, -47, 3, -17,
+    4, 36, 5, -12, 6, -19, 7, 24, 8, -175, 9, -117, 10, 46, 11, 17,
+    12, -35, 13, 11, 14, 19, 15, -23, 24, 148, 25, 99, 26, -39, 27, -14,
+    28, 30, 29, -10, 30, -16, 31, 20, 32, -178, 33, -119, 34, 47, 35, 17,
+    36, -36, 37, 12, 38, 19, 39, -24, 40, 99, 41, 66, 42, -26, 43, -10,
+    44, 20, 45, -6, 46, -11, 47, 13, 56, -35, 57, -23, 58, 9, 59, 3,
+    60, -7, 61, 2, 62, 4, 63, -5, 59, -139, 1, -41, 2, 53, 3, 35,
+    4, 59, 5, 23, 6, -4, 7, -8, 8, 54, 9, -27, 10, -52, 11, 23,
+    12, 12, 13, 16, 14, 4, 15, -5, 16, 11, 17, 11, 19, -9, 20, -11,
+    21, -6, 23, 2, 24, -65, 25, 4, 26, 44, 27, -3, 28, 10, 29, -2,
+    30, -3, 31, 1, 32, 75, 33, -8, 34, -53, 35, 7, 36, -8, 37, 5,
+    38, 4, 39, -2, 40, -44, 41, 3, 42, 29, 43, -2, 44, 7, 45, -2,
+    46, -2, 47, 1, 48, 5, 49, 4, 51, -4, 52, -5, 53, -3, 55, 1,
+    56, 11, 57, -5, 58, -10, 59, 5, 60, 2, 61, 3, 62, 1, 63, -1,
+    58, 132, 1, 37, 2, -48, 3, -32, 4, -53, 5, -21, 6, 3, 7, 7,
+    8, -49, 9, 25, 10, 47, 11, -21, 12, -11, 13, -14, 14, -3, 15, 5,
+    16, -10, 17, -10, 19, 8, 20, 10, 21, 6, 23, -2, 24, 60, 25, -4,
+    26, -40, 27, 3, 28, -9, 29, 2, 30, 3, 31, -1, 32, -69, 33, 7,
+    34, 48, 35, -6, 36, 8, 37, -4, 38, -3, 39, 1, 40, 40, 41, -2,
+    42, -27, 43, 2, 44, -6, 45, 1, 46, 2, 48, -4, 49, -4, 51, 3,
+    52, 4, 53, 2, 55, -1, 56, -10, 57, 5, 58, 9, 59, -4, 60, -2,
+    61, -3, 62, -1, 63, 1, 63, -605, 1, -25, 2, -303, 3, -21, 4, 267,
+    5, -14, 6, -125, 7, -5, 8, 74, 9, -34, 10, -32, 11, -29, 12, 74,
+    13, -19, 14, -13, 15, -7, 16, -23, 17, -32, 18, 91, 19, -27, 20, -23,
+    21, -18, 22, 38, 23, -6, 24, 63, 25, -29, 26, -27, 27, -25, 28, 63,
+    29, -16, 30, -11, 31, -6, 32, -18, 33, -25, 34, 70, 35, -21, 36, -18,
+    37, -14, 38, 29, 39, -5, 40, 42, 41, -19, 42, -18, 43, -16, 44, 42,
+    45, -11, 46, -8, 47, -4, 48, -10, 49, -13, 50, 38, 51, -11, 52, -10,
+    53, -8, 54, 16, 55, -3, 56, 15, 57, -7, 58, -6, 59, -6, 60, 15,
+    61, -4, 62, -3, 63, -1, 63, -605, 1, 25, 2, -303, 3, 21, 4, 267,
+    5, 14, 6, -125, 7, 5, 8, 74, 9, 34, 10, -32, 11, 29, 12, 74,
+    13, 19, 14, -13, 15, 7, 16, -23, 17, 32, 18, 91, 19, 27, 20, -23,
+    21, 18, 22, 38, 23, 6, 24, 63, 25, 29, 26, -27, 27, 25, 28, 63,
+    29, 16, 30, -11, 31, 6, 32, -18, 33, 25, 34, 70, 35, 21, 36, -18,
+    37, 14, 38, 29, 39, 5, 40, 42, 41, 19, 42, -18, 43, 16, 44, 42,
+    45, 11, 46, -8, 47, 4, 48, -10, 49, 13, 50, 38, 51, 11, 52, -10,
+    53, 8, 54, 16, 55, 3, 56, 15, 57, 7, 58, -6, 59, 6, 60, 15,
+    61, 4, 62, -3, 63, 1, 31, -139, 2, 11, 4, 109, 6, 5, 8, -35,
+    10, 15, 12, 12, 14, 6, 16, 11, 18, 14, 20, -33, 22, 6, 24, -29,
+    26, 13, 28, 10, 30, 5, 32, 8, 34, 11, 36, -25, 38, 5, 40, -20,
+    42, 9, 44, 7, 46, 4, 48, 5, 50, 6, 52, -14, 54, 2, 56, -7,
+    58, 3, 60, 2, 62, 1, 31, 132, 2, -10, 4, -99, 6, -4, 8, 32,
+    10, -14, 12, -11, 14, -6, 16, -10, 18, -13, 20, 30, 22, -5, 24, 27,
+    26, -12, 28, -9, 30, -5, 32, -8, 34, -10, 36, 23, 38, -4, 40, 18,
+    42, -8, 44, -6, 46, -3, 48, -4, 50, -5, 52, 12, 54, -2, 56, 6,
+    58, -3, 60, -2, 62, -1, 63, -605, 1, -25, 2, -303, 3, -21, 4, 267,
+    5, -14, 6, -125, 7, -5, 8, 74, 9, -34, 10, -32, 11, -29, 12, 74,
+    13, -19, 14, -13, 15, -7, 16, -23, 17, -32, 18, 91, 19, -27, 20, -23,
+    21, -18, 22, 38, 23, -6, 24, 63, 25, -29, 26, -27, 27, -25, 28, 63,
+    29, -16, 30, -11, 31, -6, 32, -18, 33, -25, 34, 70, 35, -21, 36, -18,
+    37, -14, 38, 29, 39, -5, 40, 42, 41, -19, 42, -18, 43, -16, 44, 42,
+    45, -11, 46, -8, 47, -4, 48, -10, 49, -13, 50, 38, 51, -11, 52, -10,
+    53, -8, 54, 16, 55, -3, 56, 15, 57, -7, 58, -6, 59, -6, 60, 15,
+    61, -4, 62, -3, 63, -1, 63, -534, 1, 95, 2, -303, 3, -38, 4, 196,
+    5, -26, 6, -125, 7, 19, 8, 144, 9, 103, 10, -32, 11, -29, 12, 4,
+    13, -19, 14, -13, 15, 20, 16, -23, 17, 32, 18, 91, 19, 27, 20, -23,
+    21, 18, 22, 38, 23, 6, 24, 4, 25, -29, 26, -27, 27, 74, 28, 122,
+    29, 49, 30, -11, 31, -6, 32, -89, 33, -45, 34, 70, 35, 80, 36, 53,
+    37, 54, 38, 29, 39, -9, 40, 2, 41, -19, 42, -18, 43, 49, 44, 82,
+    45, 33, 46, -8, 47, -4, 48, -10, 49, 13, 50, 38, 51, 11, 52, -10,
+    53, 8, 54, 16, 55, 3, 56, 29, 57, 20, 58, -6, 59, -6, 60, 1,
+    61, -4, 62, -3, 63, 4, 50, -156, 1, 9, 2, 26, 3, -18, 4, 109,
+    5, 12, 6, -2, 7, -2, 8, -51, 9, 9, 10, 30, 11, -18, 12, 12,
+    13, 12, 15, -2, 16, 11, 18, 14, 20, -33, 22, 6, 24, -16, 25, -7,
+    27, 15, 28, 10, 29, -10, 30, 11, 31, 1, 32, 25, 33, -9, 34, -5,
+    35, 18, 36, -25, 37, -12, 38, 11, 39, 2, 40, -10, 41, -5, 43, 10,
+    44, 7, 45, -7, 46, 7, 47, 1, 48, 5, 50, 6, 52, -14, 54, 2,
+    56, -10, 57, 2, 58, 6, 59, -4, 60, 2, 61, 2, 50, 147, 1, -8,
+    2, -24, 3, 17, 4, -99, 5, -11, 6, 2, 7, 2, 8, 47, 9, -8,
+    10, -28, 11, 16, 12, -11, 13, -11, 15, 2, 16, -10, 18, -13, 20, 30,
+    22, -5, 24, 14, 25, 7, 27, -14, 28, -9, 29, 9, 30, -10, 31, -1,
+    32, -23, 33, 8, 34, 4, 35, -17, 36, 23, 37, 11, 38, -10, 39, -2,
+    40, 9, 41, 4, 43, -9, 44, -6, 45, 6, 46, -6, 47, -1, 48, -4,
+    50, -5, 52, 12, 54, -2, 56, 9, 57, -2, 58, -5, 59, 3, 60, -2,
+    61, -2, 55, -587, 1, -119, 2, -186, 3, 17, 4, 143, 5, 12, 6, -77,
+    7, -24, 8, 14, 9, 117, 10, -202, 11, -17, 12, 154, 13, -11, 14, -83,
+    15, 23, 16, -47, 18, 61, 20, -47, 22, 25, 24, 72, 25, -99, 26, 61,
+    27, 14, 28, -47, 29, 10, 30, 25, 31, -20, 32, -71, 33, 119, 34, -93,
+    35, -17, 36, 71, 37, -12, 38, -39, 39, 24, 40, 48, 41, -66, 42, 41,
+    43, 10, 44, -31, 45, 6, 46, 17, 47, -13, 48, -19, 50, 25, 52, -19,
+    54, 10, 56, 3, 57, 23, 58, -40, 59, -3, 60, 31, 61, -2, 62, -17,
+    63, 5, 55, -587, 1, 119, 2, -186, 3, -17, 4, 143, 5, -12, 6, -77,
+    7, 24, 8, 14, 9, -117, 10, -202, 11, 17, 12, 154, 13, 11, 14, -83,
+    15, -23, 16, -47, 18, 61, 20, -47, 22, 25, 24, 72, 25, 99, 26, 61,
+    27, -14, 28, -47, 29, -10, 30, 25, 31, 20, 32, -71, 33, -119, 34, -93,
+    35, 17, 36, 71, 37, 12, 38, -39, 39, -24, 40, 48, 41, 66, 42, 41,
+    43, -10, 44, -31, 45, -6, 46, 17, 47, 13, 48, -19, 50, 25, 52, -19,
+    54, 10, 56, 3, 57, -23, 58, -40, 59, 3, 60, 31, 61, 2, 62, -17,
+    63, -5, 27, -147, 2, 53, 4, 67, 6, -4, 8, -7, 10, -52, 12, 72,
+    14, 4, 16, 22, 20, -22, 24, -34, 26, 44, 28, -22, 30, -3, 32, 33,
+    34, -53, 36, 33, 38, 4, 40, -22, 42, 29, 44, -15, 46, -2, 48, 9,
+    52, -9, 56, -1, 58, -10, 60, 14, 62, 1, 27, 139, 2, -48, 4, -61,
+    6, 3, 8, 6, 10, 47, 12, -66, 14, -3, 16, -20, 20, 20, 24, 31,
+    26, -40, 28, 20, 30, 3, 32, -30, 34, 48, 36, -30, 38, -3, 40, 20,
+    42, -27, 44, 13, 46, 2, 48, -8, 52, 8, 56, 1, 58, 9, 60, -13,
+    62, -1, 63, -569, 1, -60, 2, -303, 3, 9, 4, 232, 5, 6, 6, -125,
+    7, -12, 8, 124, 9, -83, 10, -32, 11, 12, 12, 25, 13, 8, 14, -13,
+    15, -16, 16, 23, 17, -78, 18, 91, 19, 11, 20, -70, 21, 8, 22, 38,
+    23, -16, 24, 105, 25, -70, 26, -27, 27, 10, 28, 21, 29, 7, 30, -11,
+    31, -14, 32, 18, 33, -60, 34, 70, 35, 9, 36, -53, 37, 6, 38, 29,
+    39, -12, 40, 70, 41, -47, 42, -18, 43, 7, 44, 14, 45, 5, 46, -8,
+    47, -9, 48, 10, 49, -32, 50, 38, 51, 5, 52, -29, 53, 3, 54, 16,
+    55, -6, 56, 25, 57, -16, 58, -6, 59, 2, 60, 5, 61, 2, 62, -3,
+    63, -3, 63, -819, 1, 60, 2, 23, 3, -9, 4, -18, 5, -6, 6, 10,
+    7, 12, 8, 74, 9, 83, 10, 32, 11, -12, 12, -25, 13, -8, 14, 13,
+    15, 16, 16, 70, 17, 78, 18, 30, 19, -11, 20, -23, 21, -8, 22, 13,
+    23, 16, 24, 63, 25, 70, 26, 27, 27, -10, 28, -21, 29, -7, 30, 11,
+    31, 14, 32, 53, 33, 60, 34, 23, 35, -9, 36, -18, 37, -6, 38, 10,
+    39, 12, 40, 42, 41, 47, 42, 18, 43, -7, 44, -14, 45, -5, 46, 8,
+    47, 9, 48, 29, 49, 32, 50, 13, 51, -5, 52, -10, 53, -3, 54, 5,
+    55, 6, 56, 15, 57, 16, 58, 6, 59, -2, 60, -5, 61, -2, 62, 3,
+    63, 3, 58, -97, 1, -57, 2, 26, 3, 49, 4, 50, 5, 33, 6, -2,
+    7, -11, 8, -46, 9, -11, 10, 37, 11, 10, 13, 6, 14, -3, 15, -2,
+    16, -22, 17, 11, 18, 34, 19, -9, 20, -22, 21, -6, 22, -2, 23, 2,
+    24, -39, 25, -10, 26, 31, 27, 8, 29, 5, 30, -2, 31, -2, 32, -17,
+    33, 8, 34, 26, 35, -7, 36, -17, 37, -5, 38, -2, 39, 2, 40, -26,
+    41, -6, 42, 21, 43, 5, 45, 4, 46, -1, 47, -1, 48, -9, 49, 4,
+    50, 14, 51, -4, 52, -9, 53, -3, 54, -1, 55, 1, 56, -9, 57, -2,
+    58, 7, 59, 2, 61, 1, 62, -1, 57, 94, 1, 52, 2, -24, 3, -44,
+    4, -46, 5, -30, 6, 2, 7, 10, 8, 42, 9, 10, 10, -33, 11, -9,
+    13, -6, 14, 2, 15, 2, 16, 20, 17, -10, 18, -31, 19, 8, 20, 20,
+    21, 6, 22, 2, 23, -2, 24, 36, 25, 9, 26, -28, 27, -7, 29, -5,
+    30, 2, 31, 2, 32, 15, 33, -7, 34, -24, 35, 6, 36, 15, 37, 4,
+    38, 2, 39, -1, 40, 24, 41, 6, 42, -19, 43, -5, 45, -3, 46, 1,
+    47, 1, 48, 8, 49, -4, 50, -13, 51, 3, 52, 8, 53, 2, 54, 1,
+    55, -1, 56, 8, 57, 2, 58, -7, 59, -2, 61, -1, 55, -552, 1, -169,
+    2, -140, 3, -25, 4, 178, 5, -16, 6, -58, 7, -34, 8, 49, 9, 69,
+    10, -156, 11, -58, 12, 189, 13, -39, 14, -65, 15, 14, 16, -47, 18, 61,
+    20, -47, 22, 25, 24, 42, 25, -58, 26, 23, 27, 49, 28, -77, 29, 33,
+    30, 9, 31, -12, 32, -107, 33, 169, 34, -140, 35, 25, 36, 36, 37, 16,
+    38, -58, 39, 34, 40, 28, 41, -39, 42, 15, 43, 33, 44, -51, 45, 22,
+    46, 6, 47, -8, 48, -19, 50, 25, 52, -19, 54, 10, 56, 10, 57, 14,
+    58, -31, 59, -12, 60, 38, 61, -8, 62, -13, 63, 3, 47, -552, 1, 169,
+    2, -140, 3, 25, 4, 178, 5, 16, 6, -58, 7, 34, 8, 49, 10, -65,
+    12, 49, 14, -27, 16, -47, 17, -91, 18, -61, 19, 77, 20, 140, 21, 52,
+    22, -25, 23, -18, 24, 42, 26, -55, 28, 42, 30, -23, 32, -107, 33, -29,
+    34, 47, 35, -143, 36, -249, 37, -96, 38, 19, 39, -6, 40, 28, 42, -37,
+    44, 28, 46, -15, 48, -19, 49, -38, 50, -25, 51, 32, 52, 58, 53, 21,
+    54, -10, 55, -8, 56, 10, 58, -13, 60, 10, 62, -5, 57, -164, 2, 75,
+    4, 50, 6, 5, 8, -23, 9, -7, 10, -15, 11, -4, 12, 40, 13, 21,
+    14, 6, 15, -5, 16, 22, 17, 10, 18, -20, 19, 6, 21, -28, 22, 8,
+    23, 7, 24, -20, 25, 6, 26, 13, 27, 4, 28, 6, 29, -18, 30, -5,
+    31, 4, 32, 50, 33, -15, 34, -44, 35, -9, 36, 17, 37, 43, 38, -18,
+    39, -10, 40, -13, 41, 4, 42, 9, 43, 2, 44, 4, 45, -12, 46, -4,
+    47, 3, 48, 9, 49, 4, 50, -8, 51, 2, 53, -12, 54, 3, 55, 3,
+    56, -5, 57, -1, 58, -3, 59, -1, 60, 8, 61, 4, 62, 1, 63, -1,
+    57, 154, 2, -68, 4, -46, 6, -5, 8, 21, 9, 7, 10, 14, 11, 4,
+    12, -36, 13, -19, 14, -6, 15, 4, 16, -20, 17, -9, 18, 18, 19, -5,
+    21, 26, 22, -8, 23, -6, 24, 18, 25, -6, 26, -12, 27, -3, 28, -5,
+    29, 16, 30, 5, 31, -4, 32, -46, 33, 14, 34, 40, 35, 8, 36, -15,
+    37, -39, 38, 16, 39, 9, 40, 12, 41, -4, 42, -8, 43, -2, 44, -4,
+    45, 11, 46, 3, 47, -3, 48, -8, 49, -4, 50, 8, 51, -2, 53, 11,
+    54, -3, 55, -2, 56, 4, 57, 1, 58, 3, 59, 1, 60, -7, 61, -4,
+    62, -1, 63, 1, 63, -534, 1, -109, 2, -256, 3, -33, 4, 267, 5, -22,
+    6, -106, 7, -22, 8, 158, 9, -131, 10, 13, 11, -29, 12, 60, 13, -19,
+    14, 6, 15, -26, 16, 23, 17, -78, 18, 91, 19, 11, 20, -70, 21, 8,
+    22, 38, 23, -16, 24, 75, 25, -29, 26, -66, 27, 45, 28, -9, 29, 30,
+    30, -27, 31, -6, 32, -18, 33, -10, 34, 23, 35, 51, 36, -89, 37, 34,
+    38, 10, 39, -2, 40, 50, 41, -19, 42, -44, 43, 30, 44, -6, 45, 20,
+    46, -18, 47, -4, 48, 10, 49, -32, 50, 38, 51, 5, 52, -29, 53, 3,
+    54, 16, 55, -6, 56, 32, 57, -26, 58, 3, 59, -6, 60, 12, 61, -4,
+    62, 1, 63, -5, 63, -641, 1, 179, 2, -23, 3, -26, 4, 18, 5, -17,
+    6, -10, 7, 36, 8, 39, 9, 131, 10, 169, 11, 29, 12, -60, 13, 19,
+    14, 70, 15, 26, 16, -23, 17, -13, 18, 30, 19, 66, 20, 70, 21, 44,
+    22, 13, 23, -3, 24, 92, 25, 29, 26, -89, 27, -45, 28, 9, 29, -30,
+    30, -37, 31, 6, 32, 18, 33, 80, 34, 70, 35, -110, 36, -196, 37, -73,
+    38, 29, 39, 16, 40, 62, 41, 19, 42, -59, 43, -30, 44, 6, 45, -20,
+    46, -25, 47, 4, 48, -10, 49, -6, 50, 13, 51, 27, 52, 29, 53, 18,
+    54, 5, 55, -1, 56, 8, 57, 26, 58, 34, 59, 6, 60, -12, 61, 4,
+    62, 14, 63, 5, 59, -147, 1, -32, 2, 64, 3, 17, 4, 50, 5, 35,
+    6, 1, 7, -10, 8, -46, 9, -27, 10, 58, 11, 23, 12, -33, 13, 16,
+    14, 6, 15, -5, 17, -1, 18, 14, 19, 15, 20, -22, 21, -22, 22, 6,
+    23, 4, 24, -39, 25, 4, 26, 13, 27, -3, 28, 28, 29, -2, 30, -10,
+    31, 1, 33, 1, 34, 20, 35, -11, 36, -17, 37, 17, 38, -17, 39, -3,
+    40, -26, 41, 3, 42, 9, 43, -2, 44, 19, 45, -2, 46, -7, 47, 1,
+    50, 6, 51, 6, 52, -9, 53, -9, 54, 2, 55, 2, 56, -9, 57, -5,
+    58, 12, 59, 5, 60, -7, 61, 3, 62, 1, 63, -1, 58, 139, 1, 29,
+    2, -58, 3, -15, 4, -46, 5, -32, 6, -1, 7, 9, 8, 42, 9, 25,
+    10, -53, 11, -21, 12, 30, 13, -14, 14, -6, 15, 5, 17, 1, 18, -13,
+    19, -13, 20, 20, 21, 20, 22, -5, 23, -4, 24, 36, 25, -4, 26, -12,
+    27, 3, 28, -25, 29, 2, 30, 9, 31, -1, 33, -1, 34, -18, 35, 10,
+    36, 15, 37, -15, 38, 16, 39, 3, 40, 24, 41, -2, 42, -8, 43, 2,
+    44, -17, 45, 1, 46, 6, 50, -5, 51, -6, 52, 8, 53, 8, 54, -2,
+    55, -2, 56, 8, 57, 5, 58, -11, 59, -4, 60, 6, 61, -3, 62, -1,
+    63, 1, 63, -641, 1, -179, 2, -23, 3, 26, 4, 18, 5, 17, 6, -10,
+    7, -36, 8, -101, 9, 34, 10, 78, 11, -5, 12, -60, 13, -3, 14, 32,
+    15, 7, 16, 70, 17, -78, 18, 30, 19, 11, 20, -23, 21, 8, 22, 13,
+    23, -16, 24, 211, 25, -169, 26, -11, 27, 25, 28, 9, 29, 16, 30, -5,
+    31, -34, 32, -125, 33, 60, 34, 70, 35, -9, 36, -53, 37, -6, 38, 29,
+    39, 12, 40, 141, 41, -113, 42, -8, 43, 16, 44, 6, 45, 11, 46, -3,
+    47, -23, 48, 29, 49, -32, 50, 13, 51, 5, 52, -10, 53, 3, 54, 5,
+    55, -6, 56, -20, 57, 7, 58, 16, 59, -1, 60, -12, 61, -1, 62, 6,
+    63, 1, 63, -569, 1, 179, 2, -116, 3, -26, 4, 89, 5, -17, 6, -48,
+    7, 36, 8, 39, 9, -34, 10, -105, 11, 5, 12, 80, 13, 3, 14, -43,
+    15, -7, 16, -23, 17, 78, 18, 152, 19, -11, 20, -116, 21, -8, 22, 63,
+    23, 16, 24, 92, 25, 169, 26, 143, 27, -25, 28, -110, 29, -16, 30, 59,
+    31, 34, 32, -53, 33, -60, 34, -23, 35, 9, 36, 18, 37, 6, 38, -10,
+    39, -12, 40, 62, 41, 113, 42, 96, 43, -16, 44, -73, 45, -11, 46, 40,
+    47, 23, 48, -10, 49, 32, 50, 63, 51, -5, 52, -48, 53, -3, 54, 26,
+    55, 6, 56, 8, 57, -7, 58, -21, 59, 1, 60, 16, 61, 1, 62, -9,
+    63, -1, 62, -139, 1, 16, 2, 79, 3, -14, 4, 25, 5, -9, 6, -6,
+    7, 3, 8, 14, 9, 32, 10, -15, 11, -27, 12, 5, 13, -18, 14, 1,
+    15, 6, 16, -11, 17, -21, 18, 34, 19, 18, 20, -33, 21, 12, 22, -2,
+    23, -4, 24, -71, 25, -27, 26, 75, 27, 23, 28, -24, 29, 15, 30, -5,
+    31, -5, 32, 42, 33, 16, 34, -26, 35, -14, 36, -8, 37, -9, 38, 2,
+    39, 3, 40, -48, 41, -18, 42, 50, 43, 15, 44, -16, 45, 10, 46, -4,
+    47, -4, 48, -5, 49, -9, 50, 14, 51, 8, 52, -14, 53, 5, 54, -1,
+    55, -2, 56, 3, 57, 6, 58, -3, 59, -5, 60, 1, 61, -4, 63, 1,
+    62, 132, 1, -15, 2, -72, 3, 13, 4, -23, 5, 8, 6, 5, 7, -3,
+    8, -13, 9, -29, 10, 14, 11, 25, 12, -4, 13, 17, 14, -1, 15, -6,
+    16, 10, 17, 20, 18, -31, 19, -17, 20, 30, 21, -11, 22, 2, 23, 4,
+    24, 65, 25, 25, 26, -68, 27, -21, 28, 22, 29, -14, 30, 5, 31, 5,
+    32, -38, 33, -15, 34, 24, 35, 13, 36, 8, 37, 8, 38, -2, 39, -3,
+    40, 43, 41, 17, 42, -46, 43, -14, 44, 14, 45, -9, 46, 3, 47, 3,
+    48, 4, 49, 8, 50, -13, 51, -7, 52, 12, 53, -5, 54, 1, 55, 2,
+    56, -3, 57, -6, 58, 3, 59, 5, 60, -1, 61, 3, 63, -1, 63, -748,
+    1, -173, 2, 163, 3, -147, 4, 125, 5, -98, 6, 67, 7, -34, 8, 25,
+    9, -34, 10, 32, 11, -29, 12, 25, 13, -19, 14, 13, 15, -7, 16, -23,
+    17, 32, 18, -30, 19, 27, 20, -23, 21, 18, 22, -13, 23, 6, 24, 21,
+    25, -29, 26, 27, 27, -25, 28, 21, 29, -16, 30, 11, 31, -6, 32, -18,
+    33, 25, 34, -23, 35, 21, 36, -18, 37, 14, 38, -10, 39, 5, 40, 14,
+    41, -19, 42, 18, 43, -16, 44, 14, 45, -11, 46, 8, 47, -4, 48, -10,
+    49, 13, 50, -13, 51, 11, 52, -10, 53, 8, 54, -5, 55, 3, 56, 5,
+    57, -7, 58, 6, 59, -6, 60, 5, 61, -4, 62, 3, 63, -1, 63, -748,
+    1, 173, 2, 163, 3, 147, 4, 125, 5, 98, 6, 67, 7, 34, 8, 25,
+    9, 34, 10, 32, 11, 29, 12, 25, 13, 19, 14, 13, 15, 7, 16, -23,
+    17, -32, 18, -30, 19, -27, 20, -23, 21, -18, 22, -13, 23, -6, 24, 21,
+    25, 29, 26, 27, 27, 25, 28, 21, 29, 16, 30, 11, 31, 6, 32, -18,
+    33, -25, 34, -23, 35, -21, 36, -18, 37, -14, 38, -10, 39, -5, 40, 14,
+    41, 19, 42, 18, 43, 16, 44, 14, 45, 11, 46, 8, 47, 4, 48, -10,
+    49, -13, 50, -13, 51, -11, 52, -10, 53, -8, 54, -5, 55, -3, 56, 5,
+    57, 7, 58, 6, 59, 6, 60, 5, 61, 4, 62, 3, 63, 1, 31, -72,
+    2, 76, 4, -59, 6, 32, 8, -12, 10, 15, 12, -12, 14, 6, 16, 11,
+    18, -14, 20, 11, 22, -6, 24, -10, 26, 13, 28, -10, 30, 5, 32, 8,
+    34, -11, 36, 8, 38, -5, 40, -7, 42, 9, 44, -7, 46, 4, 48, 5,
+    50, -6, 52, 5, 54, -2, 56, -2, 58, 3, 60, -2, 62, 1, 31, 71,
+    2, -70, 4, 53, 6, -29, 8, 11, 10, -14, 12, 11, 14, -6, 16, -10,
+    18, 13, 20, -10, 22, 5, 24, 9, 26, -12, 28, 9, 30, -5, 32, -8,
+    34, 10, 36, -8, 38, 4, 40, 6, 42, -8, 44, 6, 46, -3, 48, -4,
+    50, 5, 52, -4, 54, 2, 56, 2, 58, -3, 60, 2, 62, -1, 55, -587,
+    1, -119, 2, -186, 3, 17, 4, 143, 5, 12, 6, -77, 7, -24, 8, 14,
+    9, 117, 10, -202, 11, -17, 12, 154, 13, -11, 14, -83, 15, 23, 16, -47,
+    18, 61, 20, -47, 22, 25, 24, 72, 25, -99, 26, 61, 27, 14, 28, -47,
+    29, 10, 30, 25, 31, -20, 32, -71, 33, 119, 34, -93, 35, -17, 36, 71,
+    37, -12, 38, -39, 39, 24, 40, 48, 41, -66, 42, 41, 43, 10, 44, -31,
+    45, 6, 46, 17, 47, -13, 48, -19, 50, 25, 52, -19, 54, 10, 56, 3,
+    57, 23, 58, -40, 59, -3, 60, 31, 61, -2, 62, -17, 63, 5, 55, -587,
+    1, 119, 2, -186, 3, -17, 4, 143, 5, -12, 6, -77, 7, 24, 8, 14,
+    9, -117, 10, -202, 11, 17, 12, 154, 13, 11, 14, -83, 15, -23, 16, -47,
+    18, 61, 20, -47, 22, 25, 24, 72, 25, 99, 26, 61, 27, -14, 28, -47,
+    29, -10, 30, 25, 31, 20, 32, -71, 33, -119, 34, -93, 35, 17, 36, 71,
+    37, 12, 38, -39, 39, -24, 40, 48, 41, 66, 42, 41, 43, -10, 44, -31,
+    45, -6, 46, 17, 47, 13, 48, -19, 50, 25, 52, -19, 54, 10, 56, 3,
+    57, -23, 58, -40, 59, 3, 60, 31, 61, 2, 62, -17, 63, -5, 27, -147,
+    2, 53, 4, 67, 6, -4, 8, -7, 10, -52, 12, 72, 14, 4, 16, 22,
+    20, -22, 24, -34, 26, 44, 28, -22, 30, -3, 32, 33, 34, -53, 36, 33,
+    38, 4, 40, -22, 42, 29, 44, -15, 46, -2, 48, 9, 52, -9, 56, -1,
+    58, -10, 60, 14, 62, 1, 27, 139, 2, -48, 4, -61, 6, 3, 8, 6,
+    10, 47, 12, -66, 14, -3, 16, -20, 20, 20, 24, 31, 26, -40, 28, 20,
+    30, 3, 32, -30, 34, 48, 36, -30, 38, -3, 40, 20, 42, -27, 44, 13,
+    46, 2, 48, -8, 52, 8, 56, 1, 58, 9, 60, -13, 62, -1, 60, -658,
+    1, -119, 2, -93, 3, 17, 4, 71, 5, 12, 6, -39, 7, -24, 8, 84,
+    9, 48, 10, -202, 11, 41, 12, 84, 13, 27, 14, -83, 15, 10, 16, -47,
+    17, 91, 18, -61, 19, -77, 20, 140, 21, -52, 22, -25, 23, 18, 24, 12,
+    25, -41, 26, 61, 27, -35, 28, 12, 29, -23, 30, 25, 31, -8, 33, -20,
+    35, 101, 36, -143, 37, 68, 39, -4, 40, 8, 41, -27, 42, 41, 43, -23,
+    44, 8, 45, -16, 46, 17, 47, -5, 48, -19, 49, 38, 50, -25, 51, -32,
+    52, 58, 53, -21, 54, -10, 55, 8, 56, 17, 57, 10, 58, -40, 59, 8,
+    60, 17, 61, 5, 62, -17, 63, 2, 60, -658, 1, 119, 2, -93, 3, -17,
+    4, 71, 5, -12, 6, -39, 7, 24, 8, 84, 9, -48, 10, -202, 11, -41,
+    12, 84, 13, -27, 14, -83, 15, -10, 16, -47, 17, -91, 18, -61, 19, 77,
+    20, 140, 21, 52, 22, -25, 23, -18, 24, 12, 25, 41, 26, 61, 27, 35,
+    28, 12, 29, 23, 30, 25, 31, 8, 33, 20, 35, -101, 36, -143, 37, -68,
+    39, 4, 40, 8, 41, 27, 42, 41, 43, 23, 44, 8, 45, 16, 46, 17,
+    47, 5, 48, -19, 49, -38, 50, -25, 51, 32, 52, 58, 53, 21, 54, -10,
+    55, -8, 56, 17, 57, -10, 58, -40, 59, -8, 60, 17, 61, -5, 62, -17,
+    63, -2, 29, -114, 2, 53, 4, 33, 6, -4, 8, -40, 10, -21, 12, 72,
+    14, -9, 16, 22, 18, -40, 20, 22, 22, 17, 24, -6, 26, 18, 28, -22,
+    30, 8, 34, 9, 38, -22, 40, -4, 42, 12, 44, -15, 46, 5, 48, 9,
+    50, -17, 52, 9, 54, 7, 56, -8, 58, -4, 60, 14, 62, -2, 29, 109,
+    2, -48, 4, -30, 6, 3, 8, 36, 10, 20, 12, -66, 14, 8, 16, -20,
+    18, 37, 20, -20, 22, -15, 24, 5, 26, -17, 28, 20, 30, -7, 34, -8,
+    38, 20, 40, 4, 42, -11, 44, 13, 46, -5, 48, -8, 50, 15, 52, -8,
+    54, -6, 56, 7, 58, 4, 60, -13, 62, 2, 63, -534, 1, -193, 2, -116,
+    3, -45, 4, 196, 5, -30, 6, -48, 7, -38, 8, 109, 9, -14, 10, -78,
+    11, -128, 12, 249, 13, -86, 14, -32, 15, -3, 16, -70, 17, 32, 18, 30,
+    19, 27, 20, -70, 21, 18, 22, 13, 23, 6, 24, 33, 25, -46, 26, 11,
+    27, 59, 28, -85, 29, 40, 30, 5, 31, -9, 32, -18, 33, 45, 34, -23,
+    35, -80, 36, 125, 37, -54, 38, -10, 39, 9, 40, 22, 41, -31, 42, 8,
+    43, 40, 44, -57, 45, 27, 46, 3, 47, -6, 48, -29, 49, 13, 50, 13,
+    51, 11, 52, -29, 53, 8, 54, 5, 55, 3, 56, 22, 57, -3, 58, -16,
+    59, -26, 60, 50, 61, -17, 62, -6, 63, -1, 63, -534, 1, 193, 2, -116,
+    3, 45, 4, 196, 5, 30, 6, -48, 7, 38, 8, 109, 9, 14, 10, -78,
+    11, 128, 12, 249, 13, 86, 14, -32, 15, 3, 16, -70, 17, -32, 18, 30,
+    19, -27, 20, -70, 21, -18, 22, 13, 23, -6, 24, 33, 25, 46, 26, 11,
+    27, -59, 28, -85, 29, -40, 30, 5, 31, 9, 32, -18, 33, -45, 34, -23,
+    35, 80, 36, 125, 37, 54, 38, -10, 39, -9, 40, 22, 41, 31, 42, 8,
+    43, -40, 44, -57, 45, -27, 46, 3, 47, 6, 48, -29, 49, -13, 50, 13,
+    51, -11, 52, -29, 53, -8, 54, 5, 55, -3, 56, 22, 57, 3, 58, -16,
+    59, 26, 60, 50, 61, 17, 62, -6, 63, 1, 31, -172, 2, 86, 4, 42,
+    6, 10, 8, -51, 10, 6, 12, 28, 14, 28, 16, 33, 18, -14, 20, -11,
+    22, -6, 24, -16, 26, 20, 28, -4, 30, -13, 32, 8, 34, -20, 36, 8,
+    38, 17, 40, -10, 42, 14, 44, -3, 46, -9, 48, 14, 50, -6, 52, -5,
+    54, -2, 56, -10, 58, 1, 60, 6, 62, 6, 31, 162, 2, -78, 4, -38,
+    6, -9, 8, 47, 10, -6, 12, -26, 14, -25, 16, -30, 18, 13, 20, 10,
+    22, 5, 24, 14, 26, -19, 28, 4, 30, 12, 32, -8, 34, 18, 36, -8,
+    38, -16, 40, 9, 42, -12, 44, 2, 46, 8, 48, -12, 50, 5, 52, 4,
+    54, 2, 56, 9, 58, -1, 60, -5, 62, -5, 63, -641, 1, -95, 2, -163,
+    3, 38, 4, 89, 5, 26, 6, -67, 7, -19, 8, 25, 9, -103, 10, 124,
+    11, 29, 12, -115, 13, 19, 14, 51, 15, -20, 16, -70, 17, -32, 18, 152,
+    19, -27, 20, -70, 21, -18, 22, 63, 23, -6, 24, 21, 25, 29, 26, -50,
+    27, -74, 28, 139, 29, -49, 30, -21, 31, 6, 32, -53, 33, 45, 34, 23,
+    35, -80, 36, 89, 37, -54, 38, 10, 39, 9, 40, 14, 41, 19, 42, -33,
+    43, -49, 44, 93, 45, -33, 46, -14, 47, 4, 48, -29, 49, -13, 50, 63,
+    51, -11, 52, -29, 53, -8, 54, 26, 55, -3, 56, 5, 57, -20, 58, 25,
+    59, 6, 60, -23, 61, 4, 62, 10, 63, -4, 63, -641, 1, 95, 2, -163,
+    3, -38, 4, 89, 5, -26, 6, -67, 7, 19, 8, 25, 9, 103, 10, 124,
+    11, -29, 12, -115, 13, -19, 14, 51, 15, 20, 16, -70, 17, 32, 18, 152,
+    19, 27, 20, -70, 21, 18, 22, 63, 23, 6, 24, 21, 25, -29, 26, -50,
+    27, 74, 28, 139, 29, 49, 30, -21, 31, -6, 32, -53, 33, -45, 34, 23,
+    35, 80, 36, 89, 37, 54, 38, 10, 39, -9, 40, 14, 41, -19, 42, -33,
+    43, 49, 44, 93, 45, 33, 46, -14, 47, -4, 48, -29, 49, 13, 50, 63,
+    51, 11, 52, -29, 53, 8, 54, 26, 55, 3, 56, 5, 57, 20, 58, 25,
+    59, -6, 60, -23, 61, -4, 62, 10, 63, 4, 31, -122, 2, 42, 4, 59,
+    6, -8, 8, -12, 10, 45, 12, -44, 14, -6, 16, 33, 18, 14, 20, -55,
+    22, 6, 24, -10, 26, -13, 28, 18, 30, 16, 32, 25, 34, -20, 36, -8,
+    38, 17, 40, -7, 42, -9, 44, 12, 46, 11, 48, 14, 50, 6, 52, -23,
+    54, 2, 56, -2, 58, 9, 60, -9, 62, -1, 31, 116, 2, -38, 4, -53,
+    6, 8, 8, 11, 10, -41, 12, 40, 14, 6, 16, -30, 18, -13, 20, 50,
+    22, -5, 24, 9, 26, 12, 28, -16, 30, -15, 32, -23, 34, 18, 36, 8,
+    38, -16, 40, 6, 42, 8, 44, -11, 46, -10, 48, -12, 50, -5, 52, 21,
+    54, -2, 56, 2, 58, -8, 60, 8, 62, 1, 52, -730, 1, -183, 2, 140,
+    3, -96, 4, 71, 5, -64, 6, 58, 7, -36, 8, 49, 9, -48, 11, 41,
+    12, -49, 13, 27, 15, -10, 17, 19, 18, -61, 19, 93, 20, -93, 21, 62,
+    22, -25, 23, 4, 24, 42, 25, -41, 27, 35, 28, -42, 29, 23, 31, -8,
+    33, 14, 34, -47, 35, 72, 36, -71, 37, 48, 38, -19, 39, 3, 40, 28,
+    41, -27, 43, 23, 44, -28, 45, 16, 47, -5, 49, 8, 50, -25, 51, 39,
+    52, -39, 53, 26, 54, -10, 55, 2, 56, 10, 57, -10, 59, 8, 60, -10,
+    61, 5, 63, -2, 52, -730, 1, 183, 2, 140, 3, 96, 4, 71, 5, 64,
+    6, 58, 7, 36, 8, 49, 9, 48, 11, -41, 12, -49, 13, -27, 15, 10,
+    17, -19, 18, -61, 19, -93, 20, -93, 21, -62, 22, -25, 23, -4, 24, 42,
+    25, 41, 27, -35, 28, -42, 29, -23, 31, 8, 33, -14, 34, -47, 35, -72,
+    36, -71, 37, -48, 38, -19, 39, -3, 40, 28, 41, 27, 43, -23, 44, -28,
+    45, -16, 47, 5, 49, -8, 50, -25, 51, -39, 52, -39, 53, -26, 54, -10,
+    55, -2, 56, 10, 57, 10, 59, -8, 60, -10, 61, -5, 63, 2, 24, -80,
+    2, 81, 4, -50, 6, 21, 8, -23, 10, 21, 14, -9, 18, -8, 20, 22,
+    22, -20, 24, -20, 26, 18, 30, -8, 34, -6, 36, 17, 38, -15, 40, -13,
+    42, 12, 46, -5, 50, -3, 52, 9, 54, -8, 56, -5, 58, 4, 62, -2,
+    24, 78, 2, -74, 4, 46, 6, -19, 8, 21, 10, -20, 14, 8, 18, 8,
+    20, -20, 22, 18, 24, 18, 26, -17, 30, 7, 34, 6, 36, -15, 38, 14,
+    40, 12, 42, -11, 46, 5, 50, 3, 52, -8, 54, 8, 56, 4, 58, -4,
+    62, 2, 63, -534, 1, -214, 2, -116, 3, 56, 4, 53, 5, 37, 6, -48,
+    7, -43, 8, -80, 9, 14, 10, 78, 11, 12, 12, -80, 13, 8, 14, 32,
+    15, 3, 16, -70, 17, -32, 18, 152, 19, -27, 20, -70, 21, -18, 22, 63,
+    23, -6, 24, 110, 25, -70, 26, -11, 27, -59, 28, 110, 29, -40, 30, -5,
+    31, -14, 32, -160, 33, 164, 34, -23, 35, -98, 36, 125, 37, -65, 38, -10,
+    39, 33, 40, 73, 41, -47, 42, -8, 43, -40, 44, 73, 45, -27, 46, -3,
+    47, -9, 48, -29, 49, -13, 50, 63, 51, -11, 52, -29, 53, -8, 54, 26,
+    55, -3, 56, -16, 57, 3, 58, 16, 59, 2, 60, -16, 61, 2, 62, 6,
+    63, 1, 63, -676, 1, 144, 2, -23, 3, 4, 4, 53, 5, 2, 6, -10,
+    7, 29, 8, -150, 9, -83, 10, 78, 11, 46, 12, -10, 13, 31, 14, 32,
+    15, -16, 16, 23, 17, 32, 18, 30, 19, 27, 20, 23, 21, 18, 22, 13,
+    23, 6, 24, 169, 25, 128, 26, -11, 27, 10, 28, 51, 29, 7, 30, -5,
+    31, 26, 32, -160, 33, -95, 34, 70, 35, 38, 36, -18, 37, 26, 38, 29,
+    39, -19, 40, 113, 41, 86, 42, -8, 43, 7, 44, 34, 45, 5, 46, -3,
+    47, 17, 48, 10, 49, 13, 50, 13, 51, 11, 52, 10, 53, 8, 54, 5,
+    55, 3, 56, -30, 57, -16, 58, 16, 59, 9, 60, -2, 61, 6, 62, 6,
+    63, -3, 62, -139, 1, -25, 2, 79, 3, 32, 4, 25, 5, -3, 6, -6,
+    7, -1, 8, 54, 9, -9, 10, -21, 11, 18, 12, -28, 13, -12, 14, 4,
+    15, 2, 16, 11, 17, 21, 18, 14, 19, -18, 20, -33, 21, -12, 22, 6,
+    23, 4, 24, -65, 25, 7, 26, 44, 27, -15, 28, 4, 29, 10, 30, 8,
+    31, -1, 32, 75, 33, -8, 34, -57, 35, -4, 36, -8, 37, 21, 38, 15,
+    39, -5, 40, -44, 41, 5, 42, 29, 43, -10, 44, 3, 45, 7, 46, 5,
+    47, -1, 48, 5, 49, 9, 50, 6, 51, -8, 52, -14, 53, -5, 54, 2,
+    55, 2, 56, 11, 57, -2, 58, -4, 59, 4, 60, -6, 61, -2, 62, 1,
+    62, 132, 1, 23, 2, -72, 3, -29, 4, -23, 5, 3, 6, 5, 7, 1,
+    8, -49, 9, 8, 10, 20, 11, -16, 12, 26, 13, 11, 14, -3, 15, -2,
+    16, -10, 17, -20, 18, -13, 19, 17, 20, 30, 21, 11, 22, -5, 23, -4,
+    24, 60, 25, -7, 26, -40, 27, 14, 28, -4, 29, -9, 30, -7, 31, 1,
+    32, -69, 33, 7, 34, 52, 35, 4, 36, 8, 37, -20, 38, -13, 39, 5,
+    40, 40, 41, -4, 42, -27, 43, 9, 44, -2, 45, -6, 46, -5, 47, 1,
+    48, -4, 49, -8, 50, -5, 51, 7, 52, 12, 53, 5, 54, -2, 55, -2,
+    56, -10, 57, 2, 58, 4, 59, -3, 60, 5, 61, 2, 62, -1, 63, -783,
+    1, -60, 2, -23, 3, 9, 4, 18, 5, 6, 6, -10, 7, -12, 8, 124,
+    9, -83, 10, -32, 11, 12, 12, 25, 13, 8, 14, -13, 15, -16, 16, 116,
+    17, -78, 18, -30, 19, 11, 20, 23, 21, 8, 22, -13, 23, -16, 24, 105,
+    25, -70, 26, -27, 27, 10, 28, 21, 29, 7, 30, -11, 31, -14, 32, 89,
+    33, -60, 34, -23, 35, 9, 36, 18, 37, 6, 38, -10, 39, -12, 40, 70,
+    41, -47, 42, -18, 43, 7, 44, 14, 45, 5, 46, -8, 47, -9, 48, 48,
+    49, -32, 50, -13, 51, 5, 52, 10, 53, 3, 54, -5, 55, -6, 56, 25,
+    57, -16, 58, -6, 59, 2, 60, 5, 61, 2, 62, -3, 63, -3, 63, -783,
+    1, 60, 2, -23, 3, -9, 4, 18, 5, -6, 6, -10, 7, 12, 8, 124,
+    9, 83, 10, -32, 11, -12, 12, 25, 13, -8, 14, -13, 15, 16, 16, 116,
+    17, 78, 18, -30, 19, -11, 20, 23, 21, -8, 22, -13, 23, 16, 24, 105,
+    25, 70, 26, -27, 27, -10, 28, 21, 29, -7, 30, -11, 31, 14, 32, 89,
+    33, 60, 34, -23, 35, -9, 36, 18, 37, -6, 38, -10, 39, 12, 40, 70,
+    41, 47, 42, -18, 43, -7, 44, 14, 45, -5, 46, -8, 47, 9, 48, 48,
+    49, 32, 50, -13, 51, -5, 52, 10, 53, -3, 54, -5, 55, 6, 56, 25,
+    57, 16, 58, -6, 59, -2, 60, 5, 61, -2, 62, -3, 63, 3, 31, -55,
+    2, 26, 4, 8, 6, -2, 8, -58, 10, 37, 12, 12, 14, -3, 16, -55,
+    18, 34, 20, 11, 22, -2, 24, -49, 26, 31, 28, 10, 30, -2, 32, -42,
+    34, 26, 36, 8, 38, -2, 40, -33, 42, 21, 44, 7, 46, -1, 48, -23,
+    50, 14, 52, 5, 54, -1, 56, -12, 58, 7, 60, 2, 62, -1, 30, 55,
+    2, -24, 4, -8, 6, 2, 8, 53, 10, -33, 12, -11, 14, 2, 16, 50,
+    18, -31, 20, -10, 22, 2, 24, 45, 26, -28, 28, -9, 30, 2, 32, 38,
+    34, -24, 36, -8, 38, 2, 40, 30, 42, -19, 44, -6, 46, 1, 48, 21,
+    50, -13, 52, -4, 54, 1, 56, 11, 58, -7, 60, -2, 63, -391, 1, -249,
+    2, -256, 3, 85, 4, 125, 5, 57, 6, -106, 7, -50, 8, 228, 9, -200,
+    10, 13, 11, 29, 12, -10, 13, 19, 14, 6, 15, -40, 16, -70, 17, 13,
+    18, 91, 19, -66, 20, 23, 21, -44, 22, 38, 23, 3, 24, 16, 25, 29,
+    26, -66, 27, -4, 28, 51, 29, -3, 30, -27, 31, 6, 32, -18, 33, -10,
+    34, 23, 35, 51, 36, -89, 37, 34, 38, 10, 39, -2, 40, 11, 41, 19,
+    42, -44, 43, -3, 44, 34, 45, -2, 46, -18, 47, 4, 48, -29, 49, 6,
+    50, 38, 51, -27, 52, 10, 53, -18, 54, 16, 55, 1, 56, 45, 57, -40,
+    58, 3, 59, 6, 60, -2, 61, 4, 62, 1, 63, -8, 63, -783, 1, 109,
+    2, 70, 3, 33, 4, 18, 5, 22, 6, 29, 7, 22, 8, 109, 9, 131,
+    10, 78, 11, 29, 12, 10, 13, 19, 14, 32, 15, 26, 16, 70, 17, 78,
+    18, 30, 19, -11, 20, -23, 21, -8, 22, 13, 23, 16, 24, 33, 25, 29,
+    26, -11, 27, -45, 28, -51, 29, -30, 30, -5, 31, 6, 32, 18, 33, 10,
+    34, -23, 35, -51, 36, -53, 37, -34, 38, -10, 39, 2, 40, 22, 41, 19,
+    42, -8, 43, -30, 44, -34, 45, -20, 46, -3, 47, 4, 48, 29, 49, 32,
+    50, 13, 51, -5, 52, -10, 53, -3, 54, 5, 55, 6, 56, 22, 57, 26,
+    58, 16, 59, 6, 60, 2, 61, 4, 62, 6, 63, 5, 52, -147, 1, -75,
+    2, 79, 3, 85, 4, 33, 5, 8, 6, -6, 7, -8, 8, -79, 9, -20,
+    10, 73, 11, 27, 12, -16, 13, -5, 15, -1, 17, 22, 18, 14, 19, -33,
+    20, -22, 21, 10, 22, 6, 24, -12, 25, -2, 27, -7, 28, 14, 29, 16,
+    30, -4, 31, -3, 33, 8, 34, 5, 35, -7, 37, -5, 38, -11, 39, 2,
+    40, -8, 41, -2, 43, -5, 44, 9, 45, 10, 46, -3, 47, -2, 49, 9,
+    50, 6, 51, -14, 52, -9, 53, 4, 54, 2, 56, -16, 57, -4, 58, 15,
+    59, 5, 60, -3, 61, -1, 51, 139, 1, 69, 2, -72, 3, -77, 4, -30,
+    5, -8, 6, 5, 7, 7, 8, 72, 9, 18, 10, -67, 11, -25, 12, 15,
+    13, 5, 17, -20, 18, -13, 19, 30, 20, 20, 21, -9, 22, -5, 24, 10,
+    25, 2, 27, 6, 28, -13, 29, -14, 30, 4, 31, 3, 33, -7, 34, -4,
+    35, 6, 37, 4, 38, 10, 39, -1, 40, 7, 41, 1, 43, 4, 44, -8,
+    45, -9, 46, 3, 47, 2, 49, -8, 50, -5, 51, 12, 52, 8, 53, -4,
+    54, -2, 56, 14, 57, 4, 58, -13, 59, -5, 60, 3, 61, 1,
+};
+const BorderTile FONT_BORDER_TILE = {608, 16, FONT_BORDER_MCUS, FONT_BORDER_COEFFICIENTS};
+const char FONT_BORDER_CHARACTERS[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ->";
+
+static const uint32_t REBATE_BORDER_MCUS[] = {
+    0,
+};
+static const int16_t REBATE_BORDER_COEFFICIENTS[] = {
+    0, -872, 0, -872, 0, -13, 0, 17,
+};
+const BorderTile REBATE_BORDER_TILE = {16, 8, REBATE_BORDER_MCUS, REBATE_BORDER_COEFFICIENTS};
+
+static const uint32_t SPROCKET_BORDER_MCUS[] = {
+    0, 134, 184, 234, 368, 556, 564, 572, 760, 794, 802, 810, 844, 878, 886, 894,
+    928, 962, 970, 978, 1012, 1046, 1054, 1062, 1096, 1284, 1292, 1300, 1488, 1622, 1672, 1722,
+};
+static const int16_t SPROCKET_BORDER_COEFFICIENTS[] = {
+    0, -872, 63, -846, 1, -37, 2, 35, 3, -31, 4, 27, 5, -21, 6, 14,
+    7, -7, 8, -37, 9, 51, 10, -48, 11, 43, 12, -37, 13, 29, 14, -20,
+    15, 10, 16, 35, 17, -48, 18, 45, 19, -41, 20, 35, 21, -27, 22, 19,
+    23, -10, 24, -31, 25, 43, 26, -41, 27, 37, 28, -31, 29, 25, 30, -17,
+    31, 9, 32, 27, 33, -37, 34, 35, 35, -31, 36, 27, 37, -21, 38, 14,
+    39, -7, 40, -21, 41, 29, 42, -27, 43, 25, 44, -21, 45, 16, 46, -11,
+    47, 6, 48, 14, 49, -20, 50, 19, 51, -17, 52, 14, 53, -11, 54, 8,
+    55, -4, 56, -7, 57, 10, 58, -10, 59, 9, 60, -7, 61, 6, 62, -4,
+    63, 2, 0, -14, 0, 17, 6, -446, 8, -546, 16, 394, 24, -192, 40, 128,
+    48, -163, 56, 109, 6, -446, 8, -546, 16, 394, 24, -192, 40, 128, 48, -163,
+    56, 109, 6, -21, 8, 10, 16, -7, 24, 4, 40, -2, 48, 3, 56, -2,
+    3, 19, 8, -2, 16, 1, 24, -1, 6, -446, 8, -546, 16, 394, 24, -192,
+    40, 128, 48, -163, 56, 109, 6, -446, 8, -546, 16, 394, 24, -192, 40, 128,
+    48, -163, 56, 109, 6, -21, 8, 10, 16, -7, 24, 4, 40, -2, 48, 3,
+    56, -2, 3, 19, 8, -2, 16, 1, 24, -1, 63, -846, 1, 37, 2, 35,
+    3, 31, 4, 27, 5, 21, 6, 14, 7, 7, 8, -37, 9, -51, 10, -48,
+    11, -43, 12, -37, 13, -29, 14, -20, 15, -10, 16, 35, 17, 48, 18, 45,
+    19, 41, 20, 35, 21, 27, 22, 19, 23, 10, 24, -31, 25, -43, 26, -41,
+    27, -37, 28, -31, 29, -25, 30, -17, 31, -9, 32, 27, 33, 37, 34, 35,
+    35, 31, 36, 27, 37, 21, 38, 14, 39, 7, 40, -21, 41, -29, 42, -27,
+    43, -25, 44, -21, 45, -16, 46, -11, 47, -6, 48, 14, 49, 20, 50, 19,
+    51, 17, 52, 14, 53, 11, 54, 8, 55, 4, 56, -7, 57, -10, 58, -10,
+    59, -9, 60, -7, 61, -6, 62, -4, 63, -2, 0, -872, 0, -14, 0, 17,
+    0, -872, 62, -100, 1, -737, 2, 84, 3, 192, 4, -27, 5, -111, 6, -6,
+    7, 111, 8, -105, 9, 48, 10, 109, 11, -105, 12, -31, 13, 90, 14, -11,
+    15, -51, 16, -84, 17, 41, 18, 83, 19, -87, 20, -14, 21, 67, 22, -19,
+    23, -27, 24, -55, 25, 31, 26, 48, 27, -62, 28, 7, 29, 37, 30, -28,
+    31, 4, 32, -27, 33, 21, 34, 14, 35, -37, 36, 27, 37, 7, 38, -35,
+    39, 31, 40, -5, 41, 12, 42, -10, 43, -16, 44, 37, 45, -13, 46, -36,
+    47, 47, 48, 6, 49, 6, 50, -19, 51, -4, 52, 35, 53, -20, 54, -30,
+    55, 45, 56, 6, 57, 2, 58, -14, 60, 21, 61, -14, 62, -17, 63, 27,
+    25, -21, 1, 9, 2, -7, 3, 4, 4, -1, 5, -1, 6, 2, 7, -1,
+    8, 1, 9, -1, 10, 1, 12, -1, 13, 1, 14, -1, 15, 1, 16, 1,
+    17, -1, 20, -1, 21, 1, 22, -1, 23, 1, 24, 1, 25, -1, 28, -1,
+    29, 1, 30, -1, 3, 18, 1, -2, 2, 1, 3, -1, 0, 832, 0, 832,
+    0, -45, 0, 23, 0, 832, 0, 832, 0, -45, 0, 23, 62, -100, 1, 737,
+    2, 84, 3, -192, 4, -27, 5, 111, 6, -6, 7, -111, 8, -105, 9, -48,
+    10, 109, 11, 105, 12, -31, 13, -90, 14, -11, 15, 51, 16, -84, 17, -41,
+    18, 83, 19, 87, 20, -14, 21, -67, 22, -19, 23, 27, 24, -55, 25, -31,
+    26, 48, 27, 62, 28, 7, 29, -37, 30, -28, 31, -4, 32, -27, 33, -21,
+    34, 14, 35, 37, 36, 27, 37, -7, 38, -35, 39, -31, 40, -5, 41, -12,
+    42, -10, 43, 16, 44, 37, 45, 13, 46, -36, 47, -47, 48, 6, 49, -6,
+    50, -19, 51, 4, 52, 35, 53, 20, 54, -30, 55, -45, 56, 6, 57, -2,
+    58, -14, 60, 21, 61, 14, 62, -17, 63, -27, 0, -872, 25, -21, 1, -9,
+    2, -7, 3, -4, 4, -1, 5, 1, 6, 2, 7, 1, 8, 1, 9, 1,
+    10, 1, 12, -1, 13, -1, 14, -1, 15, -1, 16, 1, 17, 1, 20, -1,
+    21, -1, 22, -1, 23, -1, 24, 1, 25, 1, 28, -1, 29, -1, 30, -1,
+    3, 18, 1, 2, 2, 1, 3, 1, 0, -872, 4, -20, 1, -772, 3, 271,
+    5, -181, 7, 154, 6, -21, 1, 10, 2, -7, 3, 4, 5, -2, 6, 3,
+    7, -2, 3, 19, 1, -2, 2, 1, 3, -1, 0, 832, 0, 832, 0, -45,
+    0, 23, 0, 832, 0, 832, 0, -45, 0, 23, 4, -20, 1, 772, 3, -271,
+    5, 181, 7, -154, 0, -872, 6, -21, 1, -10, 2, -7, 3, -4, 5, 2,
+    6, 3, 7, 2, 3, 19, 1, 2, 2, 1, 3, 1, 0, -872, 4, -20,
+    1, -772, 3, 271, 5, -181, 7, 154, 6, -21, 1, 10, 2, -7, 3, 4,
+    5, -2, 6, 3, 7, -2, 3, 19, 1, -2, 2, 1, 3, -1, 0, 832,
+    0, 832, 0, -45, 0, 23, 0, 832, 0, 832, 0, -45, 0, 23, 4, -20,
+    1, 772, 3, -271, 5, 181, 7, -154, 0, -872, 6, -21, 1, -10, 2, -7,
+    3, -4, 5, 2, 6, 3, 7, 2, 3, 19, 1, 2, 2, 1, 3, 1,
+    0, -872, 4, -20, 1, -772, 3, 271, 5, -181, 7, 154, 6, -21, 1, 10,
+    2, -7, 3, 4, 5, -2, 6, 3, 7, -2, 3, 19, 1, -2, 2, 1,
+    3, -1, 0, 832, 0, 832, 0, -45, 0, 23, 0, 832, 0, 832, 0, -45,
+    0, 23, 4, -20, 1, 772, 3, -271, 5, 181, 7, -154, 0, -872, 6, -21,
+    1, -10, 2, -7, 3, -4, 5, 2, 6, 3, 7, 2, 3, 19, 1, 2,
+    2, 1, 3, 1, 0, -872, 4, -20, 1, -772, 3, 271, 5, -181, 7, 154,
+    6, -21, 1, 10, 2, -7, 3, 4, 5, -2, 6, 3, 7, -2, 3, 19,
+    1, -2, 2, 1, 3, -1, 0, 832, 0, 832, 0, -45, 0, 23, 0, 832,
+    0, 832, 0, -45, 0, 23, 4, -20, 1, 772, 3, -271, 5, 181, 7, -154,
+    0, -872, 6, -21, 1, -10, 2, -7, 3, -4, 5, 2, 6, 3, 7, 2,
+    3, 19, 1, 2, 2, 1, 3, 1, 0, -872, 62, -100, 1, -737, 2, 84,
+    3, 192, 4, -27, 5, -111, 6, -6, 7, 111, 8, 105, 9, -48, 10, -109,
+    11, 105, 12, 31, 13, -90, 14, 11, 15, 51, 16, -84, 17, 41, 18, 83,
+    19, -87, 20, -14, 21, 67, 22, -19, 23, -27, 24, 55, 25, -31, 26, -48,
+    27, 62, 28, -7, 29, -37, 30, 28, 31, -4, 32, -27, 33, 21, 34, 14,
+    35, -37, 36, 27, 37, 7, 38, -35, 39, 31, 40, 5, 41, -12, 42, 10,
+    43, 16, 44, -37, 45, 13, 46, 36, 47, -47, 48, 6, 49, 6, 50, -19,
+    51, -4, 52, 35, 53, -20, 54, -30, 55, 45, 56, -6, 57, -2, 58, 14,
+    60, -21, 61, 14, 62, 17, 63, -27, 25, -21, 1, 9, 2, -7, 3, 4,
+    4, -1, 5, -1, 6, 2, 7, -1, 8, -1, 9, 1, 10, -1, 12, 1,
+    13, -1, 14, 1, 15, -1, 16, 1, 17, -1, 20, -1, 21, 1, 22, -1,
+    23, 1, 24, -1, 25, 1, 28, 1, 29, -1, 30, 1, 3, 18, 1, -2,
+    2, 1, 3, -1, 0, 832, 0, 832, 0, -45, 0, 23, 0, 832, 0, 832,
+    0, -45, 0, 23, 62, -100, 1, 737, 2, 84, 3, -192, 4, -27, 5, 111,
+    6, -6, 7, -111, 8, 105, 9, 48, 10, -109, 11, -105, 12, 31, 13, 90,
+    14, 11, 15, -51, 16, -84, 17, -41, 18, 83, 19, 87, 20, -14, 21, -67,
+    22, -19, 23, 27, 24, 55, 25, 31, 26, -48, 27, -62, 28, -7, 29, 37,
+    30, 28, 31, 4, 32, -27, 33, -21, 34, 14, 35, 37, 36, 27, 37, -7,
+    38, -35, 39, -31, 40, 5, 41, 12, 42, 10, 43, -16, 44, -37, 45, -13,
+    46, 36, 47, 47, 48, 6, 49, -6, 50, -19, 51, 4, 52, 35, 53, 20,
+    54, -30, 55, -45, 56, -6, 57, 2, 58, 14, 60, -21, 61, -14, 62, 17,
+    63, 27, 0, -872, 25, -21, 1, -9, 2, -7, 3, -4, 4, -1, 5, 1,
+    6, 2, 7, 1, 8, -1, 9, -1, 10, -1, 12, 1, 13, 1, 14, 1,
+    15, 1, 16, 1, 17, 1, 20, -1, 21, -1, 22, -1, 23, -1, 24, -1,
+    25, -1, 28, 1, 29, 1, 30, 1, 3, 18, 1, 2, 2, 1, 3, 1,
+    0, -872, 63, -846, 1, -37, 2, 35, 3, -31, 4, 27, 5, -21, 6, 14,
+    7, -7, 8, 37, 9, -51, 10, 48, 11, -43, 12, 37, 13, -29, 14, 20,
+    15, -10, 16, 35, 17, -48, 18, 45, 19, -41, 20, 35, 21, -27, 22, 19,
+    23, -10, 24, 31, 25, -43, 26, 41, 27, -37, 28, 31, 29, -25, 30, 17,
+    31, -9, 32, 27, 33, -37, 34, 35, 35, -31, 36, 27, 37, -21, 38, 14,
+    39, -7, 40, 21, 41, -29, 42, 27, 43, -25, 44, 21, 45, -16, 46, 11,
+    47, -6, 48, 14, 49, -20, 50, 19, 51, -17, 52, 14, 53, -11, 54, 8,
+    55, -4, 56, 7, 57, -10, 58, 10, 59, -9, 60, 7, 61, -6, 62, 4,
+    63, -2, 0, -14, 0, 17, 6, -446, 8, 546, 16, 394, 24, 192, 40, -128,
+    48, -163, 56, -109, 6, -446, 8, 546, 16, 394, 24, 192, 40, -128, 48, -163,
+    56, -109, 6, -21, 8, -10, 16, -7, 24, -4, 40, 2, 48, 3, 56, 2,
+    3, 19, 8, 2, 16, 1, 24, 1, 6, -446, 8, 546, 16, 394, 24, 192,
+    40, -128, 48, -163, 56, -109, 6, -446, 8, 546, 16, 394, 24, 192, 40, -128,
+    48, -163, 56, -109, 6, -21, 8, -10, 16, -7, 24, -4, 40, 2, 48, 3,
+    56, 2, 3, 19, 8, 2, 16, 1, 24, 1, 63, -846, 1, 37, 2, 35,
+    3, 31, 4, 27, 5, 21, 6, 14, 7, 7, 8, 37, 9, 51, 10, 48,
+    11, 43, 12, 37, 13, 29, 14, 20, 15, 10, 16, 35, 17, 48, 18, 45,
+    19, 41, 20, 35, 21, 27, 22, 19, 23, 10, 24, 31, 25, 43, 26, 41,
+    27, 37, 28, 31, 29, 25, 30, 17, 31, 9, 32, 27, 33, 37, 34, 35,
+    35, 31, 36, 27, 37, 21, 38, 14, 39, 7, 40, 21, 41, 29, 42, 27,
+    43, 25, 44, 21, 45, 16, 46, 11, 47, 6, 48, 14, 49, 20, 50, 19,
+    51, 17, 52, 14, 53, 11, 54, 8, 55, 4, 56, 7, 57, 10, 58, 10,
+    59, 9, 60, 7, 61, 6, 62, 4, 63, 2, 0, -872, 0, -14, 0, 17,
+};
+const BorderTile SPROCKET_BORDER_TILE = {64, 64, SPROCKET_BORDER_MCUS, SPROCKET_BORDER_COEFFICIENTS};
\ No newline at end of file
@@ -0,0 +1,13 @@
+#ifndef BORDERTILES_H
+#define BORDERTILES_H
+
+#include "BorderTile.h"
+
+extern const BorderTile FONT_BORDER_TILE;
+extern const char FONT_BORDER_CHARACTERS[];
+
+extern const BorderTile REBATE_BORDER_TILE;
+
+extern const BorderTile SPROCKET_BORDER_TILE;
+
+#endif  // BORDERTILES_H
\ No newline at end of file
@@ -0,0 +1,543 @@
+#include <string.h>
+
+#include "GrainTiles.h"
+
+static const int8_t MONO_400_GRAIN_NOISE[] = {
+    29, -55, 76, -66, 52, -52, -13, 127, -40, -127, 36, 100, 53, 19, 113, -82,
+    -24, 127, -59, -11, 116, -75, 69, -87, 125, -116, -17, -71, 27, -120, -61, -35,
+    -106, 105, 23, 50, -25, 85, 56, -109, -61, -5, 23, 41, -82, 73, 100, -56,
+    -15, 50, -114, -22, -97, 67, -78, 85, -54, 37, -23, 1, -84, -62, 67, -100,
+    89, -19, 16, -103, -25, 68, 9, -94, 26, -5, 115, -75, -92, 91, -62, -6,
+    79, -124, 52, 17, 31, -102, -20, -47, 13, -107, 80, -40, 116, 12, -20, 123,
+    56, -66, -123, 95, -1, -85, 11, -39, 90, 64, 116, -126, -64, 60, 0, -120,
+    88, -75, -41, 1, 27, 103, -14, 9, -127, 57, 92, -48, 50, -12, -33, 4,
+    58, -121, 98, 1, 105, -117, 84, -82, 94, 61, -100, -36, 3, -48, -107, 39,
+    -41, 100, -93, -32, 107, -55, 86, 41, 105, 63, 3, 48, -89, 97, 71, 31,
+    6, -87, -16, 40, -58, -117, 123, 37, -78, -100, -50, 12, 103, -39, 28, -29,
+    40, 105, 12, -60, 80, -117, -66, 113, -30, -92, 25, -104, 100, -118, 118, -91,
+    -74, 44, -37, -88, 34, -71, -29, 44, -57, -21, 15, 82, 45, 73, 120, 14,
+    61, -69, 1, -81, 75, 57, -122, -4, -35, -80, -59, -25, -104, -48, -75, -115,
+    -53, 111, 79, -42, 107, 70, -29, -10, 99, 52, -22, 80, -13, -110, 119, -86,
+    69, -100, 61, 124, -88, 53, -44, 43, 72, -8, 125, -70, 8, 79, 21, -44,
+    -5, 82, 117, -50, 63, 112, 21, -43, 120, -113, -67, 109, -122, -26, -88, -15,
+    -113, 27, 87, 43, -107, -15, -68, 26, -95, 88, 113, 34, 60, 85, -2, 46,
+    -32, 64, 16, -99, 26, -71, -94, 19, -114, 5, -70, 33, -96, 50, 18, -67,
+    -50, -11, -111, 33, -28, -5, 89, -109, 18, -80, -40, 62, -24, -56, 38, 105,
+    -62, -110, 18, -21, -98, -8, 78, -103, 1, 69, 35, -13, -56, 30, -76, 69,
+    105, -52, -23, 112, -43, 9, 120, 98, 52, -113, 15, -11, -124, 19, 118, -18,
+    94, -111, -78, -4, 60, 88, 47, -55, 76, 109, -34, 127, -81, 92, -4, 82,
+    112, 8, -39, 96, -74, 23, 117, -97, -57, 102, 83, 29, -109, -85, 72, -102,
+    -31, 32, 70, -77, 54, -60, -123, 97, 51, -84, 103, -95, 57, 88, 6, -36,
+    46, -98, -3, -118, 22, 65, -85, -27, -49, 74, -74, -38, 102, -65, -83, -96,
+    28, -59, 126, -26, -126, -15, 112, -43, -87, 57, -122, -57, 71, -46, -27, -120,
+    38, -91, 75, 49, -123, -51, 61, 6, -16, 40, -123, -3, 48, 115, -16, 10,
+    92, 123, -120, 2, 103, 39, 12, -18, -72, -33, 18, -3, -42, 124, -116, 94,
+    -63, 117, 59, -73, 92, -58, -101, 38, 4, -17, 124, -98, 43, 75, -46, 53,
+    82, 4, 39, 102, -65, 10, -106, 33, -5, -24, 25, 9, 41, -108, 58, -76,
+    100, -19, -64, 15, -24, 105, -87, 77, -34, -67, 110, -93, -48, 88, -70, 56,
+    -95, -12, -53, 85, -37, -89, 125, -47, 29, 91, -118, 74, -69, -106, 23, -10,
+    -83, 16, 77, -30, 32, -10, 82, 109, -118, 49, -56, 67, 7, -27, -7, 115,
+    -104, -39, 72, -89, 54, -35, 120, -76, 82, 105, -101, 95, -14, 117, 2, 20,
+    -54, 65, 121, -103, 84, -8, 30, -114, 51, 93, 14, -29, 68, 20, -115, -42,
+    109, -82, 49, 28, -24, -112, 66, 83, -100, -58, 115, -23, 38, 52, 81, -28,
+    37, -125, -46, -91, 124, -111, -37, -76, 20, 94, -87, 28, -109, 93, -121, 22,
+    -73, -14, -118, -50, 96, 23, 71, -119, 40, -64, 63, -89, -71, -39, 106, -95,
+    31, -117, -1, -79, 40, -61, -40, 124, -76, -103, -7, -59, 120, -80, 1, 34,
+    67, 16, -104, -68, 114, 5, -76, -8, 42, 58, 9, -90, 106, -48, -97, -59,
+    103, 54, 5, 96, 44, 12, 71, 55, -62, -30, -3, 110, -69, 37, -53, 106,
+    65, 13, 90, 34, -1, -100, -56, -13, 7, -31, -48, 21, 86, -123, 72, 51,
+    -31, 94, -42, 55, 110, -95, 65, 19, -19, 74, 32, 60, -120, 44, 97, -25,
+    -64, 79, -6, 93, 59, -51, 21, 104, -125, -40, -12, 70, -77, -2, 12, 118,
+    66, -75, -103, -18, -68, -51, -2, -97, 119, -125, 77, -42, -19, 60, -86, -32,
+    45, -92, 122, -69, -28, -83, 47, 108, 89, -112, 121, -2, 47, -21, -62, -84,
+    -10, 79, 17, -113, -27, 6, 87, -124, -49, 101, -86, -37, 82, -13, -99, -51,
+    -127, 122, -39, -115, 43, -97, 75, -30, -83, 121, -62, -108, 29, 98, -119, -20,
+    -42, -4, 26, 112, 84, -116, 105, 29, -14, 88, 43, -107, 12, 123, 0, 84,
+    -60, -21, -111, 59, 81, 116, 17, -41, -92, 55, -79, 74, -106, 33, 13, 125,
+    -102, -72, 115, -51, 34, 99, -73, -4, 43, 114, 8, -107, -69, 24, 106, 56,
+    13, 38, -21, -85, 109, -14, -66, 34, 89, 51, 17, 81, -32, 62, 47, -88,
+    90, -112, 71, -34, -89, 62, -25, -80, 8, -54, -90, 54, -75, 73, -117, -100,
+    101, 6, 24, -47, -9, -105, 66, -71, -18, 27, 97, -27, -52, 105, 89, -45,
+    5, 42, 69, -87, -15, -105, 57, -32, -93, -57, 54, -23, 125, -1, -85, -32,
+    -108, -73, 4, 27, 85, -42, 11, -109, -1, -98, -20, 108, -114, -53, -67, 19,
+    34, 122, -63, 49, 17, 38, -44, 96, 68, 34, -34, 104, 22, -48, -11, 32,
+    -40, 76, -79, 43, 98, -118, 1, 37, 80, -126, 10, -66, -94, -7, -113, 56,
+    -29, -126, -59, 22, 107, 79, -63, 30, 95, -111, 20, 89, -47, 70, 46, 88,
+    115, 73, 97, -61, 52, -121, 125, 60, 101, -46, -73, 39, 6, 117, -8, 81,
+    -28, -96, -49, -8, -120, -71, 125, -102, -115, -66, 117, -21, -97, 91, -70, 117,
+    51, -126, 113, -62, -31, -85, 104, -58, 124, -47, 52, 112, 40, 67, -77, 26,
+    81, 97, -1, 50, -38, -120, 13, 122, 67, -14, -76, 38, -122, -97, -60, -12,
+    60, -91, -49, -102, -4, 69, -76, -24, -57, 25, 73, -90, -37, 94, -80, -124,
+    58, 9, 98, 77, 107, 5, -16, 80, 20, -7, 60, -121, 5, 42, 66, -26,
+    14, -94, -16, 69, 30, 13, 56, -24, -96, -4, -109, -36, 18, -18, 117, -63,
+    -89, -20, -98, 120, -78, -5, -23, -83, -44, 1, 78, -32, 102, 10, 32, -41,
+    19, -25, 44, 106, 22, -35, -89, 42, 84, -123, 119, -15, 64, -102, 44, -41,
+    109, -75, -21, -104, -82, 55, -59, -32, 48, -87, 94, -41, 78, -58, -109, -86,
+    97, -53, 2, 91, -99, -45, 84, -77, 22, 73, 101, -83, 91, -121, -46, 47,
+    103, 14, 61, -48, 72, 41, 86, -101, 49, -118, 118, -90, 58, -70, 109, -115,
+    0, 124, -119, -13, -67, 92, 111, 17, -9, -105, 53, 10, -61, 29, 74, 0,
+    -57, 27, 40, 65, -39, 22, 90, -99, 113, -51, 12, 29, -79, 126, -2, -37,
+    25, 58, -74, 123, -112, -5, 107, -120, 43, -16, 59, -60, 3, 77, -99, -6,
+    -35, -117, -68, 31, -110, 105, -54, 25, 96, -65, 14, -54, -6, -21, 91, -80,
+    -56, 69, -85, 82, 34, -113, 5, -97, -41, 97, -31, -78, 106, -113, -23, 121,
+    -98, 85, -112, -6, 119, -125, 35, -1, -74, 66, -110, 101, -13, 53, 36, 108,
+    83, -117, 44, -26, 64, 35, -55, -32, 118, -69, -105, 31, -26, 126, 24, 69,
+    38, 115, 91, -10, -29, -90, 6, 62, -36, 111, 45, 72, 27, -106, 77, 36,
+    52, -31, 11, -45, 57, -22, -53, 78, 64, -65, 36, -4, 82, -45, 20, -85,
+    53, -33, 13, -70, -52, 100, -89, 75, -17, 42, -30, -62, -94, -124, -24, -69,
+    -100, -8, -40, 18, -65, -95, 76, 6, -88, 14, 87, -49, 50, -88, -73, -56,
+    -107, 4, -82, 77, 20, 126, -70, -108, -18, -81, -98, -27, -126, 120, -38, -99,
+    95, -71, 102, -106, 121, -77, 45, 115, -84, 23, -116, 123, -92, 59, 99, -67,
+    -11, 110, 93, 71, 47, -26, 11, -43, -116, 122, 86, 4, 67, 114, 17, -47,
+    74, 102, -84, 88, 115, -13, 52, 95, -41, 66, 113, -113, -10, 107, 10, 86,
+    -18, 49, -42, -60, -125, 43, 92, -7, 75, 35, 4, 101, -46, 48, 9, -8,
+    113, -121, 29, -2, 74, 19, -125, -15, 1, 102, -51, 49, -17, -126, 7, 40,
+    -106, -50, -119, -81, -14, -103, 61, 107, -66, 19, -107, 32, -39, 90, -87, 60,
+    7, -59, 33, -125, 4, -76, -107, 28, -122, -6, 38, -94, -38, 62, -124, -30,
+    99, -92, 65, 111, -21, 56, -51, 17, -114, 87, -60, 60, -77, 86, -64, -89,
+    -18, 62, -57, -25, -90, -36, -60, 56, 85, -108, -27, 14, 72, -59, -35, 81,
+    64, 24, 3, 35, 124, -58, 26, 83, -84, 55, -10, -79, -57, 43, -16, -115,
+    111, 48, -22, 70, 104, -49, -28, 124, -59, -73, -23, 102, 20, 80, -64, 32,
+    120, 15, -116, 31, -1, -97, -78, 118, -42, -89, 114, -20, 18, -108, 70, 22,
+    37, 84, -100, 47, 90, 107, 32, -99, -42, 39, -71, 89, -83, 32, 105, -76,
+    -21, 116, -39, -93, 76, -6, -121, -34, 0, -50, 104, 73, 120, -104, -2, -72,
+    24, -93, -36, -108, 22, 61, 41, 84, 11, 74, 57, -54, 0, -79, 46, -105,
+    -49, -9, -73, 81, -37, 102, 70, -28, 49, 25, -6, -119, 41, 123, -29, -48,
+    -82, 5, 119, -72, -12, 67, 8, 126, -86, 64, 111, -10, -102, 118, -2, -95,
+    -112, 86, -66, 58, 103, -74, 50, 114, 36, -95, -23, -118, 21, -30, 99, 65,
+    -45, 124, 81, -3, -63, -87, -15, -98, 106, -84, -117, 91, -107, 115, -16, 73,
+    -85, 59, 93, -61, -107, 11, 33, -118, 97, -68, 68, -37, -92, 0, 93, -114,
+    58, -35, 17, -47, -106, -117, -67, -23, -5, 24, -122, -34, 50, -48, 22, 56,
+    -56, 42, 16, -30, -108, -20, 10, 90, -110, 64, 96, 7, 51, -65, 79, 35,
+    -101, -11, -79, 52, 96, 116, -115, -35, 0, 48, 26, -31, 36, -44, 8, 105,
+    22, -33, 3, 42, 109, -86, -12, -57, 6, -104, 83, 104, -53, 51, -73, 108,
+    -7, -123, 103, 77, 27, 96, 53, -49, 101, 76, -56, 7, 96, -115, 79, -16,
+    100, 1, -122, 93, 29, -54, -90, -41, -64, 23, -76, -44, -92, 113, -123, 12,
+    -56, 89, 9, -121, -52, 15, 33, 68, -46, -65, -12, 123, -90, 66, -122, -58,
+    -98, 122, -114, -19, -47, 61, 86, 126, -24, 56, -80, 13, -12, 29, 77, -59,
+    24, 44, -86, -28, -2, 42, -80, 15, -109, -94, 44, -68, 67, -85, -31, -73,
+    125, -44, -84, -11, 68, 118, 40, 79, -14, 126, 44, 85, -7, -34, -81, -20,
+    46, 106, -31, 39, 76, -24, -73, 90, 113, -102, 81, 14, -75, 98, -22, 83,
+    30, 48, -76, 76, 16, -123, -74, 43, -96, -45, 36, -125, 116, -107, -25, -96,
+    87, -51, 62, -64, -94, 121, 70, -32, 86, 114, -20, 29, 120, -5, 38, 14,
+    -106, 73, 48, 109, -69, -105, 59, -3, -124, -30, -103, -55, 60, 33, 95, 69,
+    -111, -91, -67, 120, -105, -7, -93, 54, 8, -125, 62, -52, 41, -7, 55, -69,
+    -39, -5, 96, -93, 115, 28, -35, -4, 70, 112, -18, 92, -66, 67, 9, 126,
+    -19, -110, 111, 90, -16, -42, -127, -62, -11, 56, -80, -40, -100, 84, -121, 60,
+    -61, 27, -96, 7, -34, 21, -78, 99, 15, 67, 108, 4, -116, 121, 19, -47,
+    -3, 56, 28, -44, 63, 101, 23, -55, -81, -19, -36, 110, -114, -96, 18, 103,
+    -119, 67, -52, -27, 54, -64, 104, -109, 9, -59, 21, -88, -33, 41, -43, -81,
+    52, 0, 15, 36, -104, 6, 25, 106, 37, 3, -119, 16, 103, -50, -22, 111,
+    -36, 87, -17, -52, 91, -115, -22, -48, -95, -68, 28, -85, -17, -63, -98, -73,
+    78, 113, -16, -82, 5, -112, -34, 127, 45, 96, 28, 2, 87, -60, -31, 117,
+    -82, 10, 38, -111, 4, -15, 78, -83, 97, -114, 83, 60, -1, -117, 98, 74,
+    -67, -38, -119, -76, 76, 99, 60, -87, -105, -54, 94, 64, -65, 46, -88, -1,
+    97, -77, -127, 63, 121, 36, 53, 113, 82, 39, -38, 88, 71, 49, 7, 99,
+    -28, -125, 16, 94, -62, 35, 81, -12, -100, 73, -68, -88, 50, 71, 34, -105,
+    -17, 80, 124, -71, 65, -100, -41, 47, 32, -26, -74, 45, 119, -55, -103, 20,
+    -92, 84, 122, -30, 49, -49, -70, -24, 79, 125, -36, 28, -9, 77, 11, -111,
+    52, 34, 17, -7, 76, -86, -60, 2, -12, -120, 101, -25, -108, 109, -40, 39,
+    -104, -55, 47, -95, 70, 111, -120, -74, 13, -43, -110, 121, -23, -48, -1, 92,
+    51, -44, -89, 26, 89, 113, 18, -55, 123, -6, -46, -97, 13, -14, 33, 109,
+    -5, 40, -58, 21, -8, -97, 117, 17, 46, -15, -77, -115, -97, 116, -72, -43,
+    123, -93, -28, -67, -108, -39, 25, -103, 63, -75, 11, -53, 24, -79, -7, 65,
+    27, 124, 83, -37, -22, -2, -50, 61, 106, 39, -8, 20, 100, -124, -79, -65,
+    23, -118, -4, -58, -29, -124, -10, -92, 67, -118, 92, 73, 103, -80, 65, -28,
+    -112, 57, 98, -86, 66, -121, 0, -43, -111, 69, 9, 88, -30, 32, 58, -13,
+    73, -53, 103, 48, 111, 9, 94, -28, 126, 44, -91, 114, 57, -122, 85, -88,
+    -15, -68, 3, -77, -107, 50, 27, -91, -27, 91, -59, 56, -96, 8, 115, 63,
+    -35, 109, 97, 57, 39, -77, 101, 51, -70, 5, 27, -35, -64, -122, 87, -47,
+    -74, 10, -104, -19, 108, 80, 36, 91, -61, -90, 110, 41, -58, 102, -122, 20,
+    -102, 3, 84, -81, -16, 33, -117, 79, -65, -43, 74, -17, 3, -62, 118, -46,
+    -116, 105, 60, 15, 98, 117, -67, 79, 5, -116, -82, -35, 80, 42, -14, 76,
+    -93, 13, -20, -108, 77, 8, -40, 84, -25, 110, -106, 55, -18, 3, 47, 118,
+    -12, 76, -41, 30, -69, -33, -79, 114, 24, -26, 54, -4, -46, -85, -23, 92,
+    -65, 41, -120, -44, 66, -94, -51, 54, -2, -99, 31, -112, 92, -34, 37, 71,
+    21, -30, -94, 36, -123, -43, -10, -103, 124, 68, 31, 112, -70, -111, 27, -56,
+    -115, 47, -70, -49, 122, -97, 34, -112, 19, -52, -82, 37, 114, -92, -54, 25,
+    93, -126, 123, -56, 54, 12, -101, 60, -9, -126, -69, -105, 82, 68, 7, 109,
+    -37, 61, 23, -3, 97, 119, -78, -19, 108, 19, 100, 50, -74, 14, -101, -5,
+    51, 90, -53, -19, 65, 86, 22, -32, 44, -51, -17, -2, 94, -46, -25, 126,
+    3, 87, 31, -85, 66, -5, -61, 116, -14, 62, 81, -42, 94, 15, -106, 61,
+    -35, 38, -94, -2, 103, -116, -17, -51, 75, 102, 14, 122, 26, -113, 48, -75,
+    -96, 124, -25, -110, -60, 16, 39, 87, -121, -36, -83, -54, -22, 79, 103, -85,
+    -64, -111, 110, -81, 0, -61, -89, 55, -75, -125, 18, -107, 61, -89, 102, -78,
+    56, -38, 111, -16, 17, -33, 94, -78, 41, -94, -124, -6, -72, 72, -24, -83,
+    -63, 6, 68, -28, 81, 42, 120, -91, 32, -39, -83, 63, -34, -14, -54, 35,
+    -7, 87, -84, 71, 51, -32, -104, 6, -67, 65, -7, 120, 59, -126, -48, 126,
+    -13, 10, 73, 42, 119, -115, 104, 7, 88, 108, 75, -63, 46, 7, 33, -11,
+    -99, -62, -125, 80, -103, 53, -118, 71, 2, 107, -28, 29, 126, -115, 43, 110,
+    21, 100, -72, -108, -82, 22, -64, 5, 93, 45, -60, 2, -95, 89, 116, -124,
+    12, -48, 32, -70, 112, -9, -45, 74, 114, 24, -109, 35, -93, -1, 25, 64,
+    -37, 31, -100, -47, -28, 26, 72, -18, -42, -94, -27, 121, -39, 84, -116, 72,
+    19, 96, -2, 42, -56, 120, 28, -46, -66, 91, 50, 9, -60, -45, -14, 78,
+    -117, -49, 51, -9, 90, -43, 64, -29, -118, -102, 85, -22, 104, -71, 56, 75,
+    -101, 106, -18, 81, -91, -125, 101, 46, -87, -25, 83, -42, 93, -68, 46, -115,
+    -76, 85, 100, -7, -71, 50, -101, -57, 38, -4, 26, -80, -102, -18, -55, 118,
+    -31, 61, -80, 107, -26, -90, 7, -17, -105, -36, -81, -109, 63, 96, 0, -99,
+    116, -20, 33, 125, 11, -113, 106, -76, 116, -10, 53, 30, -111, -44, 20, -27,
+    -59, 50, -116, 21, 3, 62, 28, -53, -98, 2, -60, 104, 11, -16, 76, 111,
+    -24, -90, 55, -119, 15, 93, -83, 125, -110, 98, 66, 49, 14, 104, -72, 39,
+    -93, -47, -112, 14, 74, -71, 99, 55, 81, 18, 119, 76, -92, 33, -75, 57,
+    -86, 86, -36, -96, -60, 55, -20, 26, 72, -53, 12, 126, -81, 42, 5, -90,
+    95, -3, -40, 122, -63, -29, -78, -15, 126, 57, 39, -121, -82, -33, -103, 17,
+    -61, 1, 122, -55, 78, -33, -11, 58, 11, -68, -118, -51, 91, -7, -123, 54,
+    2, 93, 30, -13, -40, 36, -98, 115, -120, 39, -52, -10, -26, 105, -39, 12,
+    -55, 64, -122, 3, 77, -87, 40, -2, -97, -37, -67, -120, 78, -13, 68, 119,
+    -75, 35, 66, -99, 99, 43, 89, 75, -110, 18, -74, 69, 119, 50, -49, 97,
+    37, 68, -40, 44, -109, 112, 30, -45, 75, -22, 114, -33, -89, 76, 24, 114,
+    -22, -66, 83, 127, -122, 64, -6, -58, -30, 0, -72, 53, 21, -126, 82, 45,
+    -3, -69, 112, 22, 103, -48, 96, -126, 83, 109, 62, -26, 99, -52, -105, -34,
+    -113, 86, -19, -84, -49, 12, -119, -3, -38, 108, -28, -9, 22, -114, 87, -13,
+    -95, -124, 24, -19, -88, 4, -74, -124, 42, -96, 4, 55, 34, -64, -38, -101,
+    66, -85, -107, 49, -51, -80, 91, 24, -87, 72, 98, -111, 113, -63, -17, -102,
+    98, -27, 41, -14, -110, -31, -69, 14, 48, -83, 23, 1, -94, 33, 110, 58,
+    24, -67, 6, 53, 112, -102, 32, -65, 95, -50, -101, 80, -58, -88, 61, 7,
+    117, -77, 104, -64, 85, 63, 99, -59, 109, 83, -78, -13, 123, -112, 9, -53,
+    99, 20, -31, 1, 106, 13, -23, 46, 111, -101, 11, -41, -83, 62, 29, 122,
+    17, -93, 73, -79, 61, 36, 122, -22, -56, -8, -106, 43, 89, -63, 13, -8,
+    -47, 104, -117, 77, -9, -32, 70, 47, -91, 55, 30, 0, 99, -38, 31, -66,
+    -29, 75, -4, 53, 16, -106, -26, -8, 25, -41, 17, -103, 65, 88, 46, 107,
+    -14, 39, 79, -62, -95, 71, -109, -38, -66, 57, -19, 36, 85, 3, -50, -112,
+    53, -41, 94, -55, -104, -3, 70, -113, 87, 117, -43, 75, -77, -30, -127, -86,
+    72, -26, 38, -57, 20, -75, 118, -19, 8, -79, 123, -123, 45, -18, 108, -111,
+    40, -52, -102, -35, 121, -48, 48, -91, 69, -114, 95, -52, -25, -72, -3, -92,
+    -77, -117, -44, 59, -9, 122, 34, 84, -120, 94, -57, 127, -96, -33, 72, -74,
+    87, -119, 3, 26, 108, -42, -89, 28, -73, 58, -117, -17, 106, 54, 119, 45,
+    92, -99, 123, -90, 90, -125, -46, 101, -114, 87, -24, -69, 68, -98, -81, 84,
+    13, 65, 96, -83, 30, -118, 89, 114, 1, -66, 43, 110, 30, -125, -36, 56,
+    16, 117, 92, 28, -127, -73, -50, -15, 5, 21, -79, -5, -116, 45, 110, -11,
+    32, -29, 119, -71, 80, 12, 51, 95, -33, 5, 37, -53, 10, -101, -3, -58,
+    28, -72, 2, -37, 62, 43, -4, 25, -59, 63, -40, 15, 113, 4, -45, -10,
+    125, -116, -23, 8, -68, -13, 37, -80, -34, 57, -15, -86, 6, 72, 121, 85,
+    -22, -101, -68, 4, -27, 100, 52, -84, 117, 75, -29, 52, 102, -66, 13, -87,
+    68, -102, 46, -85, -23, -121, -12, -62, -101, 114, -88, 98, 24, -38, 68, -20,
+    -110, 14, 82, -12, -108, 107, -83, 78, -102, -11, 39, -107, -54, 76, 57, 25,
+    -62, -91, 49, 111, 62, 79, -56, 11, -123, 125, -100, 80, -44, -104, -63, 34,
+    -51, 70, 48, 110, -92, 13, 67, 31, -108, -93, -47, 26, 79, -106, -20, -52,
+    97, -61, -9, 58, 100, -50, 127, 73, 19, -8, 64, -69, -120, 86, -80, 101,
+    -43, 115, 48, -53, 31, -68, -31, 11, 49, 116, 95, 28, -86, 100, -119, -33,
+    92, 36, -46, -4, -110, -95, 105, -21, 71, 27, -58, 100, 19, 45, -8, -115,
+    11, -86, -10, -39, 78, -114, -64, -37, 109, -9, 65, -126, 4, -38, 41, 113,
+    -123, 7, -39, 21, -107, 34, -91, 44, -45, -112, 83, -28, 46, 126, -93, 35,
+    59, -123, -84, 71, -21, 125, 93, -97, -49, -74, -124, -29, -6, 42, -71, -99,
+    -15, 70, -75, 89, -35, 20, 51, -43, 90, -73, -2, 54, -23, -78, 95, 114,
+    -33, 90, -110, 41, -54, 95, -20, 1, 46, -74, 98, -57, 118, 88, -94, 22,
+    -78, 83, 121, 70, -67, 86, 8, -75, -20, 108, 31, -58, 2, -16, 18, -63,
+    -5, -29, 90, -96, 18, -113, 55, 1, 73, -19, 83, -63, 121, 54, 18, 107,
+    3, 118, -124, 31, -63, 122, -82, -104, 40, -113, -31, -92, 108, -121, 64, -69,
+    25, 59, 119, -79, 18, 35, 123, -120, 83, 16, -25, -88, 55, -70, -4, 62,
+    44, -19, -89, -116, -1, -29, 113, -126, 93, 53, -84, -104, 78, -45, -113, 74,
+    112, 9, -71, 106, -9, -60, -41, 36, -87, 23, 59, 10, -110, -46, -24, 81,
+    -54, -84, 15, -26, 67, -1, -17, 101, 8, 63, 119, -52, 11, 74, -42, 2,
+    -99, -20, -62, -3, 63, -98, -82, -45, 59, -103, 29, -12, 37, -114, -27, -45,
+    -100, -55, 30, 107, -44, 48, 63, -54, -6, -36, 10, 116, 60, 99, -76, 51,
+    -101, -49, 44, 29, 65, 86, -122, 101, 120, -104, -38, 108, -91, 69, -79, -115,
+    40, 58, -103, 98, 44, -115, 75, -50, -68, -12, 81, 26, -108, -18, 35, -88,
+    52, 85, -125, 107, -33, -13, 88, 8, -65, 104, -50, 127, 75, 12, 95, 115,
+    2, 91, 54, 15, -11, -82, -105, 23, 72, -97, -71, 21, -123, -8, -32, 26,
+    92, -17, -119, -37, -81, 5, -25, -70, -10, -55, 46, -1, 89, -14, 25, 96,
+    -36, -9, 110, -44, -72, -90, 24, 115, 35, -126, -84, 47, -65, 89, 121, -57,
+    102, 9, -44, 27, 71, -109, 116, 40, -30, 69, -122, -79, -37, -107, -65, 68,
+    -119, -34, -72, 77, -113, 95, 122, -64, 35, 103, 88, -21, -57, 41, 123, -87,
+    -61, 57, 120, 78, -98, 115, 52, 16, 67, 95, -119, -72, 35, -57, 124, 6,
+    -93, 74, -61, 10, 83, 54, -31, -98, 91, -41, 0, 111, -34, 59, -6, -105,
+    -27, 42, -72, -92, 49, -52, -75, 23, -91, -6, 45, 6, 101, 50, 25, -16,
+    37, 124, -94, -58, -21, 41, -47, 4, -27, -117, 48, -44, 69, -95, 2, 80,
+    15, -109, -4, 21, -53, 33, -108, -45, -93, 29, -22, 78, -106, 61, -127, -68,
+    51, 30, -21, -121, 126, -12, -60, 16, 58, -22, 99, -96, 16, -121, -80, 23,
+    67, -116, 125, 82, 12, 102, -23, 77, -114, 112, 90, -21, -56, -91, 110, -81,
+    82, 10, 59, 102, 20, 66, -99, 82, -86, -9, 119, -81, 30, 104, -112, -38,
+    108, -77, -28, 99, -67, -15, 107, 80, -78, 117, 8, -36, 111, 16, -26, -45,
+    114, -110, 93, -81, 38, 2, 104, -118, -77, 70, -55, 33, -70, 78, 108, -47,
+    92, -1, -35, -11, -63, -122, 2, 53, -43, -61, 31, -99, 84, -5, 62, -50,
+    -109, -9, -40, -124, -3, -77, -33, 107, 17, 59, -105, 8, 86, -67, -12, 49,
+    -50, 71, 38, -90, 64, 47, -126, -32, -6, 55, -100, -52, -84, 47, 100, 0,
+    -78, 63, 14, -36, 68, -105, -46, 80, 45, 7, -112, 125, -11, 52, -24, 36,
+    -66, -101, 58, -83, 32, 94, -103, 123, -10, 63, -73, 15, -38, -123, 19, -26,
+    112, 47, -86, 118, 30, 91, -111, 45, -65, 75, -54, -18, -32, -119, 66, 28,
+    -99, 7, 88, -114, -40, 4, 93, 23, -61, 37, 98, 66, -7, 85, -96, 37,
+    78, -11, -51, -95, 116, -70, 27, -17, 110, -90, -30, 87, -43, -106, 10, -91,
+    118, 19, 77, 112, -49, 45, -34, 20, -88, 106, -111, 74, 121, 40, 97, -72,
+};
+static const uint8_t MONO_400_GRAIN_RESPONSE[] = {
+    60, 75, 90, 100, 100, 100, 100, 100, 95, 90, 80, 70, 60, 50, 40, 30,
+};
+const GrainTile MONO_400_GRAIN_TILE = {64, 60, MONO_400_GRAIN_RESPONSE, MONO_400_GRAIN_NOISE};
+
+static const int8_t TEST_FILM_GRAIN_NOISE[] = {
+    26, -91, -28, -111, 88, -41, 36, -53, 11, 51, 92, -94, 57, -10, -109, 73,
+    -64, 123, 51, -55, 13, 119, -30, -87, 108, -57, 5, -38, -113, 107, -23, -48,
+    101, -99, -52, 120, -76, 92, 56, -100, -31, -57, -92, 15, -113, 106, -49, -118,
+    59, 34, -63, -124, 53, -44, 121, -78, 73, -53, 25, 63, -64, 12, 99, -53,
+    53, 96, 71, 20, 46, -85, 77, -21, 115, -113, -42, 29, 121, 18, -79, 43,
+    -16, 5, -82, 37, -17, -95, 30, 0, 71, 42, -92, 81, -61, 11, 49, -69,
+    -2, 83, 52, -110, 11, -47, -1, 114, 20, 43, 91, 57, -65, 31, 49, -72,
+    -8, -45, 70, -3, 98, 14, -112, 42, -27, 107, -101, -9, 87, -28, -97, -6,
+    -38, -123, -16, -61, -6, 121, -122, 25, -80, 85, -14, -69, -119, -33, 81, 103,
+    -46, -125, 63, 96, -69, 87, 59, -53, -107, -24, 122, 33, -15, 89, -102, 122,
+    19, -84, -16, 29, 77, -90, -19, 83, -79, -121, -1, -42, 79, -87, 7, 122,
+    86, -108, 108, -84, -29, -59, 83, -8, -67, 10, 49, -41, -80, 56, 114, -72,
+    43, 125, -77, 82, -98, -37, 65, -59, 0, 60, 35, 97, 65, 3, -61, -100,
+    31, 113, -32, -107, 21, -41, -122, 112, 84, 18, -69, -125, 63, -80, -34, 38,
+    -119, 97, -35, -64, 107, 58, -108, -59, 51, -25, 123, -99, -12, 97, -26, -100,
+    24, -34, 10, 45, 74, -103, 29, 112, -93, 79, -121, 124, 32, -114, 21, 77,
+    -50, 6, 27, 56, 105, 11, 39, 100, -109, -33, -98, -51, -87, 112, -23, 60,
+    10, -88, 75, -2, 122, 47, -14, 8, -84, -37, 54, -1, -47, 114, 75, -10,
+    -50, 68, 47, -115, -6, -42, 36, 110, 5, 71, -70, 30, 62, -127, -48, 75,
+    -81, 63, -65, -120, 123, -18, -80, 60, -34, 24, -15, -52, 98, 3, -33, -104,
+    100, -88, -109, -29, -53, -115, -76, -25, 72, 17, 123, -9, 46, 19, -112, 91,
+    -68, -14, 43, -54, -77, -96, 67, -65, 37, 103, -97, 92, 24, -106, 5, -92,
+    109, -73, 8, 125, -82, 86, 15, -89, -46, -113, 103, 9, -58, 117, 16, 44,
+    -12, 112, 37, -6, -49, 13, 93, -56, -107, 90, -76, 69, -98, -62, 88, -9,
+    38, 66, 110, -1, 45, 91, -11, 116, -92, -66, 82, -126, -37, 77, -79, 41,
+    -38, 106, -119, 89, 17, 100, -46, 80, -118, -12, 64, -58, -23, 44, -67, 56,
+    25, -21, -100, 31, -26, 64, -124, -13, 89, 34, -33, -86, 48, -16, -72, 103,
+    -115, -51, -93, 96, 66, -100, 38, -3, 53, 118, 8, 41, -23, 59, 25, -74,
+    -22, -44, -67, 76, -85, 20, -57, 50, 27, -42, 55, 4, 107, -58, -10, 119,
+    24, -94, 65, -36, -15, -113, 29, -29, 124, 16, -76, 108, -115, 78, 101, -35,
+    -123, 71, 89, -50, 101, -70, 43, 121, -77, 63, -7, 78, -107, 87, -94, -34,
+    8, 69, -22, 24, -75, -30, 106, -123, -26, -88, -47, -118, 105, -85, 117, -123,
+    87, 17, -116, -19, 114, -100, 86, -121, -3, 101, -103, -74, 36, -95, 69, -117,
+    -50, -4, 33, -65, 46, 116, 3, -87, 51, -105, -41, 29, -6, -83, 14, -55,
+    118, -3, -88, 52, -104, 5, -53, -30, 13, -99, -56, 115, -38, 25, 58, 94,
+    33, -68, 117, -118, 54, 80, -62, 18, 76, 35, -13, 84, 18, -39, -2, 47,
+    -94, 123, 59, 38, -40, 4, 64, -27, -83, 73, -18, 15, 87, -23, 49, 12,
+    97, -81, 112, 74, -101, -75, 65, -55, 96, -15, 83, 54, 120, -29, -100, 62,
+    37, -71, -33, 20, -16, 112, 73, -110, 53, 99, 28, -123, 6, -69, -9, -112,
+    -84, 82, -40, 14, -5, -95, 126, -39, -73, 110, -103, 57, -68, -108, 73, -59,
+    -30, -76, -8, -104, 97, -78, -52, 123, 33, -62, 110, -48, -108, 125, -42, -69,
+    79, -21, -124, 4, -31, 84, -9, 38, -99, 12, -65, -118, -52, 39, 94, -14,
+    -110, 108, 74, 95, -121, 30, -83, 91, -5, -67, -21, 70, 45, 104, -50, 127,
+    1, 50, -105, 101, -53, 42, -14, -113, 47, -4, -55, 29, 127, -18, 102, 12,
+    69, 100, 27, -59, 74, 18, 47, -110, 2, 58, -119, 26, 65, -82, 5, -110,
+    29, 61, -53, 22, 103, -60, -120, 109, -43, 70, 102, -88, 0, 75, -76, 25,
+    -58, 6, -95, -44, -64, 61, -25, -46, 37, -88, 120, -41, -81, -100, 76, -29,
+    22, -63, -16, 61, -81, 90, 22, 66, 98, -84, 87, -34, 5, -81, 34, -113,
+    -1, -44, -124, 118, -26, -100, -15, 100, -36, -89, 84, -7, -31, 94, 43, 110,
+    -36, -98, 120, 42, -87, 57, 1, -28, -80, 34, -20, 23, 112, -41, -124, 124,
+    68, -30, 32, 50, -3, 124, 15, -117, 108, 57, -107, 18, 93, -16, 35, -122,
+    66, -93, 119, 29, -127, -31, -66, -98, -24, 13, -127, 63, -101, 88, -47, 52,
+    -90, 86, 45, 7, -84, 57, 81, -72, 22, 117, -54, 49, -69, -97, -17, -62,
+    82, -1, -75, -14, -113, 90, 21, 49, 124, -112, -61, 65, -99, 50, 13, -18,
+    -90, 91, -112, 104, -77, -99, 70, -59, 9, -18, 79, -61, 1, 58, -70, 112,
+    -52, 85, -35, 3, 72, 114, -2, 105, -52, 37, 114, -60, 45, -21, 119, -65,
+    29, -19, -74, -38, 94, 25, -48, -123, 44, -18, -105, 11, 112, 30, 73, -114,
+    19, 54, 94, -33, 66, -49, -73, -100, 79, 6, 97, -34, -7, -73, 105, -50,
+    58, -66, 14, -16, 77, -33, 43, 99, -96, -40, 32, -118, 102, -38, -105, -6,
+    14, 43, -107, -76, -49, 44, -111, 52, 80, -78, -11, 76, -90, 20, -119, 72,
+    102, -113, 113, 67, -109, -8, 126, 6, 97, -82, 62, 89, -121, -40, -4, 103,
+    -83, -48, -107, 14, 115, -6, 104, -35, -12, -85, 45, -118, 88, 35, 75, -114,
+    -8, 38, 114, -51, -124, 27, -69, -12, 84, -79, 123, 48, -89, 24, 69, 93,
+    -81, -19, 104, 22, 87, -20, -85, 7, -33, -116, 27, -44, 2, 108, -34, -5,
+    -46, 54, 17, -56, 36, -89, -66, -28, 71, -50, -2, -32, -78, 58, -57, 40,
+    -22, 125, 33, -65, -94, 38, -124, 70, 31, -47, 116, 18, -56, -92, -35, 8,
+    84, -102, -81, 65, 95, -2, 117, -108, 19, 64, -3, -48, -19, 114, -60, -30,
+    52, -116, 68, -61, -98, 34, 126, -63, 96, 57, 119, -106, 86, -80, 58, -99,
+    -68, 0, -91, -16, 106, 83, 56, -114, 32, -97, 115, 40, 17, 119, -96, 84,
+    -124, 67, -9, 85, 55, -54, 10, 96, -67, 61, -101, -22, 66, 107, 27, -78,
+    120, -39, 11, -27, 48, -92, -44, 52, -28, -123, -66, 73, 15, -113, 39, -95,
+    126, -45, 5, 113, -8, -44, 65, 18, -96, -4, -71, -24, 42, -56, 23, 95,
+    44, 119, 79, -126, -34, 9, -52, 109, 13, 82, -65, -106, -19, 72, 1, -69,
+    11, -42, -80, -111, -19, 110, -87, -25, -114, -4, 93, -78, 3, -126, -14, 42,
+    -59, 54, 102, -106, -65, 15, 89, -74, 111, 36, 99, -97, 89, -71, 4, 75,
+    -11, 30, -73, 57, -105, 92, -125, -23, 41, -49, 64, 101, 8, -124, 75, -23,
+    -110, -39, 22, 62, -78, 46, -101, -24, -73, -12, 50, 101, -53, -117, -31, 105,
+    29, 90, 45, 103, 16, -41, 78, 43, 118, 24, -39, 50, 126, -48, 97, -98,
+    78, -119, -13, 34, 126, -19, 68, -102, 0, -55, -18, 27, -36, 56, 109, -54,
+    -125, 98, -89, -30, 38, 12, -70, 106, 79, -114, 23, -91, -37, 127, -7, -86,
+    11, -74, 98, -57, -5, 118, 28, 93, 63, -126, -40, 23, 85, 54, 35, -88,
+    -52, -105, -3, -64, 64, -120, -72, 8, -96, -64, 82, -111, 33, -71, 56, -25,
+    2, 23, -72, 64, -50, -122, 32, -36, 86, 51, -82, 122, -116, -8, -87, -24,
+    47, 14, 77, 108, -60, 72, -6, -37, -79, 115, -18, 71, -73, 51, -59, 104,
+    84, -13, 39, -97, 73, -110, -42, -85, 4, 127, -91, -5, -75, -101, 122, -11,
+    62, 116, -28, -94, 30, 124, -19, 56, -47, 66, -21, -88, -9, 15, 83, -86,
+    116, -41, 97, -93, 85, -4, 104, -87, 18, -108, 70, 6, -48, 78, 33, 90,
+    -68, -40, -101, -15, -115, 123, -92, 56, 35, 2, -104, 93, 12, -112, 26, 58,
+    -46, -121, 123, -24, 16, 87, -10, 49, -57, 76, 39, 108, -29, 9, -61, 77,
+    -116, 19, 51, 78, -54, 2, 86, -107, 104, 13, 113, 45, 92, -35, -116, -55,
+    61, -108, 42, -24, 19, -75, 58, -57, 117, -27, -67, 41, 102, -95, 9, -111,
+    122, 67, 3, 52, 27, -43, 14, -121, 91, -68, -32, 46, -52, 109, -28, -98,
+    69, 28, -81, 54, -50, -71, 111, -114, -26, 16, -66, -118, 56, 96, 26, -21,
+    -73, -41, -85, 104, -104, -34, -84, 38, -10, -124, -74, -51, -99, 110, 28, -10,
+    93, 10, -63, 119, -113, 37, -31, -117, 75, -5, 93, -123, -20, -58, 51, -31,
+    26, -83, -55, 88, -73, 98, -22, 69, -50, 25, 120, -87, -13, 82, -79, 1,
+    -64, 93, -37, 104, -118, 38, 6, 64, 95, -102, -14, 88, -47, -84, -110, 109,
+    41, 91, 8, -20, 46, 113, 16, -67, 80, -32, 32, 62, 5, 71, -68, 48,
+    -30, -83, 72, -7, -45, 81, 111, 8, 40, -47, -88, 28, 65, 112, -76, 97,
+    -8, -122, 113, -27, -103, 47, -89, 106, -11, -108, 73, 8, -127, 62, 37, 114,
+    -17, 13, -103, -4, 68, -23, -94, -45, -75, 119, 31, 69, -3, 48, -36, 68,
+    -5, -123, -59, 28, -112, 65, -48, 97, 52, -89, 122, -20, -117, -40, -91, 123,
+    -126, 36, 106, -103, 55, -90, -15, -71, -99, 59, 127, 12, -39, -3, -105, 73,
+    -45, 57, 37, 13, 77, -6, -56, 36, -75, 53, -41, 94, -66, 17, -45, -115,
+    57, -86, 77, 26, -74, 121, 88, 19, 44, -30, -90, -60, -101, 118, 14, -56,
+    -94, 120, 56, 87, -70, -9, -97, -26, -115, 1, -59, 91, 25, 102, -1, 76,
+    16, -59, -36, 3, 27, -54, 99, 20, 83, -24, -64, -109, 81, -86, 42, 16,
+    -70, 87, -91, -42, -111, 121, 18, -114, 115, 0, -94, 34, -20, 122, -89, 89,
+    32, -59, 113, -29, -51, -109, 53, -9, -126, 81, 2, 107, 25, -23, -78, 99,
+    35, -27, -86, -37, 4, 124, 76, 22, 103, 45, 74, -98, -74, 44, -54, -23,
+    -96, 98, 63, -77, 125, -111, 66, -38, -121, 106, -8, 48, -51, 117, -26, 101,
+    -113, -17, 6, 102, -74, 55, -35, 72, -25, 84, -60, 104, -110, 48, -2, -31,
+    105, 4, -125, 50, 84, 11, -83, -55, 100, -71, 61, -39, -120, 75, 55, -108,
+    -9, 69, 19, 98, -116, 32, -82, -53, -12, -79, -38, 14, -13, 67, -113, 115,
+    51, -11, -116, 82, -28, 42, -4, -78, 53, 30, -82, 93, 18, -124, 2, -55,
+    34, 123, -60, 68, 31, -12, -93, -68, 44, -121, 22, 67, -39, -72, 74, -106,
+    -79, 70, -11, -91, 37, -17, 111, 65, -27, 17, -105, 42, 92, -63, 1, -42,
+    86, -64, -101, -51, 62, -29, 50, -102, 111, 31, -126, 116, 84, -34, -83, 26,
+    -69, -45, 36, 8, -60, -94, 86, 115, -52, 7, -105, -30, 69, -71, 54, 82,
+    -84, 60, -102, -27, -125, 78, 108, 9, 91, -46, -11, -88, 6, 111, 24, -50,
+    40, -38, 124, -62, 95, -41, -116, 32, -93, 122, -51, -15, 12, -95, 125, 27,
+    -127, 112, 41, -14, 107, -72, 90, 9, 72, -28, 51, -56, -104, 35, 106, 7,
+    74, 94, -86, 111, 60, -15, 17, -113, -24, 80, 119, 39, -44, 109, -95, -12,
+    -38, 23, -1, 97, 13, -63, -41, -106, 30, -80, 125, 45, 83, -122, -25, 96,
+    13, -116, 54, 24, -107, 3, -70, 92, -11, 48, 83, -87, 108, -30, 49, -81,
+    -20, 6, 78, -91, 22, -120, -8, -50, -110, -69, 94, 5, 59, -75, -9, -122,
+    -26, -103, 21, -36, -127, 105, -76, 33, 57, -93, -66, -10, -112, 10, 31, 94,
+    -118, 114, -53, -79, 40, 122, 63, -5, 105, 60, -31, -102, -53, -6, 62, -93,
+    -13, 90, -83, -25, 75, 117, 56, 15, -45, -122, -67, 35, 63, -117, -54, 93,
+    36, -44, -70, 53, -35, 115, 63, 40, 120, 23, -10, -87, 124, -48, 89, 66,
+    -54, 122, 54, -3, -65, 72, -40, 92, -58, 3, 67, 102, -80, 78, -28, -64,
+    44, 72, -96, 88, -31, -114, -86, -25, -58, -118, 16, 97, 34, -78, 120, -58,
+    74, -43, 107, 10, -55, -87, -29, -102, 73, 111, 7, -41, -8, 100, 14, 70,
+    -101, 121, -114, 98, 1, -62, -85, -21, -101, 75, -36, -119, 31, -28, 21, -91,
+    42, -14, -78, 90, 37, 11, -107, -11, 126, -123, -37, 23, 51, -53, 124, -101,
+    11, -17, -44, 55, 1, 24, 84, 50, 3, 81, -71, -17, 72, 8, -111, 51,
+    -103, -69, 35, -102, 46, -4, 86, -60, 31, -22, -97, 80, -75, -107, -26, -67,
+    -6, 59, -23, 31, -99, 76, 18, 105, -43, -74, 49, 107, 67, -106, 102, -63,
+    11, 80, -109, -45, -94, 113, 52, -85, 19, 46, 89, -98, -20, -119, -5, 61,
+    -76, 109, 29, -105, 114, -74, -45, 101, -97, 36, 117, -91, -47, 108, -27, 22,
+    0, 113, -11, 68, 100, -119, 20, 123, -79, 53, 96, 19, 47, 109, 33, 84,
+    -86, 19, -57, 85, -40, 48, -124, -2, 37, 92, 10, -58, -3, -76, -15, 61,
+    -117, -31, 117, 62, -7, -29, -61, 79, -23, -50, -73, 0, 115, 69, 32, 95,
+    -33, -125, 81, -60, -15, 67, -122, 13, -63, -10, -40, 60, -124, 44, -67, 85,
+    49, -122, -33, -84, -46, -18, 58, -108, 1, -44, -118, -62, -32, -91, 2, -45,
+    115, -122, 103, -81, -11, 124, -51, 82, -83, -115, -23, -96, 79, 43, 113, -49,
+    93, 28, -71, 9, 101, -121, 24, 98, -109, 66, 103, 41, -83, -42, -67, -96,
+    20, 47, -2, -86, 92, 40, -32, 126, 46, -105, 77, 18, -2, 100, -95, -42,
+    -77, 14, 78, 26, 116, -68, 93, -35, 36, 104, 68, -1, 122, 65, -111, 50,
+    -20, 41, 4, 61, -108, 30, -72, -17, 66, 103, 28, 117, -35, -124, 21, -96,
+    -5, 49, -102, -54, 43, -80, 59, -6, -92, 13, -33, -117, 82, 9, 107, -10,
+    -52, 70, 121, -42, 17, -103, -1, -82, 85, -25, 112, -85, -62, -21, 26, 124,
+    -18, 104, -60, -104, 41, 9, -89, 77, -61, -99, -24, -82, 30, -55, 92, -75,
+    76, -97, -35, -63, 75, 9, 109, -109, 17, -48, -70, 55, 7, -60, 83, -24,
+    -81, 109, 73, -19, 87, -36, 118, -57, 38, 113, -62, 30, -23, -106, 49, 78,
+    -115, -77, -22, -112, 60, 107, -52, 64, 21, -119, -50, 33, 73, 91, -115, 64,
+    -91, 52, -2, 88, -26, -126, 49, -14, 15, 116, 43, 89, -125, -18, 22, -3,
+    -51, 97, 34, 116, -25, -92, 54, -34, 46, -3, -105, 91, -83, 39, 123, 60,
+    14, -41, -123, 26, -94, 12, -112, -18, 81, -78, -3, 58, 125, -74, 24, -39,
+    112, 40, 11, 96, -66, 30, -96, -16, -71, 101, 7, 55, -107, -35, 4, -54,
+    17, -117, -38, -74, 59, 126, -47, 96, -115, -72, 3, -49, 59, 105, -90, 120,
+    -117, 10, -77, -111, 0, 81, -58, 97, -89, 121, 68, -13, -43, -101, -31, -114,
+    -68, 98, -7, 126, 67, -67, 93, 52, -40, -126, 96, -96, -48, 90, -16, -87,
+    2, -55, 80, -89, -5, -39, 78, 114, 45, -32, -90, -14, 121, -76, 46, 94,
+    119, 72, 36, 106, -98, 3, -84, 30, 61, -32, 78, -105, -8, -67, -33, 28,
+    68, -22, 57, 91, -45, 39, -121, 23, -68, -27, -117, 16, 107, 71, 0, 33,
+    80, 46, -85, -56, -31, 35, -1, -100, 27, 68, -24, 39, 15, -115, 61, 100,
+    -101, 54, -120, 33, 123, 55, -126, 0, -103, 93, 67, -63, 16, 75, -102, -31,
+    -65, -89, -15, -55, 24, 71, -19, -65, 111, -95, 18, 124, 34, 81, 51, -100,
+    -42, 104, -64, 18, -89, 123, -16, 64, 8, 83, 37, -57, 50, -73, 95, -52,
+    -15, -109, 19, 56, -117, 104, -82, 121, -61, 10, 111, -72, 75, -4, -60, 29,
+    -32, 116, -12, -51, -27, -79, 20, -61, 36, -45, 24, -115, 107, -44, 34, -5,
+    55, 88, 10, -106, 83, -37, -114, 86, -9, 49, -59, -22, -83, -120, 7, 88,
+    -82, 35, -126, -13, 53, -34, -79, 105, -48, -99, 111, -86, -20, -125, 23, -96,
+    114, -43, 96, 2, 83, -17, -43, 74, -11, -90, -44, -103, -28, 120, -82, 86,
+    9, -71, 64, 95, -108, 82, 102, -20, 118, -93, 85, -26, 1, -85, 98, -121,
+    26, -46, 114, 44, -70, 119, 12, 39, -43, -119, 105, 66, -42, 100, -16, -54,
+    118, 0, 71, 110, -104, 88, 34, -114, -7, 57, -32, 5, 74, 120, -7, 52,
+    -79, 64, -26, -69, -104, 21, 50, -120, 38, 90, 56, 99, 41, -121, 52, -43,
+    -107, 42, -88, 16, -7, 43, -43, -115, 55, -4, -72, 39, 60, -57, 71, -24,
+    -73, -95, -28, -125, -14, 55, -96, -76, 96, 23, -92, 8, 44, -67, 19, 55,
+    -114, -29, -51, 25, -68, 6, -57, 77, 25, -76, 86, -110, 28, -43, -62, 88,
+    4, 27, -99, 107, 70, -54, 114, -72, 14, -108, -19, 7, -56, 17, -13, 71,
+    110, -25, 102, -58, -97, 68, -70, 9, 75, -52, 99, -122, 124, -97, 12, 110,
+    76, -2, 60, 92, 26, -54, 104, 2, 71, -63, -19, 83, -114, 121, -98, 76,
+    -74, 40, 99, -86, -18, 65, 115, -94, -25, 126, -55, 46, -79, 101, -103, -29,
+    -119, 124, -48, 40, -5, -85, -22, 82, -37, 125, -66, -86, 81, 115, -97, -68,
+    4, -122, 33, 80, -36, 23, 122, -88, 32, -106, -20, 20, -40, -10, 47, -112,
+    36, 100, -65, 7, -85, 79, -23, -103, -36, 53, 114, -80, -33, -5, 31, -24,
+    112, 2, -109, 81, 47, -118, -42, -1, 55, -123, 10, 94, -10, 60, 13, 40,
+    76, -64, -15, 91, -124, 61, 31, -97, 45, -8, 69, 32, -106, -39, 36, 91,
+    -47, 58, -77, -2, 106, -119, -14, 85, -32, 115, 52, 80, -80, 94, -63, -35,
+    -87, -44, -104, 118, -38, -117, 48, 125, 28, -126, 0, 36, 70, -55, 90, -88,
+    -44, 59, -60, 12, -33, 98, 21, -74, 88, 29, -41, -106, -27, -93, 118, -75,
+    -4, 58, -96, 18, -38, 111, 1, -46, 106, -118, -53, 99, 0, 63, -20, -87,
+    20, 125, -22, -104, 52, -49, 41, -62, 6, -93, -66, -1, -104, 67, 6, 121,
+    23, 54, -13, 33, 70, 17, -10, -70, -48, 95, -95, -65, 103, -108, 50, 15,
+    -102, 85, -9, 127, -90, 38, -101, 110, -58, -91, 75, 111, 35, -56, 80, -37,
+    -106, 94, 35, -80, 73, -66, -111, 86, -77, 9, 54, -30, -75, -125, 109, 44,
+    -111, 74, -59, 94, 10, -83, 110, -111, 62, 92, 44, -46, 108, 32, -120, -21,
+    78, -116, 87, -77, -57, 101, -88, 88, 69, -12, 20, 60, -21, 6, -75, 99,
+    -19, 39, -124, -71, 67, -51, -13, 64, -29, 46, -3, -69, 62, 7, -127, 27,
+    109, -24, -49, 121, -17, 12, 47, -26, 28, 76, -102, 120, 19, 77, -61, 8,
+    -42, -7, -91, 30, 68, -26, 78, 23, -39, -12, -125, 21, -30, -73, 60, -56,
+    -90, 1, 110, -28, -110, 0, 35, -115, -28, -82, 112, -50, -117, 125, -35, 67,
+    -62, 113, -40, 29, 95, 7, 84, -121, 16, 120, -108, -21, -86, 108, -12, 55,
+    -66, 10, -119, 56, -104, 90, -92, 118, -58, -15, -83, 40, -49, -12, 53, -81,
+    100, 48, 116, -37, -126, -66, -3, -98, 125, -77, 102, 72, -92, 117, -11, 96,
+    -34, -65, 20, 43, 65, 121, -44, 58, 12, 42, -102, 77, 27, 46, -92, 21,
+    -109, 4, 57, -93, -29, -106, -63, 41, -81, -49, 81, 26, 92, -52, -99, 86,
+    -84, 40, 82, -5, -54, 34, -37, 64, -123, 99, 2, 83, -115, 113, -98, 85,
+    -22, -116, -70, 5, 108, 43, 91, -47, 38, 10, -56, -20, 47, 7, -109, 42,
+    125, 59, -102, -49, -84, -17, -100, 95, -61, 103, -40, -4, -80, -17, 83, -47,
+    103, -79, 79, -6, 118, 24, 104, -16, 91, 7, 56, -120, -33, 44, 17, -28,
+    117, -45, -95, 103, -81, 113, 5, -72, 22, 50, -36, -67, 25, -29, 11, -56,
+    37, 17, 81, 62, -105, -18, -82, 71, -112, 60, 87, -115, -64, 80, -45, 22,
+    -118, -9, 79, 108, 9, 74, 30, -78, 3, -127, 61, 117, -62, 97, -121, 63,
+    -14, 40, -56, -120, 48, -45, -89, 52, -36, -99, -64, -7, 119, -73, 70, -107,
+    -2, 61, -21, 20, 50, -26, -112, 87, -49, -95, 125, 70, -90, 103, 59, -107,
+    126, -44, -92, -27, -57, 21, 101, 4, -28, -87, -7, 115, 30, -95, 100, -76,
+    89, 15, -74, -24, -123, -58, 116, -37, 87, -22, 21, -98, 51, 12, -32, 32,
+    -90, 123, -32, 90, -78, 3, 73, -117, 126, 35, 101, 76, -90, 7, 105, -58,
+    29, -123, 79, -62, -105, 73, 32, -7, 107, -22, -110, -8, 44, -47, -4, -78,
+    68, -12, 95, 39, 120, 53, -100, -64, 118, 22, -50, 53, -32, -1, 62, -17,
+    -93, -46, 48, 98, 19, 52, -7, -106, 41, -86, 79, -46, -12, -103, 115, -70,
+    -1, -104, 11, 63, -22, 113, -59, 20, -4, -77, -23, -51, 40, -112, -38, 47,
+    91, -75, 124, 1, -39, 100, -57, -85, 43, 66, 15, -59, 94, -125, 80, 28,
+    -61, -120, 1, -75, -112, -43, -13, 82, 36, -122, 93, -75, -106, 109, -61, 41,
+    119, 70, -113, -34, -86, 89, -68, 65, 14, 122, -69, 34, 106, 67, -51, 84,
+    49, 98, -65, 27, -112, 39, -94, 79, -47, 60, -118, 22, 64, -16, 81, -91,
+    -10, -32, 25, -93, 53, 14, -122, 84, -35, -72, 115, 34, -83, -21, 118, -38,
+    49, 111, 72, 29, 89, 8, 67, -81, -38, 59, -18, 10, 71, 22, -126, -31,
+    28, -67, 2, 112, 33, -110, -16, 100, -52, -120, -30, 0, -113, -79, 21, -19,
+    -125, -40, 74, -89, 106, -39, -11, 95, -107, 111, 4, 90, -80, 122, -63, 15,
+    109, -109, 69, 106, -71, -21, 120, 25, -99, 4, -117, -43, 68, 21, -99, 9,
+    -88, -20, -104, -35, -62, 108, -119, 15, 111, -101, -60, 121, -91, -43, 80, -7,
+    95, -100, 44, -56, -9, 69, -41, -93, 3, 61, 96, 42, 85, -36, 58, -93,
+    37, 119, -10, -49, 5, 61, -71, 46, -31, 33, -62, -97, -33, -1, -120, 57,
+    -46, 41, -60, -6, -111, 63, -52, -13, 72, 102, 45, -15, 89, -69, 57, 101,
+    -51, 85, 20, 59, -91, -25, 48, -53, -6, 86, 26, 45, -4, 99, 53, -82,
+    13, -21, 105, 76, -77, 125, 27, 50, 109, -77, -14, -97, -63, 126, 5, 92,
+    -73, 15, -110, 48, 89, -122, 116, 11, -83, 71, -12, 105, 47, 75, 31, 95,
+    -95, 5, 87, -36, 32, 98, -84, 47, -66, -29, -90, 110, -109, 1, -27, -121,
+    39, -10, -78, 123, -2, 77, 23, -94, 66, -30, -73, -116, -26, -66, -108, -48,
+    85, -120, -40, -94, 16, -126, -61, -32, -111, 17, -46, 66, 25, -17, -116, -53,
+    63, -27, 107, -60, -80, 31, -20, -100, -49, 127, -125, 16, -54, -104, -39, -70,
+    -18, 116, -116, 58, -92, 4, 78, -107, 19, 85, -49, 12, 51, -55, 126, 66,
+    -64, 94, -114, 42, -46, -111, 113, -67, 102, -103, 55, 105, 76, 24, 126, 40,
+    -75, 67, 31, 54, -19, 95, 62, -8, 80, 38, 117, -123, 79, -82, 45, 110,
+    -6, -89, 26, 70, -2, -43, 74, 92, 23, 51, -27, -76, 88, -8, 119, 13,
+    77, -81, 20, -63, 107, -25, -43, 127, -5, -119, 38, -77, 74, -98, 28, -84,
+    16, -37, 6, 74, -71, 90, -13, -39, 39, 12, -17, -47, 2, -88, -36, -13,
+    110, 2, -58, 116, -72, 6, -103, 106, -90, -68, -25, 4, -57, 99, -37, 21,
+    -102, 83, -34, -105, 99, -116, 48, -68, -9, -109, 99, 62, 28, -85, 59, -123,
+    37, -30, 69, -11, 41, -125, 28, -70, 65, 99, -17, 117, -34, -4, 82, -20,
+    102, -96, 116, -22, 26, -92, 60, 3, -120, 90, -84, 118, -126, 45, 72, -110,
+};
+static const uint8_t TEST_FILM_GRAIN_RESPONSE[] = {
+    55, 70, 85, 95, 100, 100, 100, 95, 90, 80, 70, 60, 50, 40, 30, 20,
+};
+const GrainTile TEST_FILM_GRAIN_TILE = {64, 45, TEST_FILM_GRAIN_RESPONSE, TEST_FILM_GRAIN_NOISE};
+
+const GrainTileEntry GRAIN_TILES[GRAIN_TILE_COUNT] = {
+    {"mono_400", &MONO_400_GRAIN_TILE},
+    {"test_film", &TEST_FILM_GRAIN_TILE},
+};
+
+const GrainTile* findGrainTile(const char* name) {
+    for (int i = 0; name != NULL && i < GRAIN_TILE_COUNT; i++) {
+        if (strcmp(GRAIN_TILES[i].name, name) == 0) {
+            return GRAIN_TILES[i].tile;
+        }
+    }
+    return NULL;
+}
\ No newline at end of file
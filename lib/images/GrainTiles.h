@@ -0,0 +1,25 @@
+#ifndef GRAINTILES_H
+#define GRAINTILES_H
+
+#include "GrainTile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const GrainTile MONO_400_GRAIN_TILE;
+
+extern const GrainTile TEST_FILM_GRAIN_TILE;
+
+#define GRAIN_TILE_COUNT 2
+
+extern const GrainTileEntry GRAIN_TILES[GRAIN_TILE_COUNT];
+
+// Tile of a film by its name, NULL if the film has no grain file
+const GrainTile* findGrainTile(const char* name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // GRAINTILES_H
\ No newline at end of file
@@ -1,55 +0,0 @@
-#include "StaticImages.h"
-
-const unsigned char DASH_XBM_IMAGE[] = {
-
-0x00,0xf0,0x00,0xf0,0x00,0xf8,0x00,0x78,0x00,0x7c,0x00,0x3c,0x00,0x3e,0x00,
-0x1e,0x00,0x1f,0x00,0x0f,0x80,0x0f,0x80,0x07,0xc0,0x07,0xc0,0x03,0xe0,0x03,
-0xe0,0x01,0xf0,0x01,0xf0,0x00,0xf8,0x00,0x78,0x00,0x7c,0x00,0x3c,0x00,0x3e,
-0x00,0x1e,0x00,0x1f,0x00,0x0f,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00
-
-};
-const unsigned int DASH_XBM_WIDTH = 16;
-const unsigned int DASH_XBM_HEIGHT = 32;
-
-const unsigned char FLASH_SMALL_OFF_XBM_IMAGE[] = {
-
-0xc1,0x8f,0xc2,0x4f,0xe4,0x27,0xe8,0x13,0xf0,0x0b,0xe0,0x07,0xd0,0x1b,0xb8,
-0x1d,0x78,0x0f,0xc0,0x06,0xa0,0x05,0xd0,0x09,0xe8,0x10,0x74,0x20,0x32,0x40,
-0x31,0x80
-
-};
-const unsigned int FLASH_SMALL_OFF_XBM_WIDTH = 16;
-const unsigned int FLASH_SMALL_OFF_XBM_HEIGHT = 16;
-
-const unsigned char FLASH_SMALL_XBM_IMAGE[] = {
-
-0xc0,0x0f,0xc0,0x0f,0xe0,0x07,0xe0,0x03,0xe0,0x03,0xf0,0x01,0xf0,0x1f,0xf8,
-0x1f,0xf8,0x0f,0x80,0x07,0xc0,0x03,0xc0,0x01,0xe0,0x00,0x70,0x00,0x30,0x00,
-0x18,0x00
-
-};
-const unsigned int FLASH_SMALL_XBM_WIDTH = 16;
-const unsigned int FLASH_SMALL_XBM_HEIGHT = 16;
-
-const unsigned char BATTERY_XBM_IMAGE[] = {
-
-0xff,0xff,0x7f,0x00,0x01,0x00,0x40,0x00,0x01,0x00,0xc0,0x01,0x01,0x00,0xc0,
-0x01,0x01,0x00,0xc0,0x01,0x01,0x00,0xc0,0x01,0x01,0x00,0xc0,0x01,0x01,0x00,
-0xc0,0x01,0x01,0x00,0xc0,0x01,0x01,0x00,0xc0,0x01,0x01,0x00,0xc0,0x01,0x01,
-0x00,0x40,0x00,0xff,0xff,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00
-
-};
-const unsigned int BATTERY_XBM_WIDTH = 32;
-const unsigned int BATTERY_XBM_HEIGHT = 16;
-
-const unsigned char HAPPY_XBM_IMAGE[] = {
-
-0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xf7,0xff,0xff,0xff,0xff,0xff,
-0xff,0xfb,0xf7,0xdb,0xf7,0x1b,0xf8,0xf3,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-0xff,0xff
-
-};
-const unsigned int HAPPY_XBM_WIDTH = 16;
-const unsigned int HAPPY_XBM_HEIGHT = 16;
\ No newline at end of file
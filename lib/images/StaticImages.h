@@ -1,24 +0,0 @@
-#ifndef STATICIMAGES_H
-#define STATICIMAGES_H
-
-extern const unsigned char DASH_XBM_IMAGE[];
-extern const unsigned int DASH_XBM_WIDTH;
-extern const unsigned int DASH_XBM_HEIGHT;
-
-extern const unsigned char FLASH_SMALL_OFF_XBM_IMAGE[];
-extern const unsigned int FLASH_SMALL_OFF_XBM_WIDTH;
-extern const unsigned int FLASH_SMALL_OFF_XBM_HEIGHT;
-
-extern const unsigned char FLASH_SMALL_XBM_IMAGE[];
-extern const unsigned int FLASH_SMALL_XBM_WIDTH;
-extern const unsigned int FLASH_SMALL_XBM_HEIGHT;
-
-extern const unsigned char BATTERY_XBM_IMAGE[];
-extern const unsigned int BATTERY_XBM_WIDTH;
-extern const unsigned int BATTERY_XBM_HEIGHT;
-
-extern const unsigned char HAPPY_XBM_IMAGE[];
-extern const unsigned int HAPPY_XBM_WIDTH;
-extern const unsigned int HAPPY_XBM_HEIGHT;
-
-#endif  // STATICIMAGES_H
\ No newline at end of file
@@ -0,0 +1,22 @@
+#include "UiSprites.h"
+
+// 142 bytes of RLE pages, 224 bytes as XBM
+static const uint8_t UI_SPRITES_DATA[] = {
+    0x00, 0xff, 0x93, 0x01, 0x00, 0xff, 0x80, 0xfc, 0x85, 0x00, 0x00, 0x1f, 0x93, 0x10, 0x00, 0x1f,
+    0x80, 0x07, 0x85, 0x00, 0x87, 0x00, 0x06, 0xc0, 0xf0, 0xfc, 0xff, 0x7f, 0x1f, 0x07, 0x83, 0x00,
+    0x07, 0xc0, 0xf0, 0xfc, 0xff, 0x7f, 0x1f, 0x07, 0x01, 0x82, 0x00, 0x07, 0xc0, 0xf0, 0xfc, 0xff,
+    0x7f, 0x1f, 0x07, 0x01, 0x85, 0x00, 0x82, 0x07, 0x00, 0x01, 0x89, 0x00, 0x81, 0x00, 0x02, 0x80,
+    0xe0, 0xfc, 0x81, 0xff, 0x03, 0xdf, 0xc7, 0xc3, 0xc0, 0x84, 0x00, 0x08, 0x81, 0xe1, 0x71, 0x3d,
+    0x1f, 0x0f, 0x07, 0x03, 0x01, 0x82, 0x00, 0x06, 0x01, 0x02, 0x04, 0x88, 0xd0, 0xbc, 0x7f, 0x80,
+    0xff, 0x16, 0x7f, 0xa7, 0xd3, 0xc8, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x11, 0xe9, 0xf5, 0x3b,
+    0x1e, 0x0d, 0x03, 0x07, 0x09, 0x10, 0x20, 0x40, 0x80, 0x81, 0xff, 0x00, 0xef, 0x85, 0xff, 0x00,
+    0xef, 0x84, 0xff, 0x03, 0xf0, 0xf7, 0xff, 0xf9, 0x83, 0xfb, 0x00, 0xfc, 0x82, 0xff,
+};
+static const Sprite UI_SPRITES_SPRITES[] = {
+    {32, 16, 0}, // BATTERY
+    {16, 32, 20}, // DASH
+    {16, 16, 60}, // FLASH_SMALL
+    {16, 16, 87}, // FLASH_SMALL_OFF
+    {16, 16, 121}, // HAPPY
+};
+const SpriteAtlas UI_SPRITES = {UI_SPRITES_DATA, UI_SPRITES_SPRITES, 5};
\ No newline at end of file
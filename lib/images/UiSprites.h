@@ -0,0 +1,15 @@
+#ifndef UISPRITES_H
+#define UISPRITES_H
+
+#include "SpriteAtlas.h"
+
+#define SPRITE_BATTERY 0 // 32x16
+#define SPRITE_DASH 1 // 16x32
+#define SPRITE_FLASH_SMALL 2 // 16x16
+#define SPRITE_FLASH_SMALL_OFF 3 // 16x16
+#define SPRITE_HAPPY 4 // 16x16
+#define SPRITE_COUNT 5
+
+extern const SpriteAtlas UI_SPRITES;
+
+#endif  // UISPRITES_H
\ No newline at end of file
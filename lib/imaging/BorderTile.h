@@ -0,0 +1,25 @@
+#ifndef RETROLENS_BORDER_TILE_H
+#define RETROLENS_BORDER_TILE_H
+
+#include <stdint.h>
+
+/**
+ * @struct BorderTile
+ * @brief Border artwork as the DCT coefficients of its 4:2:2 MCUs, before quantization.
+ *
+ * Tiles are generated at build time by scripts/border_to_code.py, from the images in
+ * resources/images/borders, and kept in flash. Each MCU is two luma blocks, then one block of
+ * each chroma. Each block is the count of its AC coefficients that are not zero, its DC, then
+ * the natural-order index and the value of each of those AC coefficients. The values have the
+ * scale of jpegForwardDct(), any quantization table can be applied when the tile is placed.
+ *
+ * Plain C, the generated tiles are C sources.
+ */
+typedef struct BorderTile {
+    uint16_t width;              ///< Width in pixels, whole MCUs.
+    uint16_t height;             ///< Height in pixels, whole MCUs.
+    const uint32_t* mcus;        ///< Offset of each MCU in the coefficients, row by row.
+    const int16_t* coefficients; ///< Coded blocks of the MCUs.
+} BorderTile;
+
+#endif // RETROLENS_BORDER_TILE_H
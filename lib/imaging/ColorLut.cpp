@@ -0,0 +1,120 @@
+#include <string.h>
+
+#include "ColorLut.h"
+#include "JpegTables.h"
+
+ColorLut::ColorLut() : nodes(nullptr), size(0) {}
+
+bool ColorLut::load(const uint8_t* blob, size_t length, const char* name) {
+    clear();
+    ColorLutBlobHeader header;
+    if (blob == nullptr || length < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, blob, sizeof(header));
+    if (header.magic != COLOR_LUT_MAGIC || header.version != COLOR_LUT_VERSION ||
+        sizeof(header) + (size_t) header.count * sizeof(ColorLutBlobEntry) > length) {
+        return false;
+    }
+    for (int i = 0; i < header.count; i++) {
+        ColorLutBlobEntry entry;
+        memcpy(&entry, blob + sizeof(header) + i * sizeof(entry), sizeof(entry));
+        if (strncmp(entry.name, name, COLOR_LUT_NAME_BYTES) != 0) {
+            continue;
+        }
+        size_t count = (size_t) entry.size * entry.size * entry.size;
+        if (entry.size < COLOR_LUT_MIN_SIZE || entry.size > COLOR_LUT_MAX_SIZE || entry.offset % 4 != 0 ||
+            entry.offset > length || count * sizeof(uint32_t) > length - entry.offset ||
+            (uintptr_t) (blob + entry.offset) % 4 != 0) {
+            return false;
+        }
+        nodes = reinterpret_cast<const uint32_t*>(blob + entry.offset);
+        size = entry.size;
+
+        // Cell and fraction of each value, the last value at the far end of the last cell
+        int cells = size - 1;
+        for (int value = 0; value < 256; value++) {
+            int position = value * cells * 256 / 255;
+            int index = position >> 8;
+            int fraction = position & 255;
+            if (index == cells) {
+                index = cells - 1;
+                fraction = 256;
+            }
+            lumaOffsets[value] = (uint16_t) index;
+            blueOffsets[value] = (uint16_t) (index * size);
+            redOffsets[value] = (uint16_t) (index * size * size);
+            fractions[value] = (uint16_t) fraction;
+        }
+        return true;
+    }
+    return false;
+}
+
+void ColorLut::clear() {
+    nodes = nullptr;
+    size = 0;
+}
+
+bool ColorLut::isLoaded() const {
+    return nodes != nullptr;
+}
+
+int ColorLut::getSize() const {
+    return size;
+}
+
+// Weighted sum of 4 packed nodes, weights in 1/256 adding up to 256
+static inline void blendNodes(uint32_t a, int weightA, uint32_t b, int weightB, uint32_t c, int weightC, uint32_t d,
+                              int weightD, uint8_t* out) {
+    for (int component = 0; component < JPEG_YCC_BYTES; component++) {
+        int shift = component * COLOR_LUT_NODE_BITS;
+        int sum = (int) ((a >> shift) & COLOR_LUT_NODE_MASK) * weightA + (int) ((b >> shift) & COLOR_LUT_NODE_MASK) * weightB +
+                  (int) ((c >> shift) & COLOR_LUT_NODE_MASK) * weightC + (int) ((d >> shift) & COLOR_LUT_NODE_MASK) * weightD;
+        // Nodes in 1/4 and weights in 1/256, a node is at most 1020
+        out[component] = (uint8_t) ((sum + 512) >> 10);
+    }
+}
+
+void ColorLut::applyPixel(const uint8_t* in, uint8_t* out) const {
+    const int strideB = size;
+    const int strideR = size * size;
+    int fy = fractions[in[0]];
+    int fb = fractions[in[1]];
+    int fr = fractions[in[2]];
+    const uint32_t* cell = nodes + lumaOffsets[in[0]] + blueOffsets[in[1]] + redOffsets[in[2]];
+    uint32_t first = cell[0];
+    uint32_t last = cell[1 + strideB + strideR];
+
+    // The tetrahedron walks from the first to the last corner along the largest fractions first
+    if (fy >= fb) {
+        if (fb >= fr) {
+            blendNodes(first, 256 - fy, cell[1], fy - fb, cell[1 + strideB], fb - fr, last, fr, out);
+        } else if (fy >= fr) {
+            blendNodes(first, 256 - fy, cell[1], fy - fr, cell[1 + strideR], fr - fb, last, fb, out);
+        } else {
+            blendNodes(first, 256 - fr, cell[strideR], fr - fy, cell[1 + strideR], fy - fb, last, fb, out);
+        }
+    } else {
+        if (fr >= fb) {
+            blendNodes(first, 256 - fr, cell[strideR], fr - fb, cell[strideB + strideR], fb - fy, last, fy, out);
+        } else if (fr >= fy) {
+            blendNodes(first, 256 - fb, cell[strideB], fb - fr, cell[strideB + strideR], fr - fy, last, fy, out);
+        } else {
+            blendNodes(first, 256 - fb, cell[strideB], fb - fy, cell[1 + strideB], fy - fr, last, fr, out);
+        }
+    }
+}
+
+void ColorLut::applyStrip(uint8_t* ycc, size_t stride, int width, int rows) const {
+    if (nodes == nullptr) {
+        return;
+    }
+    for (int y = 0; y < rows; y++) {
+        uint8_t* pixel = ycc + (size_t) y * stride;
+        for (int x = 0; x < width; x++) {
+            applyPixel(pixel, pixel);
+            pixel += JPEG_YCC_BYTES;
+        }
+    }
+}
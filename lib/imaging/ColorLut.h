@@ -0,0 +1,123 @@
+#ifndef RETROLENS_COLOR_LUT_H
+#define RETROLENS_COLOR_LUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// LUT blob of scripts/cube_to_lut.py: "RLUT", little endian
+#define COLOR_LUT_MAGIC 0x54554C52
+#define COLOR_LUT_VERSION 1
+
+// Longest LUT name, the name of its film, with the terminating zero
+#define COLOR_LUT_NAME_BYTES 24
+
+// Grid sizes of the packed tables
+#define COLOR_LUT_MIN_SIZE 2
+#define COLOR_LUT_MAX_SIZE 33
+
+// Node values are in 1/4, 10 bits a component: Y, then Cb, then Cr from bit 20
+#define COLOR_LUT_NODE_BITS 10
+#define COLOR_LUT_NODE_MASK 0x3FF
+
+/**
+ * @struct ColorLutBlobHeader
+ * @brief Start of a LUT blob, followed by its entries.
+ */
+struct ColorLutBlobHeader {
+    uint32_t magic;   ///< COLOR_LUT_MAGIC.
+    uint16_t version; ///< COLOR_LUT_VERSION.
+    uint16_t count;   ///< Number of entries.
+};
+
+/**
+ * @struct ColorLutBlobEntry
+ * @brief One LUT of a blob.
+ */
+struct ColorLutBlobEntry {
+    char name[COLOR_LUT_NAME_BYTES]; ///< Film name, zero terminated.
+    uint16_t size;                   ///< Nodes along each axis.
+    uint16_t reserved;               ///< Zero.
+    uint32_t offset;                 ///< Offset of the nodes from the start of the blob, a multiple of 4.
+};
+
+/**
+ * @class ColorLut
+ * @brief 3D color lookup table on YCbCr pixels, read in place from a blob and applied with tetrahedral interpolation.
+ *
+ * The tables are made at build time from .cube files by scripts/cube_to_lut.py, resampled from
+ * RGB to a grid over Y, Cb and Cr so pixels never leave YCbCr. Each node is packed in 32 bits,
+ * Y fastest, then Cb, then Cr. The blob is only read, on the camera it stays in its flash
+ * partition behind the cache.
+ *
+ * A pixel falls in a cube of 8 nodes, split in 6 tetrahedra along its diagonal; the one the
+ * pixel is in is picked by ordering its 3 fractions, and 4 nodes are blended. The positions of
+ * the 256 values of a component on the grid are tabled once at load().
+ *
+ * Example usage:
+ * @code
+ * ColorLut lut;
+ * if (lut.load(blob, blobLength, "test_film")) {
+ *     lut.applyStrip(strip, width * JPEG_YCC_BYTES, width, rows);
+ * }
+ * @endcode
+ */
+class ColorLut {
+public:
+    /**
+     * @brief Constructor for ColorLut, empty.
+     */
+    ColorLut();
+
+    /**
+     * @brief Find a LUT in a blob by name, checking the blob.
+     *
+     * @param blob LUT blob, kept by the caller while the LUT is used.
+     * @param length Size of the blob.
+     * @param name Film name.
+     * @return true if the LUT was found, false if it was not or the blob is malformed.
+     */
+    bool load(const uint8_t* blob, size_t length, const char* name);
+
+    /**
+     * @brief Forget the LUT.
+     */
+    void clear();
+
+    /**
+     * @brief Check if a LUT is loaded.
+     */
+    bool isLoaded() const;
+
+    /**
+     * @brief Get the nodes along each axis, 0 when empty.
+     */
+    int getSize() const;
+
+    /**
+     * @brief Look up one pixel.
+     *
+     * @param in YCbCr input.
+     * @param out YCbCr output, may be the input.
+     */
+    void applyPixel(const uint8_t* in, uint8_t* out) const;
+
+    /**
+     * @brief Look up a strip in place.
+     *
+     * @param ycc Rows of interleaved YCbCr.
+     * @param stride Distance between rows, in bytes.
+     * @param width Pixels of a row.
+     * @param rows Number of rows.
+     */
+    void applyStrip(uint8_t* ycc, size_t stride, int width, int rows) const;
+
+private:
+    const uint32_t* nodes;      ///< Packed nodes, in the blob.
+    int size;                   ///< Nodes along each axis.
+    uint16_t lumaOffsets[256];  ///< Node offset of each Y value, the low corner of its cell.
+    uint16_t blueOffsets[256];  ///< Node offset of each Cb value.
+    uint16_t redOffsets[256];   ///< Node offset of each Cr value.
+    uint16_t fractions[256];    ///< Position of each value in its cell, in 1/256.
+};
+
+#endif // RETROLENS_COLOR_LUT_H
@@ -0,0 +1,339 @@
+#include <new>
+#include <string.h>
+
+#include "JpegDct.h"
+#include "DateStamp.h"
+
+// Blocks of the largest MCU, 4:2:0
+#define STAMP_MAX_MCU_BLOCKS 6
+
+// Slack of each arena allocation for its alignment
+#define STAMP_ALIGN_SLACK 8
+
+// Characters of the font and their glyphs, one row of 5 dots per byte, the leftmost dot in bit 4
+static const char STAMP_CHARACTERS[] = "0123456789'-./:";
+static const uint8_t STAMP_GLYPHS[][DATE_STAMP_GLYPH_HEIGHT] = {
+    {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}, // 0
+    {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}, // 1
+    {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}, // 2
+    {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E}, // 3
+    {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}, // 4
+    {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}, // 5
+    {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}, // 6
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}, // 7
+    {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}, // 8
+    {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C}, // 9
+    {0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00}, // '
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00}, // -
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C}, // .
+    {0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x10}, // /
+    {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00}, // :
+};
+
+static inline int16_t clampCoefficient(int32_t value) {
+    if (value > JPEG_COEFFICIENT_LIMIT - 1) {
+        return JPEG_COEFFICIENT_LIMIT - 1;
+    }
+    if (value < -JPEG_COEFFICIENT_LIMIT) {
+        return -JPEG_COEFFICIENT_LIMIT;
+    }
+    return (int16_t) value;
+}
+
+DateStamp::DateStamp(ImageArena* arena, const StampStyle& style)
+    : arena(arena), style(style), decoder(nullptr), encoder(nullptr), coefficients(nullptr), textLength(0), originX(0),
+      originY(0), dot(1), stampedBlocks(0), recodedMcus(0), copiedBytes(0) {
+    memset(glyphs, 0, sizeof(glyphs));
+}
+
+bool DateStamp::layout(int width, int height, const char* text) {
+    textLength = 0;
+    while (text[textLength] != '\0' && textLength < DATE_STAMP_MAX_CHARS) {
+        const char* character = strchr(STAMP_CHARACTERS, text[textLength]);
+        glyphs[textLength] = character != nullptr ? STAMP_GLYPHS[character - STAMP_CHARACTERS] : nullptr;
+        textLength++;
+    }
+    dot = style.scale > 0 ? style.scale : height / DATE_STAMP_HEIGHT_DIVISOR;
+    if (dot < 1) {
+        dot = 1;
+    }
+    // Right aligned, no spacing after the last character
+    int textWidth = (textLength * DATE_STAMP_ADVANCE - 1) * dot;
+    originX = width - style.margin * dot - textWidth;
+    originY = height - style.margin * dot - DATE_STAMP_GLYPH_HEIGHT * dot;
+    return textLength > 0 && originX >= 0 && originY >= 0;
+}
+
+bool DateStamp::isInk(int x, int y) const {
+    int cellX = x - originX;
+    int cellY = y - originY;
+    if (cellX < 0 || cellY < 0 || cellY >= DATE_STAMP_GLYPH_HEIGHT * dot) {
+        return false;
+    }
+    int cell = cellX / (DATE_STAMP_ADVANCE * dot);
+    if (cell >= textLength || glyphs[cell] == nullptr) {
+        return false;
+    }
+    int column = (cellX - cell * DATE_STAMP_ADVANCE * dot) / dot;
+    if (column >= DATE_STAMP_GLYPH_WIDTH) {
+        return false;
+    }
+    return (glyphs[cell][cellY / dot] >> (DATE_STAMP_GLYPH_WIDTH - 1 - column)) & 1;
+}
+
+bool DateStamp::meetsStamp(int x, int y, int width, int height) const {
+    int textWidth = (textLength * DATE_STAMP_ADVANCE - 1) * dot;
+    int textHeight = DATE_STAMP_GLYPH_HEIGHT * dot;
+    return x < originX + textWidth && x + width > originX && y < originY + textHeight && y + height > originY;
+}
+
+bool DateStamp::drawText(uint8_t* ycc, size_t stride, int width, int height, const char* text, const StampStyle& style) {
+    DateStamp stamp(nullptr, style);
+    if (!stamp.layout(width, height, text)) {
+        return false;
+    }
+    int textWidth = (stamp.textLength * DATE_STAMP_ADVANCE - 1) * stamp.dot;
+    for (int y = stamp.originY; y < stamp.originY + DATE_STAMP_GLYPH_HEIGHT * stamp.dot; y++) {
+        uint8_t* pixel = ycc + (size_t) y * stride + (size_t) stamp.originX * JPEG_YCC_BYTES;
+        for (int x = stamp.originX; x < stamp.originX + textWidth; x++) {
+            if (stamp.isInk(x, y)) {
+                pixel[0] = style.luma;
+                pixel[1] = style.blue;
+                pixel[2] = style.red;
+            }
+            pixel += JPEG_YCC_BYTES;
+        }
+    }
+    return true;
+}
+
+int DateStamp::write(const uint8_t* data, size_t length, const char* text, JpegWriter writer, void* context) {
+    stampedBlocks = 0;
+    recodedMcus = 0;
+    copiedBytes = 0;
+    size_t mark = arena->getMark();
+    void* decoderStorage = arena->alloc(sizeof(JpegDecoder), alignof(JpegDecoder));
+    void* encoderStorage = arena->alloc(sizeof(JpegEncoder), alignof(JpegEncoder));
+    coefficients = static_cast<int16_t*>(arena->alloc(STAMP_MAX_MCU_BLOCKS * JPEG_BLOCK_SIZE * sizeof(int16_t)));
+    if (decoderStorage == nullptr || encoderStorage == nullptr || coefficients == nullptr) {
+        arena->release(mark);
+        return JPEG_ERROR_MEMORY;
+    }
+
+    // Only coefficients are read, the decoder needs no strip planes
+    decoder = new (decoderStorage) JpegDecoder();
+    int result = decoder->begin(data, length, nullptr);
+    if (result == JPEG_OK && !layout(decoder->getWidth(), decoder->getHeight(), text)) {
+        result = JPEG_ERROR_UNSUPPORTED;
+    }
+    int chroma = decoder->getComponentCount() > 1 ? 1 : 0;
+    if (result == JPEG_OK && chroma > 0 &&
+        (decoder->getQuantTable(1) != decoder->getQuantTable(2) ||
+         decoder->getHuffmanSpec(1, false).values != decoder->getHuffmanSpec(2, false).values ||
+         decoder->getHuffmanSpec(1, true).values != decoder->getHuffmanSpec(2, true).values)) {
+        // The encoder codes both chromas with one set of tables
+        result = JPEG_ERROR_UNSUPPORTED;
+    }
+    if (result == JPEG_OK) {
+        encoder = new (encoderStorage) JpegEncoder();
+        encoder->beginSplice(decoder->getQuantTable(0), decoder->getQuantTable(chroma), decoder->getHuffmanSpec(0, false),
+                             decoder->getHuffmanSpec(0, true), decoder->getHuffmanSpec(chroma, false),
+                             decoder->getHuffmanSpec(chroma, true), writer, context);
+        result = splice(data, length);
+    }
+    arena->release(mark);
+    return result;
+}
+
+int DateStamp::splice(const uint8_t* data, size_t length) {
+    int mcusPerStrip = decoder->getMcusPerStrip();
+    int mcuWidth = decoder->getMcuWidth();
+    int mcuHeight = decoder->getStripHeight();
+    int totalMcus = mcusPerStrip * decoder->getStripCount();
+    int lumaBlocks = decoder->getBlocksPerMcu() - (decoder->getComponentCount() - 1);
+    uint16_t interval = decoder->getRestartInterval();
+
+    if (interval == 0) {
+        // Read up to the first MCU under the stamp, keeping the last DC of each component
+        int first = (originY / mcuHeight) * mcusPerStrip + originX / mcuWidth;
+        int16_t lastDc[JPEG_MAX_COMPONENTS] = {0, 0, 0};
+        for (int mcu = 0; mcu < first; mcu++) {
+            if (decoder->decodeMcu(coefficients) != JPEG_OK) {
+                return JPEG_ERROR_DATA;
+            }
+            lastDc[0] = coefficients[(lumaBlocks - 1) * JPEG_BLOCK_SIZE];
+            for (int i = 1; i < decoder->getComponentCount(); i++) {
+                lastDc[i] = coefficients[(lumaBlocks + i - 1) * JPEG_BLOCK_SIZE];
+            }
+        }
+
+        // Copy the file up to that bit, then code the tail again
+        int bit;
+        size_t offset = decoder->getScanPosition(&bit);
+        encoder->copyBytes(data, offset);
+        copiedBytes = offset;
+        if (bit > 0) {
+            encoder->copyBits(data[offset] >> (8 - bit), bit);
+        }
+        for (int i = 0; i < decoder->getComponentCount(); i++) {
+            encoder->setDcPredictor(i, lastDc[i]);
+        }
+        int result = recode(first, totalMcus);
+        return result == JPEG_OK ? encoder->finish() : result;
+    }
+
+    // The end of image closes the copy, whatever follows it in the buffer
+    size_t end = length >= 2 ? length - 2 : 0;
+    while (end > decoder->getScanStart() && !(data[end] == 0xFF && data[end + 1] == 0xD9)) {
+        end--;
+    }
+    if (end <= decoder->getScanStart()) {
+        return JPEG_ERROR_FORMAT;
+    }
+
+    // Intervals clear of the stamp are copied with their marker, the others coded again
+    int firstRow = originY / mcuHeight;
+    int lastRow = (originY + DATE_STAMP_GLYPH_HEIGHT * dot - 1) / mcuHeight;
+    int firstColumn = originX / mcuWidth;
+    int lastColumn = (originX + (textLength * DATE_STAMP_ADVANCE - 1) * dot - 1) / mcuWidth;
+    int intervals = (totalMcus + interval - 1) / interval;
+    int decoderInterval = 0;
+    size_t copyFrom = 0;
+    for (int index = 0; index < intervals; index++) {
+        int first = index * interval;
+        int last = first + interval < totalMcus ? first + interval : totalMcus;
+        bool stamped = false;
+        for (int mcu = first; mcu < last && !stamped; mcu++) {
+            int row = mcu / mcusPerStrip;
+            int column = mcu % mcusPerStrip;
+            stamped = row >= firstRow && row <= lastRow && column >= firstColumn && column <= lastColumn;
+        }
+        if (!stamped) {
+            continue;
+        }
+
+        if (decoder->skipRestartIntervals(index - decoderInterval) != JPEG_OK) {
+            return JPEG_ERROR_DATA;
+        }
+        int bit;
+        size_t start = decoder->getScanPosition(&bit);
+        encoder->copyBytes(data + copyFrom, start - copyFrom);
+        copiedBytes += start - copyFrom;
+        for (int i = 0; i < decoder->getComponentCount(); i++) {
+            encoder->setDcPredictor(i, 0);
+        }
+        int result = recode(first, last);
+        if (result != JPEG_OK) {
+            return result;
+        }
+        if (index + 1 == intervals) {
+            copyFrom = end;
+            break;
+        }
+        encoder->writeRestart(index);
+        if (decoder->skipRestartIntervals(0) != JPEG_OK) {
+            return JPEG_ERROR_DATA;
+        }
+        copyFrom = decoder->getScanPosition(&bit);
+        decoderInterval = index + 1;
+    }
+    encoder->copyBytes(data + copyFrom, end - copyFrom);
+    copiedBytes += end - copyFrom;
+    return encoder->finish();
+}
+
+int DateStamp::recode(int first, int end) {
+    int mcusPerStrip = decoder->getMcusPerStrip();
+    int mcuWidth = decoder->getMcuWidth();
+    int mcuHeight = decoder->getStripHeight();
+    int blocksX = mcuWidth / 8;
+    int blocksY = mcuHeight / 8;
+    for (int mcu = first; mcu < end; mcu++) {
+        if (decoder->decodeMcu(coefficients) != JPEG_OK) {
+            return JPEG_ERROR_DATA;
+        }
+        int x = (mcu % mcusPerStrip) * mcuWidth;
+        int y = (mcu / mcusPerStrip) * mcuHeight;
+        bool stamped = meetsStamp(x, y, mcuWidth, mcuHeight);
+        const int16_t* block = coefficients;
+        for (int by = 0; by < blocksY; by++) {
+            for (int bx = 0; bx < blocksX; bx++) {
+                if (stamped && meetsStamp(x + bx * 8, y + by * 8, 8, 8)) {
+                    stampBlock(block, 0, x + bx * 8, y + by * 8, 1, 1);
+                } else {
+                    encoder->encodeCoefficients(block, 0);
+                }
+                block += JPEG_BLOCK_SIZE;
+            }
+        }
+        // Chroma covers the whole MCU
+        for (int i = 1; i < decoder->getComponentCount(); i++) {
+            if (stamped) {
+                stampBlock(block, i, x, y, blocksX, blocksY);
+            } else {
+                encoder->encodeCoefficients(block, i);
+            }
+            block += JPEG_BLOCK_SIZE;
+        }
+        recodedMcus++;
+    }
+    return JPEG_OK;
+}
+
+void DateStamp::stampBlock(const int16_t* coefficients, int component, int x, int y, int stepX, int stepY) {
+    // Ink dots under each sample
+    uint8_t cover[JPEG_BLOCK_SIZE];
+    bool inked = false;
+    for (int row = 0; row < 8; row++) {
+        for (int column = 0; column < 8; column++) {
+            int count = 0;
+            for (int dy = 0; dy < stepY; dy++) {
+                for (int dx = 0; dx < stepX; dx++) {
+                    count += isInk(x + column * stepX + dx, y + row * stepY + dy) ? 1 : 0;
+                }
+            }
+            cover[row * 8 + column] = (uint8_t) count;
+            inked = inked || count > 0;
+        }
+    }
+    if (!inked) {
+        encoder->encodeCoefficients(coefficients, component);
+        return;
+    }
+
+    int16_t block[JPEG_BLOCK_SIZE];
+    const uint8_t* quant = decoder->getQuantTable(component);
+    for (int i = 0; i < JPEG_BLOCK_SIZE; i++) {
+        block[i] = clampCoefficient(coefficients[i] * quant[i]);
+    }
+    uint8_t samples[JPEG_BLOCK_SIZE];
+    jpegInverseDct(block, samples, 8);
+
+    // A subsampled chroma gets the share of its pixels under the ink, as the encoder averages them
+    uint32_t ink = component == 0 ? style.luma : (component == 1 ? style.blue : style.red);
+    uint32_t count = stepX * stepY;
+    for (int i = 0; i < JPEG_BLOCK_SIZE; i++) {
+        if (cover[i] > 0) {
+            samples[i] = (uint8_t) ((samples[i] * (count - cover[i]) + ink * cover[i] + count / 2) / count);
+        }
+    }
+    encoder->encodeBlock(samples, 8, component);
+    stampedBlocks++;
+}
+
+int DateStamp::getStampedBlocks() const {
+    return stampedBlocks;
+}
+
+int DateStamp::getRecodedMcus() const {
+    return recodedMcus;
+}
+
+size_t DateStamp::getCopiedBytes() const {
+    return copiedBytes;
+}
+
+size_t DateStamp::requiredBytes() {
+    return sizeof(JpegDecoder) + sizeof(JpegEncoder) + STAMP_MAX_MCU_BLOCKS * JPEG_BLOCK_SIZE * sizeof(int16_t) +
+           3 * STAMP_ALIGN_SLACK;
+}
@@ -0,0 +1,173 @@
+#ifndef RETROLENS_DATE_STAMP_H
+#define RETROLENS_DATE_STAMP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ImageArena.h"
+#include "JpegDecoder.h"
+#include "JpegEncoder.h"
+
+// Longest stamp text
+#define DATE_STAMP_MAX_CHARS 24
+
+// Dot matrix font, each character is drawn in a cell one dot wider than its glyph
+#define DATE_STAMP_GLYPH_WIDTH 5
+#define DATE_STAMP_GLYPH_HEIGHT 7
+#define DATE_STAMP_ADVANCE 6
+
+// The automatic dot size is the frame height over this, 6 px at 1920 rows
+#define DATE_STAMP_HEIGHT_DIVISOR 320
+
+/**
+ * @struct StampStyle
+ * @brief Look and place of the date stamp.
+ */
+struct StampStyle {
+    uint8_t luma = 158;  ///< Luma of the ink, the orange of a film date back.
+    uint8_t blue = 39;   ///< Blue difference of the ink.
+    uint8_t red = 197;   ///< Red difference of the ink.
+    int scale = 0;       ///< Pixels per font dot, 0 to follow the frame height.
+    int margin = 8;      ///< Distance to the bottom and right edges, in dots.
+};
+
+/**
+ * @class DateStamp
+ * @brief Burns a date stamp into the bottom-right corner of a JPEG, re-encoding only the blocks under it.
+ *
+ * The scan is read as quantized coefficients. Blocks under the glyphs go through the inverse
+ * DCT, get the ink and are coded again with the tables of the source, every other block keeps
+ * its coefficients. The entropy-coded data is spliced around the stamp:
+ *
+ * - With restart markers, the intervals clear of the stamp are copied byte for byte without
+ *   being decoded, only the intervals under it are coded again.
+ * - Without, the scan is copied up to the bit where the first MCU under the stamp starts and
+ *   the tail is coded again from its coefficients, as the DC predictions and the bit
+ *   alignment change past the stamp. The tail is the last rows of the frame.
+ *
+ * Memory is a coefficient decoder and an encoder from the ImageArena, whatever the frame size.
+ *
+ * Example usage:
+ * @code
+ * DateStamp stamp(&arena);
+ * stamp.write(fb->buf, fb->len, "'24 10 19", writeToFile, &file);
+ * @endcode
+ */
+class DateStamp {
+public:
+    /**
+     * @brief Constructor for DateStamp.
+     *
+     * @param arena Memory budget of the splice, used from its current mark.
+     * @param style Look and place of the stamp.
+     */
+    DateStamp(ImageArena* arena, const StampStyle& style = StampStyle());
+
+    /**
+     * @brief Write a copy of a JPEG with the stamp burnt in.
+     *
+     * @param data JPEG file.
+     * @param length Size of the file.
+     * @param text Stamp text, digits and ' - . / : or spaces, other characters are left blank.
+     * @param writer Output sink.
+     * @param context Context of the writer.
+     * @return int JPEG_OK or a JPEG_ERROR_* code, JPEG_ERROR_UNSUPPORTED if the stamp does not fit.
+     */
+    int write(const uint8_t* data, size_t length, const char* text, JpegWriter writer, void* context);
+
+    /**
+     * @brief Draw the stamp on interleaved YCbCr pixels, at full chroma resolution.
+     *
+     * @param ycc Top-left pixel of the frame.
+     * @param stride Distance between rows, in bytes.
+     * @param width Frame width.
+     * @param height Frame height.
+     * @param text Stamp text.
+     * @param style Look and place of the stamp.
+     * @return true if the stamp fits in the frame.
+     */
+    static bool drawText(uint8_t* ycc, size_t stride, int width, int height, const char* text,
+                         const StampStyle& style = StampStyle());
+
+    /**
+     * @brief Get the blocks that went through the pixels in the last write().
+     */
+    int getStampedBlocks() const;
+
+    /**
+     * @brief Get the MCUs coded again in the last write(), stamped or not.
+     */
+    int getRecodedMcus() const;
+
+    /**
+     * @brief Get the bytes of the source copied as they were in the last write().
+     */
+    size_t getCopiedBytes() const;
+
+    /**
+     * @brief Get the memory a stamp needs from its arena, whatever the frame size.
+     *
+     * @return size_t Upper bound in bytes.
+     */
+    static size_t requiredBytes();
+
+private:
+    /**
+     * @brief Place the text in a frame.
+     *
+     * @return true if the stamp fits.
+     */
+    bool layout(int width, int height, const char* text);
+
+    /**
+     * @brief Check if a pixel of the frame is under the ink.
+     */
+    bool isInk(int x, int y) const;
+
+    /**
+     * @brief Check if a rectangle of the frame meets the stamp.
+     */
+    bool meetsStamp(int x, int y, int width, int height) const;
+
+    /**
+     * @brief Splice the scan once the decoder and the encoder are ready.
+     */
+    int splice(const uint8_t* data, size_t length);
+
+    /**
+     * @brief Decode MCUs and code them again, stamping the blocks under the ink.
+     *
+     * @param first Index of the first MCU.
+     * @param end Index past the last MCU.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int recode(int first, int end);
+
+    /**
+     * @brief Stamp one block and code it again.
+     *
+     * @param coefficients Quantized coefficients of the block.
+     * @param component 0 for luma, 1 or 2 for chroma.
+     * @param x Left pixel covered by the block.
+     * @param y Top pixel covered by the block.
+     * @param stepX Pixels per sample across.
+     * @param stepY Pixels per sample down.
+     */
+    void stampBlock(const int16_t* coefficients, int component, int x, int y, int stepX, int stepY);
+
+    ImageArena* arena;                                   ///< Memory budget.
+    StampStyle style;                                    ///< Look and place of the stamp.
+    JpegDecoder* decoder;                                ///< Coefficient reader of the source.
+    JpegEncoder* encoder;                                ///< Splice output.
+    int16_t* coefficients;                               ///< Blocks of the current MCU.
+    const uint8_t* glyphs[DATE_STAMP_MAX_CHARS];         ///< Glyph of each character, nullptr if blank.
+    int textLength;                                      ///< Number of characters.
+    int originX;                                         ///< Left pixel of the text.
+    int originY;                                         ///< Top pixel of the text.
+    int dot;                                             ///< Pixels per font dot.
+    int stampedBlocks;                                   ///< Blocks that went through the pixels.
+    int recodedMcus;                                     ///< MCUs coded again.
+    size_t copiedBytes;                                  ///< Bytes of the source copied as they were.
+};
+
+#endif // RETROLENS_DATE_STAMP_H
@@ -0,0 +1,147 @@
+#include <new>
+#include <string.h>
+
+#include "DoubleExposure.h"
+
+// Slack of each arena allocation for its alignment
+#define BLEND_ALIGN_SLACK 8
+
+DoubleExposure::DoubleExposure(ImageArena* arena, const BlendConfig& config) : arena(arena), config(config), rowBytes(0) {
+    for (int i = 0; i < 2; i++) {
+        decoders[i] = nullptr;
+        strips[i] = nullptr;
+    }
+    for (int lane = 0; lane < STRIP_LANES; lane++) {
+        laneResults[lane] = JPEG_OK;
+    }
+}
+
+void DoubleExposure::blendPixels(const uint8_t* first, const uint8_t* second, uint8_t* out, size_t pixels,
+                                 const BlendConfig& config) {
+    for (size_t i = 0; i < pixels; i++) {
+        uint32_t lumaA = (first[0] * (uint32_t) config.firstWeight + 128) >> 8;
+        uint32_t lumaB = (second[0] * (uint32_t) config.secondWeight + 128) >> 8;
+        lumaA = lumaA > 255 ? 255 : lumaA;
+        lumaB = lumaB > 255 ? 255 : lumaB;
+
+        uint32_t luma;
+        if (config.mode == BLEND_MODE_ADD) {
+            luma = lumaA + lumaB;
+            luma = luma > 255 ? 255 : luma;
+        } else {
+            // a + b - a * b / 255, the product scaled by 257 / 65536
+            luma = lumaA + lumaB - ((lumaA * lumaB * 257 + 32768) >> 16);
+        }
+
+        // Chroma weighted by the light of each exposure
+        uint32_t total = lumaA + lumaB;
+        int32_t blueA = first[1] - 128;
+        int32_t redA = first[2] - 128;
+        int32_t blueB = second[1] - 128;
+        int32_t redB = second[2] - 128;
+        int32_t blue;
+        int32_t red;
+        if (total == 0) {
+            blue = (blueA + blueB) / 2;
+            red = (redA + redB) / 2;
+        } else {
+            int32_t reciprocal = (int32_t) (65536 / total);
+            blue = ((blueA * (int32_t) lumaA + blueB * (int32_t) lumaB) * reciprocal + 32768) >> 16;
+            red = ((redA * (int32_t) lumaA + redB * (int32_t) lumaB) * reciprocal + 32768) >> 16;
+        }
+
+        out[0] = (uint8_t) luma;
+        out[1] = (uint8_t) (blue + 128 < 0 ? 0 : (blue + 128 > 255 ? 255 : blue + 128));
+        out[2] = (uint8_t) (red + 128 < 0 ? 0 : (red + 128 > 255 ? 255 : red + 128));
+        first += JPEG_YCC_BYTES;
+        second += JPEG_YCC_BYTES;
+        out += JPEG_YCC_BYTES;
+    }
+}
+
+void DoubleExposure::decodeLane(void* arg, int lane) {
+    DoubleExposure* blend = static_cast<DoubleExposure*>(arg);
+    // One exposure per lane
+    if (lane < 2) {
+        blend->laneResults[lane] = blend->decoders[lane]->decodeStrip(blend->strips[lane], blend->rowBytes);
+    }
+}
+
+int DoubleExposure::write(const uint8_t* first, size_t firstLength, const uint8_t* second, size_t secondLength,
+                          JpegWriter writer, void* context, StripRunner* runner) {
+    SerialStripRunner serialRunner;
+    if (runner == nullptr) {
+        runner = &serialRunner;
+    }
+    size_t mark = arena->getMark();
+    const uint8_t* files[2] = {first, second};
+    size_t lengths[2] = {firstLength, secondLength};
+    int result = JPEG_OK;
+    for (int i = 0; i < 2 && result == JPEG_OK; i++) {
+        void* storage = arena->alloc(sizeof(JpegDecoder), alignof(JpegDecoder));
+        if (storage == nullptr) {
+            result = JPEG_ERROR_MEMORY;
+            break;
+        }
+        decoders[i] = new (storage) JpegDecoder();
+        result = decoders[i]->begin(files[i], lengths[i], arena);
+    }
+    if (result == JPEG_OK &&
+        (decoders[0]->getComponentCount() != JPEG_MAX_COMPONENTS || decoders[1]->getComponentCount() != JPEG_MAX_COMPONENTS ||
+         decoders[0]->getWidth() != decoders[1]->getWidth() || decoders[0]->getHeight() != decoders[1]->getHeight() ||
+         decoders[0]->getSubsampling() != decoders[1]->getSubsampling())) {
+        result = JPEG_ERROR_UNSUPPORTED;
+    }
+    if (result != JPEG_OK) {
+        arena->release(mark);
+        return result;
+    }
+
+    int width = decoders[1]->getWidth();
+    int height = decoders[1]->getHeight();
+    int stripHeight = decoders[1]->getStripHeight();
+    rowBytes = (size_t) width * JPEG_YCC_BYTES;
+    strips[0] = static_cast<uint8_t*>(arena->alloc(rowBytes * stripHeight));
+    strips[1] = static_cast<uint8_t*>(arena->alloc(rowBytes * stripHeight));
+    void* storage = arena->alloc(sizeof(JpegEncoder), alignof(JpegEncoder));
+    if (strips[0] == nullptr || strips[1] == nullptr || storage == nullptr) {
+        arena->release(mark);
+        return JPEG_ERROR_MEMORY;
+    }
+
+    // Encoded with the tables of the second exposure, the current quality of the rate control
+    JpegEncoder* encoder = new (storage) JpegEncoder();
+    result = encoder->begin(width, height, decoders[1]->getSubsampling(), decoders[1]->getQuantTable(0),
+                            decoders[1]->getQuantTable(1), writer, context, decoders[1]->getRestartInterval());
+    for (int row = 0; result == JPEG_OK && row < height; row += stripHeight) {
+        int rows = height - row < stripHeight ? height - row : stripHeight;
+        runner->run(decodeLane, this);
+        for (int lane = 0; lane < 2 && result == JPEG_OK; lane++) {
+            result = laneResults[lane];
+        }
+        if (result != JPEG_OK) {
+            break;
+        }
+        blendPixels(strips[0], strips[1], strips[0], (size_t) width * rows, config);
+        result = encoder->encodeStrip(strips[0], rowBytes);
+    }
+    if (result == JPEG_OK) {
+        result = encoder->finish();
+    }
+    arena->release(mark);
+    return result;
+}
+
+size_t DoubleExposure::requiredBytes(int width, int subsampling) {
+    int horizontal;
+    int vertical;
+    jpegSamplingFactors(subsampling, &horizontal, &vertical);
+    size_t mcusPerRow = (width + horizontal * 8 - 1) / (horizontal * 8);
+    size_t stripHeight = vertical * 8;
+    size_t rowBytes = (size_t) width * JPEG_YCC_BYTES;
+
+    // Two decoders with the planes of one MCU row and their strips, then the encoder
+    size_t planes = mcusPerRow * horizontal * 8 * vertical * 8 + 2 * mcusPerRow * 64;
+    size_t decoderBytes = sizeof(JpegDecoder) + planes + rowBytes * stripHeight + 5 * BLEND_ALIGN_SLACK;
+    return 2 * decoderBytes + sizeof(JpegEncoder) + BLEND_ALIGN_SLACK;
+}
@@ -0,0 +1,111 @@
+#ifndef RETROLENS_DOUBLE_EXPOSURE_H
+#define RETROLENS_DOUBLE_EXPOSURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ImageArena.h"
+#include "JpegDecoder.h"
+#include "JpegEncoder.h"
+#include "StripRunner.h"
+
+// Blend modes
+#define BLEND_MODE_ADD 0    // Light adds up and clips, like two exposures on one frame of film
+#define BLEND_MODE_SCREEN 1 // Inverse of the product of the inverses, brightens without clipping
+#define BLEND_MODE_COUNT 2
+
+// Exposure weight of a frame at full strength, in 1/256
+#define BLEND_WEIGHT_ONE 256
+
+/**
+ * @struct BlendConfig
+ * @brief How the two exposures are combined.
+ */
+struct BlendConfig {
+    int mode = BLEND_MODE_SCREEN;              ///< One of the BLEND_MODE_* values.
+    uint16_t firstWeight = BLEND_WEIGHT_ONE;   ///< Weight of the first exposure, in 1/256.
+    uint16_t secondWeight = BLEND_WEIGHT_ONE;  ///< Weight of the second exposure, in 1/256.
+};
+
+/**
+ * @class DoubleExposure
+ * @brief Blends two JPEG exposures into one JPEG, strip by strip, without decoding either frame whole.
+ *
+ * Both exposures stay compressed. Each output strip decodes the matching strip of both frames,
+ * one per lane of a StripRunner, blends them in place and encodes the result once with the
+ * quantization tables of the second exposure. Memory is two strip decoders, two strips and an
+ * encoder taken from the ImageArena, a small fraction of one decoded frame.
+ *
+ * Luma is blended with the weighted lumas of the frames. Chroma is the mean of both chromas
+ * weighted by the luma each frame brings, so a dark part of one exposure does not wash out
+ * the colors of the other.
+ *
+ * Example usage:
+ * @code
+ * DoubleExposure blend(&arena);
+ * blend.write(firstJpeg, firstLength, fb->buf, fb->len, writeToFile, &file, &runner);
+ * @endcode
+ */
+class DoubleExposure {
+public:
+    /**
+     * @brief Constructor for DoubleExposure.
+     *
+     * @param arena Memory budget of the blend, used from its current mark.
+     * @param config Blend mode and weights.
+     */
+    DoubleExposure(ImageArena* arena, const BlendConfig& config = BlendConfig());
+
+    /**
+     * @brief Blend two exposures and write the result.
+     *
+     * @param first First exposure, a JPEG file.
+     * @param firstLength Size of the first exposure.
+     * @param second Second exposure, same size and sampling as the first.
+     * @param secondLength Size of the second exposure.
+     * @param writer Output sink.
+     * @param context Context of the writer.
+     * @param runner Runner of the decoding lanes, nullptr to decode serially.
+     * @return int JPEG_OK or a JPEG_ERROR_* code, JPEG_ERROR_UNSUPPORTED if the frames differ in size or sampling.
+     */
+    int write(const uint8_t* first, size_t firstLength, const uint8_t* second, size_t secondLength, JpegWriter writer,
+              void* context, StripRunner* runner = nullptr);
+
+    /**
+     * @brief Blend interleaved YCbCr pixels.
+     *
+     * @param first Pixels of the first exposure.
+     * @param second Pixels of the second exposure.
+     * @param out Blended pixels, may be first or second.
+     * @param pixels Number of pixels.
+     * @param config Blend mode and weights.
+     */
+    static void blendPixels(const uint8_t* first, const uint8_t* second, uint8_t* out, size_t pixels, const BlendConfig& config);
+
+    /**
+     * @brief Get the memory a blend needs from its arena, whatever the frame height.
+     *
+     * @param width Frame width.
+     * @param subsampling One of the JPEG_SUBSAMPLING_* values.
+     * @return size_t Upper bound in bytes.
+     */
+    static size_t requiredBytes(int width, int subsampling);
+
+private:
+    /**
+     * @brief Lane work: decode the next strip of one exposure.
+     *
+     * @param arg Pointer to the DoubleExposure.
+     * @param lane Lane index, also the exposure index.
+     */
+    static void decodeLane(void* arg, int lane);
+
+    ImageArena* arena;              ///< Memory budget.
+    BlendConfig config;             ///< Blend mode and weights.
+    JpegDecoder* decoders[2];       ///< Decoders of the first and the second exposure.
+    uint8_t* strips[2];             ///< Current strip of each exposure.
+    size_t rowBytes;                ///< Bytes of an interleaved YCbCr row.
+    int laneResults[STRIP_LANES];   ///< Result of the last lane run.
+};
+
+#endif // RETROLENS_DOUBLE_EXPOSURE_H
@@ -0,0 +1,334 @@
+#include <ctype.h>
+#include <new>
+#include <string.h>
+
+#include "FilmBorder.h"
+
+// Blocks of a 4:2:2 MCU, the sampling of the tiles
+#define BORDER_MCU_BLOCKS 4
+#define BORDER_MCU_WIDTH 16
+#define BORDER_MCU_HEIGHT 8
+
+// Slack of each arena allocation for its alignment
+#define BORDER_ALIGN_SLACK 8
+
+// Largest height a frame header holds
+#define BORDER_MAX_HEIGHT 0xFFFF
+
+static inline int16_t quantize(int32_t value, int32_t divisor) {
+    // Rounded as the encoder does
+    return (int16_t) (value < 0 ? -((-value + divisor / 2) / divisor) : (value + divisor / 2) / divisor);
+}
+
+FilmBorder::FilmBorder(ImageArena* arena, const BorderArt& art)
+    : arena(arena), art(art), decoder(nullptr), encoder(nullptr), blocks(nullptr), filmName(""), frameLabel(""),
+      filmNameLength(0), frameLabelLength(0), columns(0), sourceMcus(0), interval(0), codedMcus(0), borderMcus(0),
+      recodedMcus(0), copiedBytes(0) {
+}
+
+int FilmBorder::write(const uint8_t* data, size_t length, const char* filmName, const char* frameLabel, JpegWriter writer,
+                      void* context) {
+    borderMcus = 0;
+    recodedMcus = 0;
+    copiedBytes = 0;
+    codedMcus = 0;
+    this->filmName = filmName;
+    this->frameLabel = frameLabel;
+    filmNameLength = (int) strnlen(filmName, FILM_BORDER_MAX_CHARS);
+    frameLabelLength = (int) strnlen(frameLabel, FILM_BORDER_MAX_CHARS);
+
+    size_t mark = arena->getMark();
+    void* decoderStorage = arena->alloc(sizeof(JpegDecoder), alignof(JpegDecoder));
+    void* encoderStorage = arena->alloc(sizeof(JpegEncoder), alignof(JpegEncoder));
+    blocks = static_cast<int16_t*>(arena->alloc(BORDER_MCU_BLOCKS * JPEG_BLOCK_SIZE * sizeof(int16_t)));
+    if (decoderStorage == nullptr || encoderStorage == nullptr || blocks == nullptr) {
+        arena->release(mark);
+        return JPEG_ERROR_MEMORY;
+    }
+
+    // Only coefficients are read, the decoder needs no strip planes
+    decoder = new (decoderStorage) JpegDecoder();
+    int result = decoder->begin(data, length, nullptr);
+    if (result == JPEG_OK &&
+        (decoder->getComponentCount() != 3 || decoder->getSubsampling() != JPEG_SUBSAMPLING_422 ||
+         decoder->getHeight() % BORDER_MCU_HEIGHT != 0 || decoder->getHeight() + 2 * FILM_BORDER_HEIGHT > BORDER_MAX_HEIGHT ||
+         decoder->getQuantTable(1) != decoder->getQuantTable(2) ||
+         decoder->getHuffmanSpec(1, false).values != decoder->getHuffmanSpec(2, false).values ||
+         decoder->getHuffmanSpec(1, true).values != decoder->getHuffmanSpec(2, true).values)) {
+        // The tiles are 4:2:2, and the encoder codes both chromas with one set of tables
+        result = JPEG_ERROR_UNSUPPORTED;
+    }
+    if (result == JPEG_OK) {
+        encoder = new (encoderStorage) JpegEncoder();
+        encoder->beginSplice(decoder->getQuantTable(0), decoder->getQuantTable(1), decoder->getHuffmanSpec(0, false),
+                             decoder->getHuffmanSpec(0, true), decoder->getHuffmanSpec(1, false),
+                             decoder->getHuffmanSpec(1, true), writer, context);
+        columns = decoder->getMcusPerStrip();
+        sourceMcus = columns * decoder->getStripCount();
+        interval = decoder->getRestartInterval();
+        result = copyHeaders(data);
+    }
+    if (result == JPEG_OK) {
+        codeRebate(true);
+        if (interval == 0) {
+            result = spliceScan(data);
+        } else if (codedMcus % interval == 0) {
+            result = copyIntervals(data, length);
+        } else {
+            result = recodeScan();
+        }
+    }
+    if (result == JPEG_OK) {
+        codeRebate(false);
+        result = encoder->finish();
+    }
+    arena->release(mark);
+    return result;
+}
+
+int FilmBorder::copyHeaders(const uint8_t* data) {
+    // Walk the segments up to the frame header, the decoder already checked them
+    size_t scanStart = decoder->getScanStart();
+    size_t offset = 2;
+    while (offset + 9 <= scanStart) {
+        if (data[offset] != 0xFF) {
+            return JPEG_ERROR_FORMAT;
+        }
+        uint8_t marker = data[offset + 1];
+        if (marker == 0xFF) {
+            offset++;
+            continue;
+        }
+        if (marker == 0xC0 || marker == 0xC1) {
+            int height = decoder->getHeight() + 2 * FILM_BORDER_HEIGHT;
+            uint8_t size[2] = {(uint8_t) (height >> 8), (uint8_t) height};
+            encoder->copyBytes(data, offset + 5);
+            encoder->copyBytes(size, sizeof(size));
+            encoder->copyBytes(data + offset + 7, scanStart - offset - 7);
+            return JPEG_OK;
+        }
+        offset += 2 + ((data[offset + 2] << 8) | data[offset + 3]);
+    }
+    return JPEG_ERROR_FORMAT;
+}
+
+void FilmBorder::codeRebate(bool top) {
+    for (int row = 0; row < FILM_BORDER_HEIGHT / BORDER_MCU_HEIGHT; row++) {
+        for (int column = 0; column < columns; column++) {
+            const BorderTile* tile;
+            int tileColumn;
+            int tileRow;
+            pickArt(top, column, row, &tile, &tileColumn, &tileRow);
+            countMcu();
+            codeArt(tile, tileColumn, tileRow);
+            borderMcus++;
+        }
+    }
+}
+
+void FilmBorder::pickArt(bool top, int column, int row, const BorderTile** tile, int* tileColumn, int* tileRow) const {
+    int x = column * BORDER_MCU_WIDTH;
+    int y = row * BORDER_MCU_HEIGHT;
+    *tile = art.rebate;
+    *tileColumn = 0;
+    *tileRow = 0;
+
+    // The bottom rebate is the top one upside down, the holes stay on the outer edge
+    int textTop = top ? FILM_BORDER_TEXT_EDGE : FILM_BORDER_HEIGHT - FILM_BORDER_TEXT_EDGE - art.font->height;
+    if (y >= textTop && y < textTop + art.font->height) {
+        int glyph = top ? glyphAt(filmName, filmNameLength, x) : glyphAt(frameLabel, frameLabelLength, x);
+        if (glyph >= 0) {
+            *tile = art.font;
+            *tileColumn = glyph;
+            *tileRow = (y - textTop) / BORDER_MCU_HEIGHT;
+        }
+        return;
+    }
+
+    int holeTop = top ? FILM_BORDER_HOLE_EDGE : FILM_BORDER_HEIGHT - FILM_BORDER_HOLE_EDGE - art.sprocket->height;
+    int holeLeft = (FILM_BORDER_HOLE_PITCH - art.sprocket->width) / 2 / BORDER_MCU_WIDTH * BORDER_MCU_WIDTH;
+    int holeX = x % FILM_BORDER_HOLE_PITCH - holeLeft;
+    if (y >= holeTop && y < holeTop + art.sprocket->height && holeX >= 0 && holeX < art.sprocket->width) {
+        *tile = art.sprocket;
+        *tileColumn = holeX / BORDER_MCU_WIDTH;
+        *tileRow = (y - holeTop) / BORDER_MCU_HEIGHT;
+    }
+}
+
+int FilmBorder::glyphAt(const char* text, int textLength, int x) const {
+    if (x < FILM_BORDER_TEXT_LEFT) {
+        return -1;
+    }
+    int index = (x - FILM_BORDER_TEXT_LEFT) % FILM_BORDER_TEXT_PITCH / BORDER_MCU_WIDTH;
+    if (index >= textLength) {
+        return -1;
+    }
+    char character = text[index] == '_' ? ' ' : (char) toupper((unsigned char) text[index]);
+    const char* found = strchr(art.characters, character);
+    if (character == '\0' || found == nullptr || found - art.characters >= art.font->width / BORDER_MCU_WIDTH) {
+        return -1;
+    }
+    return (int) (found - art.characters);
+}
+
+void FilmBorder::codeArt(const BorderTile* tile, int column, int row) {
+    const int16_t* values = tile->coefficients + tile->mcus[row * (tile->width / BORDER_MCU_WIDTH) + column];
+    for (int i = 0; i < BORDER_MCU_BLOCKS; i++) {
+        int component = i < 2 ? 0 : i - 1;
+        const uint8_t* quant = decoder->getQuantTable(component);
+        memset(blocks, 0, JPEG_BLOCK_SIZE * sizeof(int16_t));
+        int count = *values++;
+        blocks[0] = quantize(*values++, quant[0]);
+        for (int k = 0; k < count; k++) {
+            int index = values[0];
+            blocks[index] = quantize(values[1], quant[index]);
+            values += 2;
+        }
+        encoder->encodeCoefficients(blocks, component);
+    }
+}
+
+void FilmBorder::codeMcu(const int16_t* blocks) {
+    for (int i = 0; i < BORDER_MCU_BLOCKS; i++) {
+        encoder->encodeCoefficients(blocks + i * JPEG_BLOCK_SIZE, i < 2 ? 0 : i - 1);
+    }
+}
+
+void FilmBorder::countMcu() {
+    if (interval > 0 && codedMcus > 0 && codedMcus % interval == 0) {
+        encoder->writeRestart(codedMcus / interval - 1);
+    }
+    codedMcus++;
+}
+
+int FilmBorder::spliceScan(const uint8_t* data) {
+    // The first MCU had its DC predicted from zero, it now follows the rebate
+    if (decoder->decodeMcu(blocks) != JPEG_OK) {
+        return JPEG_ERROR_DATA;
+    }
+    codeMcu(blocks);
+    recodedMcus++;
+
+    // The others keep their bits, they are only read for the end of the scan and its last DCs
+    int startBit;
+    size_t start = decoder->getScanPosition(&startBit);
+    for (int mcu = 1; mcu < sourceMcus; mcu++) {
+        if (decoder->decodeMcu(blocks) != JPEG_OK) {
+            return JPEG_ERROR_DATA;
+        }
+    }
+    int endBit;
+    size_t end = decoder->getScanPosition(&endBit);
+    copyScanBits(data, start, startBit, end, endBit);
+
+    int16_t predictors[JPEG_MAX_COMPONENTS];
+    decoder->getDcPredictors(predictors);
+    for (int i = 0; i < decoder->getComponentCount(); i++) {
+        encoder->setDcPredictor(i, predictors[i]);
+    }
+    codedMcus += sourceMcus;
+    return JPEG_OK;
+}
+
+int FilmBorder::copyIntervals(const uint8_t* data, size_t length) {
+    // The end of image closes the copy, whatever follows it in the buffer
+    size_t scanStart = decoder->getScanStart();
+    size_t end = length >= 2 ? length - 2 : 0;
+    while (end > scanStart && !(data[end] == 0xFF && data[end + 1] == 0xD9)) {
+        end--;
+    }
+    if (end <= scanStart) {
+        return JPEG_ERROR_FORMAT;
+    }
+
+    // A partial last interval goes on in the bottom rebate, it is read for where it ends and its DCs
+    int tail = sourceMcus % interval;
+    int endBit = 0;
+    int16_t predictors[JPEG_MAX_COMPONENTS] = {0, 0, 0};
+    if (tail > 0) {
+        if (decoder->skipRestartIntervals(sourceMcus / interval) != JPEG_OK) {
+            return JPEG_ERROR_DATA;
+        }
+        for (int mcu = 0; mcu < tail; mcu++) {
+            if (decoder->decodeMcu(blocks) != JPEG_OK) {
+                return JPEG_ERROR_DATA;
+            }
+        }
+        end = decoder->getScanPosition(&endBit);
+        decoder->getDcPredictors(predictors);
+    }
+
+    // The frame starts an interval, after the markers of the top rebate
+    int shift = codedMcus / interval;
+    encoder->writeRestart(shift - 1);
+    copyRenumbered(data, scanStart, end, shift);
+    if (endBit > 0) {
+        encoder->copyBits(data[end] >> (8 - endBit), endBit);
+    }
+    for (int i = 0; i < decoder->getComponentCount(); i++) {
+        encoder->setDcPredictor(i, predictors[i]);
+    }
+    codedMcus += sourceMcus;
+    return JPEG_OK;
+}
+
+int FilmBorder::recodeScan() {
+    for (int mcu = 0; mcu < sourceMcus; mcu++) {
+        if (decoder->decodeMcu(blocks) != JPEG_OK) {
+            return JPEG_ERROR_DATA;
+        }
+        countMcu();
+        codeMcu(blocks);
+        recodedMcus++;
+    }
+    return JPEG_OK;
+}
+
+void FilmBorder::copyScanBits(const uint8_t* data, size_t start, int startBit, size_t end, int endBit) {
+    // Bytes are unstuffed on the way in, the encoder stuffs them again at their new place
+    size_t offset = start;
+    int bit = startBit;
+    while (offset < end) {
+        uint8_t byte = data[offset];
+        encoder->copyBits(byte & (0xFF >> bit), 8 - bit);
+        offset += byte == 0xFF ? 2 : 1;
+        bit = 0;
+    }
+    if (endBit > bit) {
+        encoder->copyBits((data[end] >> (8 - endBit)) & ((1u << (endBit - bit)) - 1), endBit - bit);
+    }
+    copiedBytes += end - start;
+}
+
+void FilmBorder::copyRenumbered(const uint8_t* data, size_t start, size_t end, int shift) {
+    // A stuffed 0xFF is followed by a zero, so 0xFF 0xD0-0xD7 is always a marker
+    size_t from = start;
+    for (size_t offset = start; shift % 8 != 0 && offset + 1 < end; offset++) {
+        if (data[offset] == 0xFF && data[offset + 1] >= 0xD0 && data[offset + 1] <= 0xD7) {
+            uint8_t marker = (uint8_t) (0xD0 + ((data[offset + 1] - 0xD0 + shift) & 7));
+            encoder->copyBytes(data + from, offset + 1 - from);
+            encoder->copyBytes(&marker, 1);
+            offset++;
+            from = offset + 1;
+        }
+    }
+    encoder->copyBytes(data + from, end - from);
+    copiedBytes += end - start;
+}
+
+int FilmBorder::getBorderMcus() const {
+    return borderMcus;
+}
+
+int FilmBorder::getRecodedMcus() const {
+    return recodedMcus;
+}
+
+size_t FilmBorder::getCopiedBytes() const {
+    return copiedBytes;
+}
+
+size_t FilmBorder::requiredBytes() {
+    return sizeof(JpegDecoder) + sizeof(JpegEncoder) + BORDER_MCU_BLOCKS * JPEG_BLOCK_SIZE * sizeof(int16_t) +
+           3 * BORDER_ALIGN_SLACK;
+}
@@ -0,0 +1,201 @@
+#ifndef RETROLENS_FILM_BORDER_H
+#define RETROLENS_FILM_BORDER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "BorderTile.h"
+#include "ImageArena.h"
+#include "JpegDecoder.h"
+#include "JpegEncoder.h"
+
+// Rebate added above and below the frame, in pixels, whole MCUs
+#define FILM_BORDER_HEIGHT 128
+
+// Sprocket holes, one centered in each pitch along the rebate, from the outer edge
+#define FILM_BORDER_HOLE_PITCH 160
+#define FILM_BORDER_HOLE_EDGE 16
+
+// Edge print, from the outer edge and repeated along the rebate
+#define FILM_BORDER_TEXT_EDGE 96
+#define FILM_BORDER_TEXT_LEFT 64
+#define FILM_BORDER_TEXT_PITCH 640
+
+// Longest film name or frame label
+#define FILM_BORDER_MAX_CHARS 24
+
+/**
+ * @struct BorderArt
+ * @brief The tiles a film border is made of.
+ */
+struct BorderArt {
+    const BorderTile* rebate;   ///< Plain rebate, one MCU.
+    const BorderTile* sprocket; ///< A sprocket hole on the rebate.
+    const BorderTile* font;     ///< Edge print glyphs side by side, one MCU wide each.
+    const char* characters;     ///< Characters of the font glyphs, in order.
+};
+
+/**
+ * @class FilmBorder
+ * @brief Adds a film rebate above and below a JPEG, sprocket holes and edge print, without coding the frame again.
+ *
+ * The rebate is made of tiles of DCT coefficients generated at build time, they are quantized
+ * with the tables of the source and coded with its Huffman tables, no pixel is touched. The
+ * frame itself keeps its entropy-coded data:
+ *
+ * - Without restart markers, only the first MCU is coded again, as its DC was predicted from
+ *   zero and now follows the rebate. The rest of the scan is copied bit for bit at the new
+ *   alignment. It is still read once, for the DC predictions the bottom rebate follows.
+ * - With restart markers and a rebate of whole intervals, the frame starts an interval and is
+ *   copied byte for byte with its markers renumbered. Only the last interval is read, when the
+ *   bottom rebate carries it on.
+ * - With other intervals the frame is coded again from its coefficients.
+ *
+ * The top rebate shows the film name, the bottom one the frame label, both in capitals. The
+ * tiles are 4:2:2 and so must be the source, with a height of whole MCUs, which the camera
+ * frames are. Memory is a coefficient decoder and an encoder from the ImageArena, whatever the
+ * frame size.
+ *
+ * Example usage:
+ * @code
+ * FilmBorder border(&arena, art);
+ * border.write(fb->buf, fb->len, "test_film", "12 >12A", writeToFile, &file);
+ * @endcode
+ */
+class FilmBorder {
+public:
+    /**
+     * @brief Constructor for FilmBorder.
+     *
+     * @param arena Memory budget of the border, used from its current mark.
+     * @param art Tiles of the border.
+     */
+    FilmBorder(ImageArena* arena, const BorderArt& art);
+
+    /**
+     * @brief Write a copy of a JPEG inside its film border.
+     *
+     * @param data JPEG file.
+     * @param length Size of the file.
+     * @param filmName Edge print of the top rebate, lower case and _ are printed as capitals and spaces.
+     * @param frameLabel Edge print of the bottom rebate.
+     * @param writer Output sink.
+     * @param context Context of the writer.
+     * @return int JPEG_OK or a JPEG_ERROR_* code, JPEG_ERROR_UNSUPPORTED for a frame the tiles do not fit.
+     */
+    int write(const uint8_t* data, size_t length, const char* filmName, const char* frameLabel, JpegWriter writer,
+              void* context);
+
+    /**
+     * @brief Get the MCUs of rebate coded in the last write().
+     */
+    int getBorderMcus() const;
+
+    /**
+     * @brief Get the MCUs of the frame coded again in the last write().
+     */
+    int getRecodedMcus() const;
+
+    /**
+     * @brief Get the bytes of the source scan copied in the last write(), at their alignment or not.
+     */
+    size_t getCopiedBytes() const;
+
+    /**
+     * @brief Get the memory a border needs from its arena, whatever the frame size.
+     *
+     * @return size_t Upper bound in bytes.
+     */
+    static size_t requiredBytes();
+
+private:
+    /**
+     * @brief Copy the headers of the source, with the height of the bordered frame.
+     *
+     * @return int JPEG_OK or JPEG_ERROR_FORMAT.
+     */
+    int copyHeaders(const uint8_t* data);
+
+    /**
+     * @brief Code one rebate, row by row.
+     *
+     * @param top True for the rebate above the frame.
+     */
+    void codeRebate(bool top);
+
+    /**
+     * @brief Find the tile and its MCU under an MCU of a rebate.
+     */
+    void pickArt(bool top, int column, int row, const BorderTile** tile, int* tileColumn, int* tileRow) const;
+
+    /**
+     * @brief Find the glyph of the edge print at a distance along the rebate.
+     *
+     * @return int Glyph index in the font, -1 for plain rebate.
+     */
+    int glyphAt(const char* text, int textLength, int x) const;
+
+    /**
+     * @brief Quantize and code an MCU of a tile.
+     */
+    void codeArt(const BorderTile* tile, int column, int row);
+
+    /**
+     * @brief Code the blocks of an MCU of the source, quantized coefficients.
+     */
+    void codeMcu(const int16_t* blocks);
+
+    /**
+     * @brief Write the restart marker due before the next MCU, if any, and count that MCU.
+     */
+    void countMcu();
+
+    /**
+     * @brief Splice a scan without restart markers.
+     */
+    int spliceScan(const uint8_t* data);
+
+    /**
+     * @brief Copy a scan whose intervals line up with the rebate.
+     */
+    int copyIntervals(const uint8_t* data, size_t length);
+
+    /**
+     * @brief Code every MCU of the scan again from its coefficients.
+     */
+    int recodeScan();
+
+    /**
+     * @brief Copy entropy-coded bits of the source at the alignment of the output.
+     *
+     * @param start Offset of the byte of the first bit.
+     * @param startBit Bits of that byte left out.
+     * @param end Offset of the byte after the last whole byte.
+     * @param endBit Bits of that byte copied.
+     */
+    void copyScanBits(const uint8_t* data, size_t start, int startBit, size_t end, int endBit);
+
+    /**
+     * @brief Copy entropy-coded bytes, moving the number of each restart marker on.
+     */
+    void copyRenumbered(const uint8_t* data, size_t start, size_t end, int shift);
+
+    ImageArena* arena;        ///< Memory budget.
+    BorderArt art;            ///< Tiles of the border.
+    JpegDecoder* decoder;     ///< Coefficient reader of the source.
+    JpegEncoder* encoder;     ///< Output.
+    int16_t* blocks;          ///< Blocks of one MCU.
+    const char* filmName;     ///< Edge print of the top rebate.
+    const char* frameLabel;   ///< Edge print of the bottom rebate.
+    int filmNameLength;       ///< Characters of the film name.
+    int frameLabelLength;     ///< Characters of the frame label.
+    int columns;              ///< MCUs across the frame.
+    int sourceMcus;           ///< MCUs of the source scan.
+    uint16_t interval;        ///< Restart interval of the source and the output, 0 for none.
+    int codedMcus;            ///< MCUs of the output so far.
+    int borderMcus;           ///< Rebate MCUs coded in the last write().
+    int recodedMcus;          ///< Frame MCUs coded again in the last write().
+    size_t copiedBytes;       ///< Source scan bytes copied in the last write().
+};
+
+#endif // RETROLENS_FILM_BORDER_H
@@ -0,0 +1,56 @@
+#include <math.h>
+
+#include "FilmGrain.h"
+#include "JpegTables.h"
+
+FilmGrain::FilmGrain() : noise(nullptr), mask(0), offsetX(0), offsetY(0) {}
+
+void FilmGrain::setTile(const GrainTile* tile) {
+    noise = nullptr;
+    if (tile == nullptr || tile->size == 0 || (tile->size & (tile->size - 1)) != 0 || tile->strength == 0) {
+        return;
+    }
+    // The noise is brought to the standard deviation of the stock, whatever the spread of the tile
+    int count = tile->size * tile->size;
+    double squares = 0;
+    for (int i = 0; i < count; i++) {
+        squares += (double) tile->noise[i] * tile->noise[i];
+    }
+    double deviation = sqrt(squares / count);
+    if (deviation == 0) {
+        return;
+    }
+    for (int step = 0; step < FILM_GRAIN_RESPONSE_STEPS; step++) {
+        double gain = tile->strength / 10.0 * tile->response[step] / 100.0 / deviation;
+        for (int value = -128; value < 128; value++) {
+            long grain = lround(value * gain);
+            scaled[step][(uint8_t) value] = (int8_t) (grain < -127 ? -127 : (grain > 127 ? 127 : grain));
+        }
+    }
+    mask = tile->size - 1;
+    offsetX = offsetY = 0;
+    noise = tile->noise;
+}
+
+bool FilmGrain::isEnabled() const {
+    return noise != nullptr;
+}
+
+void FilmGrain::newFrame(uint32_t random) {
+    offsetX = (int) (random & 0xFFFF) & mask;
+    offsetY = (int) (random >> 16) & mask;
+}
+
+void FilmGrain::applyStrip(uint8_t* ycc, size_t stride, int width, int rows, int top) const {
+    if (noise == nullptr) {
+        return;
+    }
+    for (int y = 0; y < rows; y++) {
+        uint8_t* pixel = ycc + (size_t) y * stride;
+        const int8_t* row = grainRow(top + y);
+        for (int x = 0; x < width; x++) {
+            pixel[0] = addGrain(pixel[0], row, x);
+            pixel += JPEG_YCC_BYTES;
+        }
+    }
+}
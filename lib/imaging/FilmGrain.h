@@ -0,0 +1,99 @@
+#ifndef RETROLENS_FILM_GRAIN_H
+#define RETROLENS_FILM_GRAIN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "GrainTile.h"
+
+// Luma values of each step of the grain response
+#define FILM_GRAIN_RESPONSE_STEPS 16
+#define FILM_GRAIN_RESPONSE_SHIFT 4
+
+/**
+ * @class FilmGrain
+ * @brief Film grain from a precomputed blue-noise tile, added to the luma of the developed pixels.
+ *
+ * setTile() scales every noise value for every step of the response into a table, so the grain
+ * of a pixel is one lookup by its luma and noise value, then an add. Each frame places the tile
+ * at a random offset with newFrame(), so the grain does not stay put from frame to frame.
+ * The grain is added by FilmProcess in its pixel loop; it only reads its tables, the lanes of
+ * a strip encoder can use it at the same time.
+ *
+ * Example usage:
+ * @code
+ * FilmGrain grain;
+ * grain.setTile(findGrainTile(stock->name));
+ * process.setGrain(&grain);
+ * grain.newFrame(esp_random());
+ * @endcode
+ */
+class FilmGrain {
+public:
+    /**
+     * @brief Constructor for FilmGrain, without grain.
+     */
+    FilmGrain();
+
+    /**
+     * @brief Set the grain of the film stock.
+     *
+     * @param tile Generated tile, kept by the caller, nullptr for none.
+     */
+    void setTile(const GrainTile* tile);
+
+    /**
+     * @brief Check if there is grain to add.
+     */
+    bool isEnabled() const;
+
+    /**
+     * @brief Move the tile to a new place for the next frame.
+     *
+     * @param random Random bits, the offset is taken from them.
+     */
+    void newFrame(uint32_t random);
+
+    /**
+     * @brief Get the noise under a row of the frame.
+     *
+     * @param row Row of the frame.
+     * @return const int8_t* Row of the tile, indexed by grainColumn().
+     */
+    inline const int8_t* grainRow(int row) const {
+        return noise + (size_t) ((row + offsetY) & mask) * (mask + 1);
+    }
+
+    /**
+     * @brief Add the grain of a pixel to its luma.
+     *
+     * @param luma Luma of the pixel.
+     * @param row Noise of its row, from grainRow().
+     * @param x Column of the pixel.
+     * @return uint8_t Luma with grain.
+     */
+    inline uint8_t addGrain(uint8_t luma, const int8_t* row, int x) const {
+        int value = luma + scaled[luma >> FILM_GRAIN_RESPONSE_SHIFT][(uint8_t) row[(x + offsetX) & mask]];
+        return (uint8_t) (value < 0 ? 0 : (value > 255 ? 255 : value));
+    }
+
+    /**
+     * @brief Add the grain to a strip in place, without the rest of the film process.
+     *
+     * @param ycc Rows of interleaved YCbCr.
+     * @param stride Distance between rows, in bytes.
+     * @param width Pixels of a row.
+     * @param rows Number of rows.
+     * @param top Row of the frame the strip starts at.
+     */
+    void applyStrip(uint8_t* ycc, size_t stride, int width, int rows, int top) const;
+
+private:
+    const int8_t* noise;                           ///< Noise of the tile, nullptr without grain.
+    int mask;                                      ///< Side of the tile minus one.
+    int offsetX;                                   ///< Column of the tile at the left of the frame.
+    int offsetY;                                   ///< Row of the tile at the top of the frame.
+    int8_t scaled[FILM_GRAIN_RESPONSE_STEPS][256]; ///< Grain of each noise value, as uint8_t, for each step.
+};
+
+#endif // RETROLENS_FILM_GRAIN_H
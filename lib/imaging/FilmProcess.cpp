@@ -0,0 +1,70 @@
+#include "FilmProcess.h"
+#include "JpegTables.h"
+
+const FilmLook FILM_LOOK_NEUTRAL = {0, 100};
+
+static inline int clampInt(int value, int low, int high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+FilmProcess::FilmProcess() : lut(nullptr), grain(nullptr) {
+    setLook(FILM_LOOK_NEUTRAL);
+}
+
+void FilmProcess::setLook(const FilmLook& look) {
+    int contrast = clampInt(look.contrast, -100, 100);
+    int saturation = clampInt(look.saturation, 0, 200);
+    for (int value = 0; value < 256; value++) {
+        // Smoothstep S-curve in 1/255, blended with the identity by the contrast
+        int64_t t = value;
+        int curve = (int) ((t * t * (3 * 255 - 2 * t) + 255 * 255 / 2) / (255 * 255));
+        int toneShift = (curve - value) * contrast;
+        toneCurve[value] = (uint8_t) clampInt(value + (toneShift + (toneShift < 0 ? -50 : 50)) / 100, 0, 255);
+        int chroma = (value - 128) * saturation;
+        chromaCurve[value] = (uint8_t) clampInt(128 + (chroma + (chroma < 0 ? -50 : 50)) / 100, 0, 255);
+    }
+    neutral = contrast == 0 && saturation == 100;
+}
+
+void FilmProcess::setColorLut(const ColorLut* lut) {
+    this->lut = (lut != nullptr && lut->isLoaded()) ? lut : nullptr;
+}
+
+void FilmProcess::setGrain(const FilmGrain* grain) {
+    this->grain = (grain != nullptr && grain->isEnabled()) ? grain : nullptr;
+}
+
+bool FilmProcess::isNeutral() const {
+    return neutral && lut == nullptr && grain == nullptr;
+}
+
+void FilmProcess::processStrip(uint8_t* ycc, size_t stride, int width, int rows, int top) const {
+    if (lut != nullptr) {
+        lut->applyStrip(ycc, stride, width, rows);
+    }
+    if (grain != nullptr) {
+        for (int y = 0; y < rows; y++) {
+            uint8_t* pixel = ycc + (size_t) y * stride;
+            const int8_t* grainRow = grain->grainRow(top + y);
+            for (int x = 0; x < width; x++) {
+                pixel[0] = grain->addGrain(toneCurve[pixel[0]], grainRow, x);
+                pixel[1] = chromaCurve[pixel[1]];
+                pixel[2] = chromaCurve[pixel[2]];
+                pixel += JPEG_YCC_BYTES;
+            }
+        }
+        return;
+    }
+    if (neutral) {
+        return;
+    }
+    for (int y = 0; y < rows; y++) {
+        uint8_t* pixel = ycc + (size_t) y * stride;
+        for (int x = 0; x < width; x++) {
+            pixel[0] = toneCurve[pixel[0]];
+            pixel[1] = chromaCurve[pixel[1]];
+            pixel[2] = chromaCurve[pixel[2]];
+            pixel += JPEG_YCC_BYTES;
+        }
+    }
+}
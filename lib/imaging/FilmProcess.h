@@ -0,0 +1,93 @@
+#ifndef RETROLENS_FILM_PROCESS_H
+#define RETROLENS_FILM_PROCESS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ColorLut.h"
+#include "FilmGrain.h"
+
+/**
+ * @struct FilmLook
+ * @brief Processing parameters of a film stock.
+ */
+struct FilmLook {
+    int contrast;   ///< S-curve strength on luma, in percent, 0 keeps the tones, negative flattens them.
+    int saturation; ///< Chroma gain, in percent, 100 keeps the colors.
+};
+
+/// Look that leaves the pixels untouched.
+extern const FilmLook FILM_LOOK_NEUTRAL;
+
+/**
+ * @class FilmProcess
+ * @brief Film processing stage: applies the look of a film stock to strips of interleaved YCbCr pixels.
+ *
+ * The look is turned into tables once by setLook(), so a pixel costs three lookups.
+ * A film may also have a 3D color LUT, looked up before the curves, and grain, added to
+ * the luma in the same loop as the curves. processStrip() only
+ * reads the tables, the lanes of a strip encoder can run it at the same time on strips
+ * of their own.
+ *
+ * Example usage:
+ * @code
+ * FilmProcess process;
+ * process.setLook(look);
+ * process.setColorLut(&lut);
+ * process.setGrain(&grain);
+ * process.processStrip(strip, width * JPEG_YCC_BYTES, width, rows, top);
+ * @endcode
+ */
+class FilmProcess {
+public:
+    /**
+     * @brief Constructor for FilmProcess, with the neutral look.
+     */
+    FilmProcess();
+
+    /**
+     * @brief Set the look applied by the next strips.
+     *
+     * @param look Processing parameters, clamped to -100..100 contrast and 0..200 saturation.
+     */
+    void setLook(const FilmLook& look);
+
+    /**
+     * @brief Set the color LUT applied before the curves.
+     *
+     * @param lut Loaded LUT, kept by the caller, nullptr for none.
+     */
+    void setColorLut(const ColorLut* lut);
+
+    /**
+     * @brief Set the grain added after the curves.
+     *
+     * @param grain Grain of the film, kept by the caller, nullptr for none.
+     */
+    void setGrain(const FilmGrain* grain);
+
+    /**
+     * @brief Check if the look leaves the pixels untouched.
+     */
+    bool isNeutral() const;
+
+    /**
+     * @brief Apply the look to a strip in place.
+     *
+     * @param ycc Rows of interleaved YCbCr.
+     * @param stride Distance between rows, in bytes.
+     * @param width Pixels of a row.
+     * @param rows Number of rows.
+     * @param top Row of the frame the strip starts at, places the grain.
+     */
+    void processStrip(uint8_t* ycc, size_t stride, int width, int rows, int top = 0) const;
+
+private:
+    uint8_t toneCurve[256];   ///< Output luma of each input luma.
+    uint8_t chromaCurve[256]; ///< Output chroma of each input chroma.
+    bool neutral;             ///< True if both curves are the identity.
+    const ColorLut* lut;      ///< Color LUT, nullptr for none.
+    const FilmGrain* grain;   ///< Grain, nullptr for none.
+};
+
+#endif // RETROLENS_FILM_PROCESS_H
@@ -0,0 +1,280 @@
+#include <new>
+#include <stdio.h>
+#include <string.h>
+
+#include "FrameDeveloper.h"
+
+// Slack of each arena allocation for its alignment
+#define DEVELOP_ALIGN_SLACK 8
+
+static const char* const STAGE_NAMES[DEVELOP_STAGE_COUNT] = {"look", "transform", "stamp", "border"};
+
+FrameDeveloper::FrameDeveloper(ImageArena* arena, const BorderArt& art)
+    : arena(arena), art(art), writer(nullptr), context(nullptr), bytesWritten(0), width(0), height(0),
+      subsampling(JPEG_SUBSAMPLING_422), recodedMcus(0) {
+    for (int stage = 0; stage < DEVELOP_STAGE_COUNT; stage++) {
+        stageResults[stage] = DEVELOP_STAGE_SKIPPED;
+    }
+}
+
+bool FrameDeveloper::isNeeded(const DevelopSettings& settings) {
+    return settings.look != nullptr || settings.rotation != JPEG_ROTATE_0 || settings.crop != JPEG_CROP_FULL ||
+           settings.dateText != nullptr || settings.filmName != nullptr;
+}
+
+void FrameDeveloper::setCameraStages(DevelopSettings* settings, int rotation, int crop, const char* dateText,
+                                     const char* filmName, unsigned frameNumber, char* label) {
+    settings->rotation = rotation;
+    settings->crop = crop;
+    settings->dateText = dateText;
+    settings->filmName = filmName;
+    if (filmName != nullptr) {
+        // Numbered as on a film edge, the frame and its half frame
+        snprintf(label, FILM_BORDER_MAX_CHARS, "%u >%uA", frameNumber, frameNumber);
+        settings->frameLabel = label;
+    }
+}
+
+int FrameDeveloper::write(const uint8_t* data, size_t length, const DevelopSettings& settings, JpegWriter writer,
+                          void* context) {
+    this->writer = writer;
+    this->context = context;
+    bytesWritten = 0;
+    recodedMcus = 0;
+    for (int stage = 0; stage < DEVELOP_STAGE_COUNT; stage++) {
+        stageResults[stage] = DEVELOP_STAGE_SKIPPED;
+    }
+    if (!isNeeded(settings)) {
+        return JPEG_ERROR_STATE;
+    }
+    int result = probe(data, length);
+    if (result != JPEG_OK) {
+        return result;
+    }
+
+    bool enabled[DEVELOP_STAGE_COUNT] = {settings.look != nullptr,
+                                         settings.rotation != JPEG_ROTATE_0 || settings.crop != JPEG_CROP_FULL,
+                                         settings.dateText != nullptr, settings.filmName != nullptr};
+    size_t mark = arena->getMark();
+    const uint8_t* frame = data;
+    size_t frameLength = length;
+    for (int stage = 0; stage < DEVELOP_STAGE_COUNT; stage++) {
+        if (!enabled[stage]) {
+            continue;
+        }
+        int next = stage + 1;
+        while (next < DEVELOP_STAGE_COUNT && !enabled[next]) {
+            next++;
+        }
+        size_t keep = stageBytes(stage);
+        if (arena->getCapacity() - arena->getMark() < keep) {
+            stageResults[stage] = result = JPEG_ERROR_MEMORY;
+            continue;
+        }
+
+        // The next stages need the whole frame, it is kept in the arena under the stage
+        size_t sinkMark = arena->getMark();
+        MemorySink sink = {nullptr, 0, 0};
+        if (next < DEVELOP_STAGE_COUNT) {
+            size_t bytes = stage == DEVELOP_STAGE_LOOK ? frameLength * DEVELOP_LOOK_GROWTH
+                                                       : frameLength + frameLength / DEVELOP_SLACK_DIVISOR;
+            sink = reserveSink(bytes, keep);
+        }
+        if (sink.data == nullptr) {
+            // The last stage, or no room to keep its output: it writes the frame and the stages after it are left out
+            stageResults[stage] = result = runStage(stage, frame, frameLength, settings, writeCounted, this);
+            if (result != JPEG_OK && frame != data && bytesWritten == 0) {
+                // Nothing of the stage was written, the frame is kept as the stages before it left it
+                result = writeCounted(this, frame, frameLength) ? JPEG_OK : JPEG_ERROR_WRITE;
+            }
+            arena->release(mark);
+            return result;
+        }
+        stageResults[stage] = result = runStage(stage, frame, frameLength, settings, writeToMemory, &sink);
+        if (result == JPEG_OK) {
+            frame = sink.data;
+            frameLength = sink.used;
+        } else {
+            arena->release(sinkMark);
+        }
+    }
+
+    // The last stage had no memory, the frame of the stages before it is written
+    if (frame != data) {
+        result = writeCounted(this, frame, frameLength) ? JPEG_OK : JPEG_ERROR_WRITE;
+    }
+    arena->release(mark);
+    return result;
+}
+
+int FrameDeveloper::runStage(int stage, const uint8_t* data, size_t length, const DevelopSettings& settings,
+                             JpegWriter writer, void* context) {
+    switch (stage) {
+        case DEVELOP_STAGE_LOOK:
+            return writeLook(data, length, settings.look, writer, context);
+        case DEVELOP_STAGE_TRANSFORM: {
+            JpegTransform transform(arena);
+            return transform.write(data, length, settings.rotation, settings.crop, writer, context);
+        }
+        case DEVELOP_STAGE_STAMP: {
+            // The border goes around the stamped frame, so the stamp stays on the picture
+            DateStamp stamp(arena);
+            int result = stamp.write(data, length, settings.dateText, writer, context);
+            recodedMcus += result == JPEG_OK ? stamp.getRecodedMcus() : 0;
+            return result;
+        }
+        case DEVELOP_STAGE_BORDER: {
+            FilmBorder border(arena, art);
+            int result = border.write(data, length, settings.filmName, settings.frameLabel, writer, context);
+            recodedMcus += result == JPEG_OK ? border.getRecodedMcus() : 0;
+            return result;
+        }
+    }
+    return JPEG_ERROR_STATE;
+}
+
+int FrameDeveloper::writeLook(const uint8_t* data, size_t length, const FilmProcess* look, JpegWriter writer,
+                              void* context) {
+    size_t mark = arena->getMark();
+    void* storage = arena->alloc(sizeof(JpegDecoder), alignof(JpegDecoder));
+    if (storage == nullptr) {
+        return JPEG_ERROR_MEMORY;
+    }
+    JpegDecoder* decoder = new (storage) JpegDecoder();
+    int result = decoder->begin(data, length, arena);
+    if (result == JPEG_OK && decoder->getComponentCount() != JPEG_MAX_COMPONENTS) {
+        result = JPEG_ERROR_UNSUPPORTED;
+    }
+    if (result != JPEG_OK) {
+        arena->release(mark);
+        return result;
+    }
+
+    int stripHeight = decoder->getStripHeight();
+    size_t rowBytes = (size_t) width * JPEG_YCC_BYTES;
+    uint8_t* strip = static_cast<uint8_t*>(arena->alloc(rowBytes * stripHeight));
+    storage = arena->alloc(sizeof(JpegEncoder), alignof(JpegEncoder));
+    if (strip == nullptr || storage == nullptr) {
+        arena->release(mark);
+        return JPEG_ERROR_MEMORY;
+    }
+
+    // Coded again with the tables of the frame, at the quality it was shot
+    JpegEncoder* encoder = new (storage) JpegEncoder();
+    result = encoder->begin(width, height, subsampling, decoder->getQuantTable(0), decoder->getQuantTable(1), writer, context,
+                            decoder->getRestartInterval());
+    for (int row = 0; result == JPEG_OK && row < height; row += stripHeight) {
+        int rows = height - row < stripHeight ? height - row : stripHeight;
+        result = decoder->decodeStrip(strip, rowBytes);
+        if (result != JPEG_OK) {
+            break;
+        }
+        look->processStrip(strip, rowBytes, width, rows, row);
+        result = encoder->encodeStrip(strip, rowBytes);
+    }
+    if (result == JPEG_OK) {
+        result = encoder->finish();
+    }
+    if (result == JPEG_OK) {
+        recodedMcus += decoder->getStripCount() * decoder->getMcusPerStrip();
+    }
+    arena->release(mark);
+    return result;
+}
+
+size_t FrameDeveloper::stageBytes(int stage) const {
+    switch (stage) {
+        case DEVELOP_STAGE_LOOK:
+            return lookBytes(width, subsampling);
+        case DEVELOP_STAGE_TRANSFORM:
+            // The look keeps the size and the sampling of the frame
+            return JpegTransform::requiredBytes(width, height, subsampling);
+        case DEVELOP_STAGE_STAMP:
+            return DateStamp::requiredBytes();
+        case DEVELOP_STAGE_BORDER:
+            return FilmBorder::requiredBytes();
+    }
+    return 0;
+}
+
+int FrameDeveloper::probe(const uint8_t* data, size_t length) {
+    size_t mark = arena->getMark();
+    void* storage = arena->alloc(sizeof(JpegDecoder), alignof(JpegDecoder));
+    if (storage == nullptr) {
+        return JPEG_ERROR_MEMORY;
+    }
+    // Only the headers are read, the decoder needs no strip planes
+    JpegDecoder* decoder = new (storage) JpegDecoder();
+    int result = decoder->begin(data, length, nullptr);
+    if (result == JPEG_OK) {
+        width = decoder->getWidth();
+        height = decoder->getHeight();
+        subsampling = decoder->getSubsampling();
+    }
+    arena->release(mark);
+    return result;
+}
+
+MemorySink FrameDeveloper::reserveSink(size_t bytes, size_t keep) {
+    MemorySink sink = {nullptr, 0, 0};
+    size_t room = arena->getCapacity() - arena->getMark();
+    if (room >= keep && room - keep >= bytes + sizeof(uint32_t)) {
+        sink.data = static_cast<uint8_t*>(arena->alloc(bytes));
+        sink.capacity = sink.data != nullptr ? bytes : 0;
+    }
+    return sink;
+}
+
+int FrameDeveloper::getStageResult(int stage) const {
+    if (stage < 0 || stage >= DEVELOP_STAGE_COUNT) {
+        return DEVELOP_STAGE_SKIPPED;
+    }
+    return stageResults[stage];
+}
+
+const char* FrameDeveloper::getStageName(int stage) {
+    if (stage < 0 || stage >= DEVELOP_STAGE_COUNT) {
+        return "";
+    }
+    return STAGE_NAMES[stage];
+}
+
+int FrameDeveloper::getRecodedMcus() const {
+    return recodedMcus;
+}
+
+size_t FrameDeveloper::getBytesWritten() const {
+    return bytesWritten;
+}
+
+size_t FrameDeveloper::lookBytes(int width, int subsampling) {
+    int horizontal;
+    int vertical;
+    jpegSamplingFactors(subsampling, &horizontal, &vertical);
+    size_t mcusPerRow = (width + horizontal * 8 - 1) / (horizontal * 8);
+    size_t stripHeight = vertical * 8;
+    size_t rowBytes = (size_t) width * JPEG_YCC_BYTES;
+
+    // A decoder with the planes of one MCU row, its strip, then the encoder
+    size_t planes = mcusPerRow * horizontal * 8 * vertical * 8 + 2 * mcusPerRow * 64;
+    return sizeof(JpegDecoder) + planes + rowBytes * stripHeight + sizeof(JpegEncoder) + 6 * DEVELOP_ALIGN_SLACK;
+}
+
+bool FrameDeveloper::writeToMemory(void* context, const uint8_t* data, size_t length) {
+    MemorySink* sink = static_cast<MemorySink*>(context);
+    if (sink->used + length > sink->capacity) {
+        return false;
+    }
+    memcpy(sink->data + sink->used, data, length);
+    sink->used += length;
+    return true;
+}
+
+bool FrameDeveloper::writeCounted(void* context, const uint8_t* data, size_t length) {
+    FrameDeveloper* developer = static_cast<FrameDeveloper*>(context);
+    if (!developer->writer(developer->context, data, length)) {
+        return false;
+    }
+    developer->bytesWritten += length;
+    return true;
+}
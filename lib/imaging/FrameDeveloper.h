@@ -0,0 +1,221 @@
+#ifndef RETROLENS_FRAME_DEVELOPER_H
+#define RETROLENS_FRAME_DEVELOPER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "DateStamp.h"
+#include "FilmBorder.h"
+#include "FilmProcess.h"
+#include "ImageArena.h"
+#include "JpegTransform.h"
+
+// Stages of a development, in the order they run
+#define DEVELOP_STAGE_LOOK 0      // Film look, the frame is decoded and coded again
+#define DEVELOP_STAGE_TRANSFORM 1 // Turn and crop, DCT blocks moved
+#define DEVELOP_STAGE_STAMP 2     // Date stamp, the blocks under it coded again
+#define DEVELOP_STAGE_BORDER 3    // Film border, coded tiles around the frame
+#define DEVELOP_STAGE_COUNT 4
+
+// Result of a stage that was not asked for, or not reached
+#define DEVELOP_STAGE_SKIPPED -1
+
+// Room for a developed frame kept in memory for the next step, its size over this on top of the frame
+#define DEVELOP_SLACK_DIVISOR 8
+
+// Room for a frame out of the film look, times the frame, grain on a smooth frame codes to a few times its bytes
+#define DEVELOP_LOOK_GROWTH 4
+
+/**
+ * @struct DevelopSettings
+ * @brief What a development does to a frame, each stage is left out when unset.
+ */
+struct DevelopSettings {
+    const FilmProcess* look = nullptr;  ///< Film look, nullptr for none.
+    int rotation = JPEG_ROTATE_0;       ///< One of the JPEG_ROTATE_* values.
+    int crop = JPEG_CROP_FULL;          ///< One of the JPEG_CROP_* values.
+    const char* dateText = nullptr;     ///< Date stamp text, nullptr for no stamp.
+    const char* filmName = nullptr;     ///< Film name on the top rebate, nullptr for no border.
+    const char* frameLabel = "";        ///< Frame label on the bottom rebate.
+};
+
+/**
+ * @struct MemorySink
+ * @brief Output buffer of a JpegWriter that writes to memory.
+ */
+struct MemorySink {
+    uint8_t* data;   ///< Start of the buffer.
+    size_t capacity; ///< Size of the buffer.
+    size_t used;     ///< Bytes written.
+};
+
+/**
+ * @class FrameDeveloper
+ * @brief Develops a saved JPEG frame: film look, turn and crop, date stamp and film border, in that order.
+ *
+ * This is the chain the camera runs on each single frame it saves, kept apart from the SD card
+ * so that a roll copied off the card can be developed again on a computer with the same code.
+ * With the settings of setCameraStages() and an arena of the camera's size, the bytes out are
+ * the camera's. Each stage keeps its output in the ImageArena for the next one, in a buffer of
+ * the size of its input and a slack, and the last stage writes to the writer.
+ *
+ * A stage that fails, or does not find its memory in the arena, is left out and the frame
+ * carries on as it was. If the last stage fails before it wrote anything, the frame of the
+ * stage before it is written instead. write() only fails when there is nothing developed to
+ * write, or when the writer got part of a frame: the caller then writes the frame as shot.
+ *
+ * The film look is the only stage that decodes the pixels, and codes them again with the
+ * quantization tables of the frame. The others move or add coded blocks. The camera never runs
+ * it: its film mode applies the look to the raw frame before it is coded (see RawCaptureService),
+ * so the look of this stage is for frames developed on a computer and does not match the camera.
+ *
+ * Example usage:
+ * @code
+ * DevelopSettings settings;
+ * settings.rotation = JPEG_ROTATE_90;
+ * settings.dateText = "'24 10 19";
+ * FrameDeveloper developer(&arena, art);
+ * if (developer.write(fb->buf, fb->len, settings, writeToFile, &file) != JPEG_OK) {
+ *     // Write the frame as shot
+ * }
+ * @endcode
+ */
+class FrameDeveloper {
+public:
+    /**
+     * @brief Constructor for FrameDeveloper.
+     *
+     * @param arena Memory budget of the development, used from its current mark.
+     * @param art Tiles of the film border, kept by the caller.
+     */
+    FrameDeveloper(ImageArena* arena, const BorderArt& art);
+
+    /**
+     * @brief Check if settings change a frame at all.
+     */
+    static bool isNeeded(const DevelopSettings& settings);
+
+    /**
+     * @brief Set the stages the camera runs on a single frame it saves, the film look is left as it is.
+     *
+     * The camera and the host developer both set their stages here, so a roll developed again
+     * gets the stamp and the edge print the camera gives it.
+     *
+     * @param settings Settings to set.
+     * @param rotation One of the JPEG_ROTATE_* values.
+     * @param crop One of the JPEG_CROP_* values.
+     * @param dateText Date stamp text, nullptr for no stamp.
+     * @param filmName Film name on the border, nullptr for no border.
+     * @param frameNumber Number of the frame on the border.
+     * @param label Buffer of FILM_BORDER_MAX_CHARS for the frame label, kept while the settings are used.
+     */
+    static void setCameraStages(DevelopSettings* settings, int rotation, int crop, const char* dateText,
+                                const char* filmName, unsigned frameNumber, char* label);
+
+    /**
+     * @brief Develop a frame and write it.
+     *
+     * @param data JPEG file, as the camera saves it.
+     * @param length Size of the file.
+     * @param settings Stages to run.
+     * @param writer Output sink, empty.
+     * @param context Context of the writer.
+     * @return int JPEG_OK if a developed frame was written whole, or the error of the last stage that failed.
+     */
+    int write(const uint8_t* data, size_t length, const DevelopSettings& settings, JpegWriter writer, void* context);
+
+    /**
+     * @brief Get the result of a stage in the last write().
+     *
+     * @param stage One of the DEVELOP_STAGE_* values.
+     * @return int JPEG_OK, a JPEG_ERROR_* code or DEVELOP_STAGE_SKIPPED.
+     */
+    int getStageResult(int stage) const;
+
+    /**
+     * @brief Get the name of a stage, for logs.
+     */
+    static const char* getStageName(int stage);
+
+    /**
+     * @brief Get the MCUs the stages coded again in the last write(), the whole frame for a film look.
+     */
+    int getRecodedMcus() const;
+
+    /**
+     * @brief Get the bytes written in the last write().
+     */
+    size_t getBytesWritten() const;
+
+    /**
+     * @brief Get the memory the film look needs from its arena.
+     *
+     * @param width Frame width.
+     * @param subsampling One of the JPEG_SUBSAMPLING_* values.
+     * @return size_t Upper bound in bytes.
+     */
+    static size_t lookBytes(int width, int subsampling);
+
+    /**
+     * @brief JpegWriter that appends to a buffer.
+     *
+     * @param context Pointer to the MemorySink.
+     * @param data Bytes to write.
+     * @param length Number of bytes.
+     * @return true if every byte fit.
+     */
+    static bool writeToMemory(void* context, const uint8_t* data, size_t length);
+
+private:
+    /**
+     * @brief Run a stage on a frame.
+     *
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int runStage(int stage, const uint8_t* data, size_t length, const DevelopSettings& settings, JpegWriter writer,
+                 void* context);
+
+    /**
+     * @brief Decode a frame, apply the film look and code it again with its own tables.
+     */
+    int writeLook(const uint8_t* data, size_t length, const FilmProcess* look, JpegWriter writer, void* context);
+
+    /**
+     * @brief Get the memory a stage needs from the arena, above the frame it reads.
+     */
+    size_t stageBytes(int stage) const;
+
+    /**
+     * @brief Read the size and the sampling of a frame.
+     *
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int probe(const uint8_t* data, size_t length);
+
+    /**
+     * @brief Reserve arena memory for a frame kept for the next stage.
+     *
+     * @param bytes Size of the buffer.
+     * @param keep Arena bytes the stage itself needs above the buffer.
+     * @return MemorySink Empty buffer, without data if the arena is too small.
+     */
+    MemorySink reserveSink(size_t bytes, size_t keep);
+
+    /**
+     * @brief JpegWriter that counts the bytes passed on to the writer of write().
+     */
+    static bool writeCounted(void* context, const uint8_t* data, size_t length);
+
+    ImageArena* arena;                        ///< Memory budget.
+    BorderArt art;                            ///< Tiles of the film border.
+    JpegWriter writer;                        ///< Writer of the last write().
+    void* context;                            ///< Context of that writer.
+    size_t bytesWritten;                      ///< Bytes passed on to that writer.
+    int width;                                ///< Width of the frame as shot.
+    int height;                               ///< Height of the frame as shot.
+    int subsampling;                          ///< Sampling of the frame as shot.
+    int recodedMcus;                          ///< MCUs coded again in the last write().
+    int stageResults[DEVELOP_STAGE_COUNT];    ///< Result of each stage in the last write().
+};
+
+#endif // RETROLENS_FRAME_DEVELOPER_H
@@ -0,0 +1,343 @@
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FrameStacker.h"
+
+// Slack of each arena allocation for its alignment
+#define STACK_ALIGN_SLACK 8
+
+static inline int clampInt(int value, int low, int high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+FrameStacker::FrameStacker(ImageArena* arena)
+    : arena(arena), frameCount(0), stackedCount(0), width(0), height(0), stripHeight(0), windowStrips(0), thumbnailWidth(0),
+      thumbnailHeight(0), rowBytes(0),
+      stripStart(0), stripRows(0) {
+    memset(frames, 0, sizeof(frames));
+    for (int lane = 0; lane < STRIP_LANES; lane++) {
+        accumulators[lane] = nullptr;
+        laneResults[lane] = JPEG_OK;
+    }
+}
+
+int FrameStacker::addFrame(const uint8_t* jpeg, size_t length) {
+    if (frameCount >= STACK_MAX_FRAMES) {
+        return JPEG_ERROR_STATE;
+    }
+    size_t mark = arena->getMark();
+    void* storage = arena->alloc(sizeof(JpegDecoder), alignof(JpegDecoder));
+    if (storage == nullptr) {
+        return JPEG_ERROR_MEMORY;
+    }
+    JpegDecoder* decoder = new (storage) JpegDecoder();
+    int result = decoder->begin(jpeg, length, arena);
+    if (result == JPEG_OK && decoder->getComponentCount() != JPEG_MAX_COMPONENTS) {
+        result = JPEG_ERROR_UNSUPPORTED;
+    }
+    if (result == JPEG_OK && frameCount > 0) {
+        const JpegDecoder* reference = frames[0].decoder;
+        if (decoder->getWidth() != width || decoder->getHeight() != height ||
+            decoder->getSubsampling() != reference->getSubsampling()) {
+            result = JPEG_ERROR_UNSUPPORTED;
+        }
+    }
+    if (result != JPEG_OK) {
+        arena->release(mark);
+        return result;
+    }
+
+    if (frameCount == 0) {
+        width = decoder->getWidth();
+        height = decoder->getHeight();
+        stripHeight = decoder->getStripHeight();
+        rowBytes = (size_t) width * JPEG_YCC_BYTES;
+        // The strips a shifted row can come from, around the strip being built
+        windowStrips = 1 + 2 * ((STACK_MAX_SHIFT + stripHeight - 1) / stripHeight);
+        thumbnailWidth = decoder->getThumbnailWidth();
+        thumbnailHeight = decoder->getThumbnailHeight();
+    }
+
+    StackFrame* frame = &frames[frameCount];
+    frame->decoder = decoder;
+    frame->window = static_cast<uint8_t*>(arena->alloc(rowBytes * stripHeight * windowStrips));
+    if (frame->window == nullptr) {
+        arena->release(mark);
+        return JPEG_ERROR_MEMORY;
+    }
+    frame->decodedStrips = 0;
+    frame->shiftX = 0;
+    frame->shiftY = 0;
+    frame->used = frameCount == 0;
+
+    frame->thumbnail = static_cast<uint8_t*>(arena->alloc((size_t) thumbnailWidth * thumbnailHeight));
+    if (frame->thumbnail == nullptr) {
+        arena->release(mark);
+        return JPEG_ERROR_MEMORY;
+    }
+    result = decoder->decodeThumbnail(frame->thumbnail);
+    if (result != JPEG_OK) {
+        arena->release(mark);
+        return result;
+    }
+
+    frameCount++;
+    return JPEG_OK;
+}
+
+uint32_t FrameStacker::thumbnailCost(const uint8_t* thumbnail, int offsetX, int offsetY) const {
+    // The frame content sits at reference + offset, the reference is sampled between its blocks in 1/8
+    const uint8_t* reference = frames[0].thumbnail;
+    int margin = STACK_SEARCH_BLOCKS + 1;
+    uint32_t cost = 0;
+    for (int y = margin; y < thumbnailHeight - margin; y++) {
+        int positionY = 8 * y - offsetY;
+        int fractionY = positionY & 7;
+        const uint8_t* top = reference + (size_t) (positionY >> 3) * thumbnailWidth;
+        const uint8_t* bottom = top + thumbnailWidth;
+        const uint8_t* samples = thumbnail + (size_t) y * thumbnailWidth;
+        for (int x = margin; x < thumbnailWidth - margin; x++) {
+            int positionX = 8 * x - offsetX;
+            int fractionX = positionX & 7;
+            int index = positionX >> 3;
+            int upper = top[index] * (8 - fractionX) + top[index + 1] * fractionX;
+            int lower = bottom[index] * (8 - fractionX) + bottom[index + 1] * fractionX;
+            int difference = samples[x] * 64 - (upper * (8 - fractionY) + lower * fractionY);
+            cost += difference < 0 ? -difference : difference;
+        }
+    }
+    return cost;
+}
+
+void FrameStacker::estimateShift(StackFrame* frame) {
+    frame->shiftX = 0;
+    frame->shiftY = 0;
+    if (thumbnailWidth <= 2 * (STACK_SEARCH_BLOCKS + 1) || thumbnailHeight <= 2 * (STACK_SEARCH_BLOCKS + 1)) {
+        return;
+    }
+
+    // Whole blocks first
+    uint32_t bestCost = UINT32_MAX;
+    for (int blockY = -STACK_SEARCH_BLOCKS; blockY <= STACK_SEARCH_BLOCKS; blockY++) {
+        for (int blockX = -STACK_SEARCH_BLOCKS; blockX <= STACK_SEARCH_BLOCKS; blockX++) {
+            uint32_t cost = thumbnailCost(frame->thumbnail, 8 * blockX, 8 * blockY);
+            if (cost < bestCost) {
+                bestCost = cost;
+                frame->shiftX = 8 * blockX;
+                frame->shiftY = 8 * blockY;
+            }
+        }
+    }
+
+    // Then each axis to the pixel, within a block of the coarse match
+    const int limit = 8 * STACK_SEARCH_BLOCKS;
+    for (int pass = 0; pass < 2; pass++) {
+        for (int axis = 0; axis < 2; axis++) {
+            int* shift = axis == 0 ? &frame->shiftX : &frame->shiftY;
+            int center = *shift;
+            for (int offset = center - 7; offset <= center + 7; offset++) {
+                if (offset == center || offset < -limit || offset > limit) {
+                    continue;
+                }
+                uint32_t cost = axis == 0 ? thumbnailCost(frame->thumbnail, offset, frame->shiftY)
+                                          : thumbnailCost(frame->thumbnail, frame->shiftX, offset);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    *shift = offset;
+                }
+            }
+        }
+    }
+}
+
+int FrameStacker::align() {
+    if (frameCount == 0) {
+        return JPEG_ERROR_STATE;
+    }
+    stackedCount = 1;
+    for (int i = 1; i < frameCount; i++) {
+        StackFrame* frame = &frames[i];
+        estimateShift(frame);
+        frame->used = frame->shiftX >= -STACK_MAX_SHIFT && frame->shiftX <= STACK_MAX_SHIFT &&
+                      frame->shiftY >= -STACK_MAX_SHIFT && frame->shiftY <= STACK_MAX_SHIFT;
+        if (frame->used) {
+            stackedCount++;
+        }
+    }
+    return JPEG_OK;
+}
+
+int FrameStacker::decodeUntil(StackFrame* frame, int row) {
+    int lastStrip = row / stripHeight;
+    while (frame->decodedStrips <= lastStrip) {
+        uint8_t* strip = frame->window + (size_t) (frame->decodedStrips % windowStrips) * stripHeight * rowBytes;
+        int result = frame->decoder->decodeStrip(strip, rowBytes);
+        if (result != JPEG_OK) {
+            return result;
+        }
+        frame->decodedStrips++;
+    }
+    return JPEG_OK;
+}
+
+void FrameStacker::accumulate(const StackFrame* frame, uint16_t* accumulator) {
+    // Sample the frame at the reference position plus its shift, repeating the edges
+    int firstX = clampInt(-frame->shiftX, 0, width);
+    int lastX = clampInt(width - frame->shiftX, firstX, width);
+    for (int i = 0; i < stripRows; i++) {
+        int row = clampInt(stripStart + i + frame->shiftY, 0, height - 1);
+        const uint8_t* source = frame->window + ((size_t) ((row / stripHeight) % windowStrips) * stripHeight + row % stripHeight) * rowBytes;
+        uint16_t* sums = accumulator + (size_t) i * rowBytes;
+        const uint8_t* left = source;
+        for (int x = 0; x < firstX; x++) {
+            sums[0] += left[0];
+            sums[1] += left[1];
+            sums[2] += left[2];
+            sums += JPEG_YCC_BYTES;
+        }
+        const uint8_t* samples = source + (size_t) (firstX + frame->shiftX) * JPEG_YCC_BYTES;
+        for (size_t n = (size_t) (lastX - firstX) * JPEG_YCC_BYTES; n > 0; n--) {
+            *sums++ += *samples++;
+        }
+        const uint8_t* right = source + (size_t) (width - 1) * JPEG_YCC_BYTES;
+        for (int x = lastX; x < width; x++) {
+            sums[0] += right[0];
+            sums[1] += right[1];
+            sums[2] += right[2];
+            sums += JPEG_YCC_BYTES;
+        }
+    }
+}
+
+void FrameStacker::laneJob(void* arg, int lane) {
+    FrameStacker* stacker = static_cast<FrameStacker*>(arg);
+    uint16_t* accumulator = stacker->accumulators[lane];
+    memset(accumulator, 0, sizeof(uint16_t) * stacker->rowBytes * stacker->stripRows);
+    int lastRow = clampInt(stacker->stripStart + stacker->stripRows - 1 + STACK_MAX_SHIFT, 0, stacker->height - 1);
+    int used = 0;
+    for (int i = 0; i < stacker->frameCount; i++) {
+        StackFrame* frame = &stacker->frames[i];
+        if (!frame->used) {
+            continue;
+        }
+        // Frames are dealt to the lanes in turn
+        if (used++ % STRIP_LANES != lane) {
+            continue;
+        }
+        int result = stacker->decodeUntil(frame, lastRow);
+        if (result != JPEG_OK) {
+            stacker->laneResults[lane] = result;
+            return;
+        }
+        stacker->accumulate(frame, accumulator);
+    }
+    stacker->laneResults[lane] = JPEG_OK;
+}
+
+int FrameStacker::write(JpegWriter writer, void* context, StripRunner* runner) {
+    if (frameCount == 0 || stackedCount == 0) {
+        return JPEG_ERROR_STATE;
+    }
+    SerialStripRunner serialRunner;
+    if (runner == nullptr) {
+        runner = &serialRunner;
+    }
+    size_t mark = arena->getMark();
+    size_t stripBytes = rowBytes * stripHeight;
+    for (int lane = 0; lane < STRIP_LANES; lane++) {
+        accumulators[lane] = static_cast<uint16_t*>(arena->alloc(sizeof(uint16_t) * stripBytes));
+    }
+    uint8_t* output = static_cast<uint8_t*>(arena->alloc(stripBytes));
+    void* storage = arena->alloc(sizeof(JpegEncoder), alignof(JpegEncoder));
+    bool allocated = output != nullptr && storage != nullptr;
+    for (int lane = 0; lane < STRIP_LANES; lane++) {
+        allocated = allocated && accumulators[lane] != nullptr;
+    }
+    if (!allocated) {
+        arena->release(mark);
+        return JPEG_ERROR_MEMORY;
+    }
+
+    for (int i = 0; i < frameCount; i++) {
+        if (frames[i].decodedStrips > 0) {
+            frames[i].decoder->rewind();
+            frames[i].decodedStrips = 0;
+        }
+    }
+
+    // Re-encoded once with the tables of the reference frame
+    const JpegDecoder* reference = frames[0].decoder;
+    JpegEncoder* encoder = new (storage) JpegEncoder();
+    int result = encoder->begin(width, height, reference->getSubsampling(), reference->getQuantTable(0),
+                                reference->getQuantTable(1), writer, context, reference->getRestartInterval());
+
+    // Mean of the sums, 16 bit fixed-point reciprocal
+    uint32_t reciprocal = (65536 + stackedCount / 2) / stackedCount;
+    for (stripStart = 0; result == JPEG_OK && stripStart < height; stripStart += stripHeight) {
+        stripRows = height - stripStart < stripHeight ? height - stripStart : stripHeight;
+        runner->run(laneJob, this);
+        for (int lane = 0; lane < STRIP_LANES && result == JPEG_OK; lane++) {
+            result = laneResults[lane];
+        }
+        if (result != JPEG_OK) {
+            break;
+        }
+        size_t count = rowBytes * stripRows;
+        for (size_t n = 0; n < count; n++) {
+            uint32_t sum = 0;
+            for (int lane = 0; lane < STRIP_LANES; lane++) {
+                sum += accumulators[lane][n];
+            }
+            uint32_t mean = (sum * reciprocal + 32768) >> 16;
+            output[n] = (uint8_t) (mean > 255 ? 255 : mean);
+        }
+        result = encoder->encodeStrip(output, rowBytes);
+    }
+    if (result == JPEG_OK) {
+        result = encoder->finish();
+    }
+    arena->release(mark);
+    for (int lane = 0; lane < STRIP_LANES; lane++) {
+        accumulators[lane] = nullptr;
+    }
+    return result;
+}
+
+int FrameStacker::getFrameCount() const {
+    return frameCount;
+}
+
+int FrameStacker::getStackedCount() const {
+    return stackedCount;
+}
+
+int FrameStacker::getShiftX(int frame) const {
+    return frames[frame].shiftX;
+}
+
+int FrameStacker::getShiftY(int frame) const {
+    return frames[frame].shiftY;
+}
+
+size_t FrameStacker::requiredBytes(int width, int height, int subsampling, int frames) {
+    int horizontal;
+    int vertical;
+    jpegSamplingFactors(subsampling, &horizontal, &vertical);
+    size_t mcusPerRow = (width + horizontal * 8 - 1) / (horizontal * 8);
+    size_t mcuRows = (height + vertical * 8 - 1) / (vertical * 8);
+    size_t stripHeight = vertical * 8;
+    size_t windowStrips = 1 + 2 * ((STACK_MAX_SHIFT + stripHeight - 1) / stripHeight);
+    size_t rowBytes = (size_t) width * JPEG_YCC_BYTES;
+    size_t thumbnailWidth = mcusPerRow * horizontal;
+    size_t thumbnailHeight = mcuRows * vertical;
+
+    // Per frame: decoder, MCU row planes, strip window and thumbnail
+    size_t planes = mcusPerRow * horizontal * 8 * vertical * 8 + 2 * mcusPerRow * 64;
+    size_t frameBytes = sizeof(JpegDecoder) + planes + rowBytes * stripHeight * windowStrips +
+                        thumbnailWidth * thumbnailHeight + 6 * STACK_ALIGN_SLACK;
+    // While writing: lane accumulators, the output strip and the encoder
+    size_t writeBytes = STRIP_LANES * sizeof(uint16_t) * rowBytes * stripHeight + rowBytes * stripHeight +
+                        sizeof(JpegEncoder) + (STRIP_LANES + 2) * STACK_ALIGN_SLACK;
+    return frames * frameBytes + writeBytes;
+}
@@ -0,0 +1,191 @@
+#ifndef RETROLENS_FRAME_STACKER_H
+#define RETROLENS_FRAME_STACKER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ImageArena.h"
+#include "JpegDecoder.h"
+#include "JpegEncoder.h"
+#include "StripRunner.h"
+
+#define STACK_MAX_FRAMES 4
+
+// Largest translation corrected, in pixels, frames moved further are left out
+#define STACK_MAX_SHIFT 8
+
+// Translation search range on the 1/8 scale thumbnails, in blocks
+#define STACK_SEARCH_BLOCKS 2
+
+/**
+ * @struct StackFrame
+ * @brief A frame of the stack and its decoding state.
+ */
+struct StackFrame {
+    JpegDecoder* decoder;     ///< Strip decoder of the frame.
+    uint8_t* window;          ///< Last decoded strips, a ring of windowStrips strips.
+    int decodedStrips;        ///< Number of strips decoded so far.
+    uint8_t* thumbnail;       ///< Luma block means.
+    int shiftX;               ///< Horizontal offset of the frame content from the reference, in pixels.
+    int shiftY;               ///< Vertical offset of the frame content from the reference, in pixels.
+    bool used;                ///< True if the frame is stacked.
+};
+
+/**
+ * @class FrameStacker
+ * @brief Averages a burst of JPEG frames into one less noisy JPEG, strip by strip within a fixed memory budget.
+ *
+ * Frames are aligned on the first one with a global translation estimated on the DC
+ * thumbnails, 1/8 of the frame size: whole blocks are searched over STACK_SEARCH_BLOCKS, then
+ * each axis is refined to the pixel on the bilinearly interpolated reference. A frame shifted
+ * by more than STACK_MAX_SHIFT is left out.
+ *
+ * Each frame keeps a ring of decoded strips wide enough to cover the shift. Output strips are
+ * built by STRIP_LANES lanes, each decoding and summing its own frames into 16 bit
+ * accumulators, then merged with a fixed-point reciprocal and encoded once with the
+ * quantization tables of the first frame. Every buffer comes from the ImageArena.
+ *
+ * Example usage:
+ * @code
+ * ImageArena arena(psramBlock, STACK_ARENA_BYTES);
+ * FrameStacker stacker(&arena);
+ * for (int i = 0; i < count; i++) {
+ *     stacker.addFrame(frames[i]->buf, frames[i]->len);
+ * }
+ * stacker.align();
+ * stacker.write(writeToFile, &file, &runner);
+ * @endcode
+ */
+class FrameStacker {
+public:
+    /**
+     * @brief Constructor for FrameStacker.
+     *
+     * @param arena Memory budget of the stack, used from its current mark.
+     */
+    FrameStacker(ImageArena* arena);
+
+    /**
+     * @brief Add a frame, the first one is the reference.
+     *
+     * @param jpeg JPEG file, kept by the caller until write() returns.
+     * @param length Size of the file.
+     * @return int JPEG_OK or a JPEG_ERROR_* code, JPEG_ERROR_UNSUPPORTED if the size or sampling differs from the reference.
+     */
+    int addFrame(const uint8_t* jpeg, size_t length);
+
+    /**
+     * @brief Estimate the translation of each frame and pick the frames to stack.
+     *
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int align();
+
+    /**
+     * @brief Decode, average and encode the stack.
+     *
+     * @param writer Output sink.
+     * @param context Context of the writer.
+     * @param runner Runner of the lanes, nullptr to run them serially.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int write(JpegWriter writer, void* context, StripRunner* runner = nullptr);
+
+    /**
+     * @brief Get the number of frames added.
+     */
+    int getFrameCount() const;
+
+    /**
+     * @brief Get the number of frames stacked after align().
+     */
+    int getStackedCount() const;
+
+    /**
+     * @brief Get the estimated horizontal offset of a frame.
+     *
+     * @param frame Frame index.
+     * @return int Offset in pixels.
+     */
+    int getShiftX(int frame) const;
+
+    /**
+     * @brief Get the estimated vertical offset of a frame.
+     *
+     * @param frame Frame index.
+     * @return int Offset in pixels.
+     */
+    int getShiftY(int frame) const;
+
+    /**
+     * @brief Get the memory a stack needs from its arena.
+     *
+     * @param width Frame width.
+     * @param height Frame height.
+     * @param subsampling One of the JPEG_SUBSAMPLING_* values.
+     * @param frames Number of frames.
+     * @return size_t Upper bound in bytes.
+     */
+    static size_t requiredBytes(int width, int height, int subsampling, int frames);
+
+private:
+    /**
+     * @brief Lane work: decode and sum the frames of a lane for the current strip.
+     *
+     * @param arg Pointer to the FrameStacker.
+     * @param lane Lane index.
+     */
+    static void laneJob(void* arg, int lane);
+
+    /**
+     * @brief Estimate the translation of a frame from its thumbnail.
+     *
+     * @param frame Frame to align, its shift is set.
+     */
+    void estimateShift(StackFrame* frame);
+
+    /**
+     * @brief Sum of absolute differences between a thumbnail and the shifted reference thumbnail.
+     *
+     * @param thumbnail Thumbnail of the frame.
+     * @param offsetX Horizontal offset of the frame content, in pixels.
+     * @param offsetY Vertical offset of the frame content, in pixels.
+     * @return uint32_t Cost over the thumbnail interior.
+     */
+    uint32_t thumbnailCost(const uint8_t* thumbnail, int offsetX, int offsetY) const;
+
+    /**
+     * @brief Decode strips of a frame until a row is available.
+     *
+     * @param frame Frame to decode.
+     * @param row Last row needed.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int decodeUntil(StackFrame* frame, int row);
+
+    /**
+     * @brief Add the shifted rows of a frame to an accumulator.
+     *
+     * @param frame Frame to add.
+     * @param accumulator Sums of the output strip.
+     */
+    void accumulate(const StackFrame* frame, uint16_t* accumulator);
+
+    ImageArena* arena;                      ///< Memory budget.
+    StackFrame frames[STACK_MAX_FRAMES];    ///< Frames, the first is the reference.
+    int frameCount;                         ///< Number of frames added.
+    int stackedCount;                       ///< Number of frames stacked.
+    int width;                              ///< Frame width.
+    int height;                             ///< Frame height.
+    int stripHeight;                        ///< Rows of a strip.
+    int windowStrips;                       ///< Strips kept per frame.
+    int thumbnailWidth;                     ///< Thumbnail width, in blocks.
+    int thumbnailHeight;                    ///< Thumbnail height, in blocks.
+    size_t rowBytes;                        ///< Bytes of an interleaved YCbCr row.
+    uint16_t* accumulators[STRIP_LANES];    ///< Sums of each lane.
+    int stripStart;                         ///< First row of the strip being built.
+    int stripRows;                          ///< Rows of the strip being built.
+    int laneResults[STRIP_LANES];           ///< Result of the last lane run.
+};
+
+#endif // RETROLENS_FRAME_STACKER_H
@@ -0,0 +1,33 @@
+#ifndef RETROLENS_GRAIN_TILE_H
+#define RETROLENS_GRAIN_TILE_H
+
+#include <stdint.h>
+
+/**
+ * @struct GrainTile
+ * @brief Blue-noise grain of a film stock, a square tile repeated over the frame.
+ *
+ * Tiles are generated at build time by scripts/grain_to_code.py, from the film stocks in
+ * resources/grain, and kept in flash. The noise is the void-and-cluster ranking of the tile
+ * spread evenly over -127..127, so it has no low frequencies and tiles without seams. The
+ * response scales the grain with the luma of the pixel, one step for each 16 values.
+ *
+ * Plain C, the generated tiles are C sources.
+ */
+typedef struct GrainTile {
+    uint16_t size;           ///< Side in pixels, a power of two.
+    uint16_t strength;       ///< Luma standard deviation at full response, in tenths of a level.
+    const uint8_t* response; ///< Percent of the strength for each 16 luma values, 16 steps.
+    const int8_t* noise;     ///< Noise values, row by row.
+} GrainTile;
+
+/**
+ * @struct GrainTileEntry
+ * @brief Generated tile of a film stock, by the name of its film.
+ */
+typedef struct GrainTileEntry {
+    const char* name;       ///< Film name, the name of the grain file.
+    const GrainTile* tile;  ///< Tile of the film.
+} GrainTileEntry;
+
+#endif // RETROLENS_GRAIN_TILE_H
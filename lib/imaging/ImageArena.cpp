@@ -0,0 +1,48 @@
+#include "ImageArena.h"
+
+ImageArena::ImageArena(void* buffer, size_t capacity)
+    : buffer(static_cast<uint8_t*>(buffer)), capacity(capacity), used(0), highWater(0) {}
+
+void* ImageArena::alloc(size_t size, size_t align) {
+    uintptr_t base = (uintptr_t) buffer;
+    uintptr_t start = (base + used + align - 1) & ~(uintptr_t) (align - 1);
+    size_t end = (size_t) (start - base) + size;
+    if (buffer == nullptr || end > capacity) {
+        return nullptr;
+    }
+    used = end;
+    if (used > highWater) {
+        highWater = used;
+    }
+    return reinterpret_cast<void*>(start);
+}
+
+size_t ImageArena::getMark() const {
+    return used;
+}
+
+void ImageArena::release(size_t mark) {
+    if (mark < used) {
+        used = mark;
+    }
+}
+
+void ImageArena::reset() {
+    used = 0;
+}
+
+void ImageArena::resetHighWater() {
+    highWater = used;
+}
+
+size_t ImageArena::getUsed() const {
+    return used;
+}
+
+size_t ImageArena::getHighWater() const {
+    return highWater;
+}
+
+size_t ImageArena::getCapacity() const {
+    return capacity;
+}
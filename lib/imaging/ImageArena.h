@@ -0,0 +1,90 @@
+#ifndef RETROLENS_IMAGE_ARENA_H
+#define RETROLENS_IMAGE_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @class ImageArena
+ * @brief Fixed memory budget for image processing, handed out by a bump allocator.
+ *
+ * The whole budget is one buffer given at construction, on the camera a PSRAM block reserved
+ * once at boot. Allocations never fail because of fragmentation, only because the budget is
+ * spent, and the high-water mark shows how close a pipeline came to it. Memory is given back
+ * all at once with reset(), or down to a mark taken earlier for scratch space.
+ *
+ * Example usage:
+ * @code
+ * ImageArena arena(buffer, sizeof(buffer));
+ * uint8_t* strip = static_cast<uint8_t*>(arena.alloc(width * 8 * 3));
+ * size_t mark = arena.getMark();
+ * // Scratch allocations
+ * arena.release(mark);
+ * @endcode
+ */
+class ImageArena {
+public:
+    /**
+     * @brief Constructor for ImageArena.
+     *
+     * @param buffer Memory of the budget.
+     * @param capacity Size of the buffer in bytes.
+     */
+    ImageArena(void* buffer, size_t capacity);
+
+    /**
+     * @brief Allocate from the budget.
+     *
+     * @param size Bytes to allocate.
+     * @param align Alignment, a power of two.
+     * @return void* Allocated memory, nullptr if the budget is spent.
+     */
+    void* alloc(size_t size, size_t align = 4);
+
+    /**
+     * @brief Get a mark to release scratch allocations to.
+     *
+     * @return size_t Current use.
+     */
+    size_t getMark() const;
+
+    /**
+     * @brief Give back everything allocated after a mark.
+     *
+     * @param mark Value from getMark().
+     */
+    void release(size_t mark);
+
+    /**
+     * @brief Give back everything. The high-water mark is kept.
+     */
+    void reset();
+
+    /**
+     * @brief Forget the high-water mark.
+     */
+    void resetHighWater();
+
+    /**
+     * @brief Get the bytes in use.
+     */
+    size_t getUsed() const;
+
+    /**
+     * @brief Get the largest use since construction or resetHighWater().
+     */
+    size_t getHighWater() const;
+
+    /**
+     * @brief Get the size of the budget.
+     */
+    size_t getCapacity() const;
+
+private:
+    uint8_t* buffer;  ///< Memory of the budget.
+    size_t capacity;  ///< Size of the budget.
+    size_t used;      ///< Bytes in use.
+    size_t highWater; ///< Largest use.
+};
+
+#endif // RETROLENS_IMAGE_ARENA_H
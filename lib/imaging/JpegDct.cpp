@@ -0,0 +1,175 @@
+#include "JpegDct.h"
+
+// COSINES[u][x] = C(u) / 2 * cos((2x + 1) u pi / 16) in 1/8192, C(0) = 1 / sqrt(2)
+static const int32_t COSINES[8][8] = {
+    { 2896,  2896,  2896,  2896,  2896,  2896,  2896,  2896},
+    { 4017,  3406,  2276,   799,  -799, -2276, -3406, -4017},
+    { 3784,  1567, -1567, -3784, -3784, -1567,  1567,  3784},
+    { 3406,  -799, -4017, -2276,  2276,  4017,   799, -3406},
+    { 2896, -2896, -2896,  2896,  2896, -2896, -2896,  2896},
+    { 2276, -4017,   799,  3406, -3406,  -799,  4017, -2276},
+    { 1567, -3784,  3784, -1567, -1567,  3784, -3784,  1567},
+    {  799, -2276,  3406, -4017,  4017, -3406,  2276,  -799},
+};
+
+// The first pass keeps two extra bits of precision
+#define COSINE_BITS 13
+#define PASS1_SHIFT (COSINE_BITS - 2)
+#define PASS2_SHIFT (COSINE_BITS + 2)
+
+// AAN constants in 1/8192
+#define AAN_BITS 13
+#define AAN_0_382683433 3135
+#define AAN_0_541196100 4433
+#define AAN_0_707106781 5793
+#define AAN_1_306562965 10703
+
+// Three extra bits of the samples through both passes, rounded off at the end
+#define AAN_EXTRA_BITS 3
+
+// 1 / (8 * scale(u) * scale(v)) in 1/2^22, scale(0) = 1 and scale(k) = sqrt(2) cos(k pi / 16)
+#define AAN_DESCALE_BITS 22
+static const uint32_t AAN_DESCALE[64] = {
+     524288,  377991,  401273,  445870,  524288,  667292,  968758, 1900287,
+     377991,  272516,  289301,  321455,  377991,  481091,  698436, 1370031,
+     401273,  289301,  307121,  341254,  401273,  510723,  741455, 1454417,
+     445870,  321455,  341254,  379182,  445870,  567485,  823861, 1616061,
+     524288,  377991,  401273,  445870,  524288,  667292,  968758, 1900287,
+     667292,  481091,  510723,  567485,  667292,  849302, 1232995, 2418607,
+     968758,  698436,  741455,  823861,  968758, 1232995, 1790031, 3511273,
+    1900287, 1370031, 1454417, 1616061, 1900287, 2418607, 3511273, 6887609,
+};
+
+static inline int32_t aanMultiply(int32_t value, int32_t constant) {
+    return (value * constant + (1 << (AAN_BITS - 1))) >> AAN_BITS;
+}
+
+// One row or column of the AAN transform, in place, elements step apart
+static inline void aanPass(int32_t* data, int step) {
+    int32_t tmp0 = data[0] + data[7 * step];
+    int32_t tmp7 = data[0] - data[7 * step];
+    int32_t tmp1 = data[step] + data[6 * step];
+    int32_t tmp6 = data[step] - data[6 * step];
+    int32_t tmp2 = data[2 * step] + data[5 * step];
+    int32_t tmp5 = data[2 * step] - data[5 * step];
+    int32_t tmp3 = data[3 * step] + data[4 * step];
+    int32_t tmp4 = data[3 * step] - data[4 * step];
+
+    // Even part
+    int32_t tmp10 = tmp0 + tmp3;
+    int32_t tmp13 = tmp0 - tmp3;
+    int32_t tmp11 = tmp1 + tmp2;
+    int32_t tmp12 = tmp1 - tmp2;
+    data[0] = tmp10 + tmp11;
+    data[4 * step] = tmp10 - tmp11;
+    int32_t z1 = aanMultiply(tmp12 + tmp13, AAN_0_707106781);
+    data[2 * step] = tmp13 + z1;
+    data[6 * step] = tmp13 - z1;
+
+    // Odd part
+    tmp10 = tmp4 + tmp5;
+    tmp11 = tmp5 + tmp6;
+    tmp12 = tmp6 + tmp7;
+    int32_t z5 = aanMultiply(tmp10 - tmp12, AAN_0_382683433);
+    int32_t z2 = aanMultiply(tmp10, AAN_0_541196100) + z5;
+    int32_t z4 = aanMultiply(tmp12, AAN_1_306562965) + z5;
+    int32_t z3 = aanMultiply(tmp11, AAN_0_707106781);
+    int32_t z11 = tmp7 + z3;
+    int32_t z13 = tmp7 - z3;
+    data[5 * step] = z13 + z2;
+    data[3 * step] = z13 - z2;
+    data[step] = z11 + z4;
+    data[7 * step] = z11 - z4;
+}
+
+// Both passes of the AAN transform, the output keeps the extra bits
+static void aanTransform(const uint8_t* samples, size_t stride, int32_t* data) {
+    for (int y = 0; y < 8; y++) {
+        const uint8_t* row = samples + y * stride;
+        int32_t* out = data + y * 8;
+        for (int x = 0; x < 8; x++) {
+            out[x] = ((int32_t) row[x] - 128) * (1 << AAN_EXTRA_BITS);
+        }
+        aanPass(out, 1);
+    }
+    for (int u = 0; u < 8; u++) {
+        aanPass(data + u, 8);
+    }
+}
+
+void jpegForwardDctScaled(const uint8_t* samples, size_t stride, int16_t* scaled) {
+    int32_t data[64];
+    aanTransform(samples, stride, data);
+    for (int i = 0; i < 64; i++) {
+        scaled[i] = (int16_t) ((data[i] + (1 << (AAN_EXTRA_BITS - 1))) >> AAN_EXTRA_BITS);
+    }
+}
+
+void jpegForwardDct(const uint8_t* samples, size_t stride, int16_t* coefficients) {
+    int32_t data[64];
+    aanTransform(samples, stride, data);
+    const int shift = AAN_DESCALE_BITS + AAN_EXTRA_BITS;
+    const int64_t half = (int64_t) 1 << (shift - 1);
+    for (int i = 0; i < 64; i++) {
+        int64_t value = (int64_t) data[i] * AAN_DESCALE[i];
+        coefficients[i] = (int16_t) (value < 0 ? -((-value + half) >> shift) : (value + half) >> shift);
+    }
+}
+
+void jpegQuantReciprocals(const uint16_t* quant, uint32_t* reciprocals) {
+    // The descale table has 4 more bits than the reciprocals, rounded off after the division
+    const int extraBits = AAN_DESCALE_BITS - JPEG_RECIPROCAL_BITS;
+    for (int i = 0; i < 64; i++) {
+        uint32_t divisor = (uint32_t) quant[i] << extraBits;
+        reciprocals[i] = (AAN_DESCALE[i] + divisor / 2) / divisor;
+    }
+}
+
+void jpegQuantizeScaled(const int16_t* scaled, const uint32_t* reciprocals, int16_t* quantized) {
+    // |scaled| * reciprocal is the coefficient over its divisor in 1/2^18, below 2^29
+    const uint32_t half = 1u << (JPEG_RECIPROCAL_BITS - 1);
+    for (int i = 0; i < 64; i++) {
+        int32_t value = scaled[i];
+        if (value < 0) {
+            quantized[i] = (int16_t) -(int32_t) (((uint32_t) -value * reciprocals[i] + half) >> JPEG_RECIPROCAL_BITS);
+        } else {
+            quantized[i] = (int16_t) (((uint32_t) value * reciprocals[i] + half) >> JPEG_RECIPROCAL_BITS);
+        }
+    }
+}
+
+void jpegInverseDct(const int16_t* coefficients, uint8_t* samples, size_t stride) {
+    int32_t columns[64];
+    for (int u = 0; u < 8; u++) {
+        // Columns of only a DC term are common, they are flat
+        bool acZero = true;
+        for (int v = 1; v < 8 && acZero; v++) {
+            acZero = coefficients[v * 8 + u] == 0;
+        }
+        if (acZero) {
+            int32_t flat = (coefficients[u] * COSINES[0][0] + (1 << (PASS1_SHIFT - 1))) >> PASS1_SHIFT;
+            for (int y = 0; y < 8; y++) {
+                columns[y * 8 + u] = flat;
+            }
+            continue;
+        }
+        for (int y = 0; y < 8; y++) {
+            int32_t sum = 0;
+            for (int v = 0; v < 8; v++) {
+                sum += coefficients[v * 8 + u] * COSINES[v][y];
+            }
+            columns[y * 8 + u] = (sum + (1 << (PASS1_SHIFT - 1))) >> PASS1_SHIFT;
+        }
+    }
+    for (int y = 0; y < 8; y++) {
+        uint8_t* row = samples + y * stride;
+        for (int x = 0; x < 8; x++) {
+            int32_t sum = 0;
+            for (int u = 0; u < 8; u++) {
+                sum += columns[y * 8 + u] * COSINES[u][x];
+            }
+            int32_t value = ((sum + (1 << (PASS2_SHIFT - 1))) >> PASS2_SHIFT) + 128;
+            row[x] = (uint8_t) (value < 0 ? 0 : (value > 255 ? 255 : value));
+        }
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef RETROLENS_JPEG_DCT_H
+#define RETROLENS_JPEG_DCT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Dequantized coefficients are clamped to this range, wide enough for any valid 8 bit image
+#define JPEG_COEFFICIENT_LIMIT 2048
+
+// Reciprocals of the quantization divisors are in 1/2^JPEG_RECIPROCAL_BITS
+#define JPEG_RECIPROCAL_BITS 18
+
+/**
+ * @brief Forward 8x8 DCT of a block of samples.
+ *
+ * The scaled transform below, descaled, within one of the exact DCT for 8 bit samples.
+ *
+ * @param samples Top-left sample of the block.
+ * @param stride Distance between rows, in samples.
+ * @param coefficients Output coefficients, natural order, unquantized.
+ */
+void jpegForwardDct(const uint8_t* samples, size_t stride, int16_t* coefficients);
+
+/**
+ * @brief Forward 8x8 DCT of a block of samples, leaving out the scale of each coefficient.
+ *
+ * Arai-Agui-Nakajima transform in fixed point: 5 multiplications a row or column instead of
+ * 64, the scale of each output is folded into the quantization by jpegQuantReciprocals().
+ *
+ * @param samples Top-left sample of the block.
+ * @param stride Distance between rows, in samples.
+ * @param scaled Output coefficients, natural order, times 8 and the AAN scale of their row and column.
+ */
+void jpegForwardDctScaled(const uint8_t* samples, size_t stride, int16_t* scaled);
+
+/**
+ * @brief Get the multipliers that quantize the output of jpegForwardDctScaled().
+ *
+ * @param quant Quantization divisors, natural order, 1 to 255.
+ * @param reciprocals Output multipliers in 1/2^JPEG_RECIPROCAL_BITS, scale of the transform included.
+ */
+void jpegQuantReciprocals(const uint16_t* quant, uint32_t* reciprocals);
+
+/**
+ * @brief Quantize the output of jpegForwardDctScaled(), rounding to nearest.
+ *
+ * @param scaled Coefficients of jpegForwardDctScaled().
+ * @param reciprocals Multipliers of jpegQuantReciprocals().
+ * @param quantized Output quantized coefficients, natural order.
+ */
+void jpegQuantizeScaled(const int16_t* scaled, const uint32_t* reciprocals, int16_t* quantized);
+
+/**
+ * @brief Inverse 8x8 DCT of a block of dequantized coefficients.
+ *
+ * @param coefficients Dequantized coefficients, natural order, within JPEG_COEFFICIENT_LIMIT.
+ * @param samples Top-left output sample.
+ * @param stride Distance between rows, in samples.
+ */
+void jpegInverseDct(const int16_t* coefficients, uint8_t* samples, size_t stride);
+
+#endif // RETROLENS_JPEG_DCT_H
@@ -0,0 +1,681 @@
+#include <string.h>
+
+#include "JpegDct.h"
+#include "JpegDecoder.h"
+
+// Marker codes
+#define MARKER_SOF0 0xC0
+#define MARKER_SOF1 0xC1
+#define MARKER_DHT 0xC4
+#define MARKER_RST0 0xD0
+#define MARKER_SOI 0xD8
+#define MARKER_EOI 0xD9
+#define MARKER_SOS 0xDA
+#define MARKER_DQT 0xDB
+#define MARKER_DRI 0xDD
+
+static inline uint16_t readBigEndian16(const uint8_t* bytes) {
+    return (uint16_t) ((bytes[0] << 8) | bytes[1]);
+}
+
+// Sign-extend a received magnitude of a category, T.81 F.2.2.1
+static inline int32_t extend(uint32_t value, int category) {
+    return value < (1u << (category - 1)) ? (int32_t) value - (1 << category) + 1 : (int32_t) value;
+}
+
+static inline int16_t clampCoefficient(int32_t value) {
+    if (value > JPEG_COEFFICIENT_LIMIT - 1) {
+        return JPEG_COEFFICIENT_LIMIT - 1;
+    }
+    if (value < -JPEG_COEFFICIENT_LIMIT) {
+        return -JPEG_COEFFICIENT_LIMIT;
+    }
+    return (int16_t) value;
+}
+
+JpegDecoder::JpegDecoder()
+    : data(nullptr), length(0), scanStart(0), position(0), bitBuffer(0), bitCount(0), markerReached(false), paddingBytes(0),
+      width(0), height(0), componentCount(0), maxHorizontal(1), maxVertical(1), mcusPerRow(0), mcuRows(0), nextStrip(0),
+      restartInterval(0), mcusToRestart(0), nextRestart(0) {
+    memset(components, 0, sizeof(components));
+    memset(quantTables, 0, sizeof(quantTables));
+    for (int i = 0; i < 4; i++) {
+        dcTables[i].defined = false;
+        acTables[i].defined = false;
+    }
+}
+
+int JpegDecoder::begin(const uint8_t* data, size_t length, ImageArena* arena) {
+    this->data = data;
+    this->length = length;
+    int result = parseHeaders();
+    if (result != JPEG_OK) {
+        this->data = nullptr;
+        return result;
+    }
+
+    // Sample planes of one MCU row, none when only coefficients are read
+    for (int i = 0; i < componentCount; i++) {
+        JpegComponent* component = &components[i];
+        component->planeStride = (size_t) mcusPerRow * component->horizontal * 8;
+        component->plane = nullptr;
+        if (arena == nullptr) {
+            continue;
+        }
+        component->plane = static_cast<uint8_t*>(arena->alloc(component->planeStride * component->vertical * 8));
+        if (component->plane == nullptr) {
+            this->data = nullptr;
+            return JPEG_ERROR_MEMORY;
+        }
+    }
+    resetScan();
+    return JPEG_OK;
+}
+
+int JpegDecoder::rewind() {
+    if (data == nullptr) {
+        return JPEG_ERROR_STATE;
+    }
+    resetScan();
+    return JPEG_OK;
+}
+
+int JpegDecoder::parseHeaders() {
+    if (length < 4 || data[0] != 0xFF || data[1] != MARKER_SOI) {
+        return JPEG_ERROR_FORMAT;
+    }
+    width = 0;
+    height = 0;
+    componentCount = 0;
+    restartInterval = 0;
+    size_t offset = 2;
+    while (offset + 4 <= length) {
+        if (data[offset] != 0xFF) {
+            return JPEG_ERROR_FORMAT;
+        }
+        uint8_t marker = data[offset + 1];
+        if (marker == 0xFF) {
+            // Fill byte
+            offset++;
+            continue;
+        }
+        if (marker == MARKER_EOI) {
+            return JPEG_ERROR_FORMAT;
+        }
+        size_t segmentLength = readBigEndian16(data + offset + 2);
+        if (segmentLength < 2 || offset + 2 + segmentLength > length) {
+            return JPEG_ERROR_FORMAT;
+        }
+        const uint8_t* segment = data + offset + 4;
+        size_t size = segmentLength - 2;
+        offset += 2 + segmentLength;
+
+        int result = JPEG_OK;
+        switch (marker) {
+            case MARKER_SOF0:
+            case MARKER_SOF1: {
+                if (size < 6 || segment[0] != 8) {
+                    return JPEG_ERROR_UNSUPPORTED;
+                }
+                height = readBigEndian16(segment + 1);
+                width = readBigEndian16(segment + 3);
+                componentCount = segment[5];
+                if (width == 0 || height == 0 || (componentCount != 1 && componentCount != 3)) {
+                    return JPEG_ERROR_UNSUPPORTED;
+                }
+                if (size < 6 + 3 * (size_t) componentCount) {
+                    return JPEG_ERROR_FORMAT;
+                }
+                maxHorizontal = 1;
+                maxVertical = 1;
+                for (int i = 0; i < componentCount; i++) {
+                    JpegComponent* component = &components[i];
+                    component->id = segment[6 + 3 * i];
+                    component->horizontal = segment[7 + 3 * i] >> 4;
+                    component->vertical = segment[7 + 3 * i] & 0x0F;
+                    component->quantTable = segment[8 + 3 * i] & 0x03;
+                    if (component->horizontal > maxHorizontal) {
+                        maxHorizontal = component->horizontal;
+                    }
+                    if (component->vertical > maxVertical) {
+                        maxVertical = component->vertical;
+                    }
+                }
+                if (componentCount == 1) {
+                    // A single component scan is not interleaved, its MCU is one block
+                    components[0].horizontal = 1;
+                    components[0].vertical = 1;
+                    maxHorizontal = 1;
+                    maxVertical = 1;
+                } else {
+                    // Luma at 1x1, 2x1, 1x2 or 2x2, chroma at 1x1
+                    bool lumaValid = components[0].horizontal >= 1 && components[0].horizontal <= 2 &&
+                                     components[0].vertical >= 1 && components[0].vertical <= 2;
+                    for (int i = 1; i < componentCount; i++) {
+                        lumaValid = lumaValid && components[i].horizontal == 1 && components[i].vertical == 1;
+                    }
+                    if (!lumaValid) {
+                        return JPEG_ERROR_UNSUPPORTED;
+                    }
+                }
+                mcusPerRow = (width + maxHorizontal * 8 - 1) / (maxHorizontal * 8);
+                mcuRows = (height + maxVertical * 8 - 1) / (maxVertical * 8);
+                break;
+            }
+            case MARKER_DHT:
+                result = parseHuffman(segment, size);
+                break;
+            case MARKER_DQT:
+                result = parseQuant(segment, size);
+                break;
+            case MARKER_DRI:
+                if (size < 2) {
+                    return JPEG_ERROR_FORMAT;
+                }
+                restartInterval = readBigEndian16(segment);
+                break;
+            case MARKER_SOS: {
+                if (componentCount == 0 || size < 1 || segment[0] != componentCount || size < 4 + 2 * (size_t) componentCount) {
+                    return componentCount == 0 ? JPEG_ERROR_FORMAT : JPEG_ERROR_UNSUPPORTED;
+                }
+                for (int i = 0; i < componentCount; i++) {
+                    uint8_t id = segment[1 + 2 * i];
+                    uint8_t tables = segment[2 + 2 * i];
+                    int index = -1;
+                    for (int j = 0; j < componentCount; j++) {
+                        if (components[j].id == id) {
+                            index = j;
+                        }
+                    }
+                    if (index != i) {
+                        // Scan order different from the frame order
+                        return JPEG_ERROR_UNSUPPORTED;
+                    }
+                    components[i].dcTable = (tables >> 4) & 0x03;
+                    components[i].acTable = tables & 0x03;
+                    if (!dcTables[components[i].dcTable].defined || !acTables[components[i].acTable].defined) {
+                        return JPEG_ERROR_FORMAT;
+                    }
+                }
+                scanStart = offset;
+                return JPEG_OK;
+            }
+            default:
+                if ((marker >= 0xC2 && marker <= 0xCF && marker != MARKER_DHT) || marker == 0xC8) {
+                    // Progressive, lossless, hierarchical or arithmetic
+                    return JPEG_ERROR_UNSUPPORTED;
+                }
+                // APPn, COM and others are skipped
+                break;
+        }
+        if (result != JPEG_OK) {
+            return result;
+        }
+    }
+    return JPEG_ERROR_FORMAT;
+}
+
+int JpegDecoder::parseHuffman(const uint8_t* segment, size_t size) {
+    size_t offset = 0;
+    while (offset < size) {
+        if (offset + 17 > size) {
+            return JPEG_ERROR_FORMAT;
+        }
+        uint8_t classAndIndex = segment[offset];
+        const uint8_t* counts = segment + offset + 1;
+        int total = 0;
+        for (int i = 0; i < 16; i++) {
+            total += counts[i];
+        }
+        if (total > 256 || offset + 17 + total > size || (classAndIndex & 0x0F) > 3) {
+            return JPEG_ERROR_FORMAT;
+        }
+        JpegHuffmanTable* table = (classAndIndex >> 4) != 0 ? &acTables[classAndIndex & 0x03] : &dcTables[classAndIndex & 0x03];
+        memcpy(table->values, segment + offset + 17, total);
+        memcpy(table->counts, counts, sizeof(table->counts));
+        memset(table->lookupLength, 0, sizeof(table->lookupLength));
+
+        // Canonical codes, T.81 Annex C
+        int32_t code = 0;
+        int index = 0;
+        for (int bits = 1; bits <= 16; bits++) {
+            table->valueOffset[bits] = index - code;
+            for (int i = 0; i < counts[bits - 1]; i++) {
+                if (bits <= JPEG_HUFFMAN_LOOKUP_BITS) {
+                    int shift = JPEG_HUFFMAN_LOOKUP_BITS - bits;
+                    for (int fill = 0; fill < (1 << shift); fill++) {
+                        table->lookupLength[(code << shift) | fill] = (uint8_t) bits;
+                        table->lookupValue[(code << shift) | fill] = table->values[index];
+                    }
+                }
+                code++;
+                index++;
+            }
+            table->maxCode[bits] = counts[bits - 1] > 0 ? code - 1 : -1;
+            if (code > (1 << bits)) {
+                return JPEG_ERROR_FORMAT;
+            }
+            code <<= 1;
+        }
+        table->defined = true;
+        offset += 17 + total;
+    }
+    return JPEG_OK;
+}
+
+int JpegDecoder::parseQuant(const uint8_t* segment, size_t size) {
+    size_t offset = 0;
+    while (offset < size) {
+        uint8_t precisionAndIndex = segment[offset];
+        if ((precisionAndIndex >> 4) != 0) {
+            return JPEG_ERROR_UNSUPPORTED;
+        }
+        if (offset + 1 + JPEG_BLOCK_SIZE > size || (precisionAndIndex & 0x0F) > 3) {
+            return JPEG_ERROR_FORMAT;
+        }
+        uint8_t* table = quantTables[precisionAndIndex & 0x03];
+        for (int i = 0; i < JPEG_BLOCK_SIZE; i++) {
+            table[JPEG_ZIGZAG[i]] = segment[offset + 1 + i];
+        }
+        offset += 1 + JPEG_BLOCK_SIZE;
+    }
+    return JPEG_OK;
+}
+
+void JpegDecoder::resetScan() {
+    position = scanStart;
+    bitBuffer = 0;
+    bitCount = 0;
+    markerReached = false;
+    paddingBytes = 0;
+    mcusToRestart = restartInterval;
+    nextRestart = 0;
+    nextStrip = 0;
+    for (int i = 0; i < componentCount; i++) {
+        components[i].dcPredictor = 0;
+    }
+}
+
+void JpegDecoder::fillBits() {
+    while (bitCount <= 24) {
+        uint32_t byte = 0;
+        if (!markerReached && position < length) {
+            byte = data[position];
+            if (byte == 0xFF) {
+                uint8_t next = position + 1 < length ? data[position + 1] : 0xD9;
+                if (next == 0x00) {
+                    // Stuffed zero
+                    position += 2;
+                } else {
+                    // A marker ends the segment, zeros follow
+                    markerReached = true;
+                    byte = 0;
+                    paddingBytes++;
+                }
+            } else {
+                position++;
+            }
+        } else {
+            paddingBytes++;
+        }
+        bitBuffer |= byte << (24 - bitCount);
+        bitCount += 8;
+    }
+}
+
+uint32_t JpegDecoder::readBits(int count) {
+    if (count == 0) {
+        return 0;
+    }
+    fillBits();
+    uint32_t bits = bitBuffer >> (32 - count);
+    bitBuffer <<= count;
+    bitCount -= count;
+    return bits;
+}
+
+int JpegDecoder::decodeSymbol(const JpegHuffmanTable* table) {
+    fillBits();
+    uint32_t prefix = bitBuffer >> (32 - JPEG_HUFFMAN_LOOKUP_BITS);
+    int bits = table->lookupLength[prefix];
+    if (bits > 0) {
+        bitBuffer <<= bits;
+        bitCount -= bits;
+        return table->lookupValue[prefix];
+    }
+    for (bits = JPEG_HUFFMAN_LOOKUP_BITS + 1; bits <= 16; bits++) {
+        int32_t code = (int32_t) (bitBuffer >> (32 - bits));
+        if (code <= table->maxCode[bits]) {
+            bitBuffer <<= bits;
+            bitCount -= bits;
+            return table->values[(table->valueOffset[bits] + code) & 0xFF];
+        }
+    }
+    return -1;
+}
+
+int JpegDecoder::handleRestart() {
+    if (restartInterval == 0) {
+        return JPEG_OK;
+    }
+    if (mcusToRestart == 0 && readRestartMarker() != JPEG_OK) {
+        return JPEG_ERROR_DATA;
+    }
+    mcusToRestart--;
+    return JPEG_OK;
+}
+
+int JpegDecoder::readRestartMarker() {
+    // Padding bits are dropped, the marker follows the last whole byte
+    bitBuffer = 0;
+    bitCount = 0;
+    markerReached = false;
+    paddingBytes = 0;
+    while (position + 1 < length && !(data[position] == 0xFF && data[position + 1] != 0xFF && data[position + 1] != 0x00)) {
+        position++;
+    }
+    if (position + 1 >= length || data[position + 1] != MARKER_RST0 + nextRestart) {
+        return JPEG_ERROR_DATA;
+    }
+    position += 2;
+    nextRestart = (nextRestart + 1) & 7;
+    mcusToRestart = restartInterval;
+    for (int i = 0; i < componentCount; i++) {
+        components[i].dcPredictor = 0;
+    }
+    return JPEG_OK;
+}
+
+int JpegDecoder::decodeBlock(JpegComponent* component, int16_t* block, bool dequantize) {
+    const uint8_t* quant = quantTables[component->quantTable];
+    int category = decodeSymbol(&dcTables[component->dcTable]);
+    if (category < 0 || category > 11) {
+        return JPEG_ERROR_DATA;
+    }
+    int32_t difference = category > 0 ? extend(readBits(category), category) : 0;
+    component->dcPredictor = (int16_t) (component->dcPredictor + difference);
+    if (block != nullptr) {
+        memset(block, 0, JPEG_BLOCK_SIZE * sizeof(int16_t));
+        block[0] = dequantize ? clampCoefficient(component->dcPredictor * quant[0]) : component->dcPredictor;
+    }
+
+    const JpegHuffmanTable* acTable = &acTables[component->acTable];
+    for (int k = 1; k < JPEG_BLOCK_SIZE;) {
+        int symbol = decodeSymbol(acTable);
+        if (symbol < 0) {
+            return JPEG_ERROR_DATA;
+        }
+        int run = symbol >> 4;
+        int size = symbol & 0x0F;
+        if (size == 0) {
+            if (run != 15) {
+                // End of block
+                break;
+            }
+            k += 16;
+            continue;
+        }
+        k += run;
+        if (k >= JPEG_BLOCK_SIZE) {
+            return JPEG_ERROR_DATA;
+        }
+        int32_t value = extend(readBits(size), size);
+        if (block != nullptr) {
+            int natural = JPEG_ZIGZAG[k];
+            block[natural] = dequantize ? clampCoefficient(value * quant[natural]) : (int16_t) value;
+        }
+        k++;
+    }
+    return JPEG_OK;
+}
+
+int JpegDecoder::decodeStrip(uint8_t* ycc, size_t stride) {
+    if (data == nullptr || components[0].plane == nullptr || nextStrip >= mcuRows) {
+        return JPEG_ERROR_STATE;
+    }
+    int16_t block[JPEG_BLOCK_SIZE];
+    for (int mcu = 0; mcu < mcusPerRow; mcu++) {
+        if (handleRestart() != JPEG_OK) {
+            return JPEG_ERROR_DATA;
+        }
+        for (int i = 0; i < componentCount; i++) {
+            JpegComponent* component = &components[i];
+            for (int by = 0; by < component->vertical; by++) {
+                for (int bx = 0; bx < component->horizontal; bx++) {
+                    if (decodeBlock(component, block) != JPEG_OK) {
+                        return JPEG_ERROR_DATA;
+                    }
+                    uint8_t* samples = component->plane + (size_t) by * 8 * component->planeStride +
+                                       ((size_t) mcu * component->horizontal + bx) * 8;
+                    jpegInverseDct(block, samples, component->planeStride);
+                }
+            }
+        }
+    }
+
+    // Interleave, repeating chroma samples over the luma they cover
+    int rows = height - nextStrip * maxVertical * 8;
+    if (rows > maxVertical * 8) {
+        rows = maxVertical * 8;
+    }
+    int chromaShiftX = maxHorizontal == 2 ? 1 : 0;
+    int chromaShiftY = maxVertical == 2 ? 1 : 0;
+    for (int y = 0; y < rows; y++) {
+        uint8_t* out = ycc + (size_t) y * stride;
+        const uint8_t* luma = components[0].plane + (size_t) y * components[0].planeStride;
+        if (componentCount == 1) {
+            for (int x = 0; x < width; x++) {
+                out[0] = luma[x];
+                out[1] = 128;
+                out[2] = 128;
+                out += JPEG_YCC_BYTES;
+            }
+            continue;
+        }
+        const uint8_t* blue = components[1].plane + (size_t) (y >> chromaShiftY) * components[1].planeStride;
+        const uint8_t* red = components[2].plane + (size_t) (y >> chromaShiftY) * components[2].planeStride;
+        for (int x = 0; x < width; x++) {
+            out[0] = luma[x];
+            out[1] = blue[x >> chromaShiftX];
+            out[2] = red[x >> chromaShiftX];
+            out += JPEG_YCC_BYTES;
+        }
+    }
+    nextStrip++;
+    return JPEG_OK;
+}
+
+int JpegDecoder::decodeMcu(int16_t* coefficients) {
+    if (data == nullptr) {
+        return JPEG_ERROR_STATE;
+    }
+    if (handleRestart() != JPEG_OK) {
+        return JPEG_ERROR_DATA;
+    }
+    for (int i = 0; i < componentCount; i++) {
+        JpegComponent* component = &components[i];
+        for (int block = 0; block < component->horizontal * component->vertical; block++) {
+            if (decodeBlock(component, coefficients, false) != JPEG_OK) {
+                return JPEG_ERROR_DATA;
+            }
+            coefficients += JPEG_BLOCK_SIZE;
+        }
+    }
+    // A transcoder copies the data around the MCU, it must not end in the zeros past the marker
+    if (bitCount < paddingBytes * 8) {
+        return JPEG_ERROR_DATA;
+    }
+    return JPEG_OK;
+}
+
+int JpegDecoder::skipRestartIntervals(int count) {
+    // Either at the start of an interval, or past its last MCU with the marker due
+    if (data == nullptr || restartInterval == 0 || (mcusToRestart != 0 && mcusToRestart != restartInterval)) {
+        return JPEG_ERROR_STATE;
+    }
+    if (mcusToRestart == 0 && readRestartMarker() != JPEG_OK) {
+        return JPEG_ERROR_DATA;
+    }
+    // The entropy-coded data never holds a marker, the next one ends the interval
+    for (int i = 0; i < count; i++) {
+        if (readRestartMarker() != JPEG_OK) {
+            return JPEG_ERROR_DATA;
+        }
+    }
+    return JPEG_OK;
+}
+
+size_t JpegDecoder::getScanPosition(int* bit) const {
+    // The unread bits come from the last bytes fed to the buffer, walk back over them in the file
+    int bufferedBytes = (bitCount + 7) / 8 - paddingBytes;
+    size_t offset = position;
+    for (int i = 0; i < bufferedBytes && offset > scanStart; i++) {
+        bool stuffed = offset >= scanStart + 2 && data[offset - 1] == 0x00 && data[offset - 2] == 0xFF;
+        offset -= stuffed ? 2 : 1;
+    }
+    *bit = bufferedBytes > 0 ? (8 - bitCount % 8) % 8 : 0;
+    return offset;
+}
+
+int JpegDecoder::seekMcu(int index, size_t offset, int bit, const int16_t* dcPredictors) {
+    if (data == nullptr || offset < scanStart || offset > length || bit < 0 || bit > 7) {
+        return JPEG_ERROR_STATE;
+    }
+    position = offset;
+    bitBuffer = 0;
+    bitCount = 0;
+    markerReached = false;
+    paddingBytes = 0;
+    if (restartInterval > 0) {
+        // The first MCU of an interval reads the marker in front of it
+        int interval = index / restartInterval;
+        bool markerDue = index > 0 && index % restartInterval == 0;
+        mcusToRestart = markerDue ? 0 : restartInterval - index % restartInterval;
+        nextRestart = (uint8_t) ((markerDue ? interval - 1 : interval) & 7);
+    }
+    for (int i = 0; i < componentCount; i++) {
+        components[i].dcPredictor = dcPredictors[i];
+    }
+    readBits(bit);
+    return JPEG_OK;
+}
+
+void JpegDecoder::getDcPredictors(int16_t* dcPredictors) const {
+    for (int i = 0; i < componentCount; i++) {
+        dcPredictors[i] = components[i].dcPredictor;
+    }
+}
+
+size_t JpegDecoder::getScanStart() const {
+    return scanStart;
+}
+
+JpegHuffmanSpec JpegDecoder::getHuffmanSpec(int component, bool ac) const {
+    const JpegHuffmanTable* table = ac ? &acTables[components[component].acTable] : &dcTables[components[component].dcTable];
+    JpegHuffmanSpec spec;
+    memcpy(spec.counts, table->counts, sizeof(spec.counts));
+    spec.values = table->values;
+    return spec;
+}
+
+int JpegDecoder::decodeThumbnail(uint8_t* luma) {
+    if (data == nullptr) {
+        return JPEG_ERROR_STATE;
+    }
+    resetScan();
+    int thumbnailWidth = getThumbnailWidth();
+    JpegComponent* lumaComponent = &components[0];
+    int dcScale = quantTables[lumaComponent->quantTable][0];
+    for (int row = 0; row < mcuRows; row++) {
+        for (int mcu = 0; mcu < mcusPerRow; mcu++) {
+            if (handleRestart() != JPEG_OK) {
+                return JPEG_ERROR_DATA;
+            }
+            for (int i = 0; i < componentCount; i++) {
+                JpegComponent* component = &components[i];
+                for (int by = 0; by < component->vertical; by++) {
+                    for (int bx = 0; bx < component->horizontal; bx++) {
+                        if (decodeBlock(component, nullptr) != JPEG_OK) {
+                            return JPEG_ERROR_DATA;
+                        }
+                        if (i == 0) {
+                            // The DC term is 8 times the block mean, level shifted
+                            int32_t mean = (component->dcPredictor * dcScale + 4 * (component->dcPredictor >= 0 ? 1 : -1)) / 8 + 128;
+                            int x = mcu * component->horizontal + bx;
+                            int y = row * component->vertical + by;
+                            luma[(size_t) y * thumbnailWidth + x] = (uint8_t) (mean < 0 ? 0 : (mean > 255 ? 255 : mean));
+                        }
+                    }
+                }
+            }
+        }
+    }
+    resetScan();
+    return JPEG_OK;
+}
+
+int JpegDecoder::getWidth() const {
+    return width;
+}
+
+int JpegDecoder::getHeight() const {
+    return height;
+}
+
+int JpegDecoder::getStripHeight() const {
+    return maxVertical * 8;
+}
+
+int JpegDecoder::getStripCount() const {
+    return mcuRows;
+}
+
+int JpegDecoder::getMcusPerStrip() const {
+    return mcusPerRow;
+}
+
+int JpegDecoder::getMcuWidth() const {
+    return maxHorizontal * 8;
+}
+
+int JpegDecoder::getBlocksPerMcu() const {
+    int blocks = 0;
+    for (int i = 0; i < componentCount; i++) {
+        blocks += components[i].horizontal * components[i].vertical;
+    }
+    return blocks;
+}
+
+int JpegDecoder::getNextStrip() const {
+    return nextStrip;
+}
+
+int JpegDecoder::getThumbnailWidth() const {
+    return mcusPerRow * components[0].horizontal;
+}
+
+int JpegDecoder::getThumbnailHeight() const {
+    return mcuRows * components[0].vertical;
+}
+
+int JpegDecoder::getSubsampling() const {
+    if (componentCount == 1) {
+        return JPEG_SUBSAMPLING_444;
+    }
+    if (maxHorizontal == 1) {
+        return maxVertical == 2 ? JPEG_SUBSAMPLING_440 : JPEG_SUBSAMPLING_444;
+    }
+    return maxVertical == 2 ? JPEG_SUBSAMPLING_420 : JPEG_SUBSAMPLING_422;
+}
+
+int JpegDecoder::getComponentCount() const {
+    return componentCount;
+}
+
+const uint8_t* JpegDecoder::getQuantTable(int component) const {
+    return quantTables[components[component].quantTable];
+}
+
+uint16_t JpegDecoder::getRestartInterval() const {
+    return restartInterval;
+}
@@ -0,0 +1,349 @@
+#ifndef RETROLENS_JPEG_DECODER_H
+#define RETROLENS_JPEG_DECODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ImageArena.h"
+#include "JpegTables.h"
+
+// Codes up to this length are decoded with one table lookup
+#define JPEG_HUFFMAN_LOOKUP_BITS 9
+
+/**
+ * @struct JpegHuffmanTable
+ * @brief Decoding tables of one Huffman table.
+ */
+struct JpegHuffmanTable {
+    uint8_t lookupLength[1 << JPEG_HUFFMAN_LOOKUP_BITS]; ///< Code length by prefix, 0 for longer codes.
+    uint8_t lookupValue[1 << JPEG_HUFFMAN_LOOKUP_BITS];  ///< Symbol by prefix.
+    int32_t maxCode[17];                                 ///< Largest code of each length, -1 if none.
+    int32_t valueOffset[17];                             ///< Index of the first symbol of each length minus its code.
+    uint8_t values[256];                                 ///< Symbols in code order.
+    uint8_t counts[16];                                  ///< Number of codes of each length, as in the DHT segment.
+    bool defined;                                        ///< True once a DHT segment set the table.
+};
+
+/**
+ * @struct JpegComponent
+ * @brief Frame component and its decoding state.
+ */
+struct JpegComponent {
+    uint8_t id;            ///< Component identifier of the frame header.
+    uint8_t horizontal;    ///< Horizontal sampling factor.
+    uint8_t vertical;      ///< Vertical sampling factor.
+    uint8_t quantTable;    ///< Quantization table index.
+    uint8_t dcTable;       ///< DC Huffman table index.
+    uint8_t acTable;       ///< AC Huffman table index.
+    int16_t dcPredictor;   ///< Last DC value.
+    uint8_t* plane;        ///< Samples of the current MCU row.
+    size_t planeStride;    ///< Row length of the plane.
+};
+
+/**
+ * @class JpegDecoder
+ * @brief Baseline JPEG decoder that produces the image one MCU row, a strip, at a time.
+ *
+ * Supports 8 bit Huffman baseline frames with one or three components, the 4:4:4, 4:2:2 and
+ * 4:2:0 samplings and restart intervals. Only the sample planes of one strip are held, taken
+ * from an ImageArena at begin(), so a 5 MP frame decodes in a few tens of kilobytes. Strips are
+ * written as interleaved YCbCr, chroma repeated to full resolution.
+ *
+ * A DC-only pass gives a thumbnail of the luma at 1/8 scale, enough to align frames cheaply.
+ *
+ * Transcoders read the scan one MCU at a time as quantized coefficients with decodeMcu(),
+ * skip restart intervals without decoding them and locate the reader in the file to copy
+ * the entropy-coded data they leave untouched. They pass a null arena to begin().
+ *
+ * Example usage:
+ * @code
+ * JpegDecoder decoder;
+ * if (decoder.begin(fb->buf, fb->len, &arena) == JPEG_OK) {
+ *     for (int i = 0; i < decoder.getStripCount(); i++) {
+ *         decoder.decodeStrip(strip, decoder.getWidth() * JPEG_YCC_BYTES);
+ *     }
+ * }
+ * @endcode
+ */
+class JpegDecoder {
+public:
+    /**
+     * @brief Constructor for JpegDecoder.
+     */
+    JpegDecoder();
+
+    /**
+     * @brief Parse the headers and get ready for the first strip.
+     *
+     * @param data JPEG file, kept by the caller until decoding ends.
+     * @param length Size of the file.
+     * @param arena Budget of the strip planes, nullptr to only read coefficients.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int begin(const uint8_t* data, size_t length, ImageArena* arena);
+
+    /**
+     * @brief Restart decoding from the first strip.
+     *
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int rewind();
+
+    /**
+     * @brief Decode the next strip.
+     *
+     * @param ycc Output, getStripHeight() rows of interleaved YCbCr, fewer for the last strip.
+     * @param stride Distance between output rows, in bytes.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int decodeStrip(uint8_t* ycc, size_t stride);
+
+    /**
+     * @brief Decode the whole scan keeping only the luma DC terms, then rewind.
+     *
+     * @param luma Output, getThumbnailWidth() by getThumbnailHeight() block means.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int decodeThumbnail(uint8_t* luma);
+
+    /**
+     * @brief Decode the next MCU as quantized coefficients, without the inverse DCT.
+     *
+     * Not to be mixed with decodeStrip() before a rewind().
+     *
+     * @param coefficients Output, getBlocksPerMcu() blocks in natural order, the luma blocks row
+     *                     by row then the chroma blocks. DC terms are absolute, not differences.
+     * @return int JPEG_OK or a JPEG_ERROR_* code, JPEG_ERROR_DATA if the MCU runs past the entropy-coded data.
+     */
+    int decodeMcu(int16_t* coefficients);
+
+    /**
+     * @brief Skip whole restart intervals without decoding them.
+     *
+     * Called at the start of the scan or right after the last MCU of an interval. With a count
+     * of 0 only the restart marker due is read, leaving the reader at the start of the next interval.
+     *
+     * @param count Number of intervals to skip.
+     * @return int JPEG_OK, JPEG_ERROR_DATA for a missing marker or JPEG_ERROR_STATE.
+     */
+    int skipRestartIntervals(int count);
+
+    /**
+     * @brief Get the position of the next unread bit of the entropy-coded data in the file.
+     *
+     * @param bit Output bit in the byte, 0 for the most significant.
+     * @return size_t Offset of the byte in the file.
+     */
+    size_t getScanPosition(int* bit) const;
+
+    /**
+     * @brief Move the reader to an MCU whose position and DC predictors were noted on an earlier pass.
+     *
+     * @param index Index of the MCU in the scan, for the restart markers.
+     * @param offset From getScanPosition() before the MCU.
+     * @param bit From getScanPosition() before the MCU.
+     * @param dcPredictors From getDcPredictors() before the MCU, getComponentCount() values.
+     * @return int JPEG_OK or JPEG_ERROR_STATE.
+     */
+    int seekMcu(int index, size_t offset, int bit, const int16_t* dcPredictors);
+
+    /**
+     * @brief Get the DC value of the last block of each component, the prediction of the next MCU.
+     *
+     * @param dcPredictors Output, getComponentCount() values.
+     */
+    void getDcPredictors(int16_t* dcPredictors) const;
+
+    /**
+     * @brief Get the offset of the entropy-coded data in the file, the end of the headers.
+     */
+    size_t getScanStart() const;
+
+    /**
+     * @brief Get the Huffman table of a component, as stored in its DHT segment.
+     *
+     * @param component Component index, 0 for luma.
+     * @param ac True for the AC table, false for the DC table.
+     * @return JpegHuffmanSpec Table, valid while the decoder lives.
+     */
+    JpegHuffmanSpec getHuffmanSpec(int component, bool ac) const;
+
+    /**
+     * @brief Get the image width.
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Get the image height.
+     */
+    int getHeight() const;
+
+    /**
+     * @brief Get the rows of a strip, the MCU height.
+     */
+    int getStripHeight() const;
+
+    /**
+     * @brief Get the number of strips.
+     */
+    int getStripCount() const;
+
+    /**
+     * @brief Get the number of MCUs in a strip.
+     */
+    int getMcusPerStrip() const;
+
+    /**
+     * @brief Get the width of an MCU, in pixels.
+     */
+    int getMcuWidth() const;
+
+    /**
+     * @brief Get the number of blocks of an MCU, over every component.
+     */
+    int getBlocksPerMcu() const;
+
+    /**
+     * @brief Get the index of the next strip to decode.
+     */
+    int getNextStrip() const;
+
+    /**
+     * @brief Get the width of the thumbnail, in luma blocks.
+     */
+    int getThumbnailWidth() const;
+
+    /**
+     * @brief Get the height of the thumbnail, in luma blocks.
+     */
+    int getThumbnailHeight() const;
+
+    /**
+     * @brief Get the chroma subsampling.
+     *
+     * @return int One of the JPEG_SUBSAMPLING_* values, JPEG_SUBSAMPLING_444 for grayscale.
+     */
+    int getSubsampling() const;
+
+    /**
+     * @brief Get the number of components.
+     */
+    int getComponentCount() const;
+
+    /**
+     * @brief Get the quantization table of a component.
+     *
+     * @param component Component index, 0 for luma.
+     * @return const uint8_t* Table in natural order.
+     */
+    const uint8_t* getQuantTable(int component) const;
+
+    /**
+     * @brief Get the restart interval.
+     *
+     * @return uint16_t MCUs between restart markers, 0 if none.
+     */
+    uint16_t getRestartInterval() const;
+
+private:
+    /**
+     * @brief Parse the marker segments up to the start of scan.
+     *
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int parseHeaders();
+
+    /**
+     * @brief Parse a DHT segment.
+     *
+     * @param segment Segment payload.
+     * @param size Payload size.
+     * @return int JPEG_OK or JPEG_ERROR_FORMAT.
+     */
+    int parseHuffman(const uint8_t* segment, size_t size);
+
+    /**
+     * @brief Parse a DQT segment.
+     *
+     * @param segment Segment payload.
+     * @param size Payload size.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int parseQuant(const uint8_t* segment, size_t size);
+
+    /**
+     * @brief Reset the entropy decoder to the start of the scan.
+     */
+    void resetScan();
+
+    /**
+     * @brief Refill the bit buffer to at least 25 bits, with zeros past a marker.
+     */
+    void fillBits();
+
+    /**
+     * @brief Read bits from the entropy-coded data.
+     *
+     * @param count Number of bits, 0 to 16.
+     * @return uint32_t The bits.
+     */
+    uint32_t readBits(int count);
+
+    /**
+     * @brief Decode one Huffman symbol.
+     *
+     * @param table Huffman table.
+     * @return int Symbol, -1 for an invalid code.
+     */
+    int decodeSymbol(const JpegHuffmanTable* table);
+
+    /**
+     * @brief Handle the restart marker due before the next MCU, if any.
+     *
+     * @return int JPEG_OK or JPEG_ERROR_DATA.
+     */
+    int handleRestart();
+
+    /**
+     * @brief Drop the padding bits, read the next restart marker and reset the predictors.
+     *
+     * @return int JPEG_OK or JPEG_ERROR_DATA if the marker is not the one due.
+     */
+    int readRestartMarker();
+
+    /**
+     * @brief Decode one block of a component.
+     *
+     * @param component Component of the block.
+     * @param block Output coefficients in natural order, nullptr to only track the DC.
+     * @param dequantize False to keep the quantized values, with the absolute DC.
+     * @return int JPEG_OK or JPEG_ERROR_DATA.
+     */
+    int decodeBlock(JpegComponent* component, int16_t* block, bool dequantize = true);
+
+    const uint8_t* data;                           ///< JPEG file.
+    size_t length;                                 ///< Size of the file.
+    size_t scanStart;                              ///< Offset of the entropy-coded data.
+    size_t position;                               ///< Read offset in the entropy-coded data.
+    uint32_t bitBuffer;                            ///< Unread bits, most significant first.
+    int bitCount;                                  ///< Number of unread bits.
+    bool markerReached;                            ///< True when the reader stopped at a marker.
+    int paddingBytes;                              ///< Zero bytes fed to the bit buffer past the marker.
+    int width;                                     ///< Image width.
+    int height;                                    ///< Image height.
+    int componentCount;                            ///< Number of components.
+    JpegComponent components[JPEG_MAX_COMPONENTS]; ///< Components in scan order.
+    int maxHorizontal;                             ///< Largest horizontal sampling factor.
+    int maxVertical;                               ///< Largest vertical sampling factor.
+    int mcusPerRow;                                ///< MCUs in a strip.
+    int mcuRows;                                   ///< Number of strips.
+    int nextStrip;                                 ///< Index of the next strip.
+    uint16_t restartInterval;                      ///< MCUs between restart markers.
+    uint16_t mcusToRestart;                        ///< MCUs left before the next restart marker.
+    uint8_t nextRestart;                           ///< Number of the next restart marker, 0 to 7.
+    uint8_t quantTables[4][JPEG_BLOCK_SIZE];       ///< Quantization tables, natural order.
+    JpegHuffmanTable dcTables[4];                  ///< DC Huffman tables.
+    JpegHuffmanTable acTables[4];                  ///< AC Huffman tables.
+};
+
+#endif // RETROLENS_JPEG_DECODER_H
@@ -0,0 +1,473 @@
+#include <string.h>
+
+#include "JpegDct.h"
+#include "JpegEncoder.h"
+
+static const uint8_t JFIF_HEADER[] = {
+    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 'J', 'F', 'I', 'F', 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+};
+
+// Number of bits of a magnitude, its category, one NSAU instruction on the ESP32
+static inline int bitLength(uint32_t value) {
+    return value == 0 ? 0 : 32 - __builtin_clz(value);
+}
+
+JpegEncoder::JpegEncoder()
+    : writer(nullptr), context(nullptr), width(0), height(0), subsampling(JPEG_SUBSAMPLING_422), horizontal(2), vertical(1),
+      mcusPerRow(0), mcuRows(0), nextStrip(0), nextMcu(0), restartInterval(0), mcusToRestart(0), nextRestart(0), intervals(false),
+      bitAccumulator(0), bitCount(0), bufferUsed(0), bytesWritten(0), failed(false), uncodable(false) {
+    memset(dcPredictors, 0, sizeof(dcPredictors));
+}
+
+void JpegEncoder::buildCodes(const JpegHuffmanSpec& spec, JpegHuffmanCodes* codes) {
+    memset(codes->sizes, 0, sizeof(codes->sizes));
+    uint16_t code = 0;
+    int index = 0;
+    for (int bits = 1; bits <= 16; bits++) {
+        for (int i = 0; i < spec.counts[bits - 1]; i++) {
+            codes->codes[spec.values[index]] = code;
+            codes->sizes[spec.values[index]] = (uint8_t) bits;
+            code++;
+            index++;
+        }
+        code <<= 1;
+    }
+}
+
+int JpegEncoder::begin(int width, int height, int subsampling, const uint8_t* lumaQuant, const uint8_t* chromaQuant,
+                       JpegWriter writer, void* context, uint16_t restartInterval) {
+    int result = setFrame(width, height, subsampling, lumaQuant, chromaQuant, writer, context, restartInterval);
+    if (result != JPEG_OK) {
+        return result;
+    }
+    writeHeaders();
+    return failed ? JPEG_ERROR_WRITE : JPEG_OK;
+}
+
+int JpegEncoder::beginIntervals(int width, int height, int subsampling, const uint8_t* lumaQuant,
+                                const uint8_t* chromaQuant, JpegWriter writer, void* context) {
+    int result = setFrame(width, height, subsampling, lumaQuant, chromaQuant, writer, context, 0);
+    intervals = result == JPEG_OK;
+    return result;
+}
+
+int JpegEncoder::setFrame(int width, int height, int subsampling, const uint8_t* lumaQuant, const uint8_t* chromaQuant,
+                          JpegWriter writer, void* context, uint16_t restartInterval) {
+    if (width <= 0 || height <= 0 || width > 65535 || height > 65535 || subsampling < JPEG_SUBSAMPLING_444 ||
+        subsampling > JPEG_SUBSAMPLING_440) {
+        return JPEG_ERROR_UNSUPPORTED;
+    }
+    reset(lumaQuant, chromaQuant, writer, context);
+    this->width = width;
+    this->height = height;
+    this->subsampling = subsampling;
+    this->restartInterval = restartInterval;
+    jpegSamplingFactors(subsampling, &horizontal, &vertical);
+    mcusPerRow = (width + horizontal * 8 - 1) / (horizontal * 8);
+    mcuRows = (height + vertical * 8 - 1) / (vertical * 8);
+    mcusToRestart = restartInterval;
+    buildCodes(JPEG_STD_DC_LUMA, &dcCodes[0]);
+    buildCodes(JPEG_STD_AC_LUMA, &acCodes[0]);
+    buildCodes(JPEG_STD_DC_CHROMA, &dcCodes[1]);
+    buildCodes(JPEG_STD_AC_CHROMA, &acCodes[1]);
+    return JPEG_OK;
+}
+
+int JpegEncoder::beginSplice(const uint8_t* lumaQuant, const uint8_t* chromaQuant, const JpegHuffmanSpec& lumaDc,
+                             const JpegHuffmanSpec& lumaAc, const JpegHuffmanSpec& chromaDc, const JpegHuffmanSpec& chromaAc,
+                             JpegWriter writer, void* context) {
+    reset(lumaQuant, chromaQuant, writer, context);
+    // No strips, finish() only closes the scan
+    width = 0;
+    height = 0;
+    mcusPerRow = 0;
+    mcuRows = 0;
+    restartInterval = 0;
+    mcusToRestart = 0;
+    buildCodes(lumaDc, &dcCodes[0]);
+    buildCodes(lumaAc, &acCodes[0]);
+    buildCodes(chromaDc, &dcCodes[1]);
+    buildCodes(chromaAc, &acCodes[1]);
+    return JPEG_OK;
+}
+
+void JpegEncoder::reset(const uint8_t* lumaQuant, const uint8_t* chromaQuant, JpegWriter writer, void* context) {
+    this->writer = writer;
+    this->context = context;
+    nextStrip = 0;
+    nextMcu = 0;
+    nextRestart = 0;
+    intervals = false;
+    memset(dcPredictors, 0, sizeof(dcPredictors));
+    bitAccumulator = 0;
+    bitCount = 0;
+    bufferUsed = 0;
+    bytesWritten = 0;
+    failed = false;
+    uncodable = false;
+    for (int i = 0; i < JPEG_BLOCK_SIZE; i++) {
+        quant[0][i] = lumaQuant[i] > 0 ? lumaQuant[i] : 1;
+        quant[1][i] = chromaQuant[i] > 0 ? chromaQuant[i] : 1;
+    }
+    jpegQuantReciprocals(quant[0], reciprocals[0]);
+    jpegQuantReciprocals(quant[1], reciprocals[1]);
+}
+
+void JpegEncoder::copyBytes(const uint8_t* bytes, size_t count) {
+    flushBits();
+    putBytes(bytes, count);
+}
+
+void JpegEncoder::copyBits(uint32_t bits, int count) {
+    putBits(bits, count);
+}
+
+void JpegEncoder::setDcPredictor(int component, int16_t value) {
+    dcPredictors[component] = value;
+}
+
+void JpegEncoder::writeRestart(int number) {
+    flushBits();
+    putByte(0xFF);
+    putByte((uint8_t) (0xD0 + (number & 7)));
+    memset(dcPredictors, 0, sizeof(dcPredictors));
+}
+
+void JpegEncoder::writeHeaders() {
+    putBytes(JFIF_HEADER, sizeof(JFIF_HEADER));
+
+    uint8_t dqt[4 + 2 * (1 + JPEG_BLOCK_SIZE)] = {0xFF, 0xDB, 0x00, 2 + 2 * (1 + JPEG_BLOCK_SIZE)};
+    dqt[4] = 0x00;
+    dqt[5 + JPEG_BLOCK_SIZE] = 0x01;
+    for (int i = 0; i < JPEG_BLOCK_SIZE; i++) {
+        dqt[5 + i] = (uint8_t) quant[0][JPEG_ZIGZAG[i]];
+        dqt[6 + JPEG_BLOCK_SIZE + i] = (uint8_t) quant[1][JPEG_ZIGZAG[i]];
+    }
+    putBytes(dqt, sizeof(dqt));
+
+    uint8_t sof[] = {
+        0xFF, 0xC0, 0x00, 17, 8, (uint8_t) (height >> 8), (uint8_t) height, (uint8_t) (width >> 8), (uint8_t) width, 3,
+        1, (uint8_t) ((horizontal << 4) | vertical), 0,
+        2, 0x11, 1,
+        3, 0x11, 1,
+    };
+    putBytes(sof, sizeof(sof));
+
+    writeHuffman(0x00, JPEG_STD_DC_LUMA);
+    writeHuffman(0x10, JPEG_STD_AC_LUMA);
+    writeHuffman(0x01, JPEG_STD_DC_CHROMA);
+    writeHuffman(0x11, JPEG_STD_AC_CHROMA);
+
+    if (restartInterval > 0) {
+        uint8_t dri[] = {0xFF, 0xDD, 0x00, 0x04, (uint8_t) (restartInterval >> 8), (uint8_t) restartInterval};
+        putBytes(dri, sizeof(dri));
+    }
+
+    static const uint8_t SOS[] = {0xFF, 0xDA, 0x00, 0x0C, 3, 1, 0x00, 2, 0x11, 3, 0x11, 0x00, 0x3F, 0x00};
+    putBytes(SOS, sizeof(SOS));
+}
+
+void JpegEncoder::writeHuffman(uint8_t classAndIndex, const JpegHuffmanSpec& spec) {
+    int total = 0;
+    for (int i = 0; i < 16; i++) {
+        total += spec.counts[i];
+    }
+    uint8_t header[5] = {0xFF, 0xC4, (uint8_t) ((3 + 16 + total) >> 8), (uint8_t) (3 + 16 + total), classAndIndex};
+    putBytes(header, sizeof(header));
+    putBytes(spec.counts, 16);
+    putBytes(spec.values, total);
+}
+
+int JpegEncoder::encodeStrip(const uint8_t* ycc, size_t stride) {
+    if (writer == nullptr || intervals || nextStrip >= mcuRows) {
+        return JPEG_ERROR_STATE;
+    }
+    codeStrip(nextStrip, ycc, stride);
+    nextStrip++;
+    return failed ? JPEG_ERROR_WRITE : JPEG_OK;
+}
+
+int JpegEncoder::encodeInterval(int strip, const uint8_t* ycc, size_t stride) {
+    if (writer == nullptr || !intervals || strip < 0 || strip >= mcuRows) {
+        return JPEG_ERROR_STATE;
+    }
+    memset(dcPredictors, 0, sizeof(dcPredictors));
+    codeStrip(strip, ycc, stride);
+    flushBits();
+    flushOutput();
+    return failed ? JPEG_ERROR_WRITE : JPEG_OK;
+}
+
+int JpegEncoder::appendInterval(const uint8_t* bytes, size_t count) {
+    if (writer == nullptr || intervals || restartInterval != mcusPerRow || nextStrip >= mcuRows) {
+        return JPEG_ERROR_STATE;
+    }
+    if (nextStrip > 0) {
+        writeRestart(nextRestart);
+        nextRestart = (nextRestart + 1) & 7;
+    }
+    copyBytes(bytes, count);
+    nextStrip++;
+    return failed ? JPEG_ERROR_WRITE : JPEG_OK;
+}
+
+void JpegEncoder::codeStrip(int strip, const uint8_t* ycc, size_t stride) {
+    int rows = height - strip * vertical * 8;
+    if (rows > vertical * 8) {
+        rows = vertical * 8;
+    }
+
+    uint8_t samples[JPEG_BLOCK_SIZE];
+    for (int mcu = 0; mcu < mcusPerRow; mcu++) {
+        countRestart();
+
+        // Luma blocks, then one block of each chroma averaged over the MCU
+        for (int component = 0; component < JPEG_MAX_COMPONENTS; component++) {
+            int blocksX = component == 0 ? horizontal : 1;
+            int blocksY = component == 0 ? vertical : 1;
+            int stepX = component == 0 ? 1 : horizontal;
+            int stepY = component == 0 ? 1 : vertical;
+            // Sampling factors are 1 or 2, the average is a shift
+            int shift = (stepX - 1) + (stepY - 1);
+            for (int by = 0; by < blocksY; by++) {
+                for (int bx = 0; bx < blocksX; bx++) {
+                    int originX = mcu * horizontal * 8 + bx * 8;
+                    int originY = by * 8;
+                    if (originX + 8 * stepX <= width && originY + 8 * stepY <= rows) {
+                        // Inside the frame, no edge to repeat
+                        const uint8_t* origin = ycc + (size_t) originY * stride + (size_t) originX * JPEG_YCC_BYTES + component;
+                        gatherBlock(origin, stride, stepX, stepY, shift, samples);
+                        encodeBlock(samples, 8, component);
+                        continue;
+                    }
+                    for (int y = 0; y < 8; y++) {
+                        for (int x = 0; x < 8; x++) {
+                            uint32_t sum = 0;
+                            for (int dy = 0; dy < stepY; dy++) {
+                                int sampleY = originY + y * stepY + dy;
+                                if (sampleY >= rows) {
+                                    sampleY = rows - 1;
+                                }
+                                const uint8_t* row = ycc + (size_t) sampleY * stride;
+                                for (int dx = 0; dx < stepX; dx++) {
+                                    int sampleX = originX + x * stepX + dx;
+                                    if (sampleX >= width) {
+                                        sampleX = width - 1;
+                                    }
+                                    sum += row[(size_t) sampleX * JPEG_YCC_BYTES + component];
+                                }
+                            }
+                            samples[y * 8 + x] = (uint8_t) ((sum + ((1u << shift) >> 1)) >> shift);
+                        }
+                    }
+                    encodeBlock(samples, 8, component);
+                }
+            }
+        }
+    }
+}
+
+void JpegEncoder::gatherBlock(const uint8_t* origin, size_t stride, int stepX, int stepY, int shift, uint8_t* samples) {
+    const size_t pitchX = (size_t) stepX * JPEG_YCC_BYTES;
+    if (shift == 0) {
+        for (int y = 0; y < 8; y++) {
+            const uint8_t* row = origin + (size_t) y * stride;
+            for (int x = 0; x < 8; x++) {
+                samples[y * 8 + x] = row[x * JPEG_YCC_BYTES];
+            }
+        }
+        return;
+    }
+    const uint32_t half = (1u << shift) >> 1;
+    for (int y = 0; y < 8; y++) {
+        const uint8_t* row = origin + (size_t) y * stepY * stride;
+        for (int x = 0; x < 8; x++) {
+            const uint8_t* sample = row + x * pitchX;
+            uint32_t sum = sample[0];
+            if (stepX == 2) {
+                sum += sample[JPEG_YCC_BYTES];
+            }
+            if (stepY == 2) {
+                sum += sample[stride];
+                if (stepX == 2) {
+                    sum += sample[stride + JPEG_YCC_BYTES];
+                }
+            }
+            samples[y * 8 + x] = (uint8_t) ((sum + half) >> shift);
+        }
+    }
+}
+
+int JpegEncoder::encodeMcu(const int16_t* quantized) {
+    if (writer == nullptr || intervals || nextStrip >= mcuRows) {
+        return JPEG_ERROR_STATE;
+    }
+    countRestart();
+    for (int component = 0; component < JPEG_MAX_COMPONENTS; component++) {
+        int blocks = component == 0 ? horizontal * vertical : 1;
+        for (int block = 0; block < blocks; block++) {
+            encodeCoefficients(quantized, component);
+            quantized += JPEG_BLOCK_SIZE;
+        }
+    }
+    if (++nextMcu == mcusPerRow) {
+        nextMcu = 0;
+        nextStrip++;
+    }
+    return failed ? JPEG_ERROR_WRITE : JPEG_OK;
+}
+
+void JpegEncoder::countRestart() {
+    if (restartInterval == 0) {
+        return;
+    }
+    if (mcusToRestart == 0) {
+        writeRestart(nextRestart);
+        nextRestart = (nextRestart + 1) & 7;
+        mcusToRestart = restartInterval;
+    }
+    mcusToRestart--;
+}
+
+void JpegEncoder::encodeBlock(const uint8_t* samples, size_t stride, int component) {
+    int16_t scaled[JPEG_BLOCK_SIZE];
+    jpegForwardDctScaled(samples, stride, scaled);
+
+    int16_t quantized[JPEG_BLOCK_SIZE];
+    jpegQuantizeScaled(scaled, reciprocals[component == 0 ? 0 : 1], quantized);
+    encodeCoefficients(quantized, component);
+}
+
+void JpegEncoder::encodeCoefficients(const int16_t* quantized, int component) {
+    int table = component == 0 ? 0 : 1;
+
+    // DC difference
+    int32_t difference = quantized[0] - dcPredictors[component];
+    dcPredictors[component] = quantized[0];
+    uint32_t magnitude = difference < 0 ? -difference : difference;
+    int category = bitLength(magnitude);
+    putCode(dcCodes[table], category);
+    if (category > 0) {
+        putBits((uint32_t) (difference < 0 ? difference - 1 : difference) & ((1u << category) - 1), category);
+    }
+
+    // AC run lengths in zigzag order
+    int run = 0;
+    for (int k = 1; k < JPEG_BLOCK_SIZE; k++) {
+        int32_t value = quantized[JPEG_ZIGZAG[k]];
+        if (value == 0) {
+            run++;
+            continue;
+        }
+        while (run > 15) {
+            putCode(acCodes[table], 0xF0);
+            run -= 16;
+        }
+        magnitude = value < 0 ? -value : value;
+        category = bitLength(magnitude);
+        int symbol = (run << 4) | category;
+        putCode(acCodes[table], symbol);
+        putBits((uint32_t) (value < 0 ? value - 1 : value) & ((1u << category) - 1), category);
+        run = 0;
+    }
+    if (run > 0) {
+        putCode(acCodes[table], 0x00);
+    }
+}
+
+void JpegEncoder::putCode(const JpegHuffmanCodes& codes, int symbol) {
+    if (codes.sizes[symbol] == 0) {
+        // Tables of a spliced source may lack the symbol
+        uncodable = true;
+        return;
+    }
+    putBits(codes.codes[symbol], codes.sizes[symbol]);
+}
+
+void JpegEncoder::putBits(uint32_t bits, int count) {
+    if (count == 0) {
+        return;
+    }
+    bitAccumulator = (bitAccumulator << count) | (bits & ((1u << count) - 1));
+    bitCount += count;
+    while (bitCount >= 8) {
+        uint8_t byte = (uint8_t) (bitAccumulator >> (bitCount - 8));
+        putByte(byte);
+        if (byte == 0xFF) {
+            // Stuffed zero, so the data never looks like a marker
+            putByte(0x00);
+        }
+        bitCount -= 8;
+    }
+    bitAccumulator &= (1u << bitCount) - 1;
+}
+
+void JpegEncoder::flushBits() {
+    if (bitCount > 0) {
+        putBits(0x7F, 8 - bitCount);
+    }
+}
+
+void JpegEncoder::putByte(uint8_t byte) {
+    buffer[bufferUsed++] = byte;
+    if (bufferUsed == JPEG_ENCODER_BUFFER_SIZE) {
+        flushOutput();
+    }
+}
+
+void JpegEncoder::putBytes(const uint8_t* bytes, size_t count) {
+    while (count > 0) {
+        size_t chunk = JPEG_ENCODER_BUFFER_SIZE - bufferUsed;
+        if (chunk > count) {
+            chunk = count;
+        }
+        memcpy(buffer + bufferUsed, bytes, chunk);
+        bufferUsed += chunk;
+        bytes += chunk;
+        count -= chunk;
+        if (bufferUsed == JPEG_ENCODER_BUFFER_SIZE) {
+            flushOutput();
+        }
+    }
+}
+
+void JpegEncoder::flushOutput() {
+    if (bufferUsed == 0) {
+        return;
+    }
+    if (!failed && !writer(context, buffer, bufferUsed)) {
+        failed = true;
+    }
+    bytesWritten += bufferUsed;
+    bufferUsed = 0;
+}
+
+int JpegEncoder::finish() {
+    if (writer == nullptr) {
+        return JPEG_ERROR_STATE;
+    }
+    if (intervals || nextStrip != mcuRows) {
+        return JPEG_ERROR_STATE;
+    }
+    flushBits();
+    putByte(0xFF);
+    putByte(0xD9);
+    flushOutput();
+    writer = nullptr;
+    if (uncodable) {
+        return JPEG_ERROR_UNSUPPORTED;
+    }
+    return failed ? JPEG_ERROR_WRITE : JPEG_OK;
+}
+
+int JpegEncoder::getStripHeight() const {
+    return vertical * 8;
+}
+
+int JpegEncoder::getStripCount() const {
+    return mcuRows;
+}
+
+uint32_t JpegEncoder::getBytesWritten() const {
+    return bytesWritten;
+}
@@ -0,0 +1,336 @@
+#ifndef RETROLENS_JPEG_ENCODER_H
+#define RETROLENS_JPEG_ENCODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "JpegTables.h"
+
+// Output is handed to the writer in chunks of this size
+#define JPEG_ENCODER_BUFFER_SIZE 512
+
+/**
+ * @struct JpegHuffmanCodes
+ * @brief Encoding tables of one Huffman table.
+ */
+struct JpegHuffmanCodes {
+    uint16_t codes[256]; ///< Code of each symbol.
+    uint8_t sizes[256];  ///< Code length of each symbol, 0 if the symbol has no code.
+};
+
+/**
+ * @class JpegEncoder
+ * @brief Baseline JPEG encoder fed one strip of interleaved YCbCr at a time, streaming its output to a writer.
+ *
+ * Uses the standard Huffman tables and the quantization tables given at begin(), typically the
+ * tables of the decoded source so a re-encoded frame keeps its look and size. Chroma is
+ * averaged down to the requested subsampling and the edges are padded by repeating the last
+ * row and column. Only one strip is read at a time and the output goes through a
+ * JPEG_ENCODER_BUFFER_SIZE buffer, so memory does not grow with the image.
+ *
+ * A splice appends to the scan of an existing file instead: beginSplice() takes the tables of
+ * the source and writes no header, the caller copies the untouched parts of the source and
+ * codes the others block by block.
+ *
+ * Strips can also be coded on several encoders at once, one restart interval each: encoders
+ * begun with beginIntervals() code any strip with encodeInterval(), and the encoder writing the
+ * file, begun with an interval of one strip, takes them in order with appendInterval().
+ *
+ * Example usage:
+ * @code
+ * JpegEncoder encoder;
+ * encoder.begin(width, height, JPEG_SUBSAMPLING_422, lumaQuant, chromaQuant, writeToFile, &file);
+ * for (int i = 0; i < encoder.getStripCount(); i++) {
+ *     encoder.encodeStrip(strip, width * JPEG_YCC_BYTES);
+ * }
+ * encoder.finish();
+ * @endcode
+ */
+class JpegEncoder {
+public:
+    /**
+     * @brief Constructor for JpegEncoder.
+     */
+    JpegEncoder();
+
+    /**
+     * @brief Write the headers and get ready for the first strip.
+     *
+     * @param width Image width.
+     * @param height Image height.
+     * @param subsampling One of the JPEG_SUBSAMPLING_* values.
+     * @param lumaQuant Luma quantization table, natural order.
+     * @param chromaQuant Chroma quantization table, natural order.
+     * @param writer Output sink.
+     * @param context Context of the writer.
+     * @param restartInterval MCUs between restart markers, 0 for none.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int begin(int width, int height, int subsampling, const uint8_t* lumaQuant, const uint8_t* chromaQuant,
+              JpegWriter writer, void* context, uint16_t restartInterval = 0);
+
+    /**
+     * @brief Get ready to code strips as restart intervals for another encoder, writing no header.
+     *
+     * @param width Image width.
+     * @param height Image height.
+     * @param subsampling One of the JPEG_SUBSAMPLING_* values.
+     * @param lumaQuant Luma quantization table, natural order.
+     * @param chromaQuant Chroma quantization table, natural order.
+     * @param writer Sink of the coded intervals.
+     * @param context Context of the writer.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int beginIntervals(int width, int height, int subsampling, const uint8_t* lumaQuant, const uint8_t* chromaQuant,
+                       JpegWriter writer, void* context);
+
+    /**
+     * @brief Get ready to splice into the scan of an existing file, writing nothing.
+     *
+     * The subsampling is that of the source, the tables are those of its headers.
+     *
+     * @param lumaQuant Luma quantization table, natural order.
+     * @param chromaQuant Chroma quantization table, natural order.
+     * @param lumaDc Luma DC Huffman table.
+     * @param lumaAc Luma AC Huffman table.
+     * @param chromaDc Chroma DC Huffman table.
+     * @param chromaAc Chroma AC Huffman table.
+     * @param writer Output sink.
+     * @param context Context of the writer.
+     * @return int JPEG_OK.
+     */
+    int beginSplice(const uint8_t* lumaQuant, const uint8_t* chromaQuant, const JpegHuffmanSpec& lumaDc,
+                    const JpegHuffmanSpec& lumaAc, const JpegHuffmanSpec& chromaDc, const JpegHuffmanSpec& chromaAc,
+                    JpegWriter writer, void* context);
+
+    /**
+     * @brief Copy bytes of the source to the output, padding the pending bits to a byte first.
+     *
+     * @param bytes Headers or entropy-coded data, already stuffed.
+     * @param count Number of bytes.
+     */
+    void copyBytes(const uint8_t* bytes, size_t count);
+
+    /**
+     * @brief Append entropy-coded bits, stuffing as needed.
+     *
+     * @param bits Value, in the low bits.
+     * @param count Number of bits, 0 to 16.
+     */
+    void copyBits(uint32_t bits, int count);
+
+    /**
+     * @brief Set the last DC value of a component, the base of the next difference.
+     *
+     * @param component 0 for luma, 1 or 2 for chroma.
+     * @param value Quantized DC value.
+     */
+    void setDcPredictor(int component, int16_t value);
+
+    /**
+     * @brief Pad to a byte and write a restart marker, resetting the DC predictors.
+     *
+     * @param number Marker number, 0 to 7.
+     */
+    void writeRestart(int number);
+
+    /**
+     * @brief Transform, quantize and entropy code one block.
+     *
+     * @param samples Top-left sample of an 8x8 block.
+     * @param stride Distance between rows, in samples.
+     * @param component 0 for luma, 1 or 2 for chroma.
+     */
+    void encodeBlock(const uint8_t* samples, size_t stride, int component);
+
+    /**
+     * @brief Entropy code one block of quantized coefficients.
+     *
+     * @param quantized Coefficients in natural order, absolute DC.
+     * @param component 0 for luma, 1 or 2 for chroma.
+     */
+    void encodeCoefficients(const int16_t* quantized, int component);
+
+    /**
+     * @brief Entropy code the next MCU from quantized coefficients, writing the restart markers due.
+     *
+     * An alternative to encodeStrip() for transcoders, MCUs go left to right and top to bottom.
+     *
+     * @param quantized The luma blocks row by row then the chroma blocks, natural order, absolute DC.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int encodeMcu(const int16_t* quantized);
+
+    /**
+     * @brief Encode the next strip.
+     *
+     * @param ycc getStripHeight() rows of interleaved YCbCr, fewer for the last strip.
+     * @param stride Distance between rows, in bytes.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int encodeStrip(const uint8_t* ycc, size_t stride);
+
+    /**
+     * @brief Code any strip as one restart interval, after beginIntervals().
+     *
+     * The strip starts from zero DC predictions and is padded to a byte, it reaches the writer
+     * before the call returns.
+     *
+     * @param strip Index of the strip.
+     * @param ycc getStripHeight() rows of interleaved YCbCr, fewer for the last strip.
+     * @param stride Distance between rows, in bytes.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int encodeInterval(int strip, const uint8_t* ycc, size_t stride);
+
+    /**
+     * @brief Append the next strip as coded by encodeInterval(), writing the restart marker before it.
+     *
+     * The encoder must have been begun with a restart interval of one strip.
+     *
+     * @param bytes Coded interval.
+     * @param count Size of the interval.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int appendInterval(const uint8_t* bytes, size_t count);
+
+    /**
+     * @brief Flush the last bits and write the end of image.
+     *
+     * @return int JPEG_OK or a JPEG_ERROR_* code, JPEG_ERROR_UNSUPPORTED if a spliced block needed a code the tables lack.
+     */
+    int finish();
+
+    /**
+     * @brief Get the rows of a strip, the MCU height.
+     */
+    int getStripHeight() const;
+
+    /**
+     * @brief Get the number of strips.
+     */
+    int getStripCount() const;
+
+    /**
+     * @brief Get the bytes written so far.
+     */
+    uint32_t getBytesWritten() const;
+
+    /**
+     * @brief Build the encoding tables of a Huffman table.
+     *
+     * @param spec Table as stored in a DHT segment.
+     * @param codes Output codes.
+     */
+    static void buildCodes(const JpegHuffmanSpec& spec, JpegHuffmanCodes* codes);
+
+private:
+    /**
+     * @brief Reset the output and the predictors, and set the quantization tables.
+     */
+    void reset(const uint8_t* lumaQuant, const uint8_t* chromaQuant, JpegWriter writer, void* context);
+
+    /**
+     * @brief Check the frame and set up the encoder for it.
+     */
+    int setFrame(int width, int height, int subsampling, const uint8_t* lumaQuant, const uint8_t* chromaQuant,
+                 JpegWriter writer, void* context, uint16_t restartInterval);
+
+    /**
+     * @brief Code the MCUs of a strip.
+     */
+    void codeStrip(int strip, const uint8_t* ycc, size_t stride);
+
+    /**
+     * @brief Read one block of a component inside the frame, averaged down by the sampling steps.
+     *
+     * @param origin First sample of the block in the strip.
+     * @param stride Distance between rows, in bytes.
+     * @param stepX Pixels averaged across, 1 or 2.
+     * @param stepY Pixels averaged down, 1 or 2.
+     * @param shift Divides the sum of the pixels averaged.
+     * @param samples Output 8x8 block.
+     */
+    static void gatherBlock(const uint8_t* origin, size_t stride, int stepX, int stepY, int shift, uint8_t* samples);
+
+    /**
+     * @brief Count one MCU towards the restart interval, writing the marker due first.
+     */
+    void countRestart();
+
+    /**
+     * @brief Append the Huffman code of a symbol.
+     *
+     * @param codes Encoding tables.
+     * @param symbol Symbol to code.
+     */
+    void putCode(const JpegHuffmanCodes& codes, int symbol);
+
+    /**
+     * @brief Append bits to the output.
+     *
+     * @param bits Value, in the low bits.
+     * @param count Number of bits, 0 to 16.
+     */
+    void putBits(uint32_t bits, int count);
+
+    /**
+     * @brief Pad the last byte with ones.
+     */
+    void flushBits();
+
+    /**
+     * @brief Append one byte to the output buffer.
+     */
+    void putByte(uint8_t byte);
+
+    /**
+     * @brief Append bytes that are not entropy coded.
+     */
+    void putBytes(const uint8_t* bytes, size_t count);
+
+    /**
+     * @brief Hand the output buffer to the writer.
+     */
+    void flushOutput();
+
+    /**
+     * @brief Write the marker segments up to the start of scan.
+     */
+    void writeHeaders();
+
+    /**
+     * @brief Write one DHT table.
+     */
+    void writeHuffman(uint8_t classAndIndex, const JpegHuffmanSpec& spec);
+
+    JpegWriter writer;                          ///< Output sink.
+    void* context;                              ///< Context of the writer.
+    int width;                                  ///< Image width.
+    int height;                                 ///< Image height.
+    int subsampling;                            ///< One of the JPEG_SUBSAMPLING_* values.
+    int horizontal;                             ///< Luma horizontal sampling factor.
+    int vertical;                               ///< Luma vertical sampling factor.
+    int mcusPerRow;                             ///< MCUs in a strip.
+    int mcuRows;                                ///< Number of strips.
+    int nextStrip;                              ///< Index of the next strip.
+    int nextMcu;                                ///< MCUs of the next strip coded by encodeMcu().
+    uint16_t restartInterval;                   ///< MCUs between restart markers.
+    uint16_t mcusToRestart;                     ///< MCUs left before the next restart marker.
+    uint8_t nextRestart;                        ///< Number of the next restart marker.
+    bool intervals;                             ///< True when begun with beginIntervals().
+    uint16_t quant[2][JPEG_BLOCK_SIZE];         ///< Quantization divisors, natural order.
+    uint32_t reciprocals[2][JPEG_BLOCK_SIZE];   ///< Divisors as multipliers of the scaled DCT.
+    JpegHuffmanCodes dcCodes[2];                ///< DC codes of luma and chroma.
+    JpegHuffmanCodes acCodes[2];                ///< AC codes of luma and chroma.
+    int16_t dcPredictors[JPEG_MAX_COMPONENTS];  ///< Last DC value of each component.
+    uint32_t bitAccumulator;                    ///< Pending bits.
+    int bitCount;                               ///< Number of pending bits.
+    uint8_t buffer[JPEG_ENCODER_BUFFER_SIZE];   ///< Output waiting for the writer.
+    size_t bufferUsed;                          ///< Bytes in the buffer.
+    uint32_t bytesWritten;                      ///< Bytes handed to the writer.
+    bool failed;                                ///< True once the writer refused output.
+    bool uncodable;                             ///< True once a symbol had no code in the tables.
+};
+
+#endif // RETROLENS_JPEG_ENCODER_H
@@ -0,0 +1,78 @@
+#ifndef RETROLENS_JPEG_TABLES_H
+#define RETROLENS_JPEG_TABLES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Result codes of the JPEG codec
+#define JPEG_OK 0
+#define JPEG_ERROR_FORMAT 1      // Not a JPEG or a malformed marker segment
+#define JPEG_ERROR_UNSUPPORTED 2 // Progressive, arithmetic, 12 bit or an unsupported sampling
+#define JPEG_ERROR_DATA 3        // Corrupt entropy-coded data
+#define JPEG_ERROR_WRITE 4       // The writer refused the output
+#define JPEG_ERROR_MEMORY 5      // The arena budget is spent
+#define JPEG_ERROR_STATE 6       // Call out of order
+
+// Chroma subsampling, as horizontal and vertical luma factors
+#define JPEG_SUBSAMPLING_444 0 // 1x1, 8x8 MCU
+#define JPEG_SUBSAMPLING_422 1 // 2x1, 16x8 MCU, the sensor output
+#define JPEG_SUBSAMPLING_420 2 // 2x2, 16x16 MCU
+#define JPEG_SUBSAMPLING_440 3 // 1x2, 8x16 MCU, a 4:2:2 frame turned by a quarter
+
+#define JPEG_BLOCK_SIZE 64
+#define JPEG_MAX_COMPONENTS 3
+
+// Bytes per pixel of the interleaved YCbCr strips exchanged with the codec
+#define JPEG_YCC_BYTES 3
+
+/**
+ * @brief Output sink of the encoders and transforms.
+ *
+ * @param context Writer context.
+ * @param data Bytes to write.
+ * @param length Number of bytes.
+ * @return true if all bytes were written.
+ */
+typedef bool (*JpegWriter)(void* context, const uint8_t* data, size_t length);
+
+/**
+ * @struct JpegHuffmanSpec
+ * @brief Huffman table as stored in a DHT segment.
+ */
+struct JpegHuffmanSpec {
+    uint8_t counts[16];    ///< Number of codes of each length, 1 to 16 bits.
+    const uint8_t* values; ///< Symbols in code order.
+};
+
+/// Natural order index of each zigzag position.
+extern const uint8_t JPEG_ZIGZAG[JPEG_BLOCK_SIZE];
+
+/// Quantization tables of ITU T.81 Annex K, natural order, quality 50.
+extern const uint8_t JPEG_STD_LUMA_QUANT[JPEG_BLOCK_SIZE];
+extern const uint8_t JPEG_STD_CHROMA_QUANT[JPEG_BLOCK_SIZE];
+
+/// Huffman tables of ITU T.81 Annex K.
+extern const JpegHuffmanSpec JPEG_STD_DC_LUMA;
+extern const JpegHuffmanSpec JPEG_STD_AC_LUMA;
+extern const JpegHuffmanSpec JPEG_STD_DC_CHROMA;
+extern const JpegHuffmanSpec JPEG_STD_AC_CHROMA;
+
+/**
+ * @brief Scale a base quantization table to an IJG quality.
+ *
+ * @param base Table at quality 50, natural order.
+ * @param quality Quality from 1 to 100.
+ * @param out Scaled table, natural order.
+ */
+void jpegScaleQuantTable(const uint8_t* base, int quality, uint8_t* out);
+
+/**
+ * @brief Get the luma sampling factors of a subsampling.
+ *
+ * @param subsampling One of the JPEG_SUBSAMPLING_* values.
+ * @param horizontal Output horizontal factor.
+ * @param vertical Output vertical factor.
+ */
+void jpegSamplingFactors(int subsampling, int* horizontal, int* vertical);
+
+#endif // RETROLENS_JPEG_TABLES_H
@@ -0,0 +1,305 @@
+#include <new>
+#include <string.h>
+
+#include "JpegTransform.h"
+
+// Blocks of the largest MCU, 4:2:0
+#define TRANSFORM_MAX_MCU_BLOCKS 6
+
+// Slack of each arena allocation for its alignment
+#define TRANSFORM_ALIGN_SLACK 8
+
+// Bytes of the index per MCU, the scan bit and one DC prediction per component
+#define TRANSFORM_INDEX_BYTES (sizeof(uint32_t) + JPEG_MAX_COMPONENTS * sizeof(int16_t))
+
+JpegTransform::JpegTransform(ImageArena* arena)
+    : arena(arena), decoder(nullptr), encoder(nullptr), sourceBlocks(nullptr), outputBlocks(nullptr), positions(nullptr),
+      predictors(nullptr), rotation(JPEG_ROTATE_0), turned(false), blocksX(1), blocksY(1), sourceColumns(0), sourceRows(0),
+      cropColumn(0), cropRow(0), cropColumns(0), cropRows(0), indexColumn(0), indexRow(0), indexColumns(0), indexRows(0),
+      outputWidth(0), outputHeight(0) {
+}
+
+int JpegTransform::write(const uint8_t* data, size_t length, int rotation, int crop, JpegWriter writer, void* context) {
+    if (rotation < JPEG_ROTATE_0 || rotation >= JPEG_ROTATE_COUNT || crop < JPEG_CROP_FULL || crop >= JPEG_CROP_COUNT) {
+        return JPEG_ERROR_UNSUPPORTED;
+    }
+    this->rotation = rotation;
+    turned = rotation == JPEG_ROTATE_90 || rotation == JPEG_ROTATE_270;
+    outputWidth = 0;
+    outputHeight = 0;
+
+    size_t mark = arena->getMark();
+    void* decoderStorage = arena->alloc(sizeof(JpegDecoder), alignof(JpegDecoder));
+    void* encoderStorage = arena->alloc(sizeof(JpegEncoder), alignof(JpegEncoder));
+    sourceBlocks = static_cast<int16_t*>(arena->alloc(TRANSFORM_MAX_MCU_BLOCKS * JPEG_BLOCK_SIZE * sizeof(int16_t)));
+    outputBlocks = static_cast<int16_t*>(arena->alloc(TRANSFORM_MAX_MCU_BLOCKS * JPEG_BLOCK_SIZE * sizeof(int16_t)));
+    if (decoderStorage == nullptr || encoderStorage == nullptr || sourceBlocks == nullptr || outputBlocks == nullptr) {
+        arena->release(mark);
+        return JPEG_ERROR_MEMORY;
+    }
+
+    // Only coefficients are read, the decoder needs no strip planes
+    decoder = new (decoderStorage) JpegDecoder();
+    int result = decoder->begin(data, length, nullptr);
+    if (result == JPEG_OK && (decoder->getComponentCount() != JPEG_MAX_COMPONENTS ||
+                              decoder->getQuantTable(1) != decoder->getQuantTable(2))) {
+        // The encoder codes three components, both chromas with one table
+        result = JPEG_ERROR_UNSUPPORTED;
+    }
+    if (result == JPEG_OK) {
+        result = plan(crop);
+    }
+    if (result == JPEG_OK && rotation != JPEG_ROTATE_0) {
+        positions = static_cast<uint32_t*>(arena->alloc((size_t) indexColumns * indexRows * sizeof(uint32_t)));
+        predictors = static_cast<int16_t*>(
+            arena->alloc((size_t) indexColumns * indexRows * JPEG_MAX_COMPONENTS * sizeof(int16_t), alignof(int16_t)));
+        if (positions == nullptr || predictors == nullptr) {
+            result = JPEG_ERROR_MEMORY;
+        }
+    }
+    if (result == JPEG_OK) {
+        // Quarter turns transpose the blocks and their quantization tables
+        uint8_t quant[2][JPEG_BLOCK_SIZE];
+        for (int table = 0; table < 2; table++) {
+            const uint8_t* source = decoder->getQuantTable(table);
+            for (int v = 0; v < 8; v++) {
+                for (int u = 0; u < 8; u++) {
+                    quant[table][v * 8 + u] = turned ? source[u * 8 + v] : source[v * 8 + u];
+                }
+            }
+        }
+        int subsampling = decoder->getSubsampling();
+        if (turned && subsampling == JPEG_SUBSAMPLING_422) {
+            subsampling = JPEG_SUBSAMPLING_440;
+        } else if (turned && subsampling == JPEG_SUBSAMPLING_440) {
+            subsampling = JPEG_SUBSAMPLING_422;
+        }
+        encoder = new (encoderStorage) JpegEncoder();
+        result = encoder->begin(outputWidth, outputHeight, subsampling, quant[0], quant[1], writer, context,
+                                decoder->getRestartInterval());
+    }
+    if (result == JPEG_OK) {
+        result = rotation != JPEG_ROTATE_0 ? turnCrop() : copyCrop();
+    }
+    if (result == JPEG_OK) {
+        result = encoder->finish();
+    }
+    arena->release(mark);
+    return result;
+}
+
+int JpegTransform::plan(int crop) {
+    int mcuWidth = decoder->getMcuWidth();
+    int mcuHeight = decoder->getStripHeight();
+    blocksX = mcuWidth / 8;
+    blocksY = mcuHeight / 8;
+    bool flipped = rotation != JPEG_ROTATE_0;
+    if (flipped) {
+        // The partial MCUs of the right and bottom edges would end up inside the frame
+        sourceColumns = decoder->getWidth() / mcuWidth;
+        sourceRows = decoder->getHeight() / mcuHeight;
+    } else {
+        sourceColumns = decoder->getMcusPerStrip();
+        sourceRows = decoder->getStripCount();
+    }
+    if (sourceColumns == 0 || sourceRows == 0) {
+        return JPEG_ERROR_UNSUPPORTED;
+    }
+
+    // The whole turned frame, in output MCUs
+    int columns = turned ? sourceRows : sourceColumns;
+    int rows = turned ? sourceColumns : sourceRows;
+    int outputMcuWidth = turned ? mcuHeight : mcuWidth;
+    int outputMcuHeight = turned ? mcuWidth : mcuHeight;
+    int frameWidth = flipped ? columns * outputMcuWidth : decoder->getWidth();
+    int frameHeight = flipped ? rows * outputMcuHeight : decoder->getHeight();
+
+    int cropWidth = frameWidth;
+    int cropHeight = frameHeight;
+    if (crop != JPEG_CROP_FULL) {
+        // Landscape or portrait, following the turned frame
+        int ratioWidth = crop == JPEG_CROP_SQUARE ? 1 : (frameWidth >= frameHeight ? 3 : 2);
+        int ratioHeight = crop == JPEG_CROP_SQUARE ? 1 : (frameWidth >= frameHeight ? 2 : 3);
+        if ((int64_t) frameWidth * ratioHeight > (int64_t) frameHeight * ratioWidth) {
+            cropWidth = (int) ((int64_t) frameHeight * ratioWidth / ratioHeight);
+        } else {
+            cropHeight = (int) ((int64_t) frameWidth * ratioHeight / ratioWidth);
+        }
+    }
+    if (cropWidth == frameWidth && cropHeight == frameHeight) {
+        cropColumns = columns;
+        cropRows = rows;
+        outputWidth = frameWidth;
+        outputHeight = frameHeight;
+    } else {
+        cropColumns = cropWidth / outputMcuWidth;
+        cropRows = cropHeight / outputMcuHeight;
+        outputWidth = cropColumns * outputMcuWidth;
+        outputHeight = cropRows * outputMcuHeight;
+    }
+    if (cropColumns == 0 || cropRows == 0) {
+        return JPEG_ERROR_UNSUPPORTED;
+    }
+    cropColumn = (columns - cropColumns) / 2;
+    cropRow = (rows - cropRows) / 2;
+
+    // The source MCUs under the crop, from two opposite corners
+    int firstColumn, firstRow, lastColumn, lastRow;
+    sourceMcu(cropColumn, cropRow, &firstColumn, &firstRow);
+    sourceMcu(cropColumn + cropColumns - 1, cropRow + cropRows - 1, &lastColumn, &lastRow);
+    indexColumn = firstColumn < lastColumn ? firstColumn : lastColumn;
+    indexRow = firstRow < lastRow ? firstRow : lastRow;
+    indexColumns = (firstColumn < lastColumn ? lastColumn - firstColumn : firstColumn - lastColumn) + 1;
+    indexRows = (firstRow < lastRow ? lastRow - firstRow : firstRow - lastRow) + 1;
+    return JPEG_OK;
+}
+
+void JpegTransform::sourceMcu(int column, int row, int* sourceColumn, int* sourceRow) const {
+    switch (rotation) {
+        case JPEG_ROTATE_90:
+            *sourceColumn = row;
+            *sourceRow = sourceRows - 1 - column;
+            break;
+        case JPEG_ROTATE_180:
+            *sourceColumn = sourceColumns - 1 - column;
+            *sourceRow = sourceRows - 1 - row;
+            break;
+        case JPEG_ROTATE_270:
+            *sourceColumn = sourceColumns - 1 - row;
+            *sourceRow = column;
+            break;
+        default:
+            *sourceColumn = column;
+            *sourceRow = row;
+            break;
+    }
+}
+
+int JpegTransform::indexScan() {
+    size_t scanStart = decoder->getScanStart();
+    int mcusPerStrip = decoder->getMcusPerStrip();
+    int lastRow = indexRow + indexRows - 1;
+    for (int row = 0; row <= lastRow; row++) {
+        for (int column = 0; column < mcusPerStrip; column++) {
+            if (row >= indexRow && column >= indexColumn && column < indexColumn + indexColumns) {
+                size_t entry = (size_t) (row - indexRow) * indexColumns + (column - indexColumn);
+                int bit = 0;
+                size_t offset = decoder->getScanPosition(&bit);
+                positions[entry] = (uint32_t) ((offset - scanStart) * 8 + bit);
+                decoder->getDcPredictors(&predictors[entry * JPEG_MAX_COMPONENTS]);
+            }
+            if (decoder->decodeMcu(sourceBlocks) != JPEG_OK) {
+                return JPEG_ERROR_DATA;
+            }
+        }
+    }
+    return JPEG_OK;
+}
+
+int JpegTransform::copyCrop() {
+    int mcusPerStrip = decoder->getMcusPerStrip();
+    int lastRow = cropRow + cropRows - 1;
+    for (int row = 0; row <= lastRow; row++) {
+        for (int column = 0; column < mcusPerStrip; column++) {
+            if (decoder->decodeMcu(sourceBlocks) != JPEG_OK) {
+                return JPEG_ERROR_DATA;
+            }
+            if (row >= cropRow && column >= cropColumn && column < cropColumn + cropColumns) {
+                int result = encoder->encodeMcu(sourceBlocks);
+                if (result != JPEG_OK) {
+                    return result;
+                }
+            }
+        }
+    }
+    return JPEG_OK;
+}
+
+int JpegTransform::turnCrop() {
+    int result = indexScan();
+    if (result != JPEG_OK) {
+        return result;
+    }
+
+    size_t scanStart = decoder->getScanStart();
+    int mcusPerStrip = decoder->getMcusPerStrip();
+    for (int row = cropRow; row < cropRow + cropRows; row++) {
+        for (int column = cropColumn; column < cropColumn + cropColumns; column++) {
+            int sourceColumn, sourceRow;
+            sourceMcu(column, row, &sourceColumn, &sourceRow);
+            size_t entry = (size_t) (sourceRow - indexRow) * indexColumns + (sourceColumn - indexColumn);
+            decoder->seekMcu(sourceRow * mcusPerStrip + sourceColumn, scanStart + positions[entry] / 8, positions[entry] % 8,
+                             &predictors[entry * JPEG_MAX_COMPONENTS]);
+            if (decoder->decodeMcu(sourceBlocks) != JPEG_OK) {
+                return JPEG_ERROR_DATA;
+            }
+            turnMcu(sourceBlocks, outputBlocks);
+            result = encoder->encodeMcu(outputBlocks);
+            if (result != JPEG_OK) {
+                return result;
+            }
+        }
+    }
+    return JPEG_OK;
+}
+
+void JpegTransform::turnMcu(const int16_t* source, int16_t* output) const {
+    int lumaBlocks = blocksX * blocksY;
+    int outputBlocksX = turned ? blocksY : blocksX;
+    // A flip negates the odd frequencies across it, a quarter turn is a transpose and a flip
+    int flipU = rotation == JPEG_ROTATE_90 || rotation == JPEG_ROTATE_180 ? 1 : 0;
+    int flipV = rotation == JPEG_ROTATE_270 || rotation == JPEG_ROTATE_180 ? 1 : 0;
+    for (int block = 0; block < lumaBlocks + 2; block++) {
+        // Luma blocks move inside the MCU, the chroma blocks stay after them
+        int from = block;
+        if (block < lumaBlocks) {
+            int x = block % outputBlocksX;
+            int y = block / outputBlocksX;
+            int sourceX, sourceY;
+            switch (rotation) {
+                case JPEG_ROTATE_90:
+                    sourceX = y;
+                    sourceY = blocksY - 1 - x;
+                    break;
+                case JPEG_ROTATE_180:
+                    sourceX = blocksX - 1 - x;
+                    sourceY = blocksY - 1 - y;
+                    break;
+                case JPEG_ROTATE_270:
+                    sourceX = blocksX - 1 - y;
+                    sourceY = x;
+                    break;
+                default:
+                    sourceX = x;
+                    sourceY = y;
+                    break;
+            }
+            from = sourceY * blocksX + sourceX;
+        }
+
+        const int16_t* in = source + from * JPEG_BLOCK_SIZE;
+        int16_t* out = output + block * JPEG_BLOCK_SIZE;
+        for (int v = 0; v < 8; v++) {
+            for (int u = 0; u < 8; u++) {
+                int16_t value = turned ? in[u * 8 + v] : in[v * 8 + u];
+                out[v * 8 + u] = ((u & flipU) + (v & flipV)) & 1 ? (int16_t) -value : value;
+            }
+        }
+    }
+}
+
+int JpegTransform::getOutputWidth() const {
+    return outputWidth;
+}
+
+int JpegTransform::getOutputHeight() const {
+    return outputHeight;
+}
+
+size_t JpegTransform::requiredBytes(int width, int height, int subsampling) {
+    int horizontal, vertical;
+    jpegSamplingFactors(subsampling, &horizontal, &vertical);
+    size_t mcus = (size_t) (width / (horizontal * 8)) * (height / (vertical * 8));
+    return sizeof(JpegDecoder) + sizeof(JpegEncoder) + 2 * TRANSFORM_MAX_MCU_BLOCKS * JPEG_BLOCK_SIZE * sizeof(int16_t) +
+           mcus * TRANSFORM_INDEX_BYTES + 6 * TRANSFORM_ALIGN_SLACK;
+}
@@ -0,0 +1,156 @@
+#ifndef RETROLENS_JPEG_TRANSFORM_H
+#define RETROLENS_JPEG_TRANSFORM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ImageArena.h"
+#include "JpegDecoder.h"
+#include "JpegEncoder.h"
+
+// Clockwise rotations
+#define JPEG_ROTATE_0 0
+#define JPEG_ROTATE_90 1
+#define JPEG_ROTATE_180 2
+#define JPEG_ROTATE_270 3
+#define JPEG_ROTATE_COUNT 4
+
+// Crops to a film format, centered and along the long side of the turned frame
+#define JPEG_CROP_FULL 0   // The whole frame
+#define JPEG_CROP_3_2 1    // 35 mm film
+#define JPEG_CROP_SQUARE 2 // 6x6 medium format
+#define JPEG_CROP_COUNT 3
+
+/**
+ * @class JpegTransform
+ * @brief Rotates and crops a JPEG without loss, by moving its DCT blocks instead of its pixels.
+ *
+ * The blocks keep their quantized coefficients, rotations only transpose them and flip the sign
+ * of their odd frequencies, so nothing is quantized a second time. The output is coded MCU by
+ * MCU straight into the writer, in the row order of the turned frame:
+ *
+ * - Without rotation the source is read once, the MCUs out of the crop are decoded and dropped.
+ * - With a rotation, a half turn too, a first pass notes where each MCU of the crop starts in
+ *   the scan and its DC predictions, the second pass seeks to the MCUs in output order. The
+ *   index is 10 bytes per MCU, 384 KB at QSXGA, the pixels are never held.
+ *
+ * Turned frames are trimmed to whole MCUs, as the partial MCUs of the right and bottom edges
+ * would land at the top or left. A quarter turn of 4:2:2 gives 4:4:0, the chroma stays as it was
+ * sampled. The crop is snapped to the MCU grid of the output.
+ *
+ * Example usage:
+ * @code
+ * JpegTransform transform(&arena);
+ * transform.write(fb->buf, fb->len, JPEG_ROTATE_90, JPEG_CROP_3_2, writeToFile, &file);
+ * @endcode
+ */
+class JpegTransform {
+public:
+    /**
+     * @brief Constructor for JpegTransform.
+     *
+     * @param arena Memory budget of the transform, used from its current mark.
+     */
+    JpegTransform(ImageArena* arena);
+
+    /**
+     * @brief Write a turned and cropped copy of a JPEG.
+     *
+     * @param data JPEG file.
+     * @param length Size of the file.
+     * @param rotation One of the JPEG_ROTATE_* values.
+     * @param crop One of the JPEG_CROP_* values.
+     * @param writer Output sink.
+     * @param context Context of the writer.
+     * @return int JPEG_OK or a JPEG_ERROR_* code, JPEG_ERROR_UNSUPPORTED for grayscale or a frame smaller than an MCU.
+     */
+    int write(const uint8_t* data, size_t length, int rotation, int crop, JpegWriter writer, void* context);
+
+    /**
+     * @brief Get the width of the last output.
+     */
+    int getOutputWidth() const;
+
+    /**
+     * @brief Get the height of the last output.
+     */
+    int getOutputHeight() const;
+
+    /**
+     * @brief Get the memory a transform needs from its arena, for any rotation and crop.
+     *
+     * @param width Frame width.
+     * @param height Frame height.
+     * @param subsampling One of the JPEG_SUBSAMPLING_* values.
+     * @return size_t Upper bound in bytes.
+     */
+    static size_t requiredBytes(int width, int height, int subsampling);
+
+private:
+    /**
+     * @brief Size the output and place the crop once the source headers are read.
+     *
+     * @return int JPEG_OK or JPEG_ERROR_UNSUPPORTED.
+     */
+    int plan(int crop);
+
+    /**
+     * @brief Find the source MCU of an MCU of the whole turned frame.
+     */
+    void sourceMcu(int column, int row, int* sourceColumn, int* sourceRow) const;
+
+    /**
+     * @brief Note the scan position and the DC predictions of the source MCUs under the crop.
+     *
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int indexScan();
+
+    /**
+     * @brief Code the crop of a frame that is not turned, in one pass over the source.
+     *
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int copyCrop();
+
+    /**
+     * @brief Code the crop of a rotated frame, seeking to each source MCU.
+     *
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int turnCrop();
+
+    /**
+     * @brief Move and turn the blocks of one MCU.
+     *
+     * @param source Blocks of the source MCU.
+     * @param output Blocks of the output MCU.
+     */
+    void turnMcu(const int16_t* source, int16_t* output) const;
+
+    ImageArena* arena;        ///< Memory budget.
+    JpegDecoder* decoder;     ///< Coefficient reader of the source.
+    JpegEncoder* encoder;     ///< Output.
+    int16_t* sourceBlocks;    ///< Blocks of the MCU read.
+    int16_t* outputBlocks;    ///< Blocks of the MCU coded.
+    uint32_t* positions;      ///< Scan bit of each indexed MCU, from the scan start.
+    int16_t* predictors;      ///< DC predictions before each indexed MCU, one per component.
+    int rotation;             ///< One of the JPEG_ROTATE_* values.
+    bool turned;              ///< True if rows and columns swap.
+    int blocksX;              ///< Luma blocks across a source MCU.
+    int blocksY;              ///< Luma blocks down a source MCU.
+    int sourceColumns;        ///< Whole MCUs across the source.
+    int sourceRows;           ///< Whole MCUs down the source.
+    int cropColumn;           ///< First output MCU column of the crop, in the whole turned frame.
+    int cropRow;              ///< First output MCU row of the crop.
+    int cropColumns;          ///< MCUs across the output.
+    int cropRows;             ///< MCUs down the output.
+    int indexColumn;          ///< First source MCU column under the crop.
+    int indexRow;             ///< First source MCU row under the crop.
+    int indexColumns;         ///< Source MCUs across the crop.
+    int indexRows;            ///< Source MCUs down the crop.
+    int outputWidth;          ///< Width of the last output.
+    int outputHeight;         ///< Height of the last output.
+};
+
+#endif // RETROLENS_JPEG_TRANSFORM_H
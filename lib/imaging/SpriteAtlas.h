@@ -0,0 +1,35 @@
+#ifndef RETROLENS_SPRITE_ATLAS_H
+#define RETROLENS_SPRITE_ATLAS_H
+
+#include <stdint.h>
+
+/**
+ * @struct Sprite
+ * @brief One image of a sprite atlas.
+ */
+typedef struct Sprite {
+    uint8_t width;   ///< Width in pixels.
+    uint8_t height;  ///< Height in pixels.
+    uint16_t offset; ///< Offset of its coded pages in the atlas data.
+} Sprite;
+
+/**
+ * @struct SpriteAtlas
+ * @brief The UI images, 1 bit a pixel, packed in one run-length coded array.
+ *
+ * Atlases are generated at build time by scripts/atlas_to_code.py, from the images in
+ * resources/images, and kept in flash. Each sprite is coded in SSD1306 page order: a byte is
+ * 8 rows of a column with the top row in bit 0, a page is a byte for each column, pages go
+ * down from the top. The bytes are coded in blocks: a control byte below 0x80 is followed by
+ * that many plus one literal bytes, a control byte from 0x80 by one byte repeated the control
+ * minus 0x7E times.
+ *
+ * Plain C, the generated atlases are C sources.
+ */
+typedef struct SpriteAtlas {
+    const uint8_t* data;    ///< Coded pages of every sprite.
+    const Sprite* sprites;  ///< Sprites, by index.
+    uint16_t count;         ///< Number of sprites.
+} SpriteAtlas;
+
+#endif // RETROLENS_SPRITE_ATLAS_H
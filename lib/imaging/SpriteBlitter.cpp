@@ -0,0 +1,69 @@
+#include "SpriteBlitter.h"
+
+SpriteBlitter::SpriteBlitter(uint8_t* buffer, int width, int height) : buffer(buffer), width(width), pages(height / 8) {}
+
+// Merge a byte of the sprite into a byte of the buffer
+static inline void merge(uint8_t* target, uint8_t bits, int mode) {
+    if (mode == SPRITE_BLIT_SET) {
+        *target |= bits;
+    } else if (mode == SPRITE_BLIT_CLEAR) {
+        *target &= (uint8_t) ~bits;
+    } else {
+        *target ^= bits;
+    }
+}
+
+void SpriteBlitter::draw(const SpriteAtlas& atlas, int sprite, int x, int y, int mode) {
+    if (buffer == nullptr || sprite < 0 || sprite >= atlas.count) {
+        return;
+    }
+    const Sprite& info = atlas.sprites[sprite];
+    const uint8_t* data = atlas.data + info.offset;
+    int spritePages = (info.height + 7) / 8;
+
+    // A page of the sprite straddles two pages of the buffer, unless its rows line up
+    int topPage = y >= 0 ? y / 8 : -((7 - y) / 8);
+    int shift = y - topPage * 8;
+    int columnStart = x < 0 ? -x : 0;
+    int columnEnd = x + info.width > width ? width - x : info.width;
+    if (columnStart >= columnEnd || topPage + spritePages < 0 || topPage >= pages) {
+        return;
+    }
+
+    int page = 0;
+    int column = 0;
+    uint8_t* upper = nullptr;
+    uint8_t* lower = nullptr;
+    auto startPage = [&]() {
+        int bufferPage = topPage + page;
+        upper = bufferPage >= 0 && bufferPage < pages ? buffer + bufferPage * width : nullptr;
+        lower = shift != 0 && bufferPage + 1 >= 0 && bufferPage + 1 < pages ? buffer + (bufferPage + 1) * width : nullptr;
+    };
+    startPage();
+
+    // Decode in one pass, each byte goes to its column of the current page
+    int total = spritePages * info.width;
+    for (int decoded = 0; decoded < total;) {
+        uint8_t control = *data++;
+        bool run = control >= SPRITE_RUN_FLAG;
+        int length = run ? control - SPRITE_RUN_FLAG + SPRITE_MIN_RUN : control + 1;
+        uint8_t value = run ? *data++ : 0;
+        for (int i = 0; i < length; i++) {
+            uint8_t bits = run ? value : *data++;
+            if (bits != 0 && column >= columnStart && column < columnEnd) {
+                if (upper != nullptr) {
+                    merge(upper + x + column, (uint8_t) (bits << shift), mode);
+                }
+                if (lower != nullptr) {
+                    merge(lower + x + column, (uint8_t) (bits >> (8 - shift)), mode);
+                }
+            }
+            if (++column == info.width) {
+                column = 0;
+                page++;
+                startPage();
+            }
+        }
+        decoded += length;
+    }
+}
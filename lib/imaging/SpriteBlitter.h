@@ -0,0 +1,60 @@
+#ifndef RETROLENS_SPRITE_BLITTER_H
+#define RETROLENS_SPRITE_BLITTER_H
+
+#include <stdint.h>
+
+#include "SpriteAtlas.h"
+
+// How the lit pixels of a sprite change the display, the colors of the display driver
+#define SPRITE_BLIT_SET 0    // Lit pixels are turned on
+#define SPRITE_BLIT_CLEAR 1  // Lit pixels are turned off
+#define SPRITE_BLIT_INVERT 2 // Lit pixels are flipped
+
+// Run-length coding of the atlas, see SpriteAtlas
+#define SPRITE_RUN_FLAG 0x80
+#define SPRITE_MIN_RUN 2
+
+/**
+ * @class SpriteBlitter
+ * @brief Draws the sprites of an atlas straight into the frame buffer of an SSD1306 display.
+ *
+ * The display buffer has the page order of the atlas, so a decoded byte is 8 pixels of the
+ * screen: it is shifted to the row of the sprite and merged into one or two pages of the
+ * buffer. Sprites are decoded page by page, in one pass over their data, and clipped to the
+ * screen. Only the lit pixels are drawn, like drawXbm() of the display driver.
+ *
+ * Example usage:
+ * @code
+ * SpriteBlitter blitter(display.buffer, display.getWidth(), display.getHeight());
+ * blitter.draw(UI_SPRITES, SPRITE_BATTERY, 5, 5);
+ * @endcode
+ */
+class SpriteBlitter {
+public:
+    /**
+     * @brief Constructor for SpriteBlitter.
+     *
+     * @param buffer Display buffer, a byte for each column of each page.
+     * @param width Width of the display in pixels.
+     * @param height Height of the display in pixels, whole pages.
+     */
+    SpriteBlitter(uint8_t* buffer, int width, int height);
+
+    /**
+     * @brief Draw a sprite.
+     *
+     * @param atlas Atlas of the sprite.
+     * @param sprite Index of the sprite, SPRITE_* of the generated atlas.
+     * @param x Column of the left edge, may be off the screen.
+     * @param y Row of the top edge, may be off the screen.
+     * @param mode One of the SPRITE_BLIT_* values.
+     */
+    void draw(const SpriteAtlas& atlas, int sprite, int x, int y, int mode = SPRITE_BLIT_SET);
+
+private:
+    uint8_t* buffer; ///< Display buffer.
+    int width;       ///< Columns of the display.
+    int pages;       ///< Pages of the display.
+};
+
+#endif // RETROLENS_SPRITE_BLITTER_H
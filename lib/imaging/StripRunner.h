@@ -0,0 +1,49 @@
+#ifndef RETROLENS_STRIP_RUNNER_H
+#define RETROLENS_STRIP_RUNNER_H
+
+// Strip work is split in this many lanes, one per core
+#define STRIP_LANES 2
+
+/**
+ * @brief Work of one lane.
+ *
+ * @param arg Argument given to the runner.
+ * @param lane Lane index, 0 to STRIP_LANES - 1.
+ */
+typedef void (*StripLaneFunction)(void* arg, int lane);
+
+/**
+ * @class StripRunner
+ * @brief Runs the lanes of a strip step, concurrently where the platform can.
+ *
+ * The imaging pipelines call run() once per strip with work already split in STRIP_LANES
+ * independent parts. On the camera the lanes go to both cores, on the host they may run on
+ * threads or one after the other with SerialStripRunner.
+ */
+class StripRunner {
+public:
+    virtual ~StripRunner() {}
+
+    /**
+     * @brief Run every lane and return once all of them are done.
+     *
+     * @param function Work of a lane.
+     * @param arg Argument of the work.
+     */
+    virtual void run(StripLaneFunction function, void* arg) = 0;
+};
+
+/**
+ * @class SerialStripRunner
+ * @brief StripRunner that runs the lanes one after the other on the calling task.
+ */
+class SerialStripRunner : public StripRunner {
+public:
+    void run(StripLaneFunction function, void* arg) override {
+        for (int lane = 0; lane < STRIP_LANES; lane++) {
+            function(arg, lane);
+        }
+    }
+};
+
+#endif // RETROLENS_STRIP_RUNNER_H
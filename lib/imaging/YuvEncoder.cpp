@@ -0,0 +1,145 @@
+#include <new>
+#include <string.h>
+
+#include "YuvEncoder.h"
+
+// Slack of each arena allocation for its alignment
+#define YUV_ALIGN_SLACK 8
+
+YuvEncoder::YuvEncoder(ImageArena* arena)
+    : arena(arena), source(nullptr), width(0), height(0), process(nullptr), mcuRows(0), firstMcuRow(0), bytesWritten(0) {
+    for (int lane = 0; lane < STRIP_LANES; lane++) {
+        laneEncoders[lane] = nullptr;
+        laneRows[lane] = nullptr;
+        laneOutputs[lane] = {nullptr, 0, 0};
+        laneResults[lane] = JPEG_OK;
+    }
+}
+
+bool YuvEncoder::writeToLane(void* context, const uint8_t* data, size_t length) {
+    YuvLaneOutput* output = static_cast<YuvLaneOutput*>(context);
+    if (output->used + length > output->capacity) {
+        return false;
+    }
+    memcpy(output->data + output->used, data, length);
+    output->used += length;
+    return true;
+}
+
+void YuvEncoder::unpackRows(int row, int rows, uint8_t* ycc) const {
+    // Each pair of pixels shares its chroma, as the 4:2:2 MCUs do
+    for (int y = 0; y < rows; y++) {
+        const uint8_t* pair = source + (size_t) (row + y) * width * 2;
+        uint8_t* pixel = ycc + (size_t) y * width * JPEG_YCC_BYTES;
+        for (int x = 0; x < width; x += 2) {
+            pixel[0] = pair[0];
+            pixel[1] = pair[1];
+            pixel[2] = pair[3];
+            pixel[3] = pair[2];
+            pixel[4] = pair[1];
+            pixel[5] = pair[3];
+            pair += 4;
+            pixel += 2 * JPEG_YCC_BYTES;
+        }
+    }
+}
+
+void YuvEncoder::laneJob(void* arg, int lane) {
+    YuvEncoder* encoder = static_cast<YuvEncoder*>(arg);
+    YuvLaneOutput* output = &encoder->laneOutputs[lane];
+    output->used = 0;
+    int mcuRow = encoder->firstMcuRow + lane;
+    if (mcuRow >= encoder->mcuRows) {
+        encoder->laneResults[lane] = JPEG_OK;
+        return;
+    }
+    int row = mcuRow * 8;
+    int rows = encoder->height - row < 8 ? encoder->height - row : 8;
+    uint8_t* ycc = encoder->laneRows[lane];
+    encoder->unpackRows(row, rows, ycc);
+    if (encoder->process != nullptr) {
+        encoder->process->processStrip(ycc, (size_t) encoder->width * JPEG_YCC_BYTES, encoder->width, rows, row);
+    }
+    encoder->laneResults[lane] = encoder->laneEncoders[lane]->encodeInterval(mcuRow, ycc, (size_t) encoder->width * JPEG_YCC_BYTES);
+}
+
+int YuvEncoder::write(const uint8_t* yuyv, int width, int height, int quality, const FilmProcess* process, JpegWriter writer,
+                      void* context, StripRunner* runner) {
+    if (width <= 0 || height <= 0 || width % 2 != 0) {
+        return JPEG_ERROR_UNSUPPORTED;
+    }
+    SerialStripRunner serialRunner;
+    if (runner == nullptr) {
+        runner = &serialRunner;
+    }
+    source = yuyv;
+    this->width = width;
+    this->height = height;
+    this->process = process;
+    mcuRows = (height + 7) / 8;
+    bytesWritten = 0;
+
+    size_t mark = arena->getMark();
+    size_t mcusPerRow = (width + 15) / 16;
+    void* storage = arena->alloc(sizeof(JpegEncoder), alignof(JpegEncoder));
+    bool allocated = storage != nullptr;
+    for (int lane = 0; lane < STRIP_LANES && allocated; lane++) {
+        void* laneStorage = arena->alloc(sizeof(JpegEncoder), alignof(JpegEncoder));
+        laneRows[lane] = static_cast<uint8_t*>(arena->alloc((size_t) width * JPEG_YCC_BYTES * 8));
+        laneOutputs[lane].capacity = mcusPerRow * YUV_ENCODER_MCU_BYTES;
+        laneOutputs[lane].data = static_cast<uint8_t*>(arena->alloc(laneOutputs[lane].capacity));
+        laneOutputs[lane].used = 0;
+        allocated = laneStorage != nullptr && laneRows[lane] != nullptr && laneOutputs[lane].data != nullptr;
+        laneEncoders[lane] = allocated ? new (laneStorage) JpegEncoder() : nullptr;
+    }
+    if (!allocated) {
+        arena->release(mark);
+        return JPEG_ERROR_MEMORY;
+    }
+
+    uint8_t lumaQuant[JPEG_BLOCK_SIZE];
+    uint8_t chromaQuant[JPEG_BLOCK_SIZE];
+    jpegScaleQuantTable(JPEG_STD_LUMA_QUANT, quality, lumaQuant);
+    jpegScaleQuantTable(JPEG_STD_CHROMA_QUANT, quality, chromaQuant);
+
+    // One restart interval a row, the lanes code their rows apart
+    JpegEncoder* encoder = new (storage) JpegEncoder();
+    int result = encoder->begin(width, height, JPEG_SUBSAMPLING_422, lumaQuant, chromaQuant, writer, context, (uint16_t) mcusPerRow);
+    for (int lane = 0; lane < STRIP_LANES && result == JPEG_OK; lane++) {
+        result = laneEncoders[lane]->beginIntervals(width, height, JPEG_SUBSAMPLING_422, lumaQuant, chromaQuant, writeToLane,
+                                                    &laneOutputs[lane]);
+    }
+    for (firstMcuRow = 0; result == JPEG_OK && firstMcuRow < mcuRows; firstMcuRow += STRIP_LANES) {
+        runner->run(laneJob, this);
+        for (int lane = 0; lane < STRIP_LANES && result == JPEG_OK && firstMcuRow + lane < mcuRows; lane++) {
+            result = laneResults[lane];
+            if (result == JPEG_OK) {
+                result = encoder->appendInterval(laneOutputs[lane].data, laneOutputs[lane].used);
+            }
+        }
+    }
+    if (result == JPEG_OK) {
+        result = encoder->finish();
+    }
+    bytesWritten = encoder->getBytesWritten();
+    arena->release(mark);
+    for (int lane = 0; lane < STRIP_LANES; lane++) {
+        laneEncoders[lane] = nullptr;
+        laneRows[lane] = nullptr;
+        laneOutputs[lane] = {nullptr, 0, 0};
+    }
+    source = nullptr;
+    return result;
+}
+
+uint32_t YuvEncoder::getBytesWritten() const {
+    return bytesWritten;
+}
+
+size_t YuvEncoder::requiredBytes(int width) {
+    size_t mcusPerRow = (width + 15) / 16;
+    // The file encoder, then per lane: an encoder, 8 rows of YCbCr and an MCU row of coded data
+    size_t laneBytes = sizeof(JpegEncoder) + (size_t) width * JPEG_YCC_BYTES * 8 + mcusPerRow * YUV_ENCODER_MCU_BYTES +
+                       3 * YUV_ALIGN_SLACK;
+    return sizeof(JpegEncoder) + YUV_ALIGN_SLACK + STRIP_LANES * laneBytes;
+}
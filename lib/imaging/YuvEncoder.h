@@ -0,0 +1,122 @@
+#ifndef RETROLENS_YUV_ENCODER_H
+#define RETROLENS_YUV_ENCODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FilmProcess.h"
+#include "ImageArena.h"
+#include "JpegEncoder.h"
+#include "StripRunner.h"
+
+// Rows coded at once, one 4:2:2 MCU row per lane
+#define YUV_ENCODER_STRIP_ROWS (8 * STRIP_LANES)
+
+// Longest 4:2:2 MCU: four blocks of the longest DC and 63 longest AC codes, every byte stuffed
+#define YUV_ENCODER_MCU_BYTES 1664
+
+/**
+ * @struct YuvLaneOutput
+ * @brief Coded interval of a lane, waiting for its turn in the file.
+ */
+struct YuvLaneOutput {
+    uint8_t* data;   ///< Coded bytes.
+    size_t capacity; ///< Size of the buffer, an MCU row at its longest.
+    size_t used;     ///< Bytes coded.
+};
+
+/**
+ * @class YuvEncoder
+ * @brief Encodes a YUV422 frame of the sensor to a 4:2:2 JPEG, through the film processing stage, on both cores.
+ *
+ * The frame goes in strips of YUV_ENCODER_STRIP_ROWS rows, one MCU row to each lane. A lane
+ * unpacks its row to interleaved YCbCr, runs the FilmProcess over it and codes it with its own
+ * JpegEncoder as one restart interval, into a buffer of its own. The intervals are then
+ * written in order, between restart markers, by the encoder streaming the file to the writer.
+ * A restart interval of one MCU row costs two bytes a row and lets the rows be coded apart.
+ *
+ * Memory is a few rows of pixels and coded data per lane from the ImageArena, whatever the
+ * frame height.
+ *
+ * Example usage:
+ * @code
+ * YuvEncoder encoder(&arena);
+ * encoder.write(fb->buf, fb->width, fb->height, 90, &process, writeToFile, &file, &runner);
+ * @endcode
+ */
+class YuvEncoder {
+public:
+    /**
+     * @brief Constructor for YuvEncoder.
+     *
+     * @param arena Memory budget of the encoder, used from its current mark.
+     */
+    YuvEncoder(ImageArena* arena);
+
+    /**
+     * @brief Encode a frame and stream the JPEG to a writer.
+     *
+     * @param yuyv Pixels as Y0 U Y1 V, two bytes a pixel, row after row.
+     * @param width Frame width, even.
+     * @param height Frame height.
+     * @param quality IJG quality of the quantization tables, 1 to 100.
+     * @param process Film processing stage, nullptr for none.
+     * @param writer Output sink.
+     * @param context Context of the writer.
+     * @param runner Runner of the lanes, nullptr to run them serially.
+     * @return int JPEG_OK or a JPEG_ERROR_* code, JPEG_ERROR_UNSUPPORTED for an odd width.
+     */
+    int write(const uint8_t* yuyv, int width, int height, int quality, const FilmProcess* process, JpegWriter writer,
+              void* context, StripRunner* runner = nullptr);
+
+    /**
+     * @brief Get the size of the JPEG of the last write().
+     */
+    uint32_t getBytesWritten() const;
+
+    /**
+     * @brief Get the memory the encoder needs from its arena.
+     *
+     * @param width Frame width.
+     * @return size_t Upper bound in bytes.
+     */
+    static size_t requiredBytes(int width);
+
+private:
+    /**
+     * @brief Lane work: unpack, process and code the MCU row of a lane in the current strip.
+     *
+     * @param arg Pointer to the YuvEncoder.
+     * @param lane Lane index.
+     */
+    static void laneJob(void* arg, int lane);
+
+    /**
+     * @brief JpegWriter appending to a YuvLaneOutput.
+     */
+    static bool writeToLane(void* context, const uint8_t* data, size_t length);
+
+    /**
+     * @brief Unpack rows of YUYV to interleaved YCbCr.
+     *
+     * @param row First row.
+     * @param rows Number of rows.
+     * @param ycc Output rows.
+     */
+    void unpackRows(int row, int rows, uint8_t* ycc) const;
+
+    ImageArena* arena;                          ///< Memory budget.
+    const uint8_t* source;                      ///< Frame being encoded.
+    int width;                                  ///< Frame width.
+    int height;                                 ///< Frame height.
+    const FilmProcess* process;                 ///< Film processing stage, nullptr for none.
+    int mcuRows;                                ///< MCU rows of the frame.
+    int firstMcuRow;                            ///< MCU row of lane 0 in the current strip.
+    JpegEncoder* laneEncoders[STRIP_LANES];     ///< Interval coder of each lane.
+    uint8_t* laneRows[STRIP_LANES];             ///< Interleaved YCbCr rows of each lane.
+    YuvLaneOutput laneOutputs[STRIP_LANES];     ///< Coded interval of each lane.
+    int laneResults[STRIP_LANES];               ///< Result of the last lane run.
+    uint32_t bytesWritten;                      ///< Size of the last JPEG.
+};
+
+#endif // RETROLENS_YUV_ENCODER_H
@@ -2,8 +2,26 @@
 #include "BatteryReaderService.h"
 
 BatteryReaderService::BatteryReaderService(uint8_t analogPin, uint8_t controlPin)
-    : analogPin(analogPin), controlPin(controlPin), lastBatteryLevel(0.0f), batteryReadTaskHandle(nullptr), resultQueue(nullptr) {
-    batteryMutex = xSemaphoreCreateMutex();
+    : analogPin(analogPin), controlPin(controlPin), lastBatteryLevel(0.0f), batteryReadPending(false),
+      sampler(BATTERY_DIVIDER_RATIO) {
+    vPortCPUInitializeMutex(&pendingLock);
+    batteryMutex = xSemaphoreCreateMutexStatic(&batteryMutexBuffer);
+    // The battery pin is on ADC2, read with the default 12 bit width and 11 dB attenuation
+    esp_adc_cal_characterize(ADC_UNIT_2, ADC_ATTEN_DB_11, ADC_WIDTH_BIT_12, BATTERY_DEFAULT_VREF_MV, &adcCharacteristics);
+    batteryTimer = xTimerCreateStatic("BatteryTimer", pdMS_TO_TICKS(BATTERY_SAMPLE_PERIOD_MS), pdTRUE, this,
+                                      batteryTimerCallback, &batteryTimerBuffer);
+}
+
+void BatteryReaderService::begin(bool readNow) {
+    if (readNow) {
+        requestBatteryRead();
+    }
+    xTimerStart(batteryTimer, 0);
+}
+
+void BatteryReaderService::batteryTimerCallback(TimerHandle_t timer) {
+    // Runs in the timer task, the request only takes a spinlock and queues a job
+    static_cast<BatteryReaderService*>(pvTimerGetTimerID(timer))->requestBatteryRead();
 }
 
 void BatteryReaderService::initBatteryRead(long timeout) {
@@ -20,9 +38,13 @@ void BatteryReaderService::closeBatteryRead() {
 }
 
 float BatteryReaderService::readBatteryLevel() {
+    uint16_t millivolts[BATTERY_BURST_SAMPLES];
+    sampleBurst(millivolts);
+
     if (xSemaphoreTake(batteryMutex, portMAX_DELAY) == pdTRUE) {
-        // Read the battery voltage and store the result
-        lastBatteryLevel = analogReadBatteryLevel();
+        // Filter the burst and store the state of charge
+        sampler.addBurst(millivolts, BATTERY_BURST_SAMPLES, millis());
+        lastBatteryLevel = sampler.getStateOfCharge();
         xSemaphoreGive(batteryMutex); // Release the mutex after reading
     }
     return lastBatteryLevel;
@@ -38,32 +60,68 @@ float BatteryReaderService::getLastBatteryLevel() {
     return batteryLevel;
 }
 
-float BatteryReaderService::analogReadBatteryLevel() {
+float BatteryReaderService::getBatteryVoltage() {
+    float voltage = 0.0f;
+    if (xSemaphoreTake(batteryMutex, portMAX_DELAY) == pdTRUE) {
+        voltage = sampler.getVoltage();
+        xSemaphoreGive(batteryMutex);
+    }
+    return voltage;
+}
+
+long BatteryReaderService::getTimeToEmptySeconds() {
+    long seconds = BATTERY_UNKNOWN_TIME;
+    if (xSemaphoreTake(batteryMutex, portMAX_DELAY) == pdTRUE) {
+        seconds = sampler.getTimeToEmptySeconds();
+        xSemaphoreGive(batteryMutex);
+    }
+    return seconds;
+}
+
+void BatteryReaderService::sampleBurst(uint16_t* millivolts) {
     pinMode(controlPin, OUTPUT);  // Set control pin as output
     digitalWrite(controlPin, HIGH);  // Enable the battery voltage divider
-    vTaskDelay(CONTROL_PIN_DELAY_MS / portTICK_PERIOD_MS);  // Wait for the control pin to stabilize
-    // Set analog pin to read
-    int rawAnalogValue = analogRead(analogPin);  // Read raw analog value
+    vTaskDelay(CONTROL_PIN_DELAY_MS / portTICK_PERIOD_MS);  // Wait for the divider to settle
+    analogSetPinAttenuation(analogPin, ADC_11db);
+    // Oversample while the divider is enabled, each reading corrected with the eFuse calibration
+    for (int i = 0; i < BATTERY_BURST_SAMPLES; i++) {
+        int rawAnalogValue = analogRead(analogPin);
+        millivolts[i] = (uint16_t) esp_adc_cal_raw_to_voltage(rawAnalogValue, &adcCharacteristics);
+    }
     digitalWrite(controlPin, LOW);  // Disable the battery voltage divider
     pinMode(analogPin, INPUT_PULLUP); // Set analog pin back to input mode
-    Serial.println(rawAnalogValue);
-    float voltage = (rawAnalogValue / 4095.0) * 3.3;  // Convert raw value to voltage (assuming a 3.3V reference)
-    voltage = batteryLevelToPercentage(voltage);  // Convert voltage to percentage
-    return voltage;
 }
 
-bool BatteryReaderService::startBatteryReadTask(QueueHandle_t resultQueue) {
-    this->resultQueue = resultQueue;
-    // Create the task for reading battery level
-    if (xTaskCreate(batteryReadTask, "BatteryReadTask", 2048, this, 1, &batteryReadTaskHandle) != pdPASS) {
-        return false; // Task creation failed
+bool BatteryReaderService::requestBatteryRead() {
+    // Merge with a read that is already pending, under a spinlock since the timer task calls this and must not block
+    portENTER_CRITICAL(&pendingLock);
+    bool alreadyPending = batteryReadPending;
+    batteryReadPending = true;
+    portEXIT_CRITICAL(&pendingLock);
+    if (alreadyPending) {
+        return true;
     }
 
+    // Queuing a job does not block either
+    if (!GlobalState::getWorkerPool()->submit(JOB_PRIORITY_BACKGROUND, batteryReadJob, this)) {
+        setBatteryReadPending(false);
+        return false;
+    }
     return true;
 }
 
-void BatteryReaderService::batteryReadTask(void* p) {
+void BatteryReaderService::setBatteryReadPending(bool pending) {
+    portENTER_CRITICAL(&pendingLock);
+    batteryReadPending = pending;
+    portEXIT_CRITICAL(&pendingLock);
+}
+
+int BatteryReaderService::batteryReadJob(void* p) {
     BatteryReaderService* service = static_cast<BatteryReaderService*>(p);
+
+    // Requests from now on need a new read
+    service->setBatteryReadPending(false);
+
     // Initialize the battery reading
     service->initBatteryRead();
     // Read the battery level
@@ -72,22 +130,9 @@ void BatteryReaderService::batteryReadTask(void* p) {
     // Close the battery reading
     service->closeBatteryRead();
     
-    // Send the battery level to the queue
-    if (service->resultQueue != nullptr) {
-        xQueueSend(service->resultQueue, &batteryLevel, 0);
-    }
-
-    // Task has finished, delete it
-    service->batteryReadTaskHandle = nullptr;
-    vTaskDelete(nullptr);
-}
-
-float BatteryReaderService::batteryLevelToPercentage(float voltage) {
-    // Clamp the voltage within the min/max range
-    voltage = max(minVoltage, min(maxVoltage, voltage));
-
-    // Map the voltage to a percentage (0% at minVoltage, 100% at maxVoltage)
-    float percentage = ((voltage - minVoltage) / (maxVoltage - minVoltage)) * 100.0;
-
-    return percentage;
+    // Publish the battery level
+    EventPayload payload;
+    payload.batteryLevel = batteryLevel;
+    GlobalState::getEventBus()->publish(EVENT_BATTERY_LEVEL, payload);
+    return 0;
 }
@@ -2,17 +2,32 @@
 #define RETROLENS_BATTERY_READER_SERVICE_H
 
 #include <Arduino.h>
+#include <esp_adc_cal.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 #include <freertos/task.h>
-#include <freertos/queue.h>
+#include <freertos/timers.h>
 
-#define CONTROL_PIN_DELAY_MS 50
+#include "BatterySampler.h"
+
+// Settling time of the voltage divider once enabled, the burst is taken right after
+#define CONTROL_PIN_DELAY_MS 20
+
+// Period of the continuous sampling
+#define BATTERY_SAMPLE_PERIOD_MS 30000
+
+// Reference voltage used when the eFuse holds no calibration
+#define BATTERY_DEFAULT_VREF_MV 1100
 
 /**
  * @class BatteryReaderService
  * @brief Service to handle analog reading of the battery voltage from a specific pin, 
  *        with an option to perform the reading in a task.
+ * 
+ * Reads run as background jobs on the shared worker pool, every BATTERY_SAMPLE_PERIOD_MS once
+ * started and on request. Each read enables the divider, takes an oversampled burst calibrated
+ * with the eFuse ADC characteristics, and feeds it to a BatterySampler for filtering, state of
+ * charge and time-to-empty.
  */
 class BatteryReaderService {
 public:
@@ -20,9 +35,17 @@ public:
      * @brief Constructor for BatteryReaderService.
      * 
      * @param analogPin The analog pin to read the battery voltage from.
+     * @param controlPin The pin enabling the battery voltage divider.
      */
     BatteryReaderService(uint8_t analogPin, uint8_t controlPin);
 
+    /**
+     * @brief Start the continuous sampling.
+     * 
+     * @param readNow Request a first read right away instead of after the first period.
+     */
+    void begin(bool readNow = true);
+
     /**
      * @brief Initialize the BatteryReaderService.
      */
@@ -34,60 +57,84 @@ public:
     void closeBatteryRead();
 
     /**
-     * @brief Reads the battery level (in volts) and stores it.
+     * @brief Samples the battery and stores the filtered level.
      * 
-     * @return The last read battery voltage.
+     * @return The battery level in percent.
      */
     float readBatteryLevel();
 
     /**
-     * @brief Get the last read battery voltage.
+     * @brief Get the last battery level.
      * 
-     * @return The stored battery voltage.
+     * @return The stored battery level in percent.
      */
     float getLastBatteryLevel();
 
     /**
-     * @brief Starts a task that reads the battery level and sends the result to a queue.
+     * @brief Get the filtered battery voltage.
+     * 
+     * @return The battery voltage in volts.
+     */
+    float getBatteryVoltage();
+
+    /**
+     * @brief Get the estimated time until the battery is empty.
      * 
-     * @param resultQueue The FreeRTOS queue to send the result to.
-     * @return True if the task was created successfully, false otherwise.
+     * @return Seconds, or BATTERY_UNKNOWN_TIME while charging or before enough samples.
      */
-    bool startBatteryReadTask(QueueHandle_t resultQueue = nullptr);
+    long getTimeToEmptySeconds();
+
+    /**
+     * @brief Submits a background job that reads the battery level and publishes it as an EVENT_BATTERY_LEVEL event.
+     * 
+     * Requests made while a read is pending are merged into it. Never blocks, so it can be called
+     * from a timer callback.
+     * 
+     * @return True if a read is pending, false if the job could not be queued.
+     */
+    bool requestBatteryRead();
 
 private:
     /**
-     * @brief Task function that reads the battery level and sends the result to the queue.
+     * @brief Job function that reads the battery level and publishes the result.
      * 
      * @param p A pointer to the BatteryReaderService instance.
+     * @return int Always 0.
      */
-    static void batteryReadTask(void* p);
+    static int batteryReadJob(void* p);
 
     /**
-     * @brief Reads the raw analog value and converts it to a battery voltage.
+     * @brief Timer callback of the continuous sampling.
      * 
-     * @return The battery voltage in volts.
+     * @param timer Timer whose ID is the BatteryReaderService instance.
      */
-    float analogReadBatteryLevel();
+    static void batteryTimerCallback(TimerHandle_t timer);
 
-        /**
-     * @brief Converts the battery voltage to a percentage (0-100%) based on predefined thresholds.
+    /**
+     * @brief Enables the divider and takes a burst of calibrated readings.
+     * 
+     * @param millivolts Output readings at the ADC pin, BATTERY_BURST_SAMPLES values.
+     */
+    void sampleBurst(uint16_t* millivolts);
+
+    /**
+     * @brief Set whether a read job is queued or running, under the pending lock.
      * 
-     * @param voltage The battery voltage.
-     * @return The battery level as a percentage.
+     * @param pending True once a job is queued, false when it starts or could not be queued.
      */
-    float batteryLevelToPercentage(float voltage);
+    void setBatteryReadPending(bool pending);
 
     uint8_t analogPin;                  ///< Analog pin to read from.
     uint8_t controlPin;                 ///< Control pin to enable/disable the battery reading.
-    float lastBatteryLevel;          ///< Last read battery voltage.
+    float lastBatteryLevel;          ///< Last battery level in percent.
     SemaphoreHandle_t batteryMutex;  ///< Mutex to protect battery reading operations.
-    TaskHandle_t batteryReadTaskHandle; ///< Handle for the battery read task.
-    QueueHandle_t resultQueue;       ///< Queue to send the result to.
-
-    // Battery voltage thresholds
-    const float minVoltage = 3.0;    ///< Minimum voltage for 0% battery
-    const float maxVoltage = 4.2;    ///< Maximum voltage for 100% battery
+    StaticSemaphore_t batteryMutexBuffer; ///< Storage of the battery mutex.
+    bool batteryReadPending;         ///< Whether a read job is queued or running, protected by the pending lock.
+    portMUX_TYPE pendingLock;        ///< Spinlock of the pending flag, taken from the timer task without blocking.
+    BatterySampler sampler;          ///< Filters the readings, protected by the battery mutex.
+    esp_adc_cal_characteristics_t adcCharacteristics; ///< ADC calibration read from the eFuse.
+    TimerHandle_t batteryTimer;      ///< Timer of the continuous sampling.
+    StaticTimer_t batteryTimerBuffer; ///< Storage of the timer.
 };
 
 #endif
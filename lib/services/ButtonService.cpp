@@ -3,12 +3,13 @@
 #include <freertos/queue.h>
 #include <freertos/task.h>
 #include <freertos/timers.h>
+#include <esp_timer.h>
 
 #include "ButtonService.h"
 
-ButtonService::ButtonService(int buttonPin, int buttonActive)
-    : buttonPin(buttonPin), buttonActive(buttonActive), numSubscribers(0), lastButtonState(LOW),
-      lastUpdateTime(0), buttonTask(nullptr), buttonEventQueue(nullptr) {}
+ButtonService::ButtonService(int buttonPin, int buttonActive, EventBus* eventBus, const GestureConfig& gestureConfig)
+    : buttonPin(buttonPin), buttonActive(buttonActive), lastButtonState(LOW), lastUpdateTime(0), lastPressTimeUs(-1),
+      gestures(gestureConfig), eventBus(eventBus), buttonTask(nullptr), buttonEventQueue(nullptr) {}
 
 void ButtonService::begin() {
     // Set the pin mode based on the buttonActive value
@@ -19,120 +20,129 @@ void ButtonService::begin() {
     }
     
     // Attach the interrupt handler to the button pin
-    buttonEventQueue = xQueueCreate(5, sizeof(int));
+    buttonEventQueue = xQueueCreateStatic(BUTTON_QUEUE_LENGTH, sizeof(ButtonEdge), buttonEventQueueStorage, &buttonEventQueueBuffer);
     buttonInterruptInfo = {buttonPin, buttonActive, buttonEventQueue};
     
     attachInterruptArg(digitalPinToInterrupt(buttonPin), handleButtonChange, (void *) &buttonInterruptInfo, CHANGE);
 
     // Create a task to handle button events
-    xTaskCreate(buttonServiceTask, "ButtonServiceTask", 2048, this, 1, &buttonTask);
+    buttonTask = xTaskCreateStatic(buttonServiceTask, "ButtonServiceTask", BUTTON_TASK_STACK_SIZE, this, 1, buttonTaskStack, &buttonTaskBuffer);
 }
 
 void ButtonService::end() {
+    // Detach the interrupt from the button pin before the queue goes away
+    detachInterrupt(digitalPinToInterrupt(buttonPin));
+
     // Delete the button task if it exists
     if (buttonTask != nullptr) {
         vTaskDelete(buttonTask);
+        buttonTask = nullptr;
     }
     
     // Delete the button event queue if it exists
     if (buttonEventQueue != nullptr) {
         vQueueDelete(buttonEventQueue);
-    }
-    
-    // Detach the interrupt from the button pin
-    detachInterrupt(digitalPinToInterrupt(buttonPin));
-}
-
-int ButtonService::subscribe(QueueHandle_t queue) {
-    // Check if there is space to add a new subscriber
-    if (numSubscribers < MAX_SUBSCRIBERS) {
-        // Add the queue to the list of subscribers
-        subscriberQueues[numSubscribers++] = queue;
-        return 0;
-    } else {
-        // Return an error code if there is no space for a new subscriber
-        return -1;
+        buttonEventQueue = nullptr;
     }
 }
 
-void ButtonService::unsubscribe(QueueHandle_t queue) {
-    // Find the queue in the list of subscribers and remove it
-    for (int i = 0; i < numSubscribers; i++) {
-        if (subscriberQueues[i] == queue) {
-            // Shift the remaining subscribers to fill the gap
-            for (int j = i; j < numSubscribers - 1; j++) {
-                subscriberQueues[j] = subscriberQueues[j + 1];
-            }
-            numSubscribers--;
-            break;
-        }
-    }
+void ButtonService::setGestureConfig(const GestureConfig& gestureConfig) {
+    gestures.setConfig(gestureConfig);
 }
 
 // Read the button value and convert it to 1 or 0 based on the buttonActive value
 #define READ_BUTTON_VALUE(buttonInterruptInfo) \
     (digitalRead(buttonInterruptInfo->buttonPin) == buttonInterruptInfo->buttonActive ? BUTTON_PRESSED : BUTTON_RELEASED)
 
+void ButtonService::replayWakePress() {
+    uint32_t now = millis();
+    int state = READ_BUTTON_VALUE((&buttonInterruptInfo));
+
+    // Date the press before the debounce window so the release is not filtered out
+    ButtonEdge edge = {BUTTON_PRESSED, now - DEBOUNCE_TIME_MS - 1, esp_timer_get_time()};
+    xQueueSend(buttonEventQueue, &edge, 0);
+    if (state == BUTTON_RELEASED) {
+        edge = {BUTTON_RELEASED, now, esp_timer_get_time()};
+        xQueueSend(buttonEventQueue, &edge, 0);
+    }
+}
+
+
+int64_t ButtonService::getLastPressTimeUs() {
+    return lastPressTimeUs;
+}
 
 void ButtonService::handleButtonChange(void *arg) {
     ButtonInterruptInfo *buttonInterruptInfo = (ButtonInterruptInfo *) arg;
     
-    int value = READ_BUTTON_VALUE(buttonInterruptInfo);
-    // Send the button value to the button event queue from the interrupt context
-    xQueueSendFromISR(buttonInterruptInfo->buttonEventQueue, &value, NULL);
+    // Timestamp the edge here so gesture timing does not depend on task latency
+    ButtonEdge edge = {READ_BUTTON_VALUE(buttonInterruptInfo), (uint32_t) millis(), esp_timer_get_time()};
+    // Send the button edge to the button event queue from the interrupt context
+    xQueueSendFromISR(buttonInterruptInfo->buttonEventQueue, &edge, NULL);
+}
+
+void ButtonService::publishButtonEvent(int event) {
+    EventPayload payload;
+    payload.button = event;
+    eventBus->publish(EVENT_BUTTON, payload);
+}
+
+void ButtonService::processEdge(const ButtonEdge& edge) {
+    // Check if enough time has passed since the last button update to debounce the button
+    if (edge.state == lastButtonState || (long) edge.timeMs - lastUpdateTime <= DEBOUNCE_TIME_MS) {
+        return;
+    }
+
+    // Update the last button state and update time
+    lastButtonState = edge.state;
+    lastUpdateTime = edge.timeMs;
+    if (edge.state == BUTTON_PRESSED) {
+        lastPressTimeUs = edge.timeUs;
+    }
+
+    // Gestures whose deadline expired before the edge go first
+    int events[MAX_GESTURE_EVENTS];
+    int count = gestures.update(edge.timeMs, events);
+    for (int i = 0; i < count; i++) {
+        publishButtonEvent(events[i]);
+    }
+
+    // Publish the raw button event
+    publishButtonEvent(edge.state);
+
+    // Feed the edge to the gesture recognizer
+    count = gestures.handleEdge(edge.state, edge.timeMs, events);
+    for (int i = 0; i < count; i++) {
+        publishButtonEvent(events[i]);
+    }
 }
 
 void ButtonService::buttonServiceTask(void *p) {
     // Cast the argument to a ButtonService pointer
     ButtonService *buttonService = static_cast<ButtonService *>(p);
 
-    int buttonEvent;
+    ButtonEdge edge;
+    int events[MAX_GESTURE_EVENTS];
     while (true) {
-        // Wait for a button event to be received from the button event queue
-        if (xQueueReceive(buttonService->buttonEventQueue, &buttonEvent, PERIODIC_CHECK_MS / portTICK_PERIOD_MS)) {
-            // Check if enough time has passed since the last button update to debounce the button
-            long currentTime = millis();
-            if (buttonService->lastButtonState != buttonEvent && currentTime - buttonService->lastUpdateTime > DEBOUNCE_TIME_MS) {
-                // Update the last button state
-                buttonService->lastButtonState = buttonEvent;
-
-                // Update the last update time
-                buttonService->lastUpdateTime = currentTime;
-
-                // Reset the long press flag if the button is released
-                if (buttonEvent == BUTTON_RELEASED) {
-                    buttonService->longPress = false;
-                }
-
-                // Send the button event to all subscribers
-                for (int i = 0; i < buttonService->numSubscribers; i++) {
-                    xQueueSend(buttonService->subscriberQueues[i], &buttonEvent, 0);
-                }
-            }
+        // Wake up for the next gesture deadline, or periodically to poll the button
+        long timeoutMs = buttonService->gestures.msUntilDeadline(millis());
+        if (timeoutMs < 0 || timeoutMs > PERIODIC_CHECK_MS) {
+            timeoutMs = PERIODIC_CHECK_MS;
+        }
+
+        // Wait for a button edge to be received from the button event queue
+        if (xQueueReceive(buttonService->buttonEventQueue, &edge, timeoutMs / portTICK_PERIOD_MS)) {
+            buttonService->processEdge(edge);
         } else {
-            // If no button event was received, check the button state periodically
-            int value = READ_BUTTON_VALUE((&buttonService->buttonInterruptInfo));
-            if (value != buttonService->lastButtonState && millis() - buttonService->lastUpdateTime > DEBOUNCE_TIME_MS) {
-                // Update the last button state
-                buttonService->lastButtonState = value;
-
-                // Update the last update time
-                buttonService->lastUpdateTime = millis();
-
-                // Send the button event to all subscribers
-                for (int i = 0; i < buttonService->numSubscribers; i++) {
-                    xQueueSend(buttonService->subscriberQueues[i], &value, 0);
-                }
-            }
-            // If the button is pressed for a long time, send a long press event
-            else if (value == BUTTON_PRESSED && !buttonService->longPress 
-                    && millis() - buttonService->lastUpdateTime > LONG_PRESS_TIME_MS) {
-                buttonService->longPress = true;
-                for (int i = 0; i < buttonService->numSubscribers; i++) {
-                    int longPressEvent = BUTTON_LONG_PRESSED;
-                    xQueueSend(buttonService->subscriberQueues[i], &longPressEvent, 0);
-                }
-            }
+            // If no button edge was received, check the button state periodically
+            edge = {READ_BUTTON_VALUE((&buttonService->buttonInterruptInfo)), (uint32_t) millis(), esp_timer_get_time()};
+            buttonService->processEdge(edge);
+        }
+
+        // Emit the gestures whose deadline expired (long press, hold repeat, multi-click gap)
+        int count = buttonService->gestures.update(millis(), events);
+        for (int i = 0; i < count; i++) {
+            buttonService->publishButtonEvent(events[i]);
         }
     }
 }
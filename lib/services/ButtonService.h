@@ -6,15 +6,23 @@
 #include "freertos/queue.h"
 #include "freertos/timers.h"
 
-#define MAX_SUBSCRIBERS 10
+#include "ButtonGestures.h"
+#include "EventBus.h"
+
 #define DEBOUNCE_TIME_MS 5
 #define PERIODIC_CHECK_MS 300
-#define LONG_PRESS_TIME_MS 1000
-
-#define BUTTON_PRESSED 1
-#define BUTTON_RELEASED 0
-#define BUTTON_LONG_PRESSED 2
+#define BUTTON_TASK_STACK_SIZE 2048
+#define BUTTON_QUEUE_LENGTH 5
 
+/**
+ * @struct ButtonEdge
+ * @brief Raw button edge timestamped in the interrupt.
+ */
+struct ButtonEdge {
+    int state;       ///< BUTTON_PRESSED or BUTTON_RELEASED.
+    uint32_t timeMs; ///< Time of the edge in milliseconds.
+    int64_t timeUs;  ///< Time of the edge in microseconds, on the esp_timer clock of the camera frames.
+};
 
 struct ButtonInterruptInfo {
     int buttonPin;
@@ -25,25 +33,27 @@ struct ButtonInterruptInfo {
 /**
  * @brief ButtonService class for handling button events.
  * 
- * This class provides functionality for handling button events. It allows subscribing to button events and receiving them through a queue. The class uses interrupts to detect button changes and debounce the button signal.
+ * This class provides functionality for handling button events. Button events are published on the event bus as EVENT_BUTTON events. The class uses interrupts to detect button changes and debounce the button signal.
+ * 
+ * Besides the raw BUTTON_PRESSED and BUTTON_RELEASED events, subscribers receive the gestures recognized by ButtonGestures
+ * (long press, hold repeat, double and triple click, hold-then-click). Gesture deadlines are handled by the button service task.
  * 
  * Example usage:
  * @code
- * // Create a button service object
- * ButtonService buttonService(2, LOW);
- * 
- * // Create a queue to receive button events
- * QueueHandle_t buttonEventQueue = xQueueCreate(10, sizeof(int));
+ * // Create the event bus and a button service object publishing on it
+ * EventBus eventBus;
+ * ButtonService buttonService(2, LOW, &eventBus);
+ * buttonService.begin();
  * 
  * // Subscribe to button events
- * buttonService.subscribe(buttonEventQueue);
+ * int subscriberId = eventBus.subscribe(EVENT_MASK(EVENT_BUTTON));
  * 
  * // Create a task to process button events
  * void buttonListeningTask(void *pvParameters) {
- *     int buttonEvent;
+ *     Event event;
  *     while (1) {
- *         if (xQueueReceive(buttonEventQueue, &buttonEvent, portMAX_DELAY)) {
- *             // Process button event
+ *         if (eventBus.receive(subscriberId, &event, portMAX_DELAY)) {
+ *             // Process event.payload.button
  *         }
  *     }
  * }
@@ -60,8 +70,10 @@ public:
      * 
      * @param buttonPin Pin number for the button.
      * @param buttonActive Active state of the button.
+     * @param eventBus Event bus where button events are published.
+     * @param gestureConfig Timing thresholds for gesture recognition.
      */
-    ButtonService(int buttonPin, int buttonActive);
+    ButtonService(int buttonPin, int buttonActive, EventBus* eventBus, const GestureConfig& gestureConfig = GestureConfig());
 
     /**
      * @brief Start the button service.
@@ -74,37 +86,51 @@ public:
      * @brief End the button service.
      * 
      * This function should be called to end the button service. It will detach the interrupt and delete the task and queue.
+     * Their memory is owned by the service, so begin() can be called again.
      */
     void end();
 
 
     /**
-     * @brief Subscribe to button events.
+     * @brief Set the gesture timing thresholds.
+     * 
+     * Any gesture in progress is dropped.
+     * 
+     * @param gestureConfig Timing thresholds for gesture recognition.
+     */
+    void setGestureConfig(const GestureConfig& gestureConfig);
+
+    /**
+     * @brief Deliver the press that woke the chip from standby.
      * 
-     * @param queue Queue to receive button events.
-     * @return int 0 on success, -1 on failure.
+     * The edge happened while the interrupt could not see it. A press is queued, followed by a
+     * release if the button is already up, so a quick press still takes the shot.
      */
-    int subscribe(QueueHandle_t queue);
+    void replayWakePress();
 
     /**
-     * @brief Unsubscribe from button events.
+     * @brief Get the interrupt time of the last debounced press.
      * 
-     * @param queue Queue to remove from subscribers.
+     * @return int64_t Time in microseconds on the esp_timer clock, -1 before the first press.
      */
-    void unsubscribe(QueueHandle_t queue);
+    int64_t getLastPressTimeUs();
 
 private:
     int buttonPin;           /**< Pin number for the button. */
     int buttonActive;        /**< Active state of the button. */
     int lastButtonState;     /**< Last button state for debouncing. */
-    bool longPress;          /**< Flag to indicate a long press. */
     long lastUpdateTime;     /**< Last update time for debouncing. */
-    QueueHandle_t subscriberQueues[MAX_SUBSCRIBERS]; /**< Array of subscriber queues. */
-    int numSubscribers;      /**< Number of subscribers. */
+    volatile int64_t lastPressTimeUs; /**< Interrupt time of the last debounced press. */
+    ButtonGestures gestures; /**< Gesture recognizer fed with the debounced edges. */
+    EventBus* eventBus;      /**< Event bus where button events are published. */
+    StaticTask_t buttonTaskBuffer; /**< Control block of the button service task. */
+    StackType_t buttonTaskStack[BUTTON_TASK_STACK_SIZE]; /**< Stack of the button service task. */
+    StaticQueue_t buttonEventQueueBuffer; /**< Control block of the button event queue. */
+    uint8_t buttonEventQueueStorage[BUTTON_QUEUE_LENGTH * sizeof(ButtonEdge)]; /**< Storage of the button event queue. */
 
 protected:
     TaskHandle_t buttonTask; /**< Task handle for the button service task. */
-    QueueHandle_t buttonEventQueue; /**< Queue for button events. */
+    QueueHandle_t buttonEventQueue; /**< Queue for the raw button edges sent by the interrupt. */
 
     /**
      * @brief Handle button state changes (interrupt service routine).
@@ -114,12 +140,26 @@ protected:
     static void IRAM_ATTR handleButtonChange(void *arg);
 
     /**
-     * @brief Task to process button events and notify subscribers.
+     * @brief Task to process button edges and publish button events.
      * 
      * @param p Pointer to the ButtonService instance.
      */
     static void buttonServiceTask(void *p);
 
+    /**
+     * @brief Publish a button event on the event bus.
+     * 
+     * @param event Button event to send.
+     */
+    void publishButtonEvent(int event);
+
+    /**
+     * @brief Debounce an edge, update the gestures and publish the resulting events.
+     * 
+     * @param edge Button edge to process.
+     */
+    void processEdge(const ButtonEdge& edge);
+
 };
 
 #endif // BUTTON_SERVICE_H
\ No newline at end of file
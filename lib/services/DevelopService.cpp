@@ -0,0 +1,199 @@
+#include <SD_MMC.h>
+
+#include "DevelopService.h"
+#include "GlobalState.h"
+
+DevelopService::DevelopService() : loaded(false), idle(false), sliceScheduled(false) {
+    filePath[0] = '\0';
+    scheduler.setStep(DEVELOP_TASK_CHECKSUM, checksumStep, this);
+}
+
+void DevelopService::setIdle(bool idle) {
+    this->idle = idle;
+    if (!idle) {
+        // The shot needs the card, the slice stops after its current step
+        scheduler.preempt();
+        return;
+    }
+    scheduler.resume();
+    requestSlice();
+}
+
+bool DevelopService::isBatteryLow() {
+    return GlobalState::getBatteryReaderService()->getLastBatteryLevel() < DEVELOP_MIN_BATTERY_PERCENT;
+}
+
+void DevelopService::requestSlice() {
+    // Before the queue is loaded, there may be work left from the last boot
+    if (sliceScheduled || !idle || isBatteryLow() || (loaded && scheduler.getPending() == 0)) {
+        return;
+    }
+    sliceScheduled = true;
+    if (!GlobalState::getSaveService()->requestDevelop()) {
+        sliceScheduled = false;
+    }
+}
+
+void DevelopService::endWindow(bool mounted) {
+    sliceScheduled = false;
+    if (mounted) {
+        requestSlice();
+    }
+}
+
+bool DevelopService::queueChecksum(const char* path, uint32_t length) {
+    if (!loaded) {
+        load();
+    }
+    if (!scheduler.add(DEVELOP_TASK_CHECKSUM, path, length)) {
+        Serial.printf("develop: queue full, %s not checksummed\n", path);
+        return false;
+    }
+    checkpoint();
+    return true;
+}
+
+int DevelopService::runSlice() {
+    if (!loaded) {
+        load();
+    }
+    int pending = scheduler.getPending();
+    uint32_t startMs = millis();
+    int result = scheduler.run(DEVELOP_SLICE_US, clockUs);
+    closeFile();
+
+    // A preempted slice leaves the card to the shot at once, the next save or slice saves the queue
+    if (result != DEVELOP_RUN_PREEMPTED && pending > 0) {
+        checkpoint();
+    }
+    if (pending > 0) {
+        Serial.printf("develop: %d of %d tasks left after %lu ms%s\n", scheduler.getPending(), pending,
+                      (unsigned long) (millis() - startMs), result == DEVELOP_RUN_PREEMPTED ? ", preempted" : "");
+    }
+    return result;
+}
+
+int DevelopService::getPending() {
+    return scheduler.getPending();
+}
+
+uint32_t DevelopService::getCompleted() {
+    return scheduler.getCompleted();
+}
+
+uint32_t DevelopService::getFailed() {
+    return scheduler.getFailed();
+}
+
+int DevelopService::getTaskPercent() {
+    return scheduler.getTaskPercent();
+}
+
+void DevelopService::load() {
+    loaded = true;
+    // The copy with the highest sequence that is intact, a copy torn by a power loss fails its checksum
+    bool validA = scheduler.deserialize(blob, readCopy(SD_DEVELOP_QUEUE_PATH_A));
+    uint32_t sequenceA = scheduler.getSequence();
+    bool validB = scheduler.deserialize(blob, readCopy(SD_DEVELOP_QUEUE_PATH_B));
+    if (validA && (!validB || sequenceA > scheduler.getSequence())) {
+        validB = false;
+        scheduler.deserialize(blob, readCopy(SD_DEVELOP_QUEUE_PATH_A));
+    }
+    if (validA || validB) {
+        Serial.printf("develop: %d tasks resumed from %s\n", scheduler.getPending(),
+                      validB ? SD_DEVELOP_QUEUE_PATH_B : SD_DEVELOP_QUEUE_PATH_A);
+    }
+}
+
+size_t DevelopService::readCopy(const char* path) {
+    File copy = SD_MMC.open(path);
+    if (!copy) {
+        return 0;
+    }
+    size_t length = copy.read(blob, sizeof(blob));
+    copy.close();
+    return length;
+}
+
+bool DevelopService::checkpoint() {
+    // Odd sequences go to one copy and even ones to the other, the newest intact one is loaded
+    size_t length = scheduler.serialize(blob, sizeof(blob));
+    const char* path = (scheduler.getSequence() & 1) ? SD_DEVELOP_QUEUE_PATH_A : SD_DEVELOP_QUEUE_PATH_B;
+    File copy = SD_MMC.open(path, FILE_WRITE);
+    bool written = copy && copy.write(blob, length) == length;
+    copy.close();
+    if (!written) {
+        Serial.printf("develop: failed to save the queue to %s\n", path);
+    }
+    return written;
+}
+
+bool DevelopService::openFile(const char* path) {
+    if (filePath[0] != '\0' && strcmp(filePath, path) == 0) {
+        return true;
+    }
+    closeFile();
+    file = SD_MMC.open(path);
+    if (!file || file.isDirectory()) {
+        file.close();
+        return false;
+    }
+    strcpy(filePath, path);
+    return true;
+}
+
+void DevelopService::closeFile() {
+    if (filePath[0] != '\0') {
+        file.close();
+        filePath[0] = '\0';
+    }
+}
+
+int DevelopService::checksumStep(void* context, DevelopTask* task) {
+    return static_cast<DevelopService*>(context)->checksumChunk(task);
+}
+
+int DevelopService::checksumChunk(DevelopTask* task) {
+    if (!openFile(task->path)) {
+        return -1;
+    }
+    uint32_t size = (uint32_t) file.size();
+    if (task->total == 0) {
+        // Queued without the size of the frame
+        task->total = size;
+    }
+    if (size != task->total) {
+        // Written again without a save queueing it, the bytes are not the frame the task is for
+        Serial.printf("develop: %s changed since it was saved, not checksummed\n", task->path);
+        return -1;
+    }
+
+    size_t length = min((size_t) DEVELOP_CHUNK_BYTES, (size_t) (task->total - task->cursor));
+    if (length > 0) {
+        if (file.position() != task->cursor && !file.seek(task->cursor)) {
+            return -1;
+        }
+        if (file.read(chunk, length) != length) {
+            return -1;
+        }
+        task->state = StandbyStore::crc32(chunk, length, task->state);
+        task->cursor += (uint32_t) length;
+    }
+    if (task->cursor < task->total) {
+        return DEVELOP_STEP_MORE;
+    }
+    closeFile();
+
+    File checksums = SD_MMC.open(SD_CHECKSUMS_PATH, FILE_APPEND);
+    if (!checksums) {
+        return -1;
+    }
+    checksums.printf("%08lx %lu %s %lu\n", (unsigned long) task->state, (unsigned long) task->total, task->path,
+                     (unsigned long) task->serial);
+    checksums.close();
+    return DEVELOP_STEP_DONE;
+}
+
+uint32_t DevelopService::clockUs() {
+    return (uint32_t) micros();
+}
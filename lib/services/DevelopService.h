@@ -0,0 +1,195 @@
+#ifndef RETROLENS_DEVELOP_SERVICE_H
+#define RETROLENS_DEVELOP_SERVICE_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "DevelopScheduler.h"
+
+// Queue of deferred work on the card, saved in turn to two copies so a torn write loses nothing
+#define SD_DEVELOP_QUEUE_PATH_A "/develop_a.bin"
+#define SD_DEVELOP_QUEUE_PATH_B "/develop_b.bin"
+
+// Checksums of the saved frames, a line each: CRC-32, size, path and serial of the save
+#define SD_CHECKSUMS_PATH "/checksums.txt"
+
+// Kinds of deferred work
+#define DEVELOP_TASK_CHECKSUM 0 // CRC-32 of a saved frame, appended to SD_CHECKSUMS_PATH
+
+// Bytes read from the card a step, a few milliseconds of work
+#define DEVELOP_CHUNK_BYTES 4096
+
+// Time of a slice, the pins shared with the screen and the battery are given back after it
+#define DEVELOP_SLICE_US 1000000
+
+// Below this battery level the deferred work waits for a charge
+#define DEVELOP_MIN_BATTERY_PERCENT 30
+
+/**
+ * @class DevelopService
+ * @brief Runs deferred per-frame work while the camera idles on the home screen.
+ *
+ * Work that does not belong on the shutter path, such as checksumming the saved frames, is
+ * queued by the save and done later by a DevelopScheduler. The queue is saved on the card
+ * after every change and every slice, so it resumes after a reboot or a standby.
+ *
+ * Slices run as background SD operations of the SaveService, on the background worker at the
+ * lowest task priority, and only while the home screen is up and the battery is above
+ * DEVELOP_MIN_BATTERY_PERCENT. A shutter press preempts the slice between two steps, within a
+ * few milliseconds, and the shot takes the card. Each slice ends after DEVELOP_SLICE_US so
+ * battery reads and the screen get their pins back, and the next one is requested once the
+ * card is closed.
+ *
+ * The queue is only changed inside an SD window, which the pins make exclusive. The progress
+ * getters may be read from any task.
+ *
+ * Example usage:
+ * @code
+ * // On the home screen
+ * developService.setIdle(true);
+ *
+ * // On a press
+ * developService.setIdle(false);
+ *
+ * // In an SD window, after a frame is saved
+ * developService.queueChecksum("/picture.jpg", length);
+ * @endcode
+ */
+class DevelopService {
+public:
+    /**
+     * @brief Constructor for DevelopService. The queue is loaded in the first SD window that needs it.
+     */
+    DevelopService();
+
+    /**
+     * @brief Tell the service whether the camera idles on the home screen.
+     *
+     * Leaving idle preempts the slice in progress, entering it requests a slice if work is left.
+     *
+     * @param idle True on the home screen, false on a press or when leaving it.
+     */
+    void setIdle(bool idle);
+
+    /**
+     * @brief Queue the checksum of a frame just saved. Call with the SD card mounted.
+     *
+     * The task is keyed to the size the save wrote: a frame saved over it before the checksum
+     * takes the task over, and a file of another size by then is not the frame and is skipped.
+     * Every save gets a new serial, written with the checksum, so a line names the save it is of
+     * and not whatever the path holds by the time it is read.
+     *
+     * @param path Path of the frame on the card.
+     * @param length Size of the frame as saved.
+     * @return true if the task is queued.
+     */
+    bool queueChecksum(const char* path, uint32_t length);
+
+    /**
+     * @brief Run deferred work for one slice. Call with the SD card mounted.
+     *
+     * @return int One of the DEVELOP_RUN_* values.
+     */
+    int runSlice();
+
+    /**
+     * @brief End the SD window a slice ran in, requesting the next slice if work is left.
+     *
+     * @param mounted False if the card could not be mounted, the next slice then waits for the home screen.
+     */
+    void endWindow(bool mounted);
+
+    /**
+     * @brief Check if the battery is too low for deferred work.
+     */
+    bool isBatteryLow();
+
+    /**
+     * @brief Get the number of tasks left, 0 until the queue is loaded.
+     */
+    int getPending();
+
+    /**
+     * @brief Get the number of tasks done since the queue was last empty.
+     */
+    uint32_t getCompleted();
+
+    /**
+     * @brief Get the number of tasks dropped since the queue was last empty.
+     */
+    uint32_t getFailed();
+
+    /**
+     * @brief Get the progress of the task in progress, in percent.
+     */
+    int getTaskPercent();
+
+private:
+    /**
+     * @brief Submit a slice if the camera idles, the battery allows it and work may be left.
+     */
+    void requestSlice();
+
+    /**
+     * @brief Load the newest intact copy of the queue from the mounted card.
+     */
+    void load();
+
+    /**
+     * @brief Save the queue to the older copy on the mounted card.
+     *
+     * @return true if it was written.
+     */
+    bool checkpoint();
+
+    /**
+     * @brief Read a copy of the queue into the blob buffer.
+     *
+     * @param path Path of the copy.
+     * @return size_t Bytes read, 0 if there is none.
+     */
+    size_t readCopy(const char* path);
+
+    /**
+     * @brief Open the file of a task, keeping it open across steps.
+     *
+     * @param path Path of the file.
+     * @return true if the file is open.
+     */
+    bool openFile(const char* path);
+
+    /**
+     * @brief Close the file of the task.
+     */
+    void closeFile();
+
+    /**
+     * @brief Step function of DEVELOP_TASK_CHECKSUM.
+     *
+     * @param context Pointer to the DevelopService.
+     * @param task Task to advance.
+     * @return int DEVELOP_STEP_MORE, DEVELOP_STEP_DONE, or -1 if the file cannot be read.
+     */
+    static int checksumStep(void* context, DevelopTask* task);
+
+    /**
+     * @brief Checksum the next chunk of a frame, and record the checksum once it is whole.
+     */
+    int checksumChunk(DevelopTask* task);
+
+    /**
+     * @brief Clock of the slices, in microseconds.
+     */
+    static uint32_t clockUs();
+
+    DevelopScheduler scheduler;                     ///< Queue of deferred work.
+    File file;                                      ///< File of the task in progress.
+    char filePath[DEVELOP_PATH_BYTES];              ///< Path of the open file, empty if none.
+    uint8_t chunk[DEVELOP_CHUNK_BYTES];             ///< Part of a file being checksummed.
+    uint8_t blob[DEVELOP_QUEUE_MAX_BLOB_BYTES];     ///< Saved queue.
+    bool loaded;                                    ///< True once the queue was loaded from the card.
+    volatile bool idle;                             ///< True while the camera idles on the home screen.
+    volatile bool sliceScheduled;                   ///< True from the slice request until its window ends.
+};
+
+#endif // RETROLENS_DEVELOP_SERVICE_H
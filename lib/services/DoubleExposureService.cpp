@@ -0,0 +1,74 @@
+#include <string.h>
+
+#include "GlobalState.h"
+#include "DoubleExposureService.h"
+
+DoubleExposureService::DoubleExposureService(const BlendConfig& config)
+    : config(config), runner(GlobalState::getWorkerPool()), first(nullptr), firstLength(0) {}
+
+size_t DoubleExposureService::requiredBytes() {
+    const resolution_info_t& size = resolution[CAMERA_DEFAULT_FRAME_SIZE];
+    return DoubleExposure::requiredBytes(size.width, JPEG_SUBSAMPLING_422) + DOUBLE_EXPOSURE_MIN_FIRST_BYTES;
+}
+
+bool DoubleExposureService::isAvailable() {
+    return GlobalState::getImageArena()->getCapacity() >= requiredBytes();
+}
+
+bool DoubleExposureService::hasFirstExposure() {
+    return firstLength > 0;
+}
+
+bool DoubleExposureService::keepFirstExposure(const camera_fb_t* frameBuffer) {
+    // The first exposure sits at the bottom of the arena, the blend works above it
+    const resolution_info_t& size = resolution[CAMERA_DEFAULT_FRAME_SIZE];
+    ImageArena* arena = GlobalState::getImageArena();
+    arena->reset();
+    size_t room = arena->getCapacity() - DoubleExposure::requiredBytes(size.width, JPEG_SUBSAMPLING_422);
+    uint8_t* copy = frameBuffer->len <= room ? static_cast<uint8_t*>(arena->alloc(frameBuffer->len)) : nullptr;
+    if (copy == nullptr) {
+        Serial.printf("double: first exposure of %u KB does not fit in %u KB\n", (unsigned) (frameBuffer->len / 1024),
+                      (unsigned) (room / 1024));
+        firstLength = 0;
+        return false;
+    }
+    memcpy(copy, frameBuffer->buf, frameBuffer->len);
+    first = copy;
+    firstLength = frameBuffer->len;
+    Serial.printf("double: first exposure kept, %u KB\n", (unsigned) (frameBuffer->len / 1024));
+    return true;
+}
+
+int DoubleExposureService::writeSecondExposure(const camera_fb_t* frameBuffer, JpegWriter writer, void* context) {
+    if (firstLength == 0) {
+        return JPEG_ERROR_STATE;
+    }
+    uint32_t startMs = millis();
+    ImageArena* arena = GlobalState::getImageArena();
+    size_t mark = arena->getMark();
+    arena->resetHighWater();
+    DoubleExposure blend(arena, config);
+    int result = blend.write(first, firstLength, frameBuffer->buf, frameBuffer->len, writer, context, &runner);
+    size_t blendBytes = arena->getHighWater() - mark;
+    cancel();
+    if (result != JPEG_OK) {
+        Serial.printf("double: blend failed with error %d\n", result);
+        return result;
+    }
+    Serial.printf("double: %s blend in %lu ms, %u KB of working memory\n", config.mode == BLEND_MODE_ADD ? "additive" : "screen",
+                  (unsigned long) (millis() - startMs), (unsigned) (blendBytes / 1024));
+    return JPEG_OK;
+}
+
+void DoubleExposureService::cancel() {
+    firstLength = 0;
+    first = nullptr;
+}
+
+void DoubleExposureService::setBlendMode(int mode) {
+    config.mode = mode;
+}
+
+int DoubleExposureService::getBlendMode() {
+    return config.mode;
+}
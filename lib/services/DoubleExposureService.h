@@ -0,0 +1,106 @@
+#ifndef RETROLENS_DOUBLE_EXPOSURE_SERVICE_H
+#define RETROLENS_DOUBLE_EXPOSURE_SERVICE_H
+
+#include <Arduino.h>
+#include <esp_camera.h>
+
+#include "CameraUtils.h"
+#include "DoubleExposure.h"
+#include "WorkerStripRunner.h"
+
+// Smallest room for the first exposure that makes the mode worth offering
+#define DOUBLE_EXPOSURE_MIN_FIRST_BYTES (512 * 1024)
+
+/**
+ * @class DoubleExposureService
+ * @brief Double exposure: keeps the first shot as JPEG and blends the second one into it on the way to the card.
+ *
+ * The first exposure is copied, still compressed, to the bottom of the image arena of
+ * GlobalState and nothing is saved. The second exposure is blended with it by a DoubleExposure
+ * strip by strip, decoding both frames on both cores, and the result is streamed to the
+ * writer. The first exposure is dropped once used, or when a stack needs the arena.
+ *
+ * Example usage:
+ * @code
+ * if (!doubleExposureService.hasFirstExposure()) {
+ *     doubleExposureService.keepFirstExposure(fb);
+ * } else {
+ *     doubleExposureService.writeSecondExposure(fb, writeToFile, &file);
+ * }
+ * @endcode
+ */
+class DoubleExposureService {
+public:
+    /**
+     * @brief Constructor for DoubleExposureService.
+     *
+     * @param config Blend mode and weights.
+     */
+    DoubleExposureService(const BlendConfig& config = BlendConfig());
+
+    /**
+     * @brief Get the memory a double exposure needs at the full frame size, with room for the first exposure.
+     *
+     * @return size_t Bytes of image arena.
+     */
+    static size_t requiredBytes();
+
+    /**
+     * @brief Check if the image arena is large enough for a double exposure.
+     *
+     * @return true if double exposures can be taken.
+     */
+    bool isAvailable();
+
+    /**
+     * @brief Check if a first exposure waits for the second.
+     *
+     * @return true if the next shot is the second exposure.
+     */
+    bool hasFirstExposure();
+
+    /**
+     * @brief Keep a frame as the first exposure.
+     *
+     * @param frameBuffer Captured JPEG frame, copied.
+     * @return true if the frame fits in the image arena.
+     */
+    bool keepFirstExposure(const camera_fb_t* frameBuffer);
+
+    /**
+     * @brief Blend a frame into the first exposure and write the result, dropping the first exposure.
+     *
+     * @param frameBuffer Second exposure.
+     * @param writer Output sink.
+     * @param context Context of the writer.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int writeSecondExposure(const camera_fb_t* frameBuffer, JpegWriter writer, void* context);
+
+    /**
+     * @brief Drop the first exposure.
+     */
+    void cancel();
+
+    /**
+     * @brief Set the blend mode of the next double exposure.
+     *
+     * @param mode One of the BLEND_MODE_* values.
+     */
+    void setBlendMode(int mode);
+
+    /**
+     * @brief Get the blend mode.
+     *
+     * @return int One of the BLEND_MODE_* values.
+     */
+    int getBlendMode();
+
+private:
+    BlendConfig config;           ///< Blend mode and weights.
+    WorkerStripRunner runner;     ///< Decodes both exposures on both cores.
+    const uint8_t* first;         ///< First exposure in the image arena.
+    volatile size_t firstLength;  ///< Size of the first exposure, 0 if none.
+};
+
+#endif // RETROLENS_DOUBLE_EXPOSURE_SERVICE_H
@@ -0,0 +1,90 @@
+#include "EventBus.h"
+
+EventBus::EventBus() {
+    vPortCPUInitializeMutex(&ringLock);
+    wakeEvents = xEventGroupCreateStatic(&wakeEventsBuffer);
+}
+
+int EventBus::subscribe(uint32_t typeMask) {
+    portENTER_CRITICAL(&ringLock);
+    int id = ring.subscribe(typeMask);
+    portEXIT_CRITICAL(&ringLock);
+
+    // Clear any stale wake-up left by a previous subscriber with the same id
+    if (id >= 0) {
+        xEventGroupClearBits(wakeEvents, 1u << id);
+    }
+    return id;
+}
+
+void EventBus::unsubscribe(int id) {
+    portENTER_CRITICAL(&ringLock);
+    ring.unsubscribe(id);
+    portEXIT_CRITICAL(&ringLock);
+}
+
+void EventBus::publish(uint16_t type, const EventPayload& payload) {
+    Event event = {type, (uint32_t) millis(), payload};
+
+    portENTER_CRITICAL(&ringLock);
+    ring.publish(event);
+    uint32_t subscribers = ring.getSubscribersForType(type);
+    portEXIT_CRITICAL(&ringLock);
+
+    // Wake every subscriber of the type with a single update
+    if (subscribers != 0) {
+        xEventGroupSetBits(wakeEvents, subscribers);
+    }
+}
+
+void EventBus::publishFromISR(uint16_t type, const EventPayload& payload, BaseType_t* higherPriorityTaskWoken) {
+    Event event = {type, (uint32_t) millis(), payload};
+
+    portENTER_CRITICAL_ISR(&ringLock);
+    ring.publish(event);
+    uint32_t subscribers = ring.getSubscribersForType(type);
+    portEXIT_CRITICAL_ISR(&ringLock);
+
+    // The event group update is deferred to the timer task
+    if (subscribers != 0) {
+        xEventGroupSetBitsFromISR(wakeEvents, subscribers, higherPriorityTaskWoken);
+    }
+}
+
+bool EventBus::poll(int id, Event* event) {
+    portENTER_CRITICAL(&ringLock);
+    bool result = ring.poll(id, event);
+    portEXIT_CRITICAL(&ringLock);
+    return result;
+}
+
+bool EventBus::receive(int id, Event* event, TickType_t timeout) {
+    if (id < 0 || id >= MAX_EVENT_SUBSCRIBERS) {
+        return false;
+    }
+
+    TickType_t startTime = xTaskGetTickCount();
+    while (true) {
+        if (poll(id, event)) {
+            return true;
+        }
+
+        // The bit stays set if an event was published after the poll, so no wake-up is lost
+        TickType_t elapsed = xTaskGetTickCount() - startTime;
+        if (timeout != portMAX_DELAY && elapsed >= timeout) {
+            return false;
+        }
+        TickType_t remaining = timeout == portMAX_DELAY ? portMAX_DELAY : timeout - elapsed;
+        if ((xEventGroupWaitBits(wakeEvents, 1u << id, pdTRUE, pdFALSE, remaining) & (1u << id)) == 0) {
+            // One last poll in case the event arrived right at the timeout
+            return poll(id, event);
+        }
+    }
+}
+
+void EventBus::flush(int id) {
+    Event event;
+    while (poll(id, &event)) {
+    }
+    xEventGroupClearBits(wakeEvents, 1u << id);
+}
@@ -0,0 +1,106 @@
+#ifndef RETROLENS_EVENT_BUS_H
+#define RETROLENS_EVENT_BUS_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+
+#include "EventRing.h"
+
+/**
+ * @class EventBus
+ * @brief Typed event bus shared by all services.
+ *
+ * Events are copied once into an EventRing and each subscriber reads them through its own cursor.
+ * Waiting subscribers are woken with a single event group update that sets the bits of every
+ * subscriber of the event type, so publishing costs the same whatever the number of subscribers.
+ * Events can be published from tasks and from interrupts.
+ *
+ * Example usage:
+ * @code
+ * EventBus eventBus;
+ * int id = eventBus.subscribe(EVENT_MASK(EVENT_BUTTON));
+ *
+ * EventPayload payload;
+ * payload.button = BUTTON_PRESSED;
+ * eventBus.publish(EVENT_BUTTON, payload);
+ *
+ * Event event;
+ * if (eventBus.receive(id, &event, portMAX_DELAY)) {
+ *     // Process event.payload.button
+ * }
+ * @endcode
+ */
+class EventBus {
+public:
+    /**
+     * @brief Construct a new Event Bus object.
+     */
+    EventBus();
+
+    /**
+     * @brief Subscribe to a set of event types.
+     *
+     * @param typeMask Mask of the event types to receive, built with EVENT_MASK.
+     * @return int Subscriber id, or -1 if there are already MAX_EVENT_SUBSCRIBERS subscribers.
+     */
+    int subscribe(uint32_t typeMask);
+
+    /**
+     * @brief Remove a subscriber.
+     *
+     * @param id Subscriber id returned by subscribe().
+     */
+    void unsubscribe(int id);
+
+    /**
+     * @brief Publish an event from a task.
+     *
+     * @param type Event type.
+     * @param payload Event data.
+     */
+    void publish(uint16_t type, const EventPayload& payload);
+
+    /**
+     * @brief Publish an event from an interrupt service routine.
+     *
+     * @param type Event type.
+     * @param payload Event data.
+     * @param higherPriorityTaskWoken Set to pdTRUE if a context switch should be requested.
+     */
+    void IRAM_ATTR publishFromISR(uint16_t type, const EventPayload& payload, BaseType_t* higherPriorityTaskWoken);
+
+    /**
+     * @brief Receive the next event of a subscriber, waiting if there is none.
+     *
+     * @param id Subscriber id.
+     * @param event Output event.
+     * @param timeout Time (in ticks) to wait for an event.
+     * @return true if an event was received, false on timeout.
+     */
+    bool receive(int id, Event* event, TickType_t timeout);
+
+    /**
+     * @brief Drop the pending events of a subscriber.
+     *
+     * @param id Subscriber id.
+     */
+    void flush(int id);
+
+private:
+    /**
+     * @brief Read the next event of a subscriber without waiting.
+     *
+     * @param id Subscriber id.
+     * @param event Output event.
+     * @return true if an event was read, false if there are no pending events.
+     */
+    bool poll(int id, Event* event);
+
+    EventRing ring;                 ///< Event storage and subscriber cursors.
+    portMUX_TYPE ringLock;          ///< Spinlock protecting the ring, usable from interrupts.
+    EventGroupHandle_t wakeEvents;  ///< One bit per subscriber, set when events are published.
+    StaticEventGroup_t wakeEventsBuffer; ///< Storage of the wake-up event group.
+};
+
+#endif // RETROLENS_EVENT_BUS_H
@@ -0,0 +1,43 @@
+#include <esp_timer.h>
+
+#include "GlobalState.h"
+#include "FlashService.h"
+
+FlashService::FlashService(const FlashSyncConfig& config) : sync(config) {}
+
+camera_fb_t* FlashService::captureLit() {
+    // A held metering was taken without the lamp, the sensor exposes the lit frames itself
+    GlobalState::getMeteringService()->releaseControls();
+
+    camera_fb_t* litFrame = nullptr;
+    sync.arm();
+    while (sync.getState() != FLASH_STATE_IDLE) {
+        camera_fb_t* frameBuffer = cameraCaptureImage();
+        if (frameBuffer == nullptr) {
+            sync.abort(esp_timer_get_time());
+            break;
+        }
+
+        // Switch the lamp right at the frame boundary
+        int action = sync.onFrame(cameraFrameTimeUs(frameBuffer), esp_timer_get_time());
+        GlobalState::setFlashState(sync.isLampOn());
+        if (action == FLASH_FRAME_KEEP) {
+            litFrame = frameBuffer;
+        } else {
+            cameraReleaseFrameBuffer(frameBuffer);
+        }
+    }
+    GlobalState::setFlashState(false);
+
+    Serial.printf("flash: %s, lamp on %lu ms, %d frames dropped\n", litFrame != nullptr ? "lit" : "failed",
+                  (unsigned long) (sync.getLastOnTimeUs() / 1000), sync.getLastDroppedFrames());
+    logStats();
+    return litFrame;
+}
+
+void FlashService::logStats() {
+    Serial.printf("flash: %lu shots, %lu failed, lamp on mean %lu ms, longest %lu ms, frame period %lu ms\n",
+                  (unsigned long) sync.getShotCount(), (unsigned long) sync.getFailureCount(),
+                  (unsigned long) (sync.getMeanOnTimeUs() / 1000), (unsigned long) (sync.getMaxOnTimeUs() / 1000),
+                  (unsigned long) (sync.getFramePeriodUs() / 1000));
+}
@@ -0,0 +1,54 @@
+#ifndef RETROLENS_FLASH_SERVICE_H
+#define RETROLENS_FLASH_SERVICE_H
+
+#include <Arduino.h>
+#include <esp_camera.h>
+
+#include "CameraUtils.h"
+#include "FlashSync.h"
+
+/**
+ * @class FlashService
+ * @brief Service that captures a frame lit by the flash, with the lamp on only around that frame.
+ *
+ * The lamp is switched by a FlashSync fed with the frames of the camera: on at the first frame
+ * boundary, off as soon as a frame exposed entirely under the lamp arrives, before the frame is
+ * saved. Every shot logs its lamp on time and dropped frames. An exposure held by the
+ * MeteringService is released first, it was metered without the lamp.
+ *
+ * Example usage:
+ * @code
+ * FlashService flashService;
+ * camera_fb_t* fb = flashService.captureLit();
+ * if (fb != nullptr) {
+ *     // Save fb
+ *     cameraReleaseFrameBuffer(fb);
+ * }
+ * @endcode
+ */
+class FlashService {
+public:
+    /**
+     * @brief Constructor for FlashService.
+     *
+     * @param config Timing of the lamp and of the sensor.
+     */
+    FlashService(const FlashSyncConfig& config = FlashSyncConfig());
+
+    /**
+     * @brief Capture a frame lit by the flash. The camera must not be used by anyone else meanwhile.
+     *
+     * @return camera_fb_t* Lit frame, nullptr if the camera failed or no frame was fully lit.
+     */
+    camera_fb_t* captureLit();
+
+    /**
+     * @brief Print the lamp on time statistics.
+     */
+    void logStats();
+
+private:
+    FlashSync sync; ///< Lamp controller.
+};
+
+#endif // RETROLENS_FLASH_SERVICE_H
@@ -0,0 +1,118 @@
+#include "GlobalState.h"
+#include "MeteringService.h"
+
+static const char* WB_MODE_NAMES[] = {"auto", "sunny", "cloudy", "office", "home"};
+
+MeteringService::MeteringService(const ExposureConfig& config)
+    : control(config), pixelsWidth(0), pixelsHeight(0), meterCount(0), framesTotal(0), failedCount(0), lastDurationMs(0),
+      held(false) {}
+
+bool MeteringService::meter() {
+    sensor_t* sensor = esp_camera_sensor_get();
+    if (sensor == nullptr) {
+        return false;
+    }
+    uint32_t startMs = millis();
+    framesize_t fullSize = sensor->status.framesize;
+
+    // Manual controls, the sunny preset makes the colour sums show the illuminant
+    sensor->set_exposure_ctrl(sensor, 0);
+    sensor->set_gain_ctrl(sensor, 0);
+    sensor->set_awb_gain(sensor, 1);
+    sensor->set_wb_mode(sensor, WB_MODE_SUNNY);
+    sensor->set_framesize(sensor, METERING_FRAME_SIZE);
+    applySettings(sensor, settings);
+    dropFrames(METERING_SETTLE_FRAMES);
+
+    bool converged = false;
+    bool measured = false;
+    int frames = 0;
+    while (frames < METERING_MAX_FRAMES) {
+        if (!measureFrame()) {
+            break;
+        }
+        measured = true;
+        frames++;
+        if (control.update(stats, &settings)) {
+            converged = true;
+            break;
+        }
+        applySettings(sensor, settings);
+        dropFrames(METERING_SETTLE_FRAMES);
+    }
+    if (measured) {
+        settings.wbMode = ExposureControl::pickWhiteBalance(stats);
+        // The JPEG size of the shot follows the detail of the scene
+        GlobalState::getRateService()->noteDetail(LumaMeter::measureDetail(pixels, pixelsWidth, pixelsHeight));
+    }
+
+    // Back to the full frame with the result held, its first frame is already exposed and is kept
+    sensor->set_wb_mode(sensor, settings.wbMode);
+    sensor->set_framesize(sensor, fullSize);
+    held = true;
+
+    meterCount++;
+    framesTotal += frames;
+    if (!converged) {
+        failedCount++;
+    }
+    lastDurationMs = millis() - startMs;
+    Serial.printf("metering: %s in %d frames, %lu ms, mean %u, p98 %u, exposure %u, gain %u, wb %s\n",
+                  converged ? "converged" : "not converged", frames, (unsigned long) lastDurationMs, stats.mean,
+                  stats.percentile98, settings.exposureLines, settings.gain, WB_MODE_NAMES[settings.wbMode]);
+    return converged;
+}
+
+bool MeteringService::isMeteringFrame(const camera_fb_t* frameBuffer) {
+    return frameBuffer->width <= METERING_WIDTH * 2 && frameBuffer->height <= METERING_HEIGHT * 2;
+}
+
+void MeteringService::releaseControls() {
+    sensor_t* sensor = esp_camera_sensor_get();
+    if (!held || sensor == nullptr) {
+        return;
+    }
+    sensor->set_exposure_ctrl(sensor, 1);
+    sensor->set_gain_ctrl(sensor, 1);
+    sensor->set_wb_mode(sensor, WB_MODE_AUTO);
+    held = false;
+}
+
+uint32_t MeteringService::getLastDurationMs() {
+    return lastDurationMs;
+}
+
+void MeteringService::logStats() {
+    Serial.printf("metering: %lu meterings, %lu not converged, %.1f frames each, last %lu ms\n",
+                  (unsigned long) meterCount, (unsigned long) failedCount,
+                  meterCount > 0 ? (float) framesTotal / meterCount : 0.0f, (unsigned long) lastDurationMs);
+}
+
+void MeteringService::applySettings(sensor_t* sensor, const ExposureSettings& settings) {
+    sensor->set_aec_value(sensor, settings.exposureLines);
+    sensor->set_agc_gain(sensor, settings.gain);
+}
+
+bool MeteringService::measureFrame() {
+    camera_fb_t* frameBuffer = cameraCaptureImage();
+    if (frameBuffer == nullptr) {
+        return false;
+    }
+    // The sensor frame size may lag the request by a frame, a larger frame does not fit the buffer
+    bool decoded = isMeteringFrame(frameBuffer) &&
+                   jpg2rgb565(frameBuffer->buf, frameBuffer->len, pixels, METERING_DECODE_SCALE);
+    pixelsWidth = frameBuffer->width / 2;
+    pixelsHeight = frameBuffer->height / 2;
+    cameraReleaseFrameBuffer(frameBuffer);
+    if (!decoded) {
+        return false;
+    }
+    LumaMeter::measureRgb565(pixels, (size_t) pixelsWidth * pixelsHeight, &stats);
+    return true;
+}
+
+void MeteringService::dropFrames(int count) {
+    for (int i = 0; i < count; i++) {
+        cameraReleaseFrameBuffer(cameraCaptureImage());
+    }
+}
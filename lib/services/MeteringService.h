@@ -0,0 +1,127 @@
+#ifndef RETROLENS_METERING_SERVICE_H
+#define RETROLENS_METERING_SERVICE_H
+
+#include <Arduino.h>
+#include <esp_camera.h>
+#include <img_converters.h>
+
+#include "CameraUtils.h"
+#include "ExposureControl.h"
+#include "LumaMeter.h"
+
+// Metering frames: QQVGA JPEG decoded at half scale
+#define METERING_FRAME_SIZE FRAMESIZE_QQVGA
+#define METERING_DECODE_SCALE JPG_SCALE_2X
+#define METERING_WIDTH 80
+#define METERING_HEIGHT 60
+
+// Longest metering run, in metering frames
+#define METERING_MAX_FRAMES 6
+
+// Frames the sensor needs after a register change before its frames show it
+#define METERING_SETTLE_FRAMES 1
+
+/**
+ * @class MeteringService
+ * @brief Meters the scene on tiny frames and fixes exposure, gain and white balance before the full-resolution grab.
+ *
+ * The sensor is switched to METERING_FRAME_SIZE with its automatic controls off. Each metering
+ * frame is decoded to a small RGB565 image, measured by a LumaMeter and fed to an
+ * ExposureControl, whose settings go to the sensor for the next frame, until the frame is
+ * acceptable or METERING_MAX_FRAMES have been used. The white balance preset is picked on the
+ * last frame, and its detail is passed to the RateService to predict the JPEG size. The sensor
+ * then returns to the full frame size with the settings held, so the first full-resolution frame
+ * is already exposed instead of several frames of automatic exposure settling. No frame is dropped
+ * after the switch: a frame still at the metering size, as the sensor may lag the switch by one,
+ * is for the caller to drop with isMeteringFrame(). The settings stay held until releaseControls() gives the sensor its automatic
+ * controls back, when the ZSL arm timeout ends and before a flash shot, whose lamp the metering
+ * never saw.
+ *
+ * Example usage:
+ * @code
+ * // With exclusive use of the camera
+ * meteringService.meter();
+ * camera_fb_t* fb = cameraCaptureImage();
+ * if (MeteringService::isMeteringFrame(fb)) {
+ *     cameraReleaseFrameBuffer(fb);
+ *     fb = cameraCaptureImage();
+ * }
+ * // Once the scene may have changed
+ * meteringService.releaseControls();
+ * @endcode
+ */
+class MeteringService {
+public:
+    /**
+     * @brief Constructor for MeteringService.
+     *
+     * @param config Targets and limits of the control loop.
+     */
+    MeteringService(const ExposureConfig& config = ExposureConfig());
+
+    /**
+     * @brief Meter the scene and hold the result on the sensor. The camera must not be used by anyone else meanwhile.
+     *
+     * @return true if the exposure converged, false if the frames ran out or the camera failed.
+     */
+    bool meter();
+
+    /**
+     * @brief Check if a frame was captured at the metering size, before the sensor was back at the full frame.
+     */
+    static bool isMeteringFrame(const camera_fb_t* frameBuffer);
+
+    /**
+     * @brief Turn the automatic exposure, gain and white balance of the sensor back on.
+     *
+     * Does nothing if no metering result is held. The camera must not be used by anyone else meanwhile.
+     */
+    void releaseControls();
+
+    /**
+     * @brief Get the duration of the last metering, in milliseconds.
+     */
+    uint32_t getLastDurationMs();
+
+    /**
+     * @brief Print the metering statistics.
+     */
+    void logStats();
+
+private:
+    /**
+     * @brief Write the manual controls to the sensor.
+     *
+     * @param sensor Camera sensor.
+     * @param settings Controls to write.
+     */
+    static void applySettings(sensor_t* sensor, const ExposureSettings& settings);
+
+    /**
+     * @brief Grab, decode and measure one metering frame.
+     *
+     * @return true if the frame was measured into stats.
+     */
+    bool measureFrame();
+
+    /**
+     * @brief Return frames captured before a sensor change to the driver.
+     *
+     * @param count Number of frames to drop.
+     */
+    static void dropFrames(int count);
+
+    ExposureControl control;                              ///< Exposure control loop.
+    ExposureSettings settings;                            ///< Settings of the last metering, the start of the next.
+    MeterStats stats;                                     ///< Statistics of the last metering frame.
+    uint8_t pixels[METERING_WIDTH * METERING_HEIGHT * 2]; ///< Decoded metering frame, RGB565.
+    int pixelsWidth;                                      ///< Width of the decoded frame.
+    int pixelsHeight;                                     ///< Height of the decoded frame.
+    uint32_t meterCount;                                  ///< Number of meterings.
+    uint32_t framesTotal;                                 ///< Metering frames over all meterings.
+    uint32_t failedCount;                                 ///< Meterings that did not converge.
+    uint32_t lastDurationMs;                              ///< Duration of the last metering.
+    bool held;                                            ///< True while the sensor holds a metering result.
+};
+
+#endif // RETROLENS_METERING_SERVICE_H
@@ -0,0 +1,95 @@
+#include "PinArbiter.h"
+
+PinArbiter::PinArbiter() {
+    arbiterMutex = xSemaphoreCreateMutexStatic(&arbiterMutexBuffer);
+    for (int i = 0; i < ARBITER_MAX_CLIENTS; i++) {
+        clients[i].task = nullptr;
+        clients[i].basePriority = 0;
+        clients[i].appliedPriority = 0;
+        clients[i].grantSemaphore = xSemaphoreCreateBinaryStatic(&clients[i].grantSemaphoreBuffer);
+    }
+}
+
+int PinArbiter::acquire(uint32_t resources, TickType_t timeout) {
+    UBaseType_t priority = uxTaskPriorityGet(nullptr);
+
+    xSemaphoreTake(arbiterMutex, portMAX_DELAY);
+    int ticket = arbiter.request(resources, (uint8_t) priority);
+    if (ticket == ARBITER_INVALID_TICKET) {
+        xSemaphoreGive(arbiterMutex);
+        return ARBITER_INVALID_TICKET;
+    }
+    Client& client = clients[ticket];
+    client.task = xTaskGetCurrentTaskHandle();
+    client.basePriority = priority;
+    client.appliedPriority = priority;
+    // Drop a grant left over by a previous client of the slot
+    xSemaphoreTake(client.grantSemaphore, 0);
+    bool granted = arbiter.isGranted(ticket);
+    // A waiter raises the holders blocking it
+    onArbiterChanged(0);
+    xSemaphoreGive(arbiterMutex);
+
+    if (granted) {
+        return ticket;
+    }
+    if (xSemaphoreTake(client.grantSemaphore, timeout) == pdTRUE) {
+        return ticket;
+    }
+
+    // Timed out, unless the grant raced with the timeout
+    xSemaphoreTake(arbiterMutex, portMAX_DELAY);
+    if (arbiter.isGranted(ticket)) {
+        xSemaphoreTake(client.grantSemaphore, 0);
+        xSemaphoreGive(arbiterMutex);
+        return ticket;
+    }
+    onArbiterChanged(arbiter.cancel(ticket));
+    client.task = nullptr;
+    xSemaphoreGive(arbiterMutex);
+    return ARBITER_INVALID_TICKET;
+}
+
+void PinArbiter::release(int ticket) {
+    if (ticket < 0 || ticket >= ARBITER_MAX_CLIENTS) {
+        return;
+    }
+    xSemaphoreTake(arbiterMutex, portMAX_DELAY);
+    if (!arbiter.isGranted(ticket)) {
+        xSemaphoreGive(arbiterMutex);
+        return;
+    }
+    Client& client = clients[ticket];
+    // Drop the inherited priority before waking the waiters
+    if (client.appliedPriority != client.basePriority) {
+        vTaskPrioritySet(client.task, client.basePriority);
+    }
+    client.task = nullptr;
+    onArbiterChanged(arbiter.release(ticket));
+    xSemaphoreGive(arbiterMutex);
+}
+
+void PinArbiter::onArbiterChanged(uint32_t granted) {
+    for (int ticket = 0; ticket < ARBITER_MAX_CLIENTS; ticket++) {
+        if (granted & (1u << ticket)) {
+            xSemaphoreGive(clients[ticket].grantSemaphore);
+        }
+    }
+
+    // Raise each holder to the most urgent waiter it blocks, or restore it
+    uint32_t holders = arbiter.getHolders();
+    for (int ticket = 0; ticket < ARBITER_MAX_CLIENTS; ticket++) {
+        if (!(holders & (1u << ticket)) || clients[ticket].task == nullptr) {
+            continue;
+        }
+        Client& client = clients[ticket];
+        UBaseType_t priority = arbiter.effectivePriority(ticket);
+        if (priority < client.basePriority) {
+            priority = client.basePriority;
+        }
+        if (priority != client.appliedPriority) {
+            vTaskPrioritySet(client.task, priority);
+            client.appliedPriority = priority;
+        }
+    }
+}
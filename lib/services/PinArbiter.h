@@ -0,0 +1,78 @@
+#ifndef RETROLENS_PIN_ARBITER_H
+#define RETROLENS_PIN_ARBITER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include "ResourceArbiter.h"
+
+/**
+ * @class PinArbiter
+ * @brief Blocking front end of ResourceArbiter for the pins shared by the SD card, the screen and the battery.
+ *
+ * A task asks for its whole set of pins at its current priority and sleeps on its own semaphore
+ * until the set is granted. While it waits, every holder it blocks is raised to its priority, so
+ * a capture never waits behind a battery read preempted by unrelated work.
+ *
+ * Example usage:
+ * @code
+ * PinArbiter arbiter;
+ * int ticket = arbiter.acquire(PINS_SCREEN_BUS, portMAX_DELAY);
+ * if (ticket != ARBITER_INVALID_TICKET) {
+ *     // Use the screen
+ *     arbiter.release(ticket);
+ * }
+ * @endcode
+ */
+class PinArbiter {
+public:
+    /**
+     * @brief Construct a new Pin Arbiter object.
+     */
+    PinArbiter();
+
+    /**
+     * @brief Acquire a set of pins, all at once.
+     *
+     * @param resources Mask of PINS_* resources.
+     * @param timeout Time (in ticks) to wait.
+     * @return int Ticket to release, or ARBITER_INVALID_TICKET on timeout.
+     */
+    int acquire(uint32_t resources, TickType_t timeout);
+
+    /**
+     * @brief Release the pins of a ticket and wake the tasks they unblock.
+     *
+     * @param ticket Ticket returned by acquire().
+     */
+    void release(int ticket);
+
+private:
+    /**
+     * @brief Task waiting for or holding a ticket.
+     */
+    struct Client {
+        TaskHandle_t task;                 ///< Task of the client.
+        UBaseType_t basePriority;          ///< Priority of the task when it asked.
+        UBaseType_t appliedPriority;       ///< Priority the arbiter set on the task.
+        SemaphoreHandle_t grantSemaphore;  ///< Given when the ticket is granted.
+        StaticSemaphore_t grantSemaphoreBuffer; ///< Storage of the semaphore.
+    };
+
+    /**
+     * @brief Wake the clients of the granted tickets and update the inherited priorities.
+     *        Must be called with the arbiter mutex held.
+     *
+     * @param granted Mask of granted tickets.
+     */
+    void onArbiterChanged(uint32_t granted);
+
+    ResourceArbiter arbiter;                  ///< Grant logic.
+    SemaphoreHandle_t arbiterMutex;           ///< Serializes the calls to the arbiter.
+    StaticSemaphore_t arbiterMutexBuffer;     ///< Storage of the mutex.
+    Client clients[ARBITER_MAX_CLIENTS];      ///< Clients, indexed by ticket.
+};
+
+#endif // RETROLENS_PIN_ARBITER_H
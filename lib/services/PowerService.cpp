@@ -0,0 +1,182 @@
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+
+#include "GlobalState.h"
+#include "PowerService.h"
+
+static const char* STATE_NAMES[POWER_STATE_COUNT] = {"active", "idle", "sensor-off"};
+
+PowerService::PowerService(const PowerConfig& config)
+    : tracker(config), sensorOn(true), active(false), rearmRequestMs(0), rearmLatencyMs(0),
+      rearmUnreported(false), lastLogMs(0), pmEnabled(false), cpuLock(nullptr), apbLock(nullptr), noSleepLock(nullptr) {
+    powerMutex = xSemaphoreCreateMutexStatic(&powerMutexBuffer);
+    powerTimer = xTimerCreateStatic("PowerTimer", pdMS_TO_TICKS(POWER_CHECK_PERIOD_MS), pdTRUE, this,
+                                    powerTimerCallback, &powerTimerBuffer);
+}
+
+void PowerService::begin() {
+    // Scale the clock with the load and light sleep when nothing holds a lock
+    esp_pm_config_esp32_t pmConfig = {};
+    pmConfig.max_freq_mhz = POWER_MAX_CPU_FREQ_MHZ;
+    pmConfig.min_freq_mhz = POWER_MIN_CPU_FREQ_MHZ;
+    pmConfig.light_sleep_enable = true;
+    pmEnabled = esp_pm_configure(&pmConfig) == ESP_OK &&
+                esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "power-cpu", &cpuLock) == ESP_OK &&
+                esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "power-apb", &apbLock) == ESP_OK &&
+                esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "power-sensor", &noSleepLock) == ESP_OK;
+    if (!pmEnabled) {
+        Serial.println("Power management unavailable, scaling the clock manually");
+        setCpuFrequencyMhz(POWER_MIN_CPU_FREQ_MHZ);
+    } else {
+        // The sensor is powered after the camera initialization
+        esp_pm_lock_acquire(apbLock);
+        esp_pm_lock_acquire(noSleepLock);
+    }
+
+    // The shutter button wakes the chip from light sleep
+    gpio_wakeup_enable((gpio_num_t) SHUTTER_BUTTON_PIN, SHUTTER_BUTTON_ACTIVE == LOW ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+
+    xSemaphoreTake(powerMutex, portMAX_DELAY);
+    tracker.start(millis());
+    lastLogMs = millis();
+    xSemaphoreGive(powerMutex);
+    xTimerStart(powerTimer, 0);
+}
+
+void PowerService::setActive(bool active) {
+    xSemaphoreTake(powerMutex, portMAX_DELAY);
+    if (active != this->active) {
+        this->active = active;
+        if (pmEnabled) {
+            if (active) {
+                esp_pm_lock_acquire(cpuLock);
+            } else {
+                esp_pm_lock_release(cpuLock);
+            }
+        } else {
+            setCpuFrequencyMhz(active ? POWER_MAX_CPU_FREQ_MHZ : POWER_MIN_CPU_FREQ_MHZ);
+        }
+        updateState();
+    }
+    xSemaphoreGive(powerMutex);
+}
+
+void PowerService::noteActivity() {
+    xSemaphoreTake(powerMutex, portMAX_DELAY);
+    tracker.noteActivity(millis());
+    xSemaphoreGive(powerMutex);
+}
+
+void PowerService::prepareSensor() {
+    if (sensorOn) {
+        return;
+    }
+    rearmRequestMs = millis();
+    GlobalState::getWorkerPool()->submit(JOB_PRIORITY_SHUTTER, sensorPowerUpJob, this);
+}
+
+void PowerService::acquireSensor() {
+    uint32_t startMs = millis();
+    xSemaphoreTake(powerMutex, portMAX_DELAY);
+    if (!sensorOn) {
+        // Nobody prepared the sensor, the shot pays the whole re-arm
+        powerUpSensor(startMs);
+    }
+    uint32_t waitedMs = millis() - startMs;
+    if (rearmUnreported) {
+        tracker.recordRearm(rearmLatencyMs, waitedMs > SENSOR_WAIT_THRESHOLD_MS ? waitedMs : 0);
+        rearmUnreported = false;
+    }
+    tracker.noteActivity(millis());
+    xSemaphoreGive(powerMutex);
+}
+
+void PowerService::releaseSensor() {
+    xSemaphoreTake(powerMutex, portMAX_DELAY);
+    if (sensorOn && !active) {
+        powerDownSensor();
+    }
+    xSemaphoreGive(powerMutex);
+}
+
+bool PowerService::isSensorOn() {
+    return sensorOn;
+}
+
+void PowerService::powerUpSensor(uint32_t requestMs) {
+    if (pmEnabled) {
+        esp_pm_lock_acquire(apbLock);
+        esp_pm_lock_acquire(noSleepLock);
+    }
+    cameraPowerUp();
+    sensorOn = true;
+    rearmLatencyMs = millis() - requestMs;
+    rearmUnreported = true;
+    updateState();
+}
+
+void PowerService::powerDownSensor() {
+    // A re-arm that no shot used was hidden from the user
+    if (rearmUnreported) {
+        tracker.recordRearm(rearmLatencyMs, 0);
+        rearmUnreported = false;
+    }
+    cameraPowerDown();
+    sensorOn = false;
+    if (pmEnabled) {
+        esp_pm_lock_release(noSleepLock);
+        esp_pm_lock_release(apbLock);
+    }
+    updateState();
+}
+
+void PowerService::updateState() {
+    int state = active ? POWER_STATE_ACTIVE : (sensorOn ? POWER_STATE_IDLE : POWER_STATE_SENSOR_OFF);
+    tracker.setState(state, millis());
+}
+
+void PowerService::powerTimerCallback(TimerHandle_t timer) {
+    GlobalState::getWorkerPool()->submit(JOB_PRIORITY_BACKGROUND, powerCheckJob, pvTimerGetTimerID(timer));
+}
+
+int PowerService::powerCheckJob(void* p) {
+    PowerService* service = static_cast<PowerService*>(p);
+    uint32_t now = millis();
+
+    xSemaphoreTake(service->powerMutex, portMAX_DELAY);
+    if (service->sensorOn && !service->active && service->tracker.isSensorIdle(now)) {
+        service->powerDownSensor();
+    }
+    bool logDue = now - service->lastLogMs >= POWER_LOG_PERIOD_MS;
+    xSemaphoreGive(service->powerMutex);
+
+    if (logDue) {
+        service->logStats();
+    }
+    return 0;
+}
+
+int PowerService::sensorPowerUpJob(void* p) {
+    PowerService* service = static_cast<PowerService*>(p);
+    xSemaphoreTake(service->powerMutex, portMAX_DELAY);
+    if (!service->sensorOn) {
+        service->powerUpSensor(service->rearmRequestMs);
+    }
+    xSemaphoreGive(service->powerMutex);
+    return 0;
+}
+
+void PowerService::logStats() {
+    xSemaphoreTake(powerMutex, portMAX_DELAY);
+    uint32_t now = millis();
+    lastLogMs = now;
+    for (int state = 0; state < POWER_STATE_COUNT; state++) {
+        Serial.printf("power: %s %lu s at %.0f mA\n", STATE_NAMES[state], (unsigned long) (tracker.getTimeInState(state, now) / 1000),
+                      PowerTracker::getStateCurrentMa(state));
+    }
+    Serial.printf("power: average %.1f mA, used %.2f mAh, re-arm %lu ms, sensor timeout %lu s\n",
+                  tracker.getAverageCurrentMa(now), tracker.getChargeUsedMah(now), (unsigned long) tracker.getRearmLatencyMs(),
+                  (unsigned long) (tracker.getSensorIdleTimeoutMs() / 1000));
+    xSemaphoreGive(powerMutex);
+}
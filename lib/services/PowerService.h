@@ -0,0 +1,164 @@
+#ifndef RETROLENS_POWER_SERVICE_H
+#define RETROLENS_POWER_SERVICE_H
+
+#include <Arduino.h>
+#include <esp_pm.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/timers.h>
+
+#include "PowerTracker.h"
+
+// CPU frequency range, the low end is used while waiting for the user
+#define POWER_MAX_CPU_FREQ_MHZ 240
+#define POWER_MIN_CPU_FREQ_MHZ 80
+
+// Period of the sensor idle check and of the power log
+#define POWER_CHECK_PERIOD_MS 1000
+#define POWER_LOG_PERIOD_MS 60000
+
+// Below this, acquiring the sensor did not make the shot wait
+#define SENSOR_WAIT_THRESHOLD_MS 2
+
+/**
+ * @class PowerService
+ * @brief Service that scales the CPU clock, lets the chip light sleep and powers the sensor down when idle.
+ *
+ * With power management available, the CPU runs at POWER_MAX_CPU_FREQ_MHZ only while a shot is
+ * active and the chip light sleeps, woken by the shutter pin, while the sensor is powered down.
+ * Otherwise the clock is switched with setCpuFrequencyMhz() and the chip never sleeps.
+ *
+ * The sensor is powered down through PWDN after the adaptive idle timeout of a PowerTracker.
+ * A press re-arms it in the background, so the wake-up overlaps the press, and a capture
+ * waits for it only if the press was shorter than the re-arm.
+ *
+ * Example usage:
+ * @code
+ * PowerService powerService;
+ * powerService.begin();
+ *
+ * // On a press
+ * powerService.noteActivity();
+ * powerService.prepareSensor();
+ *
+ * // On the shot
+ * powerService.setActive(true);
+ * powerService.acquireSensor();
+ * // Capture
+ * powerService.setActive(false);
+ * @endcode
+ */
+class PowerService {
+public:
+    /**
+     * @brief Constructor for PowerService.
+     *
+     * @param config Sensor power-down policy.
+     */
+    PowerService(const PowerConfig& config = PowerConfig());
+
+    /**
+     * @brief Configure power management, the wake source and start the idle checks.
+     */
+    void begin();
+
+    /**
+     * @brief Enter or leave the active state, at full clock.
+     *
+     * @param active True while a shot is running.
+     */
+    void setActive(bool active);
+
+    /**
+     * @brief Record user activity, restarting the sensor idle timeout.
+     */
+    void noteActivity();
+
+    /**
+     * @brief Submit a shutter job that powers the sensor up, if it is down.
+     */
+    void prepareSensor();
+
+    /**
+     * @brief Make sure the sensor is powered, waiting for a re-arm in progress.
+     */
+    void acquireSensor();
+
+    /**
+     * @brief Power the sensor down now, without waiting for the idle timeout.
+     * 
+     * Used before standby. Nothing happens while a shot is active.
+     */
+    void releaseSensor();
+
+    /**
+     * @brief Check if the sensor is powered and producing frames.
+     * 
+     * @return true if the sensor is on.
+     */
+    bool isSensorOn();
+
+    /**
+     * @brief Print the time spent in each state and the estimated current draw.
+     */
+    void logStats();
+
+private:
+    /**
+     * @brief Timer callback that submits the idle check.
+     *
+     * @param timer Timer whose ID is the PowerService instance.
+     */
+    static void powerTimerCallback(TimerHandle_t timer);
+
+    /**
+     * @brief Job function that powers the sensor down when idle and logs periodically.
+     *
+     * @param p Pointer to the PowerService instance.
+     * @return int Always 0.
+     */
+    static int powerCheckJob(void* p);
+
+    /**
+     * @brief Job function that powers the sensor up.
+     *
+     * @param p Pointer to the PowerService instance.
+     * @return int Always 0.
+     */
+    static int sensorPowerUpJob(void* p);
+
+    /**
+     * @brief Power the sensor up. Must be called with the power mutex held.
+     *
+     * @param requestMs Time the re-arm was requested.
+     */
+    void powerUpSensor(uint32_t requestMs);
+
+    /**
+     * @brief Power the sensor down. Must be called with the power mutex held.
+     */
+    void powerDownSensor();
+
+    /**
+     * @brief Update the tracked state from the active flag and the sensor power. Must be called with the power mutex held.
+     */
+    void updateState();
+
+    PowerTracker tracker;               ///< Time accounting and sensor policy.
+    SemaphoreHandle_t powerMutex;       ///< Protects the tracker and the sensor power.
+    StaticSemaphore_t powerMutexBuffer; ///< Storage of the power mutex.
+    volatile bool sensorOn;             ///< True while the sensor is powered.
+    bool active;                        ///< True while a shot is running.
+    volatile uint32_t rearmRequestMs;   ///< Time of the last re-arm request.
+    uint32_t rearmLatencyMs;            ///< Latency of the last re-arm.
+    bool rearmUnreported;               ///< True until the last re-arm is reported to the tracker.
+    uint32_t lastLogMs;                 ///< Time of the last power log.
+    bool pmEnabled;                     ///< True if esp_pm scales the clock and light sleeps.
+    esp_pm_lock_handle_t cpuLock;       ///< Full clock while active.
+    esp_pm_lock_handle_t apbLock;       ///< Fixed APB clock for the camera while the sensor is on.
+    esp_pm_lock_handle_t noSleepLock;   ///< No light sleep while the sensor is on.
+    TimerHandle_t powerTimer;           ///< Timer of the idle checks.
+    StaticTimer_t powerTimerBuffer;     ///< Storage of the timer.
+};
+
+#endif // RETROLENS_POWER_SERVICE_H
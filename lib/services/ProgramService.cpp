@@ -2,25 +2,38 @@
 #include <OLEDDisplay.h>
 #include <SSD1306Wire.h>
 #include "GlobalState.h"
-#include "StaticImages.h"
+#include "SpriteBlitter.h"
+#include "UiSprites.h"
 #include "ProgramService.h"
 
+static const char* SHOT_MODE_NAMES[SHOT_MODE_COUNT] = {"Single", "Stack", "Double", "Film"};
+static const char* BLEND_MODE_NAMES[BLEND_MODE_COUNT] = {"Add", "Screen"};
+static const char* ROTATION_NAMES[JPEG_ROTATE_COUNT] = {"Upright", "Turn 90", "Turn 180", "Turn 270"};
+static const char* CROP_NAMES[JPEG_CROP_COUNT] = {"Full", "3:2", "Square"};
 
-ProgramService::ProgramService() {
-    display = new SSD1306Wire(0x3c, SCREEN_I2C_SDA, SCREEN_I2C_SCL);
-    buttonEventQueue = xQueueCreate(10, sizeof(int));
-    GlobalState::getButtonService()->subscribe(buttonEventQueue);
+ProgramService::ProgramService() : display(0x3c, SCREEN_I2C_SDA, SCREEN_I2C_SCL), programTask(nullptr) {
+    buttonSubscriber = GlobalState::getEventBus()->subscribe(EVENT_MASK(EVENT_BUTTON));
+    saveResultSubscriber = GlobalState::getEventBus()->subscribe(EVENT_MASK(EVENT_SAVE_RESULT));
 }
 
 void ProgramService::initProgram() {
 
-    xTaskCreate(programTaskFunction, "ProgramTask", 2048, this, 1, &programTask);
+    programTask = xTaskCreateStatic(programTaskFunction, "ProgramTask", PROGRAM_TASK_STACK_SIZE, this, 1,
+                                    programTaskStack, &programTaskBuffer);
 }
 
 void ProgramService::setNextState(void (ProgramService::*nextState)()) {
     this->nextState = nextState;
 }
 
+void ProgramService::setFlashOn(bool flashOn) {
+    isFlashOn = flashOn;
+}
+
+void ProgramService::resumeFromStandby() {
+    wakePressPending = true;
+}
+
 void ProgramService::programTaskFunction(void *p) {
     ProgramService *programService = static_cast<ProgramService *>(p);
     // Set the initial state
@@ -31,41 +44,74 @@ void ProgramService::programTaskFunction(void *p) {
     }
 }
 
+bool ProgramService::receiveButtonEvent(int* buttonEvent, long timeoutMs) {
+    Event event;
+    if (GlobalState::getEventBus()->receive(buttonSubscriber, &event, timeoutMs / portTICK_PERIOD_MS)) {
+        *buttonEvent = event.payload.button;
+        lastActivityMs = millis();
+        GlobalState::getPowerService()->noteActivity();
+        // Wake the sensor during the press, a shot may follow on release
+        if (*buttonEvent == BUTTON_PRESSED) {
+            // The deferred work gives the card back first
+            GlobalState::getDevelopService()->setIdle(false);
+            GlobalState::getPowerService()->prepareSensor();
+            // Keep the frames around the press for the shot
+            GlobalState::getZslService()->notePress(GlobalState::getButtonService()->getLastPressTimeUs());
+        }
+        return true;
+    }
+    return false;
+}
+
+int ProgramService::waitForGesture(long timeoutMs) {
+    long startTime = millis();
+    int buttonEvent;
+    long remainingMs = timeoutMs;
+    while (remainingMs > 0 && receiveButtonEvent(&buttonEvent, remainingMs)) {
+        // Skip raw edges and hold repeats, menus only react to complete gestures
+        if (buttonEvent != BUTTON_PRESSED && buttonEvent != BUTTON_RELEASED && buttonEvent != BUTTON_HOLD_REPEAT) {
+            return buttonEvent;
+        }
+        remainingMs = timeoutMs - (millis() - startTime);
+    }
+    return -1;
+}
+
 #define HOME_SCREEN_TIMEOUT 10000
 void ProgramService::homeScreen() {
-    drawHomeScreen();
+    // The screen shares its pins with the SD card, a wake press shoots before drawing
+    if (wakePressPending) {
+        wakePressPending = false;
+    } else {
+        drawHomeScreen();
+        // Deferred work runs while the camera waits here
+        GlobalState::getDevelopService()->setIdle(true);
+    }
 
     // Wait for button press
     int buttonEvent;
-    if (xQueueReceive(buttonEventQueue, &buttonEvent, HOME_SCREEN_TIMEOUT / portTICK_PERIOD_MS)) {
+    if (receiveButtonEvent(&buttonEvent, HOME_SCREEN_TIMEOUT)) {
         if (buttonEvent == BUTTON_PRESSED) {
             // Wait for button release
-            if (xQueueReceive(buttonEventQueue, &buttonEvent, BUTTON_CANCEL_TIMEOUT / portTICK_PERIOD_MS)) {
+            if (receiveButtonEvent(&buttonEvent, BUTTON_CANCEL_TIMEOUT)) {
                 if (buttonEvent == BUTTON_RELEASED) {
                     // Take a picture if no image save is in progress
                     if (GlobalState::getSaveService()->isImageSaveInProgress() == false) {
-                        QueueHandle_t saveImageResultQueue = xQueueCreate(1, sizeof(SaveErrorMessage));
-                        if (isFlashOn) {
-                            GlobalState::setFlashState(true);
-                        }
-                        GlobalState::getSaveService()->startImageSaveTask(saveImageResultQueue);
+                        // Drop stale results before starting a new save
+                        GlobalState::getEventBus()->flush(saveResultSubscriber);
+                        GlobalState::getSaveService()->requestImageSave(GlobalState::getButtonService()->getLastPressTimeUs(), isFlashOn,
+                                                                                  shotMode);
                         drawTakingPictureScreen();
-                        SaveErrorMessage result;
-                        if (xQueueReceive(saveImageResultQueue, &result, portMAX_DELAY)) {
-                            if (result.code == 0) {
+                        Event result;
+                        if (GlobalState::getEventBus()->receive(saveResultSubscriber, &result, portMAX_DELAY)) {
+                            if (result.payload.saveResult.code == 0) {
                                 // Set the next state to the film download screen
                                 setNextState(&ProgramService::homeScreen);
                                 Serial.println("Image saved successfully");
-                                if (isFlashOn) {
-                                    GlobalState::setFlashState(false);
-                                }
                                 return;
                             }
                         } else {
                             // TODO: Handle error
-                            if (isFlashOn) {
-                                GlobalState::setFlashState(false);
-                            }
                         }
                     }
                 } else if (buttonEvent == BUTTON_LONG_PRESSED) {
@@ -76,58 +122,101 @@ void ProgramService::homeScreen() {
         }
     }
 
+    // Nothing happened for a long time, the camera is pocketed
+    if (millis() - lastActivityMs >= STANDBY_IDLE_TIMEOUT_MS && !GlobalState::getSaveService()->isImageSaveInProgress()) {
+        enterStandby();
+        setNextState(&ProgramService::homeScreen);
+        return;
+    }
+
     // Check battery status
-    GlobalState::getBatteryReaderService()->startBatteryReadTask();
+    GlobalState::getBatteryReaderService()->requestBatteryRead();
     setNextState(&ProgramService::homeScreen);
 }
 
+void ProgramService::enterStandby() {
+    GlobalState::getDevelopService()->setIdle(false);
+    GlobalState::safelyTakeScreen();
+    display.init();
+    display.displayOff();
+    releaseDisplay();
+    GlobalState::safelyFreeScreen();
+
+    StandbySettings settings;
+    settings.rollIndex = GlobalState::getSaveService()->getRollIndex();
+    settings.flashOn = isFlashOn ? 1 : 0;
+    settings.sensor = getSensorProfile();
+    GlobalState::getStandbyService()->enterStandby(settings);
+
+    // Back from light sleep, the shutter press woke the camera
+    lastActivityMs = millis();
+    resumeFromStandby();
+    GlobalState::getButtonService()->replayWakePress();
+}
+
+void ProgramService::releaseDisplay() {
+    // Only release the I2C bus, display.end() would free the frame buffer that init() allocates again
+    Wire.end();
+}
+
 void ProgramService::drawTakingPictureScreen() {
     GlobalState::safelyTakeScreen();
-    display->init();
-    display->clear();
-    display->setFont(ArialMT_Plain_10);
-    display->setTextAlignment(TEXT_ALIGN_LEFT);
-    display->drawString(0, 0, "Taking Picture...");
-    display->drawXbm(10, 10, HAPPY_XBM_WIDTH, HAPPY_XBM_HEIGHT, HAPPY_XBM_IMAGE);
-    display->display();
-    display->end();
+    display.init();
+    display.clear();
+    display.setFont(ArialMT_Plain_10);
+    display.setTextAlignment(TEXT_ALIGN_LEFT);
+    display.drawString(0, 0, "Taking Picture...");
+    drawSprite(SPRITE_HAPPY, 10, 10);
+    display.display();
+    releaseDisplay();
     GlobalState::safelyFreeScreen();
 }
 
+void ProgramService::drawSprite(int sprite, int x, int y) {
+    // Decoded from the atlas straight into the frame buffer, page by page
+    SpriteBlitter blitter(display.buffer, display.getWidth(), display.getHeight());
+    blitter.draw(UI_SPRITES, sprite, x, y);
+}
+
 void ProgramService::drawBatteryStatus() {
-    display->setFont(ArialMT_Plain_10);
-    display->setTextAlignment(TEXT_ALIGN_LEFT);
+    display.setFont(ArialMT_Plain_10);
+    display.setTextAlignment(TEXT_ALIGN_LEFT);
     float percentage = GlobalState::getBatteryReaderService()->getLastBatteryLevel();
-    display->drawXbm(5, 5, BATTERY_XBM_WIDTH, BATTERY_XBM_HEIGHT, BATTERY_XBM_IMAGE);
+    drawSprite(SPRITE_BATTERY, 5, 5);
     // Draw vertical lines depending on the battery level
     for (int i = 0; i < 5; i++) {
         if (true){//percentage > i * 20) {
-            display->drawVerticalLine(7 + i * 4, 7, 9);
-            display->drawVerticalLine(8 + i * 4, 7, 9);
-            display->drawVerticalLine(9 + i * 4, 7, 9);
+            display.drawVerticalLine(7 + i * 4, 7, 9);
+            display.drawVerticalLine(8 + i * 4, 7, 9);
+            display.drawVerticalLine(9 + i * 4, 7, 9);
         }
     }
 }
 
 void ProgramService::drawFlashStatus() {
     if (isFlashOn) {
-        display->drawXbm(108, 5, FLASH_SMALL_XBM_WIDTH, FLASH_SMALL_XBM_HEIGHT, FLASH_SMALL_XBM_IMAGE);
+        drawSprite(SPRITE_FLASH_SMALL, 108, 5);
         return;
     }
-    display->drawXbm(108, 5, FLASH_SMALL_OFF_XBM_WIDTH, FLASH_SMALL_OFF_XBM_HEIGHT, FLASH_SMALL_OFF_XBM_IMAGE);
+    drawSprite(SPRITE_FLASH_SMALL_OFF, 108, 5);
 }
 
 void ProgramService::drawHomeScreen() {
     GlobalState::safelyTakeScreen();
-    display->init();
-    display->clear();
+    display.init();
+    display.clear();
     drawBatteryStatus();
     drawFlashStatus();
-    display->setFont(ArialMT_Plain_24);
-    display->setTextAlignment(TEXT_ALIGN_LEFT);
-    display->drawString(0, 30, "Home Screen");
-    display->display();
-    display->end();
+    if (shotMode == SHOT_MODE_DOUBLE && GlobalState::getDoubleExposureService()->hasFirstExposure()) {
+        display.drawString(40, 5, "1 of 2");
+    } else if (shotMode != SHOT_MODE_SINGLE) {
+        display.drawString(40, 5, SHOT_MODE_NAMES[shotMode]);
+    }
+    display.setFont(ArialMT_Plain_24);
+    display.setTextAlignment(TEXT_ALIGN_LEFT);
+    display.drawString(0, 30, "Home Screen");
+    display.display();
+    releaseDisplay();
     GlobalState::safelyFreeScreen();
 }
 
@@ -135,27 +224,24 @@ void ProgramService::drawHomeScreen() {
 void ProgramService::flashScreen() {
     drawFlashScreen();
 
-    // Wait for button press
-    int buttonEvent;
-    if (xQueueReceive(buttonEventQueue, &buttonEvent, FLASH_SCREEN_TIMEOUT / portTICK_PERIOD_MS)) {
-        if (buttonEvent == BUTTON_PRESSED) {
-            // Wait for button release
-            if (xQueueReceive(buttonEventQueue, &buttonEvent, BUTTON_CANCEL_TIMEOUT / portTICK_PERIOD_MS)) {
-                if (buttonEvent == BUTTON_RELEASED) {
-                    // Set the next state to the home screen
-                    setNextState(&ProgramService::filmDownloadScreen);
-                    return;
-                } else if (buttonEvent == BUTTON_LONG_PRESSED) {
-                    // Toggle the flash
-                    isFlashOn = !isFlashOn;
-                    setNextState(&ProgramService::flashScreen);
-                    return;
-                }
-            }
-        } else {
-            setNextState(&ProgramService::flashScreen);
-            return;
-        }
+    // Wait for a gesture
+    int gesture = waitForGesture(FLASH_SCREEN_TIMEOUT);
+    if (gesture == BUTTON_SINGLE_CLICK) {
+        // Go to the next screen
+        setNextState(&ProgramService::modeScreen);
+        return;
+    } else if (gesture == BUTTON_DOUBLE_CLICK || gesture == BUTTON_LONG_PRESSED) {
+        // Toggle the flash
+        isFlashOn = !isFlashOn;
+        setNextState(&ProgramService::flashScreen);
+        return;
+    } else if (gesture == BUTTON_TRIPLE_CLICK) {
+        // Shortcut back to the home screen
+        setNextState(&ProgramService::homeScreen);
+        return;
+    } else if (gesture != -1) {
+        setNextState(&ProgramService::flashScreen);
+        return;
     }
     
     setNextState(&ProgramService::homeScreen);
@@ -163,44 +249,200 @@ void ProgramService::flashScreen() {
 
 void ProgramService::drawFlashScreen() {
     GlobalState::safelyTakeScreen();
-    display->init();
-    display->clear();
-    display->setFont(ArialMT_Plain_10);
-    display->setTextAlignment(TEXT_ALIGN_LEFT);
-    display->drawString(0, 0, "Flash Screen");
+    display.init();
+    display.clear();
+    display.setFont(ArialMT_Plain_10);
+    display.setTextAlignment(TEXT_ALIGN_LEFT);
+    display.drawString(0, 0, "Flash Screen");
     // Draw the flash status
-    display->drawString(0, 10, "Flash: ");
-    display->drawString(0, 20, isFlashOn ? "On" : "Off");
-    display->display();
-    display->end();
+    display.drawString(0, 10, "Flash: ");
+    display.drawString(0, 20, isFlashOn ? "On" : "Off");
+    display.display();
+    releaseDisplay();
     GlobalState::safelyFreeScreen();  
 }
 
+#define MODE_SCREEN_TIMEOUT 50000
+void ProgramService::modeScreen() {
+    drawModeScreen();
+
+    // Wait for a gesture
+    int gesture = waitForGesture(MODE_SCREEN_TIMEOUT);
+    if (gesture == BUTTON_SINGLE_CLICK) {
+        // Go to the next screen
+        setNextState(&ProgramService::stampScreen);
+        return;
+    } else if (gesture == BUTTON_LONG_PRESSED && shotMode == SHOT_MODE_DOUBLE) {
+        // Toggle the blend of the double exposure
+        DoubleExposureService* doubleExposure = GlobalState::getDoubleExposureService();
+        doubleExposure->setBlendMode((doubleExposure->getBlendMode() + 1) % BLEND_MODE_COUNT);
+        setNextState(&ProgramService::modeScreen);
+        return;
+    } else if (gesture == BUTTON_DOUBLE_CLICK || gesture == BUTTON_LONG_PRESSED) {
+        // Cycle the shot mode, a pending first exposure is dropped
+        if (shotMode == SHOT_MODE_DOUBLE) {
+            GlobalState::getDoubleExposureService()->cancel();
+        }
+        shotMode = (shotMode + 1) % SHOT_MODE_COUNT;
+        setNextState(&ProgramService::modeScreen);
+        return;
+    } else if (gesture == BUTTON_TRIPLE_CLICK) {
+        // Shortcut back to the home screen
+        setNextState(&ProgramService::homeScreen);
+        return;
+    } else if (gesture != -1) {
+        setNextState(&ProgramService::modeScreen);
+        return;
+    }
+
+    setNextState(&ProgramService::homeScreen);
+}
+
+void ProgramService::drawModeScreen() {
+    GlobalState::safelyTakeScreen();
+    display.init();
+    display.clear();
+    display.setFont(ArialMT_Plain_10);
+    display.setTextAlignment(TEXT_ALIGN_LEFT);
+    display.drawString(0, 0, "Mode Screen");
+    display.drawString(0, 10, "Shot: ");
+    display.drawString(0, 20, SHOT_MODE_NAMES[shotMode]);
+    if (shotMode == SHOT_MODE_STACK && !GlobalState::getStackService()->isAvailable()) {
+        display.drawString(0, 30, "No memory");
+    } else if (shotMode == SHOT_MODE_FILM && !GlobalState::getRawCaptureService()->isAvailable()) {
+        display.drawString(0, 30, "No memory");
+    } else if (shotMode == SHOT_MODE_DOUBLE) {
+        if (!GlobalState::getDoubleExposureService()->isAvailable()) {
+            display.drawString(0, 30, "No memory");
+        } else {
+            display.drawString(0, 30, BLEND_MODE_NAMES[GlobalState::getDoubleExposureService()->getBlendMode()]);
+        }
+    }
+    display.display();
+    releaseDisplay();
+    GlobalState::safelyFreeScreen();
+}
+
+#define STAMP_SCREEN_TIMEOUT 50000
+void ProgramService::stampScreen() {
+    drawStampScreen();
+
+    // Wait for a gesture
+    int gesture = waitForGesture(STAMP_SCREEN_TIMEOUT);
+    if (gesture == BUTTON_SINGLE_CLICK) {
+        // Go to the next screen
+        setNextState(&ProgramService::frameScreen);
+        return;
+    } else if (gesture == BUTTON_DOUBLE_CLICK) {
+        // Toggle the date stamp
+        SaveService* saveService = GlobalState::getSaveService();
+        saveService->setDateStampOn(!saveService->isDateStampOn());
+        setNextState(&ProgramService::stampScreen);
+        return;
+    } else if (gesture == BUTTON_LONG_PRESSED) {
+        // Toggle the film border
+        SaveService* saveService = GlobalState::getSaveService();
+        saveService->setFilmBorderOn(!saveService->isFilmBorderOn());
+        setNextState(&ProgramService::stampScreen);
+        return;
+    } else if (gesture == BUTTON_TRIPLE_CLICK) {
+        // Shortcut back to the home screen
+        setNextState(&ProgramService::homeScreen);
+        return;
+    } else if (gesture != -1) {
+        setNextState(&ProgramService::stampScreen);
+        return;
+    }
+
+    setNextState(&ProgramService::homeScreen);
+}
+
+void ProgramService::drawStampScreen() {
+    GlobalState::safelyTakeScreen();
+    display.init();
+    display.clear();
+    display.setFont(ArialMT_Plain_10);
+    display.setTextAlignment(TEXT_ALIGN_LEFT);
+    display.drawString(0, 0, "Stamp Screen");
+    display.drawString(0, 10, GlobalState::getSaveService()->isDateStampOn() ? "Date: On" : "Date: Off");
+    display.drawString(0, 20, GlobalState::getSaveService()->isFilmBorderOn() ? "Border: On" : "Border: Off");
+    if (shotMode != SHOT_MODE_SINGLE) {
+        display.drawString(0, 30, "Single shots only");
+    }
+    display.display();
+    releaseDisplay();
+    GlobalState::safelyFreeScreen();
+}
+
+#define FRAME_SCREEN_TIMEOUT 50000
+void ProgramService::frameScreen() {
+    drawFrameScreen();
+
+    // Wait for a gesture
+    SaveService* saveService = GlobalState::getSaveService();
+    int gesture = waitForGesture(FRAME_SCREEN_TIMEOUT);
+    if (gesture == BUTTON_SINGLE_CLICK) {
+        // Go to the next screen
+        setNextState(&ProgramService::filmDownloadScreen);
+        return;
+    } else if (gesture == BUTTON_DOUBLE_CLICK) {
+        // Cycle the turn
+        saveService->setFrameTransform((saveService->getFrameRotation() + 1) % JPEG_ROTATE_COUNT, saveService->getFrameCrop());
+        setNextState(&ProgramService::frameScreen);
+        return;
+    } else if (gesture == BUTTON_LONG_PRESSED) {
+        // Cycle the crop
+        saveService->setFrameTransform(saveService->getFrameRotation(), (saveService->getFrameCrop() + 1) % JPEG_CROP_COUNT);
+        setNextState(&ProgramService::frameScreen);
+        return;
+    } else if (gesture == BUTTON_TRIPLE_CLICK) {
+        // Shortcut back to the home screen
+        setNextState(&ProgramService::homeScreen);
+        return;
+    } else if (gesture != -1) {
+        setNextState(&ProgramService::frameScreen);
+        return;
+    }
+
+    setNextState(&ProgramService::homeScreen);
+}
+
+void ProgramService::drawFrameScreen() {
+    SaveService* saveService = GlobalState::getSaveService();
+    GlobalState::safelyTakeScreen();
+    display.init();
+    display.clear();
+    display.setFont(ArialMT_Plain_10);
+    display.setTextAlignment(TEXT_ALIGN_LEFT);
+    display.drawString(0, 0, "Frame Screen");
+    display.drawString(0, 10, ROTATION_NAMES[saveService->getFrameRotation()]);
+    display.drawString(0, 20, CROP_NAMES[saveService->getFrameCrop()]);
+    if (shotMode != SHOT_MODE_SINGLE) {
+        display.drawString(0, 30, "Single shots only");
+    }
+    display.display();
+    releaseDisplay();
+    GlobalState::safelyFreeScreen();
+}
+
 #define FILM_DOWNLOAD_SCREEN_TIMEOUT 30000
 void ProgramService::filmDownloadScreen() {
     drawFilmDownloadScreen();
 
-    // Wait for button press
-    int buttonEvent;
-    if (xQueueReceive(buttonEventQueue, &buttonEvent, FILM_DOWNLOAD_SCREEN_TIMEOUT / portTICK_PERIOD_MS)) {
-        if (buttonEvent == BUTTON_PRESSED) {
-            // Wait for button release
-            if (xQueueReceive(buttonEventQueue, &buttonEvent, BUTTON_CANCEL_TIMEOUT / portTICK_PERIOD_MS)) {
-                if (buttonEvent == BUTTON_RELEASED) {
-                    // Set the next state to the home screen
-                    setNextState(&ProgramService::homeScreen);
-                    return;
-                } else if (buttonEvent == BUTTON_LONG_PRESSED) {
-                    // Start film download
-                    //GlobalState::getDownloadService()->startFilmDownload();
-                    setNextState(&ProgramService::homeScreen);
-                    return;
-                }
-            }
-        } else {
-            setNextState(&ProgramService::filmDownloadScreen);
-            return;
-        }
+    // Wait for a gesture
+    int gesture = waitForGesture(FILM_DOWNLOAD_SCREEN_TIMEOUT);
+    if (gesture == BUTTON_SINGLE_CLICK || gesture == BUTTON_TRIPLE_CLICK) {
+        // Set the next state to the home screen
+        setNextState(&ProgramService::homeScreen);
+        return;
+    } else if (gesture == BUTTON_LONG_PRESSED) {
+        // Start film download
+        //GlobalState::getDownloadService()->startFilmDownload();
+        setNextState(&ProgramService::homeScreen);
+        return;
+    } else if (gesture != -1) {
+        setNextState(&ProgramService::filmDownloadScreen);
+        return;
     }
     
     setNextState(&ProgramService::homeScreen);
@@ -208,12 +450,31 @@ void ProgramService::filmDownloadScreen() {
 
 void ProgramService::drawFilmDownloadScreen() {
     GlobalState::safelyTakeScreen();
-    display->init();
-    display->clear();
-    display->setFont(ArialMT_Plain_10);
-    display->setTextAlignment(TEXT_ALIGN_LEFT);
-    display->drawString(0, 0, "Film Download Screen");
-    display->display();
-    display->end();
+    display.init();
+    display.clear();
+    display.setFont(ArialMT_Plain_10);
+    display.setTextAlignment(TEXT_ALIGN_LEFT);
+    display.drawString(0, 0, "Film Download Screen");
+
+    // Deferred work, done on the home screen
+    DevelopService* developService = GlobalState::getDevelopService();
+    int pending = developService->getPending();
+    char text[32];
+    if (pending > 0) {
+        int done = (int) developService->getCompleted();
+        snprintf(text, sizeof(text), "Developing %d of %d", done + 1, done + pending);
+        display.drawString(0, 12, text);
+        display.drawProgressBar(0, 26, 120, 8, developService->getTaskPercent());
+        display.drawString(0, 38, developService->isBatteryLow() ? "Paused, battery low" : "Runs on the home screen");
+    } else {
+        snprintf(text, sizeof(text), "All developed (%lu)", (unsigned long) developService->getCompleted());
+        display.drawString(0, 12, text);
+    }
+    if (developService->getFailed() > 0) {
+        snprintf(text, sizeof(text), "%lu failed", (unsigned long) developService->getFailed());
+        display.drawString(0, 50, text);
+    }
+    display.display();
+    releaseDisplay();
     GlobalState::safelyFreeScreen();  
 }
\ No newline at end of file
@@ -2,8 +2,10 @@
 #define RETROLENS_PROGRAM_SERVICE_H
 #include <SSD1306Wire.h>
 #include "SystemConfig.h"
+#include "SaveService.h"
 
 #define BUTTON_CANCEL_TIMEOUT 5000
+#define PROGRAM_TASK_STACK_SIZE 2048
 
 class ProgramService {
 public:
@@ -15,13 +17,35 @@ public:
 
     void flashScreen();
 
+    void modeScreen();
+
+    void stampScreen();
+
+    void frameScreen();
+
     void filmDownloadScreen();
 
     void setNextState(void (ProgramService::*nextState)());
 
+    /**
+     * @brief Restore the flash setting.
+     * 
+     * @param flashOn True if the flash fires on the shot.
+     */
+    void setFlashOn(bool flashOn);
+
+    /**
+     * @brief Go straight to the shot on the first home screen, without drawing it.
+     * 
+     * Set when the shutter press that woke the camera is about to be delivered.
+     */
+    void resumeFromStandby();
+
 private:
     void drawHomeScreen();
 
+    void drawSprite(int sprite, int x, int y);
+
     void drawBatteryStatus();
 
     void drawFlashStatus();
@@ -30,19 +54,61 @@ private:
 
     void drawFlashScreen();
 
+    void drawModeScreen();
+
+    void drawStampScreen();
+
+    void drawFrameScreen();
+
     void drawFilmDownloadScreen();
 
+    void releaseDisplay();
+
+    /**
+     * @brief Turn the display off, save the settings and sleep until the shutter is pressed.
+     */
+    void enterStandby();
+
     static void programTaskFunction(void *p);
 
-    QueueHandle_t buttonEventQueue;
-    SSD1306Wire* display;
+    /**
+     * @brief Wait for a button gesture, ignoring raw presses, releases and hold repeats.
+     * 
+     * @param timeoutMs Maximum time to wait in milliseconds.
+     * @return int The gesture event, or -1 on timeout.
+     */
+    int waitForGesture(long timeoutMs);
+
+    /**
+     * @brief Wait for the next button event on the event bus.
+     * 
+     * @param buttonEvent Output button event.
+     * @param timeoutMs Maximum time to wait in milliseconds.
+     * @return true if an event was received, false on timeout.
+     */
+    bool receiveButtonEvent(int* buttonEvent, long timeoutMs);
+
+    int buttonSubscriber;
+    int saveResultSubscriber;
+    SSD1306Wire display;
     TaskHandle_t programTask;
+    StaticTask_t programTaskBuffer;
+    StackType_t programTaskStack[PROGRAM_TASK_STACK_SIZE];
 
 
     // Pointer to the next state function
     void (ProgramService::*nextState)();
 
     bool isFlashOn = false;
+
+    // One of the SHOT_MODE_* values
+    int shotMode = SHOT_MODE_SINGLE;
+
+    // Time of the last button event, standby follows STANDBY_IDLE_TIMEOUT_MS without one
+    uint32_t lastActivityMs = 0;
+
+    // True while the press that woke the camera has not been handled
+    volatile bool wakePressPending = false;
 };
 
 #endif //RETROLENS_PROGRAM_SERVICE_H
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <esp_timer.h>
+
+#include "RateService.h"
+
+RateService::RateService(const RateConfig& config)
+    : controller(config), quality(config.minQuality), previousQuality(config.minQuality), qualityChangedUs(0),
+      lastTargetBytes(controller.getTargetBytes()) {
+    rateMutex = xSemaphoreCreateMutexStatic(&rateMutexBuffer);
+}
+
+void RateService::onFrame(const camera_fb_t* frameBuffer) {
+    if (frameBuffer == nullptr || frameBuffer->format != PIXFORMAT_JPEG) {
+        return;
+    }
+    xSemaphoreTake(rateMutex, portMAX_DELAY);
+    // A frame read out before the switch was encoded at the previous quality
+    uint8_t frameQuality = cameraFrameTimeUs(frameBuffer) >= qualityChangedUs ? quality : previousQuality;
+    lastTargetBytes = controller.getTargetBytes();
+    controller.onFrame(frameBuffer->len, frameQuality);
+    applyQuality();
+    xSemaphoreGive(rateMutex);
+}
+
+void RateService::noteDetail(uint32_t detail) {
+    xSemaphoreTake(rateMutex, portMAX_DELAY);
+    controller.noteDetail(detail);
+    applyQuality();
+    xSemaphoreGive(rateMutex);
+}
+
+void RateService::noteWrite(uint32_t bytes, uint32_t durationMs) {
+    xSemaphoreTake(rateMutex, portMAX_DELAY);
+    controller.noteWrite(bytes, durationMs);
+    applyQuality();
+    xSemaphoreGive(rateMutex);
+}
+
+void RateService::setFinestQuality(uint8_t quality) {
+    xSemaphoreTake(rateMutex, portMAX_DELAY);
+    controller.setFinestQuality(quality);
+    applyQuality();
+    xSemaphoreGive(rateMutex);
+}
+
+void RateService::reportShot(const camera_fb_t* frameBuffer) {
+    xSemaphoreTake(rateMutex, portMAX_DELAY);
+    uint32_t target = lastTargetBytes > 0 ? lastTargetBytes : 1;
+    Serial.printf("rate: frame %lu bytes, target %lu bytes (%lu%%), next quality %u\n", (unsigned long) frameBuffer->len,
+                  (unsigned long) target, (unsigned long) ((uint64_t) frameBuffer->len * 100 / target), quality);
+    xSemaphoreGive(rateMutex);
+    logStats();
+}
+
+void RateService::logStats() {
+    xSemaphoreTake(rateMutex, portMAX_DELAY);
+    Serial.printf("rate: %lu frames, %lu over budget, mean %lu%% of target, card %lu kB/s\n",
+                  (unsigned long) controller.getFrameCount(), (unsigned long) controller.getOverBudgetCount(),
+                  (unsigned long) controller.getMeanSizePercent(), (unsigned long) (controller.getWriteBytesPerSecond() / 1000));
+    xSemaphoreGive(rateMutex);
+}
+
+void RateService::applyQuality() {
+    uint8_t next = controller.getQuality();
+    if (next == quality) {
+        return;
+    }
+    cameraSetJpegQuality(next);
+    previousQuality = quality;
+    quality = next;
+    qualityChangedUs = esp_timer_get_time();
+}
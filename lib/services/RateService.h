@@ -0,0 +1,97 @@
+#ifndef RETROLENS_RATE_SERVICE_H
+#define RETROLENS_RATE_SERVICE_H
+
+#include <Arduino.h>
+#include <esp_camera.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include "CameraUtils.h"
+#include "RateController.h"
+
+/**
+ * @class RateService
+ * @brief Service that adjusts the sensor JPEG quality between frames to hold a file-size and write-time budget.
+ *
+ * Every frame the camera delivers is fed to a RateController, which picks the quality of the next
+ * frame and the sensor is switched when it changes. A frame that started before the last switch
+ * is counted at the quality it was encoded with. The metering frames give the scene detail before
+ * the first frame of a shot, and each SD write gives the card throughput. Saved frames are
+ * reported against their target.
+ *
+ * Example usage:
+ * @code
+ * // For each captured frame
+ * rateService.onFrame(fb);
+ *
+ * // After saving
+ * rateService.noteWrite(fb->len, writeMs);
+ * rateService.reportShot(fb);
+ * @endcode
+ */
+class RateService {
+public:
+    /**
+     * @brief Constructor for RateService.
+     *
+     * @param config Budgets and quality range.
+     */
+    RateService(const RateConfig& config = RateConfig());
+
+    /**
+     * @brief Learn from a captured frame and switch the sensor quality if needed.
+     *
+     * @param frameBuffer Captured JPEG frame.
+     */
+    void onFrame(const camera_fb_t* frameBuffer);
+
+    /**
+     * @brief Record the detail of the scene from a metering frame.
+     *
+     * @param detail Detail from LumaMeter::measureDetail().
+     */
+    void noteDetail(uint32_t detail);
+
+    /**
+     * @brief Record an SD write.
+     *
+     * @param bytes Bytes written.
+     * @param durationMs Time the write took.
+     */
+    void noteWrite(uint32_t bytes, uint32_t durationMs);
+
+    /**
+     * @brief Keep the quality at or coarser than the one of a film, and switch the sensor if needed.
+     *
+     * @param quality Finest JPEG quality of the film, 0 for the camera's.
+     */
+    void setFinestQuality(uint8_t quality);
+
+    /**
+     * @brief Print the size of a saved frame against its target.
+     *
+     * @param frameBuffer Saved frame, already fed to onFrame().
+     */
+    void reportShot(const camera_fb_t* frameBuffer);
+
+    /**
+     * @brief Print the rate control statistics.
+     */
+    void logStats();
+
+private:
+    /**
+     * @brief Switch the sensor to the quality picked by the controller. Must be called with the rate mutex held.
+     */
+    void applyQuality();
+
+    RateController controller;         ///< Quality predictor.
+    SemaphoreHandle_t rateMutex;       ///< Protects the controller, frames and writes come from different tasks.
+    StaticSemaphore_t rateMutexBuffer; ///< Storage of the rate mutex.
+    uint8_t quality;                   ///< Quality set on the sensor.
+    uint8_t previousQuality;           ///< Quality before the last switch.
+    int64_t qualityChangedUs;          ///< Time of the last switch, on the esp_timer clock.
+    uint32_t lastTargetBytes;          ///< Target the last frame was aimed at.
+};
+
+#endif // RETROLENS_RATE_SERVICE_H
@@ -0,0 +1,111 @@
+#include "Films.h"
+#include "GlobalState.h"
+#include "GrainTiles.h"
+#include "LutPartition.h"
+#include "RawCaptureService.h"
+
+RawCaptureService::RawCaptureService()
+    : runner(GlobalState::getWorkerPool()), stock(nullptr), stockPending(false), frameCount(0), totalEncodeMs(0),
+      totalPixels(0) {
+    // The built-in stock until the film stocks of the card are loaded, developed on the first film shot
+    setFilmStock(getFilmRegistry()->getStock(0));
+}
+
+size_t RawCaptureService::requiredBytes() {
+    return YuvEncoder::requiredBytes(resolution[RAW_FRAME_SIZE].width);
+}
+
+bool RawCaptureService::isAvailable() {
+    return GlobalState::getImageArena()->getCapacity() >= requiredBytes();
+}
+
+void RawCaptureService::setFilmStock(const FilmStock* stock) {
+    this->stock = stock;
+    stockPending = true;
+}
+
+void RawCaptureService::loadFilmStock() {
+    stockPending = false;
+    if (stock == nullptr) {
+        process.setLook(FILM_LOOK_NEUTRAL);
+        process.setColorLut(nullptr);
+        grain.setTile(nullptr);
+        process.setGrain(nullptr);
+        return;
+    }
+    process.setLook(FilmLook{stock->contrast, stock->saturation});
+
+    // The LUTs of the partition and the grain tiles are named after their films
+    size_t lutLength;
+    const uint8_t* luts = mapLutPartition(&lutLength);
+    bool hasLut = luts != nullptr && lut.load(luts, lutLength, stock->name);
+    process.setColorLut(hasLut ? &lut : nullptr);
+    const GrainTile* tile = findGrainTile(stock->name);
+    grain.setTile(tile);
+    process.setGrain(&grain);
+    if (!hasLut || tile == nullptr) {
+        Serial.printf("raw: %s developed%s%s\n", stock->name, hasLut ? "" : " without a LUT",
+                      tile != nullptr ? "" : " without grain");
+    }
+}
+
+int RawCaptureService::captureRaw(JpegWriter writer, void* context) {
+    if (stockPending) {
+        // Off the boot path, the LUT partition is mapped by the first shot that needs it
+        loadFilmStock();
+    }
+
+    // The ring gives the camera back, its JPEG frame buffers make room for the YUV422 one
+    GlobalState::getZslService()->takeFrame(-1);
+    framesize_t jpegFrameSize = cameraConfig.frame_size;
+    camera_fb_t* frameBuffer = nullptr;
+    if (cameraReinitialize(PIXFORMAT_YUV422, RAW_FRAME_SIZE, RAW_FRAME_BUFFERS) == ESP_OK) {
+        for (int i = 0; i < RAW_SETTLE_FRAMES; i++) {
+            cameraReleaseFrameBuffer(cameraCaptureImage());
+        }
+        frameBuffer = cameraCaptureImage();
+    }
+
+    int result = JPEG_ERROR_STATE;
+    uint32_t elapsedMs = 0;
+    if (frameBuffer != nullptr && frameBuffer->format == PIXFORMAT_YUV422) {
+        // The frame is developed within the whole arena, a pending first exposure is lost
+        uint32_t startMs = millis();
+        GlobalState::getDoubleExposureService()->cancel();
+        ImageArena* arena = GlobalState::getImageArena();
+        arena->reset();
+        grain.newFrame(esp_random());
+        YuvEncoder encoder(arena);
+        result = encoder.write(frameBuffer->buf, frameBuffer->width, frameBuffer->height, RAW_JPEG_QUALITY, &process, writer,
+                               context, &runner);
+        elapsedMs = millis() - startMs;
+        if (result == JPEG_OK) {
+            frameCount++;
+            totalEncodeMs += elapsedMs;
+            totalPixels += (uint32_t) (frameBuffer->width * frameBuffer->height / 1000);
+            Serial.printf("raw: %ux%u developed in %lu ms, %lu KB\n", (unsigned) frameBuffer->width, (unsigned) frameBuffer->height,
+                          (unsigned long) elapsedMs, (unsigned long) (encoder.getBytesWritten() / 1024));
+        }
+    }
+    cameraReleaseFrameBuffer(frameBuffer);
+
+    // Back to the JPEG frames of the ring
+    if (cameraReinitialize(PIXFORMAT_JPEG, jpegFrameSize, CAMERA_FRAME_BUFFERS) != ESP_OK) {
+        Serial.printf("raw: could not switch the camera back to JPEG\n");
+    }
+    GlobalState::getZslService()->releaseFrame(nullptr);
+
+    if (result != JPEG_OK) {
+        Serial.printf("raw: failed with error %d\n", result);
+    }
+    return result;
+}
+
+void RawCaptureService::logStats() {
+    if (frameCount == 0 || totalEncodeMs == 0) {
+        return;
+    }
+    Serial.printf("raw: %lu frames, %lu ms and %.1f MP/s per frame, %lu lanes on the other core\n", (unsigned long) frameCount,
+                  (unsigned long) (totalEncodeMs / frameCount), (float) totalPixels / totalEncodeMs,
+                  (unsigned long) runner.getOffloadedCount());
+}
@@ -0,0 +1,108 @@
+#ifndef RETROLENS_RAW_CAPTURE_SERVICE_H
+#define RETROLENS_RAW_CAPTURE_SERVICE_H
+
+#include <Arduino.h>
+#include <esp_camera.h>
+
+#include "CameraUtils.h"
+#include "ColorLut.h"
+#include "FilmGrain.h"
+#include "FilmProcess.h"
+#include "FilmRegistry.h"
+#include "WorkerStripRunner.h"
+#include "YuvEncoder.h"
+
+// YUV422 takes 2 bytes a pixel, SXGA is the largest frame the JPEG frame buffers leave room for
+#define RAW_FRAME_SIZE FRAMESIZE_SXGA
+#define RAW_FRAME_BUFFERS 1
+
+// Frames dropped after switching formats, while the sensor settles its exposure
+#define RAW_SETTLE_FRAMES 3
+
+// IJG quality of the developed frames
+#define RAW_JPEG_QUALITY 90
+
+/**
+ * @class RawCaptureService
+ * @brief Film shots: reads a frame from the sensor as YUV422 and develops it in software through the film look.
+ *
+ * The camera gives up its JPEG frame buffers for one YUV422 frame of RAW_FRAME_SIZE, the
+ * frame is run through the FilmProcess of the film, with the color LUT and the grain tile of
+ * its name when there are ones, the grain at a new place each frame, and encoded by a
+ * YuvEncoder on both cores, strip by strip within the image arena of GlobalState, and the
+ * result is streamed to the writer. The camera then goes back to JPEG.
+ *
+ * Example usage:
+ * @code
+ * // With the camera and the SD card held
+ * if (rawCaptureService.isAvailable()) {
+ *     rawCaptureService.captureRaw(writeToFile, &file);
+ * }
+ * @endcode
+ */
+class RawCaptureService {
+public:
+    /**
+     * @brief Constructor for RawCaptureService.
+     */
+    RawCaptureService();
+
+    /**
+     * @brief Get the memory a developed frame needs.
+     *
+     * @return size_t Bytes of image arena.
+     */
+    static size_t requiredBytes();
+
+    /**
+     * @brief Check if the image arena is large enough to develop a frame.
+     *
+     * @return true if captureRaw() can run.
+     */
+    bool isAvailable();
+
+    /**
+     * @brief Set the film stock the next frames are developed as.
+     *
+     * The look comes from the stock, the color LUT and the grain tile are looked up by its name. A
+     * film without a LUT in the partition or without a grain file is developed without them. The
+     * stock is only kept here, it is loaded by the next captureRaw().
+     *
+     * @param stock Film stock, kept by the caller, nullptr for none.
+     */
+    void setFilmStock(const FilmStock* stock);
+
+    /**
+     * @brief Capture a YUV422 frame and write it developed as JPEG.
+     *
+     * The camera must not be used by anyone else meanwhile, the zero-shutter-lag ring is emptied.
+     *
+     * @param writer Output sink.
+     * @param context Context of the writer.
+     * @return int JPEG_OK or a JPEG_ERROR_* code, JPEG_ERROR_STATE if the camera could not switch formats.
+     */
+    int captureRaw(JpegWriter writer, void* context);
+
+    /**
+     * @brief Print the development statistics.
+     */
+    void logStats();
+
+private:
+    /**
+     * @brief Set the look, the color LUT and the grain of the film stock, mapping the LUT partition.
+     */
+    void loadFilmStock();
+
+    WorkerStripRunner runner;      ///< Runs the strip lanes on both cores.
+    const FilmStock* stock;        ///< Film stock of the next frames.
+    bool stockPending;             ///< True until the film stock is loaded by a captureRaw().
+    FilmProcess process;           ///< Film look of the developed frames.
+    ColorLut lut;                  ///< Color LUT of the film, read from the mapped LUT partition.
+    FilmGrain grain;               ///< Grain of the film.
+    uint32_t frameCount;           ///< Frames developed.
+    uint32_t totalEncodeMs;        ///< Time spent developing, capture excluded.
+    uint32_t totalPixels;          ///< Pixels developed, in thousands.
+};
+
+#endif // RETROLENS_RAW_CAPTURE_SERVICE_H
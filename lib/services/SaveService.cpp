@@ -1,17 +1,28 @@
 #include <SD_MMC.h>
 #include <string>
+#include <time.h>
 
+#include "BorderTiles.h"
 #include "GlobalState.h"
 #include "SaveService.h"
 #include "Films.h"
 
+// Tiles generated from resources/images/borders at build time
+static const BorderArt FILM_BORDER_ART = {&REBATE_BORDER_TILE, &SPROCKET_BORDER_TILE, &FONT_BORDER_TILE, FONT_BORDER_CHARACTERS};
+
+// Film stocks of the card, parsed or loaded here before they replace the registry
+static FilmRegistry cardFilmStocks;
+
 
 SaveService::SaveService() 
-    : sdInitialized(false), saveImageResultQueue(nullptr), 
-    saveImageTaskHandle(nullptr), saveImageInProgress(false) {
-    saveImageSemaphore = xSemaphoreCreateMutex();
+    : sdInitialized(false), saveImageInProgress(false), pendingSdOperations(0), sdWindowPriority(JOB_PRIORITY_COUNT),
+      savedLength(0), filmStocksLoaded(false), rollIndex(0), shotPressTimeUs(-1), shotFlash(false),
+      shotMode(SHOT_MODE_SINGLE), dateStampOn(false), filmBorderOn(false), frameNumber(0), frameRotation(JPEG_ROTATE_0),
+      frameCrop(JPEG_CROP_FULL) {
+    saveImageSemaphore = xSemaphoreCreateMutexStatic(&saveImageSemaphoreBuffer);
 }
 
+
 SaveServiceErrorMessage SaveService::initSdCard(const char* mountPath, long timeout) {
 
     // Safely take the SD card resource
@@ -25,6 +36,7 @@ SaveServiceErrorMessage SaveService::initSdCard(const char* mountPath, long time
     }
 
     if (!isSdCardAvailable()) {
+        SD_MMC.end();
         GlobalState::safelyFreeSdCard();
         return SaveServiceErrorMessage{SD_MOUNT_ERROR, "No SD Card attached"};
     }
@@ -56,9 +68,142 @@ SaveServiceErrorMessage SaveService::saveImageToSdCard(camera_fb_t* fb, const St
         return SaveServiceErrorMessage{FILE_OPEN_ERROR, "Failed to open file for writing"};
     }
 
-    file.write(fb->buf, fb->len);
+    frameNumber++;
+    char dateText[DATE_STAMP_MAX_CHARS];
+    bool stamped = dateStampOn && formatDateStamp(dateText);
+    if (dateStampOn && !stamped) {
+        Serial.println("date: the clock was never set, frame saved without the stamp");
+    }
+    bool developed = stamped || filmBorderOn || frameRotation != JPEG_ROTATE_0 || frameCrop != JPEG_CROP_FULL;
+    bool written = developed && writeDevelopedFrame(fb, file, stamped ? dateText : nullptr);
+    if (developed && !written) {
+        // Part of the developed frame may be written, start the file again
+        file.close();
+        file = SD_MMC.open(path.c_str(), FILE_WRITE);
+        if (!file) {
+            return SaveServiceErrorMessage{FILE_OPEN_ERROR, "Failed to open file for writing"};
+        }
+    }
+    if (!written) {
+        file.write(fb->buf, fb->len);
+    }
+    savedLength = (uint32_t) file.position();
+    file.close();
+
+    return {0, ""};
+}
+
+bool SaveService::writeDevelopedFrame(camera_fb_t* fb, File& file, const char* dateText) {
+    // No film is picked yet, the first stock goes on the rebate
+    DevelopSettings settings;
+    char label[FILM_BORDER_MAX_CHARS];
+    FrameDeveloper::setCameraStages(&settings, frameRotation, frameCrop, dateText,
+                                    filmBorderOn ? getFilmName(0) : nullptr, frameNumber, label);
+
+    uint32_t startMs = millis();
+    FrameDeveloper developer(GlobalState::getImageArena(), FILM_BORDER_ART);
+    int result = developer.write(fb->buf, fb->len, settings, writeToFile, &file);
+    for (int stage = 0; stage < DEVELOP_STAGE_COUNT; stage++) {
+        int stageResult = developer.getStageResult(stage);
+        if (stageResult != JPEG_OK && stageResult != DEVELOP_STAGE_SKIPPED) {
+            // Quarter turns give 4:4:0 frames, the border tiles are 4:2:2
+            Serial.printf("%s: failed with error %d, frame saved without it\n", FrameDeveloper::getStageName(stage), stageResult);
+        }
+    }
+    if (result != JPEG_OK) {
+        Serial.printf("develop: failed with error %d, frame saved as shot\n", result);
+        return false;
+    }
+    Serial.printf("develop: %u of %u KB, %d MCUs coded again in %lu ms\n", (unsigned) (developer.getBytesWritten() / 1024),
+                  (unsigned) (fb->len / 1024), developer.getRecodedMcus(), (unsigned long) (millis() - startMs));
+    return true;
+}
+
+bool SaveService::formatDateStamp(char* text) {
+    time_t now = time(nullptr);
+    struct tm date;
+    localtime_r(&now, &date);
+    if (date.tm_year + 1900 < DATE_STAMP_MIN_YEAR) {
+        // No real-time clock and nothing set the time, a made up date is worse than none
+        return false;
+    }
+    snprintf(text, DATE_STAMP_MAX_CHARS, "'%02d %2d %2d", date.tm_year % 100, date.tm_mon + 1, date.tm_mday);
+    return true;
+}
+
+bool SaveService::writeToFile(void* context, const uint8_t* data, size_t length) {
+    return static_cast<File*>(context)->write(data, length) == length;
+}
+
+SaveServiceErrorMessage SaveService::saveStackToSdCard(const String& path) {
+    if (!sdInitialized) {
+        return SaveServiceErrorMessage{SD_INIT_ERROR, "SD card is not initialized"};
+    }
+
+    File file = SD_MMC.open(path.c_str(), FILE_WRITE);
+    if (!file) {
+        return SaveServiceErrorMessage{FILE_OPEN_ERROR, "Failed to open file for writing"};
+    }
+
+    // The stack is encoded strip by strip straight into the file, the write is not timed as it waits for the encoder
+    int result = GlobalState::getStackService()->captureStack(shotPressTimeUs, writeToFile, &file);
+    savedLength = (uint32_t) file.position();
+    file.close();
+    if (result != JPEG_OK) {
+        SD_MMC.remove(path.c_str());
+        return SaveServiceErrorMessage{CAPTURE_ERROR, "Failed to stack frames"};
+    }
+    return {0, ""};
+}
+
+SaveServiceErrorMessage SaveService::saveRawToSdCard(const String& path) {
+    if (!sdInitialized) {
+        return SaveServiceErrorMessage{SD_INIT_ERROR, "SD card is not initialized"};
+    }
+
+    File file = SD_MMC.open(path.c_str(), FILE_WRITE);
+    if (!file) {
+        return SaveServiceErrorMessage{FILE_OPEN_ERROR, "Failed to open file for writing"};
+    }
+
+    // The frame is encoded strip by strip straight into the file, like a stack
+    int result = GlobalState::getRawCaptureService()->captureRaw(writeToFile, &file);
+    savedLength = (uint32_t) file.position();
     file.close();
+    if (result != JPEG_OK) {
+        SD_MMC.remove(path.c_str());
+        return SaveServiceErrorMessage{CAPTURE_ERROR, "Failed to develop raw frame"};
+    }
+    return {0, ""};
+}
+
+SaveServiceErrorMessage SaveService::saveDoubleExposureToSdCard(camera_fb_t* fb, const String& path) {
+    DoubleExposureService* doubleExposure = GlobalState::getDoubleExposureService();
+    if (!doubleExposure->hasFirstExposure()) {
+        // Nothing is written until the second exposure
+        if (!doubleExposure->keepFirstExposure(fb)) {
+            return SaveServiceErrorMessage{CAPTURE_ERROR, "First exposure too large"};
+        }
+        return {0, ""};
+    }
 
+    if (!sdInitialized) {
+        return SaveServiceErrorMessage{SD_INIT_ERROR, "SD card is not initialized"};
+    }
+
+    File file = SD_MMC.open(path.c_str(), FILE_WRITE);
+    if (!file) {
+        return SaveServiceErrorMessage{FILE_OPEN_ERROR, "Failed to open file for writing"};
+    }
+
+    // Both exposures are decoded strip by strip and the blend is encoded straight into the file
+    int result = doubleExposure->writeSecondExposure(fb, writeToFile, &file);
+    savedLength = (uint32_t) file.position();
+    file.close();
+    if (result != JPEG_OK) {
+        SD_MMC.remove(path.c_str());
+        return SaveServiceErrorMessage{CAPTURE_ERROR, "Failed to blend exposures"};
+    }
     return {0, ""};
 }
 
@@ -79,7 +224,7 @@ void SaveService::setSaveImageInProgress(bool value) {
     }
 }
 
-bool SaveService::startImageSaveTask(QueueHandle_t resultQueue) {
+bool SaveService::requestImageSave(int64_t pressTimeUs, bool flash, int shotMode) {
     // Check if an image save is already in progress
     if (xSemaphoreTake(saveImageSemaphore, portMAX_DELAY) == pdTRUE) {
         if (saveImageInProgress) {
@@ -87,18 +232,105 @@ bool SaveService::startImageSaveTask(QueueHandle_t resultQueue) {
             return false;
         }
         saveImageInProgress = true;
+        shotPressTimeUs = pressTimeUs;
+        shotFlash = flash;
+        this->shotMode = shotMode;
         xSemaphoreGive(saveImageSemaphore); // Release the semaphore
     }
-    saveImageResultQueue = resultQueue;
 
-    // Create the imageSaveTask
-    if (xTaskCreate(imageSaveTask, "ImageSaveTask", 4096, this, 1, &saveImageTaskHandle) != pdPASS) {
+    // Run the save on the shutter path of the worker pool
+    if (!scheduleSdOperation(SD_OPERATION_SAVE_IMAGE, JOB_PRIORITY_SHUTTER)) {
+        setSaveImageInProgress(false);
         return false;
     }
-
     return true;
 }
 
+void SaveService::useFilmStocks() {
+    *getFilmRegistry() = cardFilmStocks;
+    // No film is picked yet, shots are taken and film shots developed as the first stock
+    const FilmStock* stock = getFilmRegistry()->getStock(0);
+    GlobalState::getRawCaptureService()->setFilmStock(stock);
+    if (stock != nullptr) {
+        useSensorProfile(stock->sensor);
+    }
+}
+
+void SaveService::useSensorProfile(const SensorProfile& sensor) {
+    // The finest quality of the film bounds the rate control, which sets the quality of each frame
+    GlobalState::getRateService()->setFinestQuality(sensor.jpegQuality != FILM_STOCK_SENSOR_UNSET ? sensor.jpegQuality : 0);
+
+    // Settings the film leaves out are the camera's defaults
+    SensorProfile current = getSensorProfile();
+    SensorProfile profile = current;
+    profile.frameSize = sensor.frameSize < FRAMESIZE_INVALID ? sensor.frameSize : CAMERA_DEFAULT_FRAME_SIZE;
+    profile.xclkMhz = sensor.xclkMhz != FILM_STOCK_SENSOR_UNSET ? sensor.xclkMhz : CAMERA_DEFAULT_XCLK_MHZ;
+    if (profile.frameSize == current.frameSize && profile.xclkMhz == current.xclkMhz) {
+        return;
+    }
+
+    // The ring gives the camera back while it starts again, as for a film shot
+    GlobalState::getZslService()->takeFrame(-1);
+    esp_err_t error = cameraApplyProfile(profile);
+    GlobalState::getZslService()->releaseFrame(nullptr);
+    Serial.printf("films: sensor frame size %u, %u MHz%s\n", (unsigned) profile.frameSize, (unsigned) profile.xclkMhz,
+                  error == ESP_OK ? "" : ", failed");
+}
+
+int SaveService::loadFilmStocks() {
+    filmStocksLoaded = true;
+    File source = SD_MMC.open(SD_FILM_STOCKS_PATH);
+    if (!source || source.isDirectory()) {
+        Serial.printf("films: no %s, %d built-in stocks\n", SD_FILM_STOCKS_PATH, getFilmRegistry()->getCount());
+        return getFilmRegistry()->getCount();
+    }
+    uint32_t sourceLength = (uint32_t) source.size();
+    uint32_t sourceStamp = (uint32_t) source.getLastWrite();
+    uint32_t startMs = millis();
+
+    // The registry of the last parse, in one read, while the file is unchanged
+    uint8_t blob[FILM_REGISTRY_MAX_BLOB_BYTES];
+    File cache = SD_MMC.open(SD_FILM_STOCKS_CACHE_PATH);
+    if (cache) {
+        size_t length = cache.read(blob, sizeof(blob));
+        cache.close();
+        if (cardFilmStocks.deserialize(blob, length, sourceLength, sourceStamp)) {
+            source.close();
+            useFilmStocks();
+            Serial.printf("films: %d stocks from the cache in %lu ms\n", cardFilmStocks.getCount(),
+                          (unsigned long) (millis() - startMs));
+            return cardFilmStocks.getCount();
+        }
+    }
+
+    // Parsed line by line, a line too long for the buffer fails as one
+    char line[FILM_REGISTRY_MAX_LINE + 2];
+    int result = FILM_REGISTRY_OK;
+    cardFilmStocks.beginParse();
+    while (result == FILM_REGISTRY_OK && source.available()) {
+        size_t length = source.readBytesUntil('\n', line, sizeof(line));
+        result = cardFilmStocks.parseLine(line, length);
+    }
+    source.close();
+    if (result == FILM_REGISTRY_OK) {
+        result = cardFilmStocks.endParse();
+    }
+    if (result < 0) {
+        Serial.printf("films: %s line %d, error %d, %d built-in stocks kept\n", SD_FILM_STOCKS_PATH,
+                      cardFilmStocks.getErrorLine(), result, getFilmRegistry()->getCount());
+        return result;
+    }
+    useFilmStocks();
+
+    size_t length = cardFilmStocks.serialize(blob, sizeof(blob), sourceLength, sourceStamp);
+    cache = SD_MMC.open(SD_FILM_STOCKS_CACHE_PATH, FILE_WRITE);
+    bool cached = cache && cache.write(blob, length) == length;
+    cache.close();
+    Serial.printf("films: %d stocks parsed in %lu ms, hash seed %lu, %s\n", result, (unsigned long) (millis() - startMs),
+                  (unsigned long) cardFilmStocks.getSeed(), cached ? "cached" : "not cached");
+    return result;
+}
+
 FilmsStatus SaveService::readFilmStatus() {
     SaveServiceErrorMessage saveImageErr = {0, ""};
 
@@ -124,7 +356,8 @@ FilmsStatus SaveService::readFilmStatus() {
             }
 
             // Check if filmType is valid
-            if (!isValidFilmType(filmType.c_str())) {
+            int filmIndex = getFilmIndex(filmType.c_str());
+            if (filmIndex < 0) {
                 continue;
             }
 
@@ -136,7 +369,7 @@ FilmsStatus SaveService::readFilmStatus() {
             }
 
             // Add the film to the films array
-            filmsStatus.films[i].framesRemaining = getFilmCapacity(filmType.c_str()) - numFiles;
+            filmsStatus.films[i].framesRemaining = getFilmCapacity(filmIndex) - numFiles;
             filmsStatus.films[i].filmType = filmType;
             filmsStatus.films[i].filmPath = folderName;
             i = (i + 1) % MAX_FILMS;
@@ -147,74 +380,235 @@ FilmsStatus SaveService::readFilmStatus() {
     
 }
 
-void SaveService::imageSaveTask(void* p) {
-    SaveService* service = static_cast<SaveService*>(p);
+bool SaveService::scheduleSdOperation(uint32_t operation, uint8_t priority) {
+    if (xSemaphoreTake(saveImageSemaphore, portMAX_DELAY) != pdTRUE) {
+        return false;
+    }
+    pendingSdOperations |= operation;
 
-    // Initialize the SD card
-    service->saveImageErr = service->initSdCard(SD_PATH);
-    if (service->saveImageErr.code != 0) {
-        service->closeSdCard();
-        service->setSaveImageInProgress(false);
-        if (service->saveImageResultQueue != nullptr)
-            xQueueSend(service->saveImageResultQueue, &(service->saveImageErr), 0);
-        vTaskDelete(nullptr);
+    // A window job that runs at least as urgently will pick the operation up
+    if (sdWindowPriority <= priority) {
+        xSemaphoreGive(saveImageSemaphore);
+        return true;
     }
+    if (!GlobalState::getWorkerPool()->submit(priority, sdWindowJob, this)) {
+        pendingSdOperations &= ~operation;
+        xSemaphoreGive(saveImageSemaphore);
+        return false;
+    }
+    sdWindowPriority = priority;
+    xSemaphoreGive(saveImageSemaphore);
+    return true;
+}
 
-    // Capture the image
-    camera_fb_t* fb = cameraCaptureImage();
+uint32_t SaveService::takeSdOperations() {
+    uint32_t operations = 0;
+    if (xSemaphoreTake(saveImageSemaphore, portMAX_DELAY) == pdTRUE) {
+        operations = pendingSdOperations;
+        pendingSdOperations = 0;
+        if (operations == 0) {
+            // The window closes, later requests need a new job
+            sdWindowPriority = JOB_PRIORITY_COUNT;
+        }
+        xSemaphoreGive(saveImageSemaphore);
+    }
+    return operations;
+}
 
-    // Save the image to the SD card
-    service->saveImageErr = service->saveImageToSdCard(fb);
+int SaveService::sdWindowJob(void* p) {
+    return static_cast<SaveService*>(p)->runSdWindow();
+}
 
-    // Release the frame buffer
-    cameraReleaseFrameBuffer(fb);
+int SaveService::runSdWindow() {
+    // A more urgent window may already have run everything
+    uint32_t operations = takeSdOperations();
+    if (operations == 0) {
+        return 0;
+    }
+
+    // Initialize the SD card
+    bool developed = false;
+    SaveServiceErrorMessage mountErr = initSdCard(SD_PATH);
+    if (mountErr.code != 0) {
+        closeSdCard();
+        // Fail every queued operation, and those queued meanwhile
+        do {
+            if (operations & SD_OPERATION_SAVE_IMAGE) {
+                setSaveImageInProgress(false);
+                publishResult(EVENT_SAVE_RESULT, mountErr);
+            }
+            if (operations & SD_OPERATION_FILM_STATUS) {
+                publishResult(EVENT_FILM_STATUS, mountErr);
+            }
+            developed |= (operations & SD_OPERATION_DEVELOP) != 0;
+        } while ((operations = takeSdOperations()) != 0);
+        if (developed) {
+            GlobalState::getDevelopService()->endWindow(false);
+        }
+        return mountErr.code;
+    }
+
+    // Keep the card mounted while operations keep coming, the save first and the deferred work last
+    do {
+        if (operations & SD_OPERATION_SAVE_IMAGE) {
+            if (saveImage() == 0 && savedLength > 0) {
+                // Checksummed later, when the camera idles, if the file still holds the frame by then
+                GlobalState::getDevelopService()->queueChecksum(SD_PICTURE_PATH, savedLength);
+            }
+        }
+        if (operations & SD_OPERATION_FILM_STATUS) {
+            if (!filmStocksLoaded) {
+                loadFilmStocks();
+            }
+            publishFilmStatus();
+        }
+        if (operations & SD_OPERATION_DEVELOP) {
+            GlobalState::getDevelopService()->runSlice();
+            developed = true;
+        }
+    } while ((operations = takeSdOperations()) != 0);
+
+    // A boot that starts with a shot loads the film stocks after it
+    if (!filmStocksLoaded) {
+        loadFilmStocks();
+    }
 
     // Close the SD card
-    service->closeSdCard();
-    service->setSaveImageInProgress(false);
+    closeSdCard();
 
-    // Send the result to the result queue
-    if (service->saveImageResultQueue != nullptr)
-        xQueueSend(service->saveImageResultQueue, &(service->saveImageErr), 0);
+    // The next slice gets a window of its own, so the screen and the battery get their pins between slices
+    if (developed) {
+        GlobalState::getDevelopService()->endWindow(true);
+    }
+    return 0;
+}
 
-    // Delete the task
-    vTaskDelete(nullptr);
+void SaveService::setRollIndex(uint16_t rollIndex) {
+    this->rollIndex = rollIndex;
 }
 
-bool SaveService::startReadFilmStatusTask(QueueHandle_t resultQueue) {
-    // Create the readFilmStatusTask
-    if (xTaskCreate(readFilmStatusTask, "ReadFilmStatusTask", 4096, this, 1, &saveImageTaskHandle) != pdPASS) {
-        return false;
-    }
+uint16_t SaveService::getRollIndex() {
+    return rollIndex;
+}
 
-    return true;
+void SaveService::setDateStampOn(bool on) {
+    dateStampOn = on;
 }
 
-void SaveService::readFilmStatusTask(void* p) {
-    SaveService* service = static_cast<SaveService*>(p);
+bool SaveService::isDateStampOn() {
+    return dateStampOn;
+}
 
-    // Initialize the SD card
-    service->saveImageErr = service->initSdCard(SD_PATH);
-    if (service->saveImageErr.code != 0) {
-        service->closeSdCard();
-        service->setSaveImageInProgress(false);
-        if (service->saveImageResultQueue != nullptr)
-            xQueueSend(service->saveImageResultQueue, &(service->saveImageErr), 0);
-        vTaskDelete(nullptr);
+void SaveService::setFilmBorderOn(bool on) {
+    filmBorderOn = on;
+}
+
+bool SaveService::isFilmBorderOn() {
+    return filmBorderOn;
+}
+
+void SaveService::setFrameTransform(int rotation, int crop) {
+    frameRotation = rotation;
+    frameCrop = crop;
+}
+
+int SaveService::getFrameRotation() {
+    return frameRotation;
+}
+
+int SaveService::getFrameCrop() {
+    return frameCrop;
+}
+
+int SaveService::saveImage() {
+    savedLength = 0;
+
+    // Full clock for the shot, with the sensor powered
+    GlobalState::getPowerService()->setActive(true);
+    GlobalState::getPowerService()->acquireSensor();
+
+    bool stack = shotMode == SHOT_MODE_STACK && GlobalState::getStackService()->isAvailable();
+    bool raw = shotMode == SHOT_MODE_FILM && GlobalState::getRawCaptureService()->isAvailable();
+    if ((stack || raw) && !shotFlash) {
+        // The stack and the raw capture hold the camera for their frames
+        saveImageErr = stack ? saveStackToSdCard() : saveRawToSdCard();
+        if (saveImageErr.code == 0) {
+            GlobalState::getStandbyService()->noteCapture();
+        }
+        setSaveImageInProgress(false);
+        GlobalState::getPowerService()->setActive(false);
+        publishResult(EVENT_SAVE_RESULT, saveImageErr);
+        return saveImageErr.code;
+    }
+
+    camera_fb_t* fb;
+    if (shotFlash) {
+        // The frames around the press are unlit, only take the camera back from the ring
+        GlobalState::getZslService()->takeFrame(-1);
+        fb = GlobalState::getFlashService()->captureLit();
+        GlobalState::getRateService()->onFrame(fb);
+    } else {
+        // Take the frame of the press, or capture one if the ring has none
+        fb = GlobalState::getZslService()->takeFrame(shotPressTimeUs);
+        if (fb == nullptr) {
+            fb = cameraCaptureImage();
+            if (fb != nullptr && MeteringService::isMeteringFrame(fb)) {
+                // The metering just ended, the sensor was not back at the full frame yet
+                cameraReleaseFrameBuffer(fb);
+                fb = cameraCaptureImage();
+            }
+            GlobalState::getRateService()->onFrame(fb);
+        }
+    }
+
+    if (fb != nullptr && shotMode == SHOT_MODE_DOUBLE && GlobalState::getDoubleExposureService()->isAvailable()) {
+        GlobalState::getStandbyService()->noteCapture();
+        saveImageErr = saveDoubleExposureToSdCard(fb);
+    } else if (fb != nullptr) {
+        GlobalState::getStandbyService()->noteCapture();
+        // Save the image to the SD card, timing the write for the rate control
+        uint32_t writeStartMs = millis();
+        saveImageErr = saveImageToSdCard(fb);
+        if (saveImageErr.code == 0) {
+            GlobalState::getRateService()->noteWrite(fb->len, millis() - writeStartMs);
+        }
+        GlobalState::getRateService()->reportShot(fb);
+    } else {
+        saveImageErr = {CAPTURE_ERROR, "Failed to capture image"};
     }
 
+    // Release the frame buffer
+    GlobalState::getZslService()->releaseFrame(fb);
+    setSaveImageInProgress(false);
+    GlobalState::getPowerService()->setActive(false);
+
+    // Publish the result
+    publishResult(EVENT_SAVE_RESULT, saveImageErr);
+    return saveImageErr.code;
+}
+
+void SaveService::publishResult(uint16_t type, const SaveServiceErrorMessage& result) {
+    EventPayload payload;
+    payload.saveResult = {result.code, result.message};
+    GlobalState::getEventBus()->publish(type, payload);
+}
+
+bool SaveService::requestFilmStatus() {
+    return scheduleSdOperation(SD_OPERATION_FILM_STATUS, JOB_PRIORITY_BACKGROUND);
+}
+
+bool SaveService::requestDevelop() {
+    return scheduleSdOperation(SD_OPERATION_DEVELOP, JOB_PRIORITY_BACKGROUND);
+}
+
+int SaveService::publishFilmStatus() {
+    SaveServiceErrorMessage filmStatusErr = {0, ""};
+
     // Read the film status
     // Assuming readFilmStatus() is a function that reads the film status and returns a string
     String filmStatus = "Hello"; //readFilmStatus();
 
-    // Send the film status to the result queue
-    if (service->saveImageResultQueue != nullptr)
-        xQueueSend(service->saveImageResultQueue, &filmStatus, 0);
-
-    // Close the SD card
-    service->closeSdCard();
-    service->setSaveImageInProgress(false);
-
-    // Delete the task
-    vTaskDelete(nullptr);
+    // Publish the film status result
+    publishResult(EVENT_FILM_STATUS, filmStatusErr);
+    return 0;
 }
@@ -2,6 +2,7 @@
 #define RETROLENS_SAVE_SERVICE_H
 
 #include <Arduino.h>
+#include <FS.h>
 #include <esp_camera.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
@@ -9,17 +10,41 @@
 
 #include "CameraUtils.h"
 #include "Films.h"
+#include "FrameDeveloper.h"
+#include "JpegTransform.h"
 
 #define TIMEOUT_MS 100
 #define SD_PATH "/sdcard"
 #define SD_FILMS_PATH "/films"
 
+// File the frames are saved to
+#define SD_PICTURE_PATH "/picture.jpg"
+
+// Film stock definitions on the card, and the registry parsed from them
+#define SD_FILM_STOCKS_PATH "/filmstocks.txt"
+#define SD_FILM_STOCKS_CACHE_PATH "/filmstocks.bin"
+
 #define SD_TIMEOUT 1
 #define SD_INIT_ERROR 2
 #define SD_MOUNT_ERROR 3
 #define CAPTURE_ERROR 4
 #define FILE_OPEN_ERROR 5
 
+// Operations that need the SD card, batched into one mount window
+#define SD_OPERATION_SAVE_IMAGE (1u << 0)
+#define SD_OPERATION_FILM_STATUS (1u << 1)
+#define SD_OPERATION_DEVELOP (1u << 2)
+
+// Shot modes
+#define SHOT_MODE_SINGLE 0 // One frame, from the zero-shutter-lag ring or the flash
+#define SHOT_MODE_STACK 1  // A burst averaged into one frame, less noise in low light
+#define SHOT_MODE_DOUBLE 2 // Two shots blended into one frame, the first is kept until the second
+#define SHOT_MODE_FILM 3   // One frame read raw from the sensor and developed in software with the film look
+#define SHOT_MODE_COUNT 4
+
+// Below this year the clock was never set, the board has no real-time clock
+#define DATE_STAMP_MIN_YEAR 2020
+
 /**
  * @struct SaveServiceErrorMessage
  * @brief Error messages for SaveService.
@@ -47,20 +72,24 @@ struct FilmsStatus {
  * @class SaveService
  * @brief Service to handle capturing and saving images to the SD card using a task.
  * 
+ * Image saves run as shutter jobs, and film status reads and slices of deferred work as background
+ * jobs on the shared worker pool. Requests queued while the SD card is mounted run in the same mount
+ * window, so the screen only gets its pins back once every pending SD operation is done.
+ * 
  * Example usage:
  * @code
  * SaveService saveService;
- * QueueHandle_t resultQueue;
+ * int subscriberId;
  * 
  * void setup() {
- *    resultQueue = xQueueCreate(1, sizeof(int));
- *    saveService.startImageSaveTask(resultQueue);
+ *    subscriberId = GlobalState::getEventBus()->subscribe(EVENT_MASK(EVENT_SAVE_RESULT));
+ *    saveService.requestImageSave();
  * }
  * 
  * void loop() {
- *    int result;
- *    if (xQueueReceive(resultQueue, &result, portMAX_DELAY)) {
- *        if (result == 0) {
+ *    Event event;
+ *    if (GlobalState::getEventBus()->receive(subscriberId, &event, portMAX_DELAY)) {
+ *        if (event.payload.saveResult.code == 0) {
  *            Serial.println("Image saved successfully");
  *        } else {
  *           Serial.println("Failed to save image");
@@ -96,16 +125,25 @@ public:
      * @param path The file path to save the image (default: "/picture.jpg").
      * @return SaveServiceErrorMessage containing error code and message.
      */
-    SaveServiceErrorMessage saveImageToSdCard(camera_fb_t* fb, const String& path = "/picture.jpg");
+    SaveServiceErrorMessage saveImageToSdCard(camera_fb_t* fb, const String& path = SD_PICTURE_PATH);
 
 
     /**
-     * @brief Creates a task that captures an image and saves it to the SD card.
+     * @brief Submits a shutter job that captures an image and saves it to the SD card.
+     * 
+     * The result is published as an EVENT_SAVE_RESULT event. With the press time, the frame
+     * closest to the press is taken from the zero-shutter-lag ring. With the flash, a new frame
+     * is captured under the lamp instead. A stack starts from the frame of the press and falls
+     * back to a single frame with the flash or without the stack budget. In double exposure,
+     * the first shot is kept in memory and the second is saved blended with it. A film shot
+     * reads a new raw frame and develops it, with the same fallbacks as a stack.
      * 
-     * @param resultQueue The queue to send the result of the task. If nullptr, no result is sent.
-     * @return true if the task was successfully created, false otherwise.
+     * @param pressTimeUs Interrupt time of the shutter press, negative to capture a new frame.
+     * @param flash True to light the frame with the flash.
+     * @param shotMode One of the SHOT_MODE_* values.
+     * @return true if the job was queued, false if a save is in progress or the job could not be queued.
      */
-    bool startImageSaveTask(QueueHandle_t resultQueue);
+    bool requestImageSave(int64_t pressTimeUs = -1, bool flash = false, int shotMode = SHOT_MODE_SINGLE);
 
     /**
      * @brief Checks if an image save is in progress.
@@ -115,21 +153,208 @@ public:
     bool isImageSaveInProgress();
 
     /**
-     * @brief Starts a task that reads the film status and sends the result to a queue.
+     * @brief Submits a background job that reads the film status and publishes the result as an EVENT_FILM_STATUS event.
+     * 
+     * @return True if the job was queued, false otherwise.
+     */
+    bool requestFilmStatus();
+
+    /**
+     * @brief Submits a background job that runs a slice of the deferred work of the DevelopService.
+     * 
+     * The slice shares the mount window of the other SD operations, a save queued meanwhile runs
+     * once the slice is preempted.
+     * 
+     * @return True if the job was queued, false otherwise.
+     */
+    bool requestDevelop();
+
+    /**
+     * @brief Selects the film roll the frames are saved to.
+     * 
+     * @param rollIndex Index of the roll.
+     */
+    void setRollIndex(uint16_t rollIndex);
+
+    /**
+     * @brief Gets the film roll the frames are saved to.
+     * 
+     * @return uint16_t Index of the roll.
+     */
+    uint16_t getRollIndex();
+
+    /**
+     * @brief Turns the date stamp of single frames on or off, it is off at power on.
+     * 
+     * Frames are only stamped once the clock was set, the board has no real-time clock.
      * 
-     * @param resultQueue The FreeRTOS queue to send the result to.
-     * @return True if the task was created successfully, false otherwise.
+     * @param on True to burn the date into the bottom-right corner of the frame.
      */
-    bool startReadFilmStatusTask(QueueHandle_t resultQueue);
+    void setDateStampOn(bool on);
 
+    /**
+     * @brief Checks if single frames get the date stamp.
+     * 
+     * @return true if the date stamp is on.
+     */
+    bool isDateStampOn();
+
+    /**
+     * @brief Turns the film border of single frames on or off.
+     * 
+     * @param on True to add a film rebate above and below the frame, with sprocket holes and edge print.
+     */
+    void setFilmBorderOn(bool on);
+
+    /**
+     * @brief Checks if single frames get the film border.
+     * 
+     * @return true if the film border is on.
+     */
+    bool isFilmBorderOn();
+
+    /**
+     * @brief Sets the lossless turn and crop of single frames.
+     * 
+     * @param rotation One of the JPEG_ROTATE_* values, clockwise.
+     * @param crop One of the JPEG_CROP_* values.
+     */
+    void setFrameTransform(int rotation, int crop);
+
+    /**
+     * @brief Gets the turn of single frames.
+     * 
+     * @return int One of the JPEG_ROTATE_* values.
+     */
+    int getFrameRotation();
+
+    /**
+     * @brief Gets the crop of single frames.
+     * 
+     * @return int One of the JPEG_CROP_* values.
+     */
+    int getFrameCrop();
 
 private:
     /**
-     * @brief The task function that captures and saves an image.
+     * @brief Queue an SD operation and make sure a mount window job runs at least at the given priority.
+     * 
+     * @param operation One of the SD_OPERATION_* values.
+     * @param priority Job priority the operation needs.
+     * @return true if the operation is queued, false if the job could not be submitted.
+     */
+    bool scheduleSdOperation(uint32_t operation, uint8_t priority);
+
+    /**
+     * @brief Take every queued SD operation. Taking none ends the mount window.
+     * 
+     * @return uint32_t Mask of SD_OPERATION_* values.
+     */
+    uint32_t takeSdOperations();
+
+    /**
+     * @brief Job function that mounts the SD card once and runs every queued SD operation.
      * 
      * @param p Pointer to SaveService object.
+     * @return int Error code of the mount, 0 on success.
+     */
+    static int sdWindowJob(void* p);
+
+    /**
+     * @brief Mounts the SD card and runs the queued SD operations until none is left.
+     * 
+     * @return int Error code of the mount, 0 on success.
+     */
+    int runSdWindow();
+
+    /**
+     * @brief Captures an image, saves it on the mounted SD card and publishes the result.
+     * 
+     * @return int Error code of the save, 0 on success.
+     */
+    int saveImage();
+
+    /**
+     * @brief Captures a stack and streams it to a file on the mounted SD card.
+     * 
+     * @param path The file path to save the image.
+     * @return SaveServiceErrorMessage containing error code and message.
+     */
+    SaveServiceErrorMessage saveStackToSdCard(const String& path = SD_PICTURE_PATH);
+
+    /**
+     * @brief Keeps a frame as the first exposure, or streams it blended with the first exposure to a file on the mounted SD card.
+     * 
+     * @param fb Pointer to the camera frame buffer.
+     * @param path The file path to save the image.
+     * @return SaveServiceErrorMessage containing error code and message.
+     */
+    SaveServiceErrorMessage saveDoubleExposureToSdCard(camera_fb_t* fb, const String& path = SD_PICTURE_PATH);
+
+    /**
+     * @brief Captures a raw frame and streams it developed to a file on the mounted SD card.
+     * 
+     * @param path The file path to save the image.
+     * @return SaveServiceErrorMessage containing error code and message.
+     */
+    SaveServiceErrorMessage saveRawToSdCard(const String& path = SD_PICTURE_PATH);
+
+    /**
+     * @brief Writes a frame turned, cropped, stamped and bordered as set to an open file, with a FrameDeveloper.
+     * 
+     * The turn and the crop move DCT blocks, the stamp re-encodes only the blocks under it and
+     * the border adds coded tiles around the frame, nothing else of the frame is quantized again.
+     * 
+     * @param fb Pointer to the camera frame buffer.
+     * @param file Open file, empty.
+     * @param dateText Date stamp text, nullptr for no stamp.
+     * @return true if the frame was written, false if the file must be written again as shot.
+     */
+    bool writeDevelopedFrame(camera_fb_t* fb, File& file, const char* dateText);
+
+    /**
+     * @brief Formats the current date the way a film date back prints it, '24 10 19.
+     * 
+     * @param text Output, DATE_STAMP_MAX_CHARS long.
+     * @return true if the clock was set, false if there is no date to print.
+     */
+    static bool formatDateStamp(char* text);
+
+    /**
+     * @brief JpegWriter that appends to an open file.
+     * 
+     * @param context Pointer to the File.
+     * @param data Bytes to write.
+     * @param length Number of bytes.
+     * @return true if every byte was written.
      */
-    static void imageSaveTask(void* p);
+    static bool writeToFile(void* context, const uint8_t* data, size_t length);
+
+    /**
+     * @brief Loads the film stocks of the mounted SD card into the film registry, once a boot.
+     * 
+     * The registry cached on the card is used while the film stock file keeps its size and
+     * time, otherwise the file is parsed and the cache written again. Without a file, or with
+     * one that does not parse, the built-in stocks stay.
+     * 
+     * @return int Number of films, or a FILM_REGISTRY_ERROR_* code with the built-in stocks kept.
+     */
+    int loadFilmStocks();
+
+    /**
+     * @brief Replaces the film registry with the film stocks of the card, and shoots and develops film shots with them.
+     */
+    void useFilmStocks();
+
+    /**
+     * @brief Switches the sensor to the profile of a film stock.
+     *
+     * The JPEG quality of the film is the finest the rate control picks. A frame size or a clock
+     * other than the camera's starts the camera again, with the zero-shutter-lag ring emptied.
+     *
+     * @param sensor Sensor settings of the stock, FILM_STOCK_SENSOR_UNSET fields take the camera's defaults.
+     */
+    void useSensorProfile(const SensorProfile& sensor);
 
     /**
      * @brief Reads the film status from the SD card.
@@ -139,11 +364,11 @@ private:
     FilmsStatus readFilmStatus();
 
     /**
-     * @brief The task function that reads the film status.
+     * @brief Reads the film status from the mounted SD card and publishes the result.
      * 
-     * @param p Pointer to SaveService object.
+     * @return int Error code of the read, 0 on success.
      */
-    static void readFilmStatusTask(void* p);
+    int publishFilmStatus();
 
     /**
      * @brief Checks if an SD card is present and accessible.
@@ -152,6 +377,14 @@ private:
      */
     bool isSdCardAvailable();
 
+    /**
+     * @brief Publishes the result of an operation on the event bus.
+     * 
+     * @param type Event type, EVENT_SAVE_RESULT or EVENT_FILM_STATUS.
+     * @param result Result of the operation.
+     */
+    static void publishResult(uint16_t type, const SaveServiceErrorMessage& result);
+
     /**
      * @brief Sets the saveImageInProgress flag.
      * 
@@ -163,11 +396,25 @@ private:
     
     // Save image task variables
     volatile bool saveImageInProgress;     ///< Flag to indicate if an image save is in progress.
-    SemaphoreHandle_t saveImageSemaphore;  ///< Semaphore to protect the saveImageInProgress flag.
-    TaskHandle_t saveImageTaskHandle; ///< Handle for the task that saves the image.
-    QueueHandle_t saveImageResultQueue; ///< Queue for sending task result.
+    SemaphoreHandle_t saveImageSemaphore;  ///< Semaphore to protect the flags and the queued SD operations.
+    StaticSemaphore_t saveImageSemaphoreBuffer; ///< Storage of the saveImageInProgress semaphore.
+
+    // SD mount window variables
+    uint32_t pendingSdOperations;  ///< Queued SD_OPERATION_* values.
+    uint8_t sdWindowPriority;      ///< Priority of the most urgent window job submitted, JOB_PRIORITY_COUNT if none.
     SaveServiceErrorMessage saveImageErr; ///< Error message for the task.
+    uint32_t savedLength; ///< Size of the frame the last save wrote, 0 if it wrote none.
     FilmsStatus filmsStatus; ///< The status of the films in the camera.
+    bool filmStocksLoaded; ///< True once the film stocks of the card were loaded.
+    volatile uint16_t rollIndex; ///< Film roll the frames are saved to.
+    int64_t shotPressTimeUs; ///< Press time of the requested save.
+    bool shotFlash; ///< True if the requested save uses the flash.
+    int shotMode; ///< Shot mode of the requested save.
+    volatile bool dateStampOn; ///< True if single frames get the date stamp.
+    volatile bool filmBorderOn; ///< True if single frames get the film border.
+    uint16_t frameNumber; ///< Frames saved since power on, the number on the border.
+    volatile int frameRotation; ///< One of the JPEG_ROTATE_* values, for single frames.
+    volatile int frameCrop; ///< One of the JPEG_CROP_* values, for single frames.
 };
 
 #endif
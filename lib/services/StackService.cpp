@@ -0,0 +1,85 @@
+#include "GlobalState.h"
+#include "StackService.h"
+
+StackService::StackService()
+    : runner(GlobalState::getWorkerPool()), stackCount(0), framesStacked(0), totalStackMs(0) {}
+
+size_t StackService::requiredBytes() {
+    const resolution_info_t& size = resolution[CAMERA_DEFAULT_FRAME_SIZE];
+    return FrameStacker::requiredBytes(size.width, size.height, JPEG_SUBSAMPLING_422, STACK_FRAME_COUNT);
+}
+
+bool StackService::isAvailable() {
+    return GlobalState::getImageArena()->getCapacity() >= requiredBytes();
+}
+
+int StackService::captureStack(int64_t pressTimeUs, JpegWriter writer, void* context) {
+    // The frame of the press first, it is the reference the others are aligned on
+    camera_fb_t* frames[STACK_FRAME_COUNT] = {};
+    int count = 0;
+    frames[0] = GlobalState::getZslService()->takeFrame(pressTimeUs);
+    if (frames[0] != nullptr) {
+        count++;
+    }
+    while (count < STACK_FRAME_COUNT) {
+        camera_fb_t* frameBuffer = cameraCaptureImage();
+        if (frameBuffer == nullptr) {
+            break;
+        }
+        GlobalState::getRateService()->onFrame(frameBuffer);
+        frames[count++] = frameBuffer;
+    }
+
+    // The stack takes the whole arena, a pending first exposure is lost
+    uint32_t startMs = millis();
+    GlobalState::getDoubleExposureService()->cancel();
+    ImageArena* arena = GlobalState::getImageArena();
+    arena->reset();
+    arena->resetHighWater();
+    FrameStacker stacker(arena);
+    int result = count > 0 ? JPEG_OK : JPEG_ERROR_STATE;
+    for (int i = 0; i < count && result == JPEG_OK; i++) {
+        result = stacker.addFrame(frames[i]->buf, frames[i]->len);
+        if (result != JPEG_OK && i > 0) {
+            // A frame that does not decode is left out, unless it is the reference
+            Serial.printf("stack: frame %d skipped, error %d\n", i, result);
+            result = JPEG_OK;
+        }
+    }
+    if (result == JPEG_OK) {
+        result = stacker.align();
+    }
+    if (result == JPEG_OK) {
+        result = stacker.write(writer, context, &runner);
+    }
+    uint32_t elapsedMs = millis() - startMs;
+
+    // The first frame gives the camera back to the ring
+    for (int i = 1; i < count; i++) {
+        cameraReleaseFrameBuffer(frames[i]);
+    }
+    GlobalState::getZslService()->releaseFrame(frames[0]);
+
+    if (result != JPEG_OK) {
+        Serial.printf("stack: failed with error %d\n", result);
+        return result;
+    }
+    stackCount++;
+    framesStacked += stacker.getStackedCount();
+    totalStackMs += elapsedMs;
+    Serial.printf("stack: %d of %d frames in %lu ms, %u KB of %u KB used\n", stacker.getStackedCount(), count,
+                  (unsigned long) elapsedMs, (unsigned) (arena->getHighWater() / 1024), (unsigned) (arena->getCapacity() / 1024));
+    for (int i = 1; i < stacker.getFrameCount(); i++) {
+        Serial.printf("stack: frame %d shifted %+d,%+d px\n", i, stacker.getShiftX(i), stacker.getShiftY(i));
+    }
+    return JPEG_OK;
+}
+
+void StackService::logStats() {
+    if (stackCount == 0) {
+        return;
+    }
+    Serial.printf("stack: %lu stacks, %.1f frames and %lu ms per stack, %lu lanes on the other core\n", (unsigned long) stackCount,
+                  (float) framesStacked / stackCount, (unsigned long) (totalStackMs / stackCount),
+                  (unsigned long) runner.getOffloadedCount());
+}
@@ -0,0 +1,76 @@
+#ifndef RETROLENS_STACK_SERVICE_H
+#define RETROLENS_STACK_SERVICE_H
+
+#include <Arduino.h>
+#include <esp_camera.h>
+
+#include "CameraUtils.h"
+#include "FrameStacker.h"
+#include "WorkerStripRunner.h"
+
+// Frames of a stack, every driver buffer is held at once
+#define STACK_FRAME_COUNT CAMERA_FRAME_BUFFERS
+
+/**
+ * @class StackService
+ * @brief Multi-frame noise reduction: captures a burst, aligns and averages it into one JPEG.
+ *
+ * The frame of the press is taken from the zero-shutter-lag ring when it has one and the burst
+ * is completed with new captures, holding every driver buffer. The frames are stacked by a
+ * FrameStacker strip by strip on both cores, within the image arena of GlobalState, and the
+ * result is streamed to the writer as it is encoded.
+ *
+ * Example usage:
+ * @code
+ * // With the camera and the SD card held
+ * if (stackService.isAvailable()) {
+ *     stackService.captureStack(pressTimeUs, writeToFile, &file);
+ * }
+ * @endcode
+ */
+class StackService {
+public:
+    /**
+     * @brief Constructor for StackService.
+     */
+    StackService();
+
+    /**
+     * @brief Get the memory a stack needs at the full frame size.
+     *
+     * @return size_t Bytes of image arena.
+     */
+    static size_t requiredBytes();
+
+    /**
+     * @brief Check if the image arena is large enough for a stack.
+     *
+     * @return true if captureStack() can run.
+     */
+    bool isAvailable();
+
+    /**
+     * @brief Capture a burst and write the stacked JPEG.
+     *
+     * The camera must not be used by anyone else meanwhile.
+     *
+     * @param pressTimeUs Interrupt time of the shutter press, negative to only capture new frames.
+     * @param writer Output sink.
+     * @param context Context of the writer.
+     * @return int JPEG_OK or a JPEG_ERROR_* code.
+     */
+    int captureStack(int64_t pressTimeUs, JpegWriter writer, void* context);
+
+    /**
+     * @brief Print the stack statistics.
+     */
+    void logStats();
+
+private:
+    WorkerStripRunner runner;      ///< Runs the strip lanes on both cores.
+    uint32_t stackCount;           ///< Stacks written.
+    uint32_t framesStacked;        ///< Frames averaged over every stack.
+    uint32_t totalStackMs;         ///< Time spent stacking, capture excluded.
+};
+
+#endif // RETROLENS_STACK_SERVICE_H
@@ -0,0 +1,103 @@
+#include <driver/gpio.h>
+#include <driver/rtc_io.h>
+#include <esp32/clk.h>
+#include <esp_attr.h>
+#include <esp_sleep.h>
+#include <soc/rtc.h>
+#include <soc/rtc_cntl_reg.h>
+
+#include "CameraPins.h"
+#include "GlobalState.h"
+#include "StandbyService.h"
+
+// State kept in RTC slow memory across deep sleep
+RTC_DATA_ATTR static StandbyState rtcStandbyState;
+RTC_DATA_ATTR static uint64_t rtcWakeTicks;
+
+void RTC_IRAM_ATTR esp_wake_deep_sleep(void) {
+    esp_default_wake_deep_sleep();
+
+    // Latch the RTC timer, the stub runs before the bootloader and may only touch registers and RTC memory
+    SET_PERI_REG_MASK(RTC_CNTL_TIME_UPDATE_REG, RTC_CNTL_TIME_UPDATE);
+    while (GET_PERI_REG_MASK(RTC_CNTL_TIME_UPDATE_REG, RTC_CNTL_TIME_VALID) == 0) {
+    }
+    rtcWakeTicks = READ_PERI_REG(RTC_CNTL_TIME0_REG) | ((uint64_t) READ_PERI_REG(RTC_CNTL_TIME1_REG) << 32);
+}
+
+StandbyService::StandbyService()
+    : store(&rtcStandbyState), wakeLock(portMUX_INITIALIZER_UNLOCKED), wakePending(false), wakeRtcTicks(0) {
+    deepSleepAvailable = rtc_gpio_is_valid_gpio((gpio_num_t) SHUTTER_BUTTON_PIN);
+    resuming = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT0 && store.isValid();
+    if (resuming) {
+        markWake(rtcWakeTicks);
+    }
+
+    // The sensor was held in power-down through the deep sleep
+    gpio_hold_dis((gpio_num_t) PWDN_GPIO_NUM);
+    gpio_deep_sleep_hold_dis();
+}
+
+bool StandbyService::isDeepSleepAvailable() const {
+    return deepSleepAvailable;
+}
+
+bool StandbyService::getResumeSettings(StandbySettings* settings) const {
+    return resuming && store.load(settings);
+}
+
+void StandbyService::enterStandby(const StandbySettings& settings) {
+    store.save(settings);
+    GlobalState::getPowerService()->releaseSensor();
+    Serial.printf("standby: entering %s sleep\n", deepSleepAvailable ? "deep" : "light");
+    Serial.flush();
+
+    if (deepSleepAvailable) {
+        // Keep the sensor in power-down while the digital pins are off
+        gpio_hold_en((gpio_num_t) PWDN_GPIO_NUM);
+        gpio_deep_sleep_hold_en();
+
+        if (SHUTTER_BUTTON_ACTIVE == LOW) {
+            rtc_gpio_pullup_en((gpio_num_t) SHUTTER_BUTTON_PIN);
+            rtc_gpio_pulldown_dis((gpio_num_t) SHUTTER_BUTTON_PIN);
+        } else {
+            rtc_gpio_pulldown_en((gpio_num_t) SHUTTER_BUTTON_PIN);
+            rtc_gpio_pullup_dis((gpio_num_t) SHUTTER_BUTTON_PIN);
+        }
+        esp_sleep_enable_ext0_wakeup((gpio_num_t) SHUTTER_BUTTON_PIN, SHUTTER_BUTTON_ACTIVE == LOW ? 0 : 1);
+        esp_deep_sleep_start();
+    }
+
+    // The power service enabled the GPIO wake on the shutter
+    esp_light_sleep_start();
+    markWake(rtc_time_get());
+}
+
+void StandbyService::markWake(uint64_t rtcTicks) {
+    portENTER_CRITICAL(&wakeLock);
+    wakeRtcTicks = rtcTicks;
+    wakePending = true;
+    portEXIT_CRITICAL(&wakeLock);
+}
+
+void StandbyService::noteCapture() {
+    uint64_t now = rtc_time_get();
+    portENTER_CRITICAL(&wakeLock);
+    bool pending = wakePending;
+    uint64_t wakeTicks = wakeRtcTicks;
+    wakePending = false;
+    portEXIT_CRITICAL(&wakeLock);
+    if (!pending) {
+        return;
+    }
+
+    uint32_t elapsedUs = (uint32_t) rtc_time_slowclk_to_us(now - wakeTicks, esp_clk_slowclk_cal_get());
+    store.recordWakeToCapture(elapsedUs);
+    Serial.printf("standby: wake to capture %lu ms\n", (unsigned long) (elapsedUs / 1000));
+    logStats();
+}
+
+void StandbyService::logStats() {
+    Serial.printf("standby: %lu standbys, wake to capture average %lu ms, slowest %lu ms over %lu wakes\n",
+                  (unsigned long) store.getStandbyCount(), (unsigned long) (store.getAverageWakeToCaptureUs() / 1000),
+                  (unsigned long) (store.getMaxWakeToCaptureUs() / 1000), (unsigned long) store.getWakeToCaptureCount());
+}
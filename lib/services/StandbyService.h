@@ -0,0 +1,95 @@
+#ifndef RETROLENS_STANDBY_SERVICE_H
+#define RETROLENS_STANDBY_SERVICE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+#include "StandbyStore.h"
+
+// Time without any user activity before the camera is considered pocketed
+#define STANDBY_IDLE_TIMEOUT_MS 300000
+
+/**
+ * @class StandbyService
+ * @brief Service that puts the camera in standby, woken by the shutter, and measures how fast it shoots after the wake.
+ *
+ * The roll index, the flash setting and the sensor profile are saved in RTC memory, which
+ * survives deep sleep. If the shutter is on an RTC GPIO the chip deep sleeps with an ext0 wake
+ * and the next boot resumes from the saved state. Otherwise, as with the shutter on GPIO 3 of
+ * the ESP32-CAM, deep sleep has no way to wake on the button and standby light sleeps on the
+ * GPIO wake instead, keeping the RAM and returning from enterStandby().
+ *
+ * The wake instant comes from the RTC timer, latched by the deep sleep wake stub before the
+ * bootloader runs, so the wake-to-capture time includes the whole boot. It is logged on the
+ * first capture after each wake and accumulated in the RTC state.
+ *
+ * Example usage:
+ * @code
+ * StandbyService standbyService;
+ * StandbySettings settings;
+ * if (standbyService.getResumeSettings(&settings)) {
+ *     // Fast path, restore the settings
+ * }
+ *
+ * // Later, when pocketed
+ * standbyService.enterStandby(settings);
+ * @endcode
+ */
+class StandbyService {
+public:
+    /**
+     * @brief Constructor for StandbyService, reads the wake cause and the RTC state.
+     */
+    StandbyService();
+
+    /**
+     * @brief Check if the shutter can wake the chip from deep sleep.
+     *
+     * @return true if standby deep sleeps, false if it light sleeps.
+     */
+    bool isDeepSleepAvailable() const;
+
+    /**
+     * @brief Get the settings to resume with, if this boot is a wake from deep sleep standby.
+     *
+     * @param settings Output settings saved before standby.
+     * @return true if the boot resumes from standby, false for a cold boot.
+     */
+    bool getResumeSettings(StandbySettings* settings) const;
+
+    /**
+     * @brief Save the settings, power the sensor down and sleep until the shutter is pressed.
+     *
+     * Does not return from deep sleep, the chip boots again on the wake.
+     *
+     * @param settings User state to keep.
+     */
+    void enterStandby(const StandbySettings& settings);
+
+    /**
+     * @brief Record a captured frame, logging the wake-to-capture time of the first one after a wake.
+     */
+    void noteCapture();
+
+    /**
+     * @brief Print the wake-to-capture statistics kept across standby.
+     */
+    void logStats();
+
+private:
+    /**
+     * @brief Start timing a wake.
+     *
+     * @param rtcTicks RTC timer value at the wake.
+     */
+    void markWake(uint64_t rtcTicks);
+
+    StandbyStore store;         ///< State in RTC memory.
+    bool deepSleepAvailable;    ///< True if the shutter is on an RTC GPIO.
+    bool resuming;              ///< True if this boot is a wake from deep sleep standby.
+    portMUX_TYPE wakeLock;      ///< Protects the wake timing.
+    bool wakePending;           ///< True until the first capture after a wake.
+    uint64_t wakeRtcTicks;      ///< RTC timer value at the last wake.
+};
+
+#endif // RETROLENS_STANDBY_SERVICE_H
@@ -0,0 +1,116 @@
+#include "WorkerPool.h"
+
+/**
+ * @brief Static configuration of a worker.
+ */
+struct WorkerConfig {
+    const char* name;          ///< Task name.
+    BaseType_t core;           ///< Core the task is pinned to.
+    UBaseType_t taskPriority;  ///< FreeRTOS priority of the task.
+    uint32_t priorityMask;     ///< Job priorities served by the worker.
+};
+
+static const WorkerConfig WORKER_CONFIGS[WORKER_COUNT] = {
+    // Shutter path on the application core, away from the WiFi stack
+    {"ForegroundWorker", 1, WORKER_FOREGROUND_TASK_PRIORITY, JOB_PRIORITY_MASK(JOB_PRIORITY_SHUTTER) | JOB_PRIORITY_MASK(JOB_PRIORITY_NORMAL)},
+    // Everything else on the protocol core, helping with urgent jobs when idle
+    {"BackgroundWorker", 0, WORKER_BACKGROUND_TASK_PRIORITY, JOB_PRIORITY_MASK_ALL},
+};
+
+JobFuture::JobFuture() : result(0) {
+    doneSemaphore = xSemaphoreCreateBinaryStatic(&doneSemaphoreBuffer);
+}
+
+bool JobFuture::wait(int* result, TickType_t timeout) {
+    if (xSemaphoreTake(doneSemaphore, timeout) != pdTRUE) {
+        return false;
+    }
+    if (result != nullptr) {
+        *result = this->result;
+    }
+    return true;
+}
+
+void JobFuture::complete(void* context, int result) {
+    JobFuture* future = static_cast<JobFuture*>(context);
+    future->result = result;
+    xSemaphoreGive(future->doneSemaphore);
+}
+
+WorkerPool::WorkerPool() {
+    vPortCPUInitializeMutex(&queueLock);
+    for (int i = 0; i < WORKER_COUNT; i++) {
+        workers[i].pool = this;
+        workers[i].priorityMask = WORKER_CONFIGS[i].priorityMask;
+        workers[i].handle = nullptr;
+    }
+}
+
+void WorkerPool::begin() {
+    for (int i = 0; i < WORKER_COUNT; i++) {
+        if (workers[i].handle != nullptr) {
+            continue;
+        }
+        workers[i].handle = xTaskCreateStaticPinnedToCore(workerTask, WORKER_CONFIGS[i].name, WORKER_STACK_SIZE, &workers[i],
+                                                          WORKER_CONFIGS[i].taskPriority, workers[i].stack,
+                                                          &workers[i].taskBuffer, WORKER_CONFIGS[i].core);
+    }
+}
+
+bool WorkerPool::submit(uint8_t priority, JobFunction function, void* arg, JobCallback done, void* doneContext) {
+    Job job = {function, arg, done, doneContext, priority};
+
+    portENTER_CRITICAL(&queueLock);
+    bool queued = queue.push(job);
+    portEXIT_CRITICAL(&queueLock);
+    if (!queued) {
+        return false;
+    }
+
+    // Wake the workers that can run the job, the notification count keeps the wake-up if they are busy
+    for (int i = 0; i < WORKER_COUNT; i++) {
+        if (workers[i].handle != nullptr && (workers[i].priorityMask & JOB_PRIORITY_MASK(priority))) {
+            xTaskNotifyGive(workers[i].handle);
+        }
+    }
+    return true;
+}
+
+bool WorkerPool::submit(uint8_t priority, JobFunction function, void* arg, JobFuture* future) {
+    return submit(priority, function, arg, JobFuture::complete, future);
+}
+
+void WorkerPool::workerTask(void* p) {
+    Worker* worker = static_cast<Worker*>(p);
+    WorkerPool* pool = worker->pool;
+    UBaseType_t basePriority = uxTaskPriorityGet(nullptr);
+
+    Job job;
+    while (true) {
+        // Take the most urgent job this worker can run
+        portENTER_CRITICAL(&pool->queueLock);
+        bool found = pool->queue.pop(worker->priorityMask, &job);
+        portEXIT_CRITICAL(&pool->queueLock);
+
+        if (!found) {
+            // Sleep until a job is submitted
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        // Urgent jobs run at the foreground priority whichever worker takes them
+        bool boosted = job.priority != JOB_PRIORITY_BACKGROUND && basePriority < WORKER_FOREGROUND_TASK_PRIORITY;
+        if (boosted) {
+            vTaskPrioritySet(nullptr, WORKER_FOREGROUND_TASK_PRIORITY);
+        }
+
+        int result = job.function(job.arg);
+        if (job.done != nullptr) {
+            job.done(job.doneContext, result);
+        }
+
+        if (boosted) {
+            vTaskPrioritySet(nullptr, basePriority);
+        }
+    }
+}
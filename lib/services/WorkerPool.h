@@ -0,0 +1,140 @@
+#ifndef RETROLENS_WORKER_POOL_H
+#define RETROLENS_WORKER_POOL_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include "JobQueue.h"
+
+#define WORKER_COUNT 2
+#define WORKER_STACK_SIZE 4096
+
+// FreeRTOS priorities of the workers
+#define WORKER_FOREGROUND_TASK_PRIORITY 3
+#define WORKER_BACKGROUND_TASK_PRIORITY 1
+
+/**
+ * @class JobFuture
+ * @brief Completion handle that lets a task wait for the result of a job.
+ *
+ * Example usage:
+ * @code
+ * JobFuture future;
+ * workerPool.submit(JOB_PRIORITY_NORMAL, myJob, nullptr, &future);
+ * int result;
+ * if (future.wait(&result, portMAX_DELAY)) {
+ *     // Use result
+ * }
+ * @endcode
+ */
+class JobFuture {
+public:
+    /**
+     * @brief Construct a new Job Future object.
+     */
+    JobFuture();
+
+    /**
+     * @brief Wait for the job to complete.
+     *
+     * @param result Output result of the job function.
+     * @param timeout Time (in ticks) to wait.
+     * @return true if the job completed, false on timeout.
+     */
+    bool wait(int* result, TickType_t timeout);
+
+    /**
+     * @brief Completion callback that resolves the future.
+     *
+     * @param context Pointer to the JobFuture.
+     * @param result Result of the job function.
+     */
+    static void complete(void* context, int result);
+
+private:
+    SemaphoreHandle_t doneSemaphore;       ///< Given once the job completes.
+    StaticSemaphore_t doneSemaphoreBuffer; ///< Storage of the semaphore.
+    volatile int result;                   ///< Result of the job function.
+};
+
+/**
+ * @class WorkerPool
+ * @brief Fixed pool of persistent worker tasks, pinned per core, running prioritized jobs.
+ *
+ * The foreground worker only runs shutter and normal jobs at a high task priority, so a
+ * shutter job never waits behind a battery read and preempts background work on its core.
+ * The background worker runs every priority, most urgent first, at a low task priority.
+ * Jobs are stored by value, submitting does not allocate.
+ *
+ * Example usage:
+ * @code
+ * int readBattery(void* arg) {
+ *     return 0;
+ * }
+ *
+ * workerPool.begin();
+ * workerPool.submit(JOB_PRIORITY_BACKGROUND, readBattery, nullptr);
+ * @endcode
+ */
+class WorkerPool {
+public:
+    /**
+     * @brief Construct a new Worker Pool object. No task is started until begin().
+     */
+    WorkerPool();
+
+    /**
+     * @brief Start the worker tasks.
+     */
+    void begin();
+
+    /**
+     * @brief Submit a job with an optional completion callback.
+     *
+     * @param priority One of the JOB_PRIORITY_* values.
+     * @param function Function to run on a worker.
+     * @param arg Argument of the function.
+     * @param done Completion callback, called on the worker with the function result.
+     * @param doneContext Context of the completion callback.
+     * @return true if the job was queued, false if the queue of its priority is full.
+     */
+    bool submit(uint8_t priority, JobFunction function, void* arg, JobCallback done = nullptr, void* doneContext = nullptr);
+
+    /**
+     * @brief Submit a job whose completion resolves a future.
+     *
+     * @param priority One of the JOB_PRIORITY_* values.
+     * @param function Function to run on a worker.
+     * @param arg Argument of the function.
+     * @param future Future resolved with the function result.
+     * @return true if the job was queued, false if the queue of its priority is full.
+     */
+    bool submit(uint8_t priority, JobFunction function, void* arg, JobFuture* future);
+
+private:
+    /**
+     * @brief State of a worker task.
+     */
+    struct Worker {
+        WorkerPool* pool;                     ///< Owning pool.
+        uint32_t priorityMask;                ///< Job priorities served by the worker.
+        TaskHandle_t handle;                  ///< Task handle.
+        StaticTask_t taskBuffer;              ///< Control block of the task.
+        StackType_t stack[WORKER_STACK_SIZE]; ///< Stack of the task.
+    };
+
+    /**
+     * @brief Task function of a worker: take the next job, run it and report completion.
+     *
+     * @param p Pointer to the Worker.
+     */
+    static void workerTask(void* p);
+
+    JobQueue queue;                ///< Pending jobs.
+    portMUX_TYPE queueLock;        ///< Spinlock protecting the queue.
+    Worker workers[WORKER_COUNT];  ///< Worker tasks.
+};
+
+#endif // RETROLENS_WORKER_POOL_H
@@ -0,0 +1,58 @@
+#include "WorkerStripRunner.h"
+
+WorkerStripRunner::WorkerStripRunner(WorkerPool* pool)
+    : pool(pool), function(nullptr), arg(nullptr), laneTaken(true), jobQueued(false), offloadedCount(0) {
+    vPortCPUInitializeMutex(&laneLock);
+    laneDoneSemaphore = xSemaphoreCreateBinaryStatic(&laneDoneSemaphoreBuffer);
+}
+
+void WorkerStripRunner::run(StripLaneFunction function, void* arg) {
+    portENTER_CRITICAL(&laneLock);
+    this->function = function;
+    this->arg = arg;
+    laneTaken = false;
+    bool submit = !jobQueued;
+    jobQueued = true;
+    portEXIT_CRITICAL(&laneLock);
+
+    if (submit && !pool->submit(JOB_PRIORITY_SHUTTER, laneJob, this)) {
+        portENTER_CRITICAL(&laneLock);
+        jobQueued = false;
+        portEXIT_CRITICAL(&laneLock);
+    }
+
+    function(arg, 0);
+
+    // Take lane 1 over if the job has not started it
+    portENTER_CRITICAL(&laneLock);
+    bool mine = !laneTaken;
+    laneTaken = true;
+    portEXIT_CRITICAL(&laneLock);
+    if (mine) {
+        function(arg, 1);
+    } else {
+        xSemaphoreTake(laneDoneSemaphore, portMAX_DELAY);
+    }
+}
+
+uint32_t WorkerStripRunner::getOffloadedCount() const {
+    return offloadedCount;
+}
+
+int WorkerStripRunner::laneJob(void* p) {
+    WorkerStripRunner* runner = static_cast<WorkerStripRunner*>(p);
+    portENTER_CRITICAL(&runner->laneLock);
+    runner->jobQueued = false;
+    bool mine = !runner->laneTaken;
+    runner->laneTaken = true;
+    StripLaneFunction function = runner->function;
+    void* arg = runner->arg;
+    portEXIT_CRITICAL(&runner->laneLock);
+
+    if (mine) {
+        function(arg, 1);
+        runner->offloadedCount++;
+        xSemaphoreGive(runner->laneDoneSemaphore);
+    }
+    return 0;
+}
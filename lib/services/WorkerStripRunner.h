@@ -0,0 +1,68 @@
+#ifndef RETROLENS_WORKER_STRIP_RUNNER_H
+#define RETROLENS_WORKER_STRIP_RUNNER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include "StripRunner.h"
+#include "WorkerPool.h"
+
+/**
+ * @class WorkerStripRunner
+ * @brief StripRunner that runs lane 0 on the calling task and lane 1 on the other worker of the pool.
+ *
+ * Lane 1 is submitted as a shutter job, so the idle worker takes it on the other core. The
+ * other worker may be busy, or blocked on pins held by the caller, so whoever gets to lane 1
+ * first runs it: the caller takes it over once lane 0 is done if the job has not started.
+ * At most one job is queued at a time, a job that finds its lane taken serves the next strip.
+ *
+ * Example usage:
+ * @code
+ * WorkerStripRunner runner(GlobalState::getWorkerPool());
+ * stacker.write(writer, context, &runner);
+ * @endcode
+ */
+class WorkerStripRunner : public StripRunner {
+public:
+    /**
+     * @brief Constructor for WorkerStripRunner.
+     *
+     * @param pool Worker pool that runs lane 1.
+     */
+    WorkerStripRunner(WorkerPool* pool);
+
+    /**
+     * @brief Run both lanes and return once they are done.
+     *
+     * @param function Work of a lane.
+     * @param arg Argument of the work.
+     */
+    void run(StripLaneFunction function, void* arg) override;
+
+    /**
+     * @brief Get the number of lanes run by the other worker since construction.
+     */
+    uint32_t getOffloadedCount() const;
+
+private:
+    /**
+     * @brief Job function that runs lane 1 unless the caller took it.
+     *
+     * @param p Pointer to the WorkerStripRunner.
+     * @return int Always 0.
+     */
+    static int laneJob(void* p);
+
+    WorkerPool* pool;                      ///< Pool of the second lane.
+    portMUX_TYPE laneLock;                 ///< Protects the lane state.
+    StripLaneFunction function;            ///< Work of the current run.
+    void* arg;                             ///< Argument of the current run.
+    bool laneTaken;                        ///< True once lane 1 of the current run has an owner.
+    bool jobQueued;                        ///< True while a lane job waits in the pool.
+    uint32_t offloadedCount;               ///< Lanes run by the job.
+    SemaphoreHandle_t laneDoneSemaphore;   ///< Given when the job finishes lane 1.
+    StaticSemaphore_t laneDoneSemaphoreBuffer; ///< Storage of the semaphore.
+};
+
+#endif // RETROLENS_WORKER_STRIP_RUNNER_H
@@ -0,0 +1,148 @@
+#include "GlobalState.h"
+#include "ZslService.h"
+
+ZslService::ZslService()
+    : ring(ZSL_RING_FRAMES), armed(false), armedUntilMs(0), paused(false), meteringPending(false), metering(false),
+      meteringMs(0), meteringCount(0), meteringTotalMs(0), meteringMaxMs(0), zslTaskHandle(nullptr) {
+    ringMutex = xSemaphoreCreateMutexStatic(&ringMutexBuffer);
+}
+
+void ZslService::begin() {
+    zslTaskHandle = xTaskCreateStatic(zslTask, "ZslTask", ZSL_TASK_STACK_SIZE, this, 2, zslTaskStack, &zslTaskBuffer);
+}
+
+void ZslService::notePress(int64_t pressTimeUs) {
+    xSemaphoreTake(ringMutex, portMAX_DELAY);
+    if (!armed || (int32_t) (armedUntilMs - millis()) <= 0) {
+        // The exposure held from the last metering may be for another scene
+        meteringPending = true;
+        meteringMs = 0;
+    }
+    ring.hold(pressTimeUs);
+    armedUntilMs = millis() + ZSL_ARM_TIMEOUT_MS;
+    armed = true;
+    xSemaphoreGive(ringMutex);
+    xTaskNotifyGive(zslTaskHandle);
+}
+
+camera_fb_t* ZslService::takeFrame(int64_t pressTimeUs) {
+    // Waits for a frame being captured, it may be the closest one
+    xSemaphoreTake(ringMutex, portMAX_DELAY);
+    while (metering) {
+        // The metering of the press owns the camera, a shot that comes first waits for it
+        xSemaphoreGive(ringMutex);
+        vTaskDelay(pdMS_TO_TICKS(ZSL_POLL_MS));
+        xSemaphoreTake(ringMutex, portMAX_DELAY);
+    }
+    paused = true;
+    camera_fb_t* frameBuffer = nullptr;
+    int64_t frameTimeUs = 0;
+    if (pressTimeUs >= 0) {
+        frameBuffer = static_cast<camera_fb_t*>(ring.takeClosest(pressTimeUs, &frameTimeUs));
+    }
+    drain();
+    uint32_t pressMeteringMs = meteringMs;
+    xSemaphoreGive(ringMutex);
+
+    if (frameBuffer != nullptr) {
+        // The metering of a press at rest delays its first ring frame
+        Serial.printf("zsl: press to exposure %+ld ms, metering %lu ms\n", (long) ((frameTimeUs - pressTimeUs) / 1000),
+                      (unsigned long) pressMeteringMs);
+        logStats();
+    }
+    return frameBuffer;
+}
+
+void ZslService::releaseFrame(camera_fb_t* frameBuffer) {
+    cameraReleaseFrameBuffer(frameBuffer);
+    paused = false;
+    xTaskNotifyGive(zslTaskHandle);
+}
+
+void ZslService::logStats() {
+    xSemaphoreTake(ringMutex, portMAX_DELAY);
+    Serial.printf("zsl: %lu shots, press to exposure mean %+ld ms, mean distance %ld ms, range %+ld..%+ld ms\n",
+                  (unsigned long) ring.getShotCount(), (long) (ring.getMeanOffsetUs() / 1000),
+                  (long) (ring.getMeanAbsOffsetUs() / 1000), (long) (ring.getMinOffsetUs() / 1000),
+                  (long) (ring.getMaxOffsetUs() / 1000));
+    Serial.printf("zsl: %lu presses metered, metering mean %lu ms, longest %lu ms\n", (unsigned long) meteringCount,
+                  (unsigned long) (meteringCount > 0 ? meteringTotalMs / meteringCount : 0), (unsigned long) meteringMaxMs);
+    xSemaphoreGive(ringMutex);
+}
+
+bool ZslService::isFilling() {
+    if (armed && (int32_t) (armedUntilMs - millis()) <= 0) {
+        armed = false;
+    }
+    return armed && !paused;
+}
+
+void ZslService::drain() {
+    void* frame;
+    while ((frame = ring.popOldest()) != nullptr) {
+        cameraReleaseFrameBuffer(static_cast<camera_fb_t*>(frame));
+    }
+    ring.unhold();
+}
+
+void ZslService::zslTask(void* p) {
+    ZslService* zsl = static_cast<ZslService*>(p);
+    while (true) {
+        if (!zsl->isFilling()) {
+            // Give the buffers back, they are stale by the next press
+            if (!zsl->paused) {
+                xSemaphoreTake(zsl->ringMutex, portMAX_DELAY);
+                zsl->drain();
+                // The scene may change before the next press, the sensor follows it again
+                if (GlobalState::getPowerService()->isSensorOn()) {
+                    GlobalState::getMeteringService()->releaseControls();
+                }
+                xSemaphoreGive(zsl->ringMutex);
+            }
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ZSL_ARM_TIMEOUT_MS));
+            continue;
+        }
+
+        // The sensor may be re-arming after a power-down
+        if (!GlobalState::getPowerService()->isSensorOn()) {
+            vTaskDelay(pdMS_TO_TICKS(ZSL_POLL_MS));
+            continue;
+        }
+
+        xSemaphoreTake(zsl->ringMutex, portMAX_DELAY);
+        if (zsl->meteringPending && !zsl->paused) {
+            // The ring is empty after a rest and stays paused, the lock is given back so the press does not wait
+            zsl->meteringPending = false;
+            zsl->metering = true;
+            xSemaphoreGive(zsl->ringMutex);
+            GlobalState::getMeteringService()->meter();
+            xSemaphoreTake(zsl->ringMutex, portMAX_DELAY);
+            zsl->metering = false;
+            zsl->meteringMs = GlobalState::getMeteringService()->getLastDurationMs();
+            zsl->meteringCount++;
+            zsl->meteringTotalMs += zsl->meteringMs;
+            zsl->meteringMaxMs = zsl->meteringMs > zsl->meteringMaxMs ? zsl->meteringMs : zsl->meteringMaxMs;
+        }
+        bool needsFrames = !zsl->paused && zsl->ring.needsFrames();
+        if (needsFrames) {
+            // Make room first, the driver needs a free buffer to capture into
+            if (zsl->ring.isFull()) {
+                cameraReleaseFrameBuffer(static_cast<camera_fb_t*>(zsl->ring.popOldest()));
+            }
+            camera_fb_t* frameBuffer = cameraCaptureImage();
+            if (frameBuffer != nullptr && MeteringService::isMeteringFrame(frameBuffer)) {
+                // Captured before the sensor was back at the full frame
+                cameraReleaseFrameBuffer(frameBuffer);
+            } else if (frameBuffer != nullptr) {
+                GlobalState::getRateService()->onFrame(frameBuffer);
+                void* evicted;
+                zsl->ring.push(frameBuffer, cameraFrameTimeUs(frameBuffer), &evicted);
+            }
+        }
+        xSemaphoreGive(zsl->ringMutex);
+
+        if (!needsFrames) {
+            vTaskDelay(pdMS_TO_TICKS(ZSL_POLL_MS));
+        }
+    }
+}
@@ -0,0 +1,129 @@
+#ifndef RETROLENS_ZSL_SERVICE_H
+#define RETROLENS_ZSL_SERVICE_H
+
+#include <Arduino.h>
+#include <esp_camera.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include "CameraUtils.h"
+#include "FrameRing.h"
+
+// Frames kept around the press, the driver needs one more buffer to keep capturing
+#define ZSL_RING_FRAMES (CAMERA_FRAME_BUFFERS - 1)
+
+// Time the ring keeps filling after a press, below the minimum sensor idle timeout
+#define ZSL_ARM_TIMEOUT_MS 4000
+
+// Poll period while the sensor is off or the ring holds its frames
+#define ZSL_POLL_MS 5
+
+#define ZSL_TASK_STACK_SIZE 3072
+
+/**
+ * @class ZslService
+ * @brief Zero-shutter-lag capture: keeps a ring of timestamped frames and saves the one closest to the press.
+ *
+ * A press arms the service for ZSL_ARM_TIMEOUT_MS and holds the ring at the press time taken in
+ * the button interrupt. A press that arms the service from rest first meters the scene on tiny
+ * frames with the MeteringService, so the ring fills with frames that are already exposed. The
+ * metering runs with the ring paused but without its lock, so the press never waits for it; only
+ * a shot taken before it ends does, and its latency is logged with each shot. When the
+ * arm timeout ends the sensor gets its automatic controls back, so captures outside the ring
+ * follow the scene again. The ZSL task fills the ring from the camera until it holds a frame at or
+ * after the press, so the frames around the press wait for the release, the SD mount and the
+ * save job. The shot takes the closest frame, compared on the esp_timer clock the camera driver
+ * stamps at the start of each frame, and the press-to-exposure offset statistics are logged.
+ *
+ * Example usage:
+ * @code
+ * // On the press
+ * zslService.notePress(buttonService.getLastPressTimeUs());
+ *
+ * // In the save job
+ * camera_fb_t* fb = zslService.takeFrame(pressTimeUs);
+ * if (fb == nullptr) {
+ *     fb = cameraCaptureImage();
+ * }
+ * // Save fb
+ * zslService.releaseFrame(fb);
+ * @endcode
+ */
+class ZslService {
+public:
+    /**
+     * @brief Constructor for ZslService.
+     */
+    ZslService();
+
+    /**
+     * @brief Start the ZSL task, disarmed.
+     */
+    void begin();
+
+    /**
+     * @brief Fill the ring for ZSL_ARM_TIMEOUT_MS and hold the frames around a press.
+     *
+     * @param pressTimeUs Interrupt time of the press, on the esp_timer clock.
+     */
+    void notePress(int64_t pressTimeUs);
+
+    /**
+     * @brief Stop filling the ring and take the frame closest to a press.
+     *
+     * The camera is left to the caller until releaseFrame(), even when no frame is returned.
+     *
+     * @param pressTimeUs Interrupt time of the press, negative if unknown.
+     * @return camera_fb_t* Frame to save, nullptr if the ring has none.
+     */
+    camera_fb_t* takeFrame(int64_t pressTimeUs);
+
+    /**
+     * @brief Return the saved frame to the driver and let the ring fill again while armed.
+     *
+     * @param frameBuffer Frame from takeFrame() or a direct capture, may be nullptr.
+     */
+    void releaseFrame(camera_fb_t* frameBuffer);
+
+    /**
+     * @brief Print the press-to-exposure offset and metering latency statistics.
+     */
+    void logStats();
+
+private:
+    /**
+     * @brief Task that fills the ring while armed.
+     *
+     * @param p Pointer to the ZslService instance.
+     */
+    static void zslTask(void* p);
+
+    /**
+     * @brief Check if the ring should be filling.
+     */
+    bool isFilling();
+
+    /**
+     * @brief Return every frame of the ring to the driver. Must be called with the ring mutex held.
+     */
+    void drain();
+
+    FrameRing ring;                           ///< Frames around the press.
+    SemaphoreHandle_t ringMutex;              ///< Protects the ring and the camera.
+    StaticSemaphore_t ringMutexBuffer;        ///< Storage of the ring mutex.
+    volatile bool armed;                      ///< True after a press, until the arm timeout.
+    volatile uint32_t armedUntilMs;           ///< End of the arm timeout.
+    volatile bool paused;                     ///< True while a shot owns the camera.
+    volatile bool meteringPending;            ///< True from a press at rest until the scene is metered.
+    volatile bool metering;                   ///< True while the ZSL task meters, the camera is its own.
+    uint32_t meteringMs;                      ///< Metering latency of the last press, 0 if it did not meter.
+    uint32_t meteringCount;                   ///< Presses that metered.
+    uint32_t meteringTotalMs;                 ///< Metering latency over those presses.
+    uint32_t meteringMaxMs;                   ///< Longest metering latency.
+    TaskHandle_t zslTaskHandle;               ///< ZSL task.
+    StaticTask_t zslTaskBuffer;               ///< Control block of the ZSL task.
+    StackType_t zslTaskStack[ZSL_TASK_STACK_SIZE]; ///< Stack of the ZSL task.
+};
+
+#endif // RETROLENS_ZSL_SERVICE_H
@@ -1,8 +1,13 @@
+#include <driver/gpio.h>
+#include <driver/ledc.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
 #include "CameraUtils.h"
 
 camera_config_t cameraConfig;
 
-esp_err_t initializeCamera() {
+esp_err_t initializeCamera(const SensorProfile* profile) {
     // Set up the camera configuration
     cameraConfig.ledc_channel = LEDC_CHANNEL_0;
     cameraConfig.ledc_timer = LEDC_TIMER_0;
@@ -22,18 +27,54 @@ esp_err_t initializeCamera() {
     cameraConfig.pin_sccb_scl = SIOC_GPIO_NUM;
     cameraConfig.pin_pwdn = PWDN_GPIO_NUM;
     cameraConfig.pin_reset = RESET_GPIO_NUM;
-    cameraConfig.xclk_freq_hz = 4 * 1000000;
+    cameraConfig.xclk_freq_hz = CAMERA_DEFAULT_XCLK_MHZ * 1000000;
     cameraConfig.pixel_format = PIXFORMAT_JPEG;
-    cameraConfig.frame_size = FRAMESIZE_QSXGA;
-    cameraConfig.jpeg_quality = 12;
+    cameraConfig.frame_size = CAMERA_DEFAULT_FRAME_SIZE;
+    cameraConfig.jpeg_quality = CAMERA_DEFAULT_JPEG_QUALITY;
     cameraConfig.fb_location = CAMERA_FB_IN_PSRAM;
-    cameraConfig.fb_count = 2;
+    cameraConfig.fb_count = CAMERA_FRAME_BUFFERS;
     cameraConfig.grab_mode = CAMERA_GRAB_LATEST;
 
+    // Start as the camera was left before standby
+    if (profile != nullptr) {
+        cameraConfig.xclk_freq_hz = profile->xclkMhz * 1000000;
+        cameraConfig.frame_size = (framesize_t) profile->frameSize;
+        cameraConfig.jpeg_quality = profile->jpegQuality;
+    }
+
     esp_err_t error = esp_camera_init(&cameraConfig);
     return error;
 }
 
+esp_err_t cameraReinitialize(pixformat_t format, framesize_t frameSize, int frameBuffers) {
+    esp_camera_deinit();
+    cameraConfig.pixel_format = format;
+    cameraConfig.frame_size = frameSize;
+    cameraConfig.fb_count = frameBuffers;
+    return esp_camera_init(&cameraConfig);
+}
+
+esp_err_t cameraApplyProfile(const SensorProfile& profile) {
+    cameraConfig.xclk_freq_hz = profile.xclkMhz * 1000000;
+    cameraConfig.jpeg_quality = profile.jpegQuality;
+    return cameraReinitialize(PIXFORMAT_JPEG, (framesize_t) profile.frameSize, CAMERA_FRAME_BUFFERS);
+}
+
+SensorProfile getSensorProfile() {
+    SensorProfile profile;
+    profile.frameSize = (uint8_t) cameraConfig.frame_size;
+    profile.jpegQuality = (uint8_t) cameraConfig.jpeg_quality;
+    profile.xclkMhz = (uint8_t) (cameraConfig.xclk_freq_hz / 1000000);
+    return profile;
+}
+
+void cameraSetJpegQuality(int quality) {
+    sensor_t* sensor = esp_camera_sensor_get();
+    if (sensor != nullptr && sensor->set_quality(sensor, quality) == 0) {
+        cameraConfig.jpeg_quality = quality;
+    }
+}
+
 camera_fb_t* cameraCaptureImage() {
     camera_fb_t* frameBuffer = esp_camera_fb_get();  // Capture the image
     if (!frameBuffer) {
@@ -42,8 +83,26 @@ camera_fb_t* cameraCaptureImage() {
     return frameBuffer;
 }
 
+int64_t cameraFrameTimeUs(const camera_fb_t* frameBuffer) {
+    return (int64_t) frameBuffer->timestamp.tv_sec * 1000000 + frameBuffer->timestamp.tv_usec;
+}
+
 void cameraReleaseFrameBuffer(camera_fb_t* frameBuffer) {
     if (frameBuffer) {
         esp_camera_fb_return(frameBuffer);
     }
 }
+
+void cameraPowerDown() {
+    gpio_set_level((gpio_num_t) PWDN_GPIO_NUM, 1);
+    ledc_timer_pause(CAMERA_LEDC_MODE, cameraConfig.ledc_timer);
+}
+
+void cameraPowerUp() {
+    ledc_timer_resume(CAMERA_LEDC_MODE, cameraConfig.ledc_timer);
+    gpio_set_level((gpio_num_t) PWDN_GPIO_NUM, 0);
+    vTaskDelay(pdMS_TO_TICKS(SENSOR_WAKE_SETTLE_MS));
+
+    // The buffered frame predates the power-down
+    cameraReleaseFrameBuffer(esp_camera_fb_get());
+}
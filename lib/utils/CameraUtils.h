@@ -4,18 +4,70 @@
 #include <esp_camera.h>
 
 #include "CameraPins.h"
+#include "StandbyStore.h"
+
+// Time the sensor needs after leaving power-down before its frames are valid
+#define SENSOR_WAKE_SETTLE_MS 5
+
+// LEDC speed mode of the sensor clock, as set up by the camera driver
+#define CAMERA_LEDC_MODE LEDC_HIGH_SPEED_MODE
 
 /**
  * @brief Camera configuration structure.
  */
 extern camera_config_t cameraConfig;
 
+// Frame buffers in PSRAM, all but one can be held by the zero-shutter-lag ring
+#define CAMERA_FRAME_BUFFERS 3
+
+// Default sensor configuration of a cold boot
+#define CAMERA_DEFAULT_FRAME_SIZE FRAMESIZE_QSXGA
+#define CAMERA_DEFAULT_JPEG_QUALITY 12
+#define CAMERA_DEFAULT_XCLK_MHZ 4
+
 /**
  * @brief Initialize the camera with the specified configuration.
  * 
+ * @param profile Sensor configuration to restore, nullptr for the defaults.
+ * @return esp_err_t ESP_OK on success, or an error code on failure.
+ */
+esp_err_t initializeCamera(const SensorProfile* profile = nullptr);
+
+/**
+ * @brief Initialize the camera again for another pixel format and frame size.
+ * 
+ * The frame buffers are freed and allocated again for the new format, none may be held.
+ * 
+ * @param format Pixel format of the next frames.
+ * @param frameSize Frame size of the next frames.
+ * @param frameBuffers Number of frame buffers.
  * @return esp_err_t ESP_OK on success, or an error code on failure.
  */
-esp_err_t initializeCamera();
+esp_err_t cameraReinitialize(pixformat_t format, framesize_t frameSize, int frameBuffers);
+
+/**
+ * @brief Initialize the camera again for JPEG with the frame size, quality and clock of a profile.
+ * 
+ * The frame buffers are freed and allocated again, none may be held.
+ * 
+ * @param profile Sensor configuration to switch to.
+ * @return esp_err_t ESP_OK on success, or an error code on failure.
+ */
+esp_err_t cameraApplyProfile(const SensorProfile& profile);
+
+/**
+ * @brief Get the sensor configuration the camera was initialized with.
+ * 
+ * @return SensorProfile Configuration to restore with initializeCamera().
+ */
+SensorProfile getSensorProfile();
+
+/**
+ * @brief Change the JPEG quality of the next frames, kept in the sensor configuration for standby.
+ * 
+ * @param quality JPEG quality, lower is finer.
+ */
+void cameraSetJpegQuality(int quality);
 
 /**
  * @brief Capture an image using the camera.
@@ -24,6 +76,14 @@ esp_err_t initializeCamera();
  */
 camera_fb_t* cameraCaptureImage();
 
+/**
+ * @brief Get the time the readout of a frame started, stamped by the driver.
+ * 
+ * @param frameBuffer Captured frame.
+ * @return int64_t Time in microseconds on the esp_timer clock.
+ */
+int64_t cameraFrameTimeUs(const camera_fb_t* frameBuffer);
+
 /**
  * @brief Release the frame buffer after processing the captured image.
  * 
@@ -31,4 +91,16 @@ camera_fb_t* cameraCaptureImage();
  */
 void cameraReleaseFrameBuffer(camera_fb_t* frameBuffer);
 
+/**
+ * @brief Put the sensor in power-down through PWDN and stop its clock.
+ * 
+ * The sensor keeps its registers, so cameraPowerUp() does not need a new initialization.
+ */
+void cameraPowerDown();
+
+/**
+ * @brief Wake the sensor from power-down and drop the frame captured before it.
+ */
+void cameraPowerUp();
+
 #endif // RETROLENS_CAMERA_UTILS_H
\ No newline at end of file
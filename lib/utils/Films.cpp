@@ -0,0 +1,43 @@
+#include <string.h>
+
+#include "Films.h"
+
+// The film of a card without a film stock file
+const char BUILTIN_FILM_STOCKS[] =
+    "[" TEST_FILM "]\n"
+    "capacity = 36\n"
+    "contrast = 20\n"
+    "saturation = 90\n";
+
+static FilmRegistry registry;
+static bool registryReady = false;
+
+FilmRegistry* getFilmRegistry() {
+    if (!registryReady) {
+        registry.parse(BUILTIN_FILM_STOCKS, strlen(BUILTIN_FILM_STOCKS));
+        registryReady = true;
+    }
+    return &registry;
+}
+
+bool isValidFilmType(const char* filmType) {
+    return getFilmRegistry()->find(filmType) >= 0;
+}
+
+int getFilmIndex(const char* filmType) {
+    return getFilmRegistry()->find(filmType);
+}
+
+const char* getFilmName(int filmIndex) {
+    const FilmStock* stock = getFilmRegistry()->getStock(filmIndex);
+    return stock != nullptr ? stock->name : nullptr;
+}
+
+int getFilmCapacity(int filmIndex) {
+    const FilmStock* stock = getFilmRegistry()->getStock(filmIndex);
+    return stock != nullptr ? stock->capacity : -1;
+}
+
+int getFilmCapacity(const char* filmType) {
+    return getFilmCapacity(getFilmIndex(filmType));
+}
@@ -1,20 +1,26 @@
 #ifndef RETROLENS_FILMS_H
 #define RETROLENS_FILMS_H
 
+#include "FilmRegistry.h"
+
 /**
  * @brief A test film type.
  */
 #define TEST_FILM "test_film"
 
 /**
- * @brief Array of available film types.
+ * @brief Film stocks built into the firmware, in the format of the film stock file.
  */
-extern char* FILM_TYPES[];
+extern const char BUILTIN_FILM_STOCKS[];
 
 /**
- * @brief Array of film capacities corresponding to each film type.
+ * @brief Get the registry of the film stocks.
+ *
+ * Holds the built-in stocks until the ones of the SD card are loaded into it.
+ * 
+ * @return FilmRegistry* The registry.
  */
-extern int FILM_CAPACITIES[];
+FilmRegistry* getFilmRegistry();
 
 /**
  * @brief Check if the given film type is valid.
@@ -32,6 +38,14 @@ bool isValidFilmType(const char* filmType);
  */
 int getFilmIndex(const char* filmType);
 
+/**
+ * @brief Get the name of the film at the given index.
+ * 
+ * @param filmIndex The index of the film.
+ * @return The name of the film, or nullptr if the index is invalid.
+ */
+const char* getFilmName(int filmIndex);
+
 /**
  * @brief Get the capacity of the film at the given index.
  * 
@@ -48,4 +62,4 @@ int getFilmCapacity(int filmIndex);
  */
 int getFilmCapacity(const char* filmType);
 
-#endif // RETROLENS_FILMS_H
\ No newline at end of file
+#endif // RETROLENS_FILMS_H
@@ -1,49 +1,251 @@
+#include <new>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
 #include "GlobalState.h"
 
-// Semaphores
-SemaphoreHandle_t GlobalState::screenPinsMutex;
-SemaphoreHandle_t GlobalState::batteryPinsMutex;
-SemaphoreHandle_t GlobalState::batteryAnalogPinsMutex;
+// Shared pins
+PinArbiter GlobalState::pinArbiter;
+int GlobalState::screenTicket = ARBITER_INVALID_TICKET;
+int GlobalState::batteryTicket = ARBITER_INVALID_TICKET;
+int GlobalState::sdCardTicket = ARBITER_INVALID_TICKET;
+int GlobalState::wifiTicket = ARBITER_INVALID_TICKET;
+
+// Event bus and worker pool
+EventBus GlobalState::eventBus;
+WorkerPool GlobalState::workerPool;
+
+// Image arena, reserved by its boot stage
+ImageArena GlobalState::imageArena(nullptr, 0);
 
 // Services
 ButtonService* GlobalState::buttonService;
 SaveService* GlobalState::saveService;
 BatteryReaderService* GlobalState::batteryReaderService;
+PowerService* GlobalState::powerService;
+StandbyService* GlobalState::standbyService;
+ZslService* GlobalState::zslService;
+FlashService* GlobalState::flashService;
+MeteringService* GlobalState::meteringService;
+RateService* GlobalState::rateService;
+StackService* GlobalState::stackService;
+DoubleExposureService* GlobalState::doubleExposureService;
+RawCaptureService* GlobalState::rawCaptureService;
+DevelopService* GlobalState::developService;
 ProgramService* GlobalState::programService;
 
+// Storage for the services, constructed in initialize() once the event bus and worker pool exist
+alignas(ButtonService) static uint8_t buttonServiceStorage[sizeof(ButtonService)];
+alignas(SaveService) static uint8_t saveServiceStorage[sizeof(SaveService)];
+alignas(BatteryReaderService) static uint8_t batteryReaderServiceStorage[sizeof(BatteryReaderService)];
+alignas(PowerService) static uint8_t powerServiceStorage[sizeof(PowerService)];
+alignas(StandbyService) static uint8_t standbyServiceStorage[sizeof(StandbyService)];
+alignas(ZslService) static uint8_t zslServiceStorage[sizeof(ZslService)];
+alignas(FlashService) static uint8_t flashServiceStorage[sizeof(FlashService)];
+alignas(MeteringService) static uint8_t meteringServiceStorage[sizeof(MeteringService)];
+alignas(RateService) static uint8_t rateServiceStorage[sizeof(RateService)];
+alignas(StackService) static uint8_t stackServiceStorage[sizeof(StackService)];
+alignas(DoubleExposureService) static uint8_t doubleExposureServiceStorage[sizeof(DoubleExposureService)];
+alignas(RawCaptureService) static uint8_t rawCaptureServiceStorage[sizeof(RawCaptureService)];
+alignas(DevelopService) static uint8_t developServiceStorage[sizeof(DevelopService)];
+alignas(ProgramService) static uint8_t programServiceStorage[sizeof(ProgramService)];
+
+// Boot stages, added to the boot graph in this order
+#define BOOT_STAGE_CAMERA 0
+#define BOOT_STAGE_SERVICES 1
+#define BOOT_STAGE_BUTTON 2
+#define BOOT_STAGE_POWER 3
+#define BOOT_STAGE_ZSL 4
+#define BOOT_STAGE_PROGRAM 5
+#define BOOT_STAGE_BATTERY 6
+#define BOOT_STAGE_FILM_CATALOG 7
+#define BOOT_STAGE_IMAGE_ARENA 8
+
+// Boot graph and the state shared by the stages
+BootGraph GlobalState::bootGraph;
+portMUX_TYPE GlobalState::bootLock = portMUX_INITIALIZER_UNLOCKED;
+SemaphoreHandle_t GlobalState::bootReadySemaphore;
+StaticSemaphore_t GlobalState::bootReadySemaphoreBuffer;
+bool GlobalState::resuming;
+StandbySettings GlobalState::resumeSettings;
+
 void GlobalState::initialize() {
     // Initialize serial communication
     Serial.begin(115200, SERIAL_8N1, NOT_CONNECTED_PIN, -1);
 
     pinMode(LAMP_PIN, OUTPUT);  // Set the lamp pin as output
 
-    // Create semaphores for shared resources
-    screenPinsMutex = xSemaphoreCreateMutex();
-    batteryPinsMutex = xSemaphoreCreateMutex();
-    batteryAnalogPinsMutex = xSemaphoreCreateMutex();
+    // Start the workers, they run the boot stages on both cores
+    workerPool.begin();
+
+    // The standby service tells whether this boot resumes from standby
+    GlobalState::standbyService = new (standbyServiceStorage) StandbyService();
+    resuming = standbyService->getResumeSettings(&resumeSettings);
+
+    // Stages needed for the first shot, the services start while the camera initializes
+    bootGraph.addStage("camera", 0, false);
+    bootGraph.addStage("services", 0, false);
+    bootGraph.addStage("button", BOOT_STAGE_MASK(BOOT_STAGE_SERVICES), false);
+    bootGraph.addStage("power", BOOT_STAGE_MASK(BOOT_STAGE_CAMERA) | BOOT_STAGE_MASK(BOOT_STAGE_SERVICES), false);
+    bootGraph.addStage("zsl", BOOT_STAGE_MASK(BOOT_STAGE_CAMERA) | BOOT_STAGE_MASK(BOOT_STAGE_SERVICES), false);
+    bootGraph.addStage("program", BOOT_STAGE_MASK(BOOT_STAGE_POWER) | BOOT_STAGE_MASK(BOOT_STAGE_ZSL), false);
 
-    // Check if semaphores were successfully created
-    if (screenPinsMutex == nullptr || batteryPinsMutex == nullptr) {
-        Serial.println("Failed to create semaphores!");
+    // Deferred until the camera can shoot
+    bootGraph.addStage("battery", BOOT_STAGE_MASK(BOOT_STAGE_SERVICES), true);
+    bootGraph.addStage("film-catalog", BOOT_STAGE_MASK(BOOT_STAGE_SERVICES), true);
+    bootGraph.addStage("image-arena", BOOT_STAGE_MASK(BOOT_STAGE_CAMERA) | BOOT_STAGE_MASK(BOOT_STAGE_SERVICES), true);
+
+    bootReadySemaphore = xSemaphoreCreateBinaryStatic(&bootReadySemaphoreBuffer);
+    portENTER_CRITICAL(&bootLock);
+    bootGraph.start(esp_timer_get_time());
+    uint32_t ready = bootGraph.takeReady();
+    portEXIT_CRITICAL(&bootLock);
+    submitBootStages(ready);
+
+    // Return once the camera can shoot, the deferred stages keep running
+    xSemaphoreTake(bootReadySemaphore, portMAX_DELAY);
+    unsigned long readyMs = (unsigned long) (bootGraph.getReadyTimeUs() / 1000);
+    Serial.printf("boot: ready to shoot in %lu ms, %lu ms after app start%s\n", readyMs,
+                  (unsigned long) (esp_timer_get_time() / 1000), readyMs > BOOT_READY_BUDGET_MS ? ", over budget" : "");
+}
+
+void GlobalState::submitBootStages(uint32_t stages) {
+    while (stages != 0) {
+        int stage = __builtin_ctz(stages);
+        stages &= stages - 1;
+        // Critical stages go to either worker, deferred ones stay in the background
+        uint8_t priority = bootGraph.getStage(stage)->deferred ? JOB_PRIORITY_BACKGROUND : JOB_PRIORITY_NORMAL;
+        if (!workerPool.submit(priority, bootStageJob, (void*) (intptr_t) stage)) {
+            // The queues are sized for the boot, this only happens if a stage floods them
+            Serial.printf("boot: could not submit stage %s\n", bootGraph.getStage(stage)->name);
+        }
     }
+}
+
+int GlobalState::bootStageJob(void* p) {
+    int stage = (int) (intptr_t) p;
+    portENTER_CRITICAL(&bootLock);
+    bootGraph.markStarted(stage, esp_timer_get_time());
+    portEXIT_CRITICAL(&bootLock);
+
+    runBootStage(stage);
 
-    // Initialize the camera
-    esp_err_t err = initializeCamera();
-    if (err != ESP_OK) {
-        Serial.println("Failed to initialize camera!");
+    portENTER_CRITICAL(&bootLock);
+    bool wasReady = bootGraph.isReady();
+    bootGraph.markDone(stage, esp_timer_get_time());
+    bool becameReady = !wasReady && bootGraph.isReady();
+    bool complete = bootGraph.isComplete();
+    uint32_t ready = bootGraph.takeReady();
+    portEXIT_CRITICAL(&bootLock);
+
+    submitBootStages(ready);
+    if (becameReady) {
+        xSemaphoreGive(bootReadySemaphore);
+    }
+    if (complete) {
+        logBoot();
+    }
+    return 0;
+}
+
+void GlobalState::runBootStage(int stage) {
+    switch (stage) {
+        case BOOT_STAGE_CAMERA: {
+            // Initialize the camera, as it was left before standby when resuming
+            esp_err_t err = initializeCamera(resuming ? &resumeSettings.sensor : nullptr);
+            if (err != ESP_OK) {
+                Serial.println("Failed to initialize camera!");
+            }
+            break;
+        }
+        case BOOT_STAGE_SERVICES:
+            // Initialize services in their static storage, no service memory comes from the heap
+            GlobalState::buttonService = new (buttonServiceStorage) ButtonService(SHUTTER_BUTTON_PIN, SHUTTER_BUTTON_ACTIVE, &eventBus);
+            GlobalState::saveService = new (saveServiceStorage) SaveService();
+            GlobalState::programService = new (programServiceStorage) ProgramService();
+            GlobalState::batteryReaderService = new (batteryReaderServiceStorage) BatteryReaderService(BATTERY_VOLTAGE_PIN, BATTERY_CONTROL_PIN);
+            GlobalState::powerService = new (powerServiceStorage) PowerService();
+            GlobalState::zslService = new (zslServiceStorage) ZslService();
+            GlobalState::flashService = new (flashServiceStorage) FlashService();
+            GlobalState::meteringService = new (meteringServiceStorage) MeteringService();
+            GlobalState::rateService = new (rateServiceStorage) RateService();
+            GlobalState::stackService = new (stackServiceStorage) StackService();
+            GlobalState::doubleExposureService = new (doubleExposureServiceStorage) DoubleExposureService();
+            GlobalState::rawCaptureService = new (rawCaptureServiceStorage) RawCaptureService();
+            GlobalState::developService = new (developServiceStorage) DevelopService();
+            if (resuming) {
+                saveService->setRollIndex(resumeSettings.rollIndex);
+                programService->setFlashOn(resumeSettings.flashOn != 0);
+                programService->resumeFromStandby();
+            }
+            break;
+        case BOOT_STAGE_BUTTON:
+            buttonService->begin();
+            if (resuming) {
+                buttonService->replayWakePress();
+            }
+            break;
+        case BOOT_STAGE_POWER:
+            // The sensor must be initialized, power management takes its locks as powered
+            powerService->begin();
+            break;
+        case BOOT_STAGE_PROGRAM:
+            programService->initProgram();
+            break;
+        case BOOT_STAGE_ZSL:
+            zslService->begin();
+            break;
+        case BOOT_STAGE_BATTERY:
+            // A resumed boot may be shooting, the battery waits for the first sampling period
+            batteryReaderService->begin(!resuming);
+            break;
+        case BOOT_STAGE_FILM_CATALOG:
+            // The shot after a wake needs the SD card first
+            if (!resuming) {
+                saveService->requestFilmStatus();
+            }
+            break;
+        case BOOT_STAGE_IMAGE_ARENA:
+            // The PSRAM left once the camera holds its frame buffers
+            reserveImageArena();
+            break;
+    }
+}
+
+void GlobalState::logBoot() {
+    uint64_t startUs = bootGraph.getStartUs();
+    for (int stage = 0; stage < bootGraph.getStageCount(); stage++) {
+        const BootStageInfo* info = bootGraph.getStage(stage);
+        Serial.printf("boot: %-12s %5lu ms +%lu ms%s\n", info->name, (unsigned long) ((info->startUs - startUs) / 1000),
+                      (unsigned long) ((info->endUs - info->startUs) / 1000), info->deferred ? " (deferred)" : "");
     }
+    Serial.printf("boot: ready to shoot %lu ms, stages one after the other %lu ms\n",
+                  (unsigned long) (bootGraph.getReadyTimeUs() / 1000), (unsigned long) (bootGraph.getSerialTimeUs() / 1000));
+}
 
-    // Initialize services
-    GlobalState::buttonService = new ButtonService(SHUTTER_BUTTON_PIN, SHUTTER_BUTTON_ACTIVE);
-    GlobalState::saveService = new SaveService();
-    GlobalState::programService = new ProgramService();
-    GlobalState::batteryReaderService = new BatteryReaderService(BATTERY_VOLTAGE_PIN, BATTERY_CONTROL_PIN);
+void GlobalState::reserveImageArena() {
+    // A stack needs the most, a double exposure makes do with less, a film shot with less still
+    size_t sizes[] = {StackService::requiredBytes(), DoubleExposureService::requiredBytes()};
+    for (size_t bytes : sizes) {
+        void* buffer = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (buffer != nullptr) {
+            imageArena = ImageArena(buffer, bytes);
+            Serial.printf("image-arena: %u KB of PSRAM reserved, stack %s, double exposure %s, film %s\n", (unsigned) (bytes / 1024),
+                          stackService->isAvailable() ? "on" : "off", doubleExposureService->isAvailable() ? "on" : "off",
+                          rawCaptureService->isAvailable() ? "on" : "off");
+            return;
+        }
+    }
+    Serial.printf("image-arena: could not reserve %u KB of PSRAM, stack, double exposure and film disabled\n",
+                  (unsigned) (sizes[1] / 1024));
+}
 
-    buttonService->begin();
-    programService->initProgram();
-    GlobalState::getBatteryReaderService()->startBatteryReadTask();
+EventBus* GlobalState::getEventBus() {
+    return &eventBus;
+}
 
-    GlobalState::getBatteryReaderService()->startBatteryReadTask();
+WorkerPool* GlobalState::getWorkerPool() {
+    return &workerPool;
 }
 
 ButtonService* GlobalState::getButtonService() {
@@ -58,44 +260,99 @@ BatteryReaderService* GlobalState::getBatteryReaderService() {
     return batteryReaderService;
 }
 
+PowerService* GlobalState::getPowerService() {
+    return powerService;
+}
+
+StandbyService* GlobalState::getStandbyService() {
+    return standbyService;
+}
+
+ZslService* GlobalState::getZslService() {
+    return zslService;
+}
+
+FlashService* GlobalState::getFlashService() {
+    return flashService;
+}
+
+MeteringService* GlobalState::getMeteringService() {
+    return meteringService;
+}
+
+RateService* GlobalState::getRateService() {
+    return rateService;
+}
+
+StackService* GlobalState::getStackService() {
+    return stackService;
+}
+
+DoubleExposureService* GlobalState::getDoubleExposureService() {
+    return doubleExposureService;
+}
+
+RawCaptureService* GlobalState::getRawCaptureService() {
+    return rawCaptureService;
+}
+
+DevelopService* GlobalState::getDevelopService() {
+    return developService;
+}
+
+ImageArena* GlobalState::getImageArena() {
+    return &imageArena;
+}
+
+ProgramService* GlobalState::getProgramService() {
+    return programService;
+}
+
+bool GlobalState::safelyTake(uint32_t resources, int* ticket, long timeout) {
+    int acquired = pinArbiter.acquire(resources, timeout);
+    if (acquired == ARBITER_INVALID_TICKET) {
+        return false;
+    }
+    *ticket = acquired;
+    return true;
+}
+
+void GlobalState::safelyFree(int* ticket) {
+    int held = *ticket;
+    *ticket = ARBITER_INVALID_TICKET;
+    pinArbiter.release(held);
+}
+
 bool GlobalState::safelyTakeScreen(long timeout) {
-    return xSemaphoreTake(screenPinsMutex, timeout);
+    return safelyTake(SCREEN_PINS, &screenTicket, timeout);
 }
 
 void GlobalState::safelyFreeScreen() {
-    xSemaphoreGive(screenPinsMutex);
+    safelyFree(&screenTicket);
 }
 
 bool GlobalState::safelyTakeBattery(long timeout) {
-    if (xSemaphoreTake(batteryAnalogPinsMutex, timeout) == pdTRUE) {
-        return xSemaphoreTake(batteryPinsMutex, timeout);
-    }
-    return false;
+    return safelyTake(BATTERY_PINS, &batteryTicket, timeout);
 }
 
 void GlobalState::safelyFreeBattery() {
-    xSemaphoreGive(batteryAnalogPinsMutex);
-    xSemaphoreGive(batteryPinsMutex);
+    safelyFree(&batteryTicket);
 }
 
 bool GlobalState::safelyTakeSdCard(long timeout) {
-    if (xSemaphoreTake(screenPinsMutex, timeout) == pdTRUE) {
-        return xSemaphoreTake(batteryPinsMutex, timeout);
-    }
-    return false;
+    return safelyTake(SD_CARD_PINS, &sdCardTicket, timeout);
 }
 
 void GlobalState::safelyFreeSdCard() {
-    xSemaphoreGive(batteryPinsMutex);
-    xSemaphoreGive(screenPinsMutex);
+    safelyFree(&sdCardTicket);
 }
 
 bool GlobalState::safelyTakeWifi(long timeout) {
-    return xSemaphoreTake(batteryAnalogPinsMutex, timeout);
+    return safelyTake(WIFI_PINS, &wifiTicket, timeout);
 }
 
 void GlobalState::safelyFreeWifi() {
-    xSemaphoreGive(batteryAnalogPinsMutex);
+    safelyFree(&wifiTicket);
 }
 
 void GlobalState::setFlashState(bool state) {
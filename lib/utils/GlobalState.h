@@ -5,81 +5,117 @@
 #include <freertos/semphr.h>
 
 #include "SystemConfig.h"
+#include "BootGraph.h"
 #include "CameraUtils.h"
+#include "EventBus.h"
+#include "WorkerPool.h"
+#include "PinArbiter.h"
 #include "ButtonService.h"
 #include "SaveService.h"
 #include "BatteryReaderService.h"
+#include "PowerService.h"
+#include "StandbyService.h"
+#include "ZslService.h"
+#include "FlashService.h"
+#include "MeteringService.h"
+#include "RateService.h"
+#include "StackService.h"
+#include "DoubleExposureService.h"
+#include "RawCaptureService.h"
+#include "DevelopService.h"
 #include "ProgramService.h"
 
+// Boot-to-ready-to-shoot time above which the boot log flags a regression
+#define BOOT_READY_BUDGET_MS 1000
+
 /**
  * @class GlobalState
  * @brief Manages global resources such as screen, battery, SD card, and WiFi. 
- *        Provides thread-safe access using semaphores.
+ *        Provides thread-safe access to the shared pins through a priority-aware arbiter.
  */
 class GlobalState {
 public:
     /**
-     * @brief Initializes global state resources such as semaphores and serial communication.
+     * @brief Initializes global state resources such as services and serial communication.
      * 
-     * Call this function once during the setup phase to initialize semaphores
+     * Call this function once during the setup phase to start the services
      * and set up the serial communication.
+     * 
+     * Startup is a graph of boot stages run as jobs on the worker pool, so independent stages
+     * run on both cores. It returns once the camera is ready to shoot, the battery and film
+     * catalog stages are deferred until then. Each stage is timestamped and the boot log
+     * reports the boot-to-ready-to-shoot time.
      */
     static void initialize();
 
     /**
-     * @brief Safely acquires the screen resource by taking the screen semaphore.
+     * @brief Safely acquires the screen pins.
      * 
-     * @param timeout Time (in ticks) to wait for the semaphore.
-     * @return true if the semaphore was successfully taken, false otherwise.
+     * @param timeout Time (in ticks) to wait for the pins.
+     * @return true if the pins were acquired, false otherwise.
      */
     static bool safelyTakeScreen(long timeout = portMAX_DELAY);
 
     /**
-     * @brief Releases the screen resource by giving back the screen semaphore.
+     * @brief Releases the screen pins.
      */
     static void safelyFreeScreen();
 
     /**
-     * @brief Safely acquires the battery resource by taking the battery semaphore.
+     * @brief Safely acquires the battery divider pins and the ADC.
      * 
-     * @param timeout Time (in ticks) to wait for the semaphore.
-     * @return true if the semaphore was successfully taken, false otherwise.
+     * @param timeout Time (in ticks) to wait for the pins.
+     * @return true if the pins were acquired, false otherwise.
      */
     static bool safelyTakeBattery(long timeout = portMAX_DELAY);
 
     /**
-     * @brief Releases the battery resource by giving back the battery semaphore.
+     * @brief Releases the battery pins.
      */
     static void safelyFreeBattery();
 
     /**
-     * @brief Safely acquires the SD card resource by taking both the screen and battery semaphores.
+     * @brief Safely acquires the SD card pins, shared with the screen and the battery.
      * 
-     * SD card access requires both screen and battery resources to be available.
+     * Every pin of the set is granted at once, or none on timeout.
      * 
-     * @param timeout Time (in ticks) to wait for the semaphores.
-     * @return true if both semaphores were successfully taken, false otherwise.
+     * @param timeout Time (in ticks) to wait for the pins.
+     * @return true if the pins were acquired, false otherwise.
      */
     static bool safelyTakeSdCard(long timeout = portMAX_DELAY);
 
     /**
-     * @brief Releases the SD card resource by giving back both the screen and battery semaphores.
+     * @brief Releases the SD card pins.
      */
     static void safelyFreeSdCard();
 
     /**
-     * @brief Safely acquires the WiFi resource by taking the battery semaphore.
+     * @brief Safely acquires the ADC shared by WiFi and the battery.
      * 
-     * @param timeout Time (in ticks) to wait for the semaphore.
-     * @return true if the semaphore was successfully taken, false otherwise.
+     * @param timeout Time (in ticks) to wait for the ADC.
+     * @return true if the ADC was acquired, false otherwise.
      */
     static bool safelyTakeWifi(long timeout = portMAX_DELAY);
 
     /**
-     * @brief Releases the WiFi resource by giving back the battery semaphore.
+     * @brief Releases the ADC shared by WiFi and the battery.
      */
     static void safelyFreeWifi();
 
+    /**
+     * @brief Get the Event Bus shared by all services.
+     * 
+     * @return EventBus* Pointer to the Event Bus object.
+     */
+    static EventBus* getEventBus();
+
+    /**
+     * @brief Get the Worker Pool that runs the service jobs.
+     * 
+     * @return WorkerPool* Pointer to the Worker Pool object.
+     */
+    static WorkerPool* getWorkerPool();
+
     /**
      * @brief Get the Button Service object.
      * 
@@ -101,6 +137,83 @@ public:
      */
     static BatteryReaderService* getBatteryReaderService();
 
+    /**
+     * @brief Get the Power Service object.
+     * 
+     * @return PowerService* Pointer to the Power Service object.
+     */
+    static PowerService* getPowerService();
+
+    /**
+     * @brief Get the Standby Service object.
+     * 
+     * @return StandbyService* Pointer to the Standby Service object.
+     */
+    static StandbyService* getStandbyService();
+
+    /**
+     * @brief Get the ZSL Service object.
+     * 
+     * @return ZslService* Pointer to the ZSL Service object.
+     */
+    static ZslService* getZslService();
+
+    /**
+     * @brief Get the Flash Service object.
+     * 
+     * @return FlashService* Pointer to the Flash Service object.
+     */
+    static FlashService* getFlashService();
+
+    /**
+     * @brief Get the Metering Service object.
+     * 
+     * @return MeteringService* Pointer to the Metering Service object.
+     */
+    static MeteringService* getMeteringService();
+
+    /**
+     * @brief Get the Rate Service object.
+     * 
+     * @return RateService* Pointer to the Rate Service object.
+     */
+    static RateService* getRateService();
+
+    /**
+     * @brief Get the Stack Service object.
+     * 
+     * @return StackService* Pointer to the Stack Service object.
+     */
+    static StackService* getStackService();
+
+    /**
+     * @brief Get the Double Exposure Service object.
+     * 
+     * @return DoubleExposureService* Pointer to the Double Exposure Service object.
+     */
+    static DoubleExposureService* getDoubleExposureService();
+
+    /**
+     * @brief Get the Raw Capture Service object.
+     * 
+     * @return RawCaptureService* Pointer to the Raw Capture Service object.
+     */
+    static RawCaptureService* getRawCaptureService();
+
+    /**
+     * @brief Get the Develop Service object.
+     * 
+     * @return DevelopService* Pointer to the Develop Service object.
+     */
+    static DevelopService* getDevelopService();
+
+    /**
+     * @brief Get the PSRAM arena shared by the stack, the double exposure and the film shots.
+     * 
+     * @return ImageArena* Pointer to the arena, of capacity 0 if no PSRAM could be reserved.
+     */
+    static ImageArena* getImageArena();
+
     /**
      * @brief Get the Program Service object.
      * 
@@ -116,14 +229,81 @@ public:
     static void setFlashState(bool state);
 
 private:
-    /// Semaphore for controlling access to the screen resource
-    static SemaphoreHandle_t screenPinsMutex;
+    /**
+     * @brief Acquire a pin set and keep its ticket.
+     * 
+     * @param resources Pin set, one of the *_PINS values.
+     * @param ticket Output ticket, the set conflicts with itself so one ticket per set is enough.
+     * @param timeout Time (in ticks) to wait.
+     * @return true if the pins were acquired, false otherwise.
+     */
+    static bool safelyTake(uint32_t resources, int* ticket, long timeout);
+
+    /**
+     * @brief Release a pin set acquired with safelyTake().
+     * 
+     * @param ticket Ticket of the set, reset to ARBITER_INVALID_TICKET.
+     */
+    static void safelyFree(int* ticket);
+
+    /**
+     * @brief Submit boot stages as jobs on the worker pool.
+     * 
+     * @param stages Mask of the stages taken from the boot graph.
+     */
+    static void submitBootStages(uint32_t stages);
 
-    /// Semaphore for controlling access to the battery resource
-    static SemaphoreHandle_t batteryPinsMutex;
+    /**
+     * @brief Job function that runs a boot stage and submits the stages it unblocks.
+     * 
+     * @param p Stage ID.
+     * @return int Always 0.
+     */
+    static int bootStageJob(void* p);
 
-    /// Semaphore for controlling analog battery pins
-    static SemaphoreHandle_t batteryAnalogPinsMutex;
+    /**
+     * @brief Run the work of a boot stage.
+     * 
+     * @param stage One of the BOOT_STAGE_* values.
+     */
+    static void runBootStage(int stage);
+
+    /**
+     * @brief Print the timestamps of every boot stage.
+     */
+    static void logBoot();
+
+    /**
+     * @brief Reserve the image arena beside the camera frame buffers, as large as a stack or else a double exposure.
+     */
+    static void reserveImageArena();
+
+    /// Dependency graph of the boot stages and its lock
+    static BootGraph bootGraph;
+    static portMUX_TYPE bootLock;
+
+    /// Given once the camera is ready to shoot
+    static SemaphoreHandle_t bootReadySemaphore;
+    static StaticSemaphore_t bootReadySemaphoreBuffer;
+
+    /// True if this boot resumes from standby, with the saved settings
+    static bool resuming;
+    static StandbySettings resumeSettings;
+
+    /// Arbiter of the pins shared by the screen, battery, SD card and WiFi
+    static PinArbiter pinArbiter;
+
+    /// Tickets of the held pin sets
+    static int screenTicket;
+    static int batteryTicket;
+    static int sdCardTicket;
+    static int wifiTicket;
+
+    /// Event bus shared by all services
+    static EventBus eventBus;
+
+    /// Worker pool shared by all services
+    static WorkerPool workerPool;
 
     /// Button service instance
     static ButtonService* buttonService;
@@ -134,6 +314,39 @@ private:
     /// Battery reader service instance
     static BatteryReaderService* batteryReaderService;
 
+    /// Power service instance
+    static PowerService* powerService;
+
+    /// Standby service instance
+    static StandbyService* standbyService;
+
+    /// Zero-shutter-lag service instance
+    static ZslService* zslService;
+
+    /// Flash service instance
+    static FlashService* flashService;
+
+    /// Metering service instance
+    static MeteringService* meteringService;
+
+    /// Rate service instance
+    static RateService* rateService;
+
+    /// Stack service instance
+    static StackService* stackService;
+
+    /// Double exposure service instance
+    static DoubleExposureService* doubleExposureService;
+
+    /// Raw capture service instance
+    static RawCaptureService* rawCaptureService;
+
+    /// Develop service instance
+    static DevelopService* developService;
+
+    /// PSRAM arena shared by the stack, the double exposure and the film shots, one runs at a time
+    static ImageArena imageArena;
+
     /// Program service instance
     static ProgramService* programService;
 };
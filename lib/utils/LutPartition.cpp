@@ -0,0 +1,51 @@
+#include <Arduino.h>
+#include <esp_partition.h>
+
+#include "ColorLut.h"
+#include "LutPartition.h"
+
+static const uint8_t* lutBlob = nullptr;
+static size_t lutBlobLength = 0;
+
+const uint8_t* mapLutPartition(size_t* length) {
+    if (lutBlob == nullptr) {
+        const esp_partition_t* partition =
+            esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t) LUT_PARTITION_SUBTYPE, LUT_PARTITION_LABEL);
+        ColorLutBlobHeader header;
+        if (partition == nullptr || esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK ||
+            header.magic != COLOR_LUT_MAGIC || header.version != COLOR_LUT_VERSION) {
+            Serial.printf("luts: no LUT partition\n");
+            *length = 0;
+            return nullptr;
+        }
+
+        // The blob ends with the nodes of its last LUT, only that much is mapped
+        size_t blobLength = sizeof(header) + header.count * sizeof(ColorLutBlobEntry);
+        for (int i = 0; i < header.count; i++) {
+            ColorLutBlobEntry entry;
+            if (esp_partition_read(partition, sizeof(header) + i * sizeof(entry), &entry, sizeof(entry)) != ESP_OK) {
+                *length = 0;
+                return nullptr;
+            }
+            size_t end = entry.offset + (size_t) entry.size * entry.size * entry.size * sizeof(uint32_t);
+            blobLength = end > blobLength ? end : blobLength;
+        }
+        if (blobLength > partition->size) {
+            blobLength = partition->size;
+        }
+
+        const void* mapped = nullptr;
+        spi_flash_mmap_handle_t handle;
+        if (esp_partition_mmap(partition, 0, blobLength, ESP_PARTITION_MMAP_DATA, &mapped, &handle) != ESP_OK) {
+            Serial.printf("luts: could not map %u bytes\n", (unsigned) blobLength);
+            *length = 0;
+            return nullptr;
+        }
+        lutBlob = static_cast<const uint8_t*>(mapped);
+        lutBlobLength = blobLength;
+        Serial.printf("luts: %u LUTs, %u KB mapped at 0x%08x\n", (unsigned) header.count, (unsigned) (blobLength / 1024),
+                      (unsigned) (uintptr_t) lutBlob);
+    }
+    *length = lutBlobLength;
+    return lutBlob;
+}
@@ -0,0 +1,31 @@
+#ifndef RETROLENS_LUT_PARTITION_H
+#define RETROLENS_LUT_PARTITION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Data partition of the color LUTs in partitions.csv, flashed with the blob of scripts/cube_to_lut.py
+#define LUT_PARTITION_LABEL "luts"
+#define LUT_PARTITION_SUBTYPE 0x40
+
+/**
+ * @brief Map the LUT blob of the flash partition into the data address space.
+ *
+ * Only the blob is mapped, read through the flash cache, nothing is copied to RAM. The mapping
+ * is made once and kept, later calls return the same one.
+ *
+ * Example usage:
+ * @code
+ * size_t length;
+ * const uint8_t* blob = mapLutPartition(&length);
+ * if (blob != nullptr && lut.load(blob, length, stock->name)) {
+ *     process.setColorLut(&lut);
+ * }
+ * @endcode
+ *
+ * @param length Set to the size of the blob.
+ * @return const uint8_t* Start of the blob, or nullptr without partition or with an empty one.
+ */
+const uint8_t* mapLutPartition(size_t* length);
+
+#endif // RETROLENS_LUT_PARTITION_H
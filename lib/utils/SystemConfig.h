@@ -7,6 +7,7 @@
 // Battery voltage pin and configuration
 #define BATTERY_VOLTAGE_PIN 2
 #define BATTERY_CONTROL_PIN 12
+#define BATTERY_DIVIDER_RATIO 2.0f // Battery voltage over the voltage at BATTERY_VOLTAGE_PIN
 
 // Shutter button pin and configuration
 #define SHUTTER_BUTTON_PIN 3
@@ -19,6 +20,17 @@
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
 
+// Pins shared between peripherals, granted by the pin arbiter of GlobalState
+#define PINS_SCREEN_BUS (1u << 0) // GPIO 13 and 15: screen I2C, SD card DATA3 and CMD
+#define PINS_BATTERY    (1u << 1) // GPIO 2 and 12: battery divider, SD card DATA0 and DATA2
+#define PINS_ADC2       (1u << 2) // ADC2 unit: battery voltage, unusable while WiFi runs
+
+// Pin sets of each peripheral
+#define SCREEN_PINS  PINS_SCREEN_BUS
+#define BATTERY_PINS (PINS_BATTERY | PINS_ADC2)
+#define SD_CARD_PINS (PINS_SCREEN_BUS | PINS_BATTERY)
+#define WIFI_PINS    PINS_ADC2
+
 // Not connected pin
 #define NOT_CONNECTED_PIN 20
 
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+import os
+import re
+import argparse
+from PIL import Image
+
+# Runs of one byte are coded from this length on, shorter ones stay in literals
+MIN_RUN = 2
+MAX_RUN = 129
+MAX_LITERAL = 128
+
+def page_bytes(img):
+    # SSD1306 page order: 8 rows a page, a byte a column, the top row in bit 0, pages from the top
+    width, height = img.size
+    pixels = img.load()
+    data = []
+    for page in range(0, height, 8):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                y = page + bit
+                if y < height and pixels[x, y] != 0:
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+def rle_encode(data):
+    # Control byte: 0..127 for that many plus one literal bytes, 128..255 for a run of one byte, 2..129 long
+    out = []
+    literals = []
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < MAX_RUN:
+            run += 1
+        if run >= MIN_RUN:
+            if literals:
+                out += [len(literals) - 1] + literals
+                literals = []
+            out += [0x80 + run - MIN_RUN, data[i]]
+            i += run
+        else:
+            literals.append(data[i])
+            if len(literals) == MAX_LITERAL:
+                out += [len(literals) - 1] + literals
+                literals = []
+            i += 1
+    if literals:
+        out += [len(literals) - 1] + literals
+    return out
+
+def rle_decode(data, length):
+    out = []
+    i = 0
+    while len(out) < length:
+        control = data[i]
+        if control < 0x80:
+            out += data[i + 1:i + 2 + control]
+            i += 2 + control
+        else:
+            out += [data[i + 1]] * (control - 0x80 + MIN_RUN)
+            i += 2
+    return out
+
+def format_array(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(f"0x{v:02x}" for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+def generate_atlas_from_folder(folder_path, output_name, output_folder):
+    # Ensure the output folder exists
+    os.makedirs(output_folder, exist_ok=True)
+
+    # Every image of the folder, subfolders hold other assets
+    image_files = sorted(f for f in os.listdir(folder_path) if f.endswith(".png"))
+
+    atlas = []
+    sprites = []
+    raw_bytes = 0
+    for image_file in image_files:
+        # 1-bit, lit where the pixel is white
+        img = Image.open(os.path.join(folder_path, image_file)).convert("1")
+        width, height = img.size
+        if width > 255 or height > 255:
+            raise ValueError(f"{image_file}: sprites are at most 255x255")
+        data = page_bytes(img)
+        coded = rle_encode(data)
+        assert rle_decode(coded, len(data)) == data
+        name = os.path.splitext(image_file)[0].upper()
+        sprites.append((name, width, height, len(atlas)))
+        atlas += coded
+        raw_bytes += (width + 7) // 8 * height
+
+    # UiSprites is named UI_SPRITES in code
+    symbol = re.sub(r"(?<=[a-z0-9])(?=[A-Z])", "_", output_name).upper()
+
+    header_content = f"#ifndef {output_name.upper()}_H\n#define {output_name.upper()}_H\n\n"
+    header_content += '#include "SpriteAtlas.h"\n\n'
+    for index, (name, width, height, offset) in enumerate(sprites):
+        header_content += f"#define SPRITE_{name} {index} // {width}x{height}\n"
+    header_content += f"#define SPRITE_COUNT {len(sprites)}\n\n"
+    header_content += f"extern const SpriteAtlas {symbol};\n\n"
+
+    c_content = f'#include "{output_name}.h"\n\n'
+    c_content += f"// {len(atlas)} bytes of RLE pages, {raw_bytes} bytes as XBM\n"
+    c_content += f"static const uint8_t {symbol}_DATA[] = {{\n{format_array(atlas)}\n}};\n"
+    c_content += f"static const Sprite {symbol}_SPRITES[] = {{\n"
+    for name, width, height, offset in sprites:
+        c_content += f"    {{{width}, {height}, {offset}}}, // {name}\n"
+    c_content += "};\n"
+    c_content += f"const SpriteAtlas {symbol} = {{{symbol}_DATA, {symbol}_SPRITES, {len(sprites)}}};\n"
+
+    # Finalize the header content
+    header_content += f"#endif  // {output_name.upper()}_H\n"
+
+    header_file_path = os.path.join(output_folder, f"{output_name}.h")
+    c_file_path = os.path.join(output_folder, f"{output_name}.c")
+
+    with open(header_file_path, "w") as h_file:
+        h_file.write(header_content.strip())
+
+    with open(c_file_path, "w") as c_file:
+        c_file.write(c_content.strip())
+
+    print(f"Generated {output_name}.h and {output_name}.c in folder '{output_folder}', {len(atlas)} bytes "
+          f"instead of {raw_bytes}, successfully.")
+
+if __name__ == "__main__":
+    # Create argument parser
+    parser = argparse.ArgumentParser(description="Pack the UI images in a folder into an RLE sprite atlas in SSD1306 page order")
+
+    # Add folder argument
+    parser.add_argument("folder", help="Path to the folder containing images")
+
+    # Add output name argument
+    parser.add_argument("output_name", help="Base name for the output files")
+
+    # Add output folder argument
+    parser.add_argument("output_folder", help="Path to the folder to save the output files")
+
+    # Parse the arguments
+    args = parser.parse_args()
+
+    # Pack the images in the folder
+    generate_atlas_from_folder(args.folder, args.output_name, args.output_folder)
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+import os
+import math
+import argparse
+from PIL import Image
+
+# The border tiles are coded for 4:2:2 MCUs, the sampling of the camera frames
+MCU_WIDTH = 16
+MCU_HEIGHT = 8
+
+def rgb_to_ycc(pixel):
+    # JFIF conversion, the one the decoder inverts
+    r, g, b = pixel[:3]
+    y = 0.299 * r + 0.587 * g + 0.114 * b
+    cb = 128 - 0.168736 * r - 0.331264 * g + 0.5 * b
+    cr = 128 + 0.5 * r - 0.418688 * g - 0.081312 * b
+    return y, cb, cr
+
+def forward_dct(samples):
+    # Orthonormal 8x8 DCT of level shifted samples, natural order, the scale the quantizer expects
+    coefficients = []
+    for v in range(8):
+        for u in range(8):
+            cu = math.sqrt(0.5) if u == 0 else 1.0
+            cv = math.sqrt(0.5) if v == 0 else 1.0
+            total = 0.0
+            for y in range(8):
+                for x in range(8):
+                    total += (samples[y][x] - 128) * math.cos((2 * x + 1) * u * math.pi / 16) * math.cos((2 * y + 1) * v * math.pi / 16)
+            coefficients.append(int(round(total * cu * cv / 4)))
+    return coefficients
+
+def code_block(coefficients):
+    # Count of AC coefficients, the DC, then index and value of each AC that is not zero
+    ac = [(i, c) for i, c in enumerate(coefficients) if i > 0 and c != 0]
+    values = [len(ac), coefficients[0]]
+    for index, value in ac:
+        values += [index, value]
+    return values
+
+def code_tile(img):
+    width, height = img.size
+    pixels = img.load()
+    ycc = [[rgb_to_ycc(pixels[x, y]) for x in range(width)] for y in range(height)]
+
+    offsets = []
+    values = []
+    for mcu_y in range(0, height, MCU_HEIGHT):
+        for mcu_x in range(0, width, MCU_WIDTH):
+            offsets.append(len(values))
+            # Two luma blocks, then one block of each chroma averaged over pairs of pixels
+            for block_x in range(0, MCU_WIDTH, 8):
+                samples = [[ycc[mcu_y + y][mcu_x + block_x + x][0] for x in range(8)] for y in range(8)]
+                values += code_block(forward_dct(samples))
+            for component in (1, 2):
+                samples = [[(ycc[mcu_y + y][mcu_x + 2 * x][component] + ycc[mcu_y + y][mcu_x + 2 * x + 1][component]) / 2
+                            for x in range(8)] for y in range(8)]
+                values += code_block(forward_dct(samples))
+    return offsets, values
+
+def format_array(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+def generate_tiles_from_folder(folder_path, output_name, output_folder):
+    # Ensure the output folder exists
+    os.makedirs(output_folder, exist_ok=True)
+
+    # List the artwork, a .txt next to an image lists the characters of a font
+    image_files = sorted(f for f in os.listdir(folder_path) if f.endswith(".png"))
+
+    header_content = f"#ifndef {output_name.upper()}_H\n#define {output_name.upper()}_H\n\n"
+    header_content += '#include "BorderTile.h"\n\n'
+    c_content = f'#include "{output_name}.h"\n\n'
+
+    for image_file in image_files:
+        image_path = os.path.join(folder_path, image_file)
+        img = Image.open(image_path).convert("RGB")
+
+        # Tiles are whole MCUs, the artwork is padded with the color of its bottom-right corner
+        width, height = img.size
+        if width % MCU_WIDTH != 0 or height % MCU_HEIGHT != 0:
+            padded = Image.new("RGB", ((width + MCU_WIDTH - 1) // MCU_WIDTH * MCU_WIDTH,
+                                       (height + MCU_HEIGHT - 1) // MCU_HEIGHT * MCU_HEIGHT), img.getpixel((width - 1, height - 1)))
+            padded.paste(img, (0, 0))
+            img = padded
+            width, height = img.size
+
+        base_name = os.path.splitext(image_file)[0].upper()
+        offsets, values = code_tile(img)
+
+        header_content += f"extern const BorderTile {base_name}_BORDER_TILE;\n"
+        c_content += f"static const uint32_t {base_name}_BORDER_MCUS[] = {{\n{format_array(offsets)}\n}};\n"
+        c_content += f"static const int16_t {base_name}_BORDER_COEFFICIENTS[] = {{\n{format_array(values)}\n}};\n"
+        c_content += (f"const BorderTile {base_name}_BORDER_TILE = {{{width}, {height}, {base_name}_BORDER_MCUS, "
+                      f"{base_name}_BORDER_COEFFICIENTS}};\n")
+
+        characters_path = os.path.splitext(image_path)[0] + ".txt"
+        if os.path.isfile(characters_path):
+            with open(characters_path) as characters_file:
+                characters = characters_file.read().strip().replace("\\", "\\\\").replace('"', '\\"')
+            header_content += f"extern const char {base_name}_BORDER_CHARACTERS[];\n"
+            c_content += f'const char {base_name}_BORDER_CHARACTERS[] = "{characters}";\n'
+        header_content += "\n"
+        c_content += "\n"
+
+    # Finalize the header content
+    header_content += f"#endif  // {output_name.upper()}_H\n"
+
+    header_file_path = os.path.join(output_folder, f"{output_name}.h")
+    c_file_path = os.path.join(output_folder, f"{output_name}.c")
+
+    with open(header_file_path, "w") as h_file:
+        h_file.write(header_content.strip())
+
+    with open(c_file_path, "w") as c_file:
+        c_file.write(c_content.strip())
+
+    print(f"Generated {output_name}.h and {output_name}.c in folder '{output_folder}' successfully.")
+
+if __name__ == "__main__":
+    # Create argument parser
+    parser = argparse.ArgumentParser(description="Generate DCT coefficient tiles of border artwork in a folder")
+
+    # Add folder argument
+    parser.add_argument("folder", help="Path to the folder containing the border artwork")
+
+    # Add output name argument
+    parser.add_argument("output_name", help="Base name for the output files")
+
+    # Add output folder argument
+    parser.add_argument("output_folder", help="Path to the folder to save the output files")
+
+    # Parse the arguments
+    args = parser.parse_args()
+
+    # Generate the tiles of the artwork in the folder
+    generate_tiles_from_folder(args.folder, args.output_name, args.output_folder)
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+import os
+import struct
+import argparse
+
+# Blob layout read by lib/imaging/ColorLut, little endian
+LUT_MAGIC = 0x54554C52
+LUT_VERSION = 1
+NAME_BYTES = 24
+NODE_BITS = 10
+
+# Grid sizes on the camera: small cubes keep 17 nodes, finer ones get 33
+SMALL_SIZE = 17
+LARGE_SIZE = 33
+
+def parse_cube(path):
+    # Adobe .cube 3D LUT, red changes fastest in the table
+    size = 0
+    domain_min = [0.0, 0.0, 0.0]
+    domain_max = [1.0, 1.0, 1.0]
+    table = []
+    with open(path) as cube_file:
+        for line in cube_file:
+            words = line.split("#")[0].split()
+            if not words or words[0] == "TITLE":
+                continue
+            if words[0] == "LUT_3D_SIZE":
+                size = int(words[1])
+            elif words[0] == "DOMAIN_MIN":
+                domain_min = [float(w) for w in words[1:4]]
+            elif words[0] == "DOMAIN_MAX":
+                domain_max = [float(w) for w in words[1:4]]
+            elif words[0] == "LUT_1D_SIZE":
+                raise ValueError(f"{path}: 1D LUTs are not supported")
+            elif words[0][0].isdigit() or words[0][0] in "-.":
+                table.append([float(w) for w in words[:3]])
+    if size < 2 or len(table) != size ** 3:
+        raise ValueError(f"{path}: expected {size ** 3} entries of a {size}^3 LUT, found {len(table)}")
+    return size, domain_min, domain_max, table
+
+def sample_cube(cube, rgb):
+    # Trilinear lookup of an RGB color in 0..1, the result in 0..1
+    size, domain_min, domain_max, table = cube
+    index = []
+    fraction = []
+    for c in range(3):
+        position = (rgb[c] - domain_min[c]) / (domain_max[c] - domain_min[c]) * (size - 1)
+        position = min(max(position, 0.0), size - 1.0)
+        low = min(int(position), size - 2)
+        index.append(low)
+        fraction.append(position - low)
+    result = [0.0, 0.0, 0.0]
+    for corner in range(8):
+        dr, dg, db = corner & 1, (corner >> 1) & 1, (corner >> 2) & 1
+        weight = ((fraction[0] if dr else 1 - fraction[0]) * (fraction[1] if dg else 1 - fraction[1]) *
+                  (fraction[2] if db else 1 - fraction[2]))
+        if weight == 0:
+            continue
+        entry = table[((index[2] + db) * size + index[1] + dg) * size + index[0] + dr]
+        for c in range(3):
+            result[c] += weight * entry[c]
+    return result
+
+def ycc_to_rgb(y, cb, cr):
+    # JFIF conversion, the one the decoder uses, clamped like the decoder
+    r = y + 1.402 * (cr - 128)
+    g = y - 0.344136 * (cb - 128) - 0.714136 * (cr - 128)
+    b = y + 1.772 * (cb - 128)
+    return [min(max(v, 0.0), 255.0) / 255.0 for v in (r, g, b)]
+
+def rgb_to_ycc(rgb):
+    r, g, b = (v * 255.0 for v in rgb)
+    y = 0.299 * r + 0.587 * g + 0.114 * b
+    cb = 128 - 0.168736 * r - 0.331264 * g + 0.5 * b
+    cr = 128 + 0.5 * r - 0.418688 * g - 0.081312 * b
+    return y, cb, cr
+
+def resample(cube, grid):
+    # Nodes over Y, Cb and Cr, Y fastest, each component in 1/4 packed in 10 bits
+    nodes = []
+    step = 255.0 / (grid - 1)
+    for cr_index in range(grid):
+        for cb_index in range(grid):
+            for y_index in range(grid):
+                rgb = ycc_to_rgb(y_index * step, cb_index * step, cr_index * step)
+                ycc = rgb_to_ycc(sample_cube(cube, rgb))
+                packed = 0
+                for c in range(3):
+                    value = min(max(int(round(ycc[c] * 4)), 0), 255 * 4)
+                    packed |= value << (c * NODE_BITS)
+                nodes.append(packed)
+    return nodes
+
+def generate_blob_from_folder(folder_path, output_path):
+    cube_files = sorted(f for f in os.listdir(folder_path) if f.endswith(".cube"))
+
+    entries = []
+    for cube_file in cube_files:
+        name = os.path.splitext(cube_file)[0]
+        if len(name.encode()) >= NAME_BYTES:
+            raise ValueError(f"{cube_file}: name longer than {NAME_BYTES - 1} characters")
+        cube = parse_cube(os.path.join(folder_path, cube_file))
+        grid = SMALL_SIZE if cube[0] <= SMALL_SIZE else LARGE_SIZE
+        entries.append((name, grid, resample(cube, grid)))
+
+    # Header, entries, then the nodes of each LUT, all 4 byte aligned
+    offset = 8 + 32 * len(entries)
+    blob = struct.pack("<IHH", LUT_MAGIC, LUT_VERSION, len(entries))
+    for name, grid, nodes in entries:
+        blob += struct.pack(f"<{NAME_BYTES}sHHI", name.encode(), grid, 0, offset)
+        offset += 4 * len(nodes)
+    for name, grid, nodes in entries:
+        blob += struct.pack(f"<{len(nodes)}I", *nodes)
+
+    os.makedirs(os.path.dirname(output_path) or ".", exist_ok=True)
+    with open(output_path, "wb") as blob_file:
+        blob_file.write(blob)
+
+    print(f"Generated {output_path} with {len(entries)} LUTs, {len(blob)} bytes successfully.")
+
+if __name__ == "__main__":
+    # Create argument parser
+    parser = argparse.ArgumentParser(description="Pack the .cube color LUTs in a folder into a LUT partition image")
+
+    # Add folder argument
+    parser.add_argument("folder", help="Path to the folder containing the .cube files")
+
+    # Add output argument
+    parser.add_argument("output", help="Path of the partition image to write")
+
+    # Parse the arguments
+    args = parser.parse_args()
+
+    # Pack the LUTs in the folder
+    generate_blob_from_folder(args.folder, args.output)
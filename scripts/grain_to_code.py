@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+import os
+import math
+import random
+import argparse
+
+# Luma values of each step of the response, as lib/imaging/FilmGrain reads it
+RESPONSE_STEPS = 16
+
+def read_stock(path):
+    # One "key value..." per line, # starts a comment
+    stock = {}
+    with open(path) as stock_file:
+        for line in stock_file:
+            words = line.split("#")[0].split()
+            if words:
+                stock[words[0]] = words[1:]
+    size = int(stock["size"][0])
+    response = [int(w) for w in stock["response"]]
+    if size < 8 or size & (size - 1) != 0:
+        raise ValueError(f"{path}: size must be a power of two, at least 8")
+    if len(response) != RESPONSE_STEPS:
+        raise ValueError(f"{path}: response needs {RESPONSE_STEPS} values")
+    return size, float(stock["sigma"][0]), int(stock["seed"][0]), int(stock["strength"][0]), response
+
+def blue_noise_ranks(size, sigma, seed):
+    # Void-and-cluster: the rank of each pixel in an ordering where every prefix is evenly spread
+    count = size * size
+    radius = int(math.ceil(3 * sigma))
+    kernel = [(dx, dy, math.exp(-(dx * dx + dy * dy) / (2 * sigma * sigma)))
+              for dy in range(-radius, radius + 1) for dx in range(-radius, radius + 1)]
+    pattern = [False] * count
+    energy = [0.0] * count
+
+    def toggle(index, sign):
+        # Energy of a pixel is the Gaussian-weighted count of the set pixels around it, on a torus
+        x, y = index % size, index // size
+        pattern[index] = sign > 0
+        for dx, dy, weight in kernel:
+            energy[(y + dy) % size * size + (x + dx) % size] += sign * weight
+
+    def tightest_cluster():
+        return max((i for i in range(count) if pattern[i]), key=energy.__getitem__)
+
+    def largest_void():
+        return min((i for i in range(count) if not pattern[i]), key=energy.__getitem__)
+
+    # Initial pattern: a tenth of the pixels at random, moved until it is evenly spread
+    generator = random.Random(seed)
+    for index in generator.sample(range(count), count // 10):
+        toggle(index, 1)
+    while True:
+        cluster = tightest_cluster()
+        toggle(cluster, -1)
+        void = largest_void()
+        toggle(void, 1)
+        if void == cluster:
+            break
+    prototype = (pattern[:], energy[:])
+    ones = sum(pattern)
+
+    ranks = [0] * count
+    # Phase 1: the set pixels are ranked from the tightest cluster down
+    for rank in range(ones - 1, -1, -1):
+        cluster = tightest_cluster()
+        toggle(cluster, -1)
+        ranks[cluster] = rank
+    # Phase 2: the rest, filling the largest void up
+    pattern[:], energy[:] = prototype
+    for rank in range(ones, count):
+        void = largest_void()
+        toggle(void, 1)
+        ranks[void] = rank
+    return ranks
+
+def format_array(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+def generate_tiles_from_folder(folder_path, output_name, output_folder):
+    # Ensure the output folder exists
+    os.makedirs(output_folder, exist_ok=True)
+
+    # One film stock a file, named after its film
+    stock_files = sorted(f for f in os.listdir(folder_path) if f.endswith(".txt"))
+
+    header_content = f"#ifndef {output_name.upper()}_H\n#define {output_name.upper()}_H\n\n"
+    header_content += '#include "GrainTile.h"\n\n'
+    header_content += '#ifdef __cplusplus\nextern "C" {\n#endif\n\n'
+    c_content = f'#include <string.h>\n\n#include "{output_name}.h"\n\n'
+    entries = []
+
+    for stock_file in stock_files:
+        size, sigma, seed, strength, response = read_stock(os.path.join(folder_path, stock_file))
+        ranks = blue_noise_ranks(size, sigma, seed)
+
+        # Ranks spread evenly over -127..127, zero mean
+        count = size * size
+        noise = [int(round(((rank + 0.5) / count * 2 - 1) * 127)) for rank in ranks]
+
+        base_name = os.path.splitext(stock_file)[0].upper()
+        header_content += f"extern const GrainTile {base_name}_GRAIN_TILE;\n\n"
+        c_content += f"static const int8_t {base_name}_GRAIN_NOISE[] = {{\n{format_array(noise)}\n}};\n"
+        c_content += f"static const uint8_t {base_name}_GRAIN_RESPONSE[] = {{\n{format_array(response)}\n}};\n"
+        c_content += (f"const GrainTile {base_name}_GRAIN_TILE = {{{size}, {strength}, {base_name}_GRAIN_RESPONSE, "
+                      f"{base_name}_GRAIN_NOISE}};\n\n")
+        entries.append(f'    {{"{os.path.splitext(stock_file)[0]}", &{base_name}_GRAIN_TILE}},')
+
+    # The tiles by film name, for the stocks of the film stock file
+    header_content += f"#define GRAIN_TILE_COUNT {len(entries)}\n\n"
+    header_content += "extern const GrainTileEntry GRAIN_TILES[GRAIN_TILE_COUNT];\n\n"
+    header_content += "// Tile of a film by its name, NULL if the film has no grain file\n"
+    header_content += "const GrainTile* findGrainTile(const char* name);\n\n"
+    c_content += "const GrainTileEntry GRAIN_TILES[GRAIN_TILE_COUNT] = {\n" + "\n".join(entries) + "\n};\n\n"
+    c_content += ("const GrainTile* findGrainTile(const char* name) {\n"
+                  "    for (int i = 0; name != NULL && i < GRAIN_TILE_COUNT; i++) {\n"
+                  "        if (strcmp(GRAIN_TILES[i].name, name) == 0) {\n"
+                  "            return GRAIN_TILES[i].tile;\n"
+                  "        }\n"
+                  "    }\n"
+                  "    return NULL;\n"
+                  "}\n")
+
+    # Finalize the header content
+    header_content += '#ifdef __cplusplus\n}\n#endif\n\n'
+    header_content += f"#endif  // {output_name.upper()}_H\n"
+
+    header_file_path = os.path.join(output_folder, f"{output_name}.h")
+    c_file_path = os.path.join(output_folder, f"{output_name}.c")
+
+    with open(header_file_path, "w") as h_file:
+        h_file.write(header_content.strip())
+
+    with open(c_file_path, "w") as c_file:
+        c_file.write(c_content.strip())
+
+    print(f"Generated {output_name}.h and {output_name}.c in folder '{output_folder}' successfully.")
+
+if __name__ == "__main__":
+    # Create argument parser
+    parser = argparse.ArgumentParser(description="Generate blue-noise grain tiles of the film stocks in a folder")
+
+    # Add folder argument
+    parser.add_argument("folder", help="Path to the folder containing the film stock grain files")
+
+    # Add output name argument
+    parser.add_argument("output_name", help="Base name for the output files")
+
+    # Add output folder argument
+    parser.add_argument("output_folder", help="Path to the folder to save the output files")
+
+    # Parse the arguments
+    args = parser.parse_args()
+
+    # Generate the tiles of the film stocks in the folder
+    generate_tiles_from_folder(args.folder, args.output_name, args.output_folder)
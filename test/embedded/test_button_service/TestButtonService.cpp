@@ -4,15 +4,15 @@
 
 class TestButtonService : public ButtonService {
 public:
-    TestButtonService(int buttonPin, int buttonActive) : ButtonService(buttonPin, buttonActive) {}
+    TestButtonService(int buttonPin, int buttonActive, EventBus* eventBus) : ButtonService(buttonPin, buttonActive, eventBus) {}
     
     void wrappedHandleButtonUp() {
-        int value = HIGH;
-        xQueueSend(buttonEventQueue, &value, 0);
+        ButtonEdge edge = {HIGH, (uint32_t) millis()};
+        xQueueSend(buttonEventQueue, &edge, 0);
     }
     void wrappedHandleButtonDown() {
-        int value = LOW;
-        xQueueSend(buttonEventQueue, &value, 0);
+        ButtonEdge edge = {LOW, (uint32_t) millis()};
+        xQueueSend(buttonEventQueue, &edge, 0);
     }
 };
 
@@ -27,12 +27,14 @@ void tearDown(void) {
 volatile bool buttonPressed = false;
 volatile bool buttonReleased = false;
 
+EventBus eventBus;
+int buttonSubscriber;
+
 void buttonListeningTask(void *pvParameters) {
-    int buttonEvent;
-    QueueHandle_t queue = (QueueHandle_t) pvParameters;
+    Event event;
     while (1) {
-        if (xQueueReceive(queue, &buttonEvent, portMAX_DELAY)) {
-            if (buttonEvent == HIGH) {
+        if (eventBus.receive(buttonSubscriber, &event, portMAX_DELAY)) {
+            if (event.payload.button == HIGH) {
                 buttonPressed = true;
             } else {
                 buttonReleased = true;
@@ -41,20 +43,15 @@ void buttonListeningTask(void *pvParameters) {
     }
 }
 
-QueueHandle_t buttonEventQueue;
-
 void testButtonService() {
     // Create a button service object
-    TestButtonService testButtonService(2, LOW);
-    
-    // Create a queue to receive button events
-    buttonEventQueue = xQueueCreate(10, sizeof(int));
+    TestButtonService testButtonService(2, LOW, &eventBus);
 
     // Subscribe to button events
-    testButtonService.subscribe(buttonEventQueue);
+    buttonSubscriber = eventBus.subscribe(EVENT_MASK(EVENT_BUTTON));
 
     // Create a task to process button events
-    xTaskCreate(buttonListeningTask, "Button Listener", 2048, (void *) buttonEventQueue, 1, NULL);
+    xTaskCreate(buttonListeningTask, "Button Listener", 2048, NULL, 1, NULL);
 
     // Simulate a button press
     testButtonService.wrappedHandleButtonUp();
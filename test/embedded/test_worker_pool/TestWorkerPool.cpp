@@ -0,0 +1,108 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <esp_timer.h>
+#include <WorkerPool.h>
+
+#define DISPATCH_SAMPLES 200
+
+static WorkerPool workerPool;
+
+// Time of the last submission or task creation, and time the work started
+static volatile int64_t dispatchStartUs;
+static volatile int64_t dispatchEndUs;
+static SemaphoreHandle_t taskDoneSemaphore;
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+static int timestampJob(void* arg) {
+    dispatchEndUs = esp_timer_get_time();
+    return (int) (intptr_t) arg;
+}
+
+static void timestampTask(void* p) {
+    dispatchEndUs = esp_timer_get_time();
+    xSemaphoreGive(taskDoneSemaphore);
+    vTaskDelete(NULL);
+}
+
+void testFutureReturnsResult() {
+    JobFuture future;
+    TEST_ASSERT_TRUE(workerPool.submit(JOB_PRIORITY_NORMAL, timestampJob, (void*) 42, &future));
+    int result = 0;
+    TEST_ASSERT_TRUE(future.wait(&result, pdMS_TO_TICKS(1000)));
+    TEST_ASSERT_EQUAL_INT(42, result);
+}
+
+static volatile int order[2];
+static volatile int orderCount;
+
+static int slowBackgroundJob(void* arg) {
+    delay(50);
+    order[orderCount++] = 0;
+    return 0;
+}
+
+static int shutterJob(void* arg) {
+    order[orderCount++] = 1;
+    return 0;
+}
+
+void testShutterJobDoesNotWaitForBackgroundJob() {
+    orderCount = 0;
+    JobFuture background;
+    JobFuture shutter;
+    workerPool.submit(JOB_PRIORITY_BACKGROUND, slowBackgroundJob, nullptr, &background);
+    delay(5);
+    workerPool.submit(JOB_PRIORITY_SHUTTER, shutterJob, nullptr, &shutter);
+
+    TEST_ASSERT_TRUE(shutter.wait(nullptr, pdMS_TO_TICKS(1000)));
+    TEST_ASSERT_TRUE(background.wait(nullptr, pdMS_TO_TICKS(1000)));
+    TEST_ASSERT_EQUAL_INT(1, order[0]);
+    TEST_ASSERT_EQUAL_INT(0, order[1]);
+}
+
+void testDispatchLatencyAgainstTaskCreation() {
+    JobFuture future;
+    int64_t jobTotalUs = 0;
+    for (int i = 0; i < DISPATCH_SAMPLES; i++) {
+        dispatchStartUs = esp_timer_get_time();
+        workerPool.submit(JOB_PRIORITY_SHUTTER, timestampJob, nullptr, &future);
+        future.wait(nullptr, portMAX_DELAY);
+        jobTotalUs += dispatchEndUs - dispatchStartUs;
+    }
+
+    int64_t taskTotalUs = 0;
+    for (int i = 0; i < DISPATCH_SAMPLES; i++) {
+        dispatchStartUs = esp_timer_get_time();
+        xTaskCreatePinnedToCore(timestampTask, "Timestamp", 4096, NULL, WORKER_FOREGROUND_TASK_PRIORITY, NULL, 1);
+        xSemaphoreTake(taskDoneSemaphore, portMAX_DELAY);
+        taskTotalUs += dispatchEndUs - dispatchStartUs;
+        // Let the idle task free the deleted task
+        delay(2);
+    }
+
+    int64_t jobUs = jobTotalUs / DISPATCH_SAMPLES;
+    int64_t taskUs = taskTotalUs / DISPATCH_SAMPLES;
+    char message[96];
+    snprintf(message, sizeof(message), "Job dispatch: %lld us, task creation: %lld us", jobUs, taskUs);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(jobUs < taskUs);
+}
+
+void setup() {
+    taskDoneSemaphore = xSemaphoreCreateBinary();
+    workerPool.begin();
+
+    UNITY_BEGIN();
+    RUN_TEST(testFutureReturnsResult);
+    RUN_TEST(testShutterJobDoesNotWaitForBackgroundJob);
+    RUN_TEST(testDispatchLatencyAgainstTaskCreation);
+    UNITY_END();
+}
+
+void loop() {
+}
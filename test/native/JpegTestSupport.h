@@ -0,0 +1,104 @@
+#ifndef RETROLENS_JPEG_TEST_SUPPORT_H
+#define RETROLENS_JPEG_TEST_SUPPORT_H
+
+#include <unity.h>
+#include <math.h>
+#include <thread>
+#include <vector>
+#include <ImageArena.h>
+#include <JpegDecoder.h>
+#include <JpegEncoder.h>
+#include <StripRunner.h>
+
+// Scratch of the reference decoder, apart from the arena under test
+#define TEST_DECODE_SCRATCH_BYTES (256 * 1024)
+
+/**
+ * @brief Arena of a test file, made fresh for every test by setUp.
+ *
+ * @param bytes Capacity of the arena.
+ */
+#define JPEG_TEST_ARENA(bytes)                                      \
+    static uint8_t arenaBuffer[bytes];                              \
+    static ImageArena* arena;                                       \
+    void setUp(void) {                                              \
+        arena = new ImageArena(arenaBuffer, sizeof(arenaBuffer));   \
+    }                                                               \
+    void tearDown(void) {                                           \
+        delete arena;                                               \
+    }
+
+/**
+ * @brief Runs lane 1 on a thread and lane 0 on the caller, like the two cores.
+ */
+class ThreadStripRunner : public StripRunner {
+public:
+    void run(StripLaneFunction function, void* arg) override {
+        std::thread second(function, arg, 1);
+        function(arg, 0);
+        second.join();
+    }
+};
+
+static inline bool writeToVector(void* context, const uint8_t* data, size_t length) {
+    std::vector<uint8_t>* out = static_cast<std::vector<uint8_t>*>(context);
+    out->insert(out->end(), data, data + length);
+    return true;
+}
+
+// Gradients and ripples that differ along both axes, busy enough that every block has AC terms
+static inline std::vector<uint8_t> makeScene(int width, int height) {
+    std::vector<uint8_t> ycc((size_t) width * height * JPEG_YCC_BYTES);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            uint8_t* pixel = &ycc[((size_t) y * width + x) * JPEG_YCC_BYTES];
+            pixel[0] = (uint8_t) (100 + 50 * sin(x * 0.05 + y * 0.02) + 40 * cos(y * 0.11) * sin(x * 0.013) + x * 30 / width);
+            pixel[1] = (uint8_t) (128 + 30 * sin(y * 0.01) + 10 * cos(x * 0.07));
+            pixel[2] = (uint8_t) (128 + 30 * cos(x * 0.01) - y * 20 / height);
+        }
+    }
+    return ycc;
+}
+
+// Encodes interleaved YCbCr with the standard tables, the last strip padded with zero rows
+static inline std::vector<uint8_t> encode(const std::vector<uint8_t>& ycc, int width, int height, int subsampling, int quality,
+                                          uint16_t restartInterval = 0) {
+    uint8_t lumaQuant[JPEG_BLOCK_SIZE];
+    uint8_t chromaQuant[JPEG_BLOCK_SIZE];
+    jpegScaleQuantTable(JPEG_STD_LUMA_QUANT, quality, lumaQuant);
+    jpegScaleQuantTable(JPEG_STD_CHROMA_QUANT, quality, chromaQuant);
+    std::vector<uint8_t> jpeg;
+    JpegEncoder encoder;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, encoder.begin(width, height, subsampling, lumaQuant, chromaQuant, writeToVector, &jpeg,
+                                                 restartInterval));
+    size_t rowBytes = (size_t) width * JPEG_YCC_BYTES;
+    std::vector<uint8_t> padded = ycc;
+    padded.resize(rowBytes * encoder.getStripCount() * encoder.getStripHeight());
+    for (int strip = 0; strip < encoder.getStripCount(); strip++) {
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, encoder.encodeStrip(&padded[(size_t) strip * encoder.getStripHeight() * rowBytes], rowBytes));
+    }
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, encoder.finish());
+    TEST_ASSERT_EQUAL_UINT32(jpeg.size(), encoder.getBytesWritten());
+    return jpeg;
+}
+
+// Decodes a whole frame to interleaved YCbCr, in a scratch arena of its own
+static inline std::vector<uint8_t> decode(const std::vector<uint8_t>& jpeg, int* width = nullptr, int* height = nullptr) {
+    static uint8_t scratch[TEST_DECODE_SCRATCH_BYTES];
+    ImageArena decodeArena(scratch, sizeof(scratch));
+    JpegDecoder decoder;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.begin(jpeg.data(), jpeg.size(), &decodeArena));
+    size_t rowBytes = (size_t) decoder.getWidth() * JPEG_YCC_BYTES;
+    std::vector<uint8_t> ycc(rowBytes * decoder.getStripCount() * decoder.getStripHeight());
+    for (int strip = 0; strip < decoder.getStripCount(); strip++) {
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.decodeStrip(&ycc[(size_t) strip * decoder.getStripHeight() * rowBytes], rowBytes));
+    }
+    ycc.resize(rowBytes * decoder.getHeight());
+    if (width != nullptr) {
+        *width = decoder.getWidth();
+        *height = decoder.getHeight();
+    }
+    return ycc;
+}
+
+#endif
@@ -0,0 +1,198 @@
+#include <unity.h>
+#include <math.h>
+#include <stdint.h>
+#include <BatterySampler.h>
+
+#define DIVIDER_RATIO 2.0f
+#define WINDOW_PERIOD_MS 30000
+
+static BatterySampler* sampler;
+
+void setUp(void) {
+    sampler = new BatterySampler(DIVIDER_RATIO);
+}
+
+void tearDown(void) {
+    delete sampler;
+}
+
+// Deterministic noise source, so every run sees the same trace
+static uint32_t noiseState;
+
+static float uniformNoise() {
+    noiseState = noiseState * 1664525u + 1013904223u;
+    return (float) (noiseState >> 8) / (float) (1u << 24) - 0.5f;
+}
+
+// Approximately gaussian noise with the given standard deviation
+static float gaussianNoise(float sigma) {
+    float sum = 0.0f;
+    for (int i = 0; i < 12; i++) {
+        sum += uniformNoise();
+    }
+    return sum * sigma;
+}
+
+/**
+ * Fill a burst like the ADC does for a battery at the given voltage: readings at the divider
+ * output with gaussian noise, and a few spikes from the camera and WiFi supply transients.
+ */
+static void makeBurst(uint16_t* millivolts, float batteryVoltage, float noiseMv, int spikes) {
+    float pinMv = batteryVoltage / DIVIDER_RATIO * 1000.0f;
+    for (int i = 0; i < BATTERY_BURST_SAMPLES; i++) {
+        float value = pinMv + gaussianNoise(noiseMv);
+        millivolts[i] = (uint16_t) (value < 0.0f ? 0.0f : value);
+    }
+    for (int i = 0; i < spikes; i++) {
+        millivolts[(i * 17 + 5) % BATTERY_BURST_SAMPLES] = (i % 2) ? 3100 : 150;
+    }
+}
+
+// Resting cell voltage of a discharge from 4.2 V, roughly following the curve of the sampler
+static float dischargeVoltage(float charge) {
+    // Inverse lookup of the curve by bisection keeps the trace and the table consistent
+    float low = 3.0f;
+    float high = 4.2f;
+    for (int i = 0; i < 40; i++) {
+        float mid = (low + high) / 2.0f;
+        if (BatterySampler::voltageToStateOfCharge(mid) < charge) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    return (low + high) / 2.0f;
+}
+
+void testLookupTableEndpointsAndInterpolation() {
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f, BatterySampler::voltageToStateOfCharge(4.25f));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f, BatterySampler::voltageToStateOfCharge(4.20f));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 50.0f, BatterySampler::voltageToStateOfCharge(3.84f));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, BatterySampler::voltageToStateOfCharge(3.27f));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, BatterySampler::voltageToStateOfCharge(2.90f));
+    // Halfway between 3.61 V (5%) and 3.69 V (10%)
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 7.5f, BatterySampler::voltageToStateOfCharge(3.65f));
+}
+
+void testLookupTableIsMonotonic() {
+    float previous = -1.0f;
+    for (float voltage = 3.0f; voltage <= 4.3f; voltage += 0.001f) {
+        float charge = BatterySampler::voltageToStateOfCharge(voltage);
+        TEST_ASSERT_TRUE(charge >= previous);
+        previous = charge;
+    }
+}
+
+void testBurstRejectsSpikesAndAveragesNoise() {
+    noiseState = 1;
+    uint16_t millivolts[BATTERY_BURST_SAMPLES];
+    // 25 mV of noise at the pin and 6 spikes, about 10% of the burst
+    makeBurst(millivolts, 3.90f, 25.0f, 6);
+    float voltage = sampler->addBurst(millivolts, BATTERY_BURST_SAMPLES, 0);
+
+    // A single reading is off by 50 mV at the battery, the burst by a few
+    TEST_ASSERT_FLOAT_WITHIN(0.015f, 3.90f, voltage);
+
+    // The burst is sorted in place
+    for (int i = 1; i < BATTERY_BURST_SAMPLES; i++) {
+        TEST_ASSERT_TRUE(millivolts[i - 1] <= millivolts[i]);
+    }
+}
+
+void testSingleLoadSagIsDropped() {
+    noiseState = 2;
+    uint16_t millivolts[BATTERY_BURST_SAMPLES];
+    for (int i = 0; i < 5; i++) {
+        makeBurst(millivolts, 3.95f, 5.0f, 0);
+        sampler->addBurst(millivolts, BATTERY_BURST_SAMPLES, i * WINDOW_PERIOD_MS);
+    }
+    float before = sampler->getStateOfCharge();
+
+    // A window taken while the sensor and the SD card draw current sags by 200 mV
+    makeBurst(millivolts, 3.75f, 5.0f, 0);
+    sampler->addBurst(millivolts, BATTERY_BURST_SAMPLES, 5 * WINDOW_PERIOD_MS);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, before, sampler->getStateOfCharge());
+
+    makeBurst(millivolts, 3.95f, 5.0f, 0);
+    sampler->addBurst(millivolts, BATTERY_BURST_SAMPLES, 6 * WINDOW_PERIOD_MS);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, before, sampler->getStateOfCharge());
+}
+
+void testDischargeTraceTracksChargeAndTimeToEmpty() {
+    noiseState = 3;
+    uint16_t millivolts[BATTERY_BURST_SAMPLES];
+
+    // Four hour discharge from 100% to 0%, one window every 30 s
+    const float durationS = 4.0f * 3600.0f;
+    int windows = (int) (durationS * 1000.0f / WINDOW_PERIOD_MS);
+    float previousCharge = 101.0f;
+    int checked = 0;
+    for (int i = 0; i < windows; i++) {
+        float elapsedS = (float) i * WINDOW_PERIOD_MS / 1000.0f;
+        float trueCharge = 100.0f * (1.0f - elapsedS / durationS);
+        // Every tenth window catches a load sag, as when a picture is being saved
+        float sag = (i % 10 == 7) ? 0.15f : 0.0f;
+        makeBurst(millivolts, dischargeVoltage(trueCharge) - sag, 20.0f, 4);
+        sampler->addBurst(millivolts, BATTERY_BURST_SAMPLES, (uint32_t) i * WINDOW_PERIOD_MS);
+
+        float charge = sampler->getStateOfCharge();
+        // The displayed level never jumps back up by more than a step of the noise
+        TEST_ASSERT_TRUE(charge <= previousCharge + 1.5f);
+        previousCharge = charge;
+
+        // After the first hour, in the sloped part of the curve
+        if (elapsedS > 3600.0f && trueCharge > 15.0f) {
+            TEST_ASSERT_FLOAT_WITHIN(6.0f, trueCharge, charge);
+            long timeToEmpty = sampler->getTimeToEmptySeconds();
+            TEST_ASSERT_TRUE(timeToEmpty != BATTERY_UNKNOWN_TIME);
+            float remainingS = durationS - elapsedS;
+            TEST_ASSERT_FLOAT_WITHIN(0.25f * remainingS + 600.0f, remainingS, (float) timeToEmpty);
+            checked++;
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(100, checked);
+}
+
+void testChargingTraceHasNoTimeToEmpty() {
+    noiseState = 4;
+    uint16_t millivolts[BATTERY_BURST_SAMPLES];
+
+    // Discharge for 30 minutes, then charge
+    uint32_t timeMs = 0;
+    for (int i = 0; i < 60; i++, timeMs += WINDOW_PERIOD_MS) {
+        makeBurst(millivolts, dischargeVoltage(80.0f - i * 0.2f), 10.0f, 0);
+        sampler->addBurst(millivolts, BATTERY_BURST_SAMPLES, timeMs);
+    }
+    TEST_ASSERT_TRUE(sampler->getTimeToEmptySeconds() != BATTERY_UNKNOWN_TIME);
+
+    for (int i = 0; i < 40; i++, timeMs += WINDOW_PERIOD_MS) {
+        makeBurst(millivolts, dischargeVoltage(68.0f + i * 0.5f), 10.0f, 0);
+        sampler->addBurst(millivolts, BATTERY_BURST_SAMPLES, timeMs);
+    }
+    TEST_ASSERT_EQUAL(BATTERY_UNKNOWN_TIME, sampler->getTimeToEmptySeconds());
+}
+
+void testResetForgetsHistory() {
+    noiseState = 5;
+    uint16_t millivolts[BATTERY_BURST_SAMPLES];
+    makeBurst(millivolts, 4.1f, 5.0f, 0);
+    sampler->addBurst(millivolts, BATTERY_BURST_SAMPLES, 0);
+    sampler->reset();
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, sampler->getVoltage());
+
+    // The first window after a reset is taken as is, without averaging
+    makeBurst(millivolts, 3.7f, 5.0f, 0);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 3.7f, sampler->addBurst(millivolts, BATTERY_BURST_SAMPLES, 1000));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testLookupTableEndpointsAndInterpolation);
+    RUN_TEST(testLookupTableIsMonotonic);
+    RUN_TEST(testBurstRejectsSpikesAndAveragesNoise);
+    RUN_TEST(testSingleLoadSagIsDropped);
+    RUN_TEST(testDischargeTraceTracksChargeAndTimeToEmpty);
+    RUN_TEST(testChargingTraceHasNoTimeToEmpty);
+    RUN_TEST(testResetForgetsHistory);
+    return UNITY_END();
+}
@@ -0,0 +1,127 @@
+#include <unity.h>
+#include <BootGraph.h>
+
+static BootGraph* graph;
+
+void setUp(void) {
+    graph = new BootGraph();
+}
+
+void tearDown(void) {
+    delete graph;
+}
+
+void testDependenciesMustExist() {
+    int a = graph->addStage("a", 0, false);
+    TEST_ASSERT_EQUAL_INT(0, a);
+    // Itself and later stages are rejected, so no cycle can be built
+    TEST_ASSERT_EQUAL_INT(BOOT_INVALID_STAGE, graph->addStage("b", BOOT_STAGE_MASK(1), false));
+    TEST_ASSERT_EQUAL_INT(1, graph->addStage("b", BOOT_STAGE_MASK(a), false));
+}
+
+void testCriticalCannotWaitForDeferred() {
+    int battery = graph->addStage("battery", 0, true);
+    TEST_ASSERT_EQUAL_INT(BOOT_INVALID_STAGE, graph->addStage("program", BOOT_STAGE_MASK(battery), false));
+    TEST_ASSERT_NOT_EQUAL(BOOT_INVALID_STAGE, graph->addStage("catalog", BOOT_STAGE_MASK(battery), true));
+}
+
+void testIndependentStagesAreHandedOutTogether() {
+    int camera = graph->addStage("camera", 0, false);
+    int services = graph->addStage("services", 0, false);
+    int power = graph->addStage("power", BOOT_STAGE_MASK(camera) | BOOT_STAGE_MASK(services), false);
+
+    TEST_ASSERT_EQUAL_HEX32(0, graph->takeReady());
+    graph->start(0);
+    TEST_ASSERT_EQUAL_HEX32(BOOT_STAGE_MASK(camera) | BOOT_STAGE_MASK(services), graph->takeReady());
+    // Handed out once
+    TEST_ASSERT_EQUAL_HEX32(0, graph->takeReady());
+
+    graph->markDone(services, 10);
+    TEST_ASSERT_EQUAL_HEX32(0, graph->takeReady());
+    graph->markDone(camera, 20);
+    TEST_ASSERT_EQUAL_HEX32(BOOT_STAGE_MASK(power), graph->takeReady());
+}
+
+void testDeferredStagesWaitForReady() {
+    int services = graph->addStage("services", 0, false);
+    int program = graph->addStage("program", BOOT_STAGE_MASK(services), false);
+    int battery = graph->addStage("battery", BOOT_STAGE_MASK(services), true);
+
+    graph->start(1000);
+    TEST_ASSERT_EQUAL_HEX32(BOOT_STAGE_MASK(services), graph->takeReady());
+    graph->markStarted(services, 1000);
+    graph->markDone(services, 1500);
+
+    // The battery could run, but the program comes first
+    TEST_ASSERT_EQUAL_HEX32(BOOT_STAGE_MASK(program), graph->takeReady());
+    graph->markStarted(program, 1500);
+    TEST_ASSERT_FALSE(graph->isReady());
+    graph->markDone(program, 1800);
+    TEST_ASSERT_TRUE(graph->isReady());
+    TEST_ASSERT_FALSE(graph->isComplete());
+    TEST_ASSERT_EQUAL_UINT64(800, graph->getReadyTimeUs());
+
+    TEST_ASSERT_EQUAL_HEX32(BOOT_STAGE_MASK(battery), graph->takeReady());
+    graph->markStarted(battery, 1800);
+    graph->markDone(battery, 5000);
+    TEST_ASSERT_TRUE(graph->isComplete());
+    // Deferred stages do not move the ready time
+    TEST_ASSERT_EQUAL_UINT64(800, graph->getReadyTimeUs());
+}
+
+void testTwoCoresBeatSerialBoot() {
+    // Durations of a cold boot, in microseconds
+    const uint64_t durations[] = {450000, 60000, 30000, 5000, 40000, 120000, 200000};
+    int standby = graph->addStage("standby", 0, false);
+    int camera = graph->addStage("camera", BOOT_STAGE_MASK(standby), false);
+    int services = graph->addStage("services", 0, false);
+    int button = graph->addStage("button", BOOT_STAGE_MASK(services), false);
+    int power = graph->addStage("power", BOOT_STAGE_MASK(camera) | BOOT_STAGE_MASK(services), false);
+    graph->addStage("battery", BOOT_STAGE_MASK(services), true);
+    graph->addStage("catalog", BOOT_STAGE_MASK(services), true);
+    (void) button;
+    (void) power;
+
+    // Two workers, each takes the lowest ready stage when free
+    graph->start(0);
+    uint64_t workerFree[2] = {0, 0};
+    int workerStage[2] = {-1, -1};
+    uint32_t pending = 0;
+    uint64_t now = 0;
+    while (!graph->isComplete()) {
+        pending |= graph->takeReady();
+        for (int w = 0; w < 2; w++) {
+            if (workerStage[w] < 0 && pending != 0) {
+                int stage = __builtin_ctz(pending);
+                pending &= ~BOOT_STAGE_MASK(stage);
+                graph->markStarted(stage, now);
+                workerStage[w] = stage;
+                workerFree[w] = now + durations[stage];
+            }
+        }
+        // Advance to the next completion
+        int next = workerStage[0] >= 0 && (workerStage[1] < 0 || workerFree[0] <= workerFree[1]) ? 0 : 1;
+        TEST_ASSERT_TRUE(workerStage[next] >= 0);
+        now = workerFree[next];
+        graph->markDone(workerStage[next], now);
+        workerStage[next] = -1;
+    }
+
+    uint64_t serialReadyUs = durations[0] + durations[1] + durations[2] + durations[3] + durations[4];
+    TEST_ASSERT_EQUAL_UINT64(serialReadyUs + durations[5] + durations[6], graph->getSerialTimeUs());
+    // Services and button run while the camera initializes
+    TEST_ASSERT_EQUAL_UINT64(durations[standby] + durations[camera] + durations[power], graph->getReadyTimeUs());
+    TEST_ASSERT_TRUE(graph->getReadyTimeUs() < serialReadyUs);
+    TEST_ASSERT_TRUE(graph->getStage(camera)->startUs >= graph->getStage(standby)->endUs);
+    TEST_ASSERT_TRUE(graph->getStage(services)->startUs < graph->getStage(camera)->endUs);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testDependenciesMustExist);
+    RUN_TEST(testCriticalCannotWaitForDeferred);
+    RUN_TEST(testIndependentStagesAreHandedOutTogether);
+    RUN_TEST(testDeferredStagesWaitForReady);
+    RUN_TEST(testTwoCoresBeatSerialBoot);
+    return UNITY_END();
+}
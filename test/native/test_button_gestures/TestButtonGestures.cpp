@@ -0,0 +1,207 @@
+#include <unity.h>
+#include <ButtonGestures.h>
+
+// Thresholds used by every test, so the expected timings below are exact
+static GestureConfig testConfig() {
+    GestureConfig config;
+    config.longPressMs = 1000;
+    config.multiClickGapMs = 250;
+    config.holdRepeatMs = 200;
+    config.holdClickGapMs = 400;
+    config.maxClicks = 3;
+    return config;
+}
+
+static ButtonGestures gestures(testConfig());
+static int events[MAX_GESTURE_EVENTS];
+
+void setUp(void) {
+    gestures.setConfig(testConfig());
+}
+
+void tearDown(void) {
+}
+
+// Feed an edge and check that it produces no gesture
+static void edgeWithoutGesture(int state, uint32_t timeMs) {
+    TEST_ASSERT_EQUAL_INT(0, gestures.handleEdge(state, timeMs, events));
+}
+
+// Feed a click (press then release) that produces no gesture by itself
+static void click(uint32_t pressMs, uint32_t releaseMs) {
+    edgeWithoutGesture(BUTTON_PRESSED, pressMs);
+    edgeWithoutGesture(BUTTON_RELEASED, releaseMs);
+}
+
+void testSingleClickAfterGap() {
+    click(0, 100);
+    TEST_ASSERT_EQUAL(250, gestures.msUntilDeadline(100));
+    TEST_ASSERT_EQUAL_INT(0, gestures.update(349, events));
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(350, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_SINGLE_CLICK, events[0]);
+    TEST_ASSERT_EQUAL(-1, gestures.msUntilDeadline(350));
+}
+
+void testReleaseJustBeforeLongPressIsClick() {
+    click(0, 999);
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(1249, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_SINGLE_CLICK, events[0]);
+}
+
+void testDoubleClick() {
+    click(0, 80);
+    // Second press 249 ms after the first release, just inside the gap
+    click(329, 400);
+    TEST_ASSERT_EQUAL_INT(0, gestures.update(649, events));
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(650, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_DOUBLE_CLICK, events[0]);
+}
+
+void testPressAtGapDeadlineSplitsClicks() {
+    click(0, 80);
+    // The gap expires at 330, a press at that exact time starts a new gesture
+    TEST_ASSERT_EQUAL_INT(1, gestures.handleEdge(BUTTON_PRESSED, 330, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_SINGLE_CLICK, events[0]);
+    edgeWithoutGesture(BUTTON_RELEASED, 400);
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(650, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_SINGLE_CLICK, events[0]);
+}
+
+void testTripleClickIsReportedOnRelease() {
+    click(0, 50);
+    click(150, 200);
+    edgeWithoutGesture(BUTTON_PRESSED, 300);
+    // The third click reaches maxClicks, no need to wait for the gap
+    TEST_ASSERT_EQUAL_INT(1, gestures.handleEdge(BUTTON_RELEASED, 350, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_TRIPLE_CLICK, events[0]);
+    TEST_ASSERT_EQUAL(-1, gestures.msUntilDeadline(350));
+}
+
+void testLongPressAndHoldRepeat() {
+    edgeWithoutGesture(BUTTON_PRESSED, 0);
+    TEST_ASSERT_EQUAL(1000, gestures.msUntilDeadline(0));
+    TEST_ASSERT_EQUAL_INT(0, gestures.update(999, events));
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(1000, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_LONG_PRESSED, events[0]);
+
+    // Repeats every 200 ms from the start of the hold
+    TEST_ASSERT_EQUAL_INT(0, gestures.update(1199, events));
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(1200, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_HOLD_REPEAT, events[0]);
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(1400, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_HOLD_REPEAT, events[0]);
+
+    // Releasing ends the repeats
+    edgeWithoutGesture(BUTTON_RELEASED, 1500);
+    TEST_ASSERT_EQUAL_INT(0, gestures.update(1900, events));
+    TEST_ASSERT_EQUAL(-1, gestures.msUntilDeadline(1900));
+}
+
+void testLateUpdateKeepsRepeatCadence() {
+    edgeWithoutGesture(BUTTON_PRESSED, 0);
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(1000, events));
+    // A late wake-up reports the missed repeats and keeps the original schedule
+    TEST_ASSERT_EQUAL_INT(2, gestures.update(1450, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_HOLD_REPEAT, events[0]);
+    TEST_ASSERT_EQUAL_INT(BUTTON_HOLD_REPEAT, events[1]);
+    TEST_ASSERT_EQUAL(150, gestures.msUntilDeadline(1450));
+}
+
+void testLongPressDetectedOnRelease() {
+    edgeWithoutGesture(BUTTON_PRESSED, 0);
+    // No update while held, the release at the deadline still reports the long press first
+    TEST_ASSERT_EQUAL_INT(1, gestures.handleEdge(BUTTON_RELEASED, 1000, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_LONG_PRESSED, events[0]);
+}
+
+void testHoldThenClick() {
+    edgeWithoutGesture(BUTTON_PRESSED, 0);
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(1000, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_LONG_PRESSED, events[0]);
+    edgeWithoutGesture(BUTTON_RELEASED, 1100);
+    // Follow-up press 399 ms after the hold ended
+    edgeWithoutGesture(BUTTON_PRESSED, 1499);
+    TEST_ASSERT_EQUAL_INT(1, gestures.handleEdge(BUTTON_RELEASED, 1550, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_HOLD_CLICK, events[0]);
+}
+
+void testHoldThenLateClickIsSingleClick() {
+    edgeWithoutGesture(BUTTON_PRESSED, 0);
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(1000, events));
+    edgeWithoutGesture(BUTTON_RELEASED, 1100);
+    // The follow-up window closes at 1500
+    click(1500, 1550);
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(1800, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_SINGLE_CLICK, events[0]);
+}
+
+void testHoldThenSecondHold() {
+    edgeWithoutGesture(BUTTON_PRESSED, 0);
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(1000, events));
+    edgeWithoutGesture(BUTTON_RELEASED, 1050);
+    edgeWithoutGesture(BUTTON_PRESSED, 1200);
+    TEST_ASSERT_EQUAL_INT(0, gestures.update(2199, events));
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(2200, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_LONG_PRESSED, events[0]);
+}
+
+void testClickThenHoldDropsClicks() {
+    click(0, 50);
+    edgeWithoutGesture(BUTTON_PRESSED, 200);
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(1200, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_LONG_PRESSED, events[0]);
+    edgeWithoutGesture(BUTTON_RELEASED, 1300);
+    TEST_ASSERT_EQUAL_INT(0, gestures.update(1700, events));
+}
+
+void testConfigurableThresholds() {
+    GestureConfig config = testConfig();
+    config.multiClickGapMs = 100;
+    config.maxClicks = 2;
+    config.holdRepeatMs = 0;
+    gestures.setConfig(config);
+
+    click(0, 50);
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(150, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_SINGLE_CLICK, events[0]);
+
+    // maxClicks of two reports the double click on release
+    click(200, 250);
+    edgeWithoutGesture(BUTTON_PRESSED, 300);
+    TEST_ASSERT_EQUAL_INT(1, gestures.handleEdge(BUTTON_RELEASED, 350, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_DOUBLE_CLICK, events[0]);
+
+    // A zero repeat period disables hold repeats
+    edgeWithoutGesture(BUTTON_PRESSED, 400);
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(1400, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_LONG_PRESSED, events[0]);
+    TEST_ASSERT_EQUAL(-1, gestures.msUntilDeadline(1400));
+}
+
+void testTimerWrapAround() {
+    uint32_t start = 0xFFFFFF00u;
+    click(start, start + 50);
+    TEST_ASSERT_EQUAL(250, gestures.msUntilDeadline(start + 50));
+    TEST_ASSERT_EQUAL_INT(0, gestures.update(start + 299, events));
+    TEST_ASSERT_EQUAL_INT(1, gestures.update(start + 300, events));
+    TEST_ASSERT_EQUAL_INT(BUTTON_SINGLE_CLICK, events[0]);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testSingleClickAfterGap);
+    RUN_TEST(testReleaseJustBeforeLongPressIsClick);
+    RUN_TEST(testDoubleClick);
+    RUN_TEST(testPressAtGapDeadlineSplitsClicks);
+    RUN_TEST(testTripleClickIsReportedOnRelease);
+    RUN_TEST(testLongPressAndHoldRepeat);
+    RUN_TEST(testLateUpdateKeepsRepeatCadence);
+    RUN_TEST(testLongPressDetectedOnRelease);
+    RUN_TEST(testHoldThenClick);
+    RUN_TEST(testHoldThenLateClickIsSingleClick);
+    RUN_TEST(testHoldThenSecondHold);
+    RUN_TEST(testClickThenHoldDropsClicks);
+    RUN_TEST(testConfigurableThresholds);
+    RUN_TEST(testTimerWrapAround);
+    return UNITY_END();
+}
@@ -0,0 +1,286 @@
+#include <unity.h>
+#include <math.h>
+#include <string.h>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <ColorLut.h>
+#include <FilmProcess.h>
+#include <JpegTables.h>
+
+#define BENCH_WIDTH 1280
+#define BENCH_HEIGHT 1024
+
+typedef std::function<void(double, double, double, double*)> ColorFunction;
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// A blob of one LUT, in words so the nodes are aligned like in the flash partition
+static std::vector<uint32_t> makeBlob(const char* name, int size, const ColorFunction& function) {
+    size_t count = (size_t) size * size * size;
+    std::vector<uint32_t> words((sizeof(ColorLutBlobHeader) + sizeof(ColorLutBlobEntry)) / 4 + count);
+    ColorLutBlobHeader header = {COLOR_LUT_MAGIC, COLOR_LUT_VERSION, 1};
+    ColorLutBlobEntry entry = {};
+    strncpy(entry.name, name, sizeof(entry.name) - 1);
+    entry.size = (uint16_t) size;
+    entry.offset = sizeof(header) + sizeof(entry);
+    memcpy(&words[0], &header, sizeof(header));
+    memcpy(reinterpret_cast<uint8_t*>(&words[0]) + sizeof(header), &entry, sizeof(entry));
+
+    // Y fastest, then Cb, then Cr, as scripts/cube_to_lut.py packs them
+    uint32_t* nodes = &words[entry.offset / 4];
+    double step = 255.0 / (size - 1);
+    for (int r = 0; r < size; r++) {
+        for (int b = 0; b < size; b++) {
+            for (int y = 0; y < size; y++) {
+                double out[3];
+                function(y * step, b * step, r * step, out);
+                uint32_t packed = 0;
+                for (int c = 0; c < 3; c++) {
+                    long value = lround(out[c] * 4);
+                    packed |= (uint32_t) (value < 0 ? 0 : (value > 1020 ? 1020 : value)) << (c * COLOR_LUT_NODE_BITS);
+                }
+                *nodes++ = packed;
+            }
+        }
+    }
+    return words;
+}
+
+static const uint8_t* blobBytes(const std::vector<uint32_t>& words) {
+    return reinterpret_cast<const uint8_t*>(words.data());
+}
+
+static void identity(double y, double cb, double cr, double* out) {
+    out[0] = y;
+    out[1] = cb;
+    out[2] = cr;
+}
+
+// A film-like look: lifted and compressed tones, chroma crossed and reduced
+static void filmLook(double y, double cb, double cr, double* out) {
+    out[0] = 12 + 231 * pow(y / 255.0, 0.8);
+    out[1] = 128 + 0.8 * (cb - 128) - 0.1 * (cr - 128) - 6 * (y / 255.0);
+    out[2] = 128 + 0.85 * (cr - 128) + 0.05 * (cb - 128) + 8 * (y / 255.0);
+}
+
+// Tetrahedral interpolation in doubles, on the packed nodes of a blob
+static void referencePixel(const std::vector<uint32_t>& words, int size, const uint8_t* in, double* out) {
+    const uint32_t* nodes = &words[(sizeof(ColorLutBlobHeader) + sizeof(ColorLutBlobEntry)) / 4];
+    int index[3];
+    double fraction[3];
+    for (int c = 0; c < 3; c++) {
+        double position = in[c] * (size - 1) / 255.0;
+        index[c] = position >= size - 1 ? size - 2 : (int) position;
+        fraction[c] = position - index[c];
+    }
+    auto node = [&](int dy, int db, int dr, int c) {
+        uint32_t packed = nodes[((index[2] + dr) * size + index[1] + db) * size + index[0] + dy];
+        return ((packed >> (c * COLOR_LUT_NODE_BITS)) & COLOR_LUT_NODE_MASK) / 4.0;
+    };
+    // Walk from the low corner to the high one along the largest fractions first
+    int order[3] = {0, 1, 2};
+    std::sort(order, order + 3, [&](int a, int b) { return fraction[a] > fraction[b]; });
+    for (int c = 0; c < 3; c++) {
+        int step[3] = {0, 0, 0};
+        double value = (1 - fraction[order[0]]) * node(0, 0, 0, c);
+        for (int i = 0; i < 3; i++) {
+            step[order[i]] = 1;
+            double weight = fraction[order[i]] - (i < 2 ? fraction[order[i + 1]] : 0);
+            value += weight * node(step[0], step[1], step[2], c);
+        }
+        out[c] = value;
+    }
+}
+
+// Every 3rd value of each component, 0 to 255
+static void forEachSample(const std::function<void(const uint8_t*)>& visit) {
+    for (int r = 0; r <= 255; r += 3) {
+        for (int b = 0; b <= 255; b += 3) {
+            for (int y = 0; y <= 255; y += 3) {
+                uint8_t in[3] = {(uint8_t) y, (uint8_t) b, (uint8_t) r};
+                visit(in);
+            }
+        }
+    }
+}
+
+void testIdentityKeepsPixels(void) {
+    int sizes[] = {17, 33};
+    for (int size : sizes) {
+        std::vector<uint32_t> blob = makeBlob("identity", size, identity);
+        ColorLut lut;
+        TEST_ASSERT_TRUE(lut.load(blobBytes(blob), blob.size() * 4, "identity"));
+        TEST_ASSERT_EQUAL_INT(size, lut.getSize());
+        int worst = 0;
+        forEachSample([&](const uint8_t* in) {
+            uint8_t out[3];
+            lut.applyPixel(in, out);
+            for (int c = 0; c < 3; c++) {
+                worst = abs(out[c] - in[c]) > worst ? abs(out[c] - in[c]) : worst;
+            }
+        });
+        TEST_ASSERT_TRUE(worst <= 1);
+    }
+}
+
+void testMatchesFloatReference(void) {
+    int sizes[] = {17, 33};
+    for (int size : sizes) {
+        std::vector<uint32_t> blob = makeBlob("test_film", size, filmLook);
+        ColorLut lut;
+        TEST_ASSERT_TRUE(lut.load(blobBytes(blob), blob.size() * 4, "test_film"));
+        double worst = 0;
+        forEachSample([&](const uint8_t* in) {
+            uint8_t out[3];
+            double reference[3];
+            lut.applyPixel(in, out);
+            referencePixel(blob, size, in, reference);
+            for (int c = 0; c < 3; c++) {
+                worst = fabs(out[c] - reference[c]) > worst ? fabs(out[c] - reference[c]) : worst;
+            }
+        });
+        char message[96];
+        snprintf(message, sizeof(message), "%d^3 LUT: %.2f worst difference to the float interpolation", size, worst);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_TRUE(worst <= 1.0);
+    }
+}
+
+void testApproximatesTheLook(void) {
+    int sizes[] = {17, 33};
+    for (int size : sizes) {
+        std::vector<uint32_t> blob = makeBlob("test_film", size, filmLook);
+        ColorLut lut;
+        TEST_ASSERT_TRUE(lut.load(blobBytes(blob), blob.size() * 4, "test_film"));
+        double worst = 0;
+        double squares = 0;
+        long count = 0;
+        forEachSample([&](const uint8_t* in) {
+            uint8_t out[3];
+            double exact[3];
+            lut.applyPixel(in, out);
+            filmLook(in[0], in[1], in[2], exact);
+            for (int c = 0; c < 3; c++) {
+                double error = fabs(out[c] - exact[c]);
+                worst = error > worst ? error : worst;
+                squares += error * error;
+                count++;
+            }
+        });
+        char message[96];
+        snprintf(message, sizeof(message), "%d^3 LUT: %.2f worst, %.3f RMS error to the look", size, worst,
+                 sqrt(squares / count));
+        TEST_MESSAGE(message);
+        // The gamma curve bends most near black, where the first cell is widest
+        TEST_ASSERT_TRUE(worst <= (size == 33 ? 2.0 : 4.0));
+    }
+}
+
+void testRejectsMalformedBlobs(void) {
+    std::vector<uint32_t> good = makeBlob("test_film", 17, identity);
+    size_t length = good.size() * 4;
+    ColorLut lut;
+    TEST_ASSERT_FALSE(lut.load(nullptr, 0, "test_film"));
+    TEST_ASSERT_FALSE(lut.load(blobBytes(good), length, "other_film"));
+    TEST_ASSERT_FALSE(lut.load(blobBytes(good), length - 4, "test_film"));
+    TEST_ASSERT_FALSE(lut.isLoaded());
+
+    std::vector<uint32_t> bad = good;
+    bad[0] ^= 1;
+    TEST_ASSERT_FALSE(lut.load(blobBytes(bad), length, "test_film"));
+
+    // Entry fields: size, then offset
+    ColorLutBlobEntry* entry = reinterpret_cast<ColorLutBlobEntry*>(reinterpret_cast<uint8_t*>(good.data()) + 8);
+    for (int size : {1, 34}) {
+        bad = good;
+        reinterpret_cast<ColorLutBlobEntry*>(reinterpret_cast<uint8_t*>(bad.data()) + 8)->size = (uint16_t) size;
+        TEST_ASSERT_FALSE(lut.load(blobBytes(bad), length, "test_film"));
+    }
+    bad = good;
+    reinterpret_cast<ColorLutBlobEntry*>(reinterpret_cast<uint8_t*>(bad.data()) + 8)->offset = entry->offset + 2;
+    TEST_ASSERT_FALSE(lut.load(blobBytes(bad), length, "test_film"));
+    bad = good;
+    reinterpret_cast<ColorLutBlobEntry*>(reinterpret_cast<uint8_t*>(bad.data()) + 8)->offset = 0xFFFFFFF0u;
+    TEST_ASSERT_FALSE(lut.load(blobBytes(bad), length, "test_film"));
+
+    TEST_ASSERT_TRUE(lut.load(blobBytes(good), length, "test_film"));
+    lut.clear();
+    TEST_ASSERT_FALSE(lut.isLoaded());
+    TEST_ASSERT_EQUAL_INT(0, lut.getSize());
+}
+
+void testFilmProcessAppliesTheLut(void) {
+    std::vector<uint32_t> blob = makeBlob("test_film", 17, filmLook);
+    ColorLut lut;
+    ColorLut empty;
+    FilmProcess process;
+    process.setColorLut(&empty);
+    TEST_ASSERT_TRUE(process.isNeutral());
+    TEST_ASSERT_TRUE(lut.load(blobBytes(blob), blob.size() * 4, "test_film"));
+    process.setColorLut(&lut);
+    TEST_ASSERT_FALSE(process.isNeutral());
+
+    uint8_t strip[4 * JPEG_YCC_BYTES] = {0, 128, 128, 60, 100, 150, 128, 128, 128, 255, 200, 40};
+    uint8_t expected[4 * JPEG_YCC_BYTES];
+    for (int i = 0; i < 4; i++) {
+        lut.applyPixel(strip + i * JPEG_YCC_BYTES, expected + i * JPEG_YCC_BYTES);
+    }
+    process.processStrip(strip, 2 * JPEG_YCC_BYTES, 2, 2);
+    TEST_ASSERT_EQUAL_MEMORY(expected, strip, sizeof(strip));
+
+    // The curves follow the LUT
+    FilmLook look = {40, 120};
+    process.setLook(look);
+    FilmProcess curves;
+    curves.setLook(look);
+    uint8_t twice[4 * JPEG_YCC_BYTES] = {0, 128, 128, 60, 100, 150, 128, 128, 128, 255, 200, 40};
+    process.processStrip(twice, 4 * JPEG_YCC_BYTES, 4, 1);
+    curves.processStrip(expected, 4 * JPEG_YCC_BYTES, 4, 1);
+    TEST_ASSERT_EQUAL_MEMORY(expected, twice, sizeof(twice));
+
+    process.setColorLut(nullptr);
+    process.setLook(FILM_LOOK_NEUTRAL);
+    TEST_ASSERT_TRUE(process.isNeutral());
+}
+
+void testThroughput(void) {
+    std::vector<uint8_t> frame((size_t) BENCH_WIDTH * BENCH_HEIGHT * JPEG_YCC_BYTES);
+    for (size_t i = 0; i < frame.size(); i++) {
+        frame[i] = (uint8_t) ((i * 2654435761u) >> 13);
+    }
+    int sizes[] = {17, 33};
+    double rates[2];
+    for (int i = 0; i < 2; i++) {
+        std::vector<uint32_t> blob = makeBlob("test_film", sizes[i], filmLook);
+        ColorLut lut;
+        TEST_ASSERT_TRUE(lut.load(blobBytes(blob), blob.size() * 4, "test_film"));
+        std::vector<uint8_t> work = frame;
+        int repeats = 5;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; r++) {
+            lut.applyStrip(work.data(), BENCH_WIDTH * JPEG_YCC_BYTES, BENCH_WIDTH, BENCH_HEIGHT);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / repeats;
+        rates[i] = BENCH_WIDTH * BENCH_HEIGHT / seconds / 1e6;
+    }
+    char message[128];
+    snprintf(message, sizeof(message), "%dx%d tetrahedral LUT: %.1f MP/s at 17^3, %.1f MP/s at 33^3", BENCH_WIDTH,
+             BENCH_HEIGHT, rates[0], rates[1]);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(rates[0] > 0 && rates[1] > 0);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testIdentityKeepsPixels);
+    RUN_TEST(testMatchesFloatReference);
+    RUN_TEST(testApproximatesTheLook);
+    RUN_TEST(testRejectsMalformedBlobs);
+    RUN_TEST(testFilmProcessAppliesTheLut);
+    RUN_TEST(testThroughput);
+    return UNITY_END();
+}
@@ -0,0 +1,253 @@
+#include <unity.h>
+#include <math.h>
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+#include <DateStamp.h>
+#include "../JpegTestSupport.h"
+
+#define FRAME_WIDTH 640
+#define FRAME_HEIGHT 480
+#define ARENA_BYTES (64 * 1024)
+#define STAMP_TEXT "'24 10 19"
+
+JPEG_TEST_ARENA(ARENA_BYTES)
+
+// The reference: decode everything, draw, encode everything with the tables of the source
+static std::vector<uint8_t> fullReencode(const std::vector<uint8_t>& jpeg, const char* text) {
+    static uint8_t scratch[128 * 1024];
+    ImageArena decodeArena(scratch, sizeof(scratch));
+    JpegDecoder decoder;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.begin(jpeg.data(), jpeg.size(), &decodeArena));
+    int width = decoder.getWidth();
+    int height = decoder.getHeight();
+    size_t rowBytes = (size_t) width * JPEG_YCC_BYTES;
+    std::vector<uint8_t> ycc(rowBytes * decoder.getStripCount() * decoder.getStripHeight());
+    for (int strip = 0; strip < decoder.getStripCount(); strip++) {
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.decodeStrip(&ycc[(size_t) strip * decoder.getStripHeight() * rowBytes], rowBytes));
+    }
+    DateStamp::drawText(ycc.data(), rowBytes, width, height, text);
+    std::vector<uint8_t> out;
+    JpegEncoder encoder;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, encoder.begin(width, height, decoder.getSubsampling(), decoder.getQuantTable(0),
+                                                 decoder.getQuantTable(1), writeToVector, &out, decoder.getRestartInterval()));
+    for (int strip = 0; strip < encoder.getStripCount(); strip++) {
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, encoder.encodeStrip(&ycc[(size_t) strip * encoder.getStripHeight() * rowBytes], rowBytes));
+    }
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, encoder.finish());
+    return out;
+}
+
+// Ink pixels of the stamp, found by drawing it on an empty frame
+static std::vector<bool> inkMask(int width, int height, const char* text) {
+    std::vector<uint8_t> blank((size_t) width * height * JPEG_YCC_BYTES, 0);
+    DateStamp::drawText(blank.data(), (size_t) width * JPEG_YCC_BYTES, width, height, text);
+    std::vector<bool> mask((size_t) width * height);
+    for (size_t i = 0; i < mask.size(); i++) {
+        mask[i] = blank[i * JPEG_YCC_BYTES] != 0;
+    }
+    return mask;
+}
+
+// Checks the splice against the source outside the stamp and against the full re-encode on the ink
+static void checkSplice(uint16_t restartInterval) {
+    std::vector<uint8_t> source = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85, restartInterval);
+    DateStamp stamp(arena);
+    std::vector<uint8_t> stamped;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stamp.write(source.data(), source.size(), STAMP_TEXT, writeToVector, &stamped));
+    TEST_ASSERT_EQUAL_UINT32(0, arena->getUsed());
+    TEST_ASSERT_GREATER_THAN(0, stamp.getStampedBlocks());
+
+    std::vector<uint8_t> original = decode(source);
+    std::vector<uint8_t> result = decode(stamped);
+    std::vector<uint8_t> reference = decode(fullReencode(source, STAMP_TEXT));
+    std::vector<bool> ink = inkMask(FRAME_WIDTH, FRAME_HEIGHT, STAMP_TEXT);
+
+    // Stamp rectangle in MCUs, 16x8 at 4:2:2
+    int left = FRAME_WIDTH;
+    int top = FRAME_HEIGHT;
+    int inkCount = 0;
+    for (int y = 0; y < FRAME_HEIGHT; y++) {
+        for (int x = 0; x < FRAME_WIDTH; x++) {
+            if (ink[(size_t) y * FRAME_WIDTH + x]) {
+                left = x < left ? x : left;
+                top = y < top ? y : top;
+                inkCount++;
+            }
+        }
+    }
+    TEST_ASSERT_TRUE(left > FRAME_WIDTH / 2 && top > FRAME_HEIGHT * 3 / 4);
+    int mcuLeft = left / 16 * 16;
+    int mcuTop = top / 8 * 8;
+
+    int inkPixels = 0;
+    for (int y = 0; y < FRAME_HEIGHT; y++) {
+        for (int x = 0; x < FRAME_WIDTH; x++) {
+            size_t index = ((size_t) y * FRAME_WIDTH + x) * JPEG_YCC_BYTES;
+            if (x < mcuLeft || y < mcuTop) {
+                // Outside the stamped MCUs nothing changed, not even by rounding
+                TEST_ASSERT_EQUAL_UINT8_ARRAY(&original[index], &result[index], JPEG_YCC_BYTES);
+            } else if (ink[(size_t) y * FRAME_WIDTH + x]) {
+                // Under the ink, the stamped blocks are those of a full re-encode
+                TEST_ASSERT_EQUAL_UINT8_ARRAY(&reference[index], &result[index], JPEG_YCC_BYTES);
+                inkPixels++;
+            }
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(50, inkPixels);
+    TEST_ASSERT_EQUAL_INT(inkCount, inkPixels);
+}
+
+void testLayoutInTheBottomRightCorner() {
+    std::vector<uint8_t> ycc((size_t) FRAME_WIDTH * FRAME_HEIGHT * JPEG_YCC_BYTES, 128);
+    TEST_ASSERT_TRUE(DateStamp::drawText(ycc.data(), (size_t) FRAME_WIDTH * JPEG_YCC_BYTES, FRAME_WIDTH, FRAME_HEIGHT, "88"));
+
+    // Automatic dot of 1 px at 480 rows, margin of 8 dots, "88" is 11 dots wide and 7 high
+    int right = 0;
+    int bottom = 0;
+    int left = FRAME_WIDTH;
+    int top = FRAME_HEIGHT;
+    for (int y = 0; y < FRAME_HEIGHT; y++) {
+        for (int x = 0; x < FRAME_WIDTH; x++) {
+            const uint8_t* pixel = &ycc[((size_t) y * FRAME_WIDTH + x) * JPEG_YCC_BYTES];
+            if (pixel[0] != 128) {
+                TEST_ASSERT_EQUAL_UINT8(39, pixel[1]);
+                TEST_ASSERT_EQUAL_UINT8(197, pixel[2]);
+                left = x < left ? x : left;
+                right = x > right ? x : right;
+                top = y < top ? y : top;
+                bottom = y > bottom ? y : bottom;
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(FRAME_WIDTH - 8 - 1, right);
+    TEST_ASSERT_EQUAL_INT(FRAME_HEIGHT - 8 - 1, bottom);
+    TEST_ASSERT_EQUAL_INT(FRAME_WIDTH - 8 - 11, left);
+    TEST_ASSERT_EQUAL_INT(FRAME_HEIGHT - 8 - 7, top);
+
+    // Too long for the frame
+    TEST_ASSERT_FALSE(DateStamp::drawText(ycc.data(), 16 * JPEG_YCC_BYTES, 16, 16, STAMP_TEXT));
+}
+
+void testSpliceWithoutRestartMarkers() {
+    checkSplice(0);
+}
+
+void testSpliceWithRestartMarkers() {
+    checkSplice(4);
+}
+
+void testRestartIntervalsClearOfTheStampAreCopied() {
+    uint16_t interval = 8;
+    std::vector<uint8_t> source = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85, interval);
+    DateStamp stamp(arena);
+    std::vector<uint8_t> stamped;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stamp.write(source.data(), source.size(), STAMP_TEXT, writeToVector, &stamped));
+
+    // Only the intervals under the stamp are coded again, everything else is the source as it was
+    int mcus = (FRAME_WIDTH / 16) * (FRAME_HEIGHT / 8);
+    TEST_ASSERT_EQUAL_INT(0, stamp.getRecodedMcus() % interval);
+    TEST_ASSERT_LESS_THAN(mcus / 20, stamp.getRecodedMcus());
+    TEST_ASSERT_GREATER_THAN(source.size() * 95 / 100, stamp.getCopiedBytes());
+    size_t prefix = 0;
+    while (prefix < source.size() && prefix < stamped.size() && source[prefix] == stamped[prefix]) {
+        prefix++;
+    }
+    TEST_ASSERT_GREATER_THAN(source.size() * 3 / 4, prefix);
+}
+
+void testTailIsCodedFromCoefficients() {
+    std::vector<uint8_t> source = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85);
+    DateStamp stamp(arena);
+    std::vector<uint8_t> stamped;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stamp.write(source.data(), source.size(), STAMP_TEXT, writeToVector, &stamped));
+
+    // The copy stops inside the first stamped row, the tail is a few rows of MCUs
+    int mcusPerRow = FRAME_WIDTH / 16;
+    TEST_ASSERT_LESS_THAN(3 * mcusPerRow, stamp.getRecodedMcus());
+    TEST_ASSERT_GREATER_THAN(source.size() * 9 / 10, stamp.getCopiedBytes());
+    TEST_ASSERT_EQUAL_MEMORY(source.data(), stamped.data(), stamp.getCopiedBytes());
+
+    // An empty stamp changes nothing but the blocks it stamps
+    std::vector<uint8_t> blank;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stamp.write(source.data(), source.size(), "  ", writeToVector, &blank));
+    TEST_ASSERT_EQUAL_INT(0, stamp.getStampedBlocks());
+    TEST_ASSERT_EQUAL_INT(source.size(), blank.size());
+    TEST_ASSERT_EQUAL_MEMORY(source.data(), blank.data(), source.size());
+}
+
+void testBadInputAndMemory() {
+    std::vector<uint8_t> source = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85);
+    std::vector<uint8_t> out;
+    DateStamp stamp(arena);
+
+    // Not a JPEG
+    std::vector<uint8_t> garbage(1000, 0x55);
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_FORMAT, stamp.write(garbage.data(), garbage.size(), STAMP_TEXT, writeToVector, &out));
+
+    // Entropy-coded data cut before the stamp
+    std::vector<uint8_t> cut(source.begin(), source.begin() + source.size() / 2);
+    cut.push_back(0xFF);
+    cut.push_back(0xD9);
+    out.clear();
+    TEST_ASSERT_NOT_EQUAL(JPEG_OK, stamp.write(cut.data(), cut.size(), STAMP_TEXT, writeToVector, &out));
+    TEST_ASSERT_EQUAL_UINT32(0, arena->getUsed());
+
+    // The budget covers any frame size, one byte less is refused
+    size_t required = DateStamp::requiredBytes();
+    std::vector<uint8_t> budget(required);
+    ImageArena exact(budget.data(), budget.size());
+    DateStamp fitting(&exact);
+    out.clear();
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, fitting.write(source.data(), source.size(), STAMP_TEXT, writeToVector, &out));
+    TEST_ASSERT_LESS_OR_EQUAL(required, exact.getHighWater());
+    ImageArena tight(budget.data(), required - 3 * 8 - 64);
+    DateStamp starved(&tight);
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_MEMORY, starved.write(source.data(), source.size(), STAMP_TEXT, writeToVector, &out));
+    TEST_ASSERT_EQUAL_UINT32(0, tight.getUsed());
+}
+
+void testFasterThanFullReencode() {
+    // A 2 MP frame, the splice against decoding, drawing and encoding it all
+    const int width = 1600;
+    const int height = 1200;
+    std::vector<uint8_t> scene = makeScene(width, height);
+    const uint16_t intervals[2] = {0, 16};
+    for (int i = 0; i < 2; i++) {
+        std::vector<uint8_t> source = encode(scene, width, height, JPEG_SUBSAMPLING_422, 85, intervals[i]);
+        std::vector<uint8_t> out;
+        out.reserve(source.size() * 2);
+
+        auto start = std::chrono::steady_clock::now();
+        DateStamp stamp(arena);
+        for (int run = 0; run < 5; run++) {
+            out.clear();
+            TEST_ASSERT_EQUAL_INT(JPEG_OK, stamp.write(source.data(), source.size(), STAMP_TEXT, writeToVector, &out));
+        }
+        double spliceMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / 5;
+
+        start = std::chrono::steady_clock::now();
+        for (int run = 0; run < 5; run++) {
+            fullReencode(source, STAMP_TEXT);
+        }
+        double fullMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / 5;
+
+        char message[160];
+        snprintf(message, sizeof(message), "restart %u: splice %.2f ms, full re-encode %.2f ms, %.0fx, %d of %d MCUs coded again",
+                 intervals[i], spliceMs, fullMs, fullMs / spliceMs, stamp.getRecodedMcus(), (width / 16) * (height / 8));
+        TEST_MESSAGE(message);
+        TEST_ASSERT_LESS_THAN(fullMs / 4, spliceMs);
+    }
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testLayoutInTheBottomRightCorner);
+    RUN_TEST(testSpliceWithoutRestartMarkers);
+    RUN_TEST(testSpliceWithRestartMarkers);
+    RUN_TEST(testRestartIntervalsClearOfTheStampAreCopied);
+    RUN_TEST(testTailIsCodedFromCoefficients);
+    RUN_TEST(testBadInputAndMemory);
+    RUN_TEST(testFasterThanFullReencode);
+    return UNITY_END();
+}
@@ -0,0 +1,363 @@
+#include <string.h>
+#include <unity.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <DevelopScheduler.h>
+
+#define TASK_CHECKSUM 0
+#define TASK_UNREGISTERED 1
+
+// Bytes checksummed a step, as the firmware reads them from the card
+#define CHUNK_BYTES 4096
+
+// Time a step takes on the fake clock
+#define STEP_US 1000
+
+/**
+ * @brief Files of a fake card, and the checksums the tasks found.
+ */
+struct Card {
+    std::map<std::string, std::vector<uint8_t>> files;
+    std::map<std::string, uint32_t> checksums;
+    std::map<std::string, uint32_t> serials;
+    size_t bytesRead;
+};
+
+static Card* card;
+static DevelopScheduler* scheduler;
+static uint32_t fakeNowUs;
+
+static uint32_t fakeClock() {
+    return fakeNowUs;
+}
+
+static uint32_t steadyClock() {
+    return (uint32_t) std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// The checksum step of the firmware, over memory
+static int checksumStep(void* context, DevelopTask* task) {
+    Card* target = static_cast<Card*>(context);
+    auto file = target->files.find(task->path);
+    if (file == target->files.end()) {
+        return -1;
+    }
+    if (task->total == 0) {
+        task->total = (uint32_t) file->second.size();
+    }
+    if (file->second.size() != task->total) {
+        return -1;
+    }
+    size_t length = std::min((size_t) CHUNK_BYTES, (size_t) (task->total - task->cursor));
+    task->state = StandbyStore::crc32(file->second.data() + task->cursor, length, task->state);
+    task->cursor += (uint32_t) length;
+    target->bytesRead += length;
+    fakeNowUs += STEP_US;
+    if (task->cursor < task->total) {
+        return DEVELOP_STEP_MORE;
+    }
+    target->checksums[task->path] = task->state;
+    target->serials[task->path] = task->serial;
+    return DEVELOP_STEP_DONE;
+}
+
+static void addFile(const char* path, size_t length, uint32_t seed) {
+    std::mt19937 random(seed);
+    std::vector<uint8_t>& data = card->files[path];
+    data.resize(length);
+    for (size_t i = 0; i < length; i++) {
+        data[i] = (uint8_t) random();
+    }
+}
+
+// Every file has the checksum of its whole content
+static void checkChecksums(void) {
+    TEST_ASSERT_EQUAL_INT(card->files.size(), card->checksums.size());
+    for (auto& file : card->files) {
+        TEST_ASSERT_EQUAL_UINT32(StandbyStore::crc32(file.second.data(), file.second.size()), card->checksums[file.first]);
+    }
+}
+
+void setUp(void) {
+    card = new Card();
+    card->bytesRead = 0;
+    scheduler = new DevelopScheduler();
+    scheduler->setStep(TASK_CHECKSUM, checksumStep, card);
+    fakeNowUs = 0;
+}
+
+void tearDown(void) {
+    delete scheduler;
+    delete card;
+}
+
+void testRunsTasksInOrder(void) {
+    addFile("/a.jpg", 3 * CHUNK_BYTES + 17, 1);
+    addFile("/b.jpg", 100, 2);
+    addFile("/c.jpg", 0, 3);
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/a.jpg"));
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/b.jpg"));
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/c.jpg"));
+    TEST_ASSERT_EQUAL_INT(3, scheduler->getPending());
+    TEST_ASSERT_EQUAL_STRING("/a.jpg", scheduler->getTask(0)->path);
+
+    // Two steps into the first task
+    TEST_ASSERT_EQUAL_INT(DEVELOP_RUN_BUDGET, scheduler->run(2 * STEP_US, fakeClock));
+    TEST_ASSERT_EQUAL_INT(3, scheduler->getPending());
+    TEST_ASSERT_EQUAL_INT(2 * CHUNK_BYTES, scheduler->getTask(0)->cursor);
+    TEST_ASSERT_EQUAL_INT(2 * CHUNK_BYTES * 100 / (3 * CHUNK_BYTES + 17), scheduler->getTaskPercent());
+
+    TEST_ASSERT_EQUAL_INT(DEVELOP_RUN_EMPTY, scheduler->run(1000 * STEP_US, fakeClock));
+    TEST_ASSERT_EQUAL_INT(0, scheduler->getPending());
+    TEST_ASSERT_EQUAL_INT(3, scheduler->getCompleted());
+    TEST_ASSERT_EQUAL_INT(0, scheduler->getFailed());
+    TEST_ASSERT_EQUAL_INT(0, scheduler->getTaskPercent());
+    TEST_ASSERT_NULL(scheduler->getTask(0));
+    checkChecksums();
+    TEST_ASSERT_EQUAL_INT(3 * CHUNK_BYTES + 117, card->bytesRead);
+
+    // A new batch counts from zero
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/b.jpg"));
+    TEST_ASSERT_EQUAL_INT(0, scheduler->getCompleted());
+}
+
+void testAddRestartsAndRejects(void) {
+    addFile("/a.jpg", 2 * CHUNK_BYTES, 4);
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/a.jpg"));
+    scheduler->run(STEP_US, fakeClock);
+    TEST_ASSERT_EQUAL_INT(CHUNK_BYTES, scheduler->getTask(0)->cursor);
+
+    // The file was written again, the task starts over instead of being queued twice
+    addFile("/a.jpg", 3 * CHUNK_BYTES, 5);
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/a.jpg"));
+    TEST_ASSERT_EQUAL_INT(1, scheduler->getPending());
+    TEST_ASSERT_EQUAL_INT(0, scheduler->getTask(0)->cursor);
+    TEST_ASSERT_EQUAL_INT(DEVELOP_RUN_EMPTY, scheduler->run(1000 * STEP_US, fakeClock));
+    checkChecksums();
+
+    // Invalid kinds and paths, and a full queue
+    TEST_ASSERT_FALSE(scheduler->add(-1, "/a.jpg"));
+    TEST_ASSERT_FALSE(scheduler->add(DEVELOP_TASK_KINDS, "/a.jpg"));
+    TEST_ASSERT_FALSE(scheduler->add(TASK_CHECKSUM, nullptr));
+    TEST_ASSERT_FALSE(scheduler->add(TASK_CHECKSUM, std::string(DEVELOP_PATH_BYTES, 'a').c_str()));
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, std::string(DEVELOP_PATH_BYTES - 1, 'a').c_str()));
+    for (int i = 1; i < DEVELOP_QUEUE_CAPACITY; i++) {
+        TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, ("/" + std::to_string(i)).c_str()));
+    }
+    TEST_ASSERT_FALSE(scheduler->add(TASK_CHECKSUM, "/one_more.jpg"));
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/1"));
+    TEST_ASSERT_EQUAL_INT(DEVELOP_QUEUE_CAPACITY, scheduler->getPending());
+}
+
+void testSecondSaveBeforeChecksum(void) {
+    // A frame is saved and queued with its size, and its checksum starts
+    addFile("/picture.jpg", 3 * CHUNK_BYTES, 40);
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/picture.jpg", 3 * CHUNK_BYTES));
+    scheduler->run(STEP_US, fakeClock);
+    TEST_ASSERT_EQUAL_INT(CHUNK_BYTES, scheduler->getTask(0)->cursor);
+
+    TEST_ASSERT_EQUAL_UINT32(1, scheduler->getTask(0)->serial);
+
+    // A second frame of the same size is saved over it first, the checksum is of the second save and says so
+    addFile("/picture.jpg", 3 * CHUNK_BYTES, 41);
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/picture.jpg", 3 * CHUNK_BYTES));
+    TEST_ASSERT_EQUAL_INT(1, scheduler->getPending());
+    TEST_ASSERT_EQUAL_INT(0, scheduler->getTask(0)->cursor);
+    TEST_ASSERT_EQUAL_INT(3 * CHUNK_BYTES, scheduler->getTask(0)->total);
+    TEST_ASSERT_EQUAL_UINT32(2, scheduler->getTask(0)->serial);
+    TEST_ASSERT_EQUAL_INT(DEVELOP_RUN_EMPTY, scheduler->run(1000 * STEP_US, fakeClock));
+    TEST_ASSERT_EQUAL_INT(1, scheduler->getCompleted());
+    checkChecksums();
+    TEST_ASSERT_EQUAL_UINT32(2, card->serials["/picture.jpg"]);
+
+    // Written again without a save queueing it, the file is not the queued frame and gets no checksum
+    card->checksums.clear();
+    addFile("/picture.jpg", 2 * CHUNK_BYTES + 5, 42);
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/picture.jpg", 2 * CHUNK_BYTES + 5));
+    addFile("/picture.jpg", CHUNK_BYTES, 43);
+    TEST_ASSERT_EQUAL_INT(DEVELOP_RUN_EMPTY, scheduler->run(1000 * STEP_US, fakeClock));
+    TEST_ASSERT_EQUAL_INT(0, scheduler->getCompleted());
+    TEST_ASSERT_EQUAL_INT(1, scheduler->getFailed());
+    TEST_ASSERT_EQUAL_INT(0, card->checksums.size());
+}
+
+void testFailedTasksAreDropped(void) {
+    addFile("/a.jpg", 10, 6);
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/gone.jpg"));
+    TEST_ASSERT_TRUE(scheduler->add(TASK_UNREGISTERED, "/a.jpg"));
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/a.jpg"));
+    TEST_ASSERT_EQUAL_INT(DEVELOP_RUN_EMPTY, scheduler->run(1000 * STEP_US, fakeClock));
+    TEST_ASSERT_EQUAL_INT(1, scheduler->getCompleted());
+    TEST_ASSERT_EQUAL_INT(2, scheduler->getFailed());
+    checkChecksums();
+}
+
+void testPreemptionLatency(void) {
+    // Frames of a few hundred kilobytes, as the camera saves them
+    for (int i = 0; i < 8; i++) {
+        addFile(("/frame" + std::to_string(i) + ".jpg").c_str(), 400 * 1024 + i * 1000, 10 + i);
+        scheduler->add(TASK_CHECKSUM, ("/frame" + std::to_string(i) + ".jpg").c_str());
+    }
+
+    // Shutter presses at random times while the slices run, on the wall clock
+    std::mt19937 random(7);
+    std::vector<double> latenciesUs;
+    int presses = 0;
+    while (scheduler->getPending() > 0 && presses < 200) {
+        std::chrono::steady_clock::time_point returnTime;
+        int result = -1;
+        std::thread slice([&]() {
+            result = scheduler->run(UINT32_MAX, steadyClock);
+            returnTime = std::chrono::steady_clock::now();
+        });
+        std::this_thread::sleep_for(std::chrono::microseconds(200 + random() % 3000));
+        auto pressTime = std::chrono::steady_clock::now();
+        scheduler->preempt();
+        slice.join();
+        if (result == DEVELOP_RUN_PREEMPTED && returnTime > pressTime) {
+            latenciesUs.push_back(std::chrono::duration<double, std::micro>(returnTime - pressTime).count());
+        }
+
+        // Preempted until resumed, a slice started after the press does nothing
+        size_t bytesRead = card->bytesRead;
+        if (scheduler->getPending() > 0) {
+            TEST_ASSERT_EQUAL_INT(DEVELOP_RUN_PREEMPTED, scheduler->run(UINT32_MAX, steadyClock));
+        }
+        TEST_ASSERT_EQUAL_INT(bytesRead, card->bytesRead);
+        scheduler->resume();
+        presses++;
+    }
+    TEST_ASSERT_EQUAL_INT(0, scheduler->getPending());
+    TEST_ASSERT_TRUE(latenciesUs.size() > 10);
+
+    // Preempted tasks carried on where they were, no byte was read twice
+    checkChecksums();
+    size_t total = 0;
+    for (auto& file : card->files) {
+        total += file.second.size();
+    }
+    TEST_ASSERT_EQUAL_INT(total, card->bytesRead);
+
+    std::sort(latenciesUs.begin(), latenciesUs.end());
+    double medianUs = latenciesUs[latenciesUs.size() / 2];
+    double maxUs = latenciesUs.back();
+    char message[160];
+    snprintf(message, sizeof(message), "%u preemptions: median %.0f us, max %.0f us from the press to the end of the slice",
+             (unsigned) latenciesUs.size(), medianUs, maxUs);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(medianUs < 1000);
+    TEST_ASSERT_TRUE(maxUs < 5000);
+}
+
+void testResumesAfterReboot(void) {
+    addFile("/a.jpg", 5 * CHUNK_BYTES + 3, 20);
+    addFile("/b.jpg", 4 * CHUNK_BYTES, 21);
+    addFile("/c.jpg", 7 * CHUNK_BYTES + 1000, 22);
+    scheduler->add(TASK_CHECKSUM, "/a.jpg");
+    scheduler->add(TASK_CHECKSUM, "/b.jpg");
+    scheduler->add(TASK_CHECKSUM, "/c.jpg");
+
+    // Saved in turn to two slots after each slice, as the firmware does
+    std::vector<uint8_t> slots[2];
+    for (int slice = 0; slice < 3; slice++) {
+        scheduler->run(3 * STEP_US, fakeClock);
+        std::vector<uint8_t> blob(DEVELOP_QUEUE_MAX_BLOB_BYTES);
+        blob.resize(scheduler->serialize(blob.data(), blob.size()));
+        TEST_ASSERT_TRUE(blob.size() > 0);
+        slots[scheduler->getSequence() & 1] = blob;
+    }
+    TEST_ASSERT_EQUAL_INT(2, scheduler->getPending());
+    TEST_ASSERT_EQUAL_INT(1, scheduler->getCompleted());
+    uint32_t savedCursor = scheduler->getTask(0)->cursor;
+
+    // Work after the last save is lost with the power
+    scheduler->run(2 * STEP_US, fakeClock);
+    size_t bytesBeforeReboot = card->bytesRead;
+
+    // A new boot loads the newest slot and carries on from its cursor
+    delete scheduler;
+    scheduler = new DevelopScheduler();
+    scheduler->setStep(TASK_CHECKSUM, checksumStep, card);
+    const std::vector<uint8_t>& newest = slots[3 & 1];
+    TEST_ASSERT_TRUE(scheduler->deserialize(newest.data(), newest.size()));
+    TEST_ASSERT_EQUAL_INT(3, scheduler->getSequence());
+    TEST_ASSERT_EQUAL_INT(2, scheduler->getPending());
+    TEST_ASSERT_EQUAL_INT(1, scheduler->getCompleted());
+    TEST_ASSERT_EQUAL_STRING("/b.jpg", scheduler->getTask(0)->path);
+    TEST_ASSERT_EQUAL_INT(savedCursor, scheduler->getTask(0)->cursor);
+    TEST_ASSERT_EQUAL_UINT32(2, scheduler->getTask(0)->serial);
+    TEST_ASSERT_EQUAL_UINT32(3, scheduler->getAdded());
+    TEST_ASSERT_EQUAL_INT(DEVELOP_RUN_EMPTY, scheduler->run(1000 * STEP_US, fakeClock));
+    TEST_ASSERT_EQUAL_INT(3, scheduler->getCompleted());
+    checkChecksums();
+    TEST_ASSERT_EQUAL_INT(card->files["/b.jpg"].size() - savedCursor + card->files["/c.jpg"].size(),
+                          card->bytesRead - bytesBeforeReboot);
+
+    // The serials carry on after the reboot, a new save is never named as an old one
+    TEST_ASSERT_TRUE(scheduler->add(TASK_CHECKSUM, "/a.jpg"));
+    TEST_ASSERT_EQUAL_UINT32(4, scheduler->getTask(0)->serial);
+
+    // Power lost while the newest slot was written, the older one still loads
+    std::vector<uint8_t> torn = newest;
+    torn.resize(torn.size() / 2);
+    TEST_ASSERT_FALSE(scheduler->deserialize(torn.data(), torn.size()));
+    TEST_ASSERT_EQUAL_INT(0, scheduler->getPending());
+    const std::vector<uint8_t>& older = slots[2 & 1];
+    TEST_ASSERT_TRUE(scheduler->deserialize(older.data(), older.size()));
+    TEST_ASSERT_EQUAL_INT(2, scheduler->getSequence());
+    card->checksums.clear();
+    TEST_ASSERT_EQUAL_INT(DEVELOP_RUN_EMPTY, scheduler->run(1000 * STEP_US, fakeClock));
+    TEST_ASSERT_EQUAL_INT(3, scheduler->getCompleted());
+    TEST_ASSERT_EQUAL_INT(2, card->checksums.size());
+}
+
+void testRejectsDamagedQueue(void) {
+    addFile("/a.jpg", 3 * CHUNK_BYTES, 30);
+    scheduler->add(TASK_CHECKSUM, "/a.jpg");
+    scheduler->add(TASK_CHECKSUM, "/b.jpg");
+    scheduler->run(STEP_US, fakeClock);
+    uint8_t blob[DEVELOP_QUEUE_MAX_BLOB_BYTES];
+    size_t length = scheduler->serialize(blob, sizeof(blob));
+    TEST_ASSERT_EQUAL_INT(sizeof(DevelopQueueHeader) + 2 * sizeof(DevelopTask) + sizeof(uint32_t), length);
+    TEST_ASSERT_EQUAL_INT(0, scheduler->serialize(blob, length - 1));
+
+    DevelopScheduler loaded;
+    TEST_ASSERT_TRUE(loaded.deserialize(blob, length));
+    TEST_ASSERT_EQUAL_INT(2, loaded.getPending());
+    TEST_ASSERT_EQUAL_INT(CHUNK_BYTES, loaded.getTask(0)->cursor);
+
+    // Any flipped bit is caught
+    for (size_t i = 0; i < length; i++) {
+        blob[i] ^= 0x10;
+        TEST_ASSERT_FALSE(loaded.deserialize(blob, length));
+        TEST_ASSERT_EQUAL_INT(0, loaded.getPending());
+        blob[i] ^= 0x10;
+    }
+    TEST_ASSERT_FALSE(loaded.deserialize(blob, length - 1));
+    TEST_ASSERT_FALSE(loaded.deserialize(nullptr, length));
+    TEST_ASSERT_FALSE(loaded.deserialize(blob, 3));
+
+    // An empty queue saves and loads too
+    DevelopScheduler empty;
+    length = empty.serialize(blob, sizeof(blob));
+    TEST_ASSERT_TRUE(loaded.deserialize(blob, length));
+    TEST_ASSERT_EQUAL_INT(0, loaded.getPending());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testRunsTasksInOrder);
+    RUN_TEST(testAddRestartsAndRejects);
+    RUN_TEST(testSecondSaveBeforeChecksum);
+    RUN_TEST(testFailedTasksAreDropped);
+    RUN_TEST(testPreemptionLatency);
+    RUN_TEST(testResumesAfterReboot);
+    RUN_TEST(testRejectsDamagedQueue);
+    return UNITY_END();
+}
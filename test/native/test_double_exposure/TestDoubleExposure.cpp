@@ -0,0 +1,202 @@
+#include <unity.h>
+#include <math.h>
+#include <thread>
+#include <vector>
+#include <DoubleExposure.h>
+#include "../JpegTestSupport.h"
+
+#define FRAME_WIDTH 320
+#define FRAME_HEIGHT 240
+#define ARENA_BYTES (512 * 1024)
+
+JPEG_TEST_ARENA(ARENA_BYTES)
+
+// A bright disc on a dark background, in warm tones
+static std::vector<uint8_t> makePortrait() {
+    std::vector<uint8_t> ycc((size_t) FRAME_WIDTH * FRAME_HEIGHT * JPEG_YCC_BYTES);
+    for (int y = 0; y < FRAME_HEIGHT; y++) {
+        for (int x = 0; x < FRAME_WIDTH; x++) {
+            int dx = x - FRAME_WIDTH / 3;
+            int dy = y - FRAME_HEIGHT / 2;
+            bool disc = dx * dx + dy * dy < 80 * 80;
+            uint8_t* pixel = &ycc[((size_t) y * FRAME_WIDTH + x) * JPEG_YCC_BYTES];
+            pixel[0] = disc ? (uint8_t) (170 + dx / 4) : 20;
+            pixel[1] = disc ? 100 : 128;
+            pixel[2] = disc ? 170 : 128;
+        }
+    }
+    return ycc;
+}
+
+// Vertical stripes and a gradient, in cold tones
+static std::vector<uint8_t> makeTexture() {
+    std::vector<uint8_t> ycc((size_t) FRAME_WIDTH * FRAME_HEIGHT * JPEG_YCC_BYTES);
+    for (int y = 0; y < FRAME_HEIGHT; y++) {
+        for (int x = 0; x < FRAME_WIDTH; x++) {
+            uint8_t* pixel = &ycc[((size_t) y * FRAME_WIDTH + x) * JPEG_YCC_BYTES];
+            pixel[0] = (uint8_t) (60 + 50 * sin(x * 0.08) + 60 * y / FRAME_HEIGHT);
+            pixel[1] = 160;
+            pixel[2] = 110;
+        }
+    }
+    return ycc;
+}
+
+static double psnr(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, int channel) {
+    double error = 0;
+    size_t count = 0;
+    for (size_t i = channel; i < a.size(); i += JPEG_YCC_BYTES) {
+        double difference = (double) a[i] - b[i];
+        error += difference * difference;
+        count++;
+    }
+    return error == 0 ? 99.0 : 10.0 * log10(255.0 * 255.0 * count / error);
+}
+
+static void blendOne(const uint8_t* first, const uint8_t* second, uint8_t* out, const BlendConfig& config) {
+    DoubleExposure::blendPixels(first, second, out, 1, config);
+}
+
+void testScreenBlend() {
+    BlendConfig config;
+    uint8_t out[3];
+    const uint8_t black[3] = {0, 128, 128};
+    const uint8_t white[3] = {255, 128, 128};
+    const uint8_t gray[3] = {128, 90, 200};
+
+    // Black leaves the other exposure as it is, white stays white
+    blendOne(gray, black, out, config);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(gray, out, 3);
+    blendOne(white, gray, out, config);
+    TEST_ASSERT_EQUAL_UINT8(255, out[0]);
+
+    // Two mid grays: 1 - (1 - 0.5)^2
+    blendOne(gray, gray, out, config);
+    TEST_ASSERT_INT_WITHIN(1, 192, out[0]);
+    TEST_ASSERT_EQUAL_UINT8(90, out[1]);
+    TEST_ASSERT_EQUAL_UINT8(200, out[2]);
+}
+
+void testAdditiveBlendClipsAndWeights() {
+    BlendConfig config;
+    config.mode = BLEND_MODE_ADD;
+    uint8_t out[3];
+    const uint8_t dim[3] = {100, 128, 128};
+    const uint8_t bright[3] = {200, 128, 128};
+    blendOne(dim, dim, out, config);
+    TEST_ASSERT_EQUAL_UINT8(200, out[0]);
+    blendOne(dim, bright, out, config);
+    TEST_ASSERT_EQUAL_UINT8(255, out[0]);
+
+    // Each exposure one stop under gives the mean
+    config.firstWeight = BLEND_WEIGHT_ONE / 2;
+    config.secondWeight = BLEND_WEIGHT_ONE / 2;
+    blendOne(dim, bright, out, config);
+    TEST_ASSERT_EQUAL_UINT8(150, out[0]);
+}
+
+void testChromaFollowsTheLight() {
+    BlendConfig config;
+    uint8_t out[3];
+    // A colored subject over the dark part of the other exposure keeps its color
+    const uint8_t subject[3] = {200, 80, 190};
+    const uint8_t shadow[3] = {2, 200, 60};
+    blendOne(subject, shadow, out, config);
+    TEST_ASSERT_INT_WITHIN(4, 80, out[1]);
+    TEST_ASSERT_INT_WITHIN(4, 190, out[2]);
+
+    // Equal light gives the mean color
+    const uint8_t other[3] = {200, 176, 66};
+    blendOne(subject, other, out, config);
+    TEST_ASSERT_INT_WITHIN(1, 128, out[1]);
+    TEST_ASSERT_INT_WITHIN(1, 128, out[2]);
+}
+
+void testStreamedBlendMatchesPixelBlend() {
+    std::vector<uint8_t> first = encode(makePortrait(), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 90);
+    std::vector<uint8_t> second = encode(makeTexture(), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 90);
+
+    BlendConfig config;
+    DoubleExposure blend(arena, config);
+    std::vector<uint8_t> result;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, blend.write(first.data(), first.size(), second.data(), second.size(), writeToVector, &result));
+
+    // Same as blending the decoded frames, within the loss of one more encoding
+    std::vector<uint8_t> expected = decode(first);
+    std::vector<uint8_t> decodedSecond = decode(second);
+    DoubleExposure::blendPixels(expected.data(), decodedSecond.data(), expected.data(), (size_t) FRAME_WIDTH * FRAME_HEIGHT, config);
+    std::vector<uint8_t> blended = decode(result);
+    TEST_ASSERT_GREATER_THAN(36.0, psnr(expected, blended, 0));
+    TEST_ASSERT_GREATER_THAN(34.0, psnr(expected, blended, 1));
+    TEST_ASSERT_EQUAL_UINT32(0, arena->getUsed());
+}
+
+void testMemoryHighWater() {
+    std::vector<uint8_t> first = encode(makePortrait(), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 90);
+    std::vector<uint8_t> second = encode(makeTexture(), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 90);
+    size_t required = DoubleExposure::requiredBytes(FRAME_WIDTH, JPEG_SUBSAMPLING_422);
+
+    std::vector<uint8_t> budget(required);
+    ImageArena exact(budget.data(), budget.size());
+    DoubleExposure blend(&exact);
+    std::vector<uint8_t> result;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, blend.write(first.data(), first.size(), second.data(), second.size(), writeToVector, &result));
+    TEST_ASSERT_LESS_OR_EQUAL(required, exact.getHighWater());
+
+    // A few strips, not the decoded frames
+    TEST_ASSERT_LESS_THAN((size_t) FRAME_WIDTH * FRAME_HEIGHT * JPEG_YCC_BYTES / 4, exact.getHighWater());
+    // A full sensor frame blends in under a tenth of one decoded frame
+    TEST_ASSERT_LESS_THAN((size_t) 2560 * 1920 * JPEG_YCC_BYTES / 10, DoubleExposure::requiredBytes(2560, JPEG_SUBSAMPLING_422));
+
+    ImageArena tight(budget.data(), required / 2);
+    DoubleExposure starved(&tight);
+    result.clear();
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_MEMORY,
+                          starved.write(first.data(), first.size(), second.data(), second.size(), writeToVector, &result));
+    TEST_ASSERT_EQUAL_UINT32(0, tight.getUsed());
+}
+
+void testMismatchedExposuresAreRefused() {
+    std::vector<uint8_t> first = encode(makePortrait(), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 90);
+    std::vector<uint8_t> texture = makeTexture();
+    std::vector<uint8_t> small(texture.begin(), texture.begin() + (size_t) 64 * 64 * JPEG_YCC_BYTES);
+    std::vector<uint8_t> second = encode(small, 64, 64, JPEG_SUBSAMPLING_422, 90);
+    std::vector<uint8_t> garbage(500, 0x55);
+
+    DoubleExposure blend(arena);
+    std::vector<uint8_t> result;
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_UNSUPPORTED,
+                          blend.write(first.data(), first.size(), second.data(), second.size(), writeToVector, &result));
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_FORMAT,
+                          blend.write(first.data(), first.size(), garbage.data(), garbage.size(), writeToVector, &result));
+    TEST_ASSERT_EQUAL_UINT32(0, arena->getUsed());
+    TEST_ASSERT_EQUAL_UINT32(0, result.size());
+}
+
+void testLanesMatchSerial() {
+    std::vector<uint8_t> first = encode(makePortrait(), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 90);
+    std::vector<uint8_t> second = encode(makeTexture(), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 90);
+    BlendConfig config;
+    config.mode = BLEND_MODE_ADD;
+    DoubleExposure blend(arena, config);
+    ThreadStripRunner threaded;
+    std::vector<uint8_t> serialResult;
+    std::vector<uint8_t> threadedResult;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, blend.write(first.data(), first.size(), second.data(), second.size(), writeToVector, &serialResult));
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, blend.write(first.data(), first.size(), second.data(), second.size(), writeToVector,
+                                               &threadedResult, &threaded));
+    TEST_ASSERT_EQUAL_UINT32(serialResult.size(), threadedResult.size());
+    TEST_ASSERT_EQUAL_MEMORY(serialResult.data(), threadedResult.data(), serialResult.size());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testScreenBlend);
+    RUN_TEST(testAdditiveBlendClipsAndWeights);
+    RUN_TEST(testChromaFollowsTheLight);
+    RUN_TEST(testStreamedBlendMatchesPixelBlend);
+    RUN_TEST(testMemoryHighWater);
+    RUN_TEST(testMismatchedExposuresAreRefused);
+    RUN_TEST(testLanesMatchSerial);
+    return UNITY_END();
+}
@@ -0,0 +1,187 @@
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include <EventRing.h>
+
+static EventRing* ring;
+
+void setUp(void) {
+    ring = new EventRing();
+}
+
+void tearDown(void) {
+    delete ring;
+}
+
+// Build a button event
+static Event buttonEvent(int button) {
+    Event event = {EVENT_BUTTON, 0, {}};
+    event.payload.button = button;
+    return event;
+}
+
+void testEverySubscriberReceivesEveryEvent() {
+    int first = ring->subscribe(EVENT_MASK(EVENT_BUTTON));
+    int second = ring->subscribe(EVENT_MASK(EVENT_BUTTON));
+    TEST_ASSERT_NOT_EQUAL(first, second);
+
+    for (int i = 0; i < 10; i++) {
+        ring->publish(buttonEvent(i));
+    }
+
+    Event event;
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_TRUE(ring->poll(first, &event));
+        TEST_ASSERT_EQUAL_INT(i, event.payload.button);
+    }
+    TEST_ASSERT_FALSE(ring->poll(first, &event));
+
+    // The second cursor is independent from the first one
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_TRUE(ring->poll(second, &event));
+        TEST_ASSERT_EQUAL_INT(i, event.payload.button);
+    }
+    TEST_ASSERT_FALSE(ring->poll(second, &event));
+}
+
+void testSubscriberOnlySeesLaterEvents() {
+    ring->publish(buttonEvent(1));
+    int id = ring->subscribe(EVENT_MASK(EVENT_BUTTON));
+    ring->publish(buttonEvent(2));
+
+    Event event;
+    TEST_ASSERT_TRUE(ring->poll(id, &event));
+    TEST_ASSERT_EQUAL_INT(2, event.payload.button);
+    TEST_ASSERT_FALSE(ring->poll(id, &event));
+}
+
+void testTypeMaskFiltersEvents() {
+    int buttons = ring->subscribe(EVENT_MASK(EVENT_BUTTON));
+    int results = ring->subscribe(EVENT_MASK(EVENT_SAVE_RESULT) | EVENT_MASK(EVENT_BATTERY_LEVEL));
+
+    Event battery = {EVENT_BATTERY_LEVEL, 0, {}};
+    battery.payload.batteryLevel = 42.5f;
+    Event save = {EVENT_SAVE_RESULT, 0, {}};
+    save.payload.saveResult = {3, "No SD Card attached"};
+    ring->publish(buttonEvent(1));
+    ring->publish(battery);
+    ring->publish(save);
+
+    TEST_ASSERT_EQUAL_UINT32(1u << buttons, ring->getSubscribersForType(EVENT_BUTTON));
+    TEST_ASSERT_EQUAL_UINT32(1u << results, ring->getSubscribersForType(EVENT_SAVE_RESULT));
+    TEST_ASSERT_EQUAL_UINT32(0, ring->getSubscribersForType(EVENT_FILM_STATUS));
+
+    Event event;
+    TEST_ASSERT_TRUE(ring->poll(buttons, &event));
+    TEST_ASSERT_EQUAL_INT(EVENT_BUTTON, event.type);
+    TEST_ASSERT_FALSE(ring->poll(buttons, &event));
+
+    TEST_ASSERT_TRUE(ring->poll(results, &event));
+    TEST_ASSERT_EQUAL_INT(EVENT_BATTERY_LEVEL, event.type);
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 42.5, event.payload.batteryLevel);
+    TEST_ASSERT_TRUE(ring->poll(results, &event));
+    TEST_ASSERT_EQUAL_INT(EVENT_SAVE_RESULT, event.type);
+    TEST_ASSERT_EQUAL_INT(3, event.payload.saveResult.code);
+    TEST_ASSERT_FALSE(ring->poll(results, &event));
+}
+
+void testSlowSubscriberOverrun() {
+    int id = ring->subscribe(EVENT_MASK(EVENT_BUTTON));
+    for (int i = 0; i < EVENT_RING_SIZE + 5; i++) {
+        ring->publish(buttonEvent(i));
+    }
+
+    // The five oldest events were overwritten
+    Event event;
+    TEST_ASSERT_TRUE(ring->poll(id, &event));
+    TEST_ASSERT_EQUAL_INT(5, event.payload.button);
+    TEST_ASSERT_EQUAL_UINT32(5, ring->getOverruns(id));
+
+    int count = 1;
+    while (ring->poll(id, &event)) {
+        count++;
+    }
+    TEST_ASSERT_EQUAL_INT(EVENT_RING_SIZE, count);
+    TEST_ASSERT_EQUAL_INT(EVENT_RING_SIZE + 4, event.payload.button);
+}
+
+void testSubscriberSlotsAreReused() {
+    int ids[MAX_EVENT_SUBSCRIBERS];
+    for (int i = 0; i < MAX_EVENT_SUBSCRIBERS; i++) {
+        ids[i] = ring->subscribe(EVENT_MASK(EVENT_BUTTON));
+        TEST_ASSERT_GREATER_OR_EQUAL(0, ids[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(-1, ring->subscribe(EVENT_MASK(EVENT_BUTTON)));
+
+    ring->unsubscribe(ids[3]);
+    TEST_ASSERT_EQUAL_UINT32(0, ring->getSubscribersForType(EVENT_BUTTON) & (1u << ids[3]));
+    TEST_ASSERT_EQUAL_INT(ids[3], ring->subscribe(EVENT_MASK(EVENT_BATTERY_LEVEL)));
+
+    Event event;
+    TEST_ASSERT_FALSE(ring->poll(-1, &event));
+    TEST_ASSERT_FALSE(ring->poll(MAX_EVENT_SUBSCRIBERS, &event));
+}
+
+#define BENCHMARK_EVENTS 1000000
+
+// Measure the cost of publishing with a given number of subscribers that keep up with the writer
+static double publishNanoseconds(int subscribers, double* consumeNanoseconds) {
+    EventRing benchmarkRing;
+    int ids[MAX_EVENT_SUBSCRIBERS];
+    for (int i = 0; i < subscribers; i++) {
+        ids[i] = benchmarkRing.subscribe(EVENT_MASK(EVENT_BUTTON));
+    }
+
+    Event event = buttonEvent(0);
+    volatile int sink = 0;
+    std::chrono::nanoseconds publishTime(0);
+    std::chrono::nanoseconds consumeTime(0);
+    for (int batch = 0; batch < BENCHMARK_EVENTS / (EVENT_RING_SIZE / 2); batch++) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < EVENT_RING_SIZE / 2; i++) {
+            event.payload.button = i;
+            benchmarkRing.publish(event);
+        }
+        auto published = std::chrono::steady_clock::now();
+        for (int s = 0; s < subscribers; s++) {
+            Event received;
+            while (benchmarkRing.poll(ids[s], &received)) {
+                sink += received.payload.button;
+            }
+        }
+        consumeTime += std::chrono::steady_clock::now() - published;
+        publishTime += published - start;
+    }
+
+    if (consumeNanoseconds != nullptr) {
+        int reads = subscribers > 0 ? subscribers : 1;
+        *consumeNanoseconds = (double) consumeTime.count() / ((double) BENCHMARK_EVENTS * reads);
+    }
+    return (double) publishTime.count() / BENCHMARK_EVENTS;
+}
+
+void benchmarkPublishAndConsume() {
+    double oneConsume = 0;
+    double allConsume = 0;
+    double one = publishNanoseconds(1, &oneConsume);
+    double all = publishNanoseconds(MAX_EVENT_SUBSCRIBERS, &allConsume);
+
+    char message[160];
+    snprintf(message, sizeof(message), "publish: %.1f ns (1 subscriber), %.1f ns (%d subscribers); consume: %.1f ns, %.1f ns per event",
+             one, all, MAX_EVENT_SUBSCRIBERS, oneConsume, allConsume);
+    TEST_MESSAGE(message);
+
+    // Publishing must not scale with the number of subscribers
+    TEST_ASSERT_LESS_THAN(one * 3 + 5, all);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testEverySubscriberReceivesEveryEvent);
+    RUN_TEST(testSubscriberOnlySeesLaterEvents);
+    RUN_TEST(testTypeMaskFiltersEvents);
+    RUN_TEST(testSlowSubscriberOverrun);
+    RUN_TEST(testSubscriberSlotsAreReused);
+    RUN_TEST(benchmarkPublishAndConsume);
+    return UNITY_END();
+}
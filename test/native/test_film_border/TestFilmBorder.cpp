@@ -0,0 +1,256 @@
+#include <unity.h>
+#include <math.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <FilmBorder.h>
+#include <JpegDct.h>
+#include "../JpegTestSupport.h"
+
+#define FRAME_WIDTH 320
+#define FRAME_HEIGHT 96
+#define ARENA_BYTES (64 * 1024)
+
+#define REBATE_LUMA 20
+#define HOLE_LUMA 235
+#define FONT_CHARACTERS "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ->"
+
+JPEG_TEST_ARENA(ARENA_BYTES)
+
+// Tiles built the way scripts/border_to_code.py builds them, from a luma pattern on neutral chroma
+struct TestTile {
+    std::vector<uint32_t> mcus;
+    std::vector<int16_t> coefficients;
+    BorderTile tile;
+};
+
+static TestTile rebateTile;
+static TestTile sprocketTile;
+static TestTile fontTile;
+static BorderArt art;
+
+static uint8_t rebateLuma(int x, int y) {
+    return REBATE_LUMA;
+}
+
+static uint8_t sprocketLuma(int x, int y) {
+    return x >= 16 && x < 48 && y >= 8 && y < 56 ? HOLE_LUMA : REBATE_LUMA;
+}
+
+// Each glyph is a box with its own luma, so the test can tell which one was placed
+static uint8_t fontLuma(int x, int y) {
+    int glyph = x / 16;
+    return x % 16 >= 4 && x % 16 < 12 && y >= 2 && y < 14 ? (uint8_t) (60 + 4 * glyph) : REBATE_LUMA;
+}
+
+static void codeBlock(const uint8_t* samples, std::vector<int16_t>* out) {
+    int16_t coefficients[JPEG_BLOCK_SIZE];
+    jpegForwardDct(samples, 8, coefficients);
+    size_t countAt = out->size();
+    out->push_back(0);
+    out->push_back(coefficients[0]);
+    for (int i = 1; i < JPEG_BLOCK_SIZE; i++) {
+        if (coefficients[i] != 0) {
+            out->push_back((int16_t) i);
+            out->push_back(coefficients[i]);
+            (*out)[countAt]++;
+        }
+    }
+}
+
+static void buildTile(TestTile* tile, int width, int height, uint8_t (*luma)(int, int)) {
+    tile->mcus.clear();
+    tile->coefficients.clear();
+    uint8_t neutral[JPEG_BLOCK_SIZE];
+    memset(neutral, 128, sizeof(neutral));
+    for (int mcuY = 0; mcuY < height; mcuY += 8) {
+        for (int mcuX = 0; mcuX < width; mcuX += 16) {
+            tile->mcus.push_back((uint32_t) tile->coefficients.size());
+            for (int blockX = 0; blockX < 16; blockX += 8) {
+                uint8_t samples[JPEG_BLOCK_SIZE];
+                for (int i = 0; i < JPEG_BLOCK_SIZE; i++) {
+                    samples[i] = luma(mcuX + blockX + i % 8, mcuY + i / 8);
+                }
+                codeBlock(samples, &tile->coefficients);
+            }
+            codeBlock(neutral, &tile->coefficients);
+            codeBlock(neutral, &tile->coefficients);
+        }
+    }
+    tile->tile = {(uint16_t) width, (uint16_t) height, tile->mcus.data(), tile->coefficients.data()};
+}
+
+// The tiles are built once, every test borders with the same art
+static void buildArt() {
+    buildTile(&rebateTile, 16, 8, rebateLuma);
+    buildTile(&sprocketTile, 64, 64, sprocketLuma);
+    buildTile(&fontTile, 16 * (int) strlen(FONT_CHARACTERS), 16, fontLuma);
+    art = {&rebateTile.tile, &sprocketTile.tile, &fontTile.tile, FONT_CHARACTERS};
+}
+
+static std::vector<uint8_t> border(const std::vector<uint8_t>& jpeg, const char* filmName, const char* frameLabel,
+                                   FilmBorder* bordered = nullptr) {
+    FilmBorder local(arena, art);
+    FilmBorder* used = bordered != nullptr ? bordered : &local;
+    std::vector<uint8_t> out;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, used->write(jpeg.data(), jpeg.size(), filmName, frameLabel, writeToVector, &out));
+    TEST_ASSERT_EQUAL_UINT32(0, arena->getUsed());
+    return out;
+}
+
+// The frame inside the rebate decodes to the pixels of the source
+static void checkFrameIsKept(const std::vector<uint8_t>& source, const std::vector<uint8_t>& bordered) {
+    int width, height;
+    std::vector<uint8_t> result = decode(bordered, &width, &height);
+    TEST_ASSERT_EQUAL_INT(FRAME_WIDTH, width);
+    TEST_ASSERT_EQUAL_INT(FRAME_HEIGHT + 2 * FILM_BORDER_HEIGHT, height);
+    std::vector<uint8_t> original = decode(source);
+    size_t rowBytes = (size_t) FRAME_WIDTH * JPEG_YCC_BYTES;
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(original.data(), &result[FILM_BORDER_HEIGHT * rowBytes], original.size());
+}
+
+static int lumaAt(const std::vector<uint8_t>& ycc, int x, int y) {
+    return ycc[((size_t) y * FRAME_WIDTH + x) * JPEG_YCC_BYTES];
+}
+
+void testFrameIsKeptInsideTheRebate() {
+    std::vector<uint8_t> source = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85);
+    FilmBorder bordered(arena, art);
+    std::vector<uint8_t> out = border(source, "test_film", "12 >12A", &bordered);
+    checkFrameIsKept(source, out);
+
+    // Only the first MCU is coded again, the rest of the scan is copied at its new alignment
+    char message[128];
+    snprintf(message, sizeof(message), "%u KB frame, %u KB bordered, %d rebate MCUs", (unsigned) (source.size() / 1024),
+             (unsigned) (out.size() / 1024), bordered.getBorderMcus());
+    TEST_MESSAGE(message);
+    TEST_ASSERT_EQUAL_INT(2 * (FILM_BORDER_HEIGHT / 8) * (FRAME_WIDTH / 16), bordered.getBorderMcus());
+    TEST_ASSERT_EQUAL_INT(1, bordered.getRecodedMcus());
+    JpegDecoder decoder;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.begin(source.data(), source.size(), nullptr));
+    TEST_ASSERT_TRUE(bordered.getCopiedBytes() > (source.size() - decoder.getScanStart()) * 9 / 10);
+}
+
+void testHolesAndEdgePrint() {
+    std::vector<uint8_t> source = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85);
+    std::vector<uint8_t> result = decode(border(source, "b_", "1z?"));
+
+    // A hole centered in each pitch, on the outer edge of both rebates
+    int bottom = FILM_BORDER_HEIGHT + FRAME_HEIGHT;
+    for (int hole = 0; hole < FRAME_WIDTH / FILM_BORDER_HOLE_PITCH; hole++) {
+        int center = hole * FILM_BORDER_HOLE_PITCH + FILM_BORDER_HOLE_PITCH / 2;
+        TEST_ASSERT_INT_WITHIN(4, HOLE_LUMA, lumaAt(result, center, FILM_BORDER_HOLE_EDGE + 32));
+        TEST_ASSERT_INT_WITHIN(4, HOLE_LUMA, lumaAt(result, center, bottom + FILM_BORDER_HEIGHT - FILM_BORDER_HOLE_EDGE - 32));
+        TEST_ASSERT_INT_WITHIN(4, REBATE_LUMA, lumaAt(result, center - 40, FILM_BORDER_HOLE_EDGE + 32));
+        TEST_ASSERT_INT_WITHIN(4, REBATE_LUMA, lumaAt(result, center, 4));
+        TEST_ASSERT_INT_WITHIN(4, REBATE_LUMA, lumaAt(result, center, bottom + FILM_BORDER_HEIGHT - 4));
+    }
+
+    // Film name in capitals above, frame label below, unknown characters and spaces left plain
+    const char* font = FONT_CHARACTERS;
+    int top = FILM_BORDER_TEXT_EDGE + 8;
+    int below = bottom + FILM_BORDER_HEIGHT - FILM_BORDER_TEXT_EDGE - 8;
+    int x = FILM_BORDER_TEXT_LEFT + 8;
+    TEST_ASSERT_INT_WITHIN(4, 60 + 4 * (strchr(font, 'B') - font), lumaAt(result, x, top));
+    TEST_ASSERT_INT_WITHIN(4, REBATE_LUMA, lumaAt(result, x + 16, top));
+    TEST_ASSERT_INT_WITHIN(4, REBATE_LUMA, lumaAt(result, x - 16, top));
+    TEST_ASSERT_INT_WITHIN(4, 60 + 4 * (strchr(font, '1') - font), lumaAt(result, x, below));
+    TEST_ASSERT_INT_WITHIN(4, 60 + 4 * (strchr(font, 'Z') - font), lumaAt(result, x + 16, below));
+    TEST_ASSERT_INT_WITHIN(4, REBATE_LUMA, lumaAt(result, x + 32, below));
+}
+
+void testRestartIntervals() {
+    std::vector<uint8_t> scene = makeScene(FRAME_WIDTH, FRAME_HEIGHT);
+    int rebateMcus = (FILM_BORDER_HEIGHT / 8) * (FRAME_WIDTH / 16);
+    int frameMcus = (FRAME_HEIGHT / 8) * (FRAME_WIDTH / 16);
+
+    // 40 lines up with the rebate and the frame, 64 with the rebate only, 7 with neither
+    const uint16_t intervals[] = {40, 64, 7};
+    const int recoded[] = {0, 0, frameMcus};
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(i == 0, rebateMcus % intervals[i] == 0 && frameMcus % intervals[i] == 0);
+        std::vector<uint8_t> source = encode(scene, FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85, intervals[i]);
+        FilmBorder bordered(arena, art);
+        std::vector<uint8_t> out = border(source, "film", "3", &bordered);
+        checkFrameIsKept(source, out);
+        JpegDecoder decoder;
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.begin(out.data(), out.size(), nullptr));
+        TEST_ASSERT_EQUAL_UINT16(intervals[i], decoder.getRestartInterval());
+        TEST_ASSERT_EQUAL_INT(recoded[i], bordered.getRecodedMcus());
+        TEST_ASSERT_EQUAL_UINT32(recoded[i] == 0, bordered.getCopiedBytes() > 0);
+    }
+}
+
+void testUnsupportedFramesAndMemory() {
+    std::vector<uint8_t> scene = makeScene(FRAME_WIDTH, FRAME_HEIGHT);
+    FilmBorder bordered(arena, art);
+    std::vector<uint8_t> out;
+
+    // The tiles are 4:2:2 MCUs, and the rebate needs the frame to end on a whole MCU row
+    std::vector<uint8_t> subsampled = encode(scene, FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_420, 85);
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_UNSUPPORTED, bordered.write(subsampled.data(), subsampled.size(), "a", "1", writeToVector, &out));
+    std::vector<uint8_t> partial = encode(scene, FRAME_WIDTH, FRAME_HEIGHT - 4, JPEG_SUBSAMPLING_422, 85);
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_UNSUPPORTED, bordered.write(partial.data(), partial.size(), "a", "1", writeToVector, &out));
+    uint8_t garbage[64] = {0xFF, 0xD8, 0x12};
+    TEST_ASSERT_NOT_EQUAL(JPEG_OK, bordered.write(garbage, sizeof(garbage), "a", "1", writeToVector, &out));
+    TEST_ASSERT_EQUAL_UINT32(0, arena->getUsed());
+
+    // A scan cut short runs into the end of the file
+    std::vector<uint8_t> source = encode(scene, FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85);
+    std::vector<uint8_t> cut(source.begin(), source.begin() + source.size() / 2);
+    cut.push_back(0xFF);
+    cut.push_back(0xD9);
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_DATA, bordered.write(cut.data(), cut.size(), "a", "1", writeToVector, &out));
+    TEST_ASSERT_EQUAL_UINT32(0, arena->getUsed());
+
+    // The bound is enough, less is refused without writing past the arena
+    std::vector<uint8_t> exact(FilmBorder::requiredBytes());
+    ImageArena exactArena(exact.data(), exact.size());
+    FilmBorder fitting(&exactArena, art);
+    out.clear();
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, fitting.write(source.data(), source.size(), "a", "1", writeToVector, &out));
+    ImageArena tightArena(exact.data(), exact.size() / 2);
+    FilmBorder tight(&tightArena, art);
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_MEMORY, tight.write(source.data(), source.size(), "a", "1", writeToVector, &out));
+    TEST_ASSERT_EQUAL_UINT32(0, tightArena.getUsed());
+}
+
+void testThroughput() {
+    // QSXGA, the sensor frame
+    const int width = 2560;
+    const int height = 1920;
+    std::vector<uint8_t> source = encode(makeScene(width, height), width, height, JPEG_SUBSAMPLING_422, 85);
+
+    // A copy of the frame is the floor
+    auto start = std::chrono::steady_clock::now();
+    std::vector<uint8_t> copy;
+    writeToVector(&copy, source.data(), source.size());
+    double copyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    FilmBorder bordered(arena, art);
+    std::vector<uint8_t> out;
+    out.reserve(source.size() * 2);
+    start = std::chrono::steady_clock::now();
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, bordered.write(source.data(), source.size(), "test_film", "12 >12A", writeToVector, &out));
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    char message[160];
+    snprintf(message, sizeof(message), "%.1f ms, %.1f MB/s of a %.0f KB frame, %.0f KB of rebate, copy %.2f ms", ms,
+             source.size() / (1024.0 * 1024.0) / (ms / 1000.0), source.size() / 1024.0,
+             ((double) out.size() - source.size()) / 1024.0, copyMs);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_EQUAL_INT(1, bordered.getRecodedMcus());
+}
+
+int main() {
+    buildArt();
+    UNITY_BEGIN();
+    RUN_TEST(testFrameIsKeptInsideTheRebate);
+    RUN_TEST(testHolesAndEdgePrint);
+    RUN_TEST(testRestartIntervals);
+    RUN_TEST(testUnsupportedFramesAndMemory);
+    RUN_TEST(testThroughput);
+    return UNITY_END();
+}
@@ -0,0 +1,250 @@
+#include <unity.h>
+#include <math.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include <FilmGrain.h>
+#include <FilmProcess.h>
+#include <GrainTiles.h>
+#include <JpegTables.h>
+
+#define FRAME_WIDTH 256
+#define FRAME_HEIGHT 128
+#define BENCH_WIDTH 1280
+#define BENCH_HEIGHT 1024
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static std::vector<uint8_t> makeFlatFrame(int width, int height, uint8_t luma) {
+    std::vector<uint8_t> frame((size_t) width * height * JPEG_YCC_BYTES);
+    for (size_t i = 0; i < frame.size(); i += JPEG_YCC_BYTES) {
+        frame[i] = luma;
+        frame[i + 1] = 128;
+        frame[i + 2] = 128;
+    }
+    return frame;
+}
+
+// Mean and variance of the luma minus a level
+static void lumaStatistics(const std::vector<uint8_t>& frame, int level, double* mean, double* variance) {
+    double sum = 0;
+    double squares = 0;
+    size_t count = frame.size() / JPEG_YCC_BYTES;
+    for (size_t i = 0; i < frame.size(); i += JPEG_YCC_BYTES) {
+        double difference = frame[i] - level;
+        sum += difference;
+        squares += difference * difference;
+    }
+    *mean = sum / count;
+    *variance = squares / count - *mean * *mean;
+}
+
+void testTileIsZeroMeanAndSpread(void) {
+    for (int t = 0; t < GRAIN_TILE_COUNT; t++) {
+        const GrainTile* tile = GRAIN_TILES[t].tile;
+        int count = tile->size * tile->size;
+        double sum = 0;
+        int low = 0;
+        int high = 0;
+        for (int i = 0; i < count; i++) {
+            sum += tile->noise[i];
+            low += tile->noise[i] < -100;
+            high += tile->noise[i] > 100;
+        }
+        // The ranks are spread evenly, every part of the range is used as much
+        TEST_ASSERT_TRUE_MESSAGE(fabs(sum / count) < 0.5, GRAIN_TILES[t].name);
+        TEST_ASSERT_TRUE_MESSAGE(abs(low - high) <= count / 100, GRAIN_TILES[t].name);
+        TEST_ASSERT_TRUE_MESSAGE(low > count / 10, GRAIN_TILES[t].name);
+    }
+}
+
+void testTilesAreFoundByFilmName(void) {
+    TEST_ASSERT_EQUAL_PTR(&TEST_FILM_GRAIN_TILE, findGrainTile("test_film"));
+    TEST_ASSERT_EQUAL_PTR(&MONO_400_GRAIN_TILE, findGrainTile("mono_400"));
+
+    // Films without a grain file have no tile, the caller develops them without grain
+    TEST_ASSERT_NULL(findGrainTile("test_fil"));
+    TEST_ASSERT_NULL(findGrainTile(""));
+    TEST_ASSERT_NULL(findGrainTile(nullptr));
+    FilmGrain grain;
+    grain.setTile(findGrainTile("no_such_film"));
+    TEST_ASSERT_FALSE(grain.isEnabled());
+}
+
+void testTileHasABlueSpectrum(void) {
+    const GrainTile* tile = &TEST_FILM_GRAIN_TILE;
+    int size = tile->size;
+
+    // Power spectrum by a separable DFT, rows then columns
+    std::vector<double> realRows((size_t) size * size), imagRows((size_t) size * size);
+    for (int y = 0; y < size; y++) {
+        for (int u = 0; u < size; u++) {
+            double re = 0, im = 0;
+            for (int x = 0; x < size; x++) {
+                double angle = -2 * M_PI * u * x / size;
+                re += tile->noise[y * size + x] * cos(angle);
+                im += tile->noise[y * size + x] * sin(angle);
+            }
+            realRows[y * size + u] = re;
+            imagRows[y * size + u] = im;
+        }
+    }
+    double lowPower = 0;
+    double totalPower = 0;
+    int lowBins = 0;
+    for (int v = 0; v < size; v++) {
+        for (int u = 0; u < size; u++) {
+            double re = 0, im = 0;
+            for (int y = 0; y < size; y++) {
+                double angle = -2 * M_PI * v * y / size;
+                re += realRows[y * size + u] * cos(angle) - imagRows[y * size + u] * sin(angle);
+                im += realRows[y * size + u] * sin(angle) + imagRows[y * size + u] * cos(angle);
+            }
+            if (u == 0 && v == 0) {
+                continue;
+            }
+            int fu = u < size / 2 ? u : size - u;
+            int fv = v < size / 2 ? v : size - v;
+            double power = re * re + im * im;
+            totalPower += power;
+            if (fu * fu + fv * fv < (size / 8) * (size / 8)) {
+                lowPower += power;
+                lowBins++;
+            }
+        }
+    }
+    // White noise would put a share of its power in the low band as large as its share of the bins
+    double whiteShare = (double) lowBins / (size * size - 1);
+    double lowShare = lowPower / totalPower;
+    char message[96];
+    snprintf(message, sizeof(message), "Low band: %.2f%% of the power, %.2f%% for white noise", lowShare * 100, whiteShare * 100);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(lowShare < whiteShare / 4);
+}
+
+void testGrainMeanAndVarianceFollowTheResponse(void) {
+    FilmGrain grain;
+    grain.setTile(&TEST_FILM_GRAIN_TILE);
+    TEST_ASSERT_TRUE(grain.isEnabled());
+    int levels[] = {24, 96, 200};
+    for (int level : levels) {
+        std::vector<uint8_t> frame = makeFlatFrame(FRAME_WIDTH, FRAME_HEIGHT, (uint8_t) level);
+        grain.applyStrip(frame.data(), FRAME_WIDTH * JPEG_YCC_BYTES, FRAME_WIDTH, FRAME_HEIGHT, 0);
+        double mean, variance;
+        lumaStatistics(frame, level, &mean, &variance);
+        double expected = TEST_FILM_GRAIN_TILE.strength / 10.0 *
+                          TEST_FILM_GRAIN_TILE.response[level >> FILM_GRAIN_RESPONSE_SHIFT] / 100.0;
+        char message[96];
+        snprintf(message, sizeof(message), "Luma %d: mean %+.3f, deviation %.2f, expected %.2f", level, mean, sqrt(variance),
+                 expected);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_TRUE(fabs(mean) < 0.1);
+        TEST_ASSERT_TRUE(fabs(sqrt(variance) - expected) < expected * 0.1 + 0.1);
+        // Chroma is left alone
+        TEST_ASSERT_EQUAL_INT(128, frame[1]);
+        TEST_ASSERT_EQUAL_INT(128, frame[2]);
+    }
+}
+
+void testFramesMoveTheTileAndStripsLineUp(void) {
+    FilmGrain grain;
+    grain.setTile(&TEST_FILM_GRAIN_TILE);
+    grain.newFrame(0x00120034);
+    std::vector<uint8_t> whole = makeFlatFrame(FRAME_WIDTH, FRAME_HEIGHT, 100);
+    grain.applyStrip(whole.data(), FRAME_WIDTH * JPEG_YCC_BYTES, FRAME_WIDTH, FRAME_HEIGHT, 0);
+
+    // Strips of 8 rows placed by their top row give the same frame
+    std::vector<uint8_t> strips = makeFlatFrame(FRAME_WIDTH, FRAME_HEIGHT, 100);
+    for (int top = 0; top < FRAME_HEIGHT; top += 8) {
+        grain.applyStrip(strips.data() + (size_t) top * FRAME_WIDTH * JPEG_YCC_BYTES, FRAME_WIDTH * JPEG_YCC_BYTES, FRAME_WIDTH, 8,
+                         top);
+    }
+    TEST_ASSERT_EQUAL_MEMORY(whole.data(), strips.data(), whole.size());
+
+    // Another frame, another place
+    grain.newFrame(0x00070021);
+    std::vector<uint8_t> next = makeFlatFrame(FRAME_WIDTH, FRAME_HEIGHT, 100);
+    grain.applyStrip(next.data(), FRAME_WIDTH * JPEG_YCC_BYTES, FRAME_WIDTH, FRAME_HEIGHT, 0);
+    TEST_ASSERT_TRUE(memcmp(whole.data(), next.data(), whole.size()) != 0);
+
+    // Without a tile nothing is added
+    FilmGrain none;
+    none.setTile(nullptr);
+    TEST_ASSERT_FALSE(none.isEnabled());
+    std::vector<uint8_t> plain = makeFlatFrame(FRAME_WIDTH, FRAME_HEIGHT, 100);
+    none.applyStrip(plain.data(), FRAME_WIDTH * JPEG_YCC_BYTES, FRAME_WIDTH, FRAME_HEIGHT, 0);
+    TEST_ASSERT_EQUAL_MEMORY(makeFlatFrame(FRAME_WIDTH, FRAME_HEIGHT, 100).data(), plain.data(), plain.size());
+}
+
+void testFilmProcessAddsGrainAfterTheCurves(void) {
+    FilmGrain grain;
+    grain.setTile(&TEST_FILM_GRAIN_TILE);
+    grain.newFrame(0x00050009);
+    FilmLook look = {40, 80};
+    FilmProcess process;
+    process.setLook(look);
+    process.setGrain(&grain);
+    TEST_ASSERT_FALSE(process.isNeutral());
+
+    std::vector<uint8_t> frame((size_t) FRAME_WIDTH * 16 * JPEG_YCC_BYTES);
+    for (size_t i = 0; i < frame.size(); i++) {
+        frame[i] = (uint8_t) (i * 7 + i / 97);
+    }
+    std::vector<uint8_t> expected = frame;
+    FilmProcess curves;
+    curves.setLook(look);
+    curves.processStrip(expected.data(), FRAME_WIDTH * JPEG_YCC_BYTES, FRAME_WIDTH, 16);
+    grain.applyStrip(expected.data(), FRAME_WIDTH * JPEG_YCC_BYTES, FRAME_WIDTH, 16, 40);
+    process.processStrip(frame.data(), FRAME_WIDTH * JPEG_YCC_BYTES, FRAME_WIDTH, 16, 40);
+    TEST_ASSERT_EQUAL_MEMORY(expected.data(), frame.data(), frame.size());
+
+    process.setGrain(nullptr);
+    process.setLook(FILM_LOOK_NEUTRAL);
+    TEST_ASSERT_TRUE(process.isNeutral());
+}
+
+static double measure(const FilmProcess& process, std::vector<uint8_t>& frame) {
+    int repeats = 5;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        for (int top = 0; top < BENCH_HEIGHT; top += 16) {
+            process.processStrip(frame.data() + (size_t) top * BENCH_WIDTH * JPEG_YCC_BYTES, BENCH_WIDTH * JPEG_YCC_BYTES,
+                                 BENCH_WIDTH, 16, top);
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / repeats;
+    return BENCH_WIDTH * BENCH_HEIGHT / seconds / 1e6;
+}
+
+void testThroughput(void) {
+    std::vector<uint8_t> frame = makeFlatFrame(BENCH_WIDTH, BENCH_HEIGHT, 110);
+    FilmLook look = {20, 90};
+    FilmProcess curves;
+    curves.setLook(look);
+    FilmGrain grain;
+    grain.setTile(&TEST_FILM_GRAIN_TILE);
+    FilmProcess grainy;
+    grainy.setLook(look);
+    grainy.setGrain(&grain);
+    double curvesRate = measure(curves, frame);
+    double grainRate = measure(grainy, frame);
+    char message[128];
+    snprintf(message, sizeof(message), "%dx%d film process: %.1f MP/s curves only, %.1f MP/s with grain", BENCH_WIDTH,
+             BENCH_HEIGHT, curvesRate, grainRate);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(grainRate > 0);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testTileIsZeroMeanAndSpread);
+    RUN_TEST(testTilesAreFoundByFilmName);
+    RUN_TEST(testTileHasABlueSpectrum);
+    RUN_TEST(testGrainMeanAndVarianceFollowTheResponse);
+    RUN_TEST(testFramesMoveTheTileAndStripsLineUp);
+    RUN_TEST(testFilmProcessAddsGrainAfterTheCurves);
+    RUN_TEST(testThroughput);
+    return UNITY_END();
+}
@@ -0,0 +1,266 @@
+#include <string.h>
+#include <unity.h>
+#include <random>
+#include <string>
+#include <vector>
+#include <FilmRegistry.h>
+
+static const char STOCKS[] =
+    "# Film stocks of the card\n"
+    "[test_film]\n"
+    "capacity = 36\n"
+    "contrast = 20   ; a little punch\n"
+    "saturation = 90\n"
+    "\n"
+    "[mono_400]\r\n"
+    "  capacity=24\r\n"
+    "saturation = 0\r\n"
+    "contrast = -15\r\n"
+    "jpeg_quality = 10\r\n"
+    "frame_size = 13\r\n"
+    "xclk_mhz = 20\r\n"
+    "[slide_100]\n"
+    "capacity = 12";
+
+static FilmRegistry* registry;
+
+void setUp(void) {
+    registry = new FilmRegistry();
+}
+
+void tearDown(void) {
+    delete registry;
+}
+
+static int parse(FilmRegistry* target, const std::string& text) {
+    return target->parse(text.data(), text.size());
+}
+
+// Every film is found at its index and nothing else is
+static void checkLookups(const FilmRegistry& target) {
+    for (int i = 0; i < target.getCount(); i++) {
+        const FilmStock* stock = target.getStock(i);
+        TEST_ASSERT_NOT_NULL(stock);
+        TEST_ASSERT_EQUAL_INT(i, target.find(stock->name));
+        TEST_ASSERT_TRUE(stock->capacity >= 1 && stock->capacity <= 999);
+    }
+    TEST_ASSERT_NULL(target.getStock(target.getCount()));
+    TEST_ASSERT_EQUAL_INT(-1, target.find("no_such_film"));
+    TEST_ASSERT_EQUAL_INT(-1, target.find(""));
+}
+
+void testParsesStocks(void) {
+    TEST_ASSERT_EQUAL_INT(3, registry->parse(STOCKS, strlen(STOCKS)));
+    TEST_ASSERT_EQUAL_INT(0, registry->getErrorLine());
+    checkLookups(*registry);
+
+    const FilmStock* test = registry->getStock(registry->find("test_film"));
+    TEST_ASSERT_EQUAL_INT(36, test->capacity);
+    TEST_ASSERT_EQUAL_INT(20, test->contrast);
+    TEST_ASSERT_EQUAL_INT(90, test->saturation);
+    TEST_ASSERT_EQUAL_INT(FILM_STOCK_SENSOR_UNSET, test->sensor.frameSize);
+    TEST_ASSERT_EQUAL_INT(FILM_STOCK_SENSOR_UNSET, test->sensor.jpegQuality);
+
+    const FilmStock* mono = registry->getStock(1);
+    TEST_ASSERT_EQUAL_STRING("mono_400", mono->name);
+    TEST_ASSERT_EQUAL_INT(24, mono->capacity);
+    TEST_ASSERT_EQUAL_INT(-15, mono->contrast);
+    TEST_ASSERT_EQUAL_INT(0, mono->saturation);
+    TEST_ASSERT_EQUAL_INT(13, mono->sensor.frameSize);
+    TEST_ASSERT_EQUAL_INT(10, mono->sensor.jpegQuality);
+    TEST_ASSERT_EQUAL_INT(20, mono->sensor.xclkMhz);
+
+    // Defaults of the keys left out
+    const FilmStock* slide = registry->getStock(2);
+    TEST_ASSERT_EQUAL_INT(12, slide->capacity);
+    TEST_ASSERT_EQUAL_INT(0, slide->contrast);
+    TEST_ASSERT_EQUAL_INT(100, slide->saturation);
+
+    // Names are matched whole
+    TEST_ASSERT_EQUAL_INT(-1, registry->find("test_fil"));
+    TEST_ASSERT_EQUAL_INT(-1, registry->find("test_film_"));
+    TEST_ASSERT_EQUAL_INT(-1, registry->find("TEST_FILM"));
+}
+
+void testReportsErrorsWithTheirLine(void) {
+    struct {
+        const char* text;
+        int error;
+        int line;
+    } cases[] = {
+        {"capacity = 36\n", FILM_REGISTRY_ERROR_SYNTAX, 1},
+        {"[a]\ncapacity = 36\ncolour = 3\n", FILM_REGISTRY_ERROR_SYNTAX, 3},
+        {"[a]\ncapacity 36\n", FILM_REGISTRY_ERROR_SYNTAX, 2},
+        {"[a]\ncapacity = 3x\n", FILM_REGISTRY_ERROR_SYNTAX, 2},
+        {"[a]\ncapacity =\n", FILM_REGISTRY_ERROR_SYNTAX, 2},
+        {"[a\ncapacity = 36\n", FILM_REGISTRY_ERROR_SYNTAX, 1},
+        {"[a]\ncapacity = 0\n", FILM_REGISTRY_ERROR_RANGE, 2},
+        {"[a]\ncapacity = 36\ncontrast = 101\n", FILM_REGISTRY_ERROR_RANGE, 3},
+        {"[a]\ncapacity = 36\njpeg_quality = 99999\n", FILM_REGISTRY_ERROR_SYNTAX, 3},
+        {"[Film]\ncapacity = 36\n", FILM_REGISTRY_ERROR_RANGE, 1},
+        {"[]\n", FILM_REGISTRY_ERROR_RANGE, 1},
+        {"[a_name_that_is_far_too_long]\n", FILM_REGISTRY_ERROR_RANGE, 1},
+        {"[a]\ncapacity = 36\n[a]\ncapacity = 1\n", FILM_REGISTRY_ERROR_DUPLICATE, 3},
+        {"[a]\ncapacity = 36\ncapacity = 24\n", FILM_REGISTRY_ERROR_DUPLICATE, 3},
+        {"[a]\ncontrast = 5\n[b]\ncapacity = 1\n", FILM_REGISTRY_ERROR_MISSING, 3},
+        {"[a]\ncapacity = 1\n[b]\n", FILM_REGISTRY_ERROR_MISSING, 0},
+        {"# nothing\n\n", FILM_REGISTRY_ERROR_MISSING, 0},
+    };
+    for (auto& test : cases) {
+        int result = registry->parse(test.text, strlen(test.text));
+        TEST_ASSERT_EQUAL_INT_MESSAGE(test.error, result, test.text);
+        // Errors at the end are reported after the last line
+        int lines = 0;
+        for (const char* c = test.text; *c; c++) {
+            lines += *c == '\n';
+        }
+        TEST_ASSERT_EQUAL_INT_MESSAGE(test.line == 0 ? lines + 1 : test.line, registry->getErrorLine(), test.text);
+        TEST_ASSERT_EQUAL_INT(0, registry->getCount());
+        TEST_ASSERT_EQUAL_INT(-1, registry->find("a"));
+    }
+
+    // Lines longer than a line can be
+    std::string longLine = "[a]\ncapacity = 36" + std::string(FILM_REGISTRY_MAX_LINE, ' ') + "\n";
+    TEST_ASSERT_EQUAL_INT(FILM_REGISTRY_ERROR_SYNTAX, parse(registry, longLine));
+}
+
+void testPerfectHashOfAFullRegistry(void) {
+    std::string text;
+    char line[48];
+    for (int i = 0; i < FILM_REGISTRY_MAX_FILMS; i++) {
+        snprintf(line, sizeof(line), "[film_%02d]\ncapacity = %d\n", i, 10 + i);
+        text += line;
+    }
+    TEST_ASSERT_EQUAL_INT(FILM_REGISTRY_MAX_FILMS, parse(registry, text));
+    checkLookups(*registry);
+    for (int i = 0; i < FILM_REGISTRY_MAX_FILMS; i++) {
+        snprintf(line, sizeof(line), "film_%02d", i);
+        TEST_ASSERT_EQUAL_INT(i, registry->find(line));
+        TEST_ASSERT_EQUAL_INT(10 + i, registry->getStock(i)->capacity);
+    }
+    char message[64];
+    snprintf(message, sizeof(message), "%d films in %d slots, seed %u", FILM_REGISTRY_MAX_FILMS, FILM_REGISTRY_SLOTS,
+             (unsigned) registry->getSeed());
+    TEST_MESSAGE(message);
+
+    text += "[one_more]\ncapacity = 1\n";
+    TEST_ASSERT_EQUAL_INT(FILM_REGISTRY_ERROR_FULL, parse(registry, text));
+    TEST_ASSERT_EQUAL_INT(FILM_REGISTRY_MAX_FILMS * 2 + 1, registry->getErrorLine());
+}
+
+void testCacheRoundTrip(void) {
+    TEST_ASSERT_EQUAL_INT(3, registry->parse(STOCKS, strlen(STOCKS)));
+    uint8_t blob[FILM_REGISTRY_MAX_BLOB_BYTES];
+    size_t length = registry->serialize(blob, sizeof(blob), 312, 1700000000);
+    TEST_ASSERT_TRUE(length > 0);
+    TEST_ASSERT_EQUAL_INT(0, registry->serialize(blob, length - 1, 312, 1700000000));
+
+    FilmRegistry loaded;
+    TEST_ASSERT_TRUE(loaded.deserialize(blob, length, 312, 1700000000));
+    TEST_ASSERT_EQUAL_INT(3, loaded.getCount());
+    TEST_ASSERT_EQUAL_UINT32(registry->getSeed(), loaded.getSeed());
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_MEMORY(registry->getStock(i), loaded.getStock(i), sizeof(FilmStock));
+    }
+    checkLookups(loaded);
+
+    // A changed file, a short read or a damaged card send the parse through again
+    TEST_ASSERT_FALSE(loaded.deserialize(blob, length, 313, 1700000000));
+    TEST_ASSERT_EQUAL_INT(0, loaded.getCount());
+    TEST_ASSERT_FALSE(loaded.deserialize(blob, length, 312, 1700000001));
+    TEST_ASSERT_FALSE(loaded.deserialize(blob, length - 1, 312, 1700000000));
+    blob[length / 2] ^= 0x10;
+    TEST_ASSERT_FALSE(loaded.deserialize(blob, length, 312, 1700000000));
+    TEST_ASSERT_EQUAL_INT(-1, loaded.find("test_film"));
+}
+
+void testFuzzParser(void) {
+    // Mutations of a valid file: the parser never reads out of its line and never keeps a bad registry
+    std::mt19937 random(1234);
+    std::string base(STOCKS);
+    const char alphabet[] = "[]=#;\n\r -+_09az\t";
+    int parsed = 0;
+    for (int iteration = 0; iteration < 20000; iteration++) {
+        std::string text = base;
+        int mutations = 1 + (int) (random() % 6);
+        for (int m = 0; m < mutations && !text.empty(); m++) {
+            size_t at = random() % text.size();
+            switch (random() % 4) {
+                case 0:
+                    text[at] = alphabet[random() % (sizeof(alphabet) - 1)];
+                    break;
+                case 1:
+                    text.insert(at, 1, alphabet[random() % (sizeof(alphabet) - 1)]);
+                    break;
+                case 2:
+                    text.erase(at, 1 + random() % 8);
+                    break;
+                default:
+                    text[at] = (char) (random() & 0xFF);
+                    break;
+            }
+        }
+        // Without a terminating zero, so reading past the end shows up under a sanitizer
+        std::vector<char> exact(text.begin(), text.end());
+        int result = registry->parse(exact.data(), exact.size());
+        if (result > 0) {
+            parsed++;
+            TEST_ASSERT_EQUAL_INT(result, registry->getCount());
+            checkLookups(*registry);
+        } else {
+            TEST_ASSERT_TRUE(result >= FILM_REGISTRY_ERROR_HASH && result <= FILM_REGISTRY_ERROR_SYNTAX);
+            TEST_ASSERT_EQUAL_INT(0, registry->getCount());
+        }
+    }
+    char message[64];
+    snprintf(message, sizeof(message), "%d of 20000 mutated files parsed", parsed);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(parsed > 0);
+}
+
+void testFuzzCache(void) {
+    // Damaged or crafted blobs are rejected unless they hold a consistent registry
+    TEST_ASSERT_EQUAL_INT(3, registry->parse(STOCKS, strlen(STOCKS)));
+    uint8_t good[FILM_REGISTRY_MAX_BLOB_BYTES];
+    size_t length = registry->serialize(good, sizeof(good), 1, 2);
+    std::mt19937 random(99);
+    FilmRegistry loaded;
+    int accepted = 0;
+    for (int iteration = 0; iteration < 20000; iteration++) {
+        std::vector<uint8_t> blob(good, good + length);
+        if (iteration % 2 == 0) {
+            for (int m = 0; m < 1 + (int) (random() % 4); m++) {
+                blob[random() % blob.size()] ^= (uint8_t) (1u << (random() % 8));
+            }
+        } else {
+            for (size_t i = sizeof(FilmRegistryHeader); i < blob.size(); i++) {
+                blob[i] = (uint8_t) random();
+            }
+        }
+        // Resealed, so the content checks are what stands in the way
+        uint32_t checksum = StandbyStore::crc32(blob.data(), blob.size() - 4);
+        if (iteration % 3 == 0) {
+            memcpy(&blob[blob.size() - 4], &checksum, 4);
+        }
+        if (loaded.deserialize(blob.data(), blob.size(), 1, 2)) {
+            accepted++;
+            checkLookups(loaded);
+        } else {
+            TEST_ASSERT_EQUAL_INT(0, loaded.getCount());
+        }
+    }
+    char message[64];
+    snprintf(message, sizeof(message), "%d of 20000 damaged caches accepted", accepted);
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testParsesStocks);
+    RUN_TEST(testReportsErrorsWithTheirLine);
+    RUN_TEST(testPerfectHashOfAFullRegistry);
+    RUN_TEST(testCacheRoundTrip);
+    RUN_TEST(testFuzzParser);
+    RUN_TEST(testFuzzCache);
+    return UNITY_END();
+}
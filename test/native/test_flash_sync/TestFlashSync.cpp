@@ -0,0 +1,153 @@
+#include <unity.h>
+#include <FlashSync.h>
+
+// Simulated sensor: a frame starts every period and arrives after its readout
+#define FRAME_PERIOD_US 120000
+#define READOUT_US 100000
+
+static FlashSync* sync;
+
+void setUp(void) {
+    sync = new FlashSync();
+}
+
+void tearDown(void) {
+    delete sync;
+}
+
+/**
+ * @brief Run a flash shot with frames starting at startUs + k * period.
+ *
+ * @return int64_t Start of the kept frame, -1 if none.
+ */
+static int64_t runShot(FlashSync* flash, int64_t armUs, int64_t periodUs) {
+    // Frames before the arm only feed the period
+    int64_t frameUs = 0;
+    for (; frameUs + READOUT_US < armUs; frameUs += periodUs) {
+        flash->onFrame(frameUs, frameUs + READOUT_US);
+    }
+    flash->arm();
+    for (; flash->getState() != FLASH_STATE_IDLE; frameUs += periodUs) {
+        if (flash->onFrame(frameUs, frameUs + READOUT_US) == FLASH_FRAME_KEEP) {
+            return frameUs;
+        }
+    }
+    return -1;
+}
+
+void testLampGoesOnAtFrameBoundary() {
+    sync->onFrame(0, READOUT_US);
+    sync->arm();
+    TEST_ASSERT_FALSE(sync->isLampOn());
+    TEST_ASSERT_EQUAL_INT(FLASH_FRAME_DROP, sync->onFrame(FRAME_PERIOD_US, FRAME_PERIOD_US + READOUT_US));
+    TEST_ASSERT_TRUE(sync->isLampOn());
+    TEST_ASSERT_EQUAL_INT(FLASH_STATE_LIT, sync->getState());
+}
+
+void testKeptFrameIsFullyLit() {
+    for (int64_t armUs = 500000; armUs < 500000 + FRAME_PERIOD_US; armUs += 7000) {
+        FlashSync flash;
+        int64_t keptUs = runShot(&flash, armUs, FRAME_PERIOD_US);
+        TEST_ASSERT_TRUE(keptUs >= 0);
+        TEST_ASSERT_FALSE(flash.isLampOn());
+
+        // The first row started integrating a frame period before the readout
+        int64_t lampOnUs = keptUs + READOUT_US - flash.getLastOnTimeUs();
+        TEST_ASSERT_TRUE(keptUs - FRAME_PERIOD_US >= lampOnUs + FLASH_LED_RISE_US);
+        // Off as soon as the lit frame is in, at most three frames after the boundary
+        TEST_ASSERT_TRUE(flash.getLastOnTimeUs() <= 3 * FRAME_PERIOD_US);
+        TEST_ASSERT_EQUAL_INT(FRAME_PERIOD_US, flash.getFramePeriodUs());
+    }
+}
+
+void testKnownExposureKeepsEarlierFrame() {
+    FlashSyncConfig config;
+    config.exposureUs = 10000;
+    FlashSync shortExposure(config);
+    FlashSync worstCase;
+    runShot(&shortExposure, 500000, FRAME_PERIOD_US);
+    runShot(&worstCase, 500000, FRAME_PERIOD_US);
+    TEST_ASSERT_TRUE(shortExposure.getLastOnTimeUs() < worstCase.getLastOnTimeUs());
+    TEST_ASSERT_EQUAL_INT(1, shortExposure.getLastDroppedFrames());
+    TEST_ASSERT_EQUAL_INT(2, worstCase.getLastDroppedFrames());
+}
+
+void testStaleFramesGiveUp() {
+    sync->onFrame(0, READOUT_US);
+    sync->onFrame(FRAME_PERIOD_US, FRAME_PERIOD_US + READOUT_US);
+    sync->arm();
+    // The driver keeps returning frames that started before the lamp
+    int64_t nowUs = 300000;
+    for (int i = 0; i <= FLASH_MAX_LIT_FRAMES; i++, nowUs += 1000) {
+        TEST_ASSERT_EQUAL_INT(FLASH_FRAME_DROP, sync->onFrame(2 * FRAME_PERIOD_US, nowUs));
+    }
+    TEST_ASSERT_FALSE(sync->isLampOn());
+    TEST_ASSERT_EQUAL_UINT32(1, sync->getFailureCount());
+    TEST_ASSERT_EQUAL_UINT32(0, sync->getShotCount());
+}
+
+void testAbortSwitchesLampOff() {
+    sync->onFrame(0, READOUT_US);
+    sync->arm();
+    sync->onFrame(FRAME_PERIOD_US, FRAME_PERIOD_US + READOUT_US);
+    TEST_ASSERT_TRUE(sync->isLampOn());
+    sync->abort(FRAME_PERIOD_US + READOUT_US + 50000);
+    TEST_ASSERT_FALSE(sync->isLampOn());
+    TEST_ASSERT_EQUAL_INT64(50000, sync->getLastOnTimeUs());
+    TEST_ASSERT_EQUAL_UINT32(1, sync->getFailureCount());
+}
+
+void testStatisticsOverShots() {
+    FlashSync flash;
+    int64_t frameUs = 0;
+    for (int shot = 0; shot < 5; shot++) {
+        flash.arm();
+        while (flash.getState() != FLASH_STATE_IDLE) {
+            flash.onFrame(frameUs, frameUs + READOUT_US);
+            frameUs += FRAME_PERIOD_US;
+        }
+        frameUs += 3 * FRAME_PERIOD_US;
+    }
+    TEST_ASSERT_EQUAL_UINT32(5, flash.getShotCount());
+    TEST_ASSERT_TRUE(flash.getMeanOnTimeUs() > 0);
+    TEST_ASSERT_TRUE(flash.getMaxOnTimeUs() >= flash.getMeanOnTimeUs());
+}
+
+void testSyncBeatsLampAroundSave() {
+    // Before: lamp on at the request, off after a 150 ms mount, the latest completed frame and a 400 ms write
+    const int64_t mountUs = 150000;
+    const int64_t writeUs = 400000;
+    int partialBefore = 0;
+    int64_t onBeforeSumUs = 0;
+    int64_t onAfterSumUs = 0;
+    int shots = 0;
+    for (int64_t requestUs = 1000000; requestUs < 1000000 + FRAME_PERIOD_US; requestUs += 5000) {
+        int64_t captureAt = requestUs + mountUs;
+        // CAMERA_GRAB_LATEST returns the last frame whose readout ended
+        int64_t frameUs = ((captureAt - READOUT_US) / FRAME_PERIOD_US) * FRAME_PERIOD_US;
+        onBeforeSumUs += captureAt + writeUs - requestUs;
+        if (frameUs - FRAME_PERIOD_US < requestUs + FLASH_LED_RISE_US) {
+            partialBefore++;
+        }
+
+        FlashSync flash;
+        TEST_ASSERT_TRUE(runShot(&flash, captureAt, FRAME_PERIOD_US) >= 0);
+        onAfterSumUs += flash.getLastOnTimeUs();
+        shots++;
+    }
+    // The old window sometimes exposed a partially lit frame, and burned the LED much longer
+    TEST_ASSERT_TRUE(partialBefore > 0);
+    TEST_ASSERT_TRUE(onAfterSumUs * 2 < onBeforeSumUs);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testLampGoesOnAtFrameBoundary);
+    RUN_TEST(testKeptFrameIsFullyLit);
+    RUN_TEST(testKnownExposureKeepsEarlierFrame);
+    RUN_TEST(testStaleFramesGiveUp);
+    RUN_TEST(testAbortSwitchesLampOff);
+    RUN_TEST(testStatisticsOverShots);
+    RUN_TEST(testSyncBeatsLampAroundSave);
+    return UNITY_END();
+}
@@ -0,0 +1,267 @@
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+#include <BorderTiles.h>
+#include <FrameDeveloper.h>
+#include <GrainTiles.h>
+#include "../JpegTestSupport.h"
+
+#define FRAME_WIDTH 640
+#define FRAME_HEIGHT 480
+#define ARENA_BYTES (2 * 1024 * 1024)
+#define STAMP_TEXT "'24 10 19"
+#define FILM_NAME "test_film"
+#define FRAME_LABEL "7 >7A"
+#define TOOL_ARENA_BYTES (16 * 1024 * 1024)
+
+JPEG_TEST_ARENA(ARENA_BYTES)
+static const BorderArt ART = {&REBATE_BORDER_TILE, &SPROCKET_BORDER_TILE, &FONT_BORDER_TILE, FONT_BORDER_CHARACTERS};
+
+static bool refuseWrite(void* context, const uint8_t* data, size_t length) {
+    return false;
+}
+
+static std::vector<uint8_t> decodeLuma(const std::vector<uint8_t>& jpeg, int* width, int* height) {
+    std::vector<uint8_t> ycc = decode(jpeg, width, height);
+    std::vector<uint8_t> luma(ycc.size() / JPEG_YCC_BYTES);
+    for (size_t p = 0; p < luma.size(); p++) {
+        luma[p] = ycc[p * JPEG_YCC_BYTES];
+    }
+    return luma;
+}
+
+// The chain as SaveService ran it stage by stage, each into a buffer of its own
+static std::vector<uint8_t> chainByHand(const std::vector<uint8_t>& jpeg, int rotation, int crop, const char* text,
+                                        const char* filmName) {
+    std::vector<uint8_t> frame = jpeg;
+    if (rotation != JPEG_ROTATE_0 || crop != JPEG_CROP_FULL) {
+        std::vector<uint8_t> out;
+        JpegTransform transform(arena);
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, transform.write(frame.data(), frame.size(), rotation, crop, writeToVector, &out));
+        frame = out;
+    }
+    if (text != nullptr) {
+        std::vector<uint8_t> out;
+        DateStamp stamp(arena);
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, stamp.write(frame.data(), frame.size(), text, writeToVector, &out));
+        frame = out;
+    }
+    if (filmName != nullptr) {
+        std::vector<uint8_t> out;
+        FilmBorder border(arena, ART);
+        if (border.write(frame.data(), frame.size(), filmName, FRAME_LABEL, writeToVector, &out) == JPEG_OK) {
+            frame = out;
+        }
+    }
+    return frame;
+}
+
+static std::vector<uint8_t> develop(const std::vector<uint8_t>& jpeg, const DevelopSettings& settings, int expected,
+                                    FrameDeveloper* developer) {
+    std::vector<uint8_t> out;
+    TEST_ASSERT_EQUAL_INT(expected, developer->write(jpeg.data(), jpeg.size(), settings, writeToVector, &out));
+    TEST_ASSERT_EQUAL_INT(0, arena->getMark());
+    if (expected == JPEG_OK) {
+        TEST_ASSERT_EQUAL_INT(out.size(), developer->getBytesWritten());
+    }
+    return out;
+}
+
+// The frame as tools/developer writes it, into a buffer with an arena of its own
+static std::vector<uint8_t> developLikeTheTool(const std::vector<uint8_t>& jpeg, const DevelopSettings& settings,
+                                               size_t arenaBytes) {
+    std::vector<uint8_t> memory(arenaBytes);
+    ImageArena toolArena(memory.data(), memory.size());
+    std::vector<uint8_t> out(jpeg.size() * 4 + 1024 * 1024);
+    MemorySink sink = {out.data(), out.size(), 0};
+    FrameDeveloper developer(&toolArena, ART);
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, developer.write(jpeg.data(), jpeg.size(), settings, FrameDeveloper::writeToMemory, &sink));
+    out.resize(sink.used);
+    return out;
+}
+
+void testSameBytesAsTheStagesByHand() {
+    std::vector<uint8_t> jpeg = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 80);
+    const int rotations[] = {JPEG_ROTATE_0, JPEG_ROTATE_180, JPEG_ROTATE_0};
+    const int crops[] = {JPEG_CROP_FULL, JPEG_CROP_3_2, JPEG_CROP_SQUARE};
+    for (int i = 0; i < 3; i++) {
+        DevelopSettings settings;
+        settings.rotation = rotations[i];
+        settings.crop = crops[i];
+        settings.dateText = STAMP_TEXT;
+        settings.filmName = FILM_NAME;
+        settings.frameLabel = FRAME_LABEL;
+        FrameDeveloper developer(arena, ART);
+        std::vector<uint8_t> out = develop(jpeg, settings, JPEG_OK, &developer);
+        std::vector<uint8_t> expected = chainByHand(jpeg, rotations[i], crops[i], STAMP_TEXT, FILM_NAME);
+        TEST_ASSERT_EQUAL_INT(expected.size(), out.size());
+        TEST_ASSERT_EQUAL_MEMORY(expected.data(), out.data(), out.size());
+        for (int stage = DEVELOP_STAGE_TRANSFORM; stage < DEVELOP_STAGE_COUNT; stage++) {
+            int result = stage == DEVELOP_STAGE_TRANSFORM && i == 0 ? DEVELOP_STAGE_SKIPPED : JPEG_OK;
+            TEST_ASSERT_EQUAL_INT(result, developer.getStageResult(stage));
+        }
+        TEST_ASSERT_EQUAL_INT(DEVELOP_STAGE_SKIPPED, developer.getStageResult(DEVELOP_STAGE_LOOK));
+    }
+}
+
+void testFailedBorderKeepsTheStampedFrame() {
+    // A quarter turn gives a 4:4:0 frame, the border tiles are 4:2:2
+    std::vector<uint8_t> jpeg = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 80);
+    DevelopSettings settings;
+    settings.rotation = JPEG_ROTATE_90;
+    settings.dateText = STAMP_TEXT;
+    settings.filmName = FILM_NAME;
+    FrameDeveloper developer(arena, ART);
+    std::vector<uint8_t> out = develop(jpeg, settings, JPEG_OK, &developer);
+    std::vector<uint8_t> expected = chainByHand(jpeg, JPEG_ROTATE_90, JPEG_CROP_FULL, STAMP_TEXT, nullptr);
+    TEST_ASSERT_EQUAL_INT(expected.size(), out.size());
+    TEST_ASSERT_EQUAL_MEMORY(expected.data(), out.data(), out.size());
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, developer.getStageResult(DEVELOP_STAGE_STAMP));
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_UNSUPPORTED, developer.getStageResult(DEVELOP_STAGE_BORDER));
+
+    // With the border alone there is nothing developed to keep
+    DevelopSettings borderOnly;
+    borderOnly.filmName = FILM_NAME;
+    develop(expected, borderOnly, JPEG_ERROR_UNSUPPORTED, &developer);
+}
+
+void testLookIsAppliedFirst() {
+    std::vector<uint8_t> jpeg = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 80, 4);
+    FilmGrain grain;
+    grain.setTile(&TEST_FILM_GRAIN_TILE);
+    grain.newFrame(7);
+    FilmProcess process;
+    process.setLook(FilmLook{60, 40});
+    process.setGrain(&grain);
+    DevelopSettings settings;
+    settings.look = &process;
+    settings.dateText = STAMP_TEXT;
+    FrameDeveloper developer(arena, ART);
+    std::vector<uint8_t> out = develop(jpeg, settings, JPEG_OK, &developer);
+
+    // Grain codes to more bytes than the smooth frame had, the stamp still gets the whole frame
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, developer.getStageResult(DEVELOP_STAGE_LOOK));
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, developer.getStageResult(DEVELOP_STAGE_STAMP));
+    TEST_ASSERT_TRUE(out.size() > jpeg.size());
+    // The whole frame for the look, and the blocks under the stamp
+    TEST_ASSERT_TRUE(developer.getRecodedMcus() > (FRAME_WIDTH / 16) * (FRAME_HEIGHT / 8));
+
+    // Contrast spreads the tones of the frame
+    int width;
+    int height;
+    std::vector<uint8_t> before = decodeLuma(jpeg, &width, &height);
+    std::vector<uint8_t> after = decodeLuma(out, &width, &height);
+    TEST_ASSERT_EQUAL_INT(FRAME_WIDTH, width);
+    TEST_ASSERT_EQUAL_INT(FRAME_HEIGHT, height);
+    double spreadBefore = 0;
+    double spreadAfter = 0;
+    for (size_t i = 0; i < before.size(); i += 7) {
+        spreadBefore += fabs(before[i] - 128.0);
+        spreadAfter += fabs(after[i] - 128.0);
+    }
+    TEST_ASSERT_TRUE(spreadAfter > spreadBefore * 1.1);
+
+    // The same look gives the same bytes
+    std::vector<uint8_t> again = develop(jpeg, settings, JPEG_OK, &developer);
+    TEST_ASSERT_EQUAL_INT(out.size(), again.size());
+    TEST_ASSERT_EQUAL_MEMORY(out.data(), again.data(), out.size());
+}
+
+void testStagesWithoutMemoryAreLeftOut() {
+    std::vector<uint8_t> jpeg = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 80);
+    DevelopSettings settings;
+    settings.rotation = JPEG_ROTATE_180;
+    settings.dateText = STAMP_TEXT;
+    settings.filmName = FILM_NAME;
+
+    // Room for the transform but not for a copy of its output: it writes the frame, the rest is left out
+    size_t transformBytes = JpegTransform::requiredBytes(FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422);
+    ImageArena small(arenaBuffer, transformBytes + jpeg.size() / 2);
+    FrameDeveloper developer(&small, ART);
+    std::vector<uint8_t> out;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, developer.write(jpeg.data(), jpeg.size(), settings, writeToVector, &out));
+    std::vector<uint8_t> expected = chainByHand(jpeg, JPEG_ROTATE_180, JPEG_CROP_FULL, nullptr, nullptr);
+    TEST_ASSERT_EQUAL_INT(expected.size(), out.size());
+    TEST_ASSERT_EQUAL_MEMORY(expected.data(), out.data(), out.size());
+    TEST_ASSERT_EQUAL_INT(DEVELOP_STAGE_SKIPPED, developer.getStageResult(DEVELOP_STAGE_STAMP));
+
+    // Too little for the film look: it is left out and the stamp still runs
+    FilmProcess process;
+    process.setLook(FilmLook{60, 40});
+    DevelopSettings lookSettings;
+    lookSettings.look = &process;
+    lookSettings.dateText = STAMP_TEXT;
+    ImageArena tiny(arenaBuffer, DateStamp::requiredBytes() + 1024);
+    FrameDeveloper tinyDeveloper(&tiny, ART);
+    out.clear();
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, tinyDeveloper.write(jpeg.data(), jpeg.size(), lookSettings, writeToVector, &out));
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_MEMORY, tinyDeveloper.getStageResult(DEVELOP_STAGE_LOOK));
+    expected = chainByHand(jpeg, JPEG_ROTATE_0, JPEG_CROP_FULL, STAMP_TEXT, nullptr);
+    TEST_ASSERT_EQUAL_INT(expected.size(), out.size());
+    TEST_ASSERT_EQUAL_MEMORY(expected.data(), out.data(), out.size());
+}
+
+void testToolGivesTheCameraBytes() {
+    std::vector<uint8_t> jpeg = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 80);
+
+    // Set as SaveService sets a single frame, and written to the card from the camera's arena
+    DevelopSettings cameraSettings;
+    char cameraLabel[FILM_BORDER_MAX_CHARS];
+    FrameDeveloper::setCameraStages(&cameraSettings, JPEG_ROTATE_180, JPEG_CROP_3_2, STAMP_TEXT, FILM_NAME, 7, cameraLabel);
+    TEST_ASSERT_EQUAL_STRING(FRAME_LABEL, cameraSettings.frameLabel);
+    TEST_ASSERT_NULL(cameraSettings.look);
+    FrameDeveloper camera(arena, ART);
+    std::vector<uint8_t> saved = develop(jpeg, cameraSettings, JPEG_OK, &camera);
+
+    // Set as the tool sets a frame of the roll, with its default arena and with the camera's
+    DevelopSettings toolSettings;
+    char toolLabel[FILM_BORDER_MAX_CHARS];
+    FrameDeveloper::setCameraStages(&toolSettings, JPEG_ROTATE_180, JPEG_CROP_3_2, STAMP_TEXT, FILM_NAME, 7, toolLabel);
+    const size_t arenas[] = {TOOL_ARENA_BYTES, ARENA_BYTES};
+    for (size_t bytes : arenas) {
+        std::vector<uint8_t> out = developLikeTheTool(jpeg, toolSettings, bytes);
+        TEST_ASSERT_EQUAL_INT(saved.size(), out.size());
+        TEST_ASSERT_EQUAL_MEMORY(saved.data(), out.data(), out.size());
+    }
+
+    // A camera short of memory leaves the stamp and the border out, the tool does too with the same arena
+    size_t smallBytes = JpegTransform::requiredBytes(FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422) + jpeg.size() / 2;
+    ImageArena small(arenaBuffer, smallBytes);
+    FrameDeveloper smallCamera(&small, ART);
+    std::vector<uint8_t> fallback;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, smallCamera.write(jpeg.data(), jpeg.size(), cameraSettings, writeToVector, &fallback));
+    TEST_ASSERT_EQUAL_INT(DEVELOP_STAGE_SKIPPED, smallCamera.getStageResult(DEVELOP_STAGE_STAMP));
+    std::vector<uint8_t> out = developLikeTheTool(jpeg, toolSettings, smallBytes);
+    TEST_ASSERT_EQUAL_INT(fallback.size(), out.size());
+    TEST_ASSERT_EQUAL_MEMORY(fallback.data(), out.data(), out.size());
+}
+
+void testBadInputAndWriter() {
+    std::vector<uint8_t> jpeg = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 80);
+    DevelopSettings settings;
+    FrameDeveloper developer(arena, ART);
+    TEST_ASSERT_FALSE(FrameDeveloper::isNeeded(settings));
+    develop(jpeg, settings, JPEG_ERROR_STATE, &developer);
+
+    settings.dateText = STAMP_TEXT;
+    TEST_ASSERT_TRUE(FrameDeveloper::isNeeded(settings));
+    std::vector<uint8_t> garbage(jpeg.begin() + 4, jpeg.end());
+    develop(garbage, settings, JPEG_ERROR_FORMAT, &developer);
+
+    std::vector<uint8_t> out;
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_WRITE, developer.write(jpeg.data(), jpeg.size(), settings, refuseWrite, nullptr));
+    TEST_ASSERT_EQUAL_INT(0, developer.getBytesWritten());
+    TEST_ASSERT_EQUAL_INT(0, arena->getMark());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testSameBytesAsTheStagesByHand);
+    RUN_TEST(testFailedBorderKeepsTheStampedFrame);
+    RUN_TEST(testLookIsAppliedFirst);
+    RUN_TEST(testStagesWithoutMemoryAreLeftOut);
+    RUN_TEST(testToolGivesTheCameraBytes);
+    RUN_TEST(testBadInputAndWriter);
+    return UNITY_END();
+}
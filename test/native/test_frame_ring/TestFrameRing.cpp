@@ -0,0 +1,157 @@
+#include <unity.h>
+#include <FrameRing.h>
+
+static FrameRing* ring;
+static int frames[8];
+
+void setUp(void) {
+    ring = new FrameRing(3);
+}
+
+void tearDown(void) {
+    delete ring;
+}
+
+void testCapacityIsClamped() {
+    TEST_ASSERT_EQUAL_INT(1, FrameRing(0).getCapacity());
+    TEST_ASSERT_EQUAL_INT(FRAME_RING_MAX_FRAMES, FrameRing(100).getCapacity());
+}
+
+void testOldestIsEvictedWhenFull() {
+    void* evicted = nullptr;
+    TEST_ASSERT_FALSE(ring->push(&frames[0], 0, &evicted));
+    TEST_ASSERT_FALSE(ring->push(&frames[1], 100, &evicted));
+    TEST_ASSERT_FALSE(ring->push(&frames[2], 200, &evicted));
+    TEST_ASSERT_TRUE(ring->isFull());
+
+    TEST_ASSERT_TRUE(ring->push(&frames[3], 300, &evicted));
+    TEST_ASSERT_EQUAL_PTR(&frames[0], evicted);
+    TEST_ASSERT_EQUAL_INT(3, ring->getCount());
+
+    TEST_ASSERT_EQUAL_PTR(&frames[1], ring->popOldest());
+    TEST_ASSERT_EQUAL_PTR(&frames[2], ring->popOldest());
+    TEST_ASSERT_EQUAL_PTR(&frames[3], ring->popOldest());
+    TEST_ASSERT_NULL(ring->popOldest());
+}
+
+void testClosestFrameIsTaken() {
+    void* evicted;
+    ring->push(&frames[0], 1000, &evicted);
+    ring->push(&frames[1], 1400, &evicted);
+    ring->push(&frames[2], 1800, &evicted);
+
+    int64_t frameTimeUs = 0;
+    TEST_ASSERT_EQUAL_PTR(&frames[1], ring->takeClosest(1500, &frameTimeUs));
+    TEST_ASSERT_EQUAL_INT64(1400, frameTimeUs);
+    TEST_ASSERT_EQUAL_INT(2, ring->getCount());
+
+    // The remaining frames keep their order
+    TEST_ASSERT_EQUAL_PTR(&frames[0], ring->popOldest());
+    TEST_ASSERT_EQUAL_PTR(&frames[2], ring->popOldest());
+}
+
+void testTieGoesToEarlierFrame() {
+    void* evicted;
+    ring->push(&frames[0], 1000, &evicted);
+    ring->push(&frames[1], 2000, &evicted);
+    TEST_ASSERT_EQUAL_PTR(&frames[0], ring->takeClosest(1500, nullptr));
+}
+
+void testEmptyRingTakesNothing() {
+    TEST_ASSERT_NULL(ring->takeClosest(1000, nullptr));
+    TEST_ASSERT_EQUAL_UINT32(0, ring->getShotCount());
+}
+
+void testClosestAfterWrap() {
+    void* evicted;
+    for (int i = 0; i < 7; i++) {
+        ring->push(&frames[i], i * 100, &evicted);
+    }
+    // Frames 4, 5 and 6 are left
+    TEST_ASSERT_EQUAL_PTR(&frames[4], ring->takeClosest(0, nullptr));
+    TEST_ASSERT_EQUAL_PTR(&frames[6], ring->takeClosest(10000, nullptr));
+    TEST_ASSERT_EQUAL_PTR(&frames[5], ring->popOldest());
+}
+
+void testOffsetStatistics() {
+    void* evicted;
+    // Frame 60 us after the press
+    ring->push(&frames[0], 1060, &evicted);
+    ring->takeClosest(1000, nullptr);
+    // Frame 20 us before the press
+    ring->push(&frames[1], 1980, &evicted);
+    ring->takeClosest(2000, nullptr);
+
+    TEST_ASSERT_EQUAL_UINT32(2, ring->getShotCount());
+    TEST_ASSERT_EQUAL_INT64(20, ring->getMeanOffsetUs());
+    TEST_ASSERT_EQUAL_INT64(40, ring->getMeanAbsOffsetUs());
+    TEST_ASSERT_EQUAL_INT64(-20, ring->getMinOffsetUs());
+    TEST_ASSERT_EQUAL_INT64(60, ring->getMaxOffsetUs());
+}
+
+void testHoldKeepsFramesAroundPress() {
+    void* evicted;
+    ring->push(&frames[0], 0, &evicted);
+    ring->push(&frames[1], 100, &evicted);
+    ring->hold(150);
+    TEST_ASSERT_TRUE(ring->needsFrames());
+    ring->push(&frames[2], 200, &evicted);
+    TEST_ASSERT_FALSE(ring->needsFrames());
+
+    TEST_ASSERT_EQUAL_PTR(&frames[1], ring->takeClosest(150, nullptr));
+    // The shot ends the hold
+    TEST_ASSERT_TRUE(ring->needsFrames());
+}
+
+void testUnhold() {
+    void* evicted;
+    ring->hold(0);
+    ring->push(&frames[0], 100, &evicted);
+    TEST_ASSERT_FALSE(ring->needsFrames());
+    ring->unhold();
+    TEST_ASSERT_TRUE(ring->needsFrames());
+}
+
+void testRingBeatsCaptureAfterSave() {
+    // Frames every 150 ms, shot requested on release 500 ms after the press
+    const int64_t framePeriodUs = 150000;
+    const int64_t requestDelayUs = 500000;
+    FrameRing zsl(2);
+    int64_t lateSumUs = 0;
+    int shots = 0;
+    for (int64_t pressUs = 1000000; pressUs < 6000000; pressUs += 333333) {
+        void* evicted;
+        for (int64_t t = 0; t <= pressUs + requestDelayUs; t += framePeriodUs) {
+            if (t >= pressUs) {
+                zsl.hold(pressUs);
+            }
+            if (zsl.needsFrames()) {
+                zsl.push(&frames[0], t, &evicted);
+            }
+        }
+        zsl.takeClosest(pressUs, nullptr);
+        while (zsl.popOldest() != nullptr) {
+        }
+        // Without the ring, the first frame after the request
+        int64_t next = ((pressUs + requestDelayUs) / framePeriodUs + 1) * framePeriodUs;
+        lateSumUs += next - pressUs;
+        shots++;
+    }
+    TEST_ASSERT_TRUE(zsl.getMeanAbsOffsetUs() <= framePeriodUs / 2);
+    TEST_ASSERT_TRUE(zsl.getMeanAbsOffsetUs() * 5 < lateSumUs / shots);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testCapacityIsClamped);
+    RUN_TEST(testOldestIsEvictedWhenFull);
+    RUN_TEST(testClosestFrameIsTaken);
+    RUN_TEST(testTieGoesToEarlierFrame);
+    RUN_TEST(testEmptyRingTakesNothing);
+    RUN_TEST(testClosestAfterWrap);
+    RUN_TEST(testOffsetStatistics);
+    RUN_TEST(testHoldKeepsFramesAroundPress);
+    RUN_TEST(testUnhold);
+    RUN_TEST(testRingBeatsCaptureAfterSave);
+    return UNITY_END();
+}
@@ -0,0 +1,232 @@
+#include <unity.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <FrameStacker.h>
+#include "../JpegTestSupport.h"
+
+#define FRAME_WIDTH 320
+#define FRAME_HEIGHT 240
+#define SCENE_MARGIN 16
+#define NOISE_SIGMA 10.0
+#define ARENA_BYTES (2 * 1024 * 1024)
+
+JPEG_TEST_ARENA(ARENA_BYTES)
+static std::vector<uint8_t> scene;
+static int sceneWidth;
+static int sceneHeight;
+
+static uint32_t randomState;
+
+static double nextUniform() {
+    randomState = randomState * 1664525u + 1013904223u;
+    return ((randomState >> 8) + 0.5) / 16777216.0;
+}
+
+static double nextGaussian() {
+    return sqrt(-2.0 * log(nextUniform())) * cos(6.283185307 * nextUniform());
+}
+
+static uint8_t clampSample(double value) {
+    return (uint8_t) (value < 0 ? 0 : (value > 255 ? 255 : value + 0.5));
+}
+
+// Textured scene larger than a frame, so shifted frames see real content at their edges
+static void makeScene() {
+    sceneWidth = FRAME_WIDTH + 2 * SCENE_MARGIN;
+    sceneHeight = FRAME_HEIGHT + 2 * SCENE_MARGIN;
+    scene.assign((size_t) sceneWidth * sceneHeight * JPEG_YCC_BYTES, 0);
+    randomState = 7;
+    for (int y = 0; y < sceneHeight; y++) {
+        for (int x = 0; x < sceneWidth; x++) {
+            double luma = 120 + 50 * sin(x * 0.05) * cos(y * 0.07) + 30 * sin((x + 2 * y) * 0.021);
+            if ((x / 40 + y / 30) % 3 == 0) {
+                luma += 40;
+            }
+            uint8_t* pixel = &scene[((size_t) y * sceneWidth + x) * JPEG_YCC_BYTES];
+            pixel[0] = clampSample(luma);
+            pixel[1] = clampSample(128 + 30 * sin(y * 0.03));
+            pixel[2] = clampSample(128 + 30 * cos(x * 0.02));
+        }
+    }
+}
+
+// Frame whose content is the reference moved by dx, dy, with sensor noise
+static std::vector<uint8_t> makeFrame(int dx, int dy, double sigma, uint32_t seed) {
+    std::vector<uint8_t> ycc((size_t) FRAME_WIDTH * FRAME_HEIGHT * JPEG_YCC_BYTES);
+    randomState = seed;
+    for (int y = 0; y < FRAME_HEIGHT; y++) {
+        for (int x = 0; x < FRAME_WIDTH; x++) {
+            const uint8_t* source = &scene[((size_t) (y + SCENE_MARGIN - dy) * sceneWidth + x + SCENE_MARGIN - dx) * JPEG_YCC_BYTES];
+            uint8_t* pixel = &ycc[((size_t) y * FRAME_WIDTH + x) * JPEG_YCC_BYTES];
+            pixel[0] = clampSample(source[0] + sigma * nextGaussian());
+            pixel[1] = clampSample(source[1] + sigma * 0.5 * nextGaussian());
+            pixel[2] = clampSample(source[2] + sigma * 0.5 * nextGaussian());
+        }
+    }
+    return ycc;
+}
+
+// Luma PSNR against the noiseless reference, away from the edges repeated by the shifts
+static double lumaPsnr(const std::vector<uint8_t>& ycc) {
+    double error = 0;
+    int count = 0;
+    for (int y = STACK_MAX_SHIFT; y < FRAME_HEIGHT - STACK_MAX_SHIFT; y++) {
+        for (int x = STACK_MAX_SHIFT; x < FRAME_WIDTH - STACK_MAX_SHIFT; x++) {
+            double difference = (double) ycc[((size_t) y * FRAME_WIDTH + x) * JPEG_YCC_BYTES] -
+                                scene[((size_t) (y + SCENE_MARGIN) * sceneWidth + x + SCENE_MARGIN) * JPEG_YCC_BYTES];
+            error += difference * difference;
+            count++;
+        }
+    }
+    return 10.0 * log10(255.0 * 255.0 * count / error);
+}
+
+static const int SHIFTS[STACK_MAX_FRAMES][2] = {{0, 0}, {3, -2}, {-5, 4}, {6, 1}};
+static std::vector<uint8_t> frames[STACK_MAX_FRAMES];
+
+// The shifted frames, coded on first use and shared by the tests
+static const std::vector<uint8_t>& frame(int index) {
+    if (scene.empty()) {
+        makeScene();
+        for (int i = 0; i < STACK_MAX_FRAMES; i++) {
+            frames[i] = encode(makeFrame(SHIFTS[i][0], SHIFTS[i][1], NOISE_SIGMA, 100 + i), FRAME_WIDTH, FRAME_HEIGHT,
+                               JPEG_SUBSAMPLING_422, 92);
+        }
+    }
+    return frames[index];
+}
+
+static void addFrames(FrameStacker* stacker, int count) {
+    for (int i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, stacker->addFrame(frame(i).data(), frame(i).size()));
+    }
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stacker->align());
+}
+
+void testShiftsAreEstimated() {
+    FrameStacker stacker(arena);
+    addFrames(&stacker, STACK_MAX_FRAMES);
+    TEST_ASSERT_EQUAL_INT(STACK_MAX_FRAMES, stacker.getStackedCount());
+    for (int i = 0; i < STACK_MAX_FRAMES; i++) {
+        // Sampling the frame at the shift lands on the reference content
+        TEST_ASSERT_INT_WITHIN(1, SHIFTS[i][0], stacker.getShiftX(i));
+        TEST_ASSERT_INT_WITHIN(1, SHIFTS[i][1], stacker.getShiftY(i));
+    }
+}
+
+void testStackingRaisesPsnr() {
+    double single = lumaPsnr(decode(frame(0)));
+
+    FrameStacker stacker(arena);
+    addFrames(&stacker, STACK_MAX_FRAMES);
+    std::vector<uint8_t> stacked;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stacker.write(writeToVector, &stacked));
+    double result = lumaPsnr(decode(stacked));
+
+    char message[96];
+    snprintf(message, sizeof(message), "luma PSNR: %.2f dB single, %.2f dB with %d frames", single, result, STACK_MAX_FRAMES);
+    TEST_MESSAGE(message);
+    // Four frames halve the noise, 6 dB in theory, less the residual misalignment and coding
+    TEST_ASSERT_GREATER_THAN(single + 4.0, result);
+}
+
+void testFarFrameIsLeftOut() {
+    std::vector<uint8_t> far = encode(makeFrame(13, 0, NOISE_SIGMA, 99), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 92);
+    FrameStacker stacker(arena);
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stacker.addFrame(frame(0).data(), frame(0).size()));
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stacker.addFrame(far.data(), far.size()));
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stacker.addFrame(frame(1).data(), frame(1).size()));
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stacker.align());
+    TEST_ASSERT_EQUAL_INT(2, stacker.getStackedCount());
+    TEST_ASSERT_GREATER_THAN(STACK_MAX_SHIFT, stacker.getShiftX(1));
+}
+
+void testMismatchedFrameIsRefused() {
+    std::vector<uint8_t> ycc((size_t) 64 * 64 * JPEG_YCC_BYTES, 128);
+    std::vector<uint8_t> small = encode(ycc, 64, 64, JPEG_SUBSAMPLING_422, 90);
+
+    FrameStacker stacker(arena);
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stacker.addFrame(frame(0).data(), frame(0).size()));
+    size_t used = arena->getUsed();
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_UNSUPPORTED, stacker.addFrame(small.data(), small.size()));
+    TEST_ASSERT_EQUAL_UINT32(used, arena->getUsed());
+    TEST_ASSERT_EQUAL_INT(1, stacker.getFrameCount());
+}
+
+void testMemoryStaysWithinBudget() {
+    size_t required = FrameStacker::requiredBytes(FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, STACK_MAX_FRAMES);
+    std::vector<uint8_t> budget(required);
+    ImageArena exact(budget.data(), budget.size());
+    FrameStacker stacker(&exact);
+    for (int i = 0; i < STACK_MAX_FRAMES; i++) {
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, stacker.addFrame(frame(i).data(), frame(i).size()));
+    }
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stacker.align());
+    std::vector<uint8_t> stacked;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, stacker.write(writeToVector, &stacked));
+    TEST_ASSERT_LESS_OR_EQUAL(required, exact.getHighWater());
+
+    // The budget is a few strips per frame, far below the decoded frames
+    TEST_ASSERT_LESS_THAN((size_t) FRAME_WIDTH * FRAME_HEIGHT * JPEG_YCC_BYTES, required);
+
+    // A full sensor frame stays within a slice of the PSRAM
+    TEST_ASSERT_LESS_THAN(1536 * 1024, FrameStacker::requiredBytes(2560, 1920, JPEG_SUBSAMPLING_422, STACK_MAX_FRAMES));
+
+    // A short budget fails cleanly
+    ImageArena tight(budget.data(), required / 2);
+    FrameStacker starved(&tight);
+    int result = JPEG_OK;
+    for (int i = 0; i < STACK_MAX_FRAMES && result == JPEG_OK; i++) {
+        result = starved.addFrame(frame(i).data(), frame(i).size());
+    }
+    if (result == JPEG_OK) {
+        starved.align();
+        stacked.clear();
+        result = starved.write(writeToVector, &stacked);
+    }
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_MEMORY, result);
+}
+
+static double stackSeconds(StripRunner* runner, std::vector<uint8_t>* out, int repeats) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        arena->reset();
+        FrameStacker stacker(arena);
+        addFrames(&stacker, STACK_MAX_FRAMES);
+        out->clear();
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, stacker.write(writeToVector, out, runner));
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / repeats;
+}
+
+void benchmarkLanes() {
+    SerialStripRunner serial;
+    ThreadStripRunner threaded;
+    std::vector<uint8_t> serialOutput;
+    std::vector<uint8_t> threadedOutput;
+    double serialSeconds = stackSeconds(&serial, &serialOutput, 10);
+    double threadedSeconds = stackSeconds(&threaded, &threadedOutput, 10);
+
+    // The lanes only split the work, the output is the same
+    TEST_ASSERT_EQUAL_UINT32(serialOutput.size(), threadedOutput.size());
+    TEST_ASSERT_EQUAL_MEMORY(serialOutput.data(), threadedOutput.data(), serialOutput.size());
+
+    double megapixels = (double) FRAME_WIDTH * FRAME_HEIGHT * STACK_MAX_FRAMES / 1e6;
+    char message[128];
+    snprintf(message, sizeof(message), "stack of %d frames: %.1f MP/s serial, %.1f MP/s on %d lanes", STACK_MAX_FRAMES,
+             megapixels / serialSeconds, megapixels / threadedSeconds, STRIP_LANES);
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testShiftsAreEstimated);
+    RUN_TEST(testStackingRaisesPsnr);
+    RUN_TEST(testFarFrameIsLeftOut);
+    RUN_TEST(testMismatchedFrameIsRefused);
+    RUN_TEST(testMemoryStaysWithinBudget);
+    RUN_TEST(benchmarkLanes);
+    return UNITY_END();
+}
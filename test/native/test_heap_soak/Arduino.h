@@ -0,0 +1,43 @@
+#ifndef RETROLENS_SHIM_ARDUINO_H
+#define RETROLENS_SHIM_ARDUINO_H
+
+// Host stand-in of the Arduino calls of the shot path services, with pins set by the test
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define INPUT_PULLDOWN 0x09
+#define CHANGE 0x03
+#define ADC_11db 3
+#define digitalPinToInterrupt(pin) (pin)
+
+uint32_t millis();
+void delay(uint32_t ms);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+void analogSetPinAttenuation(uint8_t pin, int attenuation);
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t pin);
+
+/**
+ * @brief Move the clock of millis() forward.
+ */
+void shimAdvanceMillis(uint32_t ms);
+
+/**
+ * @brief Set the level of a pin and run its interrupt handler, as an edge on the pin would.
+ */
+void shimDrivePin(uint8_t pin, int value);
+
+#endif // RETROLENS_SHIM_ARDUINO_H
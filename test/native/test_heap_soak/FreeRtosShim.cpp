@@ -0,0 +1,451 @@
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+
+#include "Arduino.h"
+#include "esp_adc_cal.h"
+#include "esp_timer.h"
+#include "freertos/event_groups.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "freertos/timers.h"
+
+#define SHIM_MAX_TIMERS 8
+#define SHIM_MAX_PINS 40
+
+// One lock and one condition for every blocking call, waiters check their own state when woken.
+// They are never destroyed, the tasks still wait on them when the test exits.
+static pthread_mutex_t kernelLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t kernelChanged;
+static pthread_once_t kernelOnce = PTHREAD_ONCE_INIT;
+static std::atomic<long> dynamicObjects(0);
+
+static StaticTimer_t* startedTimers[SHIM_MAX_TIMERS];
+static int startedTimerCount = 0;
+
+static std::atomic<uint32_t> simulatedMillis(0);
+static int pinLevels[SHIM_MAX_PINS];
+static void (*pinHandlers[SHIM_MAX_PINS])(void*);
+static void* pinHandlerArgs[SHIM_MAX_PINS];
+
+// Control block of the threads that were not created as tasks, such as the test itself
+static thread_local StaticTask_t* currentTask = nullptr;
+static thread_local StaticTask_t foreignTask;
+
+static uint64_t startMs;
+
+static StaticTask_t* getCurrentTask() {
+    return currentTask != nullptr ? currentTask : &foreignTask;
+}
+
+static uint64_t monotonicMs() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+static void initializeKernel() {
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    pthread_cond_init(&kernelChanged, &attributes);
+    startMs = monotonicMs();
+}
+
+/**
+ * @brief Holds the kernel lock for a scope.
+ */
+struct KernelLock {
+    KernelLock() {
+        pthread_once(&kernelOnce, initializeKernel);
+        pthread_mutex_lock(&kernelLock);
+    }
+    ~KernelLock() {
+        pthread_mutex_unlock(&kernelLock);
+    }
+};
+
+static void kernelNotify() {
+    pthread_cond_broadcast(&kernelChanged);
+}
+
+// Wait under the kernel lock until ready() holds or the timeout ends
+template <typename Ready>
+static bool waitFor(KernelLock& lock, TickType_t timeout, Ready ready) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout / 1000;
+    deadline.tv_nsec += (long) (timeout % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    while (!ready()) {
+        if (timeout == portMAX_DELAY) {
+            pthread_cond_wait(&kernelChanged, &kernelLock);
+        } else if (pthread_cond_timedwait(&kernelChanged, &kernelLock, &deadline) != 0) {
+            return ready();
+        }
+    }
+    return true;
+}
+
+long shimGetDynamicObjects() {
+    return dynamicObjects;
+}
+
+void shimRunTimers() {
+    for (int i = 0; i < startedTimerCount; i++) {
+        if (startedTimers[i]->active) {
+            startedTimers[i]->callback(startedTimers[i]);
+        }
+    }
+}
+
+void vPortCPUInitializeMutex(portMUX_TYPE* mux) {
+    mux->locked.clear();
+}
+
+void vPortEnterCritical(portMUX_TYPE* mux) {
+    while (mux->locked.test_and_set(std::memory_order_acquire)) {
+        sched_yield();
+    }
+}
+
+void vPortExitCritical(portMUX_TYPE* mux) {
+    mux->locked.clear(std::memory_order_release);
+}
+
+static void* runTask(void* p) {
+    StaticTask_t* task = static_cast<StaticTask_t*>(p);
+    currentTask = task;
+    task->function(task->arg);
+    return nullptr;
+}
+
+TaskHandle_t xTaskCreateStatic(TaskFunction_t function, const char* name, uint32_t stackDepth, void* arg,
+                               UBaseType_t priority, StackType_t* stack, StaticTask_t* task) {
+    task->function = function;
+    task->arg = arg;
+    task->priority = priority;
+    task->notifyValue = 0;
+    task->notifyPending = false;
+    if (pthread_create(&task->thread, nullptr, runTask, task) != 0) {
+        return nullptr;
+    }
+    pthread_detach(task->thread);
+    return task;
+}
+
+TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth, void* arg,
+                                           UBaseType_t priority, StackType_t* stack, StaticTask_t* task, BaseType_t core) {
+    return xTaskCreateStatic(function, name, stackDepth, arg, priority, stack, task);
+}
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stackDepth, void* arg, UBaseType_t priority,
+                       TaskHandle_t* handle) {
+    dynamicObjects++;
+    TaskHandle_t task = xTaskCreateStatic(function, name, stackDepth, arg, priority, nullptr, new StaticTask_t());
+    if (handle != nullptr) {
+        *handle = task;
+    }
+    return task != nullptr ? pdPASS : pdFAIL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+    return xTaskCreate(function, name, stackDepth, arg, priority, handle);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    // Only a task ending itself is supported, the others run until the test exits
+    if (task == nullptr || task == currentTask) {
+        pthread_exit(nullptr);
+    }
+}
+
+void vTaskDelay(TickType_t ticks) {
+    // The hardware being waited for is simulated, the task only gives way
+    sched_yield();
+}
+
+TickType_t xTaskGetTickCount() {
+    pthread_once(&kernelOnce, initializeKernel);
+    return (TickType_t) (monotonicMs() - startMs);
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task) {
+    return (task != nullptr ? task : getCurrentTask())->priority;
+}
+
+void vTaskPrioritySet(TaskHandle_t task, UBaseType_t priority) {
+    (task != nullptr ? task : getCurrentTask())->priority = priority;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+    KernelLock lock;
+    if (action == eSetBits) {
+        task->notifyValue |= value;
+    } else if (action == eIncrement) {
+        task->notifyValue++;
+    }
+    task->notifyPending = true;
+    kernelNotify();
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    return xTaskNotify(task, 0, eIncrement);
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t* value, TickType_t timeout) {
+    StaticTask_t* task = getCurrentTask();
+    KernelLock lock;
+    if (!task->notifyPending) {
+        task->notifyValue &= ~clearOnEntry;
+    }
+    if (!waitFor(lock, timeout, [task] { return task->notifyPending; })) {
+        return pdFALSE;
+    }
+    if (value != nullptr) {
+        *value = task->notifyValue;
+    }
+    task->notifyValue &= ~clearOnExit;
+    task->notifyPending = false;
+    return pdTRUE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t timeout) {
+    StaticTask_t* task = getCurrentTask();
+    KernelLock lock;
+    if (!waitFor(lock, timeout, [task] { return task->notifyValue != 0; })) {
+        return 0;
+    }
+    uint32_t value = task->notifyValue;
+    task->notifyValue = clearOnExit ? 0 : value - 1;
+    task->notifyPending = false;
+    return value;
+}
+
+QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t itemSize, uint8_t* storage, StaticQueue_t* queue) {
+    queue->storage = storage;
+    queue->itemSize = itemSize;
+    queue->length = length;
+    queue->head = 0;
+    queue->count = 0;
+    return queue;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    dynamicObjects++;
+    return xQueueCreateStatic(length, itemSize, new uint8_t[length * itemSize + 1], new StaticQueue_t());
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+    KernelLock lock;
+    queue->count = 0;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t timeout) {
+    KernelLock lock;
+    if (!waitFor(lock, timeout, [queue] { return queue->count < queue->length; })) {
+        return pdFALSE;
+    }
+    UBaseType_t tail = (queue->head + queue->count) % queue->length;
+    if (queue->itemSize > 0) {
+        memcpy(queue->storage + tail * queue->itemSize, item, queue->itemSize);
+    }
+    queue->count++;
+    kernelNotify();
+    return pdTRUE;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* higherPriorityTaskWoken) {
+    return xQueueSend(queue, item, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t timeout) {
+    KernelLock lock;
+    if (!waitFor(lock, timeout, [queue] { return queue->count > 0; })) {
+        return pdFALSE;
+    }
+    if (queue->itemSize > 0) {
+        memcpy(item, queue->storage + queue->head * queue->itemSize, queue->itemSize);
+    }
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    kernelNotify();
+    return pdTRUE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* semaphore) {
+    xQueueCreateStatic(1, 0, nullptr, semaphore);
+    semaphore->count = 1;
+    return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t* semaphore) {
+    return xQueueCreateStatic(1, 0, nullptr, semaphore);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    dynamicObjects++;
+    return xSemaphoreCreateMutexStatic(new StaticSemaphore_t());
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    dynamicObjects++;
+    return xSemaphoreCreateBinaryStatic(new StaticSemaphore_t());
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t timeout) {
+    return xQueueReceive(semaphore, nullptr, timeout);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return xQueueSend(semaphore, nullptr, 0);
+}
+
+TimerHandle_t xTimerCreateStatic(const char* name, TickType_t period, UBaseType_t autoReload, void* id,
+                                 TimerCallbackFunction_t callback, StaticTimer_t* timer) {
+    timer->name = name;
+    timer->period = period;
+    timer->id = id;
+    timer->callback = callback;
+    timer->active = false;
+    return timer;
+}
+
+TimerHandle_t xTimerCreate(const char* name, TickType_t period, UBaseType_t autoReload, void* id,
+                           TimerCallbackFunction_t callback) {
+    dynamicObjects++;
+    return xTimerCreateStatic(name, period, autoReload, id, callback, new StaticTimer_t());
+}
+
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t timeout) {
+    KernelLock lock;
+    for (int i = 0; i < startedTimerCount; i++) {
+        if (startedTimers[i] == timer) {
+            timer->active = true;
+            return pdPASS;
+        }
+    }
+    if (startedTimerCount == SHIM_MAX_TIMERS) {
+        return pdFAIL;
+    }
+    startedTimers[startedTimerCount++] = timer;
+    timer->active = true;
+    return pdPASS;
+}
+
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t timeout) {
+    timer->active = false;
+    return pdPASS;
+}
+
+void* pvTimerGetTimerID(TimerHandle_t timer) {
+    return timer->id;
+}
+
+EventGroupHandle_t xEventGroupCreateStatic(StaticEventGroup_t* group) {
+    group->bits = 0;
+    return group;
+}
+
+EventGroupHandle_t xEventGroupCreate() {
+    dynamicObjects++;
+    return xEventGroupCreateStatic(new StaticEventGroup_t());
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits) {
+    KernelLock lock;
+    group->bits |= bits;
+    kernelNotify();
+    return group->bits;
+}
+
+BaseType_t xEventGroupSetBitsFromISR(EventGroupHandle_t group, EventBits_t bits, BaseType_t* higherPriorityTaskWoken) {
+    xEventGroupSetBits(group, bits);
+    return pdPASS;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits) {
+    KernelLock lock;
+    EventBits_t previous = group->bits;
+    group->bits &= ~bits;
+    return previous;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clearOnExit, BaseType_t waitForAll,
+                                TickType_t timeout) {
+    KernelLock lock;
+    auto ready = [group, bits, waitForAll] { return waitForAll ? (group->bits & bits) == bits : (group->bits & bits) != 0; };
+    bool set = waitFor(lock, timeout, ready);
+    EventBits_t value = group->bits;
+    if (set && clearOnExit) {
+        group->bits &= ~bits;
+    }
+    return value;
+}
+
+uint32_t millis() {
+    return simulatedMillis;
+}
+
+void delay(uint32_t ms) {
+    vTaskDelay(ms);
+}
+
+void shimAdvanceMillis(uint32_t ms) {
+    simulatedMillis += ms;
+}
+
+int64_t esp_timer_get_time() {
+    return (int64_t) simulatedMillis * 1000;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    pinLevels[pin] = value;
+}
+
+int digitalRead(uint8_t pin) {
+    return pinLevels[pin];
+}
+
+uint16_t analogRead(uint8_t pin) {
+    // About 1.9 V at the pin, a battery a little over half charged behind the divider
+    return 2360;
+}
+
+void analogSetPinAttenuation(uint8_t pin, int attenuation) {
+}
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode) {
+    pinHandlers[pin] = handler;
+    pinHandlerArgs[pin] = arg;
+}
+
+void detachInterrupt(uint8_t pin) {
+    pinHandlers[pin] = nullptr;
+}
+
+void shimDrivePin(uint8_t pin, int value) {
+    pinLevels[pin] = value;
+    if (pinHandlers[pin] != nullptr) {
+        pinHandlers[pin](pinHandlerArgs[pin]);
+    }
+}
+
+esp_adc_cal_value_t esp_adc_cal_characterize(adc_unit_t unit, adc_atten_t attenuation, adc_bits_width_t width,
+                                             uint32_t defaultVref, esp_adc_cal_characteristics_t* characteristics) {
+    characteristics->vref = defaultVref;
+    return ESP_ADC_CAL_VAL_DEFAULT_VREF;
+}
+
+uint32_t esp_adc_cal_raw_to_voltage(uint32_t raw, const esp_adc_cal_characteristics_t* characteristics) {
+    return raw * 3300 / 4095;
+}
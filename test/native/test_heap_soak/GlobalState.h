@@ -0,0 +1,29 @@
+#ifndef RETROLENS_SHIM_GLOBAL_STATE_H
+#define RETROLENS_SHIM_GLOBAL_STATE_H
+
+// Host stand-in of the global state, with the shared objects of the shot path only
+
+#include "../../../lib/services/EventBus.h"
+#include "../../../lib/services/WorkerPool.h"
+
+#define BATTERY_DIVIDER_RATIO 2.0f
+
+class GlobalState {
+public:
+    static bool safelyTakeBattery(long timeout = portMAX_DELAY) {
+        return true;
+    }
+    static void safelyFreeBattery() {
+    }
+    static EventBus* getEventBus() {
+        return &eventBus;
+    }
+    static WorkerPool* getWorkerPool() {
+        return &workerPool;
+    }
+
+    static EventBus eventBus;
+    static WorkerPool workerPool;
+};
+
+#endif // RETROLENS_SHIM_GLOBAL_STATE_H
@@ -0,0 +1,5 @@
+// Services of the shot path, built against the host stand-ins of this folder
+#include "../../../lib/services/BatteryReaderService.cpp"
+#include "../../../lib/services/ButtonService.cpp"
+#include "../../../lib/services/EventBus.cpp"
+#include "../../../lib/services/WorkerPool.cpp"
@@ -0,0 +1,142 @@
+#include <unity.h>
+#include <new>
+#include <stdlib.h>
+
+#include "Arduino.h"
+#include "../../../lib/services/BatteryReaderService.h"
+#include "../../../lib/services/ButtonService.h"
+#include "GlobalState.h"
+
+// Count every heap allocation made through new/delete during the test
+static std::atomic<long> allocations(0);
+static std::atomic<long> liveAllocations(0);
+
+void* operator new(size_t size) {
+    allocations++;
+    liveAllocations++;
+    void* p = malloc(size ? size : 1);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    if (p != nullptr) {
+        liveAllocations--;
+        free(p);
+    }
+}
+
+void operator delete(void* p, size_t) noexcept {
+    operator delete(p);
+}
+
+#define SOAK_SHOTS 5000
+#define SHOT_PERIOD_MS 2000
+#define PRESS_MS 120
+#define EVENT_TIMEOUT_MS 1000
+
+#define BUTTON_PIN 12
+#define BATTERY_ANALOG_PIN 14
+#define BATTERY_CONTROL_PIN 15
+
+// Shared objects and services of the shot path, in static storage as GlobalState::initialize keeps them
+EventBus GlobalState::eventBus;
+WorkerPool GlobalState::workerPool;
+alignas(ButtonService) static uint8_t buttonServiceStorage[sizeof(ButtonService)];
+alignas(BatteryReaderService) static uint8_t batteryReaderServiceStorage[sizeof(BatteryReaderService)];
+static ButtonService* buttonService;
+static BatteryReaderService* batteryReaderService;
+
+static int buttonSubscriber;
+static int batterySubscriber;
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+static int shutterJob(void* arg) {
+    return (int) (intptr_t) arg;
+}
+
+// Wait for an event of a subscriber, skipping the others
+static bool waitForEvent(int subscriber, int button) {
+    Event event;
+    while (GlobalState::getEventBus()->receive(subscriber, &event, pdMS_TO_TICKS(EVENT_TIMEOUT_MS))) {
+        if (event.type != EVENT_BUTTON || event.payload.button == button) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// One shot: press and release through the interrupt, a shutter job, then the battery refresh of the timer
+static bool simulateShot() {
+    shimAdvanceMillis(SHOT_PERIOD_MS);
+    shimDrivePin(BUTTON_PIN, LOW);
+    if (!waitForEvent(buttonSubscriber, BUTTON_PRESSED)) {
+        return false;
+    }
+
+    JobFuture future;
+    int result = 0;
+    if (!GlobalState::getWorkerPool()->submit(JOB_PRIORITY_SHUTTER, shutterJob, (void*) 1, &future) ||
+        !future.wait(&result, pdMS_TO_TICKS(EVENT_TIMEOUT_MS))) {
+        return false;
+    }
+
+    shimAdvanceMillis(PRESS_MS);
+    shimDrivePin(BUTTON_PIN, HIGH);
+    if (!waitForEvent(buttonSubscriber, BUTTON_RELEASED)) {
+        return false;
+    }
+
+    shimRunTimers();
+    return result == 1 && waitForEvent(batterySubscriber, 0);
+}
+
+void testServicesStartWithoutHeap() {
+    long allocationsBefore = allocations;
+    shimDrivePin(BUTTON_PIN, HIGH);
+
+    GlobalState::getWorkerPool()->begin();
+    buttonService = new (buttonServiceStorage) ButtonService(BUTTON_PIN, LOW, GlobalState::getEventBus());
+    batteryReaderService = new (batteryReaderServiceStorage) BatteryReaderService(BATTERY_ANALOG_PIN, BATTERY_CONTROL_PIN);
+    buttonService->begin();
+    batteryReaderService->begin(false);
+
+    TEST_ASSERT_EQUAL(0, allocations - allocationsBefore);
+    TEST_ASSERT_EQUAL(0, shimGetDynamicObjects());
+}
+
+void testShotPathHeapIsFlat() {
+    TEST_ASSERT_NOT_NULL(batteryReaderService);
+    buttonSubscriber = GlobalState::getEventBus()->subscribe(EVENT_MASK(EVENT_BUTTON));
+    batterySubscriber = GlobalState::getEventBus()->subscribe(EVENT_MASK(EVENT_BATTERY_LEVEL));
+
+    // Warm up, then measure
+    TEST_ASSERT_TRUE(simulateShot());
+    long allocationsBefore = allocations;
+    long liveBefore = liveAllocations;
+
+    int shots = 0;
+    for (int i = 0; i < SOAK_SHOTS; i++) {
+        shots += simulateShot() ? 1 : 0;
+    }
+
+    TEST_ASSERT_EQUAL_INT(SOAK_SHOTS, shots);
+    TEST_ASSERT_EQUAL(0, allocations - allocationsBefore);
+    TEST_ASSERT_EQUAL(liveBefore, liveAllocations);
+    TEST_ASSERT_EQUAL(0, shimGetDynamicObjects());
+    TEST_ASSERT_TRUE(batteryReaderService->getLastBatteryLevel() > 0.0f);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testServicesStartWithoutHeap);
+    RUN_TEST(testShotPathHeapIsFlat);
+    return UNITY_END();
+}
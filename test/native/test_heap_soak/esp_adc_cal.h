@@ -0,0 +1,19 @@
+#ifndef RETROLENS_SHIM_ESP_ADC_CAL_H
+#define RETROLENS_SHIM_ESP_ADC_CAL_H
+
+#include <stdint.h>
+
+typedef enum { ADC_UNIT_1 = 1, ADC_UNIT_2 = 2 } adc_unit_t;
+typedef enum { ADC_ATTEN_DB_0 = 0, ADC_ATTEN_DB_11 = 3 } adc_atten_t;
+typedef enum { ADC_WIDTH_BIT_12 = 3 } adc_bits_width_t;
+typedef enum { ESP_ADC_CAL_VAL_DEFAULT_VREF = 2 } esp_adc_cal_value_t;
+
+struct esp_adc_cal_characteristics_t {
+    uint32_t vref;
+};
+
+esp_adc_cal_value_t esp_adc_cal_characterize(adc_unit_t unit, adc_atten_t attenuation, adc_bits_width_t width,
+                                             uint32_t defaultVref, esp_adc_cal_characteristics_t* characteristics);
+uint32_t esp_adc_cal_raw_to_voltage(uint32_t raw, const esp_adc_cal_characteristics_t* characteristics);
+
+#endif // RETROLENS_SHIM_ESP_ADC_CAL_H
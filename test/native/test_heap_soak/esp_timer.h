@@ -0,0 +1,8 @@
+#ifndef RETROLENS_SHIM_ESP_TIMER_H
+#define RETROLENS_SHIM_ESP_TIMER_H
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time();
+
+#endif // RETROLENS_SHIM_ESP_TIMER_H
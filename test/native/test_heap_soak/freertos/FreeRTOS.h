@@ -0,0 +1,94 @@
+#ifndef RETROLENS_SHIM_FREERTOS_H
+#define RETROLENS_SHIM_FREERTOS_H
+
+// Host stand-in of the FreeRTOS subset used by the shot path services, on pthreads.
+// The static variants use the buffers they are given. The dynamic variants allocate and are
+// counted, so a test can check that a service never creates a kernel object on the heap.
+
+#include <limits.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t EventBits_t;
+typedef uint8_t StackType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define portMAX_DELAY ((TickType_t) 0xffffffffUL)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t) (ms))
+#define IRAM_ATTR
+
+// Spinlock of the critical sections
+struct portMUX_TYPE {
+    std::atomic_flag locked = ATOMIC_FLAG_INIT;
+};
+#define portMUX_INITIALIZER_UNLOCKED {}
+
+void vPortCPUInitializeMutex(portMUX_TYPE* mux);
+void vPortEnterCritical(portMUX_TYPE* mux);
+void vPortExitCritical(portMUX_TYPE* mux);
+#define portENTER_CRITICAL(mux) vPortEnterCritical(mux)
+#define portEXIT_CRITICAL(mux) vPortExitCritical(mux)
+#define portENTER_CRITICAL_ISR(mux) vPortEnterCritical(mux)
+#define portEXIT_CRITICAL_ISR(mux) vPortExitCritical(mux)
+
+typedef void (*TaskFunction_t)(void*);
+
+// Task control block, the task runs on a thread with its own stack
+struct StaticTask_t {
+    pthread_t thread;
+    TaskFunction_t function;
+    void* arg;
+    UBaseType_t priority;
+    uint32_t notifyValue;
+    bool notifyPending;
+};
+typedef StaticTask_t* TaskHandle_t;
+
+// Queue control block, semaphores are queues of empty items
+struct StaticQueue_t {
+    uint8_t* storage;
+    size_t itemSize;
+    UBaseType_t length;
+    UBaseType_t head;
+    UBaseType_t count;
+};
+typedef StaticQueue_t StaticSemaphore_t;
+typedef StaticQueue_t* QueueHandle_t;
+typedef StaticQueue_t* SemaphoreHandle_t;
+
+struct StaticEventGroup_t {
+    EventBits_t bits;
+};
+typedef StaticEventGroup_t* EventGroupHandle_t;
+
+struct StaticTimer_t;
+typedef StaticTimer_t* TimerHandle_t;
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t);
+struct StaticTimer_t {
+    const char* name;
+    TickType_t period;
+    void* id;
+    TimerCallbackFunction_t callback;
+    bool active;
+};
+
+/**
+ * @brief Get the kernel objects created on the heap since the start.
+ */
+long shimGetDynamicObjects();
+
+/**
+ * @brief Run the callback of every started timer, as the timer task does when they expire.
+ */
+void shimRunTimers();
+
+#endif // RETROLENS_SHIM_FREERTOS_H
@@ -0,0 +1,14 @@
+#ifndef RETROLENS_SHIM_EVENT_GROUPS_H
+#define RETROLENS_SHIM_EVENT_GROUPS_H
+
+#include "FreeRTOS.h"
+
+EventGroupHandle_t xEventGroupCreateStatic(StaticEventGroup_t* group);
+EventGroupHandle_t xEventGroupCreate();
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits);
+BaseType_t xEventGroupSetBitsFromISR(EventGroupHandle_t group, EventBits_t bits, BaseType_t* higherPriorityTaskWoken);
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clearOnExit, BaseType_t waitForAll,
+                                TickType_t timeout);
+
+#endif // RETROLENS_SHIM_EVENT_GROUPS_H
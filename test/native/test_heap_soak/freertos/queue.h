@@ -0,0 +1,13 @@
+#ifndef RETROLENS_SHIM_QUEUE_H
+#define RETROLENS_SHIM_QUEUE_H
+
+#include "FreeRTOS.h"
+
+QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t itemSize, uint8_t* storage, StaticQueue_t* queue);
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t timeout);
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* higherPriorityTaskWoken);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t timeout);
+
+#endif // RETROLENS_SHIM_QUEUE_H
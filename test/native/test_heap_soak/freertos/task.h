@@ -0,0 +1,26 @@
+#ifndef RETROLENS_SHIM_TASK_H
+#define RETROLENS_SHIM_TASK_H
+
+#include "FreeRTOS.h"
+
+enum eNotifyAction { eNoAction, eSetBits, eIncrement };
+
+TaskHandle_t xTaskCreateStatic(TaskFunction_t function, const char* name, uint32_t stackDepth, void* arg,
+                               UBaseType_t priority, StackType_t* stack, StaticTask_t* task);
+TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth, void* arg,
+                                           UBaseType_t priority, StackType_t* stack, StaticTask_t* task, BaseType_t core);
+BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stackDepth, void* arg, UBaseType_t priority,
+                       TaskHandle_t* handle);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task);
+void vTaskPrioritySet(TaskHandle_t task, UBaseType_t priority);
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t* value, TickType_t timeout);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t timeout);
+
+#endif // RETROLENS_SHIM_TASK_H
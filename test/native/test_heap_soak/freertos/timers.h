@@ -0,0 +1,14 @@
+#ifndef RETROLENS_SHIM_TIMERS_H
+#define RETROLENS_SHIM_TIMERS_H
+
+#include "FreeRTOS.h"
+
+TimerHandle_t xTimerCreateStatic(const char* name, TickType_t period, UBaseType_t autoReload, void* id,
+                                 TimerCallbackFunction_t callback, StaticTimer_t* timer);
+TimerHandle_t xTimerCreate(const char* name, TickType_t period, UBaseType_t autoReload, void* id,
+                           TimerCallbackFunction_t callback);
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t timeout);
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t timeout);
+void* pvTimerGetTimerID(TimerHandle_t timer);
+
+#endif // RETROLENS_SHIM_TIMERS_H
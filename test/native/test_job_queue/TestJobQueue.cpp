@@ -0,0 +1,96 @@
+#include <unity.h>
+#include <JobQueue.h>
+
+static JobQueue* queue;
+
+static int noop(void* arg) {
+    return 0;
+}
+
+// Build a job whose argument identifies it
+static Job makeJob(uint8_t priority, long id) {
+    Job job = {noop, (void*) id, nullptr, nullptr, priority};
+    return job;
+}
+
+void setUp(void) {
+    queue = new JobQueue();
+}
+
+void tearDown(void) {
+    delete queue;
+}
+
+void testFifoInsidePriority() {
+    for (long i = 0; i < 5; i++) {
+        TEST_ASSERT_TRUE(queue->push(makeJob(JOB_PRIORITY_NORMAL, i)));
+    }
+    Job job;
+    for (long i = 0; i < 5; i++) {
+        TEST_ASSERT_TRUE(queue->pop(JOB_PRIORITY_MASK_ALL, &job));
+        TEST_ASSERT_EQUAL(i, (long) job.arg);
+    }
+    TEST_ASSERT_FALSE(queue->pop(JOB_PRIORITY_MASK_ALL, &job));
+}
+
+void testShutterJobsGoFirst() {
+    queue->push(makeJob(JOB_PRIORITY_BACKGROUND, 1));
+    queue->push(makeJob(JOB_PRIORITY_NORMAL, 2));
+    queue->push(makeJob(JOB_PRIORITY_BACKGROUND, 3));
+    queue->push(makeJob(JOB_PRIORITY_SHUTTER, 4));
+
+    long expected[] = {4, 2, 1, 3};
+    Job job;
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(queue->pop(JOB_PRIORITY_MASK_ALL, &job));
+        TEST_ASSERT_EQUAL(expected[i], (long) job.arg);
+    }
+}
+
+void testForegroundMaskSkipsBackgroundJobs() {
+    uint32_t foreground = JOB_PRIORITY_MASK(JOB_PRIORITY_SHUTTER) | JOB_PRIORITY_MASK(JOB_PRIORITY_NORMAL);
+    queue->push(makeJob(JOB_PRIORITY_BACKGROUND, 1));
+
+    Job job;
+    TEST_ASSERT_FALSE(queue->hasPending(foreground));
+    TEST_ASSERT_FALSE(queue->pop(foreground, &job));
+    TEST_ASSERT_TRUE(queue->hasPending(JOB_PRIORITY_MASK(JOB_PRIORITY_BACKGROUND)));
+
+    queue->push(makeJob(JOB_PRIORITY_SHUTTER, 2));
+    TEST_ASSERT_TRUE(queue->pop(foreground, &job));
+    TEST_ASSERT_EQUAL(2, (long) job.arg);
+    TEST_ASSERT_EQUAL_INT(1, queue->pending(JOB_PRIORITY_BACKGROUND));
+}
+
+void testFullPriorityDoesNotBlockOthers() {
+    for (long i = 0; i < JOB_QUEUE_CAPACITY; i++) {
+        TEST_ASSERT_TRUE(queue->push(makeJob(JOB_PRIORITY_BACKGROUND, i)));
+    }
+    TEST_ASSERT_FALSE(queue->push(makeJob(JOB_PRIORITY_BACKGROUND, 99)));
+    TEST_ASSERT_TRUE(queue->push(makeJob(JOB_PRIORITY_SHUTTER, 100)));
+    TEST_ASSERT_EQUAL_INT(JOB_QUEUE_CAPACITY, queue->pending(JOB_PRIORITY_BACKGROUND));
+
+    // Slots are reused once jobs are popped
+    Job job;
+    for (int i = 0; i < 3 * JOB_QUEUE_CAPACITY; i++) {
+        TEST_ASSERT_TRUE(queue->pop(JOB_PRIORITY_MASK(JOB_PRIORITY_BACKGROUND), &job));
+        TEST_ASSERT_TRUE(queue->push(makeJob(JOB_PRIORITY_BACKGROUND, i)));
+    }
+}
+
+void testInvalidJobsAreRejected() {
+    TEST_ASSERT_FALSE(queue->push(makeJob(JOB_PRIORITY_COUNT, 1)));
+    Job job = {nullptr, nullptr, nullptr, nullptr, JOB_PRIORITY_NORMAL};
+    TEST_ASSERT_FALSE(queue->push(job));
+    TEST_ASSERT_EQUAL_INT(0, queue->pending(JOB_PRIORITY_COUNT));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testFifoInsidePriority);
+    RUN_TEST(testShutterJobsGoFirst);
+    RUN_TEST(testForegroundMaskSkipsBackgroundJobs);
+    RUN_TEST(testFullPriorityDoesNotBlockOthers);
+    RUN_TEST(testInvalidJobsAreRejected);
+    return UNITY_END();
+}
@@ -0,0 +1,269 @@
+#include <unity.h>
+#include <math.h>
+#include <vector>
+#include <ImageArena.h>
+#include <JpegDct.h>
+#include <JpegDecoder.h>
+#include <JpegEncoder.h>
+#include "../JpegTestSupport.h"
+
+#define ARENA_BYTES (256 * 1024)
+
+JPEG_TEST_ARENA(ARENA_BYTES)
+
+// Smooth gradients, a sharp edge and a colored disc, interleaved YCbCr
+static std::vector<uint8_t> makeDiscScene(int width, int height) {
+    std::vector<uint8_t> ycc((size_t) width * height * JPEG_YCC_BYTES);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            uint8_t* pixel = &ycc[((size_t) y * width + x) * JPEG_YCC_BYTES];
+            int luma = 40 + 150 * x / width + 20 * y / height;
+            if (x > width / 2 && y < height / 3) {
+                luma = 230;
+            }
+            int dx = x - width / 3;
+            int dy = y - height / 2;
+            bool disc = dx * dx + dy * dy < (height / 4) * (height / 4);
+            pixel[0] = (uint8_t) luma;
+            pixel[1] = disc ? 90 : 128;
+            pixel[2] = disc ? 180 : 128;
+        }
+    }
+    return ycc;
+}
+
+static int tryDecode(const std::vector<uint8_t>& jpeg, std::vector<uint8_t>* ycc) {
+    JpegDecoder decoder;
+    int result = decoder.begin(jpeg.data(), jpeg.size(), arena);
+    if (result != JPEG_OK) {
+        return result;
+    }
+    size_t rowBytes = (size_t) decoder.getWidth() * JPEG_YCC_BYTES;
+    ycc->assign(rowBytes * decoder.getStripCount() * decoder.getStripHeight(), 0);
+    for (int strip = 0; strip < decoder.getStripCount(); strip++) {
+        result = decoder.decodeStrip(&(*ycc)[(size_t) strip * decoder.getStripHeight() * rowBytes], rowBytes);
+        if (result != JPEG_OK) {
+            return result;
+        }
+    }
+    ycc->resize(rowBytes * decoder.getHeight());
+    return JPEG_OK;
+}
+
+static double psnr(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, int channel) {
+    double error = 0;
+    size_t count = 0;
+    for (size_t i = channel; i < a.size(); i += JPEG_YCC_BYTES) {
+        double difference = (double) a[i] - b[i];
+        error += difference * difference;
+        count++;
+    }
+    return error == 0 ? 99.0 : 10.0 * log10(255.0 * 255.0 * count / error);
+}
+
+void testRoundTripEverySubsampling() {
+    // Sizes that are not a multiple of the MCU exercise the edge replication
+    const int width = 100;
+    const int height = 70;
+    std::vector<uint8_t> scene = makeDiscScene(width, height);
+    for (int subsampling = JPEG_SUBSAMPLING_444; subsampling <= JPEG_SUBSAMPLING_420; subsampling++) {
+        std::vector<uint8_t> jpeg = encode(scene, width, height, subsampling, 90);
+        std::vector<uint8_t> decoded;
+        arena->reset();
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, tryDecode(jpeg, &decoded));
+        TEST_ASSERT_GREATER_THAN(38.0, psnr(scene, decoded, 0));
+        TEST_ASSERT_GREATER_THAN(30.0, psnr(scene, decoded, 2));
+    }
+}
+
+void testQualityTradesSizeForError() {
+    std::vector<uint8_t> scene = makeDiscScene(128, 96);
+    std::vector<uint8_t> low = encode(scene, 128, 96, JPEG_SUBSAMPLING_422, 30);
+    std::vector<uint8_t> high = encode(scene, 128, 96, JPEG_SUBSAMPLING_422, 95);
+    std::vector<uint8_t> lowDecoded;
+    std::vector<uint8_t> highDecoded;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, tryDecode(low, &lowDecoded));
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, tryDecode(high, &highDecoded));
+    TEST_ASSERT_LESS_THAN(high.size(), low.size());
+    TEST_ASSERT_GREATER_THAN(psnr(scene, lowDecoded, 0), psnr(scene, highDecoded, 0));
+}
+
+void testRestartMarkersDecodeIdentically() {
+    std::vector<uint8_t> scene = makeDiscScene(96, 48);
+    std::vector<uint8_t> plain = encode(scene, 96, 48, JPEG_SUBSAMPLING_422, 80);
+    std::vector<uint8_t> restarted = encode(scene, 96, 48, JPEG_SUBSAMPLING_422, 80, 5);
+    TEST_ASSERT_GREATER_THAN(plain.size(), restarted.size());
+
+    std::vector<uint8_t> plainDecoded;
+    std::vector<uint8_t> restartedDecoded;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, tryDecode(plain, &plainDecoded));
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, tryDecode(restarted, &restartedDecoded));
+    TEST_ASSERT_EQUAL_MEMORY(plainDecoded.data(), restartedDecoded.data(), plainDecoded.size());
+}
+
+void testThumbnailHoldsBlockMeans() {
+    std::vector<uint8_t> scene = makeDiscScene(64, 32);
+    std::vector<uint8_t> jpeg = encode(scene, 64, 32, JPEG_SUBSAMPLING_422, 90);
+    std::vector<uint8_t> decoded;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, tryDecode(jpeg, &decoded));
+
+    JpegDecoder decoder;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.begin(jpeg.data(), jpeg.size(), arena));
+    TEST_ASSERT_EQUAL_INT(8, decoder.getThumbnailWidth());
+    TEST_ASSERT_EQUAL_INT(4, decoder.getThumbnailHeight());
+    uint8_t thumbnail[8 * 4];
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.decodeThumbnail(thumbnail));
+    for (int by = 0; by < 4; by++) {
+        for (int bx = 0; bx < 8; bx++) {
+            int sum = 0;
+            for (int y = 0; y < 8; y++) {
+                for (int x = 0; x < 8; x++) {
+                    sum += decoded[((size_t) (by * 8 + y) * 64 + bx * 8 + x) * JPEG_YCC_BYTES];
+                }
+            }
+            TEST_ASSERT_INT_WITHIN(2, sum / 64, thumbnail[by * 8 + bx]);
+        }
+    }
+
+    // The decoder is rewound for the strips
+    uint8_t strip[64 * 8 * JPEG_YCC_BYTES];
+    TEST_ASSERT_EQUAL_INT(0, decoder.getNextStrip());
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.decodeStrip(strip, 64 * JPEG_YCC_BYTES));
+    TEST_ASSERT_EQUAL_MEMORY(decoded.data(), strip, sizeof(strip));
+}
+
+void testRejectsBrokenFiles() {
+    std::vector<uint8_t> notJpeg(200, 0x42);
+    std::vector<uint8_t> decoded;
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_FORMAT, tryDecode(notJpeg, &decoded));
+
+    std::vector<uint8_t> jpeg = encode(makeDiscScene(64, 32), 64, 32, JPEG_SUBSAMPLING_422, 90);
+    std::vector<uint8_t> headerOnly(jpeg.begin(), jpeg.begin() + 100);
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_FORMAT, tryDecode(headerOnly, &decoded));
+
+    // A progressive frame header is refused
+    std::vector<uint8_t> progressive = jpeg;
+    for (size_t i = 2; i + 1 < progressive.size(); i++) {
+        if (progressive[i] == 0xFF && progressive[i + 1] == 0xC0) {
+            progressive[i + 1] = 0xC2;
+            break;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_UNSUPPORTED, tryDecode(progressive, &decoded));
+
+    JpegDecoder idle;
+    uint8_t strip[16];
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_STATE, idle.decodeStrip(strip, sizeof(strip)));
+}
+
+void testDecoderPlanesComeFromTheArena() {
+    std::vector<uint8_t> jpeg = encode(makeDiscScene(640, 16), 640, 16, JPEG_SUBSAMPLING_422, 90);
+    uint8_t small[1024];
+    ImageArena smallArena(small, sizeof(small));
+    JpegDecoder decoder;
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_MEMORY, decoder.begin(jpeg.data(), jpeg.size(), &smallArena));
+
+    // One MCU row of 16x8 luma and two 8x8 chroma blocks per MCU
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.begin(jpeg.data(), jpeg.size(), arena));
+    TEST_ASSERT_GREATER_OR_EQUAL(640 * 8 * 2, arena->getUsed());
+    TEST_ASSERT_LESS_THAN(640 * 8 * 2 + 64, arena->getUsed());
+}
+
+void testArenaMarksAndHighWater() {
+    void* first = arena->alloc(10);
+    size_t mark = arena->getMark();
+    void* second = arena->alloc(100, 16);
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_EQUAL_INT(0, (uintptr_t) second % 16);
+    arena->release(mark);
+    TEST_ASSERT_EQUAL_UINT32(mark, arena->getUsed());
+    TEST_ASSERT_GREATER_OR_EQUAL(mark + 100, arena->getHighWater());
+    TEST_ASSERT_NULL(arena->alloc(ARENA_BYTES));
+    arena->reset();
+    TEST_ASSERT_EQUAL_UINT32(0, arena->getUsed());
+}
+
+void testDctRoundTrip() {
+    uint8_t block[JPEG_BLOCK_SIZE];
+    for (int i = 0; i < JPEG_BLOCK_SIZE; i++) {
+        block[i] = (uint8_t) ((i * 37 + (i / 8) * 11) % 256);
+    }
+    int16_t coefficients[JPEG_BLOCK_SIZE];
+    jpegForwardDct(block, 8, coefficients);
+    // The DC term is 8 times the level shifted mean
+    int sum = 0;
+    for (int i = 0; i < JPEG_BLOCK_SIZE; i++) {
+        sum += block[i] - 128;
+    }
+    TEST_ASSERT_INT_WITHIN(1, sum / 8, coefficients[0]);
+
+    uint8_t restored[JPEG_BLOCK_SIZE];
+    jpegInverseDct(coefficients, restored, 8);
+    for (int i = 0; i < JPEG_BLOCK_SIZE; i++) {
+        TEST_ASSERT_INT_WITHIN(1, block[i], restored[i]);
+    }
+}
+
+void testScaledDctQuantizesLikeDivision() {
+    // The AAN scale folded in the reciprocals gives the quantized exact coefficients, to rounding
+    uint16_t quant[JPEG_BLOCK_SIZE];
+    for (int i = 0; i < JPEG_BLOCK_SIZE; i++) {
+        quant[i] = (uint16_t) (1 + (i * 7) % 60);
+    }
+    uint32_t reciprocals[JPEG_BLOCK_SIZE];
+    jpegQuantReciprocals(quant, reciprocals);
+    uint32_t state = 11;
+    for (int trial = 0; trial < 200; trial++) {
+        uint8_t block[JPEG_BLOCK_SIZE];
+        for (int i = 0; i < JPEG_BLOCK_SIZE; i++) {
+            state = state * 1664525u + 1013904223u;
+            block[i] = trial % 2 == 0 ? (uint8_t) (state >> 24) : (uint8_t) ((i % 8) * 30 + (state >> 29));
+        }
+        int16_t coefficients[JPEG_BLOCK_SIZE];
+        jpegForwardDct(block, 8, coefficients);
+        int16_t scaled[JPEG_BLOCK_SIZE];
+        int16_t quantized[JPEG_BLOCK_SIZE];
+        jpegForwardDctScaled(block, 8, scaled);
+        jpegQuantizeScaled(scaled, reciprocals, quantized);
+        for (int i = 0; i < JPEG_BLOCK_SIZE; i++) {
+            TEST_ASSERT_INT_WITHIN(1, (int) lround((double) coefficients[i] / quant[i]), quantized[i]);
+        }
+    }
+}
+
+void testStandardHuffmanTables() {
+    const JpegHuffmanSpec* specs[] = {&JPEG_STD_DC_LUMA, &JPEG_STD_AC_LUMA, &JPEG_STD_DC_CHROMA, &JPEG_STD_AC_CHROMA};
+    const int symbols[] = {12, 162, 12, 162};
+    for (int t = 0; t < 4; t++) {
+        int total = 0;
+        for (int i = 0; i < 16; i++) {
+            total += specs[t]->counts[i];
+        }
+        TEST_ASSERT_EQUAL_INT(symbols[t], total);
+
+        // Canonical codes are prefix free: each code is larger than the previous of its length
+        JpegHuffmanCodes codes;
+        JpegEncoder::buildCodes(*specs[t], &codes);
+        for (int i = 1; i < total; i++) {
+            uint8_t previous = specs[t]->values[i - 1];
+            uint8_t current = specs[t]->values[i];
+            uint32_t shifted = (uint32_t) codes.codes[previous] << (codes.sizes[current] - codes.sizes[previous]);
+            TEST_ASSERT_LESS_THAN(codes.codes[current], shifted);
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testRoundTripEverySubsampling);
+    RUN_TEST(testQualityTradesSizeForError);
+    RUN_TEST(testRestartMarkersDecodeIdentically);
+    RUN_TEST(testThumbnailHoldsBlockMeans);
+    RUN_TEST(testRejectsBrokenFiles);
+    RUN_TEST(testDecoderPlanesComeFromTheArena);
+    RUN_TEST(testArenaMarksAndHighWater);
+    RUN_TEST(testDctRoundTrip);
+    RUN_TEST(testScaledDctQuantizesLikeDivision);
+    RUN_TEST(testStandardHuffmanTables);
+    return UNITY_END();
+}
@@ -0,0 +1,231 @@
+#include <unity.h>
+#include <math.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include <JpegTransform.h>
+#include "../JpegTestSupport.h"
+
+#define FRAME_WIDTH 640
+#define FRAME_HEIGHT 480
+#define ARENA_BYTES (1024 * 1024)
+
+JPEG_TEST_ARENA(ARENA_BYTES)
+
+// The reference: the same turn and crop of the decoded pixels
+static std::vector<uint8_t> turnPixels(const std::vector<uint8_t>& ycc, int width, int height, int rotation, int left, int top,
+                                       int outputWidth, int outputHeight) {
+    std::vector<uint8_t> out((size_t) outputWidth * outputHeight * JPEG_YCC_BYTES);
+    bool turned = rotation == JPEG_ROTATE_90 || rotation == JPEG_ROTATE_270;
+    int turnedWidth = turned ? height : width;
+    int turnedHeight = turned ? width : height;
+    for (int y = 0; y < outputHeight; y++) {
+        for (int x = 0; x < outputWidth; x++) {
+            int turnedX = left + x;
+            int turnedY = top + y;
+            int sourceX = turnedX;
+            int sourceY = turnedY;
+            if (rotation == JPEG_ROTATE_90) {
+                sourceX = turnedY;
+                sourceY = turnedWidth - 1 - turnedX;
+            } else if (rotation == JPEG_ROTATE_180) {
+                sourceX = turnedWidth - 1 - turnedX;
+                sourceY = turnedHeight - 1 - turnedY;
+            } else if (rotation == JPEG_ROTATE_270) {
+                sourceX = turnedHeight - 1 - turnedY;
+                sourceY = turnedX;
+            }
+            memcpy(&out[((size_t) y * outputWidth + x) * JPEG_YCC_BYTES], &ycc[((size_t) sourceY * width + sourceX) * JPEG_YCC_BYTES],
+                   JPEG_YCC_BYTES);
+        }
+    }
+    return out;
+}
+
+static int maxDifference(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+    int worst = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        int difference = abs((int) a[i] - (int) b[i]);
+        worst = difference > worst ? difference : worst;
+    }
+    return worst;
+}
+
+static std::vector<uint8_t> transform(const std::vector<uint8_t>& jpeg, int rotation, int crop, JpegTransform* transformer = nullptr) {
+    JpegTransform local(arena);
+    JpegTransform* used = transformer != nullptr ? transformer : &local;
+    std::vector<uint8_t> out;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, used->write(jpeg.data(), jpeg.size(), rotation, crop, writeToVector, &out));
+    TEST_ASSERT_EQUAL_UINT32(0, arena->getUsed());
+    return out;
+}
+
+// Checks a transform against the pixel space, the crop centered on the MCU grid of the output
+static void checkAgainstPixels(int rotation, int crop, int expectedWidth, int expectedHeight, int expectedLeft, int expectedTop) {
+    std::vector<uint8_t> source = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85);
+    JpegTransform transformer(arena);
+    std::vector<uint8_t> turned = transform(source, rotation, crop, &transformer);
+    TEST_ASSERT_EQUAL_INT(expectedWidth, transformer.getOutputWidth());
+    TEST_ASSERT_EQUAL_INT(expectedHeight, transformer.getOutputHeight());
+
+    int width, height;
+    std::vector<uint8_t> result = decode(turned, &width, &height);
+    TEST_ASSERT_EQUAL_INT(expectedWidth, width);
+    TEST_ASSERT_EQUAL_INT(expectedHeight, height);
+    std::vector<uint8_t> reference = turnPixels(decode(source), FRAME_WIDTH, FRAME_HEIGHT, rotation, expectedLeft, expectedTop,
+                                                expectedWidth, expectedHeight);
+
+    // The coefficients are the same, only the rounding of the inverse DCT can follow another order
+    int worst = maxDifference(reference, result);
+    char message[96];
+    snprintf(message, sizeof(message), "rotation %d crop %d: %dx%d, largest difference %d", rotation * 90, crop, width, height, worst);
+    TEST_MESSAGE(message);
+    if (rotation == JPEG_ROTATE_0) {
+        TEST_ASSERT_EQUAL_INT(0, worst);
+    } else {
+        TEST_ASSERT_LESS_OR_EQUAL(1, worst);
+    }
+}
+
+void testRotationsMatchPixelSpace() {
+    checkAgainstPixels(JPEG_ROTATE_90, JPEG_CROP_FULL, FRAME_HEIGHT, FRAME_WIDTH, 0, 0);
+    checkAgainstPixels(JPEG_ROTATE_180, JPEG_CROP_FULL, FRAME_WIDTH, FRAME_HEIGHT, 0, 0);
+    checkAgainstPixels(JPEG_ROTATE_270, JPEG_CROP_FULL, FRAME_HEIGHT, FRAME_WIDTH, 0, 0);
+}
+
+void testCropsAreCenteredOnTheMcuGrid() {
+    // 640x426 snapped to 8 rows, 3 MCU rows dropped above
+    checkAgainstPixels(JPEG_ROTATE_0, JPEG_CROP_3_2, 640, 424, 0, 24);
+    // 480 columns is 30 MCUs of 16, 5 dropped on the left
+    checkAgainstPixels(JPEG_ROTATE_0, JPEG_CROP_SQUARE, 480, 480, 80, 0);
+    // Turned, the 4:4:0 MCU is 8 wide and 16 high, the crop is portrait
+    checkAgainstPixels(JPEG_ROTATE_90, JPEG_CROP_3_2, 424, 640, 24, 0);
+    checkAgainstPixels(JPEG_ROTATE_270, JPEG_CROP_SQUARE, 480, 480, 0, 80);
+    checkAgainstPixels(JPEG_ROTATE_180, JPEG_CROP_3_2, 640, 424, 0, 24);
+}
+
+void testRoundTripsAreLossless() {
+    std::vector<uint8_t> source = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85);
+    std::vector<uint8_t> original = decode(source);
+
+    // A turn and its inverse give the coefficients of the source back, so the same pixels
+    std::vector<uint8_t> back = transform(transform(source, JPEG_ROTATE_90, JPEG_CROP_FULL), JPEG_ROTATE_270, JPEG_CROP_FULL);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(original.data(), decode(back).data(), original.size());
+    back = transform(transform(source, JPEG_ROTATE_180, JPEG_CROP_FULL), JPEG_ROTATE_180, JPEG_CROP_FULL);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(original.data(), decode(back).data(), original.size());
+    std::vector<uint8_t> turned = source;
+    for (int i = 0; i < 4; i++) {
+        turned = transform(turned, JPEG_ROTATE_90, JPEG_CROP_FULL);
+    }
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(original.data(), decode(turned).data(), original.size());
+
+    // Without a turn or a crop the scan is coded again bit for bit
+    std::vector<uint8_t> copy = transform(source, JPEG_ROTATE_0, JPEG_CROP_FULL);
+    TEST_ASSERT_EQUAL_UINT32(source.size(), copy.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(source.data(), copy.data(), source.size());
+}
+
+void testRestartMarkersAreFollowed() {
+    std::vector<uint8_t> scene = makeScene(FRAME_WIDTH, FRAME_HEIGHT);
+    std::vector<uint8_t> plain = encode(scene, FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85);
+    std::vector<uint8_t> restarted = encode(scene, FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85, 7);
+    for (int rotation = JPEG_ROTATE_90; rotation < JPEG_ROTATE_COUNT; rotation++) {
+        // Seeks land inside and at the start of intervals, the output keeps the interval
+        std::vector<uint8_t> fromPlain = decode(transform(plain, rotation, JPEG_CROP_3_2));
+        std::vector<uint8_t> fromRestarted = transform(restarted, rotation, JPEG_CROP_3_2);
+        JpegDecoder decoder;
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.begin(fromRestarted.data(), fromRestarted.size(), nullptr));
+        TEST_ASSERT_EQUAL_UINT16(7, decoder.getRestartInterval());
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(fromPlain.data(), decode(fromRestarted).data(), fromPlain.size());
+    }
+}
+
+void testPartialMcusAreTrimmed() {
+    // 100x60 is 6 whole MCUs of 16 and 7 whole rows of 8, plus partial ones
+    std::vector<uint8_t> source = encode(makeScene(100, 60), 100, 60, JPEG_SUBSAMPLING_422, 90);
+    JpegTransform transformer(arena);
+    std::vector<uint8_t> turned = transform(source, JPEG_ROTATE_90, JPEG_CROP_FULL, &transformer);
+    TEST_ASSERT_EQUAL_INT(56, transformer.getOutputWidth());
+    TEST_ASSERT_EQUAL_INT(96, transformer.getOutputHeight());
+    JpegDecoder decoder;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.begin(turned.data(), turned.size(), nullptr));
+    TEST_ASSERT_EQUAL_INT(JPEG_SUBSAMPLING_440, decoder.getSubsampling());
+
+    // Without a turn the partial MCUs stay
+    transform(source, JPEG_ROTATE_0, JPEG_CROP_FULL, &transformer);
+    TEST_ASSERT_EQUAL_INT(100, transformer.getOutputWidth());
+    TEST_ASSERT_EQUAL_INT(60, transformer.getOutputHeight());
+}
+
+void testBadInputAndMemory() {
+    std::vector<uint8_t> source = encode(makeScene(FRAME_WIDTH, FRAME_HEIGHT), FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422, 85);
+    JpegTransform transformer(arena);
+    std::vector<uint8_t> out;
+
+    uint8_t garbage[64] = {0xFF, 0xD8, 0x12};
+    TEST_ASSERT_NOT_EQUAL(JPEG_OK, transformer.write(garbage, sizeof(garbage), JPEG_ROTATE_90, JPEG_CROP_FULL, writeToVector, &out));
+    TEST_ASSERT_EQUAL_UINT32(0, arena->getUsed());
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_UNSUPPORTED,
+                          transformer.write(source.data(), source.size(), 5, JPEG_CROP_FULL, writeToVector, &out));
+
+    // A scan cut short runs into the end of the file
+    std::vector<uint8_t> cut(source.begin(), source.begin() + source.size() / 2);
+    cut.push_back(0xFF);
+    cut.push_back(0xD9);
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_DATA, transformer.write(cut.data(), cut.size(), JPEG_ROTATE_90, JPEG_CROP_FULL, writeToVector, &out));
+    TEST_ASSERT_EQUAL_UINT32(0, arena->getUsed());
+
+    // The bound is enough, less is refused without writing past the arena
+    size_t required = JpegTransform::requiredBytes(FRAME_WIDTH, FRAME_HEIGHT, JPEG_SUBSAMPLING_422);
+    std::vector<uint8_t> exact(required);
+    ImageArena exactArena(exact.data(), exact.size());
+    JpegTransform fitting(&exactArena);
+    out.clear();
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, fitting.write(source.data(), source.size(), JPEG_ROTATE_90, JPEG_CROP_FULL, writeToVector, &out));
+    ImageArena tightArena(exact.data(), required / 2);
+    JpegTransform tight(&tightArena);
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_MEMORY, tight.write(source.data(), source.size(), JPEG_ROTATE_90, JPEG_CROP_FULL, writeToVector, &out));
+    TEST_ASSERT_EQUAL_UINT32(0, tightArena.getUsed());
+}
+
+void testThroughput() {
+    // QSXGA, the sensor frame
+    const int width = 2560;
+    const int height = 1920;
+    std::vector<uint8_t> source = encode(makeScene(width, height), width, height, JPEG_SUBSAMPLING_422, 85);
+    double sourceMb = source.size() / (1024.0 * 1024.0);
+
+    // The pixel-space way, decode, turn and encode again
+    auto start = std::chrono::steady_clock::now();
+    int decodedWidth, decodedHeight;
+    std::vector<uint8_t> pixels = decode(source, &decodedWidth, &decodedHeight);
+    std::vector<uint8_t> turnedPixels = turnPixels(pixels, width, height, JPEG_ROTATE_90, 0, 0, height, width);
+    std::vector<uint8_t> reencoded = encode(turnedPixels, height, width, JPEG_SUBSAMPLING_422, 85);
+    double pixelMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    const char* names[JPEG_ROTATE_COUNT] = {"crop 3:2", "90", "180", "270"};
+    for (int rotation = JPEG_ROTATE_0; rotation < JPEG_ROTATE_COUNT; rotation++) {
+        int crop = rotation == JPEG_ROTATE_0 ? JPEG_CROP_3_2 : JPEG_CROP_FULL;
+        start = std::chrono::steady_clock::now();
+        std::vector<uint8_t> out = transform(source, rotation, crop);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        char message[128];
+        snprintf(message, sizeof(message), "%s: %.1f ms, %.1f MB/s of a %.0f KB frame, pixel space %.1f ms", names[rotation], ms,
+                 sourceMb / (ms / 1000.0), source.size() / 1024.0, pixelMs);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_TRUE(ms < pixelMs);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(testRotationsMatchPixelSpace);
+    RUN_TEST(testCropsAreCenteredOnTheMcuGrid);
+    RUN_TEST(testRoundTripsAreLossless);
+    RUN_TEST(testRestartMarkersAreFollowed);
+    RUN_TEST(testPartialMcusAreTrimmed);
+    RUN_TEST(testBadInputAndMemory);
+    RUN_TEST(testThroughput);
+    return UNITY_END();
+}
@@ -0,0 +1,206 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+#include <ExposureControl.h>
+#include <LumaMeter.h>
+
+#define FRAME_WIDTH 80
+#define FRAME_HEIGHT 60
+#define FRAME_PIXELS (FRAME_WIDTH * FRAME_HEIGHT)
+
+static uint8_t gray[FRAME_PIXELS + 8];
+static uint8_t rgb[FRAME_PIXELS * 2];
+static MeterStats stats;
+
+void setUp(void) {
+    srand(1234);
+}
+
+void tearDown(void) {}
+
+static void putRgb565(uint8_t* out, uint8_t red, uint8_t green, uint8_t blue) {
+    uint16_t pixel = ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
+    out[0] = pixel >> 8;
+    out[1] = pixel & 0xFF;
+}
+
+void testGrayHistogramMatchesReference() {
+    // Every start alignment and odd lengths go through the head and tail paths
+    for (int offset = 0; offset < 4; offset++) {
+        size_t count = FRAME_PIXELS - offset * 3 - 1;
+        uint32_t reference[LUMA_LEVELS] = {0};
+        uint64_t sum = 0;
+        for (size_t i = 0; i < count; i++) {
+            gray[offset + i] = rand() & 0xFF;
+            reference[gray[offset + i]]++;
+            sum += gray[offset + i];
+        }
+        LumaMeter::measureGray8(gray + offset, count, &stats);
+        TEST_ASSERT_EQUAL_UINT32(count, stats.count);
+        TEST_ASSERT_EQUAL_MEMORY(reference, stats.histogram, sizeof(reference));
+        TEST_ASSERT_EQUAL_UINT8((sum + count / 2) / count, stats.mean);
+    }
+}
+
+void testClippingAndPercentiles() {
+    // 10% black, 80% mid gray, 10% white
+    for (int i = 0; i < FRAME_PIXELS; i++) {
+        gray[i] = i < FRAME_PIXELS / 10 ? 0 : (i < FRAME_PIXELS * 9 / 10 ? 128 : 255);
+    }
+    LumaMeter::measureGray8(gray, FRAME_PIXELS, &stats);
+    TEST_ASSERT_EQUAL_UINT32(FRAME_PIXELS / 10, stats.clippedLow);
+    TEST_ASSERT_EQUAL_UINT32(FRAME_PIXELS / 10, stats.clippedHigh);
+    TEST_ASSERT_EQUAL_UINT8(128, stats.median);
+    TEST_ASSERT_EQUAL_UINT8(255, stats.percentile98);
+    TEST_ASSERT_EQUAL_UINT8(0, LumaMeter::percentile(stats, 50));
+    TEST_ASSERT_EQUAL_UINT32(0, stats.sumRed);
+}
+
+void testRgbLumaAndChannelSums() {
+    for (int i = 0; i < FRAME_PIXELS; i++) {
+        putRgb565(rgb + 2 * i, 255, 255, 255);
+    }
+    LumaMeter::measureRgb565(rgb, FRAME_PIXELS, &stats);
+    TEST_ASSERT_EQUAL_UINT8(255, stats.mean);
+    TEST_ASSERT_EQUAL_UINT32(FRAME_PIXELS, stats.clippedHigh);
+    TEST_ASSERT_EQUAL_UINT32(255u * FRAME_PIXELS, stats.sumRed);
+
+    // Pure green weighs more than pure red or blue
+    putRgb565(rgb, 0, 255, 0);
+    LumaMeter::measureRgb565(rgb, 1, &stats);
+    TEST_ASSERT_EQUAL_UINT8(149, stats.mean);
+    putRgb565(rgb, 255, 0, 0);
+    LumaMeter::measureRgb565(rgb, 1, &stats);
+    TEST_ASSERT_EQUAL_UINT8(76, stats.mean);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.sumGreen);
+}
+
+void testDetailFollowsGradients() {
+    // Flat frame, then vertical stripes of 0 and 64
+    for (int i = 0; i < FRAME_PIXELS; i++) {
+        putRgb565(rgb + 2 * i, 100, 100, 100);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, LumaMeter::measureDetail(rgb, FRAME_WIDTH, FRAME_HEIGHT));
+    for (int i = 0; i < FRAME_PIXELS; i++) {
+        uint8_t level = (i % FRAME_WIDTH) & 1 ? 64 : 0;
+        putRgb565(rgb + 2 * i, level, level, level);
+    }
+    TEST_ASSERT_UINT32_WITHIN(16, 64 * 16, LumaMeter::measureDetail(rgb, FRAME_WIDTH, FRAME_HEIGHT));
+}
+
+/**
+ * @brief Simulated sensor: a scene of reflectances, brightness proportional to exposure times gain, clipped at 255.
+ */
+static void simulateFrame(const ExposureSettings& settings, uint32_t sceneScale, bool brightSky) {
+    uint32_t brightness = ExposureControl::brightness(settings);
+    for (int i = 0; i < FRAME_PIXELS; i++) {
+        uint32_t reflectance = (i * 7) % 200 + 20;
+        if (brightSky && i < FRAME_PIXELS / 5) {
+            reflectance = 2000;
+        }
+        uint64_t level = (uint64_t) reflectance * brightness * sceneScale / 100000;
+        gray[i] = level > 255 ? 255 : (uint8_t) level;
+    }
+    LumaMeter::measureGray8(gray, FRAME_PIXELS, &stats);
+}
+
+static int runLoop(ExposureControl& control, ExposureSettings* settings, uint32_t sceneScale, bool brightSky) {
+    for (int frame = 1; frame <= 8; frame++) {
+        simulateFrame(*settings, sceneScale, brightSky);
+        if (control.update(stats, settings)) {
+            return frame;
+        }
+    }
+    return -1;
+}
+
+void testConvergesInFewFramesOverTheRange() {
+    ExposureControl control;
+    // From a bright beach to a dim room
+    uint32_t scenes[] = {2000, 300, 20, 5};
+    for (uint32_t scene : scenes) {
+        ExposureSettings settings;
+        int frames = runLoop(control, &settings, scene, false);
+        TEST_ASSERT_GREATER_THAN(0, frames);
+        TEST_ASSERT_LESS_OR_EQUAL(5, frames);
+        TEST_ASSERT_INT_WITHIN(EXPOSURE_TOLERANCE, EXPOSURE_TARGET_MEAN, stats.mean);
+    }
+}
+
+void testGainOnlyPastLongestExposure() {
+    ExposureControl control;
+    ExposureSettings settings;
+    TEST_ASSERT_GREATER_THAN(0, runLoop(control, &settings, 300, false));
+    TEST_ASSERT_EQUAL_UINT8(0, settings.gain);
+
+    settings = ExposureSettings();
+    TEST_ASSERT_GREATER_THAN(0, runLoop(control, &settings, 5, false));
+    TEST_ASSERT_GREATER_THAN(0, settings.gain);
+    TEST_ASSERT_GREATER_THAN(EXPOSURE_MAX_LINES / 2, settings.exposureLines);
+}
+
+void testTooDarkSettlesAtTheLimit() {
+    ExposureControl control;
+    ExposureSettings settings;
+    TEST_ASSERT_GREATER_THAN(0, runLoop(control, &settings, 1, false));
+    TEST_ASSERT_EQUAL_UINT16(EXPOSURE_MAX_LINES, settings.exposureLines);
+    TEST_ASSERT_EQUAL_UINT8(EXPOSURE_MAX_GAIN, settings.gain);
+}
+
+void testHighlightsPullExposureDown() {
+    ExposureControl control;
+    ExposureSettings settings;
+    int frames = runLoop(control, &settings, 300, true);
+    TEST_ASSERT_GREATER_THAN(0, frames);
+
+    // Either the sky is no longer blown or the scene is accepted as backlit
+    bool clipped = stats.clippedHigh * 1000 > stats.count * EXPOSURE_HIGHLIGHT_LIMIT_PERMILLE;
+    TEST_ASSERT_TRUE(!clipped || stats.mean < EXPOSURE_TARGET_MEAN - EXPOSURE_TOLERANCE);
+}
+
+void testStepIsLimited() {
+    ExposureControl control;
+    ExposureSettings settings;
+    memset(gray, 0, FRAME_PIXELS);
+    LumaMeter::measureGray8(gray, FRAME_PIXELS, &stats);
+    TEST_ASSERT_FALSE(control.update(stats, &settings));
+    TEST_ASSERT_EQUAL_UINT32(300 * EXPOSURE_MAX_STEP, ExposureControl::brightness(settings));
+
+    memset(gray, 255, FRAME_PIXELS);
+    LumaMeter::measureGray8(gray, FRAME_PIXELS, &stats);
+    settings = ExposureSettings();
+    TEST_ASSERT_FALSE(control.update(stats, &settings));
+    // Saturated, the largest step down
+    TEST_ASSERT_EQUAL_UINT32(300 / EXPOSURE_MAX_STEP, ExposureControl::brightness(settings));
+}
+
+void testWhiteBalancePresets() {
+    memset(&stats, 0, sizeof(stats));
+    TEST_ASSERT_EQUAL_UINT8(WB_MODE_AUTO, ExposureControl::pickWhiteBalance(stats));
+
+    stats.sumGreen = 1000;
+    stats.sumRed = 1000;
+    stats.sumBlue = 1000;
+    TEST_ASSERT_EQUAL_UINT8(WB_MODE_SUNNY, ExposureControl::pickWhiteBalance(stats));
+    stats.sumBlue = 1300;
+    TEST_ASSERT_EQUAL_UINT8(WB_MODE_CLOUDY, ExposureControl::pickWhiteBalance(stats));
+    stats.sumBlue = 700;
+    TEST_ASSERT_EQUAL_UINT8(WB_MODE_OFFICE, ExposureControl::pickWhiteBalance(stats));
+    stats.sumBlue = 400;
+    TEST_ASSERT_EQUAL_UINT8(WB_MODE_HOME, ExposureControl::pickWhiteBalance(stats));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testGrayHistogramMatchesReference);
+    RUN_TEST(testClippingAndPercentiles);
+    RUN_TEST(testRgbLumaAndChannelSums);
+    RUN_TEST(testDetailFollowsGradients);
+    RUN_TEST(testConvergesInFewFramesOverTheRange);
+    RUN_TEST(testGainOnlyPastLongestExposure);
+    RUN_TEST(testTooDarkSettlesAtTheLimit);
+    RUN_TEST(testHighlightsPullExposureDown);
+    RUN_TEST(testStepIsLimited);
+    RUN_TEST(testWhiteBalancePresets);
+    return UNITY_END();
+}
@@ -0,0 +1,112 @@
+#include <unity.h>
+#include <PowerTracker.h>
+
+static PowerTracker* tracker;
+
+void setUp(void) {
+    tracker = new PowerTracker();
+    tracker->start(1000);
+}
+
+void tearDown(void) {
+    delete tracker;
+}
+
+void testTimeIsAccountedPerState() {
+    tracker->setState(POWER_STATE_ACTIVE, 3000);
+    tracker->setState(POWER_STATE_IDLE, 4000);
+    tracker->setState(POWER_STATE_SENSOR_OFF, 10000);
+
+    TEST_ASSERT_EQUAL_UINT32(1000, tracker->getTimeInState(POWER_STATE_ACTIVE, 20000));
+    TEST_ASSERT_EQUAL_UINT32(2000 + 6000, tracker->getTimeInState(POWER_STATE_IDLE, 20000));
+    // The current stay counts up to now
+    TEST_ASSERT_EQUAL_UINT32(10000, tracker->getTimeInState(POWER_STATE_SENSOR_OFF, 20000));
+    TEST_ASSERT_EQUAL_INT(POWER_STATE_SENSOR_OFF, tracker->getState());
+}
+
+void testChargeAndAverageCurrent() {
+    // One hour idle, then one hour with the sensor off
+    tracker->setState(POWER_STATE_SENSOR_OFF, 1000 + 3600000);
+    uint32_t end = 1000 + 2 * 3600000;
+
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, POWER_IDLE_CURRENT_MA + POWER_SENSOR_OFF_CURRENT_MA, tracker->getChargeUsedMah(end));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, (POWER_IDLE_CURRENT_MA + POWER_SENSOR_OFF_CURRENT_MA) / 2.0f,
+                             tracker->getAverageCurrentMa(end));
+}
+
+void testSensorIdleAfterTimeout() {
+    tracker->noteActivity(5000);
+    TEST_ASSERT_FALSE(tracker->isSensorIdle(5000 + SENSOR_IDLE_TIMEOUT_MS - 1));
+    TEST_ASSERT_TRUE(tracker->isSensorIdle(5000 + SENSOR_IDLE_TIMEOUT_MS));
+
+    tracker->noteActivity(5000 + SENSOR_IDLE_TIMEOUT_MS);
+    TEST_ASSERT_FALSE(tracker->isSensorIdle(5000 + SENSOR_IDLE_TIMEOUT_MS + 1));
+}
+
+void testFeltRearmDoublesTimeout() {
+    tracker->recordRearm(150, 40);
+    TEST_ASSERT_EQUAL_UINT32(2 * SENSOR_IDLE_TIMEOUT_MS, tracker->getSensorIdleTimeoutMs());
+
+    for (int i = 0; i < 10; i++) {
+        tracker->recordRearm(150, 40);
+    }
+    TEST_ASSERT_EQUAL_UINT32(SENSOR_IDLE_TIMEOUT_MAX_MS, tracker->getSensorIdleTimeoutMs());
+}
+
+void testHiddenRearmsShrinkTimeoutToFloor() {
+    for (int i = 0; i < 50; i++) {
+        tracker->recordRearm(20, 0);
+    }
+    TEST_ASSERT_EQUAL_UINT32(SENSOR_IDLE_TIMEOUT_MIN_MS, tracker->getSensorIdleTimeoutMs());
+    TEST_ASSERT_EQUAL_UINT32(20, tracker->getRearmLatencyMs());
+}
+
+void testSlowRearmRaisesBreakEvenFloor() {
+    // A 2 s re-arm at full clock costs more than 5 s of savings
+    for (int i = 0; i < 50; i++) {
+        tracker->recordRearm(2000, 0);
+    }
+    uint32_t breakEvenMs = (uint32_t) (2000.0f * POWER_ACTIVE_CURRENT_MA / (POWER_IDLE_CURRENT_MA - POWER_SENSOR_OFF_CURRENT_MA));
+    TEST_ASSERT_TRUE(breakEvenMs > SENSOR_IDLE_TIMEOUT_MIN_MS);
+    TEST_ASSERT_UINT32_WITHIN(1, breakEvenMs, tracker->getSensorIdleTimeoutMs());
+}
+
+void testPowerDownSavesChargeOverADay() {
+    // A day of use: a burst of shots every 15 minutes, compare always-on with the tracker policy
+    PowerTracker alwaysOn;
+    PowerTracker managed;
+    alwaysOn.start(0);
+    managed.start(0);
+    bool sensorOn = true;
+    const uint32_t dayMs = 24u * 3600u * 1000u;
+    for (uint32_t now = 0; now < dayMs; now += 100) {
+        bool shooting = (now % 900000) < 2000;
+        if (shooting && (now % 900000) == 0) {
+            managed.noteActivity(now);
+            if (!sensorOn) {
+                // Re-armed during the press, hidden from the shot
+                managed.recordRearm(120, 0);
+                sensorOn = true;
+            }
+        }
+        alwaysOn.setState(shooting ? POWER_STATE_ACTIVE : POWER_STATE_IDLE, now);
+        if (sensorOn && !shooting && managed.isSensorIdle(now)) {
+            sensorOn = false;
+        }
+        managed.setState(shooting ? POWER_STATE_ACTIVE : (sensorOn ? POWER_STATE_IDLE : POWER_STATE_SENSOR_OFF), now);
+    }
+    float saved = 1.0f - managed.getChargeUsedMah(dayMs) / alwaysOn.getChargeUsedMah(dayMs);
+    TEST_ASSERT_GREATER_THAN(50, (int) (saved * 100.0f));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testTimeIsAccountedPerState);
+    RUN_TEST(testChargeAndAverageCurrent);
+    RUN_TEST(testSensorIdleAfterTimeout);
+    RUN_TEST(testFeltRearmDoublesTimeout);
+    RUN_TEST(testHiddenRearmsShrinkTimeoutToFloor);
+    RUN_TEST(testSlowRearmRaisesBreakEvenFloor);
+    RUN_TEST(testPowerDownSavesChargeOverADay);
+    return UNITY_END();
+}
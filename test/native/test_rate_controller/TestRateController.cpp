@@ -0,0 +1,156 @@
+#include <stdlib.h>
+#include <unity.h>
+#include <RateController.h>
+
+// Complexities of simulated scenes, bytes times (quality + offset)
+#define SCENE_SKY 2000000ull
+#define SCENE_STREET 8000000ull
+#define SCENE_FOLIAGE 16000000ull
+
+void setUp(void) {
+    srand(42);
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief Simulated sensor: the size model with up to 6% of noise either way.
+ */
+static uint32_t encode(uint64_t sceneComplexity, uint8_t quality) {
+    uint64_t bytes = sceneComplexity / (quality + RATE_QUALITY_OFFSET);
+    int noisePercent = rand() % 13 - 6;
+    return (uint32_t) (bytes * (100 + noisePercent) / 100);
+}
+
+void testFirstFrameUsesFinestQuality() {
+    RateController rate;
+    TEST_ASSERT_EQUAL_UINT8(RATE_DEFAULT_MIN_QUALITY, rate.getQuality());
+    TEST_ASSERT_EQUAL_UINT32(RATE_DEFAULT_BYTE_BUDGET * RATE_DEFAULT_HEADROOM_PERCENT / 100, rate.getTargetBytes());
+    TEST_ASSERT_EQUAL_UINT32(0, rate.predictBytes(20));
+}
+
+void testSimpleSceneKeepsFinestQuality() {
+    RateController rate;
+    for (int i = 0; i < 20; i++) {
+        rate.onFrame(encode(SCENE_SKY, rate.getQuality()), rate.getQuality());
+    }
+    TEST_ASSERT_EQUAL_UINT8(RATE_DEFAULT_MIN_QUALITY, rate.getQuality());
+    TEST_ASSERT_EQUAL_UINT32(0, rate.getOverBudgetCount());
+}
+
+void testDetailedSceneSettlesUnderBudget() {
+    RateController rate;
+    // The first frame of an unknown scene may blow the budget, later ones must not
+    rate.onFrame(encode(SCENE_FOLIAGE, rate.getQuality()), rate.getQuality());
+    uint32_t overAfterFirst = rate.getOverBudgetCount();
+    for (int i = 0; i < 50; i++) {
+        uint8_t quality = rate.getQuality();
+        uint32_t bytes = encode(SCENE_FOLIAGE, quality);
+        TEST_ASSERT_LESS_OR_EQUAL(RATE_DEFAULT_BYTE_BUDGET, bytes);
+        rate.onFrame(bytes, quality);
+    }
+    TEST_ASSERT_EQUAL_UINT32(overAfterFirst, rate.getOverBudgetCount());
+    TEST_ASSERT_GREATER_THAN(RATE_DEFAULT_MIN_QUALITY, rate.getQuality());
+    // Close to the target, not far below it
+    TEST_ASSERT_GREATER_THAN(80, rate.getMeanSizePercent());
+}
+
+void testDetailPredictsSceneChange() {
+    RateController rate;
+    rate.noteDetail(100);
+    for (int i = 0; i < 10; i++) {
+        rate.onFrame(encode(SCENE_STREET, rate.getQuality()), rate.getQuality());
+    }
+    uint8_t streetQuality = rate.getQuality();
+
+    // Metering sees twice the detail before the first foliage frame
+    uint8_t quality = rate.noteDetail(200);
+    TEST_ASSERT_GREATER_THAN(streetQuality, quality);
+    uint32_t bytes = encode(SCENE_FOLIAGE, quality);
+    TEST_ASSERT_LESS_OR_EQUAL(RATE_DEFAULT_BYTE_BUDGET, bytes);
+
+    // Without the hint, the same change goes over budget
+    RateController blind;
+    for (int i = 0; i < 10; i++) {
+        blind.onFrame(encode(SCENE_STREET, blind.getQuality()), blind.getQuality());
+    }
+    TEST_ASSERT_GREATER_THAN(RATE_DEFAULT_BYTE_BUDGET, SCENE_FOLIAGE / (blind.getQuality() + RATE_QUALITY_OFFSET));
+}
+
+void testSlowCardLowersTarget() {
+    RateController rate;
+    for (int i = 0; i < 10; i++) {
+        rate.onFrame(encode(SCENE_STREET, rate.getQuality()), rate.getQuality());
+    }
+    uint8_t fastQuality = rate.getQuality();
+
+    // 150 kB/s, 1.5 s of writing moves 225 kB
+    for (int i = 0; i < 20; i++) {
+        rate.noteWrite(150000, 1000);
+    }
+    TEST_ASSERT_UINT32_WITHIN(1000, 150000, rate.getWriteBytesPerSecond());
+    TEST_ASSERT_UINT32_WITHIN(2000, 225000 * RATE_DEFAULT_HEADROOM_PERCENT / 100, rate.getTargetBytes());
+    TEST_ASSERT_GREATER_THAN(fastQuality, rate.getQuality());
+    for (int i = 0; i < 20; i++) {
+        uint8_t quality = rate.getQuality();
+        uint32_t bytes = encode(SCENE_STREET, quality);
+        TEST_ASSERT_LESS_OR_EQUAL(225000, bytes);
+        rate.onFrame(bytes, quality);
+    }
+}
+
+void testImpossibleSceneClampsAndCounts() {
+    RateConfig config;
+    config.byteBudget = 50000;
+    RateController rate(config);
+    for (int i = 0; i < 5; i++) {
+        rate.onFrame(encode(SCENE_FOLIAGE, rate.getQuality()), rate.getQuality());
+    }
+    TEST_ASSERT_EQUAL_UINT8(RATE_DEFAULT_MAX_QUALITY, rate.getQuality());
+    TEST_ASSERT_EQUAL_UINT32(5, rate.getOverBudgetCount());
+    TEST_ASSERT_GREATER_THAN(100, rate.getLastSizePercent());
+}
+
+void testSizeShareIsReported() {
+    RateController rate;
+    uint32_t target = rate.getTargetBytes();
+    rate.onFrame(target / 2, RATE_DEFAULT_MIN_QUALITY);
+    TEST_ASSERT_EQUAL_UINT32(50, rate.getLastSizePercent());
+    rate.onFrame(rate.getTargetBytes(), rate.getQuality());
+    TEST_ASSERT_EQUAL_UINT32(100, rate.getLastSizePercent());
+    TEST_ASSERT_EQUAL_UINT32(75, rate.getMeanSizePercent());
+    TEST_ASSERT_EQUAL_UINT32(2, rate.getFrameCount());
+}
+
+void testFinestQualityOfAFilm() {
+    RateController rate;
+    for (int i = 0; i < 10; i++) {
+        rate.onFrame(encode(SCENE_SKY, rate.getQuality()), rate.getQuality());
+    }
+    TEST_ASSERT_EQUAL_UINT8(RATE_DEFAULT_MIN_QUALITY, rate.getQuality());
+
+    // A coarser film holds the easy scene at its own finest quality
+    TEST_ASSERT_EQUAL_UINT8(25, rate.setFinestQuality(25));
+    for (int i = 0; i < 10; i++) {
+        rate.onFrame(encode(SCENE_SKY, rate.getQuality()), rate.getQuality());
+    }
+    TEST_ASSERT_EQUAL_UINT8(25, rate.getQuality());
+
+    // Finer than the camera allows, or coarser than the range, is kept within the range
+    TEST_ASSERT_EQUAL_UINT8(RATE_DEFAULT_MIN_QUALITY, rate.setFinestQuality(4));
+    RateController coarse;
+    TEST_ASSERT_EQUAL_UINT8(RATE_DEFAULT_MAX_QUALITY, coarse.setFinestQuality(63));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testFirstFrameUsesFinestQuality);
+    RUN_TEST(testSimpleSceneKeepsFinestQuality);
+    RUN_TEST(testDetailedSceneSettlesUnderBudget);
+    RUN_TEST(testDetailPredictsSceneChange);
+    RUN_TEST(testSlowCardLowersTarget);
+    RUN_TEST(testImpossibleSceneClampsAndCounts);
+    RUN_TEST(testSizeShareIsReported);
+    RUN_TEST(testFinestQualityOfAFilm);
+    return UNITY_END();
+}
@@ -0,0 +1,379 @@
+#include <unity.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include <ResourceArbiter.h>
+
+// Same pin sets as SystemConfig.h
+#define PINS_SCREEN_BUS (1u << 0)
+#define PINS_BATTERY    (1u << 1)
+#define PINS_ADC2       (1u << 2)
+#define SCREEN_PINS  PINS_SCREEN_BUS
+#define BATTERY_PINS (PINS_BATTERY | PINS_ADC2)
+#define SD_CARD_PINS (PINS_SCREEN_BUS | PINS_BATTERY)
+#define WIFI_PINS    PINS_ADC2
+
+#define PRIORITY_LOW 1
+#define PRIORITY_MEDIUM 2
+#define PRIORITY_HIGH 3
+
+static ResourceArbiter* arbiter;
+
+void setUp(void) {
+    arbiter = new ResourceArbiter();
+}
+
+void tearDown(void) {
+    delete arbiter;
+}
+
+void testDisjointSetsAreGrantedTogether() {
+    int screen = arbiter->request(SCREEN_PINS, PRIORITY_LOW);
+    int battery = arbiter->request(BATTERY_PINS, PRIORITY_LOW);
+    TEST_ASSERT_TRUE(arbiter->isGranted(screen));
+    TEST_ASSERT_TRUE(arbiter->isGranted(battery));
+    TEST_ASSERT_EQUAL_HEX32(SCREEN_PINS | BATTERY_PINS, arbiter->getHeldResources());
+}
+
+void testSetIsGrantedWholeOrNothing() {
+    int battery = arbiter->request(BATTERY_PINS, PRIORITY_LOW);
+    int sd = arbiter->request(SD_CARD_PINS, PRIORITY_HIGH);
+
+    // The free screen pins are not taken while the SD card waits for the battery pins
+    TEST_ASSERT_FALSE(arbiter->isGranted(sd));
+    TEST_ASSERT_EQUAL_HEX32(BATTERY_PINS, arbiter->getHeldResources());
+
+    uint32_t granted = arbiter->release(battery);
+    TEST_ASSERT_EQUAL_HEX32(1u << sd, granted);
+    TEST_ASSERT_TRUE(arbiter->isGranted(sd));
+}
+
+void testHigherPriorityWaiterGoesFirst() {
+    int holder = arbiter->request(SD_CARD_PINS, PRIORITY_LOW);
+    int low = arbiter->request(SCREEN_PINS, PRIORITY_LOW);
+    int high = arbiter->request(SD_CARD_PINS, PRIORITY_HIGH);
+
+    uint32_t granted = arbiter->release(holder);
+    TEST_ASSERT_EQUAL_HEX32(1u << high, granted);
+    TEST_ASSERT_FALSE(arbiter->isGranted(low));
+
+    granted = arbiter->release(high);
+    TEST_ASSERT_EQUAL_HEX32(1u << low, granted);
+}
+
+void testFifoInsidePriority() {
+    int holder = arbiter->request(SCREEN_PINS, PRIORITY_LOW);
+    int first = arbiter->request(SCREEN_PINS, PRIORITY_MEDIUM);
+    int second = arbiter->request(SCREEN_PINS, PRIORITY_MEDIUM);
+
+    TEST_ASSERT_EQUAL_HEX32(1u << first, arbiter->release(holder));
+    TEST_ASSERT_EQUAL_HEX32(1u << second, arbiter->release(first));
+}
+
+void testLowPriorityCannotBargeIn() {
+    int battery = arbiter->request(BATTERY_PINS, PRIORITY_LOW);
+    int sd = arbiter->request(SD_CARD_PINS, PRIORITY_HIGH);
+
+    // The screen pins are free but reserved by the waiting SD card
+    int screen = arbiter->request(SCREEN_PINS, PRIORITY_LOW);
+    TEST_ASSERT_FALSE(arbiter->isGranted(screen));
+
+    // A request outside the reservation only waits for the holder
+    int wifi = arbiter->request(WIFI_PINS, PRIORITY_LOW);
+    TEST_ASSERT_FALSE(arbiter->isGranted(wifi));
+    arbiter->release(battery);
+    TEST_ASSERT_TRUE(arbiter->isGranted(sd));
+    TEST_ASSERT_TRUE(arbiter->isGranted(wifi));
+    TEST_ASSERT_FALSE(arbiter->isGranted(screen));
+}
+
+void testHolderInheritsWaiterPriority() {
+    int battery = arbiter->request(BATTERY_PINS, PRIORITY_LOW);
+    int screen = arbiter->request(SCREEN_PINS, PRIORITY_LOW);
+    TEST_ASSERT_EQUAL_UINT8(PRIORITY_LOW, arbiter->effectivePriority(battery));
+
+    int sd = arbiter->request(SD_CARD_PINS, PRIORITY_HIGH);
+    TEST_ASSERT_EQUAL_UINT8(PRIORITY_HIGH, arbiter->effectivePriority(battery));
+    TEST_ASSERT_EQUAL_UINT8(PRIORITY_HIGH, arbiter->effectivePriority(screen));
+
+    // The boost ends with the wait
+    arbiter->cancel(sd);
+    TEST_ASSERT_EQUAL_UINT8(PRIORITY_LOW, arbiter->effectivePriority(battery));
+}
+
+void testCancelWithdrawsReservation() {
+    int battery = arbiter->request(BATTERY_PINS, PRIORITY_LOW);
+    int sd = arbiter->request(SD_CARD_PINS, PRIORITY_HIGH);
+    int screen = arbiter->request(SCREEN_PINS, PRIORITY_LOW);
+
+    // A timed out SD request must not leak the screen pins it reserved
+    uint32_t granted = arbiter->cancel(sd);
+    TEST_ASSERT_EQUAL_HEX32(1u << screen, granted);
+    TEST_ASSERT_TRUE(arbiter->isGranted(battery));
+    TEST_ASSERT_FALSE(arbiter->isGranted(sd));
+}
+
+void testInvalidRequests() {
+    TEST_ASSERT_EQUAL_INT(ARBITER_INVALID_TICKET, arbiter->request(0, PRIORITY_LOW));
+    for (int i = 0; i < ARBITER_MAX_CLIENTS; i++) {
+        TEST_ASSERT_NOT_EQUAL(ARBITER_INVALID_TICKET, arbiter->request(SCREEN_PINS, PRIORITY_LOW));
+    }
+    TEST_ASSERT_EQUAL_INT(ARBITER_INVALID_TICKET, arbiter->request(SCREEN_PINS, PRIORITY_LOW));
+    TEST_ASSERT_EQUAL_HEX32(0, arbiter->release(ARBITER_INVALID_TICKET));
+    TEST_ASSERT_EQUAL_HEX32(0, arbiter->release(1));  // Waiting, not granted
+}
+
+/**
+ * Blocking wrapper built like PinArbiter, with host threads instead of tasks.
+ */
+class HostPinArbiter {
+public:
+    int acquire(uint32_t resources, uint8_t priority, std::chrono::microseconds timeout) {
+        std::unique_lock<std::mutex> lock(mutex);
+        int ticket = arbiter.request(resources, priority);
+        if (ticket == ARBITER_INVALID_TICKET) {
+            return ARBITER_INVALID_TICKET;
+        }
+        if (!granted.wait_for(lock, timeout, [&] { return arbiter.isGranted(ticket); })) {
+            arbiter.cancel(ticket);
+            granted.notify_all();
+            return ARBITER_INVALID_TICKET;
+        }
+        return ticket;
+    }
+
+    void release(int ticket) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (arbiter.release(ticket) != 0) {
+            granted.notify_all();
+        }
+    }
+
+private:
+    ResourceArbiter arbiter;
+    std::mutex mutex;
+    std::condition_variable granted;
+};
+
+#define STRESS_THREADS 8
+#define STRESS_ITERATIONS 20000
+
+void testStressNoDeadlockAndMutualExclusion() {
+    static const uint32_t SETS[] = {SCREEN_PINS, BATTERY_PINS, SD_CARD_PINS, WIFI_PINS};
+    HostPinArbiter pins;
+    std::atomic<int> owners[3];
+    for (auto& owner : owners) {
+        owner = 0;
+    }
+    std::atomic<long> completed(0);
+    std::atomic<long> timeouts(0);
+    std::atomic<bool> overlap(false);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < STRESS_THREADS; t++) {
+        threads.emplace_back([&, t] {
+            std::mt19937 random(t);
+            for (int i = 0; i < STRESS_ITERATIONS; i++) {
+                uint32_t set = SETS[random() % 4];
+                uint8_t priority = 1 + random() % 3;
+                // Two seconds is far beyond any hold time here, a timeout means a deadlock
+                int ticket = pins.acquire(set, priority, std::chrono::milliseconds(2000));
+                if (ticket == ARBITER_INVALID_TICKET) {
+                    timeouts++;
+                    continue;
+                }
+                for (int r = 0; r < 3; r++) {
+                    if ((set & (1u << r)) && owners[r].fetch_add(1) != 0) {
+                        overlap = true;
+                    }
+                }
+                if (random() % 8 == 0) {
+                    std::this_thread::yield();
+                }
+                for (int r = 0; r < 3; r++) {
+                    if (set & (1u << r)) {
+                        owners[r].fetch_sub(1);
+                    }
+                }
+                pins.release(ticket);
+                completed++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    TEST_ASSERT_FALSE(overlap);
+    TEST_ASSERT_EQUAL(0, timeouts.load());
+    TEST_ASSERT_EQUAL(STRESS_THREADS * STRESS_ITERATIONS, completed.load());
+}
+
+void testStressWithTimeoutsLeaksNothing() {
+    HostPinArbiter pins;
+    std::atomic<bool> stop(false);
+
+    // Holders that keep the battery busy
+    std::thread holder([&] {
+        while (!stop) {
+            int ticket = pins.acquire(BATTERY_PINS, PRIORITY_LOW, std::chrono::milliseconds(1000));
+            if (ticket != ARBITER_INVALID_TICKET) {
+                std::this_thread::sleep_for(std::chrono::microseconds(300));
+                pins.release(ticket);
+            }
+        }
+    });
+
+    // SD requests that often give up, like initSdCard with its short timeout
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 500; i++) {
+                int ticket = pins.acquire(SD_CARD_PINS, PRIORITY_HIGH, std::chrono::microseconds(100 * (i % 3)));
+                if (ticket != ARBITER_INVALID_TICKET) {
+                    pins.release(ticket);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    stop = true;
+    holder.join();
+
+    // Every pin is free again: a screen request is granted at once
+    int screen = pins.acquire(SCREEN_PINS, PRIORITY_LOW, std::chrono::milliseconds(0));
+    TEST_ASSERT_NOT_EQUAL(ARBITER_INVALID_TICKET, screen);
+    int battery = pins.acquire(BATTERY_PINS, PRIORITY_LOW, std::chrono::milliseconds(0));
+    TEST_ASSERT_NOT_EQUAL(ARBITER_INVALID_TICKET, battery);
+}
+
+/**
+ * Single core scheduler simulation, one step per millisecond. The runnable task with the highest
+ * priority runs, the priority of a holder being its effective priority when inheritance is on.
+ */
+struct SimulatedTask {
+    uint32_t resources;    // Pins needed for the critical section, 0 for pure CPU work
+    uint8_t priority;
+    int releaseMs;         // Time the task becomes ready
+    int workMs;            // CPU time of the critical section
+    int ticket;
+    int doneMs;
+    int waitMs;            // Time between asking for the pins and getting them
+};
+
+static void simulate(SimulatedTask* tasks, int count, bool inheritance) {
+    ResourceArbiter simulated;
+    for (int i = 0; i < count; i++) {
+        tasks[i].ticket = ARBITER_INVALID_TICKET;
+        tasks[i].doneMs = -1;
+        tasks[i].waitMs = 0;
+    }
+    for (int now = 0; now < 10000; now++) {
+        // Ready tasks ask for their pins
+        for (int i = 0; i < count; i++) {
+            if (tasks[i].releaseMs == now && tasks[i].resources != 0) {
+                tasks[i].ticket = simulated.request(tasks[i].resources, tasks[i].priority);
+            }
+        }
+        // Pick the most urgent runnable task
+        int running = -1;
+        int runningPriority = -1;
+        for (int i = 0; i < count; i++) {
+            SimulatedTask& task = tasks[i];
+            if (task.releaseMs > now || task.doneMs >= 0) {
+                continue;
+            }
+            if (task.resources != 0 && !simulated.isGranted(task.ticket)) {
+                task.waitMs++;
+                continue;
+            }
+            int priority = task.priority;
+            if (inheritance && task.resources != 0) {
+                priority = simulated.effectivePriority(task.ticket);
+            }
+            if (priority > runningPriority) {
+                running = i;
+                runningPriority = priority;
+            }
+        }
+        if (running < 0) {
+            continue;
+        }
+        SimulatedTask& task = tasks[running];
+        if (--task.workMs == 0) {
+            task.doneMs = now + 1;
+            if (task.resources != 0) {
+                simulated.release(task.ticket);
+            }
+        }
+    }
+}
+
+void testInheritanceBoundsCaptureLatency() {
+    // A battery read holds its pins for 10 ms, a capture needs the SD card 2 ms later, then
+    // 100 ms of unrelated medium priority work (display refresh, metering) becomes ready
+    SimulatedTask withoutInheritance[] = {
+        {BATTERY_PINS, PRIORITY_LOW, 0, 10},
+        {SD_CARD_PINS, PRIORITY_HIGH, 2, 5},
+        {0, PRIORITY_MEDIUM, 3, 100},
+    };
+    SimulatedTask withInheritance[3];
+    for (int i = 0; i < 3; i++) {
+        withInheritance[i] = withoutInheritance[i];
+    }
+
+    simulate(withoutInheritance, 3, false);
+    simulate(withInheritance, 3, true);
+
+    // Without inheritance the capture waits for the medium work too: priority inversion
+    TEST_ASSERT_GREATER_THAN(100, withoutInheritance[1].waitMs);
+    // With it, the capture only waits for the rest of the battery read
+    TEST_ASSERT_LESS_OR_EQUAL(8, withInheritance[1].waitMs);
+}
+
+void testCaptureLatencyUnderContention() {
+    // Battery reads and screen refreshes arrive continuously, a capture every 97 ms
+    std::vector<SimulatedTask> tasks;
+    for (int t = 0; t < 2000; t += 7) {
+        tasks.push_back({BATTERY_PINS, PRIORITY_LOW, t, 3});
+        tasks.push_back({SCREEN_PINS, PRIORITY_MEDIUM, t + 3, 2});
+    }
+    int firstCapture = (int) tasks.size();
+    for (int t = 5; t < 2000; t += 97) {
+        tasks.push_back({SD_CARD_PINS, PRIORITY_HIGH, t, 4});
+    }
+    simulate(tasks.data(), (int) tasks.size(), true);
+
+    // A capture waits at most for the holders already running, never for queued work
+    int worstWaitMs = 0;
+    for (size_t i = firstCapture; i < tasks.size(); i++) {
+        TEST_ASSERT_TRUE(tasks[i].doneMs >= 0);
+        if (tasks[i].waitMs > worstWaitMs) {
+            worstWaitMs = tasks[i].waitMs;
+        }
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(5, worstWaitMs);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testDisjointSetsAreGrantedTogether);
+    RUN_TEST(testSetIsGrantedWholeOrNothing);
+    RUN_TEST(testHigherPriorityWaiterGoesFirst);
+    RUN_TEST(testFifoInsidePriority);
+    RUN_TEST(testLowPriorityCannotBargeIn);
+    RUN_TEST(testHolderInheritsWaiterPriority);
+    RUN_TEST(testCancelWithdrawsReservation);
+    RUN_TEST(testInvalidRequests);
+    RUN_TEST(testStressNoDeadlockAndMutualExclusion);
+    RUN_TEST(testStressWithTimeoutsLeaksNothing);
+    RUN_TEST(testInheritanceBoundsCaptureLatency);
+    RUN_TEST(testCaptureLatencyUnderContention);
+    return UNITY_END();
+}
@@ -0,0 +1,175 @@
+#include <string.h>
+#include <unity.h>
+#include <chrono>
+#include <vector>
+#include <SpriteBlitter.h>
+#include <UiSprites.h>
+
+#define SCREEN_WIDTH 128
+#define SCREEN_HEIGHT 64
+#define SCREEN_BYTES (SCREEN_WIDTH * SCREEN_HEIGHT / 8)
+
+static uint8_t screen[SCREEN_BYTES];
+static uint8_t expected[SCREEN_BYTES];
+
+void setUp(void) {
+    memset(screen, 0, sizeof(screen));
+    memset(expected, 0, sizeof(expected));
+}
+
+void tearDown(void) {}
+
+// Pages of a sprite decoded on their own, and the size of their coded data
+static std::vector<uint8_t> decodePages(int sprite, size_t* codedBytes) {
+    const Sprite& info = UI_SPRITES.sprites[sprite];
+    size_t total = (size_t) (info.height + 7) / 8 * info.width;
+    const uint8_t* data = UI_SPRITES.data + info.offset;
+    const uint8_t* start = data;
+    std::vector<uint8_t> pages;
+    while (pages.size() < total) {
+        uint8_t control = *data++;
+        if (control < SPRITE_RUN_FLAG) {
+            pages.insert(pages.end(), data, data + control + 1);
+            data += control + 1;
+        } else {
+            pages.insert(pages.end(), control - SPRITE_RUN_FLAG + SPRITE_MIN_RUN, *data++);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(total, pages.size());
+    *codedBytes = (size_t) (data - start);
+    return pages;
+}
+
+// The same sprite as an XBM, rows of bytes with the left pixel in bit 0
+static std::vector<uint8_t> toXbm(int sprite) {
+    const Sprite& info = UI_SPRITES.sprites[sprite];
+    size_t coded;
+    std::vector<uint8_t> pages = decodePages(sprite, &coded);
+    int rowBytes = (info.width + 7) / 8;
+    std::vector<uint8_t> xbm((size_t) rowBytes * info.height);
+    for (int y = 0; y < info.height; y++) {
+        for (int x = 0; x < info.width; x++) {
+            if (pages[(y / 8) * info.width + x] & (1 << (y & 7))) {
+                xbm[y * rowBytes + x / 8] |= (uint8_t) (1 << (x & 7));
+            }
+        }
+    }
+    return xbm;
+}
+
+// drawXbm() and setPixel() of the display driver, with the white color
+static void setPixel(uint8_t* buffer, int x, int y) {
+    if (x >= 0 && x < SCREEN_WIDTH && y >= 0 && y < SCREEN_HEIGHT) {
+        buffer[x + (y / 8) * SCREEN_WIDTH] |= (uint8_t) (1 << (y & 7));
+    }
+}
+
+static void drawXbm(uint8_t* buffer, int xMove, int yMove, int width, int height, const uint8_t* xbm) {
+    int widthInXbm = (width + 7) / 8;
+    uint8_t data = 0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (x & 7) {
+                data >>= 1;
+            } else {
+                data = xbm[(x / 8) + y * widthInXbm];
+            }
+            if (data & 0x01) {
+                setPixel(buffer, xMove + x, yMove + y);
+            }
+        }
+    }
+}
+
+void testMatchesDrawXbmAnywhere(void) {
+    SpriteBlitter blitter(screen, SCREEN_WIDTH, SCREEN_HEIGHT);
+    int positions[][2] = {{0, 0}, {5, 5}, {108, 5}, {10, 10}, {-7, -3}, {120, 60}, {-40, 0}, {0, -40}, {127, 63}, {3, 64}};
+    for (int sprite = 0; sprite < SPRITE_COUNT; sprite++) {
+        const Sprite& info = UI_SPRITES.sprites[sprite];
+        std::vector<uint8_t> xbm = toXbm(sprite);
+        for (auto& position : positions) {
+            // Over a busy background, only the lit pixels may change
+            for (int i = 0; i < SCREEN_BYTES; i++) {
+                screen[i] = expected[i] = (uint8_t) (i * 37);
+            }
+            blitter.draw(UI_SPRITES, sprite, position[0], position[1]);
+            drawXbm(expected, position[0], position[1], info.width, info.height, xbm.data());
+            TEST_ASSERT_EQUAL_MEMORY(expected, screen, SCREEN_BYTES);
+        }
+    }
+}
+
+void testClearAndInvertModes(void) {
+    SpriteBlitter blitter(screen, SCREEN_WIDTH, SCREEN_HEIGHT);
+    memset(screen, 0xFF, sizeof(screen));
+    blitter.draw(UI_SPRITES, SPRITE_BATTERY, 9, 13, SPRITE_BLIT_CLEAR);
+    // Cleared where a set draw lights up
+    memset(expected, 0, sizeof(expected));
+    SpriteBlitter(expected, SCREEN_WIDTH, SCREEN_HEIGHT).draw(UI_SPRITES, SPRITE_BATTERY, 9, 13);
+    for (int i = 0; i < SCREEN_BYTES; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t) ~expected[i], screen[i]);
+    }
+
+    // Inverting twice gives the screen back
+    for (int i = 0; i < SCREEN_BYTES; i++) {
+        screen[i] = expected[i] = (uint8_t) (i * 11);
+    }
+    blitter.draw(UI_SPRITES, SPRITE_HAPPY, 60, 21, SPRITE_BLIT_INVERT);
+    TEST_ASSERT_TRUE(memcmp(expected, screen, SCREEN_BYTES) != 0);
+    blitter.draw(UI_SPRITES, SPRITE_HAPPY, 60, 21, SPRITE_BLIT_INVERT);
+    TEST_ASSERT_EQUAL_MEMORY(expected, screen, SCREEN_BYTES);
+
+    // Unknown sprites draw nothing
+    blitter.draw(UI_SPRITES, SPRITE_COUNT, 0, 0);
+    blitter.draw(UI_SPRITES, -1, 0, 0);
+    TEST_ASSERT_EQUAL_MEMORY(expected, screen, SCREEN_BYTES);
+}
+
+void testFlashAndBlitTime(void) {
+    size_t atlasBytes = 0;
+    size_t xbmBytes = 0;
+    for (int sprite = 0; sprite < SPRITE_COUNT; sprite++) {
+        size_t coded;
+        decodePages(sprite, &coded);
+        atlasBytes += coded;
+        xbmBytes += toXbm(sprite).size();
+    }
+
+    // The icons of the home screen, as it is drawn
+    std::vector<uint8_t> battery = toXbm(SPRITE_BATTERY);
+    std::vector<uint8_t> flash = toXbm(SPRITE_FLASH_SMALL);
+    const Sprite& batteryInfo = UI_SPRITES.sprites[SPRITE_BATTERY];
+    const Sprite& flashInfo = UI_SPRITES.sprites[SPRITE_FLASH_SMALL];
+    int repeats = 200000;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        drawXbm(expected, 5, 5 + (r & 1), batteryInfo.width, batteryInfo.height, battery.data());
+        drawXbm(expected, 108, 5, flashInfo.width, flashInfo.height, flash.data());
+    }
+    double xbmNs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9 / repeats;
+    SpriteBlitter blitter(screen, SCREEN_WIDTH, SCREEN_HEIGHT);
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        blitter.draw(UI_SPRITES, SPRITE_BATTERY, 5, 5 + (r & 1));
+        blitter.draw(UI_SPRITES, SPRITE_FLASH_SMALL, 108, 5);
+    }
+    double atlasNs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9 / repeats;
+    TEST_ASSERT_EQUAL_MEMORY(expected, screen, SCREEN_BYTES);
+
+    char message[160];
+    snprintf(message, sizeof(message), "%d sprites: %u bytes of atlas, %u bytes of XBM, %u saved", SPRITE_COUNT,
+             (unsigned) atlasBytes, (unsigned) xbmBytes, (unsigned) (xbmBytes - atlasBytes));
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message), "Home screen icons: %.0f ns with the blitter, %.0f ns with drawXbm, %.1fx", atlasNs, xbmNs,
+             xbmNs / atlasNs);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(atlasBytes < xbmBytes);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testMatchesDrawXbmAnywhere);
+    RUN_TEST(testClearAndInvertModes);
+    RUN_TEST(testFlashAndBlitTime);
+    return UNITY_END();
+}
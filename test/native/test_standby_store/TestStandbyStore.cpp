@@ -0,0 +1,111 @@
+#include <string.h>
+#include <unity.h>
+#include <StandbyStore.h>
+
+static StandbyState memory;
+static StandbyStore* store;
+
+static StandbySettings makeSettings(uint16_t rollIndex, uint8_t flashOn) {
+    StandbySettings settings;
+    memset(&settings, 0, sizeof(settings));
+    settings.rollIndex = rollIndex;
+    settings.flashOn = flashOn;
+    settings.sensor.frameSize = 21;
+    settings.sensor.jpegQuality = 12;
+    settings.sensor.xclkMhz = 4;
+    return settings;
+}
+
+void setUp(void) {
+    // RTC memory holds garbage after a power loss
+    memset(&memory, 0xA5, sizeof(memory));
+    store = new StandbyStore(&memory);
+}
+
+void tearDown(void) {
+    delete store;
+}
+
+void testGarbageIsInvalid() {
+    StandbySettings settings = makeSettings(7, 1);
+    StandbySettings loaded = settings;
+    TEST_ASSERT_FALSE(store->isValid());
+    TEST_ASSERT_FALSE(store->load(&loaded));
+    TEST_ASSERT_EQUAL_UINT16(7, loaded.rollIndex);
+    TEST_ASSERT_EQUAL_UINT32(0, store->getStandbyCount());
+}
+
+void testSaveThenLoad() {
+    store->save(makeSettings(3, 1));
+
+    // A new store over the same memory, as after a wake
+    StandbyStore resumed(&memory);
+    StandbySettings loaded;
+    TEST_ASSERT_TRUE(resumed.load(&loaded));
+    TEST_ASSERT_EQUAL_UINT16(3, loaded.rollIndex);
+    TEST_ASSERT_EQUAL_UINT8(1, loaded.flashOn);
+    TEST_ASSERT_EQUAL_UINT8(21, loaded.sensor.frameSize);
+    TEST_ASSERT_EQUAL_UINT8(12, loaded.sensor.jpegQuality);
+    TEST_ASSERT_EQUAL_UINT8(4, loaded.sensor.xclkMhz);
+    TEST_ASSERT_EQUAL_UINT32(1, resumed.getStandbyCount());
+}
+
+void testCorruptionIsDetected() {
+    store->save(makeSettings(3, 0));
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(&memory);
+    for (size_t i = 0; i < offsetof(StandbyState, checksum); i++) {
+        for (int bit = 0; bit < 8; bit++) {
+            bytes[i] ^= (uint8_t) (1u << bit);
+            TEST_ASSERT_FALSE(store->isValid());
+            bytes[i] ^= (uint8_t) (1u << bit);
+        }
+    }
+    TEST_ASSERT_TRUE(store->isValid());
+}
+
+void testOlderLayoutIsRejected() {
+    store->save(makeSettings(3, 0));
+    memory.version = STANDBY_STATE_VERSION + 1;
+    memory.checksum = StandbyStore::crc32(&memory, offsetof(StandbyState, checksum));
+    TEST_ASSERT_FALSE(store->isValid());
+}
+
+void testInvalidate() {
+    store->save(makeSettings(3, 0));
+    store->invalidate();
+    StandbySettings loaded;
+    TEST_ASSERT_FALSE(store->load(&loaded));
+}
+
+void testWakeToCaptureStatisticsSurviveSaves() {
+    // Ignored before the first save
+    store->recordWakeToCapture(1000);
+    TEST_ASSERT_EQUAL_UINT32(0, store->getWakeToCaptureCount());
+
+    store->save(makeSettings(0, 0));
+    store->recordWakeToCapture(400000);
+    store->save(makeSettings(1, 0));
+    store->recordWakeToCapture(200000);
+
+    TEST_ASSERT_TRUE(store->isValid());
+    TEST_ASSERT_EQUAL_UINT32(2, store->getStandbyCount());
+    TEST_ASSERT_EQUAL_UINT32(2, store->getWakeToCaptureCount());
+    TEST_ASSERT_EQUAL_UINT32(300000, store->getAverageWakeToCaptureUs());
+    TEST_ASSERT_EQUAL_UINT32(400000, store->getMaxWakeToCaptureUs());
+}
+
+void testCrc32KnownValue() {
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926u, StandbyStore::crc32("123456789", 9));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testGarbageIsInvalid);
+    RUN_TEST(testSaveThenLoad);
+    RUN_TEST(testCorruptionIsDetected);
+    RUN_TEST(testOlderLayoutIsRejected);
+    RUN_TEST(testInvalidate);
+    RUN_TEST(testWakeToCaptureStatisticsSurviveSaves);
+    RUN_TEST(testCrc32KnownValue);
+    return UNITY_END();
+}
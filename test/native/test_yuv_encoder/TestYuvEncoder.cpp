@@ -0,0 +1,232 @@
+#include <unity.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <JpegDecoder.h>
+#include <YuvEncoder.h>
+#include "../JpegTestSupport.h"
+
+#define FRAME_WIDTH 200
+#define FRAME_HEIGHT 60
+#define BENCH_WIDTH 1280
+#define BENCH_HEIGHT 1024
+#define ARENA_BYTES (1024 * 1024)
+
+JPEG_TEST_ARENA(ARENA_BYTES)
+
+// Smooth gradients with a soft texture, as the sensor gives them in YUYV
+static std::vector<uint8_t> makeFrame(int width, int height) {
+    std::vector<uint8_t> yuyv((size_t) width * height * 2);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x += 2) {
+            uint8_t* pair = &yuyv[((size_t) y * width + x) * 2];
+            for (int i = 0; i < 2; i++) {
+                double luma = 40 + 150.0 * (x + i) / width + 25 * sin((x + i) * 0.3) * cos(y * 0.2);
+                pair[2 * i] = (uint8_t) (luma < 0 ? 0 : (luma > 255 ? 255 : luma));
+            }
+            pair[1] = (uint8_t) (90 + 70.0 * y / height);
+            pair[3] = (uint8_t) (170 - 60.0 * x / width);
+        }
+    }
+    return yuyv;
+}
+
+// Decode a JPEG to interleaved YCbCr
+static int decodeAll(const std::vector<uint8_t>& jpeg, std::vector<uint8_t>* ycc, int* width, int* height) {
+    size_t mark = arena->getMark();
+    JpegDecoder decoder;
+    int result = decoder.begin(jpeg.data(), jpeg.size(), arena);
+    if (result != JPEG_OK) {
+        return result;
+    }
+    *width = decoder.getWidth();
+    *height = decoder.getHeight();
+    size_t rowBytes = (size_t) *width * JPEG_YCC_BYTES;
+    ycc->assign(rowBytes * decoder.getStripCount() * decoder.getStripHeight(), 0);
+    for (int strip = 0; strip < decoder.getStripCount() && result == JPEG_OK; strip++) {
+        result = decoder.decodeStrip(&(*ycc)[rowBytes * strip * decoder.getStripHeight()], rowBytes);
+    }
+    arena->release(mark);
+    return result;
+}
+
+// PSNR of one component of the decoded frame against the YUYV source
+static double componentPsnr(const std::vector<uint8_t>& yuyv, const std::vector<uint8_t>& ycc, int width, int height,
+                            int component) {
+    double error = 0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const uint8_t* pair = &yuyv[((size_t) y * width + (x & ~1)) * 2];
+            int expected = component == 0 ? pair[(x & 1) * 2] : pair[component == 1 ? 1 : 3];
+            double difference = expected - ycc[((size_t) y * width + x) * JPEG_YCC_BYTES + component];
+            error += difference * difference;
+        }
+    }
+    error /= (double) width * height;
+    return 10 * log10(255.0 * 255.0 / (error > 1e-9 ? error : 1e-9));
+}
+
+void testDecodesToTheSource() {
+    std::vector<uint8_t> yuyv = makeFrame(FRAME_WIDTH, FRAME_HEIGHT);
+    YuvEncoder encoder(arena);
+    std::vector<uint8_t> jpeg;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, encoder.write(yuyv.data(), FRAME_WIDTH, FRAME_HEIGHT, 90, nullptr, writeToVector, &jpeg));
+    TEST_ASSERT_EQUAL_UINT32(jpeg.size(), encoder.getBytesWritten());
+    TEST_ASSERT_EQUAL_UINT32(0, arena->getUsed());
+
+    std::vector<uint8_t> ycc;
+    int width = 0;
+    int height = 0;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, decodeAll(jpeg, &ycc, &width, &height));
+    TEST_ASSERT_EQUAL_INT(FRAME_WIDTH, width);
+    TEST_ASSERT_EQUAL_INT(FRAME_HEIGHT, height);
+    double luma = componentPsnr(yuyv, ycc, width, height, 0);
+    double blue = componentPsnr(yuyv, ycc, width, height, 1);
+    double red = componentPsnr(yuyv, ycc, width, height, 2);
+    char message[96];
+    snprintf(message, sizeof(message), "PSNR at quality 90: %.1f dB luma, %.1f dB Cb, %.1f dB Cr", luma, blue, red);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_GREATER_THAN(38, (int) luma);
+    TEST_ASSERT_GREATER_THAN(38, (int) blue);
+    TEST_ASSERT_GREATER_THAN(38, (int) red);
+}
+
+void testOneRestartIntervalPerRow() {
+    std::vector<uint8_t> yuyv = makeFrame(FRAME_WIDTH, FRAME_HEIGHT);
+    YuvEncoder encoder(arena);
+    std::vector<uint8_t> jpeg;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, encoder.write(yuyv.data(), FRAME_WIDTH, FRAME_HEIGHT, 75, nullptr, writeToVector, &jpeg));
+
+    size_t mark = arena->getMark();
+    JpegDecoder decoder;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, decoder.begin(jpeg.data(), jpeg.size(), arena));
+    TEST_ASSERT_EQUAL_INT(JPEG_SUBSAMPLING_422, decoder.getSubsampling());
+    TEST_ASSERT_EQUAL_INT(decoder.getMcusPerStrip(), decoder.getRestartInterval());
+    arena->release(mark);
+
+    // Markers between the rows only, numbered in turn
+    int markers = 0;
+    for (size_t i = decoder.getScanStart(); i + 1 < jpeg.size(); i++) {
+        if (jpeg[i] == 0xFF && jpeg[i + 1] >= 0xD0 && jpeg[i + 1] <= 0xD7) {
+            TEST_ASSERT_EQUAL_INT(0xD0 + (markers & 7), jpeg[i + 1]);
+            markers++;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT((FRAME_HEIGHT + 7) / 8 - 1, markers);
+}
+
+void testLanesMatchSerial() {
+    std::vector<uint8_t> yuyv = makeFrame(FRAME_WIDTH, FRAME_HEIGHT);
+    YuvEncoder encoder(arena);
+    SerialStripRunner serial;
+    ThreadStripRunner threaded;
+    std::vector<uint8_t> serialJpeg;
+    std::vector<uint8_t> threadedJpeg;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, encoder.write(yuyv.data(), FRAME_WIDTH, FRAME_HEIGHT, 90, nullptr, writeToVector, &serialJpeg, &serial));
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, encoder.write(yuyv.data(), FRAME_WIDTH, FRAME_HEIGHT, 90, nullptr, writeToVector, &threadedJpeg,
+                                                 &threaded));
+    TEST_ASSERT_EQUAL_UINT32(serialJpeg.size(), threadedJpeg.size());
+    TEST_ASSERT_EQUAL_MEMORY(serialJpeg.data(), threadedJpeg.data(), serialJpeg.size());
+}
+
+void testFilmProcessCurves() {
+    FilmProcess process;
+    TEST_ASSERT_TRUE(process.isNeutral());
+    uint8_t pixels[4 * JPEG_YCC_BYTES] = {30, 100, 160, 128, 128, 128, 220, 60, 200, 255, 255, 0};
+    uint8_t original[sizeof(pixels)];
+    memcpy(original, pixels, sizeof(pixels));
+    process.processStrip(pixels, sizeof(pixels), 4, 1);
+    TEST_ASSERT_EQUAL_MEMORY(original, pixels, sizeof(pixels));
+
+    // Contrast pushes the tones away from the middle, saturation pulls the chroma to neutral
+    FilmLook look = {60, 50};
+    process.setLook(look);
+    TEST_ASSERT_FALSE(process.isNeutral());
+    process.processStrip(pixels, sizeof(pixels), 4, 1);
+    TEST_ASSERT_LESS_THAN(30, pixels[0]);
+    TEST_ASSERT_INT_WITHIN(1, 128, pixels[3]);
+    TEST_ASSERT_GREATER_THAN(220, pixels[6]);
+    TEST_ASSERT_EQUAL_UINT8(255, pixels[9]);
+    TEST_ASSERT_EQUAL_UINT8(114, pixels[1]);
+    TEST_ASSERT_EQUAL_UINT8(144, pixels[2]);
+    TEST_ASSERT_EQUAL_UINT8(128, pixels[4]);
+    TEST_ASSERT_EQUAL_UINT8(64, pixels[11]);
+
+    // The encoder runs the stage: no saturation gives a grey frame
+    FilmLook grey = {0, 0};
+    process.setLook(grey);
+    std::vector<uint8_t> yuyv = makeFrame(FRAME_WIDTH, FRAME_HEIGHT);
+    YuvEncoder encoder(arena);
+    std::vector<uint8_t> jpeg;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, encoder.write(yuyv.data(), FRAME_WIDTH, FRAME_HEIGHT, 90, &process, writeToVector, &jpeg));
+    std::vector<uint8_t> ycc;
+    int width = 0;
+    int height = 0;
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, decodeAll(jpeg, &ycc, &width, &height));
+    for (int i = 0; i < width * height; i += 37) {
+        TEST_ASSERT_INT_WITHIN(1, 128, ycc[(size_t) i * JPEG_YCC_BYTES + 1]);
+        TEST_ASSERT_INT_WITHIN(1, 128, ycc[(size_t) i * JPEG_YCC_BYTES + 2]);
+    }
+}
+
+void testRejectsOddWidthAndSmallArena() {
+    std::vector<uint8_t> yuyv = makeFrame(FRAME_WIDTH, FRAME_HEIGHT);
+    YuvEncoder encoder(arena);
+    std::vector<uint8_t> jpeg;
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_UNSUPPORTED, encoder.write(yuyv.data(), FRAME_WIDTH - 1, FRAME_HEIGHT, 90, nullptr, writeToVector, &jpeg));
+    TEST_ASSERT_EQUAL_UINT32(0, jpeg.size());
+
+    // The bound is enough and nothing is left allocated after a failure
+    size_t bytes = YuvEncoder::requiredBytes(FRAME_WIDTH);
+    ImageArena exact(arenaBuffer, bytes);
+    YuvEncoder fitting(&exact);
+    TEST_ASSERT_EQUAL_INT(JPEG_OK, fitting.write(yuyv.data(), FRAME_WIDTH, FRAME_HEIGHT, 90, nullptr, writeToVector, &jpeg));
+    ImageArena small(arenaBuffer, bytes / 2);
+    YuvEncoder starved(&small);
+    TEST_ASSERT_EQUAL_INT(JPEG_ERROR_MEMORY, starved.write(yuyv.data(), FRAME_WIDTH, FRAME_HEIGHT, 90, nullptr, writeToVector, &jpeg));
+    TEST_ASSERT_EQUAL_UINT32(0, small.getUsed());
+}
+
+static double encodeSeconds(const std::vector<uint8_t>& yuyv, StripRunner* runner, const FilmProcess* process, size_t* size) {
+    YuvEncoder encoder(arena);
+    std::vector<uint8_t> jpeg;
+    jpeg.reserve(yuyv.size());
+    const int repeats = 5;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; i++) {
+        jpeg.clear();
+        TEST_ASSERT_EQUAL_INT(JPEG_OK, encoder.write(yuyv.data(), BENCH_WIDTH, BENCH_HEIGHT, 90, process, writeToVector, &jpeg, runner));
+    }
+    *size = jpeg.size();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / repeats;
+}
+
+void testThroughput() {
+    std::vector<uint8_t> yuyv = makeFrame(BENCH_WIDTH, BENCH_HEIGHT);
+    SerialStripRunner serial;
+    ThreadStripRunner threaded;
+    FilmProcess process;
+    FilmLook look = {30, 90};
+    process.setLook(look);
+    size_t size = 0;
+    double serialSeconds = encodeSeconds(yuyv, &serial, &process, &size);
+    double threadedSeconds = encodeSeconds(yuyv, &threaded, &process, &size);
+    double megapixels = (double) BENCH_WIDTH * BENCH_HEIGHT / 1e6;
+    char message[128];
+    snprintf(message, sizeof(message), "%dx%d YUV422 to JPEG: %.1f MP/s serial, %.1f MP/s on %d lanes, %u KB", BENCH_WIDTH,
+             BENCH_HEIGHT, megapixels / serialSeconds, megapixels / threadedSeconds, STRIP_LANES, (unsigned) (size / 1024));
+    TEST_MESSAGE(message);
+    TEST_ASSERT_GREATER_THAN(0, (int) size);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testDecodesToTheSource);
+    RUN_TEST(testOneRestartIntervalPerRow);
+    RUN_TEST(testLanesMatchSerial);
+    RUN_TEST(testFilmProcessCurves);
+    RUN_TEST(testRejectsOddWidthAndSmallArena);
+    RUN_TEST(testThroughput);
+    return UNITY_END();
+}
@@ -0,0 +1,85 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "MappedFile.h"
+
+MappedFile::MappedFile() : descriptor(-1), data(nullptr), size(0), writable(false) {}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr) {
+        munmap(data, size);
+    }
+    if (descriptor >= 0) {
+        ::close(descriptor);
+    }
+}
+
+bool MappedFile::openRead(const char* path) {
+    close();
+    descriptor = open(path, O_RDONLY);
+    struct stat info;
+    if (descriptor < 0 || fstat(descriptor, &info) != 0 || !S_ISREG(info.st_mode)) {
+        close();
+        return false;
+    }
+    size = (size_t) info.st_size;
+    if (size == 0) {
+        return true;
+    }
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (mapping == MAP_FAILED) {
+        close();
+        return false;
+    }
+
+    // Frames are read front to back once, the kernel reads ahead and drops them behind
+    data = static_cast<uint8_t*>(mapping);
+    madvise(data, size, MADV_SEQUENTIAL);
+    return true;
+}
+
+bool MappedFile::create(const char* path, size_t capacity) {
+    close();
+    descriptor = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (descriptor < 0 || capacity == 0 || ftruncate(descriptor, (off_t) capacity) != 0) {
+        close();
+        return false;
+    }
+    void* mapping = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    if (mapping == MAP_FAILED) {
+        close();
+        return false;
+    }
+    data = static_cast<uint8_t*>(mapping);
+    size = capacity;
+    writable = true;
+    return true;
+}
+
+bool MappedFile::close(size_t length) {
+    bool closed = true;
+    if (data != nullptr) {
+        closed = munmap(data, size) == 0;
+    }
+    if (descriptor >= 0) {
+        if (writable) {
+            closed = ftruncate(descriptor, (off_t) length) == 0 && closed;
+        }
+        closed = ::close(descriptor) == 0 && closed;
+    }
+    descriptor = -1;
+    data = nullptr;
+    size = 0;
+    writable = false;
+    return closed;
+}
+
+uint8_t* MappedFile::getData() const {
+    return data;
+}
+
+size_t MappedFile::getSize() const {
+    return size;
+}
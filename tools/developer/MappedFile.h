@@ -0,0 +1,82 @@
+#ifndef RETROLENS_MAPPED_FILE_H
+#define RETROLENS_MAPPED_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @class MappedFile
+ * @brief A file mapped into memory, read in place or written in place.
+ *
+ * Frames are developed straight from the page cache and into the output file, without a copy
+ * through a read or write buffer. A created file is mapped at a capacity larger than it can
+ * get and cut to its real size on close(), the pages never written are never allocated.
+ *
+ * Example usage:
+ * @code
+ * MappedFile in;
+ * MappedFile out;
+ * if (in.openRead("roll/0001.jpg") && out.create("out/0001.jpg", 2 * in.getSize())) {
+ *     memcpy(out.getData(), in.getData(), in.getSize());
+ *     out.close(in.getSize());
+ * }
+ * @endcode
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Constructor for MappedFile, without a file.
+     */
+    MappedFile();
+
+    /**
+     * @brief Destructor, unmaps the file as it is.
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Map a file to read it.
+     *
+     * @param path Path of the file.
+     * @return true if the file is mapped, an empty file too.
+     */
+    bool openRead(const char* path);
+
+    /**
+     * @brief Create a file, or empty it, and map it to write it.
+     *
+     * @param path Path of the file.
+     * @param capacity Largest size the file may get.
+     * @return true if the file is mapped.
+     */
+    bool create(const char* path, size_t capacity);
+
+    /**
+     * @brief Unmap the file, cutting a created file to its size.
+     *
+     * @param length Size of a created file, ignored for a file opened to read.
+     * @return true if the file was cut and closed.
+     */
+    bool close(size_t length = 0);
+
+    /**
+     * @brief Get the mapped bytes, nullptr if nothing is mapped.
+     */
+    uint8_t* getData() const;
+
+    /**
+     * @brief Get the size of a file opened to read, or the capacity of a created one.
+     */
+    size_t getSize() const;
+
+private:
+    int descriptor;  ///< File descriptor, -1 if none.
+    uint8_t* data;   ///< Start of the mapping, nullptr if none.
+    size_t size;     ///< Bytes mapped.
+    bool writable;   ///< True for a created file.
+};
+
+#endif // RETROLENS_MAPPED_FILE_H
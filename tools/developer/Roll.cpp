@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <ctype.h>
+#include <dirent.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "Roll.h"
+
+// Fields of a ustar header
+#define TAR_NAME_OFFSET 0
+#define TAR_NAME_BYTES 100
+#define TAR_SIZE_OFFSET 124
+#define TAR_SIZE_BYTES 12
+#define TAR_TYPE_OFFSET 156
+
+static std::string baseName(const std::string& path) {
+    std::string trimmed = path;
+    while (trimmed.size() > 1 && trimmed.back() == '/') {
+        trimmed.pop_back();
+    }
+    size_t slash = trimmed.find_last_of('/');
+    return slash == std::string::npos ? trimmed : trimmed.substr(slash + 1);
+}
+
+static std::string field(const uint8_t* header, size_t offset, size_t bytes) {
+    const char* text = reinterpret_cast<const char*>(header + offset);
+    return std::string(text, strnlen(text, bytes));
+}
+
+bool RollSet::isJpegName(const std::string& name) {
+    size_t dot = name.find_last_of('.');
+    if (dot == std::string::npos || name[0] == '.') {
+        return false;
+    }
+    std::string extension = name.substr(dot + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    return extension == "jpg" || extension == "jpeg";
+}
+
+int RollSet::add(const std::string& path) {
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) {
+        return -1;
+    }
+    std::string roll = baseName(path);
+    if (S_ISDIR(info.st_mode)) {
+        return addFolder(path, roll);
+    }
+    size_t dot = roll.find_last_of('.');
+    if (dot != std::string::npos && dot > 0) {
+        roll = roll.substr(0, dot);
+    }
+    return addContainer(path, roll);
+}
+
+int RollSet::addFolder(const std::string& path, const std::string& roll) {
+    DIR* folder = opendir(path.c_str());
+    if (folder == nullptr) {
+        return -1;
+    }
+    std::vector<std::string> names;
+    while (struct dirent* entry = readdir(folder)) {
+        if (isJpegName(entry->d_name)) {
+            names.push_back(entry->d_name);
+        }
+    }
+    closedir(folder);
+
+    size_t first = frames.size();
+    for (const std::string& name : names) {
+        std::unique_ptr<MappedFile> file(new MappedFile());
+        if (!file->openRead((path + "/" + name).c_str()) || file->getSize() == 0) {
+            continue;
+        }
+        frames.push_back(RollFrame{roll, name, file->getData(), file->getSize(), 0});
+        files.push_back(std::move(file));
+    }
+    numberRoll(first);
+    return (int) (frames.size() - first);
+}
+
+int RollSet::addContainer(const std::string& path, const std::string& roll) {
+    std::unique_ptr<MappedFile> file(new MappedFile());
+    if (!file->openRead(path.c_str())) {
+        return -1;
+    }
+    const uint8_t* data = file->getData();
+    size_t size = file->getSize();
+    size_t first = frames.size();
+    size_t offset = 0;
+    while (offset + TAR_BLOCK_BYTES <= size) {
+        const uint8_t* header = data + offset;
+        if (header[TAR_NAME_OFFSET] == 0) {
+            // Two zero blocks end the archive
+            break;
+        }
+        size_t length = (size_t) strtoull(field(header, TAR_SIZE_OFFSET, TAR_SIZE_BYTES).c_str(), nullptr, 8);
+        offset += TAR_BLOCK_BYTES;
+        if (offset + length > size) {
+            // A container cut short, none of its frames are kept
+            frames.resize(first);
+            return -1;
+        }
+
+        // Regular files only, their folders in the container are flattened
+        char type = (char) header[TAR_TYPE_OFFSET];
+        std::string name = baseName(field(header, TAR_NAME_OFFSET, TAR_NAME_BYTES));
+        if ((type == '0' || type == '\0') && length > 0 && isJpegName(name)) {
+            frames.push_back(RollFrame{roll, name, data + offset, length, 0});
+        }
+        offset += (length + TAR_BLOCK_BYTES - 1) / TAR_BLOCK_BYTES * TAR_BLOCK_BYTES;
+    }
+    files.push_back(std::move(file));
+    numberRoll(first);
+    return (int) (frames.size() - first);
+}
+
+void RollSet::numberRoll(size_t first) {
+    std::sort(frames.begin() + first, frames.end(),
+              [](const RollFrame& a, const RollFrame& b) { return a.name < b.name; });
+    for (size_t i = first; i < frames.size(); i++) {
+        frames[i].number = (int) (i - first + 1);
+    }
+}
+
+const std::vector<RollFrame>& RollSet::getFrames() const {
+    return frames;
+}
+
+std::vector<std::string> RollSet::getRolls() const {
+    std::vector<std::string> rolls;
+    for (const RollFrame& frame : frames) {
+        if (std::find(rolls.begin(), rolls.end(), frame.roll) == rolls.end()) {
+            rolls.push_back(frame.roll);
+        }
+    }
+    return rolls;
+}
@@ -0,0 +1,90 @@
+#ifndef RETROLENS_ROLL_H
+#define RETROLENS_ROLL_H
+
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "MappedFile.h"
+
+// Block of a tar container, headers and file data are padded to it
+#define TAR_BLOCK_BYTES 512
+
+/**
+ * @struct RollFrame
+ * @brief A frame of a roll, read in place from its mapping.
+ */
+struct RollFrame {
+    std::string roll;    ///< Name of the roll, the folder or container without its extension.
+    std::string name;    ///< File name of the frame.
+    const uint8_t* data; ///< JPEG file, in the mapping of its file or container.
+    size_t length;       ///< Size of the file.
+    int number;          ///< Number of the frame on the roll, from 1, in the order of the names.
+};
+
+/**
+ * @class RollSet
+ * @brief The frames of roll folders and tar containers, mapped into memory.
+ *
+ * A roll folder is a folder of JPEG files, as copied off the card. A container is an
+ * uncompressed tar of them; its frames are read in place from the one mapping of the
+ * container. Frames are numbered in the order of their names, the way the camera names them.
+ *
+ * Example usage:
+ * @code
+ * RollSet rolls;
+ * rolls.add("DCIM/roll_0003");
+ * rolls.add("roll_0004.tar");
+ * for (const RollFrame& frame : rolls.getFrames()) {
+ *     // frame.data, frame.length
+ * }
+ * @endcode
+ */
+class RollSet {
+public:
+    /**
+     * @brief Add the frames of a roll folder or a tar container.
+     *
+     * @param path Path of the folder or the container.
+     * @return int Number of frames added, or -1 if the path cannot be read.
+     */
+    int add(const std::string& path);
+
+    /**
+     * @brief Get the frames of every roll added.
+     */
+    const std::vector<RollFrame>& getFrames() const;
+
+    /**
+     * @brief Get the names of the rolls added.
+     */
+    std::vector<std::string> getRolls() const;
+
+    /**
+     * @brief Check if a file name is the name of a JPEG file.
+     */
+    static bool isJpegName(const std::string& name);
+
+private:
+    /**
+     * @brief Add the JPEG files of a folder, each mapped on its own.
+     */
+    int addFolder(const std::string& path, const std::string& roll);
+
+    /**
+     * @brief Add the JPEG files of a mapped tar container.
+     */
+    int addContainer(const std::string& path, const std::string& roll);
+
+    /**
+     * @brief Number the frames of the last roll added, in the order of their names.
+     */
+    void numberRoll(size_t first);
+
+    std::vector<std::unique_ptr<MappedFile>> files; ///< Mappings the frames are read from.
+    std::vector<RollFrame> frames;                  ///< Frames of every roll.
+};
+
+#endif // RETROLENS_ROLL_H
@@ -0,0 +1,102 @@
+#include "WorkStealingPool.h"
+
+WorkStealingPool::WorkStealingPool(int threads) : queued(0), unfinished(0), stolen(0), nextQueue(0), stopping(false) {
+    if (threads < 1) {
+        threads = 1;
+    }
+    for (int i = 0; i < threads; i++) {
+        queues.emplace_back(new WorkerQueue());
+    }
+    for (int i = 0; i < threads; i++) {
+        this->threads.emplace_back(&WorkStealingPool::run, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    wait();
+    {
+        std::lock_guard<std::mutex> guard(idleLock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void WorkStealingPool::submit(PoolJob job) {
+    unfinished++;
+    WorkerQueue& queue = *queues[nextQueue];
+    nextQueue = (nextQueue + 1) % queues.size();
+    {
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.jobs.push_back(std::move(job));
+    }
+
+    // Counted under the idle lock, so a worker that found every queue empty cannot miss the wake
+    {
+        std::lock_guard<std::mutex> guard(idleLock);
+        queued++;
+    }
+    wake.notify_one();
+}
+
+void WorkStealingPool::wait() {
+    std::unique_lock<std::mutex> guard(idleLock);
+    idle.wait(guard, [this] { return unfinished == 0; });
+}
+
+int WorkStealingPool::getThreadCount() const {
+    return (int) threads.size();
+}
+
+uint64_t WorkStealingPool::getStolenCount() const {
+    return stolen;
+}
+
+bool WorkStealingPool::take(int worker, PoolJob* job) {
+    {
+        WorkerQueue& own = *queues[worker];
+        std::lock_guard<std::mutex> guard(own.lock);
+        if (!own.jobs.empty()) {
+            *job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            queued--;
+            return true;
+        }
+    }
+
+    // The oldest job of the next queue that has one, the one its owner would reach last
+    int count = (int) queues.size();
+    for (int i = 1; i < count; i++) {
+        WorkerQueue& other = *queues[(worker + i) % count];
+        std::lock_guard<std::mutex> guard(other.lock);
+        if (!other.jobs.empty()) {
+            *job = std::move(other.jobs.front());
+            other.jobs.pop_front();
+            queued--;
+            stolen++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::run(int worker) {
+    while (true) {
+        PoolJob job;
+        if (take(worker, &job)) {
+            job(worker);
+            if (--unfinished == 0) {
+                std::lock_guard<std::mutex> guard(idleLock);
+                idle.notify_all();
+            }
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(idleLock);
+        wake.wait(guard, [this] { return queued > 0 || stopping; });
+        if (stopping && queued == 0) {
+            return;
+        }
+    }
+}
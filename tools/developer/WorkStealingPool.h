@@ -0,0 +1,108 @@
+#ifndef RETROLENS_WORK_STEALING_POOL_H
+#define RETROLENS_WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief A job of the pool.
+ *
+ * @param worker Index of the worker thread running it, for the state kept per worker.
+ */
+typedef std::function<void(int worker)> PoolJob;
+
+/**
+ * @class WorkStealingPool
+ * @brief Thread pool where each worker has a queue of its own and takes from the others when it runs dry.
+ *
+ * Jobs are dealt to the queues in turn. A worker runs the newest job of its queue, and once it
+ * is empty steals the oldest job of another queue, so a roll of large frames on one worker is
+ * shared out instead of finishing last. Each queue has a lock of its own, the workers only meet
+ * on a lock when one steals.
+ *
+ * Example usage:
+ * @code
+ * WorkStealingPool pool(4);
+ * for (const RollFrame& frame : frames) {
+ *     pool.submit([&frame](int worker) { developFrame(frame, worker); });
+ * }
+ * pool.wait();
+ * @endcode
+ */
+class WorkStealingPool {
+public:
+    /**
+     * @brief Constructor for WorkStealingPool, starts the workers.
+     *
+     * @param threads Number of worker threads, at least 1.
+     */
+    explicit WorkStealingPool(int threads);
+
+    /**
+     * @brief Destructor, runs the jobs left and stops the workers.
+     */
+    ~WorkStealingPool();
+
+    /**
+     * @brief Queue a job.
+     */
+    void submit(PoolJob job);
+
+    /**
+     * @brief Wait until every queued job has run.
+     */
+    void wait();
+
+    /**
+     * @brief Get the number of worker threads.
+     */
+    int getThreadCount() const;
+
+    /**
+     * @brief Get the number of jobs a worker took from another queue.
+     */
+    uint64_t getStolenCount() const;
+
+private:
+    /**
+     * @struct WorkerQueue
+     * @brief Jobs dealt to one worker.
+     */
+    struct WorkerQueue {
+        std::mutex lock;         ///< Guards the jobs.
+        std::deque<PoolJob> jobs; ///< The newest at the back.
+    };
+
+    /**
+     * @brief Take the newest job of a queue, or the oldest of another one.
+     *
+     * @param worker Index of the worker.
+     * @param job Taken job.
+     * @return true if a job was taken.
+     */
+    bool take(int worker, PoolJob* job);
+
+    /**
+     * @brief Loop of a worker thread.
+     */
+    void run(int worker);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues; ///< One queue per worker.
+    std::vector<std::thread> threads;                 ///< Worker threads.
+    std::mutex idleLock;                              ///< Guards the sleep and wake of the workers.
+    std::condition_variable wake;                     ///< Signals a new job or the stop.
+    std::condition_variable idle;                     ///< Signals that no job is left.
+    std::atomic<int> queued;                          ///< Jobs waiting in the queues.
+    std::atomic<int> unfinished;                      ///< Jobs queued or running.
+    std::atomic<uint64_t> stolen;                     ///< Jobs taken from another queue.
+    size_t nextQueue;                                 ///< Queue of the next submitted job.
+    bool stopping;                                    ///< Set by the destructor.
+};
+
+#endif // RETROLENS_WORK_STEALING_POOL_H
@@ -0,0 +1,487 @@
+#include <atomic>
+#include <chrono>
+#include <errno.h>
+#include <math.h>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <vector>
+
+#include "BorderTiles.h"
+#include "Films.h"
+#include "FrameDeveloper.h"
+#include "GrainTiles.h"
+#include "MappedFile.h"
+#include "Roll.h"
+#include "StandbyStore.h"
+#include "WorkStealingPool.h"
+
+// Arena of each worker, larger than the camera gives a frame so no stage is left out for memory
+#define DEVELOPER_ARENA_KB (16 * 1024)
+
+// Room of a developed frame over the frame as shot, the border and the grain add bytes
+#define DEVELOPER_OUTPUT_FACTOR 4
+#define DEVELOPER_OUTPUT_SLACK (1024 * 1024)
+
+// Frames of the benchmark, a busy scene at the size of the camera frames
+#define BENCH_WIDTH 2592
+#define BENCH_HEIGHT 1944
+#define BENCH_QUALITY 90
+
+// Tiles of the film border, the ones built into the firmware
+static const BorderArt FILM_BORDER_ART = {&REBATE_BORDER_TILE, &SPROCKET_BORDER_TILE, &FONT_BORDER_TILE, FONT_BORDER_CHARACTERS};
+
+/**
+ * @struct Options
+ * @brief Command line of the developer.
+ */
+struct Options {
+    std::vector<std::string> inputs; ///< Roll folders and containers.
+    std::string output;              ///< Folder the developed rolls go to.
+    int threads = 0;                 ///< Worker threads, 0 for one per core.
+    int rotation = JPEG_ROTATE_0;    ///< One of the JPEG_ROTATE_* values.
+    int crop = JPEG_CROP_FULL;       ///< One of the JPEG_CROP_* values.
+    std::string dateText;            ///< Date stamp text, empty for no stamp.
+    bool border = false;             ///< True to add the film border.
+    bool look = false;               ///< True to apply the film look.
+    bool grain = true;               ///< True to add the grain of the film look.
+    std::string film;                ///< Film stock, empty for the first one.
+    std::string stocksPath;          ///< Film stock file, empty for the built-in stocks.
+    std::string lutsPath;            ///< LUT blob of scripts/cube_to_lut.py, empty for none.
+    size_t arenaBytes = (size_t) DEVELOPER_ARENA_KB * 1024; ///< Arena of each worker.
+    int benchFrames = 0;             ///< Frames of the benchmark, 0 to develop the inputs.
+};
+
+/**
+ * @struct WorkerState
+ * @brief Memory and film look of one worker, the grain moves from frame to frame.
+ */
+struct WorkerState {
+    std::vector<uint8_t> buffer; ///< Memory of the arena.
+    ImageArena arena;            ///< Arena of the developer.
+    FilmGrain grain;             ///< Grain of the film look.
+    FilmProcess process;         ///< Film look.
+
+    explicit WorkerState(size_t bytes) : buffer(bytes), arena(buffer.data(), bytes) {}
+};
+
+/**
+ * @struct Developer
+ * @brief What every frame is developed with, shared read-only by the workers.
+ */
+struct Developer {
+    const Options* options;                         ///< Command line.
+    FilmRegistry stocks;                            ///< Film stocks.
+    const FilmStock* stock = nullptr;               ///< Stock of the film look and the border.
+    MappedFile lutFile;                             ///< Mapped LUT blob.
+    ColorLut lut;                                   ///< LUT of the film, when the blob has one.
+    std::vector<std::unique_ptr<WorkerState>> workers; ///< State of each worker.
+    std::atomic<int> developed{0};                  ///< Frames developed.
+    std::atomic<int> asShot{0};                     ///< Frames kept as shot, a stage failed.
+    std::atomic<int> failed{0};                     ///< Frames not written.
+    std::atomic<uint64_t> bytesIn{0};               ///< Bytes of the frames read.
+    std::atomic<uint64_t> bytesOut{0};              ///< Bytes of the frames written.
+};
+
+static void printUsage() {
+    printf("Usage: retrolens-develop [options] -o OUTPUT ROLL...\n"
+           "       retrolens-develop [options] --bench FRAMES\n"
+           "\n"
+           "Develops roll folders or tar containers of frames copied off the camera, with the\n"
+           "code the camera develops them with. Each roll goes to a folder of OUTPUT. The turn,\n"
+           "the stamp and the border give the camera's bytes with its arena (--arena-kb); the\n"
+           "film look is developed here alone, the camera puts its look on the raw frame.\n"
+           "\n"
+           "  -o, --output DIR    Folder of the developed rolls\n"
+           "  -j, --threads N     Worker threads, one per core by default\n"
+           "  --rotate DEGREES    0, 90, 180 or 270, clockwise\n"
+           "  --crop FORMAT       full, 3:2 or square\n"
+           "  --date TEXT         Date stamp, as the camera prints it: \"'24 10 19\"\n"
+           "  --border            Film border, with the film name and the frame numbers\n"
+           "  --look              Film look of the film on the decoded frame: curves, color LUT and\n"
+           "                      grain seeded by the frame, not the bytes of the camera's film mode\n"
+           "  --no-grain          Film look without grain\n"
+           "  --film NAME         Film stock of the look and the border, the first by default\n"
+           "  --stocks FILE       Film stock file, as on the card, the built-in stocks by default\n"
+           "  --luts FILE         Color LUT blob of scripts/cube_to_lut.py, as in the flash\n"
+           "  --arena-kb KB       Memory of each worker, 16 MB so no stage is left out; the KB the\n"
+           "                      camera logs as image-arena to leave out what it leaves out\n"
+           "  --bench FRAMES      Develop synthetic frames with 1, 2, 4... threads and report images/s\n");
+}
+
+static bool parseOptions(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if ((arg == "-o" || arg == "--output") && hasValue) {
+            options->output = argv[++i];
+        } else if ((arg == "-j" || arg == "--threads") && hasValue) {
+            options->threads = atoi(argv[++i]);
+        } else if (arg == "--rotate" && hasValue) {
+            int degrees = atoi(argv[++i]);
+            if (degrees % 90 != 0 || degrees < 0 || degrees >= 360) {
+                return false;
+            }
+            options->rotation = degrees / 90;
+        } else if (arg == "--crop" && hasValue) {
+            std::string crop = argv[++i];
+            if (crop == "full") {
+                options->crop = JPEG_CROP_FULL;
+            } else if (crop == "3:2") {
+                options->crop = JPEG_CROP_3_2;
+            } else if (crop == "square") {
+                options->crop = JPEG_CROP_SQUARE;
+            } else {
+                return false;
+            }
+        } else if (arg == "--date" && hasValue) {
+            options->dateText = argv[++i];
+            if (options->dateText.size() >= DATE_STAMP_MAX_CHARS) {
+                return false;
+            }
+        } else if (arg == "--border") {
+            options->border = true;
+        } else if (arg == "--look") {
+            options->look = true;
+        } else if (arg == "--no-grain") {
+            options->grain = false;
+        } else if (arg == "--film" && hasValue) {
+            options->film = argv[++i];
+        } else if (arg == "--stocks" && hasValue) {
+            options->stocksPath = argv[++i];
+        } else if (arg == "--luts" && hasValue) {
+            options->lutsPath = argv[++i];
+        } else if (arg == "--arena-kb" && hasValue) {
+            options->arenaBytes = (size_t) atol(argv[++i]) * 1024;
+        } else if (arg == "--bench" && hasValue) {
+            options->benchFrames = atoi(argv[++i]);
+        } else if (!arg.empty() && arg[0] != '-') {
+            options->inputs.push_back(arg);
+        } else {
+            return false;
+        }
+    }
+    if (options->threads <= 0) {
+        options->threads = (int) std::thread::hardware_concurrency();
+        options->threads = options->threads > 0 ? options->threads : 1;
+    }
+    if (options->benchFrames > 0) {
+        return true;
+    }
+    return !options->inputs.empty() && !options->output.empty();
+}
+
+static bool makeFolders(const std::string& path) {
+    for (size_t slash = path.find('/', 1); ; slash = path.find('/', slash + 1)) {
+        std::string folder = path.substr(0, slash);
+        if (mkdir(folder.c_str(), 0755) != 0 && errno != EEXIST) {
+            return false;
+        }
+        if (slash == std::string::npos) {
+            return true;
+        }
+    }
+}
+
+static bool setUpFilm(Developer* developer) {
+    const Options& options = *developer->options;
+    std::string text = BUILTIN_FILM_STOCKS;
+    if (!options.stocksPath.empty()) {
+        MappedFile file;
+        if (!file.openRead(options.stocksPath.c_str())) {
+            fprintf(stderr, "films: cannot read %s\n", options.stocksPath.c_str());
+            return false;
+        }
+        text.assign(reinterpret_cast<const char*>(file.getData()), file.getSize());
+    }
+    int result = developer->stocks.parse(text.data(), text.size());
+    if (result < 0) {
+        fprintf(stderr, "films: error %d on line %d\n", result, developer->stocks.getErrorLine());
+        return false;
+    }
+    int index = options.film.empty() ? 0 : developer->stocks.find(options.film.c_str());
+    developer->stock = developer->stocks.getStock(index);
+    if (developer->stock == nullptr) {
+        fprintf(stderr, "films: no film stock %s\n", options.film.c_str());
+        return false;
+    }
+
+    // The LUT blob is the one flashed to the LUT partition, each LUT named after its film
+    const ColorLut* lut = nullptr;
+    if (!options.lutsPath.empty()) {
+        if (!developer->lutFile.openRead(options.lutsPath.c_str()) ||
+            !developer->lut.load(developer->lutFile.getData(), developer->lutFile.getSize(), developer->stock->name)) {
+            fprintf(stderr, "films: no LUT of %s in %s\n", developer->stock->name, options.lutsPath.c_str());
+            return false;
+        }
+        lut = &developer->lut;
+    }
+    // The grain tiles are named after their films too, a film without one is developed without grain
+    const GrainTile* grainTile = options.grain ? findGrainTile(developer->stock->name) : nullptr;
+    if (options.grain && grainTile == nullptr) {
+        fprintf(stderr, "films: no grain of %s, developed without it\n", developer->stock->name);
+    }
+    for (int i = 0; i < options.threads; i++) {
+        WorkerState* worker = new WorkerState(options.arenaBytes);
+        worker->process.setLook(FilmLook{developer->stock->contrast, developer->stock->saturation});
+        worker->process.setColorLut(lut);
+        if (grainTile != nullptr) {
+            worker->grain.setTile(grainTile);
+            worker->process.setGrain(&worker->grain);
+        }
+        developer->workers.emplace_back(worker);
+    }
+    return true;
+}
+
+/**
+ * @brief Develop a frame into a buffer, or copy it as shot if a stage fails, as the camera does.
+ *
+ * @return int JPEG_OK if developed, the error of the developer if kept as shot, or -1 if it does not fit.
+ */
+static int developFrame(Developer* developer, WorkerState* worker, const RollFrame& frame, uint8_t* out, size_t capacity,
+                        size_t* length) {
+    const Options& options = *developer->options;
+    DevelopSettings settings;
+    char label[FILM_BORDER_MAX_CHARS];
+    FrameDeveloper::setCameraStages(&settings, options.rotation, options.crop,
+                                    options.dateText.empty() ? nullptr : options.dateText.c_str(),
+                                    options.border ? developer->stock->name : nullptr, frame.number, label);
+    if (options.look) {
+        // Host only, the grain lands where the frame puts it, the same every run and on every thread count
+        worker->grain.newFrame(StandbyStore::crc32(frame.data, frame.length));
+        settings.look = &worker->process;
+    }
+
+    if (!FrameDeveloper::isNeeded(settings)) {
+        // Nothing asked for, the roll is copied
+        if (frame.length > capacity) {
+            return -1;
+        }
+        memcpy(out, frame.data, frame.length);
+        *length = frame.length;
+        return JPEG_OK;
+    }
+
+    MemorySink sink = {out, capacity, 0};
+    FrameDeveloper frameDeveloper(&worker->arena, FILM_BORDER_ART);
+    int result = frameDeveloper.write(frame.data, frame.length, settings, FrameDeveloper::writeToMemory, &sink);
+    for (int stage = 0; stage < DEVELOP_STAGE_COUNT; stage++) {
+        int stageResult = frameDeveloper.getStageResult(stage);
+        if (stageResult != JPEG_OK && stageResult != DEVELOP_STAGE_SKIPPED) {
+            fprintf(stderr, "%s/%s: %s failed with error %d, left out\n", frame.roll.c_str(), frame.name.c_str(),
+                    FrameDeveloper::getStageName(stage), stageResult);
+        }
+    }
+    if (result == JPEG_OK) {
+        *length = sink.used;
+        return JPEG_OK;
+    }
+    if (frame.length > capacity) {
+        return -1;
+    }
+    memcpy(out, frame.data, frame.length);
+    *length = frame.length;
+    return result;
+}
+
+static void countFrame(Developer* developer, const RollFrame& frame, int result, size_t length) {
+    developer->bytesIn += frame.length;
+    if (result < 0) {
+        developer->failed++;
+        return;
+    }
+    developer->bytesOut += length;
+    if (result == JPEG_OK) {
+        developer->developed++;
+    } else {
+        developer->asShot++;
+        fprintf(stderr, "%s/%s: error %d, kept as shot\n", frame.roll.c_str(), frame.name.c_str(), result);
+    }
+}
+
+static void developToFile(Developer* developer, int worker, const RollFrame& frame) {
+    std::string path = developer->options->output + "/" + frame.roll + "/" + frame.name;
+    MappedFile out;
+    size_t capacity = frame.length * DEVELOPER_OUTPUT_FACTOR + DEVELOPER_OUTPUT_SLACK;
+    if (!out.create(path.c_str(), capacity)) {
+        fprintf(stderr, "%s: cannot write\n", path.c_str());
+        countFrame(developer, frame, -1, 0);
+        return;
+    }
+    size_t length = 0;
+    int result = developFrame(developer, developer->workers[worker].get(), frame, out.getData(), capacity, &length);
+    if (!out.close(result < 0 ? 0 : length)) {
+        result = -1;
+    }
+    countFrame(developer, frame, result, length);
+}
+
+static int developRolls(Developer* developer) {
+    const Options& options = *developer->options;
+    RollSet rolls;
+    for (const std::string& input : options.inputs) {
+        int count = rolls.add(input);
+        if (count < 0) {
+            fprintf(stderr, "%s: cannot read the roll\n", input.c_str());
+            return 2;
+        }
+        printf("%s: %d frames\n", input.c_str(), count);
+    }
+    for (const std::string& roll : rolls.getRolls()) {
+        if (!makeFolders(options.output + "/" + roll)) {
+            fprintf(stderr, "%s/%s: cannot create the folder\n", options.output.c_str(), roll.c_str());
+            return 2;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t stolen;
+    {
+        WorkStealingPool pool(options.threads);
+        for (const RollFrame& frame : rolls.getFrames()) {
+            pool.submit([developer, &frame](int worker) { developToFile(developer, worker, frame); });
+        }
+        pool.wait();
+        stolen = pool.getStolenCount();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    int frames = (int) rolls.getFrames().size();
+    printf("%d frames developed, %d kept as shot, %d failed, %.1f to %.1f MB in %.2f s, %.1f images/s on %d threads, "
+           "%lu stolen\n",
+           developer->developed.load(), developer->asShot.load(), developer->failed.load(), developer->bytesIn / 1e6,
+           developer->bytesOut / 1e6, seconds, seconds > 0 ? frames / seconds : 0.0, options.threads,
+           (unsigned long) stolen);
+    return developer->failed > 0 ? 2 : 0;
+}
+
+// A busy scene, different for every frame, coded as the camera codes its frames
+static int makeBenchFrame(int index, std::vector<uint8_t>* jpeg) {
+    size_t rowBytes = (size_t) BENCH_WIDTH * JPEG_YCC_BYTES;
+    uint8_t lumaQuant[JPEG_BLOCK_SIZE];
+    uint8_t chromaQuant[JPEG_BLOCK_SIZE];
+    jpegScaleQuantTable(JPEG_STD_LUMA_QUANT, BENCH_QUALITY, lumaQuant);
+    jpegScaleQuantTable(JPEG_STD_CHROMA_QUANT, BENCH_QUALITY, chromaQuant);
+
+    // A coded frame is far smaller than its pixels
+    jpeg->resize(rowBytes * BENCH_HEIGHT);
+    MemorySink sink = {jpeg->data(), jpeg->size(), 0};
+    JpegEncoder encoder;
+    int result = encoder.begin(BENCH_WIDTH, BENCH_HEIGHT, JPEG_SUBSAMPLING_422, lumaQuant, chromaQuant,
+                               FrameDeveloper::writeToMemory, &sink);
+    std::vector<uint8_t> strip(rowBytes * encoder.getStripHeight());
+    for (int top = 0; result == JPEG_OK && top < BENCH_HEIGHT; top += encoder.getStripHeight()) {
+        for (int y = 0; y < encoder.getStripHeight(); y++) {
+            for (int x = 0; x < BENCH_WIDTH; x++) {
+                uint8_t* pixel = &strip[y * rowBytes + (size_t) x * JPEG_YCC_BYTES];
+                int row = top + y;
+                pixel[0] = (uint8_t) (110 + 60 * sin(x * 0.01 + row * 0.007 + index) + 40 * cos(row * 0.03) * sin(x * 0.005));
+                pixel[1] = (uint8_t) (128 + 30 * sin(row * 0.002 + index));
+                pixel[2] = (uint8_t) (128 + 30 * cos(x * 0.002));
+            }
+        }
+        result = encoder.encodeStrip(strip.data(), rowBytes);
+    }
+    if (result == JPEG_OK) {
+        result = encoder.finish();
+    }
+    jpeg->resize(sink.used);
+    return result;
+}
+
+static int runBench(Developer* developer) {
+    const Options& options = *developer->options;
+    int count = options.benchFrames;
+    std::vector<std::vector<uint8_t>> sources;
+    std::vector<RollFrame> frames;
+    sources.resize(count);
+    for (int i = 0; i < count; i++) {
+        int result = makeBenchFrame(i, &sources[i]);
+        if (result != JPEG_OK) {
+            fprintf(stderr, "bench: cannot code frame %d, error %d\n", i + 1, result);
+            return 1;
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "%04d.jpg", i + 1);
+        frames.push_back(RollFrame{"bench", name, sources[i].data(), sources[i].size(), i + 1});
+    }
+
+    std::vector<int> threadCounts;
+    for (int threads = 1; threads < options.threads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(options.threads);
+
+    printf("%d frames of %dx%d, %u cores\n", count, BENCH_WIDTH, BENCH_HEIGHT, std::thread::hardware_concurrency());
+    printf("threads  images/s  speedup  stolen  same bytes\n");
+    std::vector<std::vector<uint8_t>> reference;
+    double baseline = 0;
+    bool same = true;
+    for (int threads : threadCounts) {
+        std::vector<std::vector<uint8_t>> outputs(count);
+        std::vector<size_t> lengths(count);
+        std::vector<int> results(count);
+        for (int i = 0; i < count; i++) {
+            outputs[i].resize(frames[i].length * DEVELOPER_OUTPUT_FACTOR + DEVELOPER_OUTPUT_SLACK);
+        }
+        auto start = std::chrono::steady_clock::now();
+        uint64_t stolen;
+        {
+            WorkStealingPool pool(threads);
+            for (int i = 0; i < count; i++) {
+                pool.submit([&, i](int worker) {
+                    results[i] = developFrame(developer, developer->workers[worker].get(), frames[i], outputs[i].data(),
+                                              outputs[i].size(), &lengths[i]);
+                });
+            }
+            pool.wait();
+            stolen = pool.getStolenCount();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        for (int i = 0; i < count; i++) {
+            if (results[i] != JPEG_OK) {
+                fprintf(stderr, "bench: frame %d failed with error %d\n", i + 1, results[i]);
+                return 2;
+            }
+            outputs[i].resize(lengths[i]);
+        }
+        double rate = count / seconds;
+        if (reference.empty()) {
+            reference = outputs;
+            baseline = rate;
+        }
+        bool identical = outputs == reference;
+        same = same && identical;
+        printf("%7d  %8.2f  %6.2fx  %6lu  %s\n", threads, rate, rate / baseline, (unsigned long) stolen,
+               identical ? "yes" : "NO");
+    }
+    return same ? 0 : 2;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        printUsage();
+        return 1;
+    }
+    if (options.benchFrames > 0 && !options.look && options.dateText.empty() && !options.border &&
+        options.rotation == JPEG_ROTATE_0 && options.crop == JPEG_CROP_FULL) {
+        // A benchmark of nothing, develop the way a film shot would be
+        options.look = true;
+        options.dateText = "'24 10 19";
+        options.border = true;
+    }
+
+    Developer developer;
+    developer.options = &options;
+    if (!setUpFilm(&developer)) {
+        return 2;
+    }
+    return options.benchFrames > 0 ? runBench(&developer) : developRolls(&developer);
+}